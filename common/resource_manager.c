@@ -38,6 +38,14 @@ extern const uint8_t res[];
 
 
 error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
+{
+   //Retrieve the location and the length of the resource
+   return resGetDataEx(path, data, length, NULL);
+}
+
+
+error_t resGetDataEx(const char_t *path, const uint8_t **data, size_t *length,
+   const ResFileInfo **info)
 {
    bool_t found;
    bool_t match;
@@ -127,7 +135,7 @@ error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
    if(!found)
       return ERROR_NOT_FOUND;
    //Enforce the entry type
-   if(resEntry->type != RES_TYPE_FILE)
+   if(resEntry->type != RES_TYPE_FILE && resEntry->type != RES_TYPE_FILE_EX)
       return ERROR_NOT_FOUND;
 
    //Return the location of the specified resource
@@ -135,6 +143,23 @@ error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
    //Return the length of the resource
    *length = letoh32(resEntry->dataLength);
 
+   //The file information record is optional
+   if(info != NULL)
+   {
+      //Check whether the payload is preceded by a file information record
+      if(resEntry->type == RES_TYPE_FILE_EX &&
+         letoh32(resEntry->dataStart) >= (sizeof(ResHeader) + sizeof(ResFileInfo)))
+      {
+         //Point to the file information record
+         *info = (const ResFileInfo *) (*data - sizeof(ResFileInfo));
+      }
+      else
+      {
+         //No metadata available for this resource
+         *info = NULL;
+      }
+   }
+
    //Successful processing
    return NO_ERROR;
 }
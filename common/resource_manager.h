@@ -45,11 +45,18 @@ extern "C" {
 
 typedef enum
 {
-   RES_TYPE_DIR  = 1,
-   RES_TYPE_FILE = 2
+   RES_TYPE_DIR     = 1,
+   RES_TYPE_FILE    = 2,
+   RES_TYPE_FILE_EX = 3 ///<File preceded by a ResFileInfo record
 } ResType;
 
 
+//Size of the entity tag field
+#define RES_ETAG_SIZE 24
+//Size of the Last-Modified date field
+#define RES_DATE_SIZE 32
+
+
 //CC-RX, CodeWarrior or Win32 compiler?
 #if defined(__CCRX__)
    #pragma pack
@@ -96,6 +103,23 @@ typedef __packed_struct
 } ResHeader;
 
 
+/**
+ * @brief File information record
+ *
+ * The record immediately precedes the payload of RES_TYPE_FILE_EX entries.
+ * Both strings are precomputed by the resource compiler so that they can be
+ * sent as is in the ETag and Last-Modified header fields
+ **/
+
+typedef __packed_struct
+{
+   uint32_t dataLength;              ///<Length of the payload
+   uint32_t lastModified;            ///<Last modification time (Unix time)
+   char_t etag[RES_ETAG_SIZE];       ///<Strong entity tag (quoted string)
+   char_t date[RES_DATE_SIZE];       ///<Last modification time (IMF-fixdate)
+} ResFileInfo;
+
+
 //CC-RX, CodeWarrior or Win32 compiler?
 #if defined(__CCRX__)
    #pragma unpack
@@ -118,6 +142,9 @@ typedef struct
 //Resource management
 error_t resGetData(const char_t *path, const uint8_t **data, size_t *length);
 
+error_t resGetDataEx(const char_t *path, const uint8_t **data, size_t *length,
+   const ResFileInfo **info);
+
 error_t resSearchFile(const char_t *path, DirEntry *dirEntry);
 
 //error_t resOpenDirectory(Directory *directory, const DirEntry *entry);
@@ -38,6 +38,9 @@
 //Check crypto library configuration
 #if (CHACHA20_POLY1305_SUPPORT == ENABLED)
 
+//Size of the chunks that are encrypted and authenticated in a single pass
+#define CHACHA20_POLY1305_CHUNK_SIZE 512
+
 
 /**
  * @brief Authenticated encryption using ChaCha20Poly1305
@@ -60,6 +63,8 @@ error_t chacha20Poly1305Encrypt(const uint8_t *k, size_t kLen,
    const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen)
 {
    error_t error;
+   size_t i;
+   size_t m;
    size_t paddingLen;
    ChachaContext chachaContext;
    Poly1305Context poly1305Context;
@@ -82,10 +87,6 @@ error_t chacha20Poly1305Encrypt(const uint8_t *k, size_t kLen,
    //The other 256 bits of the ChaCha20 block are discarded
    chachaCipher(&chachaContext, NULL, NULL, 32);
 
-   //Next, the ChaCha20 encryption function is called to encrypt the
-   //plaintext, using the same key and nonce
-   chachaCipher(&chachaContext, p, c, length);
-
    //Initialize the Poly1305 function with the key calculated above
    poly1305Init(&poly1305Context, temp);
 
@@ -107,8 +108,20 @@ error_t chacha20Poly1305Encrypt(const uint8_t *k, size_t kLen,
       poly1305Update(&poly1305Context, temp, paddingLen);
    }
 
-   //Compute MAC over the ciphertext
-   poly1305Update(&poly1305Context, c, length);
+   //Encrypt the plaintext and authenticate the resulting ciphertext in a
+   //single pass, while the data is still in the cache
+   for(i = 0; i < length; i += m)
+   {
+      //Size of the current chunk
+      m = MIN(length - i, CHACHA20_POLY1305_CHUNK_SIZE);
+
+      //The ChaCha20 encryption function is called to encrypt the plaintext,
+      //using the same key and nonce
+      chachaCipher(&chachaContext, p + i, c + i, m);
+
+      //Compute MAC over the ciphertext
+      poly1305Update(&poly1305Context, c + i, m);
+   }
 
    //If the length of the ciphertext is not an integral multiple of 16 bytes,
    //then padding is required
@@ -166,6 +179,7 @@ error_t chacha20Poly1305Decrypt(const uint8_t *k, size_t kLen,
    error_t error;
    uint8_t mask;
    size_t i;
+   size_t m;
    size_t paddingLen;
    ChachaContext chachaContext;
    Poly1305Context poly1305Context;
@@ -209,8 +223,19 @@ error_t chacha20Poly1305Decrypt(const uint8_t *k, size_t kLen,
       poly1305Update(&poly1305Context, temp, paddingLen);
    }
 
-   //Compute MAC over the ciphertext
-   poly1305Update(&poly1305Context, c, length);
+   //Authenticate the ciphertext and decrypt it in a single pass, while the
+   //data is still in the cache
+   for(i = 0; i < length; i += m)
+   {
+      //Size of the current chunk
+      m = MIN(length - i, CHACHA20_POLY1305_CHUNK_SIZE);
+
+      //Compute MAC over the ciphertext
+      poly1305Update(&poly1305Context, c + i, m);
+
+      //Decrypt the ciphertext
+      chachaCipher(&chachaContext, c + i, p + i, m);
+   }
 
    //If the length of the ciphertext is not an integral multiple of 16 bytes,
    //then padding is required
@@ -240,9 +265,6 @@ error_t chacha20Poly1305Decrypt(const uint8_t *k, size_t kLen,
    //Compute message-authentication code
    poly1305Final(&poly1305Context, temp);
 
-   //Finally, we decrypt the ciphertext
-   chachaCipher(&chachaContext, c, p, length);
-
    //The calculated tag is bitwise compared to the received tag. The message
    //is authenticated if and only if the tags match
    for(mask = 0, i = 0; i < tLen; i++)
@@ -36,6 +36,8 @@
 //Check crypto library configuration
 #if (GCM_SUPPORT == ENABLED)
 
+#if (GCM_CT_SUPPORT == DISABLED)
+
 //Reduction table
 static const uint32_t r[GCM_TABLE_N] =
 {
@@ -78,6 +80,63 @@ static const uint32_t r[GCM_TABLE_N] =
 #endif
 };
 
+#endif
+#if (GCM_CT_SUPPORT == ENABLED)
+
+/**
+ * @brief Carry-less multiplication of two 64-bit integers (low half)
+ *
+ * Integer multiplications are performed on operands whose bits are spaced
+ * four positions apart, so that carries are confined to the unused positions
+ *
+ * @param[in] x First operand
+ * @param[in] y Second operand
+ * @return Lower 64 bits of the carry-less product
+ **/
+
+static uint64_t gcmBmul64(uint64_t x, uint64_t y)
+{
+   uint64_t x0;
+   uint64_t x1;
+   uint64_t x2;
+   uint64_t x3;
+   uint64_t y0;
+   uint64_t y1;
+   uint64_t y2;
+   uint64_t y3;
+   uint64_t z0;
+   uint64_t z1;
+   uint64_t z2;
+   uint64_t z3;
+
+   //Split the operands
+   x0 = x & 0x1111111111111111ULL;
+   x1 = x & 0x2222222222222222ULL;
+   x2 = x & 0x4444444444444444ULL;
+   x3 = x & 0x8888888888888888ULL;
+   y0 = y & 0x1111111111111111ULL;
+   y1 = y & 0x2222222222222222ULL;
+   y2 = y & 0x4444444444444444ULL;
+   y3 = y & 0x8888888888888888ULL;
+
+   //Compute the partial products
+   z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+   z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+   z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+   z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+
+   //Discard the carries
+   z0 &= 0x1111111111111111ULL;
+   z1 &= 0x2222222222222222ULL;
+   z2 &= 0x4444444444444444ULL;
+   z3 &= 0x8888888888888888ULL;
+
+   //Return the result
+   return z0 | z1 | z2 | z3;
+}
+
+#endif
+
 
 /**
  * @brief Initialize GCM context
@@ -90,9 +149,27 @@ static const uint32_t r[GCM_TABLE_N] =
 __weak_func error_t gcmInit(GcmContext *context, const CipherAlgo *cipherAlgo,
    void *cipherContext)
 {
+   //Portable implementation
+   return gcmSoftInit(context, cipherAlgo, cipherContext);
+}
+
+
+/**
+ * @brief Initialize GCM context (portable implementation)
+ * @param[in] context Pointer to the GCM context
+ * @param[in] cipherAlgo Cipher algorithm
+ * @param[in] cipherContext Pointer to the cipher algorithm context
+ * @return Error code
+ **/
+
+error_t gcmSoftInit(GcmContext *context, const CipherAlgo *cipherAlgo,
+   void *cipherContext)
+{
+#if (GCM_CT_SUPPORT == DISABLED)
    uint_t i;
    uint_t j;
    uint32_t c;
+#endif
    uint32_t h[4];
 
    //Check parameters
@@ -117,6 +194,13 @@ __weak_func error_t gcmInit(GcmContext *context, const CipherAlgo *cipherAlgo,
    context->cipherAlgo->encryptBlock(context->cipherContext, (uint8_t *) h,
       (uint8_t *) h);
 
+#if (GCM_CT_SUPPORT == ENABLED)
+   //The constant-time implementation operates directly on H
+   context->m[0][0] = betoh32(h[3]);
+   context->m[0][1] = betoh32(h[2]);
+   context->m[0][2] = betoh32(h[1]);
+   context->m[0][3] = betoh32(h[0]);
+#else
    //Pre-compute M(0) = H * 0
    j = GCM_REVERSE_BITS(0);
    context->m[j][0] = 0;
@@ -181,6 +265,7 @@ __weak_func error_t gcmInit(GcmContext *context, const CipherAlgo *cipherAlgo,
       context->m[j][2] = h[2];
       context->m[j][3] = h[3];
    }
+#endif
 
    //Successful initialization
    return NO_ERROR;
@@ -211,6 +296,7 @@ __weak_func error_t gcmEncrypt(GcmContext *context, const uint8_t *iv,
    uint8_t b[16];
    uint8_t j[16];
    uint8_t s[16];
+   uint8_t o[CIPHER_MAX_PARALLEL_BLOCKS * 16];
 
    //Make sure the GCM context is valid
    if(context == NULL)
@@ -237,23 +323,8 @@ __weak_func error_t gcmEncrypt(GcmContext *context, const uint8_t *iv,
       //Initialize GHASH calculation
       osMemset(j, 0, 16);
 
-      //Length of the IV
-      n = ivLen;
-
       //Process the initialization vector
-      while(n > 0)
-      {
-         //The IV is processed in a block-by-block fashion
-         k = MIN(n, 16);
-
-         //Apply GHASH function
-         gcmXorBlock(j, j, iv, k);
-         gcmMul(context, j);
-
-         //Next block
-         iv += k;
-         n -= k;
-      }
+      gcmUpdateGhash(context, j, iv, ivLen);
 
       //The string is appended with 64 additional 0 bits, followed by the
       //64-bit representation of the length of the IV
@@ -262,8 +333,7 @@ __weak_func error_t gcmEncrypt(GcmContext *context, const uint8_t *iv,
 
       //The GHASH function is applied to the resulting string to form the
       //pre-counter block
-      gcmXorBlock(j, j, b, 16);
-      gcmMul(context, j);
+      gcmGhash(context, j, b, 1);
    }
 
    //Compute MSB(CIPH(J(0)))
@@ -272,45 +342,30 @@ __weak_func error_t gcmEncrypt(GcmContext *context, const uint8_t *iv,
 
    //Initialize GHASH calculation
    osMemset(s, 0, 16);
-   //Length of the AAD
-   n = aLen;
 
    //Process AAD
-   while(n > 0)
-   {
-      //Additional data are processed in a block-by-block fashion
-      k = MIN(n, 16);
-
-      //Apply GHASH function
-      gcmXorBlock(s, s, a, k);
-      gcmMul(context, s);
-
-      //Next block
-      a += k;
-      n -= k;
-   }
+   gcmUpdateGhash(context, s, a, aLen);
 
    //Length of the plaintext
    n = length;
 
-   //Process plaintext
+   //The encryption and the GHASH computation are performed in a single
+   //pass, several blocks at a time
    while(n > 0)
    {
-      //The encryption operates in a block-by-block fashion
-      k = MIN(n, 16);
+      //Number of bytes to process at a time
+      k = MIN(n, CIPHER_MAX_PARALLEL_BLOCKS * 16);
 
-      //Increment counter
-      gcmIncCounter(j);
+      //Generate the key stream
+      gcmGenerateKeyStream(context, j, o, (k + 15) / 16);
 
       //Encrypt plaintext
-      context->cipherAlgo->encryptBlock(context->cipherContext, j, b);
-      gcmXorBlock(c, p, b, k);
+      gcmXorBlock(c, p, o, k);
 
-      //Apply GHASH function
-      gcmXorBlock(s, s, c, k);
-      gcmMul(context, s);
+      //Apply GHASH function to the resulting ciphertext
+      gcmUpdateGhash(context, s, c, k);
 
-      //Next block
+      //Next blocks
       p += k;
       c += k;
       n -= k;
@@ -323,8 +378,7 @@ __weak_func error_t gcmEncrypt(GcmContext *context, const uint8_t *iv,
 
    //The GHASH function is applied to the result to produce a single output
    //block S
-   gcmXorBlock(s, s, b, 16);
-   gcmMul(context, s);
+   gcmGhash(context, s, b, 1);
 
    //Let T = MSB(GCTR(J(0), S)
    gcmXorBlock(t, t, s, tLen);
@@ -360,6 +414,7 @@ __weak_func error_t gcmDecrypt(GcmContext *context, const uint8_t *iv,
    uint8_t j[16];
    uint8_t r[16];
    uint8_t s[16];
+   uint8_t o[CIPHER_MAX_PARALLEL_BLOCKS * 16];
 
    //Make sure the GCM context is valid
    if(context == NULL)
@@ -386,23 +441,8 @@ __weak_func error_t gcmDecrypt(GcmContext *context, const uint8_t *iv,
       //Initialize GHASH calculation
       osMemset(j, 0, 16);
 
-      //Length of the IV
-      n = ivLen;
-
       //Process the initialization vector
-      while(n > 0)
-      {
-         //The IV is processed in a block-by-block fashion
-         k = MIN(n, 16);
-
-         //Apply GHASH function
-         gcmXorBlock(j, j, iv, k);
-         gcmMul(context, j);
-
-         //Next block
-         iv += k;
-         n -= k;
-      }
+      gcmUpdateGhash(context, j, iv, ivLen);
 
       //The string is appended with 64 additional 0 bits, followed by the
       //64-bit representation of the length of the IV
@@ -411,8 +451,7 @@ __weak_func error_t gcmDecrypt(GcmContext *context, const uint8_t *iv,
 
       //The GHASH function is applied to the resulting string to form the
       //pre-counter block
-      gcmXorBlock(j, j, b, 16);
-      gcmMul(context, j);
+      gcmGhash(context, j, b, 1);
    }
 
    //Compute MSB(CIPH(J(0)))
@@ -421,45 +460,30 @@ __weak_func error_t gcmDecrypt(GcmContext *context, const uint8_t *iv,
 
    //Initialize GHASH calculation
    osMemset(s, 0, 16);
-   //Length of the AAD
-   n = aLen;
 
    //Process AAD
-   while(n > 0)
-   {
-      //Additional data are processed in a block-by-block fashion
-      k = MIN(n, 16);
-
-      //Apply GHASH function
-      gcmXorBlock(s, s, a, k);
-      gcmMul(context, s);
-
-      //Next block
-      a += k;
-      n -= k;
-   }
+   gcmUpdateGhash(context, s, a, aLen);
 
    //Length of the ciphertext
    n = length;
 
-   //Process ciphertext
+   //The GHASH computation and the decryption are performed in a single
+   //pass, several blocks at a time
    while(n > 0)
    {
-      //The decryption operates in a block-by-block fashion
-      k = MIN(n, 16);
+      //Number of bytes to process at a time
+      k = MIN(n, CIPHER_MAX_PARALLEL_BLOCKS * 16);
 
-      //Apply GHASH function
-      gcmXorBlock(s, s, c, k);
-      gcmMul(context, s);
+      //Generate the key stream
+      gcmGenerateKeyStream(context, j, o, (k + 15) / 16);
 
-      //Increment counter
-      gcmIncCounter(j);
+      //Apply GHASH function to the ciphertext
+      gcmUpdateGhash(context, s, c, k);
 
       //Decrypt ciphertext
-      context->cipherAlgo->encryptBlock(context->cipherContext, j, b);
-      gcmXorBlock(p, c, b, k);
+      gcmXorBlock(p, c, o, k);
 
-      //Next block
+      //Next blocks
       c += k;
       p += k;
       n -= k;
@@ -472,8 +496,7 @@ __weak_func error_t gcmDecrypt(GcmContext *context, const uint8_t *iv,
 
    //The GHASH function is applied to the result to produce a single output
    //block S
-   gcmXorBlock(s, s, b, 16);
-   gcmMul(context, s);
+   gcmGhash(context, s, b, 1);
 
    //Let R = MSB(GCTR(J(0), S))
    gcmXorBlock(r, r, s, tLen);
@@ -498,6 +521,97 @@ __weak_func error_t gcmDecrypt(GcmContext *context, const uint8_t *iv,
 
 __weak_func void gcmMul(GcmContext *context, uint8_t *x)
 {
+   //Portable implementation
+   gcmSoftMul(context, x);
+}
+
+
+/**
+ * @brief Multiplication operation in GF(2^128) (portable implementation)
+ * @param[in] context Pointer to the GCM context
+ * @param[in, out] x 16-byte block to be multiplied by H
+ **/
+
+void gcmSoftMul(GcmContext *context, uint8_t *x)
+{
+#if (GCM_CT_SUPPORT == ENABLED)
+   uint64_t h0;
+   uint64_t h1;
+   uint64_t h2;
+   uint64_t h0r;
+   uint64_t h1r;
+   uint64_t h2r;
+   uint64_t y0;
+   uint64_t y1;
+   uint64_t y2;
+   uint64_t y0r;
+   uint64_t y1r;
+   uint64_t y2r;
+   uint64_t z0;
+   uint64_t z1;
+   uint64_t z2;
+   uint64_t z0h;
+   uint64_t z1h;
+   uint64_t z2h;
+   uint64_t v0;
+   uint64_t v1;
+   uint64_t v2;
+   uint64_t v3;
+
+   //Load the hash subkey H
+   h1 = ((uint64_t) context->m[0][3] << 32) | context->m[0][2];
+   h0 = ((uint64_t) context->m[0][1] << 32) | context->m[0][0];
+
+   //Load the input block
+   y1 = LOAD64BE(x);
+   y0 = LOAD64BE(x + 8);
+
+   //The high halves of the 64x64 products are obtained by multiplying the
+   //bit-reversed operands
+   h0r = reverseInt64(h0);
+   h1r = reverseInt64(h1);
+   h2 = h0 ^ h1;
+   h2r = h0r ^ h1r;
+   y0r = reverseInt64(y0);
+   y1r = reverseInt64(y1);
+   y2 = y0 ^ y1;
+   y2r = y0r ^ y1r;
+
+   //Compute the 256-bit carry-less product (Karatsuba method)
+   z0 = gcmBmul64(y0, h0);
+   z1 = gcmBmul64(y1, h1);
+   z2 = gcmBmul64(y2, h2);
+   z0h = gcmBmul64(y0r, h0r);
+   z1h = gcmBmul64(y1r, h1r);
+   z2h = gcmBmul64(y2r, h2r);
+
+   z2 ^= z0 ^ z1;
+   z2h ^= z0h ^ z1h;
+   z0h = reverseInt64(z0h) >> 1;
+   z1h = reverseInt64(z1h) >> 1;
+   z2h = reverseInt64(z2h) >> 1;
+
+   v0 = z0;
+   v1 = z0h ^ z2;
+   v2 = z1 ^ z2h;
+   v3 = z1h;
+
+   //Shift the product left by one bit, since the operands are bit-reflected
+   v3 = (v3 << 1) | (v2 >> 63);
+   v2 = (v2 << 1) | (v1 >> 63);
+   v1 = (v1 << 1) | (v0 >> 63);
+   v0 = (v0 << 1);
+
+   //Reduce the result modulo x^128 + x^7 + x^2 + x + 1
+   v2 ^= v0 ^ (v0 >> 1) ^ (v0 >> 2) ^ (v0 >> 7);
+   v1 ^= (v0 << 63) ^ (v0 << 62) ^ (v0 << 57);
+   v3 ^= v1 ^ (v1 >> 1) ^ (v1 >> 2) ^ (v1 >> 7);
+   v2 ^= (v1 << 63) ^ (v1 << 62) ^ (v1 << 57);
+
+   //Save the result
+   STORE64BE(v3, x);
+   STORE64BE(v2, x + 8);
+#else
    int_t i;
    uint8_t b;
    uint8_t c;
@@ -574,6 +688,66 @@ __weak_func void gcmMul(GcmContext *context, uint8_t *x)
    STORE32BE(z[2], x + 4);
    STORE32BE(z[1], x + 8);
    STORE32BE(z[0], x + 12);
+#endif
+}
+
+
+/**
+ * @brief Apply GHASH function to several complete blocks
+ * @param[in] context Pointer to the GCM context
+ * @param[in,out] s GHASH state
+ * @param[in] x Pointer to the 16-byte blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+__weak_func void gcmGhash(GcmContext *context, uint8_t *s, const uint8_t *x,
+   size_t n)
+{
+   //Process the blocks one after the other
+   for(; n > 0; n--)
+   {
+      //Compute S = (S + X) * H
+      gcmXorBlock(s, s, x, 16);
+      gcmMul(context, s);
+
+      //Next block
+      x += 16;
+   }
+}
+
+
+/**
+ * @brief Apply GHASH function to a string of arbitrary length
+ * @param[in] context Pointer to the GCM context
+ * @param[in,out] s GHASH state
+ * @param[in] data Pointer to the data (the last block is padded with zeroes)
+ * @param[in] length Length of the data, in bytes
+ **/
+
+void gcmUpdateGhash(GcmContext *context, uint8_t *s, const uint8_t *data,
+   size_t length)
+{
+   size_t n;
+
+   //Number of complete blocks
+   n = length / 16;
+
+   //Process the complete blocks at once
+   if(n > 0)
+   {
+      gcmGhash(context, s, data, n);
+   }
+
+   //Remaining bytes to process
+   n *= 16;
+   length -= n;
+
+   //The last block is padded with zeroes
+   if(length > 0)
+   {
+      gcmXorBlock(s, s, data + n, length);
+      gcmMul(context, s);
+   }
 }
 
 
@@ -597,6 +771,47 @@ void gcmXorBlock(uint8_t *x, const uint8_t *a, const uint8_t *b, size_t n)
 }
 
 
+/**
+ * @brief Generate several key stream blocks
+ * @param[in] context Pointer to the GCM context
+ * @param[in,out] ctr Pointer to the counter block
+ * @param[out] output Key stream blocks
+ * @param[in] n Number of blocks to generate
+ **/
+
+void gcmGenerateKeyStream(GcmContext *context, uint8_t *ctr, uint8_t *output,
+   size_t n)
+{
+   size_t i;
+
+   //Generate the successive counter blocks
+   for(i = 0; i < n; i++)
+   {
+      //Increment counter
+      gcmIncCounter(ctr);
+      //Save the current counter block
+      osMemcpy(output + i * 16, ctr, 16);
+   }
+
+   //Check whether the cipher can process several blocks at a time
+   if(context->cipherAlgo->encryptBlocks != NULL)
+   {
+      //Encrypt the counter blocks
+      context->cipherAlgo->encryptBlocks(context->cipherContext, output,
+         output, n);
+   }
+   else
+   {
+      //Encrypt the counter blocks one at a time
+      for(i = 0; i < n; i++)
+      {
+         context->cipherAlgo->encryptBlock(context->cipherContext,
+            output + i * 16, output + i * 16);
+      }
+   }
+}
+
+
 /**
  * @brief Increment counter block
  * @param[in,out] ctr Pointer to the counter block
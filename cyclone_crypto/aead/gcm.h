@@ -31,6 +31,18 @@
 //Dependencies
 #include "core/crypto.h"
 
+//Application specific context
+#ifndef GCM_PRIVATE_CONTEXT
+   #define GCM_PRIVATE_CONTEXT
+#endif
+
+//Constant-time GHASH computation (no precalculated table)
+#ifndef GCM_CT_SUPPORT
+   #define GCM_CT_SUPPORT DISABLED
+#elif (GCM_CT_SUPPORT != ENABLED && GCM_CT_SUPPORT != DISABLED)
+   #error GCM_CT_SUPPORT parameter is not valid
+#endif
+
 //Precalculated table width, in bits
 #ifndef GCM_TABLE_W
    #define GCM_TABLE_W 4
@@ -39,7 +51,10 @@
 #endif
 
 //4-bit or 8-bit precalculated table?
-#if (GCM_TABLE_W == 4)
+#if (GCM_CT_SUPPORT == ENABLED)
+   #define GCM_TABLE_N 1
+   #define GCM_REVERSE_BITS(n) 0
+#elif (GCM_TABLE_W == 4)
    #define GCM_TABLE_N 16
    #define GCM_REVERSE_BITS(n) reverseInt4(n)
 #else
@@ -62,6 +77,7 @@ typedef struct
    const CipherAlgo *cipherAlgo; ///<Cipher algorithm
    void *cipherContext;          ///<Cipher algorithm context
    uint32_t m[GCM_TABLE_N][4];   ///<Precalculated table
+   GCM_PRIVATE_CONTEXT
 } GcmContext;
 
 
@@ -69,6 +85,9 @@ typedef struct
 error_t gcmInit(GcmContext *context, const CipherAlgo *cipherAlgo,
    void *cipherContext);
 
+error_t gcmSoftInit(GcmContext *context, const CipherAlgo *cipherAlgo,
+   void *cipherContext);
+
 error_t gcmEncrypt(GcmContext *context, const uint8_t *iv,
    size_t ivLen, const uint8_t *a, size_t aLen, const uint8_t *p,
    uint8_t *c, size_t length, uint8_t *t, size_t tLen);
@@ -78,7 +97,15 @@ error_t gcmDecrypt(GcmContext *context, const uint8_t *iv,
    uint8_t *p, size_t length, const uint8_t *t, size_t tLen);
 
 void gcmMul(GcmContext *context, uint8_t *x);
+void gcmSoftMul(GcmContext *context, uint8_t *x);
+void gcmGhash(GcmContext *context, uint8_t *s, const uint8_t *x, size_t n);
+
+void gcmUpdateGhash(GcmContext *context, uint8_t *s, const uint8_t *data,
+   size_t length);
+
 void gcmXorBlock(uint8_t *x, const uint8_t *a, const uint8_t *b, size_t n);
+void gcmGenerateKeyStream(GcmContext *context, uint8_t *ctr, uint8_t *output,
+   size_t n);
 void gcmIncCounter(uint8_t *ctr);
 
 //C++ guard
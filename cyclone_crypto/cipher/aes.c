@@ -218,7 +218,9 @@ const CipherAlgo aesCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) aesEncryptBlock,
    (CipherAlgoDecryptBlock) aesDecryptBlock,
-   (CipherAlgoDeinit) aesDeinit
+   (CipherAlgoDeinit) aesDeinit,
+   (CipherAlgoEncryptBlocks) aesEncryptBlocks,
+   (CipherAlgoDecryptBlocks) aesDecryptBlocks
 };
 
 
@@ -341,6 +343,21 @@ __weak_func error_t aesInit(AesContext *context, const uint8_t *key,
 
 __weak_func void aesEncryptBlock(AesContext *context, const uint8_t *input,
    uint8_t *output)
+{
+   //Portable implementation
+   aesSoftEncryptBlock(context, input, output);
+}
+
+
+/**
+ * @brief Encrypt a 16-byte block using AES algorithm (portable implementation)
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Plaintext block to encrypt
+ * @param[out] output Ciphertext block resulting from encryption
+ **/
+
+void aesSoftEncryptBlock(AesContext *context, const uint8_t *input,
+   uint8_t *output)
 {
    uint_t i;
    uint32_t s0;
@@ -452,6 +469,21 @@ __weak_func void aesEncryptBlock(AesContext *context, const uint8_t *input,
 
 __weak_func void aesDecryptBlock(AesContext *context, const uint8_t *input,
    uint8_t *output)
+{
+   //Portable implementation
+   aesSoftDecryptBlock(context, input, output);
+}
+
+
+/**
+ * @brief Decrypt a 16-byte block using AES algorithm (portable implementation)
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Ciphertext block to decrypt
+ * @param[out] output Plaintext block resulting from decryption
+ **/
+
+void aesSoftDecryptBlock(AesContext *context, const uint8_t *input,
+   uint8_t *output)
 {
    uint_t i;
    uint32_t s0;
@@ -554,6 +586,64 @@ __weak_func void aesDecryptBlock(AesContext *context, const uint8_t *input,
 }
 
 
+/**
+ * @brief Encrypt several 16-byte blocks using AES algorithm
+ *
+ * The default implementation processes the blocks one at a time. Ports with
+ * pipelined or SIMD AES override this function
+ *
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Plaintext blocks to encrypt
+ * @param[out] output Ciphertext blocks resulting from encryption
+ * @param[in] n Number of blocks
+ **/
+
+__weak_func void aesEncryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n)
+{
+   //Process the blocks one at a time
+   while(n > 0)
+   {
+      //Encrypt current block
+      aesEncryptBlock(context, input, output);
+
+      //Next block
+      input += AES_BLOCK_SIZE;
+      output += AES_BLOCK_SIZE;
+      n--;
+   }
+}
+
+
+/**
+ * @brief Decrypt several 16-byte blocks using AES algorithm
+ *
+ * The default implementation processes the blocks one at a time. Ports with
+ * pipelined or SIMD AES override this function
+ *
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Ciphertext blocks to decrypt
+ * @param[out] output Plaintext blocks resulting from decryption
+ * @param[in] n Number of blocks
+ **/
+
+__weak_func void aesDecryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n)
+{
+   //Process the blocks one at a time
+   while(n > 0)
+   {
+      //Decrypt current block
+      aesDecryptBlock(context, input, output);
+
+      //Next block
+      input += AES_BLOCK_SIZE;
+      output += AES_BLOCK_SIZE;
+      n--;
+   }
+}
+
+
 /**
  * @brief Release AES context
  * @param[in] context Pointer to the AES context
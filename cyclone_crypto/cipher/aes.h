@@ -90,6 +90,18 @@ void aesEncryptBlock(AesContext *context, const uint8_t *input,
 void aesDecryptBlock(AesContext *context, const uint8_t *input,
    uint8_t *output);
 
+void aesSoftEncryptBlock(AesContext *context, const uint8_t *input,
+   uint8_t *output);
+
+void aesSoftDecryptBlock(AesContext *context, const uint8_t *input,
+   uint8_t *output);
+
+void aesEncryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n);
+
+void aesDecryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n);
+
 void aesDeinit(AesContext *context);
 
 //C++ guard
@@ -283,7 +283,9 @@ const CipherAlgo ariaCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) ariaEncryptBlock,
    (CipherAlgoDecryptBlock) ariaDecryptBlock,
-   (CipherAlgoDeinit) ariaDeinit
+   (CipherAlgoDeinit) ariaDeinit,
+   NULL,
+   NULL
 };
 
 
@@ -204,7 +204,9 @@ const CipherAlgo blowfishCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) blowfishEncryptBlock,
    (CipherAlgoDecryptBlock) blowfishDecryptBlock,
-   (CipherAlgoDeinit) blowfishDeinit
+   (CipherAlgoDeinit) blowfishDeinit,
+   NULL,
+   NULL
 };
 
 
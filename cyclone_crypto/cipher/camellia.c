@@ -286,7 +286,9 @@ const CipherAlgo camelliaCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) camelliaEncryptBlock,
    (CipherAlgoDecryptBlock) camelliaDecryptBlock,
-   (CipherAlgoDeinit) camelliaDeinit
+   (CipherAlgoDeinit) camelliaDeinit,
+   NULL,
+   NULL
 };
 
 
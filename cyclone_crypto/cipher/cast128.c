@@ -380,7 +380,9 @@ const CipherAlgo cast128CipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) cast128EncryptBlock,
    (CipherAlgoDecryptBlock) cast128DecryptBlock,
-   (CipherAlgoDeinit) cast128Deinit
+   (CipherAlgoDeinit) cast128Deinit,
+   NULL,
+   NULL
 };
 
 
@@ -297,7 +297,9 @@ const CipherAlgo cast256CipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) cast256EncryptBlock,
    (CipherAlgoDecryptBlock) cast256DecryptBlock,
-   (CipherAlgoDeinit) cast256Deinit
+   (CipherAlgoDeinit) cast256Deinit,
+   NULL,
+   NULL
 };
 
 
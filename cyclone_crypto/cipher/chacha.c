@@ -52,6 +52,11 @@
    b = ROL32(b, 7); \
 }
 
+//Vector holding the same word of several keystream blocks
+#if (CIPHER_VECTOR_SUPPORT == ENABLED)
+typedef uint32_t ChachaVector __attribute__((vector_size(CHACHA_PARALLEL_BLOCKS * 4)));
+#endif
+
 
 /**
  * @brief Initialize ChaCha context using the supplied key and nonce
@@ -177,72 +182,111 @@ error_t chachaInit(ChachaContext *context, uint_t nr, const uint8_t *key,
  * @param[in] length Number of bytes to be processed
  **/
 
-void chachaCipher(ChachaContext *context, const uint8_t *input,
+__weak_func void chachaCipher(ChachaContext *context, const uint8_t *input,
+   uint8_t *output, size_t length)
+{
+   //Portable implementation
+   chachaSoftCipher(context, input, output, length);
+}
+
+
+/**
+ * @brief Encrypt/decrypt data with ChaCha (portable implementation)
+ * @param[in] context Pointer to the ChaCha context
+ * @param[in] input Pointer to the data to encrypt/decrypt (optional)
+ * @param[in] output Pointer to the resulting data (optional)
+ * @param[in] length Number of bytes to be processed
+ **/
+
+void chachaSoftCipher(ChachaContext *context, const uint8_t *input,
    uint8_t *output, size_t length)
 {
    uint_t i;
-   uint_t n;
+   size_t n;
    uint8_t *k;
 
    //Encryption loop
    while(length > 0)
    {
-      //Check whether a new keystream block must be generated
-      if(context->pos == 0 || context->pos >= 64)
+      //Complete keystream blocks can be XORed directly with the input data as
+      //long as no keystream byte is pending
+      if((context->pos == 0 || context->pos >= 64) && length >= 64 &&
+         output != NULL)
       {
-         //ChaCha successively calls the ChaCha block function, with the same key
-         //and nonce, and with successively increasing block counter parameters
-         chachaProcessBlock(context);
+         //Number of bytes that form complete blocks
+         n = length - (length % 64);
 
-         //Increment block counter
-         context->state[12]++;
+         //Generate the keystream blocks
+         chachaProcessBlocks(context, input, output, n / 64);
 
-         //Propagate the carry if necessary
-         if(context->state[12] == 0)
-         {
-            context->state[13]++;
-         }
+         //Advance data pointers
+         input = (input != NULL) ? input + n : NULL;
+         output += n;
 
-         //Rewind to the beginning of the keystream block
+         //The keystream block is empty
          context->pos = 0;
       }
-
-      //Compute the number of bytes to encrypt/decrypt at a time
-      n = MIN(length, 64 - context->pos);
-
-      //Valid output pointer?
-      if(output != NULL)
+      else
       {
-         //Point to the keystream
-         k = (uint8_t *) context->block + context->pos;
-
-         //Valid input pointer?
-         if(input != NULL)
+         //Check whether a new keystream block must be generated
+         if(context->pos == 0 || context->pos >= 64)
          {
-            //XOR the input data with the keystream
-            for(i = 0; i < n; i++)
+            //ChaCha successively calls the ChaCha block function, with the same
+            //key and nonce, and with successively increasing block counter
+            //parameters
+            chachaProcessBlock(context);
+
+            //Increment block counter
+            context->state[12]++;
+
+            //Propagate the carry if necessary
+            if(context->state[12] == 0)
             {
-               output[i] = input[i] ^ k[i];
+               context->state[13]++;
             }
 
-            //Advance input pointer
-            input += n;
+            //Rewind to the beginning of the keystream block
+            context->pos = 0;
          }
-         else
+
+         //Compute the number of bytes to encrypt/decrypt at a time
+         n = MIN(length, 64 - context->pos);
+
+         //Valid output pointer?
+         if(output != NULL)
          {
-            //Output the keystream
-            for(i = 0; i < n; i++)
+            //Point to the keystream
+            k = (uint8_t *) context->block + context->pos;
+
+            //Valid input pointer?
+            if(input != NULL)
+            {
+               //XOR the input data with the keystream
+               for(i = 0; i < n; i++)
+               {
+                  output[i] = input[i] ^ k[i];
+               }
+
+               //Advance input pointer
+               input += n;
+            }
+            else
             {
-               output[i] = k[i];
+               //Output the keystream
+               for(i = 0; i < n; i++)
+               {
+                  output[i] = k[i];
+               }
             }
+
+            //Advance output pointer
+            output += n;
          }
 
-         //Advance output pointer
-         output += n;
+         //Current position in the keystream block
+         context->pos += n;
       }
 
-      //Current position in the keystream block
-      context->pos += n;
       //Remaining bytes to process
       length -= n;
    }
@@ -303,6 +347,147 @@ void chachaProcessBlock(ChachaContext *context)
 }
 
 
+/**
+ * @brief Generate several keystream blocks and XOR them with the input data
+ * @param[in] context Pointer to the ChaCha context
+ * @param[in] input Pointer to the data to encrypt/decrypt (optional)
+ * @param[out] output Pointer to the resulting data
+ * @param[in] n Number of 64-byte blocks to process
+ **/
+
+void chachaProcessBlocks(ChachaContext *context, const uint8_t *input,
+   uint8_t *output, size_t n)
+{
+   uint_t i;
+   uint32_t k;
+   uint32_t *w;
+#if (CIPHER_VECTOR_SUPPORT == ENABLED)
+   uint_t j;
+   ChachaVector v[16];
+   ChachaVector x[16];
+
+   //Generate CHACHA_PARALLEL_BLOCKS keystream blocks at a time
+   for(; n >= CHACHA_PARALLEL_BLOCKS; n -= CHACHA_PARALLEL_BLOCKS)
+   {
+      //Broadcast the state (one keystream block per lane). Each vector is
+      //assigned as a whole before individual lanes are modified
+      for(i = 0; i < 16; i++)
+      {
+         v[i] = (ChachaVector) {0} + context->state[i];
+      }
+
+      //Each lane uses its own block counter, with word 12 overflowing into
+      //word 13
+      for(j = 0; j < CHACHA_PARALLEL_BLOCKS; j++)
+      {
+         v[12][j] += j;
+         v[13][j] += (v[12][j] < context->state[12]) ? 1 : 0;
+      }
+
+      //Copy the state to the working state
+      for(i = 0; i < 16; i++)
+      {
+         x[i] = v[i];
+      }
+
+      //ChaCha runs 8, 12 or 20 rounds, alternating between column rounds and
+      //diagonal rounds (all the lanes are processed at once)
+      for(i = 0; i < context->nr; i += 2)
+      {
+         QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+         QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+         QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+         QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+
+         QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+         QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+         QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+         QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+      }
+
+      //Add the original input words to the output words
+      for(i = 0; i < 16; i++)
+      {
+         x[i] += v[i];
+      }
+
+      //Serialize the keystream blocks one after the other
+      for(j = 0; j < CHACHA_PARALLEL_BLOCKS; j++)
+      {
+         for(i = 0; i < 16; i++)
+         {
+            //Valid input pointer?
+            if(input != NULL)
+            {
+               k = x[i][j] ^ LOAD32LE(input + i * 4);
+            }
+            else
+            {
+               k = x[i][j];
+            }
+
+            //Save the resulting data (little-endian order)
+            STORE32LE(k, output + i * 4);
+         }
+
+         //Advance data pointers
+         input = (input != NULL) ? input + 64 : NULL;
+         output += 64;
+      }
+
+      //Update the block counter
+      context->state[12] += CHACHA_PARALLEL_BLOCKS;
+
+      //Propagate the carry if necessary
+      if(context->state[12] < CHACHA_PARALLEL_BLOCKS)
+      {
+         context->state[13]++;
+      }
+   }
+#endif
+
+   //Point to the keystream block
+   w = context->block;
+
+   //Process the remaining blocks one at a time
+   for(; n > 0; n--)
+   {
+      //Generate a keystream block
+      chachaProcessBlock(context);
+
+      //Increment block counter
+      context->state[12]++;
+
+      //Propagate the carry if necessary
+      if(context->state[12] == 0)
+      {
+         context->state[13]++;
+      }
+
+      //XOR the input data with the keystream, a word at a time
+      for(i = 0; i < 16; i++)
+      {
+         //Valid input pointer?
+         if(input != NULL)
+         {
+            k = LOAD32LE(&w[i]) ^ LOAD32LE(input + i * 4);
+         }
+         else
+         {
+            k = LOAD32LE(&w[i]);
+         }
+
+         //Save the resulting data
+         STORE32LE(k, output + i * 4);
+      }
+
+      //Advance data pointers
+      input = (input != NULL) ? input + 64 : NULL;
+      output += 64;
+   }
+}
+
+
 /**
  * @brief Release ChaCha context
  * @param[in] context Pointer to the ChaCha context
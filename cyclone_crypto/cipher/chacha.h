@@ -31,6 +31,9 @@
 //Dependencies
 #include "core/crypto.h"
 
+//Number of keystream blocks generated in parallel
+#define CHACHA_PARALLEL_BLOCKS 4
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -57,8 +60,14 @@ error_t chachaInit(ChachaContext *context, uint_t nr, const uint8_t *key,
 void chachaCipher(ChachaContext *context, const uint8_t *input,
    uint8_t *output, size_t length);
 
+void chachaSoftCipher(ChachaContext *context, const uint8_t *input,
+   uint8_t *output, size_t length);
+
 void chachaProcessBlock(ChachaContext *context);
 
+void chachaProcessBlocks(ChachaContext *context, const uint8_t *input,
+   uint8_t *output, size_t n);
+
 void chachaDeinit(ChachaContext *context);
 
 //C++ guard
@@ -273,7 +273,9 @@ const CipherAlgo desCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) desEncryptBlock,
    (CipherAlgoDecryptBlock) desDecryptBlock,
-   (CipherAlgoDeinit) desDeinit
+   (CipherAlgoDeinit) desDeinit,
+   NULL,
+   NULL
 };
 
 
@@ -51,7 +51,9 @@ const CipherAlgo des3CipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) des3EncryptBlock,
    (CipherAlgoDecryptBlock) des3DecryptBlock,
-   (CipherAlgoDeinit) des3Deinit
+   (CipherAlgoDeinit) des3Deinit,
+   NULL,
+   NULL
 };
 
 
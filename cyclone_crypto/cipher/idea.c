@@ -48,7 +48,9 @@ const CipherAlgo ideaCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) ideaEncryptBlock,
    (CipherAlgoDecryptBlock) ideaDecryptBlock,
-   (CipherAlgoDeinit) ideaDeinit
+   (CipherAlgoDeinit) ideaDeinit,
+   NULL,
+   NULL
 };
 
 
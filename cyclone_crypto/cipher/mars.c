@@ -208,7 +208,9 @@ const CipherAlgo marsCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) marsEncryptBlock,
    (CipherAlgoDecryptBlock) marsDecryptBlock,
-   (CipherAlgoDeinit) marsDeinit
+   (CipherAlgoDeinit) marsDeinit,
+   NULL,
+   NULL
 };
 
 
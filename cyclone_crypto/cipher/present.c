@@ -180,7 +180,9 @@ const CipherAlgo presentCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) presentEncryptBlock,
    (CipherAlgoDecryptBlock) presentDecryptBlock,
-   (CipherAlgoDeinit) presentDeinit
+   (CipherAlgoDeinit) presentDeinit,
+   NULL,
+   NULL
 };
 
 
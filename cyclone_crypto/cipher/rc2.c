@@ -69,7 +69,9 @@ const CipherAlgo rc2CipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) rc2EncryptBlock,
    (CipherAlgoDecryptBlock) rc2DecryptBlock,
-   (CipherAlgoDeinit) rc2Deinit
+   (CipherAlgoDeinit) rc2Deinit,
+   NULL,
+   NULL
 };
 
 
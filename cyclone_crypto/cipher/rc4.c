@@ -47,7 +47,9 @@ const CipherAlgo rc4CipherAlgo =
    (CipherAlgoDecryptStream) rc4Cipher,
    NULL,
    NULL,
-   (CipherAlgoDeinit) rc4Deinit
+   (CipherAlgoDeinit) rc4Deinit,
+   NULL,
+   NULL
 };
 
 
@@ -51,7 +51,9 @@ const CipherAlgo rc6CipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) rc6EncryptBlock,
    (CipherAlgoDecryptBlock) rc6DecryptBlock,
-   (CipherAlgoDeinit) rc6Deinit
+   (CipherAlgoDeinit) rc6Deinit,
+   NULL,
+   NULL
 };
 
 
@@ -220,7 +220,9 @@ const CipherAlgo seedCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) seedEncryptBlock,
    (CipherAlgoDecryptBlock) seedDecryptBlock,
-   (CipherAlgoDeinit) seedDeinit
+   (CipherAlgoDeinit) seedDeinit,
+   NULL,
+   NULL
 };
 
 
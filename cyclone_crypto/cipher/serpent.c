@@ -378,7 +378,9 @@ const CipherAlgo serpentCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) serpentEncryptBlock,
    (CipherAlgoDecryptBlock) serpentDecryptBlock,
-   (CipherAlgoDeinit) serpentDeinit
+   (CipherAlgoDeinit) serpentDeinit,
+   NULL,
+   NULL
 };
 
 
@@ -119,7 +119,9 @@ const CipherAlgo sm4CipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) sm4EncryptBlock,
    (CipherAlgoDecryptBlock) sm4DecryptBlock,
-   (CipherAlgoDeinit) sm4Deinit
+   (CipherAlgoDeinit) sm4Deinit,
+   NULL,
+   NULL
 };
 
 
@@ -51,7 +51,9 @@ const CipherAlgo teaCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) teaEncryptBlock,
    (CipherAlgoDecryptBlock) teaDecryptBlock,
-   (CipherAlgoDeinit) teaDeinit
+   (CipherAlgoDeinit) teaDeinit,
+   NULL,
+   NULL
 };
 
 
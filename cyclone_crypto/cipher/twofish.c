@@ -107,7 +107,9 @@ const CipherAlgo twofishCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) twofishEncryptBlock,
    (CipherAlgoDecryptBlock) twofishDecryptBlock,
-   (CipherAlgoDeinit) twofishDeinit
+   (CipherAlgoDeinit) twofishDeinit,
+   NULL,
+   NULL
 };
 
 
@@ -51,7 +51,9 @@ const CipherAlgo xteaCipherAlgo =
    NULL,
    (CipherAlgoEncryptBlock) xteaEncryptBlock,
    (CipherAlgoDecryptBlock) xteaDecryptBlock,
-   (CipherAlgoDeinit) xteaDeinit
+   (CipherAlgoDeinit) xteaDeinit,
+   NULL,
+   NULL
 };
 
 
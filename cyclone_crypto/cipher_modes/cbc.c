@@ -99,7 +99,48 @@ __weak_func error_t cbcDecrypt(const CipherAlgo *cipher, void *context,
    uint8_t *iv, const uint8_t *c, uint8_t *p, size_t length)
 {
    size_t i;
+   size_t n;
    uint8_t t[16];
+   uint8_t o[CIPHER_MAX_PARALLEL_BLOCKS * 16];
+
+   //Check whether the cipher can process several blocks at a time
+   if(cipher->decryptBlocks != NULL && cipher->blockSize <= 16)
+   {
+      //Unlike encryption, CBC decryption can be parallelized
+      while(length >= cipher->blockSize)
+      {
+         //Number of blocks to process at a time
+         n = MIN(length / cipher->blockSize, CIPHER_MAX_PARALLEL_BLOCKS);
+         n *= cipher->blockSize;
+
+         //Decrypt the current blocks
+         cipher->decryptBlocks(context, c, o, n / cipher->blockSize);
+
+         //Save the last input block (the output may overwrite the input)
+         osMemcpy(t, c + n - cipher->blockSize, cipher->blockSize);
+
+         //XOR output blocks with the previous input blocks, starting from the
+         //last one so that in-place processing is supported
+         for(i = n; i > cipher->blockSize; i--)
+         {
+            p[i - 1] = o[i - 1] ^ c[i - 1 - cipher->blockSize];
+         }
+
+         //XOR the first output block with IV contents
+         for(i = 0; i < cipher->blockSize; i++)
+         {
+            p[i] = o[i] ^ iv[i];
+         }
+
+         //Update IV with the last input block
+         osMemcpy(iv, t, cipher->blockSize);
+
+         //Next blocks
+         c += n;
+         p += n;
+         length -= n;
+      }
+   }
 
    //CBC mode operates in a block-by-block fashion
    while(length >= cipher->blockSize)
@@ -53,8 +53,10 @@ __weak_func error_t ctrEncrypt(const CipherAlgo *cipher, void *context, uint_t m
    uint8_t *t, const uint8_t *p, uint8_t *c, size_t length)
 {
    size_t i;
+   size_t j;
+   size_t k;
    size_t n;
-   uint8_t o[16];
+   uint8_t o[CIPHER_MAX_PARALLEL_BLOCKS * 16];
 
    //The parameter must be a multiple of 8
    if((m % 8) != 0)
@@ -71,22 +73,45 @@ __weak_func error_t ctrEncrypt(const CipherAlgo *cipher, void *context, uint_t m
    //Process plaintext
    while(length > 0)
    {
-      //CTR mode operates in a block-by-block fashion
-      n = MIN(length, cipher->blockSize);
+      //Check whether the cipher can process several blocks at a time
+      if(cipher->encryptBlocks != NULL && cipher->blockSize <= 16)
+      {
+         //Number of counter blocks to process at a time
+         k = (length + cipher->blockSize - 1) / cipher->blockSize;
+         k = MIN(k, CIPHER_MAX_PARALLEL_BLOCKS);
+
+         //Generate the counter blocks T(j), ..., T(j + k - 1)
+         for(j = 0; j < k; j++)
+         {
+            osMemcpy(o + j * cipher->blockSize, t, cipher->blockSize);
+            ctrIncBlock(t, 1, cipher->blockSize, m);
+         }
+
+         //Compute O(j) = CIPH(T(j)) for all the counter blocks
+         cipher->encryptBlocks(context, o, o, k);
+
+         //Number of bytes to process
+         n = MIN(length, k * cipher->blockSize);
+      }
+      else
+      {
+         //CTR mode operates in a block-by-block fashion
+         n = MIN(length, cipher->blockSize);
 
-      //Compute O(j) = CIPH(T(j))
-      cipher->encryptBlock(context, t, o);
+         //Compute O(j) = CIPH(T(j))
+         cipher->encryptBlock(context, t, o);
 
-      //Compute C(j) = P(j) XOR T(j)
+         //Standard incrementing function
+         ctrIncBlock(t, 1, cipher->blockSize, m);
+      }
+
+      //Compute C(j) = P(j) XOR O(j)
       for(i = 0; i < n; i++)
       {
          c[i] = p[i] ^ o[i];
       }
 
-      //Standard incrementing function
-      ctrIncBlock(t, 1, cipher->blockSize, m);
-
-      //Next block
+      //Next blocks
       p += n;
       c += n;
       length -= n;
@@ -50,6 +50,21 @@
 __weak_func error_t ecbEncrypt(const CipherAlgo *cipher, void *context,
    const uint8_t *p, uint8_t *c, size_t length)
 {
+   size_t n;
+
+   //Check whether the cipher can process several blocks at a time
+   if(cipher->encryptBlocks != NULL)
+   {
+      //Number of complete blocks
+      n = length / cipher->blockSize;
+
+      //Blocks are independent of each other in ECB mode
+      cipher->encryptBlocks(context, p, c, n);
+
+      //Number of bytes left
+      length -= n * cipher->blockSize;
+   }
+
    //ECB mode operates in a block-by-block fashion
    while(length >= cipher->blockSize)
    {
@@ -84,6 +99,21 @@ __weak_func error_t ecbEncrypt(const CipherAlgo *cipher, void *context,
 __weak_func error_t ecbDecrypt(const CipherAlgo *cipher, void *context,
    const uint8_t *c, uint8_t *p, size_t length)
 {
+   size_t n;
+
+   //Check whether the cipher can process several blocks at a time
+   if(cipher->decryptBlocks != NULL)
+   {
+      //Number of complete blocks
+      n = length / cipher->blockSize;
+
+      //Blocks are independent of each other in ECB mode
+      cipher->decryptBlocks(context, c, p, n);
+
+      //Number of bytes left
+      length -= n * cipher->blockSize;
+   }
+
    //ECB mode operates in a block-by-block fashion
    while(length >= cipher->blockSize)
    {
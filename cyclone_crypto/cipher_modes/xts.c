@@ -98,8 +98,12 @@ error_t xtsInit(XtsContext *context, const CipherAlgo *cipherAlgo,
 error_t xtsEncrypt(XtsContext *context, const uint8_t *i, const uint8_t *p,
    uint8_t *c, size_t length)
 {
+   size_t j;
+   size_t n;
    uint8_t t[16];
    uint8_t x[16];
+   uint8_t tt[CIPHER_MAX_PARALLEL_BLOCKS * 16];
+   uint8_t xx[CIPHER_MAX_PARALLEL_BLOCKS * 16];
 
    //The data unit size shall be at least 128 bits
    if(length < 16)
@@ -108,6 +112,43 @@ error_t xtsEncrypt(XtsContext *context, const uint8_t *i, const uint8_t *p,
    //Encrypt the tweak using K2
    context->cipherAlgo->encryptBlock(&context->cipherContext2, i, t);
 
+   //Check whether the cipher can process several blocks at a time
+   if(context->cipherAlgo->encryptBlocks != NULL)
+   {
+      //Process as many complete blocks as possible
+      while(length >= 16)
+      {
+         //Number of blocks to process at a time
+         n = MIN(length / 16, CIPHER_MAX_PARALLEL_BLOCKS);
+
+         //Compute the successive tweak values
+         for(j = 0; j < n; j++)
+         {
+            //Merge the tweak into the input block
+            xtsXorBlock(xx + j * 16, p + j * 16, t);
+            //Save the tweak value
+            osMemcpy(tt + j * 16, t, 16);
+            //Multiply T by x in GF(2^128)
+            xtsMul(t, t);
+         }
+
+         //Encrypt the blocks using K1
+         context->cipherAlgo->encryptBlocks(&context->cipherContext1, xx, xx,
+            n);
+
+         //Merge the tweaks into the output blocks
+         for(j = 0; j < n; j++)
+         {
+            xtsXorBlock(c + j * 16, xx + j * 16, tt + j * 16);
+         }
+
+         //Next blocks
+         p += n * 16;
+         c += n * 16;
+         length -= n * 16;
+      }
+   }
+
    //XTS mode operates in a block-by-block fashion
    while(length >= 16)
    {
@@ -163,8 +204,12 @@ error_t xtsEncrypt(XtsContext *context, const uint8_t *i, const uint8_t *p,
 error_t xtsDecrypt(XtsContext *context, const uint8_t *i, const uint8_t *c,
    uint8_t *p, size_t length)
 {
+   size_t j;
+   size_t n;
    uint8_t t[16];
    uint8_t x[16];
+   uint8_t tt[CIPHER_MAX_PARALLEL_BLOCKS * 16];
+   uint8_t xx[CIPHER_MAX_PARALLEL_BLOCKS * 16];
 
    //The data unit size shall be at least 128 bits
    if(length < 16)
@@ -173,6 +218,43 @@ error_t xtsDecrypt(XtsContext *context, const uint8_t *i, const uint8_t *c,
    //Encrypt the tweak using K2
    context->cipherAlgo->encryptBlock(&context->cipherContext2, i, t);
 
+   //Check whether the cipher can process several blocks at a time
+   if(context->cipherAlgo->decryptBlocks != NULL)
+   {
+      //The last complete block is processed separately
+      while(length >= 32)
+      {
+         //Number of blocks to process at a time
+         n = MIN((length - 16) / 16, CIPHER_MAX_PARALLEL_BLOCKS);
+
+         //Compute the successive tweak values
+         for(j = 0; j < n; j++)
+         {
+            //Merge the tweak into the input block
+            xtsXorBlock(xx + j * 16, c + j * 16, t);
+            //Save the tweak value
+            osMemcpy(tt + j * 16, t, 16);
+            //Multiply T by x in GF(2^128)
+            xtsMul(t, t);
+         }
+
+         //Decrypt the blocks using K1
+         context->cipherAlgo->decryptBlocks(&context->cipherContext1, xx, xx,
+            n);
+
+         //Merge the tweaks into the output blocks
+         for(j = 0; j < n; j++)
+         {
+            xtsXorBlock(p + j * 16, xx + j * 16, tt + j * 16);
+         }
+
+         //Next blocks
+         c += n * 16;
+         p += n * 16;
+         length -= n * 16;
+      }
+   }
+
    //XTS mode operates in a block-by-block fashion
    while(length >= 32)
    {
@@ -721,6 +721,13 @@
    #error YARROW_SUPPORT parameter is not valid
 #endif
 
+//CTR_DRBG PRNG support
+#ifndef CTR_DRBG_SUPPORT
+   #define CTR_DRBG_SUPPORT DISABLED
+#elif (CTR_DRBG_SUPPORT != ENABLED && CTR_DRBG_SUPPORT != DISABLED)
+   #error CTR_DRBG_SUPPORT parameter is not valid
+#endif
+
 //Object identifier support
 #ifndef OID_SUPPORT
    #define OID_SUPPORT ENABLED
@@ -756,6 +763,35 @@
    #error PKCS5_SUPPORT parameter is not valid
 #endif
 
+//Maximum number of blocks handed over to the multi-block cipher primitives
+#ifndef CIPHER_MAX_PARALLEL_BLOCKS
+   #define CIPHER_MAX_PARALLEL_BLOCKS 8
+#elif (CIPHER_MAX_PARALLEL_BLOCKS < 1 || CIPHER_MAX_PARALLEL_BLOCKS > 64)
+   #error CIPHER_MAX_PARALLEL_BLOCKS parameter is not valid
+#endif
+
+//Multi-lane hashing using GCC vector extensions
+#ifndef HASH_VECTOR_SUPPORT
+   #if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+      #define HASH_VECTOR_SUPPORT ENABLED
+   #else
+      #define HASH_VECTOR_SUPPORT DISABLED
+   #endif
+#elif (HASH_VECTOR_SUPPORT != ENABLED && HASH_VECTOR_SUPPORT != DISABLED)
+   #error HASH_VECTOR_SUPPORT parameter is not valid
+#endif
+
+//Multi-block ciphering using GCC vector extensions
+#ifndef CIPHER_VECTOR_SUPPORT
+   #if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+      #define CIPHER_VECTOR_SUPPORT ENABLED
+   #else
+      #define CIPHER_VECTOR_SUPPORT DISABLED
+   #endif
+#elif (CIPHER_VECTOR_SUPPORT != ENABLED && CIPHER_VECTOR_SUPPORT != DISABLED)
+   #error CIPHER_VECTOR_SUPPORT parameter is not valid
+#endif
+
 //Allocate memory block
 #ifndef cryptoAllocMem
    #define cryptoAllocMem(size) osAllocMem(size)
@@ -978,6 +1014,12 @@ typedef void (*CipherAlgoDecryptBlock)(void *context, const uint8_t *input,
 
 typedef void (*CipherAlgoDeinit)(void *context);
 
+typedef void (*CipherAlgoEncryptBlocks)(void *context, const uint8_t *input,
+   uint8_t *output, size_t n);
+
+typedef void (*CipherAlgoDecryptBlocks)(void *context, const uint8_t *input,
+   uint8_t *output, size_t n);
+
 //Common interface for key encapsulation mechanisms (KEM)
 typedef error_t (*KemAlgoGenerateKeyPair)(const PrngAlgo *prngAlgo,
    void *prngContext, uint8_t *pk, uint8_t *sk);
@@ -1040,6 +1082,8 @@ typedef struct
    CipherAlgoEncryptBlock encryptBlock;
    CipherAlgoDecryptBlock decryptBlock;
    CipherAlgoDeinit deinit;
+   CipherAlgoEncryptBlocks encryptBlocks; ///<Optional multi-block encryption
+   CipherAlgoDecryptBlocks decryptBlocks; ///<Optional multi-block decryption
 } CipherAlgo;
 
 
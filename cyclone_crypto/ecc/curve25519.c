@@ -642,4 +642,639 @@ void curve25519Export(uint32_t *a, uint8_t *data)
    osMemcpy(data, a, 32);
 }
 
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+
+//128-bit unsigned integer
+typedef unsigned __int128 curve25519_uint128_t;
+
+//Mask for 51-bit limbs
+#define CURVE25519_MASK51 0x7FFFFFFFFFFFFULL
+
+//64x64-bit multiplication with 128-bit result
+#define CURVE25519_MUL(a, b) ((curve25519_uint128_t) (a) * (b))
+
+//Square root of -1 modulo p (radix-2^51 representation)
+static const uint64_t CURVE25519_SQRT_MINUS_1_51[5] =
+{
+   0x61B274A0EA0B0, 0x0D5A5FC8F189D, 0x7EF5E9CBD0C60, 0x78595A6804C9E,
+   0x2B8324804FC1D
+};
+
+
+/**
+ * @brief Set integer value (radix-2^51 representation)
+ * @param[out] a Pointer to the integer to be initialized
+ * @param[in] b Initial value
+ **/
+
+void curve25519SetInt51(uint64_t *a, uint32_t b)
+{
+   //Set the value of the least significant limb
+   a[0] = b;
+
+   //Initialize the rest of the integer
+   a[1] = 0;
+   a[2] = 0;
+   a[3] = 0;
+   a[4] = 0;
+}
+
+
+/**
+ * @brief Modular addition (radix-2^51 representation)
+ * @param[out] r Resulting integer R = (A + B) mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ * @param[in] b An integer whose limbs are lower than 2^52
+ **/
+
+void curve25519Add51(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+   uint64_t c;
+   uint64_t u[5];
+
+   //Compute U = A + B
+   u[0] = a[0] + b[0];
+   u[1] = a[1] + b[1];
+   u[2] = a[2] + b[2];
+   u[3] = a[3] + b[3];
+   u[4] = a[4] + b[4];
+
+   //Propagate carries (2^255 = 19 mod p)
+   c = u[0] >> 51;
+   r[0] = u[0] & CURVE25519_MASK51;
+   u[1] += c;
+   c = u[1] >> 51;
+   r[1] = u[1] & CURVE25519_MASK51;
+   u[2] += c;
+   c = u[2] >> 51;
+   r[2] = u[2] & CURVE25519_MASK51;
+   u[3] += c;
+   c = u[3] >> 51;
+   r[3] = u[3] & CURVE25519_MASK51;
+   u[4] += c;
+   c = u[4] >> 51;
+   r[4] = u[4] & CURVE25519_MASK51;
+   r[0] += c * 19;
+}
+
+
+/**
+ * @brief Modular subtraction (radix-2^51 representation)
+ * @param[out] r Resulting integer R = (A - B) mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ * @param[in] b An integer whose limbs are lower than 2^52
+ **/
+
+void curve25519Sub51(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+   uint64_t c;
+   uint64_t u[5];
+
+   //Compute U = A + 4 * p - B
+   u[0] = a[0] + 0x1FFFFFFFFFFFB4ULL - b[0];
+   u[1] = a[1] + 0x1FFFFFFFFFFFFCULL - b[1];
+   u[2] = a[2] + 0x1FFFFFFFFFFFFCULL - b[2];
+   u[3] = a[3] + 0x1FFFFFFFFFFFFCULL - b[3];
+   u[4] = a[4] + 0x1FFFFFFFFFFFFCULL - b[4];
+
+   //Propagate carries (2^255 = 19 mod p)
+   c = u[0] >> 51;
+   r[0] = u[0] & CURVE25519_MASK51;
+   u[1] += c;
+   c = u[1] >> 51;
+   r[1] = u[1] & CURVE25519_MASK51;
+   u[2] += c;
+   c = u[2] >> 51;
+   r[2] = u[2] & CURVE25519_MASK51;
+   u[3] += c;
+   c = u[3] >> 51;
+   r[3] = u[3] & CURVE25519_MASK51;
+   u[4] += c;
+   c = u[4] >> 51;
+   r[4] = u[4] & CURVE25519_MASK51;
+   r[0] += c * 19;
+}
+
+
+/**
+ * @brief Modular multiplication (radix-2^51 representation)
+ * @param[out] r Resulting integer R = (A * B) mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ * @param[in] b An integer whose limbs are lower than 2^52
+ **/
+
+void curve25519Mul51(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+   uint64_t c;
+   uint64_t b1;
+   uint64_t b2;
+   uint64_t b3;
+   uint64_t b4;
+   curve25519_uint128_t u[5];
+
+   //Since 2^255 = 19 mod p, the upper limbs of the product can be folded
+   //back into the lower ones
+   b1 = b[1] * 19;
+   b2 = b[2] * 19;
+   b3 = b[3] * 19;
+   b4 = b[4] * 19;
+
+   //Compute the 128-bit partial products
+   u[0] = CURVE25519_MUL(a[0], b[0]) + CURVE25519_MUL(a[1], b4) +
+      CURVE25519_MUL(a[2], b3) + CURVE25519_MUL(a[3], b2) +
+      CURVE25519_MUL(a[4], b1);
+
+   u[1] = CURVE25519_MUL(a[0], b[1]) + CURVE25519_MUL(a[1], b[0]) +
+      CURVE25519_MUL(a[2], b4) + CURVE25519_MUL(a[3], b3) +
+      CURVE25519_MUL(a[4], b2);
+
+   u[2] = CURVE25519_MUL(a[0], b[2]) + CURVE25519_MUL(a[1], b[1]) +
+      CURVE25519_MUL(a[2], b[0]) + CURVE25519_MUL(a[3], b4) +
+      CURVE25519_MUL(a[4], b3);
+
+   u[3] = CURVE25519_MUL(a[0], b[3]) + CURVE25519_MUL(a[1], b[2]) +
+      CURVE25519_MUL(a[2], b[1]) + CURVE25519_MUL(a[3], b[0]) +
+      CURVE25519_MUL(a[4], b4);
+
+   u[4] = CURVE25519_MUL(a[0], b[4]) + CURVE25519_MUL(a[1], b[3]) +
+      CURVE25519_MUL(a[2], b[2]) + CURVE25519_MUL(a[3], b[1]) +
+      CURVE25519_MUL(a[4], b[0]);
+
+   //Propagate carries
+   u[1] += (uint64_t) (u[0] >> 51);
+   r[0] = (uint64_t) u[0] & CURVE25519_MASK51;
+   u[2] += (uint64_t) (u[1] >> 51);
+   r[1] = (uint64_t) u[1] & CURVE25519_MASK51;
+   u[3] += (uint64_t) (u[2] >> 51);
+   r[2] = (uint64_t) u[2] & CURVE25519_MASK51;
+   u[4] += (uint64_t) (u[3] >> 51);
+   r[3] = (uint64_t) u[3] & CURVE25519_MASK51;
+   c = (uint64_t) (u[4] >> 51);
+   r[4] = (uint64_t) u[4] & CURVE25519_MASK51;
+
+   //Reduce the carry out of the most significant limb
+   r[0] += c * 19;
+   r[1] += r[0] >> 51;
+   r[0] &= CURVE25519_MASK51;
+}
+
+
+/**
+ * @brief Modular multiplication (radix-2^51 representation)
+ * @param[out] r Resulting integer R = (A * B) mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ * @param[in] b An integer such as 0 <= B < 2^32
+ **/
+
+void curve25519MulInt51(uint64_t *r, const uint64_t *a, uint32_t b)
+{
+   uint64_t c;
+   curve25519_uint128_t u;
+
+   //Compute R = A * B and propagate carries
+   u = CURVE25519_MUL(a[0], b);
+   r[0] = (uint64_t) u & CURVE25519_MASK51;
+   u = CURVE25519_MUL(a[1], b) + (uint64_t) (u >> 51);
+   r[1] = (uint64_t) u & CURVE25519_MASK51;
+   u = CURVE25519_MUL(a[2], b) + (uint64_t) (u >> 51);
+   r[2] = (uint64_t) u & CURVE25519_MASK51;
+   u = CURVE25519_MUL(a[3], b) + (uint64_t) (u >> 51);
+   r[3] = (uint64_t) u & CURVE25519_MASK51;
+   u = CURVE25519_MUL(a[4], b) + (uint64_t) (u >> 51);
+   r[4] = (uint64_t) u & CURVE25519_MASK51;
+   c = (uint64_t) (u >> 51);
+
+   //Reduce the carry out of the most significant limb
+   r[0] += c * 19;
+   r[1] += r[0] >> 51;
+   r[0] &= CURVE25519_MASK51;
+}
+
+
+/**
+ * @brief Modular squaring (radix-2^51 representation)
+ * @param[out] r Resulting integer R = (A ^ 2) mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ **/
+
+void curve25519Sqr51(uint64_t *r, const uint64_t *a)
+{
+   uint64_t c;
+   uint64_t d0;
+   uint64_t d1;
+   uint64_t d2;
+   uint64_t a3;
+   uint64_t a4;
+   uint64_t d4;
+   curve25519_uint128_t u[5];
+
+   //Pre-compute the doubled and folded limbs
+   d0 = a[0] * 2;
+   d1 = a[1] * 2;
+   d2 = a[2] * 2 * 19;
+   a3 = a[3] * 19;
+   a4 = a[4] * 19;
+   d4 = a4 * 2;
+
+   //The cross products appear twice, so they are computed only once
+   u[0] = CURVE25519_MUL(a[0], a[0]) + CURVE25519_MUL(d4, a[1]) +
+      CURVE25519_MUL(d2, a[3]);
+
+   u[1] = CURVE25519_MUL(d0, a[1]) + CURVE25519_MUL(d4, a[2]) +
+      CURVE25519_MUL(a3, a[3]);
+
+   u[2] = CURVE25519_MUL(d0, a[2]) + CURVE25519_MUL(a[1], a[1]) +
+      CURVE25519_MUL(d4, a[3]);
+
+   u[3] = CURVE25519_MUL(d0, a[3]) + CURVE25519_MUL(d1, a[2]) +
+      CURVE25519_MUL(a4, a[4]);
+
+   u[4] = CURVE25519_MUL(d0, a[4]) + CURVE25519_MUL(d1, a[3]) +
+      CURVE25519_MUL(a[2], a[2]);
+
+   //Propagate carries
+   u[1] += (uint64_t) (u[0] >> 51);
+   r[0] = (uint64_t) u[0] & CURVE25519_MASK51;
+   u[2] += (uint64_t) (u[1] >> 51);
+   r[1] = (uint64_t) u[1] & CURVE25519_MASK51;
+   u[3] += (uint64_t) (u[2] >> 51);
+   r[2] = (uint64_t) u[2] & CURVE25519_MASK51;
+   u[4] += (uint64_t) (u[3] >> 51);
+   r[3] = (uint64_t) u[3] & CURVE25519_MASK51;
+   c = (uint64_t) (u[4] >> 51);
+   r[4] = (uint64_t) u[4] & CURVE25519_MASK51;
+
+   //Reduce the carry out of the most significant limb
+   r[0] += c * 19;
+   r[1] += r[0] >> 51;
+   r[0] &= CURVE25519_MASK51;
+}
+
+
+/**
+ * @brief Raise an integer to power 2^n (radix-2^51 representation)
+ * @param[out] r Resulting integer R = (A ^ (2^n)) mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ * @param[in] n An integer such as n >= 1
+ **/
+
+void curve25519SqrN51(uint64_t *r, const uint64_t *a, uint_t n)
+{
+   uint_t i;
+
+   //Pre-compute (A ^ 2) mod p
+   curve25519Sqr51(r, a);
+
+   //Compute R = (A ^ (2^n)) mod p
+   for(i = 1; i < n; i++)
+   {
+      curve25519Sqr51(r, r);
+   }
+}
+
+
+/**
+ * @brief Modular reduction (radix-2^51 representation)
+ * @param[out] r Resulting integer R = A mod p (canonical limbs)
+ * @param[in] a An integer whose limbs are lower than 2^52
+ **/
+
+void curve25519Red51(uint64_t *r, const uint64_t *a)
+{
+   uint64_t q;
+   uint64_t u[5];
+
+   //Propagate carries so that every limb fits in 51 bits
+   u[1] = a[1] + (a[0] >> 51);
+   u[0] = a[0] & CURVE25519_MASK51;
+   u[2] = a[2] + (u[1] >> 51);
+   u[1] &= CURVE25519_MASK51;
+   u[3] = a[3] + (u[2] >> 51);
+   u[2] &= CURVE25519_MASK51;
+   u[4] = a[4] + (u[3] >> 51);
+   u[3] &= CURVE25519_MASK51;
+   u[0] += (u[4] >> 51) * 19;
+   u[4] &= CURVE25519_MASK51;
+
+   //Compute the quotient q = (A + 19) / 2^255, which is either 0 or 1
+   q = (u[0] + 19) >> 51;
+   q = (u[1] + q) >> 51;
+   q = (u[2] + q) >> 51;
+   q = (u[3] + q) >> 51;
+   q = (u[4] + q) >> 51;
+
+   //Compute R = A + 19 * q - 2^255 * q
+   u[0] += q * 19;
+   u[1] += u[0] >> 51;
+   r[0] = u[0] & CURVE25519_MASK51;
+   u[2] += u[1] >> 51;
+   r[1] = u[1] & CURVE25519_MASK51;
+   u[3] += u[2] >> 51;
+   r[2] = u[2] & CURVE25519_MASK51;
+   u[4] += u[3] >> 51;
+   r[3] = u[3] & CURVE25519_MASK51;
+   r[4] = u[4] & CURVE25519_MASK51;
+}
+
+
+/**
+ * @brief Modular multiplicative inverse (radix-2^51 representation)
+ * @param[out] r Resulting integer R = A^-1 mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ **/
+
+void curve25519Inv51(uint64_t *r, const uint64_t *a)
+{
+   uint64_t u[5];
+   uint64_t v[5];
+
+   //Since GF(p) is a prime field, the Fermat's little theorem can be
+   //used to find the multiplicative inverse of A modulo p
+   curve25519Sqr51(u, a);
+   curve25519Mul51(u, u, a); //A^(2^2 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, a); //A^(2^3 - 1)
+   curve25519SqrN51(u, v, 3);
+   curve25519Mul51(u, u, v); //A^(2^6 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, a); //A^(2^7 - 1)
+   curve25519SqrN51(u, v, 7);
+   curve25519Mul51(u, u, v); //A^(2^14 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, a); //A^(2^15 - 1)
+   curve25519SqrN51(u, v, 15);
+   curve25519Mul51(u, u, v); //A^(2^30 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, a); //A^(2^31 - 1)
+   curve25519SqrN51(u, v, 31);
+   curve25519Mul51(v, u, v); //A^(2^62 - 1)
+   curve25519SqrN51(u, v, 62);
+   curve25519Mul51(u, u, v); //A^(2^124 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, a); //A^(2^125 - 1)
+   curve25519SqrN51(u, v, 125);
+   curve25519Mul51(u, u, v); //A^(2^250 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Sqr51(u, u);
+   curve25519Mul51(u, u, a); //A^(2^252 - 3)
+   curve25519Sqr51(u, u);
+   curve25519Sqr51(u, u);
+   curve25519Mul51(u, u, a); //A^(2^254 - 11)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(r, u, a); //A^(2^255 - 21)
+}
+
+
+/**
+ * @brief Square root of (A / B) modulo p (radix-2^51 representation)
+ * @param[out] r Resulting integer R = (A / B)^(1 / 2) mod p
+ * @param[in] a An integer whose limbs are lower than 2^52
+ * @param[in] b An integer whose limbs are lower than 2^52
+ * @return The function returns 0 if the square root exists, else 1
+ **/
+
+uint32_t curve25519Sqrt51(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+   uint32_t res1;
+   uint32_t res2;
+   uint64_t c[5];
+   uint64_t u[5];
+   uint64_t v[5];
+   uint64_t w[5];
+
+   //Compute B^3
+   curve25519Sqr51(w, b);
+   curve25519Mul51(w, w, b);
+
+   //Compute C = A * B^7
+   curve25519Sqr51(v, w);
+   curve25519Mul51(v, v, b);
+   curve25519Mul51(c, a, v);
+
+   //Compute U = C^((p - 5) / 8)
+   curve25519Sqr51(u, c);
+   curve25519Mul51(u, u, c); //C^(2^2 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, c); //C^(2^3 - 1)
+   curve25519SqrN51(u, v, 3);
+   curve25519Mul51(u, u, v); //C^(2^6 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, c); //C^(2^7 - 1)
+   curve25519SqrN51(u, v, 7);
+   curve25519Mul51(u, u, v); //C^(2^14 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, c); //C^(2^15 - 1)
+   curve25519SqrN51(u, v, 15);
+   curve25519Mul51(u, u, v); //C^(2^30 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, c); //C^(2^31 - 1)
+   curve25519SqrN51(u, v, 31);
+   curve25519Mul51(v, u, v); //C^(2^62 - 1)
+   curve25519SqrN51(u, v, 62);
+   curve25519Mul51(u, u, v); //C^(2^124 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Mul51(v, u, c); //C^(2^125 - 1)
+   curve25519SqrN51(u, v, 125);
+   curve25519Mul51(u, u, v); //C^(2^250 - 1)
+   curve25519Sqr51(u, u);
+   curve25519Sqr51(u, u);
+   curve25519Mul51(u, u, c); //C^(2^252 - 3)
+
+   //The first candidate root is U = A * B^3 * (A * B^7)^((p - 5) / 8)
+   curve25519Mul51(u, u, a);
+   curve25519Mul51(u, u, w);
+
+   //The second candidate root is V = U * sqrt(-1)
+   curve25519Mul51(v, u, CURVE25519_SQRT_MINUS_1_51);
+
+   //Calculate C = B * U^2
+   curve25519Sqr51(c, u);
+   curve25519Mul51(c, c, b);
+
+   //Check whether B * U^2 = A
+   res1 = curve25519Comp51(c, a);
+
+   //Calculate C = B * V^2
+   curve25519Sqr51(c, v);
+   curve25519Mul51(c, c, b);
+
+   //Check whether B * V^2 = A
+   res2 = curve25519Comp51(c, a);
+
+   //Select the first or the second candidate root
+   curve25519Select51(r, u, v, res1);
+
+   //Return 0 if the square root exists
+   return res1 & res2;
+}
+
+
+/**
+ * @brief Copy an integer (radix-2^51 representation)
+ * @param[out] a Pointer to the destination integer
+ * @param[in] b Pointer to the source integer
+ **/
+
+void curve25519Copy51(uint64_t *a, const uint64_t *b)
+{
+   //Copy the value of the integer
+   a[0] = b[0];
+   a[1] = b[1];
+   a[2] = b[2];
+   a[3] = b[3];
+   a[4] = b[4];
+}
+
+
+/**
+ * @brief Conditional swap (radix-2^51 representation)
+ * @param[in,out] a Pointer to the first integer
+ * @param[in,out] b Pointer to the second integer
+ * @param[in] c Condition variable
+ **/
+
+void curve25519Swap51(uint64_t *a, uint64_t *b, uint32_t c)
+{
+   uint_t i;
+   uint64_t mask;
+   uint64_t dummy;
+
+   //The mask is the all-1 or all-0 word
+   mask = ~((uint64_t) c) + 1;
+
+   //Conditional swap
+   for(i = 0; i < 5; i++)
+   {
+      //Constant time implementation
+      dummy = mask & (a[i] ^ b[i]);
+      a[i] ^= dummy;
+      b[i] ^= dummy;
+   }
+}
+
+
+/**
+ * @brief Select an integer (radix-2^51 representation)
+ * @param[out] r Pointer to the destination integer
+ * @param[in] a Pointer to the first source integer
+ * @param[in] b Pointer to the second source integer
+ * @param[in] c Condition variable
+ **/
+
+void curve25519Select51(uint64_t *r, const uint64_t *a, const uint64_t *b,
+   uint32_t c)
+{
+   uint_t i;
+   uint64_t mask;
+
+   //The mask is the all-1 or all-0 word
+   mask = (uint64_t) c - 1;
+
+   //Select between A and B
+   for(i = 0; i < 5; i++)
+   {
+      //Constant time implementation
+      r[i] = (a[i] & mask) | (b[i] & ~mask);
+   }
+}
+
+
+/**
+ * @brief Compare integers (radix-2^51 representation)
+ * @param[in] a Pointer to the first integer
+ * @param[in] b Pointer to the second integer
+ * @return The function returns 0 if the A = B mod p, else 1
+ **/
+
+uint32_t curve25519Comp51(const uint64_t *a, const uint64_t *b)
+{
+   uint_t i;
+   uint64_t mask;
+   uint64_t u[5];
+   uint64_t v[5];
+
+   //The comparison is performed on canonical representations
+   curve25519Red51(u, a);
+   curve25519Red51(v, b);
+
+   //Initialize mask
+   mask = 0;
+
+   //Compare A and B
+   for(i = 0; i < 5; i++)
+   {
+      //Constant time implementation
+      mask |= u[i] ^ v[i];
+   }
+
+   //Return 0 if A = B, else 1
+   return (uint32_t) ((mask | (~mask + 1)) >> 63);
+}
+
+
+/**
+ * @brief Convert an integer to radix-2^51 representation
+ * @param[out] r Resulting integer (radix-2^51 representation)
+ * @param[in] a An integer such as 0 <= A < 2^255 (radix-2^32 representation)
+ **/
+
+void curve25519Load51(uint64_t *r, const uint32_t *a)
+{
+   uint64_t w0;
+   uint64_t w1;
+   uint64_t w2;
+   uint64_t w3;
+
+   //Concatenate the 32-bit words
+   w0 = a[0] | ((uint64_t) a[1] << 32);
+   w1 = a[2] | ((uint64_t) a[3] << 32);
+   w2 = a[4] | ((uint64_t) a[5] << 32);
+   w3 = a[6] | ((uint64_t) a[7] << 32);
+
+   //Split the integer into 51-bit limbs
+   r[0] = w0 & CURVE25519_MASK51;
+   r[1] = ((w0 >> 51) | (w1 << 13)) & CURVE25519_MASK51;
+   r[2] = ((w1 >> 38) | (w2 << 26)) & CURVE25519_MASK51;
+   r[3] = ((w2 >> 25) | (w3 << 39)) & CURVE25519_MASK51;
+   r[4] = (w3 >> 12) & CURVE25519_MASK51;
+}
+
+
+/**
+ * @brief Convert an integer from radix-2^51 representation
+ * @param[out] r Resulting integer such as 0 <= R < p (radix-2^32
+ *   representation)
+ * @param[in] a An integer whose limbs are lower than 2^52
+ **/
+
+void curve25519Store51(uint32_t *r, const uint64_t *a)
+{
+   uint64_t w0;
+   uint64_t w1;
+   uint64_t w2;
+   uint64_t w3;
+   uint64_t u[5];
+
+   //Reduce non-canonical values
+   curve25519Red51(u, a);
+
+   //Pack the 51-bit limbs
+   w0 = u[0] | (u[1] << 51);
+   w1 = (u[1] >> 13) | (u[2] << 38);
+   w2 = (u[2] >> 26) | (u[3] << 25);
+   w3 = (u[3] >> 39) | (u[4] << 12);
+
+   //Split the integer into 32-bit words
+   r[0] = w0 & 0xFFFFFFFF;
+   r[1] = w0 >> 32;
+   r[2] = w1 & 0xFFFFFFFF;
+   r[3] = w1 >> 32;
+   r[4] = w2 & 0xFFFFFFFF;
+   r[5] = w2 >> 32;
+   r[6] = w3 & 0xFFFFFFFF;
+   r[7] = w3 >> 32;
+}
+
+#endif
+
 #endif
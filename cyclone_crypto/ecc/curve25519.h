@@ -39,6 +39,19 @@
 //A24 constant
 #define CURVE25519_A24 121666
 
+//Radix-2^51 field arithmetic (64-bit platforms)
+#ifndef CURVE25519_RADIX51_SUPPORT
+   #if defined(__SIZEOF_INT128__)
+      #define CURVE25519_RADIX51_SUPPORT ENABLED
+   #else
+      #define CURVE25519_RADIX51_SUPPORT DISABLED
+   #endif
+#elif (CURVE25519_RADIX51_SUPPORT != ENABLED && CURVE25519_RADIX51_SUPPORT != DISABLED)
+   #error CURVE25519_RADIX51_SUPPORT parameter is not valid
+#elif (CURVE25519_RADIX51_SUPPORT == ENABLED && !defined(__SIZEOF_INT128__))
+   #error CURVE25519_RADIX51_SUPPORT requires 128-bit integer support
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -70,6 +83,33 @@ uint32_t curve25519Comp(const uint32_t *a, const uint32_t *b);
 void curve25519Import(uint32_t *a, const uint8_t *data);
 void curve25519Export(uint32_t *a, uint8_t *data);
 
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+
+void curve25519SetInt51(uint64_t *a, uint32_t b);
+void curve25519Add51(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void curve25519Sub51(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void curve25519Mul51(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void curve25519MulInt51(uint64_t *r, const uint64_t *a, uint32_t b);
+void curve25519Sqr51(uint64_t *r, const uint64_t *a);
+void curve25519SqrN51(uint64_t *r, const uint64_t *a, uint_t n);
+void curve25519Red51(uint64_t *r, const uint64_t *a);
+void curve25519Inv51(uint64_t *r, const uint64_t *a);
+
+uint32_t curve25519Sqrt51(uint64_t *r, const uint64_t *a, const uint64_t *b);
+
+void curve25519Copy51(uint64_t *a, const uint64_t *b);
+void curve25519Swap51(uint64_t *a, uint64_t *b, uint32_t c);
+
+void curve25519Select51(uint64_t *r, const uint64_t *a, const uint64_t *b,
+   uint32_t c);
+
+uint32_t curve25519Comp51(const uint64_t *a, const uint64_t *b);
+
+void curve25519Load51(uint64_t *r, const uint32_t *a);
+void curve25519Store51(uint32_t *r, const uint64_t *a);
+
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -31,6 +31,7 @@
 //Dependencies
 #include "core/crypto.h"
 #include "ecc/ec.h"
+#include "ecc/p256.h"
 #include "debug.h"
 
 //Check crypto library configuration
@@ -51,6 +52,7 @@ void ecInitDomainParameters(EcDomainParameters *params)
    params->name = NULL;
    params->type = EC_CURVE_TYPE_NONE;
    params->mod = NULL;
+   params->comb = NULL;
 
    //Initialize EC domain parameters
    mpiInit(&params->p);
@@ -121,6 +123,8 @@ error_t ecLoadDomainParameters(EcDomainParameters *params,
    params->h = curveInfo->h;
    //Fast modular reduction
    params->mod = curveInfo->mod;
+   //Fixed-base comb table
+   params->comb = curveInfo->comb;
 
    //Debug message
    TRACE_DEBUG("  p:\r\n");
@@ -983,6 +987,190 @@ end:
 }
 
 
+#if (EC_COMB_SUPPORT == ENABLED)
+
+/**
+ * @brief Load a precomputed point from the fixed-base comb table
+ * @param[in] comb Fixed-base comb table
+ * @param[in] index Index of the point (1 <= index < 2^w)
+ * @param[out] r Affine point
+ * @return Error code
+ **/
+
+error_t ecCombLoadPoint(const EcCombTable *comb, uint_t index, EcPoint *r)
+{
+   error_t error;
+   uint_t i;
+   const uint32_t *p;
+
+   //Point to the coordinates of the precomputed point
+   p = comb->points + (index - 1) * 2 * comb->wordLen;
+
+   //Resize the coordinates
+   MPI_CHECK(mpiGrow(&r->x, comb->wordLen));
+   MPI_CHECK(mpiGrow(&r->y, comb->wordLen));
+
+   //Copy the x and y coordinates
+   for(i = 0; i < r->x.size; i++)
+   {
+      r->x.data[i] = (i < comb->wordLen) ? p[i] : 0;
+   }
+
+   for(i = 0; i < r->y.size; i++)
+   {
+      r->y.data[i] = (i < comb->wordLen) ? p[comb->wordLen + i] : 0;
+   }
+
+   //The coordinates are positive integers
+   r->x.sign = 1;
+   r->y.sign = 1;
+
+   //The point is in affine representation
+   MPI_CHECK(mpiSetValue(&r->z, 1));
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Fixed-base comb scalar multiplication
+ *
+ * The scalar is split into w teeth of the given spacing, so that only
+ * spacing doublings and at most spacing mixed additions are required
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.G
+ * @param[in] d An integer d such as 0 <= d < 2^(w * spacing)
+ * @return Error code
+ **/
+
+error_t ecCombMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d)
+{
+   error_t error;
+   int_t i;
+   uint_t j;
+   uint_t k;
+   const EcCombTable *comb;
+   EcPoint t;
+
+   //Point to the fixed-base comb table
+   comb = params->comb;
+
+   //Initialize EC point
+   ecInit(&t);
+
+   //Set R = (1, 1, 0)
+   MPI_CHECK(mpiSetValue(&r->x, 1));
+   MPI_CHECK(mpiSetValue(&r->y, 1));
+   MPI_CHECK(mpiSetValue(&r->z, 0));
+
+   //Process the columns of the comb, most significant first
+   for(i = comb->spacing - 1; i >= 0; i--)
+   {
+      //Point doubling
+      EC_CHECK(ecDouble(params, r, r));
+
+      //Gather the bits of d located at positions i + j * spacing
+      for(k = 0, j = 0; j < comb->width; j++)
+      {
+         k |= mpiGetBitValue(d, i + j * comb->spacing) << j;
+      }
+
+      //Any bit set in the current column?
+      if(k != 0)
+      {
+         //Compute R = R + T(k)
+         EC_CHECK(ecCombLoadPoint(comb, k, &t));
+         EC_CHECK(ecFullAdd(params, r, r, &t));
+      }
+   }
+
+end:
+   //Release EC point
+   ecFree(&t);
+
+   //Return status code
+   return error;
+}
+
+#endif
+
+
+#if (P256_ENGINE_SUPPORT == ENABLED)
+
+/**
+ * @brief Scalar multiplication (secp256r1 curve)
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < 2^256
+ * @param[in] s EC point (affine representation)
+ * @param[in] base The point S is the base point G
+ * @return Error code
+ **/
+
+error_t ecMultP256(EcPoint *r, const Mpi *d, const EcPoint *s, bool_t base)
+{
+   error_t error;
+   uint8_t x[P256_BYTE_LEN];
+   uint8_t y[P256_BYTE_LEN];
+   uint32_t k[P256_WORD_LEN];
+   P256Point a;
+
+   //Convert the scalar to an integer
+   error = mpiExport(d, x, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN);
+   //Any error to report?
+   if(error)
+      return error;
+
+   p256Import(k, x);
+
+   //Multiplication of the base point?
+   if(base)
+   {
+      //Compute R = d.G
+      p256MultBase(&a, k);
+   }
+   else
+   {
+      //Import the point S
+      MPI_CHECK(mpiExport(&s->x, x, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN));
+      MPI_CHECK(mpiExport(&s->y, y, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN));
+      EC_CHECK(p256ImportPoint(&a, x, y));
+
+      //Compute R = d.S
+      p256Mult(&a, k, &a);
+   }
+
+   //Point at the infinity?
+   if(p256ExportPoint(&a, x, y))
+   {
+      //Set R = (1, 1, 0)
+      MPI_CHECK(mpiSetValue(&r->x, 1));
+      MPI_CHECK(mpiSetValue(&r->y, 1));
+      MPI_CHECK(mpiSetValue(&r->z, 0));
+   }
+   else
+   {
+      //Return the resulting point in affine representation
+      MPI_CHECK(mpiImport(&r->x, x, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN));
+      MPI_CHECK(mpiImport(&r->y, y, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN));
+      MPI_CHECK(mpiSetValue(&r->z, 1));
+   }
+
+end:
+   //Clear the scalar from the stack
+   osMemset(k, 0, sizeof(k));
+   osMemset(x, 0, sizeof(x));
+
+   //Return status code
+   return error;
+}
+
+#endif
+
+
 /**
  * @brief Scalar multiplication
  * @param[in] params EC domain parameters
@@ -1002,6 +1190,28 @@ __weak_func error_t ecMult(const EcDomainParameters *params, EcPoint *r, const M
    //Initialize multiple precision integer
    mpiInit(&h);
 
+#if (P256_ENGINE_SUPPORT == ENABLED)
+   //Check whether the dedicated secp256r1 implementation can be used
+   if(params->mod == secp256r1Mod && mpiGetBitLength(d) <= 256 &&
+      mpiCompInt(&s->z, 1) == 0)
+   {
+      //Constant-time scalar multiplication
+      EC_CHECK(ecMultP256(r, d, s, s == &params->g));
+   }
+   else
+#endif
+#if (EC_COMB_SUPPORT == ENABLED)
+   //Check whether S is the base point G of a curve with a precomputed table
+   if(params->comb != NULL && mpiGetBitLength(d) <= params->comb->width *
+      params->comb->spacing && (s == &params->g ||
+      (mpiCompInt(&s->z, 1) == 0 && mpiComp(&s->x, &params->g.x) == 0 &&
+      mpiComp(&s->y, &params->g.y) == 0)))
+   {
+      //Fixed-base comb method
+      EC_CHECK(ecCombMult(params, r, d));
+   }
+   else
+#endif
    //Check whether d == 0
    if(mpiCompInt(d, 0) == 0)
    {
@@ -71,15 +71,16 @@ typedef struct
 
 typedef struct
 {
-   const char_t *name; ///<Curve name
-   EcCurveType type;   ///<Curve type
-   Mpi p;              ///<Prime
-   Mpi a;              ///<Curve parameter a
-   Mpi b;              ///<Curve parameter b
-   EcPoint g;          ///<Base point G
-   Mpi q;              ///<Order of the point G
-   uint32_t h;         ///<Cofactor h
-   EcFastModAlgo mod;  ///<Fast modular reduction
+   const char_t *name;      ///<Curve name
+   EcCurveType type;        ///<Curve type
+   Mpi p;                   ///<Prime
+   Mpi a;                   ///<Curve parameter a
+   Mpi b;                   ///<Curve parameter b
+   EcPoint g;               ///<Base point G
+   Mpi q;                   ///<Order of the point G
+   uint32_t h;              ///<Cofactor h
+   EcFastModAlgo mod;       ///<Fast modular reduction
+   const EcCombTable *comb; ///<Fixed-base comb table
 } EcDomainParameters;
 
 
@@ -161,6 +162,21 @@ error_t ecFullAdd(const EcDomainParameters *params, EcPoint *r,
 error_t ecFullSub(const EcDomainParameters *params, EcPoint *r,
    const EcPoint *s, const EcPoint *t);
 
+#if (P256_ENGINE_SUPPORT == ENABLED)
+
+error_t ecMultP256(EcPoint *r, const Mpi *d, const EcPoint *s, bool_t base);
+
+#endif
+
+#if (EC_COMB_SUPPORT == ENABLED)
+
+error_t ecCombLoadPoint(const EcCombTable *comb, uint_t index, EcPoint *r);
+
+error_t ecCombMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d);
+
+#endif
+
 error_t ecMult(const EcDomainParameters *params, EcPoint *r, const Mpi *d,
    const EcPoint *s);
 
@@ -133,6 +133,8 @@ const EcCurveInfo secp112r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -173,6 +175,8 @@ const EcCurveInfo secp112r2Curve =
    //Cofactor
    4,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -213,7 +217,9 @@ const EcCurveInfo secp128r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp128r1Mod
+   secp128r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -253,7 +259,9 @@ const EcCurveInfo secp128r2Curve =
    //Cofactor
    4,
    //Fast modular reduction
-   secp128r2Mod
+   secp128r2Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -299,7 +307,9 @@ const EcCurveInfo secp160k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160k1Mod
+   secp160k1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -345,7 +355,9 @@ const EcCurveInfo secp160r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160r1Mod
+   secp160r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -391,7 +403,9 @@ const EcCurveInfo secp160r2Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160r2Mod
+   secp160r2Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -437,7 +451,9 @@ const EcCurveInfo secp192k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp192k1Mod
+   secp192k1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -483,7 +499,9 @@ const EcCurveInfo secp192r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp192r1Mod
+   secp192r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -529,7 +547,9 @@ const EcCurveInfo secp224k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp224k1Mod
+   secp224k1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -575,7 +595,9 @@ const EcCurveInfo secp224r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp224r1Mod
+   secp224r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -621,7 +643,13 @@ const EcCurveInfo secp256k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp256k1Mod
+   secp256k1Mod,
+   //Fixed-base comb table
+#if (EC_COMB_SUPPORT == ENABLED)
+   &secp256k1CombTable
+#else
+   NULL
+#endif
 };
 
 #endif
@@ -667,7 +695,13 @@ const EcCurveInfo secp256r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp256r1Mod
+   secp256r1Mod,
+   //Fixed-base comb table
+#if (EC_COMB_SUPPORT == ENABLED)
+   &secp256r1CombTable
+#else
+   NULL
+#endif
 };
 
 #endif
@@ -719,7 +753,13 @@ const EcCurveInfo secp384r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp384r1Mod
+   secp384r1Mod,
+   //Fixed-base comb table
+#if (EC_COMB_SUPPORT == ENABLED)
+   &secp384r1CombTable
+#else
+   NULL
+#endif
 };
 
 #endif
@@ -783,7 +823,13 @@ const EcCurveInfo secp521r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp521r1Mod
+   secp521r1Mod,
+   //Fixed-base comb table
+#if (EC_COMB_SUPPORT == ENABLED)
+   &secp521r1CombTable
+#else
+   NULL
+#endif
 };
 
 #endif
@@ -829,6 +875,8 @@ const EcCurveInfo brainpoolP160r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -875,6 +923,8 @@ const EcCurveInfo brainpoolP192r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -921,6 +971,8 @@ const EcCurveInfo brainpoolP224r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -967,6 +1019,8 @@ const EcCurveInfo brainpoolP256r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1019,6 +1073,8 @@ const EcCurveInfo brainpoolP320r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1071,6 +1127,8 @@ const EcCurveInfo brainpoolP384r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1129,6 +1187,8 @@ const EcCurveInfo brainpoolP512r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1175,7 +1235,9 @@ const EcCurveInfo sm2Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   sm2Mod
+   sm2Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 #endif
@@ -1221,6 +1283,8 @@ const EcCurveInfo x25519Curve =
    //Cofactor
    8,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1279,6 +1343,8 @@ const EcCurveInfo x448Curve =
    //Cofactor
    4,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1325,6 +1391,8 @@ const EcCurveInfo ed25519Curve =
    //Cofactor
    8,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1383,6 +1451,8 @@ const EcCurveInfo ed448Curve =
    //Cofactor
    4,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -2576,4 +2646,1666 @@ const EcCurveInfo *ecGetCurveInfo(const uint8_t *oid, size_t length)
    return curveInfo;
 }
 
+#if (EC_COMB_SUPPORT == ENABLED)
+
+#if (SECP256K1_SUPPORT == ENABLED)
+
+/**
+ * @brief Fixed-base comb table (secp256k1 curve)
+ **/
+
+static const uint32_t secp256k1CombPoints[] =
+{
+#if (EC_COMB_WIDTH == 4)
+   0x16F81798, 0x59F2815B, 0x2DCE28D9, 0x029BFCDB, 0xCE870B07, 0x55A06295, 0xF9DCBBAC, 0x79BE667E,
+   0xFB10D4B8, 0x9C47D08F, 0xA6855419, 0xFD17B448, 0x0E1108A8, 0x5DA4FBFC, 0x26A3C465, 0x483ADA77,
+   0x42D0E6BD, 0x13B7E0E7, 0xDB0F5E53, 0xF774D163, 0x104D6ECB, 0x82A2147C, 0x243C4E25, 0x3322D401,
+   0x6C28B2A0, 0x24F3A2E9, 0xA2873AF6, 0x2805F63E, 0x4DDAF9B7, 0xBFB019BC, 0xE9664EF5, 0x56E70797,
+   0x829D122A, 0xDCA81127, 0x67E99549, 0x8F17F314, 0x6A8A9E73, 0x9B889085, 0x846DD99D, 0x583FDFD9,
+   0x63C4EAC4, 0xF3C7719E, 0xB734B37A, 0xB44685A3, 0x572A47A6, 0x9F92D2D6, 0x2FF57D81, 0xABC6232F,
+   0x9EC4C0DA, 0x1B7B444C, 0x723EA335, 0xE88C5678, 0x981F162E, 0x9239C1AD, 0xF63B5F33, 0x8F68B9D2,
+   0x501FFF82, 0xF23CBF79, 0x95510BFD, 0xBBEA2CFE, 0xB6BE215D, 0xDE1D90C2, 0xBA063986, 0x662A9F2D,
+   0x114CBF09, 0x63C5E885, 0x7BE77E3E, 0x2F27CE93, 0xF54A3E33, 0xDAA6D12D, 0x3EFF872C, 0x8B300E51,
+   0xB3B10A39, 0x26C6FF28, 0x9AAF7169, 0x08F6A7AA, 0x6B8238EA, 0x446F0D46, 0x7F43C0CC, 0x1CEC3067,
+   0x075E9070, 0xBA16CE6A, 0x9B5CFE37, 0xBC26893D, 0x9C510774, 0xE1DDADFE, 0xFE3AE2F4, 0x90922D88,
+   0x5C08824A, 0x653943CC, 0xFCE8F4BC, 0x06D74475, 0x533C615D, 0x8D101FA7, 0x742108A9, 0x7B1903F6,
+   0x6EBDC96C, 0x1BCFA45C, 0x1C7584BA, 0xE400BC04, 0x74CF531F, 0x6395E20E, 0xC5131B30, 0x1EDD0BB1,
+   0xE358CF9E, 0xA117161B, 0x2724D11C, 0xE490D6F0, 0xEE6DD8C9, 0xF75062F6, 0xFBA373E4, 0x31E03B2B,
+   0x2120E2B3, 0x7F3B58FA, 0x7F47F9AA, 0x7A58FDCE, 0x4CE6E521, 0xE7BE4AE3, 0x1F51BDBA, 0xEAA649F2,
+   0xBA5AD93D, 0xD47A5305, 0xF13F7E59, 0x01A6B965, 0x9879AA5A, 0xC69A80F8, 0x5BBBB03A, 0xBE3279ED,
+   0x27BB4D71, 0xCF291A33, 0x33524832, 0x6CAF7D6B, 0x766584EE, 0x6E0EE131, 0xD064C589, 0x160CB0F6,
+   0x17136E8D, 0x9D5DE554, 0x1AAB720E, 0xE3F2D468, 0xCCF75CC2, 0xD1378B49, 0xC4FF16E1, 0x6920C375,
+   0x1A9EE611, 0x3EEF9E96, 0x9CC37FAF, 0xFE4D7BF3, 0xB321D965, 0x462AA9B3, 0x208736C5, 0x1702DA3E,
+   0x3A545CEB, 0xFBA57BBF, 0x7EA858F5, 0x6DBCD766, 0x680D92F1, 0x088E897C, 0xBC626C80, 0x468C1FD8,
+   0xB188660A, 0xB40F85C7, 0x99BC3C36, 0xC5873C19, 0x7F33B54C, 0x3C7B4541, 0x1F8C9BF8, 0x4CD3A93C,
+   0x33099CB0, 0xF8DCE380, 0x2EDD2F33, 0x7A167DD6, 0x0FFE35B7, 0x576D8987, 0xC68ACE5C, 0xD2DE0386,
+   0x6658BB08, 0x9A9E0A72, 0xC589607B, 0xE23C5F2A, 0xF2BFB4C8, 0xA048CA14, 0xC62C2291, 0x4D9A0F89,
+   0x0F827294, 0x427B5F31, 0x9F2C35CD, 0x1EA7A8B5, 0x85A3C00F, 0x95442E56, 0x9B57975A, 0x8CB83121,
+   0x51F5CF67, 0x4333F0DA, 0xF4F0D3CB, 0x6D3EA47C, 0xA05A831F, 0x442FDA14, 0x016D3E81, 0x6A496013,
+   0xE52E0F48, 0xF647318C, 0x4A0D5FF1, 0x5FF3A66E, 0x61199BA8, 0x046ED81A, 0x3E79C23A, 0x578EDF08,
+   0x3EA01EA7, 0xB8F996F8, 0x7497BB15, 0xC0045D33, 0x6205647C, 0xC4749DC9, 0x0EFD22C9, 0xD8946054,
+   0x12774AD5, 0x062DCB09, 0x8BE06E3A, 0xCB13F310, 0x235DE1A9, 0xCA281D35, 0x69C3645C, 0xAF8A7412,
+   0xBEB8B1E2, 0x8808CA5F, 0xEA0DDA76, 0x0262B204, 0xDDEB356B, 0xB6FFFFFC, 0xFBB83870, 0x52DE253A,
+   0x8F8D21EA, 0x961F40C0, 0x002F03ED, 0x89686278, 0x38E421EA, 0x0FF834D7, 0xD36FB8DB, 0x3A270D6F
+#elif (EC_COMB_WIDTH == 5)
+   0x16F81798, 0x59F2815B, 0x2DCE28D9, 0x029BFCDB, 0xCE870B07, 0x55A06295, 0xF9DCBBAC, 0x79BE667E,
+   0xFB10D4B8, 0x9C47D08F, 0xA6855419, 0xFD17B448, 0x0E1108A8, 0x5DA4FBFC, 0x26A3C465, 0x483ADA77,
+   0x3AD86047, 0xEFF959F4, 0x3A9B8BCA, 0x79B53A04, 0x64CA9067, 0x719CCA77, 0xD35983A7, 0x8E7BCD0B,
+   0x8460372A, 0xEA10047E, 0x47FD68B3, 0x79E88E2E, 0x0CA95145, 0x94031042, 0x2A3DA4B3, 0x10B7770B,
+   0x1ED7EEE7, 0x74328667, 0xA9B17323, 0x7827CCD5, 0x01110E1F, 0x7392FE71, 0x6D6328C6, 0xC0A60972,
+   0xDC69E1CE, 0xC3752C3E, 0x303FB7E5, 0x8EDF3C26, 0x5DB9BE3D, 0x145EE80E, 0xD605C301, 0xFC24D5B7,
+   0x2BCBB891, 0x3AB15024, 0xDF26CBEE, 0x8F7CC643, 0x743F8F9A, 0xE8281BAA, 0x03B2ABE1, 0xC738C56B,
+   0x699A84C3, 0x17E735D9, 0x7880CFE9, 0x82314EEF, 0xACBFBBBB, 0x7F718F2E, 0x951AD253, 0x893FB578,
+   0xDC7BCF13, 0x9D39C3CD, 0xE5B9DA42, 0x9147A764, 0x61A84676, 0x58EB23F6, 0xE4FFC15C, 0xBFC2D555,
+   0x59B9BEC9, 0x2A4A1324, 0xDE124564, 0x56EF4FBA, 0xC1BF08BE, 0xBC0AAA66, 0x5530FE36, 0xB4A78631,
+   0x9E41F197, 0x3D67D146, 0xD73EE44A, 0xB20A8FF6, 0x4A910719, 0x86D7AF29, 0x33E599E0, 0x9BC21301,
+   0xEFBDE3D6, 0x10A2660D, 0x19C01401, 0x0E8FDE54, 0x7AA49BEC, 0x6A7B5537, 0x7508C0E7, 0x9F33812E,
+   0x8118BF1D, 0xBD422767, 0xA4830508, 0x50D357DD, 0xE4AB6320, 0x7CD07090, 0xA0FD5D71, 0x541CCFEF,
+   0xF6E48013, 0x9057BC09, 0x886E9F21, 0xF2516E54, 0xFB855FF5, 0xAA4A3E84, 0x55F519A8, 0xCED807C9,
+   0xFD054C96, 0x8E8BD373, 0xA8D1CA88, 0xEEC4143B, 0xE5FEE5DC, 0x6D51DFDB, 0x19CDE61F, 0x4DF9C149,
+   0xCAD10D5D, 0x92EBAC06, 0xC2884901, 0xB5D506CD, 0x3A1D85D4, 0x050974C2, 0x092D8728, 0x0035EC51,
+   0xD9C3B41A, 0x90D4A05C, 0x59AF300D, 0x8504F89B, 0x66FDA64D, 0x8539C37B, 0xC2F0BFE0, 0x9EA471E9,
+   0x88B92D14, 0x78BEF128, 0x0E1AF314, 0x346601B9, 0xF4A4A777, 0x53AAD005, 0x471E3900, 0xC0C868E5,
+   0xA972062F, 0x0A41F308, 0xB39C65C3, 0x8AC28FC0, 0x31A0C1B2, 0x373FDDF5, 0x479312A4, 0x3BB654B0,
+   0xEE38DC58, 0x8B7E7A84, 0x17B92CFF, 0x16D86529, 0xB4D59215, 0x084AC6ED, 0x895148A6, 0x6C348EA7,
+   0xE0FCB9DD, 0x967D8A33, 0x53A5934F, 0x6EB41655, 0x9BEA5FE9, 0xDA715229, 0xB824F0B2, 0x9BA0B77D,
+   0xB22700C2, 0xE0A273DF, 0x7C4D2E1D, 0x32237ADE, 0xC76065AC, 0x22A41E97, 0x775B13CD, 0xE136CB59,
+   0xDE38F5A1, 0x5CCAD733, 0x61F3C3C3, 0x852F8C5D, 0x0769092A, 0x7A360FA2, 0x88B5339F, 0x7A7959ED,
+   0xE83E937C, 0xE56B35BE, 0x312C851D, 0x95A97C26, 0xF178B17B, 0x7E1538C1, 0xEEC9EE05, 0x0D6A910E,
+   0x9E9FBC99, 0xA82A532D, 0x9F645F87, 0x77E6191A, 0xD2397B9E, 0xD58485DB, 0x580DC783, 0x15523F6E,
+   0x0B196821, 0xFB1EC968, 0x49214ED2, 0x25CC553D, 0x4525F9F5, 0x0FB14554, 0xCDF7B3A9, 0x0504A480,
+   0x26B32BF1, 0x543492FB, 0x4C5CC067, 0x585365E2, 0xB53AB969, 0xDCF2A1A9, 0xCEB7AE1E, 0x993995F4,
+   0x2CA07632, 0xDAD4CD08, 0x043A9B4D, 0xC8320C9A, 0xB4DC6DB5, 0x78B40E14, 0x80EBFE8C, 0xCDD3A299,
+   0xC4881ED4, 0x457E18AA, 0xB2D9AC4B, 0x5D71C0A1, 0x15F1A2A9, 0x866C5FA6, 0xBC055B4F, 0x724EC6B7,
+   0x5CF8801D, 0xE2E12A20, 0x682E487C, 0x5FEB7F82, 0xDB253BA2, 0x42884D32, 0xB6A66EEE, 0x2278626D,
+   0x3180EEF9, 0x6D76A879, 0x9A28B977, 0x8D001220, 0x1AA07B12, 0x7E3ACEBB, 0x1D22E5F0, 0xFA50C0F6,
+   0x3F4F2811, 0x38CD8D7D, 0xA57A213B, 0x5E683293, 0x2281A68A, 0xB72CD287, 0x2397EBA9, 0x6B84C692,
+   0x863E4D1F, 0xBAEBC358, 0x1833891A, 0xE79B1D21, 0xC3FF9D0B, 0xF888C179, 0x5348D428, 0x1621ADE8,
+   0xCBDE7BF5, 0x7C1739D8, 0xF203F3D3, 0x8AC8BC5C, 0xB04CAE27, 0x8693A416, 0xDC6B8B71, 0x7E3E9AD7,
+   0x958D7470, 0xC396FAB3, 0xBA3F73C6, 0x2115D12A, 0x3CE86EA7, 0x1960303E, 0x87AC3F60, 0xBE82A87F,
+   0xE504673B, 0x57114695, 0x33A7BE96, 0x6D0925A6, 0x44FA3E96, 0x80504F4B, 0xD552F9A3, 0xA623715D,
+   0xD27A2DD6, 0x82A20559, 0x32095657, 0x72E3E8F1, 0x2EE5CA03, 0x1918FBF0, 0x23A985BA, 0x0E1F3115,
+   0x86B1E576, 0xD38D6EB9, 0xC9FC776C, 0xD2893FA3, 0x25DC6ADB, 0x5441C7B0, 0xA66B1102, 0x2DD46211,
+   0xEA47F3EB, 0x9B836C6E, 0xBFFF1840, 0xB2C40446, 0x7E4A5106, 0xAA376A68, 0xC8BC0888, 0xFE1CA893,
+   0x9F7CBDF6, 0x350171A0, 0x3E03619E, 0x8605A84F, 0x43DB48A5, 0x82458D07, 0xACABD83E, 0x2595E886,
+   0xB3347D19, 0xAA377F20, 0xE845D4BD, 0xEAC5E9C2, 0x253B325A, 0xE7AF797E, 0x7154E43F, 0xD04E35BE,
+   0x8FDD94B0, 0x75DDC2B5, 0x1CE94907, 0xC649082F, 0x8803B677, 0x6715B86F, 0xF31CD3A4, 0x0179EBA5,
+   0x2E8FDB15, 0x46F63234, 0x3AB6DC53, 0x46F098D2, 0x4D15B80B, 0x07B57D9F, 0x929C91EB, 0x4C963DF9,
+   0x945DD325, 0xE79BE64D, 0xEB47BCDB, 0x523E3FE2, 0xD9269AA2, 0xEA7931DC, 0xA3130D78, 0x9BE4C88C,
+   0x8843F925, 0xEA060D89, 0x98F52D02, 0x05B1F632, 0x2B8F7323, 0xE70A2750, 0x16BDE3A7, 0x1293C805,
+   0xE3F76A0A, 0x2F5FDE3D, 0x229CA347, 0x5D36333C, 0x694C2420, 0xAE147845, 0xBFD4F859, 0x25A1C0B8,
+   0xF523F145, 0xA41CA8FC, 0xDE5A5710, 0x5EC3B1AB, 0x5D14DE5E, 0xFB15F740, 0x1CED5C38, 0xB9B00384,
+   0x6C3394C8, 0x85B84547, 0x33D05CA3, 0x980A386A, 0xE48C40FE, 0x47CF9EE4, 0xE8D7B34E, 0xFE6F7DB6,
+   0x91E1887E, 0x2BB3EB03, 0xEFA1115C, 0x7DC40D14, 0x1D0DD4FE, 0x195C3396, 0x1A2A4570, 0x9B0457E6,
+   0x80A7B570, 0x8D9793E9, 0xA07CB95D, 0x432657C9, 0xDA56EF9E, 0x9A1BF666, 0x916B891F, 0x2B65A9E0,
+   0x0FEDD437, 0x47AB7715, 0xBC968ECC, 0xFA46E33A, 0x937945F7, 0x7C8DB828, 0xE1B2571C, 0x374642A9,
+   0x8BCFB8DB, 0xDF83151C, 0x86E3D903, 0x5FB1702F, 0x84F65C3A, 0x9ADAF518, 0x81C7AEE9, 0xEAE7C348,
+   0x9B969891, 0x5A5E7D06, 0x5FC1FA0A, 0x9D943719, 0x1A6BBECF, 0x9FBFE405, 0x355DCD84, 0x64F751B4,
+   0xDB96EF6C, 0x596361F2, 0xC98804CB, 0xB9941B9F, 0x7E7930DB, 0xB85FE724, 0xB790B83F, 0x0FBB2594,
+   0x2E2F7365, 0xEB62CD0A, 0xB4EC24A2, 0x6B84E815, 0xA17C7DD1, 0x0C958D61, 0xCAE10452, 0x2CB6ECE5,
+   0xC16DF050, 0x5FBD20BE, 0xB06C74DD, 0x6C776E20, 0x0DE237E7, 0xF35F7665, 0xAE607168, 0x0D041A6C,
+   0xADEA7962, 0x57186DC0, 0x2A58A4E9, 0xE6B3958D, 0x12C2C4C8, 0x2BE2790D, 0x97BE6F02, 0x0720A44D,
+   0xC67131CA, 0x1FEB91A6, 0x4AA89BB4, 0xAAE177E7, 0x3DD306A9, 0x8CEF3094, 0xFACADFE7, 0xC9F828F5,
+   0xD48A3E80, 0x0D3C7550, 0x5461AEB3, 0xD7D73BF6, 0x5193C24B, 0xDF88F481, 0x86AFA641, 0x561745CF,
+   0x32D71193, 0x5F058BE2, 0xF0E52906, 0x84142782, 0x34092867, 0xBCD76F67, 0xAB15B33F, 0x574823CC,
+   0xFD32E1CC, 0x11F8813E, 0x1D4BF2CD, 0xCC0FC919, 0x228AB159, 0x566B058B, 0x30EF2135, 0x892A09EC,
+   0x464A8415, 0x4C3C6C07, 0xF43A18DD, 0xF2B2F5CC, 0x0ACD8F4F, 0x95BDF49C, 0x8A7F8937, 0xAB3A52B1
+#else
+   0x16F81798, 0x59F2815B, 0x2DCE28D9, 0x029BFCDB, 0xCE870B07, 0x55A06295, 0xF9DCBBAC, 0x79BE667E,
+   0xFB10D4B8, 0x9C47D08F, 0xA6855419, 0xFD17B448, 0x0E1108A8, 0x5DA4FBFC, 0x26A3C465, 0x483ADA77,
+   0x43FF8359, 0x6048B060, 0xC65E7651, 0x46B4821D, 0xC21DA014, 0xB7D282B5, 0x9F7BD253, 0xA2B7B362,
+   0xFE86FEC2, 0xA2397FEC, 0x046F3835, 0x10D10835, 0xF71E29C9, 0x57A937A3, 0x1695122D, 0x69303894,
+   0xB10FD304, 0xBE27D057, 0x347F3A26, 0x86960638, 0x18E4A8AD, 0x8CD0B2D6, 0x8B4D88D4, 0x6576D554,
+   0x74B35A7E, 0x3214FBF6, 0x19DCA53C, 0xDE91C8FF, 0x7471A2CD, 0x4BA282BD, 0x3A1E8C39, 0xB481E63E,
+   0xDFBFA4DC, 0x476706E4, 0x04C85B17, 0xF5948A78, 0x7ADBB41F, 0x8392119D, 0x731FEA19, 0xD6788590,
+   0xBD3B5406, 0xCA7BCD6B, 0xDDC9A07C, 0x6206F1C4, 0xD21C13AA, 0x940EF5C6, 0x9D5063C4, 0x28EAA8C8,
+   0xF7866196, 0x3E73FCC8, 0x81B3F4AA, 0x25E21C36, 0x9339AE07, 0x52565E80, 0x891E3CC0, 0x29C47EAB,
+   0x26AC3DCD, 0x3D9D8AA9, 0x2FF10FDF, 0x3E49815B, 0x6ACA3EF4, 0xD55A8DEC, 0x88B83DF0, 0x4E0D94B7,
+   0xEDECC847, 0xEA375008, 0x5844A04C, 0x309FEFFB, 0xCF58F7E0, 0x170A37E4, 0x1AD31962, 0xF73C1285,
+   0x4B5D70E2, 0x2CF714DB, 0x17B6864F, 0x99EDBEDF, 0x3E0D2581, 0x8C3A8A7D, 0x59C6B114, 0x506B9E27,
+   0x2B7FE6B1, 0x8F6FF9C4, 0x65DED430, 0xA647B5B0, 0x29AA5F4B, 0x5D53C326, 0x63D326C5, 0xCEA2E172,
+   0xB3CF7BD1, 0x7E5111E5, 0x99C547A7, 0x2C157FA2, 0xC251B9E4, 0x884E42AB, 0x9B97D96F, 0x31685DB5,
+   0x4CF27076, 0xE6847DF8, 0xE7627EAE, 0xD89858AD, 0x7FD9AF59, 0xFCAFEBE7, 0x784E8158, 0x4D49AEFD,
+   0x03AA781E, 0x6B90B662, 0x7DF4D846, 0x6E0F2D1A, 0x359CA6F0, 0xE723F210, 0xA10DD135, 0xCD32FC59,
+   0xCE279A45, 0x042F7989, 0x270F23BF, 0xEA8B0FA8, 0xBD2623D6, 0x505C7CE5, 0xCD0123C6, 0x2C0E4587,
+   0x79858DA8, 0xAA5491ED, 0xC5348EBE, 0xC881DBF3, 0x946801EB, 0xF45BAA5C, 0x07D42762, 0xA02F6127,
+   0x7F56F827, 0x0035AF53, 0xD253E9A6, 0x8344FC81, 0x99E92F76, 0xCA8F1B6A, 0x3CD4A952, 0xDCB97FC1,
+   0x87B67C3D, 0x160A4B4E, 0x408C6130, 0x42443F4B, 0x12C01D14, 0x0A190512, 0xFF5D737B, 0x2EFBD169,
+   0x16F41F0A, 0x355569BA, 0xA5850C70, 0x4D1EBB05, 0x57E55D8A, 0x5A957698, 0x1CE7D833, 0x2543E5F8,
+   0x0596238C, 0x50E913A0, 0x2FBFC3DD, 0xEF0E4031, 0x573634AD, 0xC23EB566, 0x173C881F, 0x9AF00533,
+   0x74B45960, 0xE0B3A843, 0x723DF5A8, 0x76671C46, 0xC61CA37F, 0xD2429517, 0xBB68BE24, 0xE5E08B13,
+   0x6990CFC6, 0x1CAF639C, 0xAABACFF0, 0xF150B8E7, 0x19A76C68, 0xE2EC209E, 0x392329A9, 0xEAE00D38,
+   0x78E4E9DA, 0xF4AC2E21, 0xD33DC867, 0x37B8D870, 0x39BA6EA9, 0xB70813E4, 0x7D0C0BAC, 0x3D56CE04,
+   0x6E005F31, 0x1A7205C7, 0x0BBF0EFA, 0x0B5B1892, 0x79D928AB, 0x8AB4D9BB, 0x2CB116D6, 0x42509897,
+   0xCC2A56D6, 0x8C30941C, 0x004C17BA, 0xA0EC8285, 0xA704D6D1, 0xB54F07C0, 0x14FE9BF7, 0x402D950E,
+   0xFFD37A94, 0x78296EC7, 0xB7A03AC1, 0xBE3298E1, 0x07122852, 0x72BBC0EF, 0xA04E067C, 0x92EAE98F,
+   0xFACFBA20, 0xBD776166, 0x32B1F491, 0xBDA94162, 0x7909D66D, 0x25D8A1A1, 0x2192F380, 0x8FD85DD8,
+   0x1275D68D, 0x0BF5973B, 0x7B5B9AB6, 0xCA56C719, 0xCB3FB9E9, 0x144CB34F, 0xAFB2FFF6, 0x90E00591,
+   0xBE58AD71, 0x8F763889, 0xCF9A3A20, 0xBB30D1F5, 0x29DE8C38, 0x0A05FE96, 0x28DEC3E3, 0x7778A78C,
+   0xFD9F43AC, 0x3B513FC1, 0xFF24AC56, 0x87B38411, 0xF2FF5800, 0xF7098E12, 0xB5A5B22F, 0x34626D9A,
+   0x48ED1367, 0x92B072DD, 0x3D031297, 0x9C02CEDD, 0xB38E947E, 0xFDB0A5A0, 0xA82F6607, 0x0D207580,
+   0xF693D28E, 0x97607326, 0x73D7045F, 0x4BF8E9D4, 0x7806A821, 0x249D105E, 0x9F2E5AE6, 0x7F6F578E,
+   0xB15CB0A8, 0xE1C74ACA, 0x59AF20F2, 0x557E6C70, 0x33DD830D, 0x02CEAD82, 0xF4BAAF3F, 0x42A4634A,
+   0xE0DA513C, 0xB2F7CCF5, 0x638FC0A9, 0xF4FA5D59, 0xA39F43CE, 0x8CDC23A3, 0x811E89B0, 0xB239264B,
+   0x48E82495, 0xB30F1951, 0x980ADE7A, 0x0F7F6787, 0x8F7226B5, 0xED1ED050, 0xFA8C13A7, 0xC1964E0E,
+   0xDDAB5F2C, 0x248B057C, 0x5EE35B01, 0x74D4E362, 0x3B8E224C, 0x9B019BBF, 0x01C21FFE, 0x9BC30516,
+   0x1D66E242, 0xAAA02855, 0xE3E64E20, 0xD114895E, 0x981FF163, 0xA4E1409D, 0x59373163, 0x7C636CDC,
+   0xBDA86BE3, 0x22E7130E, 0xE9C411DC, 0x772062DE, 0xFD6A1C16, 0x3BE6C1EF, 0x952CC272, 0x7274A8E2,
+   0x1B2AEA68, 0xF9668526, 0x3FADA381, 0x6FACBC2B, 0x23CD513E, 0xCE134BEF, 0xFA35CA7B, 0xC7ABFC5C,
+   0x92658C1C, 0xA1B5ABD1, 0xD19D0EB0, 0xBC85B730, 0x29A3CCC5, 0xCFC5FBA0, 0x38F755D9, 0x8758B7F1,
+   0xEB777697, 0x6EB52DD9, 0x55333C65, 0x8E30CA87, 0xBD496935, 0x2EC4ADAC, 0x5138C61F, 0x0278107B,
+   0x00FC31A9, 0x809BD735, 0x907F17BA, 0xD450E064, 0x0927F99F, 0xB4E62680, 0x280282A7, 0xB5FE260E,
+   0x957B0A0D, 0x30663648, 0xF7643745, 0xF0D9B655, 0x46614891, 0x2A0B0C46, 0x2C4E3F25, 0x40E94E24,
+   0xA60E3E05, 0x8D58F6F5, 0xE5A1D66C, 0x6D731D6F, 0xBD3E84DF, 0xECE08E1D, 0xAB745C23, 0x169EE313,
+   0x15544867, 0x4005DEF4, 0x4403863C, 0x41133D51, 0xB15F58E4, 0xC0E4FBDC, 0x3D958A99, 0x5E67D697,
+   0xDE26E2CF, 0x410A4E8E, 0x82703792, 0x292DFF5F, 0xD4843BA9, 0xE043D144, 0xA61301E9, 0x1D22C149,
+   0x35D63671, 0x87FA81C7, 0xF2EB49A9, 0x64885362, 0x3D7EB3C1, 0xF5EB487F, 0x457B84DF, 0xF1A5EAE5,
+   0xAF57DCA7, 0x1F664B95, 0x1B62AFC2, 0xA394CE9C, 0xA22C8191, 0x9A8940FE, 0xCB8CB5B4, 0x0AEBC938,
+   0xBB8C8298, 0xDA173E1E, 0xAC647203, 0xE4573E3A, 0xAC6E28C8, 0x2BD53450, 0x7601BA84, 0xFA7EA771,
+   0xD1F4270C, 0xFD9D7678, 0x063FA89B, 0x432BED96, 0xEB2B23AE, 0xD71AF888, 0xC620FD3E, 0xDB11B810,
+   0x0153A230, 0x76205B8F, 0x20DD1A21, 0xE7B7F86F, 0x83C0C37E, 0xD3AE5D6D, 0x32C2827D, 0x5C1048A5,
+   0xBC73A533, 0x2CF3D4D1, 0x98A8B3AD, 0x91FFB641, 0x0F3E2AD0, 0xBF2469C7, 0x2680C891, 0x6859FC33,
+   0x34087A25, 0xE19A13E9, 0x1EC217E7, 0x6E48000D, 0x7AF20404, 0x30646A48, 0xDBD1BC55, 0xD43E05CD,
+   0x86E439BC, 0x70FEFAB9, 0x1320DC1C, 0x67F66A71, 0x2483C19F, 0xD0B7B242, 0x58089217, 0x0AEE0025,
+   0x710F1026, 0xDDC3C419, 0xCA267C4A, 0x946F2362, 0xA753C190, 0x0604B808, 0xFECEE2E7, 0x0A34BB13,
+   0x837B4596, 0xBC660551, 0x0EE17558, 0xD9411CFE, 0xC15F0F55, 0x0C1EAF02, 0xE08A903C, 0x1D69732C,
+   0xE954D499, 0x18DC08E5, 0x3B5FC120, 0x1AD0C60F, 0xF97CF585, 0x387E34D2, 0xA6E09AB5, 0xDDB618EB,
+   0x0ACB5DD3, 0xEB60973F, 0xD770812B, 0x54ABB29E, 0x7192DB95, 0x8C2095C6, 0x6D221978, 0x7459F30C,
+   0x48506A70, 0x4B215FCF, 0xE7271FAC, 0x8758BF9A, 0xC0CABB2B, 0xAD70FBA2, 0x1D06F3FE, 0x0E7AC39F,
+   0x100AE7A9, 0x1455FA0E, 0x763C7A81, 0x93464741, 0xEDCD7892, 0x2D0AC5EA, 0x94C7A28D, 0x25717899,
+   0xB26B64F1, 0x5CF39944, 0xF5476D99, 0xB7EDCF28, 0x2511E59D, 0xD4CDA4C6, 0x1B58F010, 0x7175407F,
+   0xB24234D5, 0x426E7EFA, 0x74471D2A, 0xB01FE8B7, 0x134CC86E, 0xF36D3401, 0x44E3D550, 0x43B45543,
+   0x700952EF, 0xAEF3DDCC, 0x53CA9141, 0x3297F9BD, 0x553AEADA, 0x2DD28FD1, 0xB0CCD48E, 0x1CC817B6,
+   0x127F538E, 0x26B1DD83, 0x783D6A22, 0xCBE309DD, 0x75033D5A, 0xE444283C, 0xDA85C29C, 0x1E3E58C7,
+   0xD7721115, 0x5884159B, 0xB8E16DC1, 0xB3664810, 0x6135A62F, 0xFA819D53, 0x217DDB87, 0x60CAC14D,
+   0xFB69E482, 0x4B5E3471, 0xD20BCAD2, 0x5D330D63, 0x6976F1D0, 0x455EE5D2, 0x4E25E444, 0xC2FEB935,
+   0x959BACAD, 0x53D48500, 0x602A2A3D, 0x339B127A, 0xE641CB81, 0x1448BEF4, 0x7E0DAE3E, 0xEFA53F42,
+   0xCA6AFD2A, 0xCFA2A15E, 0x891F9E25, 0x25D7C847, 0xDD949DF7, 0x07A27E70, 0xA2BB65C7, 0x6F5BBAE1,
+   0x3DCBE5DD, 0x7CA3DEEA, 0xD03EB4FB, 0xACE67DB5, 0xBE39C4D5, 0x1CC96933, 0x7A56A16D, 0xE10E89B8,
+   0x3D1806CD, 0xB99D5043, 0xE1466A33, 0xE8319AC5, 0x651B1E7A, 0xAE56FA13, 0x4498CB19, 0x8E4CD19D,
+   0x122F0F71, 0x4F085199, 0x564B3619, 0x98BFF21D, 0xEA1344F7, 0x3C554918, 0xC729F953, 0x80F118A6,
+   0x1F1A9CA2, 0x26207C60, 0x04B6563D, 0x2B6624A1, 0x9DDE7FED, 0x92AF032F, 0x7756AF48, 0x43C9408C,
+   0x76A4596C, 0xE43FD414, 0x74F4FBE9, 0xD07984ED, 0x1A03D271, 0xE10744CC, 0x1FA88C85, 0x3FA3A959,
+   0x4A7B42A2, 0x0D42F716, 0x30883954, 0xEB89FCA4, 0x3A788F67, 0xB1EB18B2, 0xBC60F121, 0x7D47DA22,
+   0x5FF781ED, 0x5408C204, 0x7687900E, 0x670205A7, 0x117953B2, 0x44F2847C, 0x9789510C, 0x38C5897A,
+   0xFD6F3968, 0x9FE387C9, 0x1CAEFD1B, 0xFFEB4826, 0x23CA7311, 0x1B4D3164, 0x6DFB3C09, 0x947858D5,
+   0x0CC1B9ED, 0xCFB4A087, 0x6B53BEB2, 0xA9DEE862, 0xD51620BC, 0x0BD8E3AE, 0x0980E5F2, 0x6E7F11C8,
+   0x07EE8B3E, 0x28C8A205, 0x7C8E24B9, 0xD05F9AE5, 0xB355F0D8, 0xDED3A615, 0x3B8ACA26, 0x1498B6F1,
+   0xFBADAF91, 0xE6A6D143, 0x39E47148, 0xE45AF203, 0xD04B9C13, 0x9BC61B74, 0xD26EAEF4, 0x2F92485F,
+   0x192D8926, 0x0B6A3795, 0x4A7699FA, 0x126B5CAD, 0x7FC6F4BA, 0x1A176233, 0xF3824CA8, 0x20070B88,
+   0xDFBB68A2, 0xB79B5ECF, 0x4F279BBD, 0xF6DE05E9, 0x7A39847D, 0xB906D78D, 0x79B928BF, 0x197AC92F,
+   0x08912F0E, 0x6B38627A, 0xF2096E06, 0x66DA353B, 0x80F7FB94, 0xDF136FF1, 0xBDFBA5DC, 0xAC2B3FFE,
+   0x99B8A0BA, 0x5C8E2B6C, 0x776EAFC2, 0xD2CBAABB, 0xBC6BC541, 0x1D2024C2, 0x90D0DC18, 0x75B0FD5A,
+   0x609CE2EC, 0xC09EF18E, 0x4031D2F6, 0xFBB2E1EB, 0xFCF1F434, 0xE59D734C, 0x58BF2658, 0x3CF9A44B,
+   0xEEBF6BB7, 0x7FA42090, 0x3E8565B4, 0xAE040881, 0xAE51BF84, 0x09284CF6, 0xE0A29511, 0x27B2B3A4,
+   0x1397EC0A, 0xC88B67E5, 0x1B219C9B, 0x7ABE3DB7, 0xE3BCDB3A, 0xAE64B66D, 0x6942800C, 0x800E23B4,
+   0xAEB002A6, 0x2CD59C9D, 0x8E32D04A, 0x5C2C98DB, 0xEDF6AA05, 0xA7909E91, 0x457716DC, 0x802DDDC6,
+   0x20A34D02, 0xC1BB3AEB, 0xC7FD6C58, 0x9920E08A, 0xD91BE4A0, 0xE4424FEA, 0xDB848E62, 0xD46B7E27,
+   0x3C1DBE36, 0xFBC5E2C6, 0x499A8C7D, 0x4E4390F2, 0x7EF771B4, 0x09B89E98, 0x4D2DF8FA, 0x03179E31,
+   0x48B5AD2B, 0x71871ABE, 0x01CBB15E, 0x2276676F, 0x43935012, 0x0FBE6332, 0xB73F95CB, 0xFA461B20,
+   0xC9D36995, 0x24CDCC14, 0x3B97B6E6, 0xC382A77A, 0xBCCDEFB3, 0x85A6D079, 0x693867E2, 0x7AA61648,
+   0xAD4E9E90, 0x6FA33DC1, 0x0C210B89, 0x9715B243, 0x99991D1C, 0x6B1D7AEE, 0x56C3B7D6, 0x215EA706,
+   0x5AE60BA3, 0xBE35D078, 0x5368C6D6, 0x2717BD73, 0x1D660217, 0x20FAEBC1, 0x4EA4C464, 0x91B44ADB,
+   0x5EB7D71B, 0xFF0217DD, 0xCBACDB25, 0x64864F81, 0x79DB1649, 0xFA5643D7, 0xC58A4774, 0xF9A2A68C,
+   0x5D76033D, 0x315B0D5D, 0x39A2A2E7, 0x1725522C, 0x1270C1DD, 0x8E139689, 0x77E65BB1, 0x97CF990E,
+   0x64D34089, 0xAB150E3C, 0x0A79CD92, 0xA427E24A, 0x6EB4024E, 0x66A8943C, 0xF39BF3B1, 0x0C6F126A,
+   0x8AA5CD34, 0x2492273C, 0xAEB1ED2F, 0x1C796C26, 0x49711F57, 0xE6E60B49, 0x65551826, 0x10B21046,
+   0x0C680613, 0xAF42A154, 0x0FC8D939, 0x6F5B700C, 0x7F0A41DC, 0xB14F59A2, 0x092D9BE4, 0xF5498B37,
+   0x1499350D, 0x19756A7C, 0x476127B0, 0x0CE33AC1, 0x2BEC1059, 0xDDBD9023, 0xF5CCE58D, 0x6FCA2FE6,
+   0x01E0F19F, 0xE0F0F83A, 0x3A3B24B1, 0x903CC85A, 0xF79BB62B, 0xD1F61B64, 0x7B2DADF7, 0x81BF2264,
+   0xACE757FE, 0x28C79F0A, 0x2DCA79EF, 0x75191457, 0x14761633, 0xD1A6BBBE, 0x4571386B, 0x17B832E4,
+   0xCB5B0597, 0xF0A6CF26, 0xAC3971A5, 0x92CF246A, 0xC73C3D28, 0x4E6675C1, 0x44C5FCC9, 0x5A7AB536,
+   0x607E5BA7, 0x40B90860, 0xF5C5549B, 0x1AA584BF, 0xE962D92C, 0x57F76E5C, 0x2B4E9144, 0x60D45EFB,
+   0x0417E3D3, 0xAC84AF0E, 0x0FAE5B6C, 0x248E3DAD, 0xE9A1346E, 0x26EE0961, 0x8BA9086C, 0xCAAD90BE,
+   0x404F423D, 0x8AD7D399, 0x4AB8A5F7, 0x59558598, 0x276EF53C, 0xF714D3FA, 0xE3B32A5B, 0x71C441D7,
+   0x07388EB8, 0x495BD4C1, 0xC62BCB6D, 0x164EB4D7, 0x66BB2CDA, 0x5140B981, 0xE309896C, 0xF642D5AF,
+   0x40AEEEC1, 0xA1A6B0CE, 0x8252ED26, 0x861B5597, 0x78EFF849, 0x6C5F6DE2, 0x18BDAEA0, 0xB0FB446D,
+   0xCC52CB4B, 0xDD4C2E4E, 0xA94F9A62, 0x614F658C, 0x734823C2, 0x4A02453E, 0xCB570754, 0x44573F4F,
+   0x9D2B66F6, 0x0847B97E, 0xAE0E537A, 0xFD9A06EC, 0xE4121630, 0xFB8AF82A, 0xE6D8F9A2, 0x2B5A3487,
+   0x07FD388F, 0x8BB94C3A, 0xB8A94CB3, 0x55C3D037, 0xFAACA627, 0x53602650, 0x8E0F3281, 0x5BEA4F2E,
+   0x716E7B6C, 0x792EA92C, 0xB2C822FF, 0x91A2D0AA, 0x45E2A74B, 0x39AF1271, 0x05C8F5F6, 0xADC613FF,
+   0xFB00CBF4, 0xE9D9793E, 0x71B4D7A7, 0x31B7A7CC, 0xE38703C1, 0xB5254C04, 0xF22280E9, 0xC97F9A92,
+   0x6F67A7FA, 0xBCEE76E7, 0x93B18760, 0x9ED7EBA3, 0xA69403A8, 0x2D464F09, 0xD03C30CE, 0xE0F4E23F,
+   0x92CD776F, 0x43938577, 0x6D650A84, 0xBAF51315, 0x561B50EB, 0xF7AA6C27, 0x368A21BE, 0xF4281BF2,
+   0x93605259, 0x886E0C32, 0x8D59B90B, 0x78DF128A, 0x40223094, 0x93EBA202, 0x067BEF7F, 0x37AC7F14,
+   0xDA29E74A, 0x83BBBB5D, 0xA76E9B01, 0x5F455F8F, 0xB5ECB4C4, 0x58BA3533, 0x57C1C6BD, 0x288E321F,
+   0x59F54695, 0x1A6D4CB9, 0xA333FEEC, 0x2332BDB7, 0x872C146A, 0x7FC5F4D0, 0xCAF7A4CC, 0x2B3FEFC1,
+   0x709FAF11, 0x15D04F75, 0xF8978B40, 0xEAF837AC, 0x59909228, 0x28B64297, 0x24602FD5, 0x92E6323D,
+   0x95DA59E5, 0x8671B790, 0x0A748575, 0x7AA04FF6, 0xD5D6A26E, 0xC9B59947, 0x3B895A3E, 0x9E7DEE38,
+   0x53EE485B, 0x3E0FBA1A, 0x026CA84F, 0x354A1921, 0x0AC7CC2F, 0xDD1AB3C3, 0x780722A4, 0x49831BFA,
+   0x3CD79F44, 0xF8D19D14, 0x59D0BD87, 0x7BC9F6BE, 0x31E36C60, 0xFAAD3077, 0x90C75AB2, 0x1C1E6283,
+   0x3714FF9F, 0xBBA3BA1E, 0x27969B07, 0x1E7BB20B, 0x4D391133, 0x523B1791, 0x9C57B316, 0xA7F4D242,
+   0x1F530FEE, 0x93CCAD49, 0xFB3B1B98, 0x5AE91D7F, 0xBA91BF45, 0x142893FD, 0x570FBA39, 0x25898AD2,
+   0x1B7180E3, 0x0BAA5982, 0xC7C54C52, 0x8A89E34C, 0xF28203DB, 0xC9D4AAD1, 0xB0267681, 0x2188B6D4
+#endif
+};
+
+const EcCombTable secp256k1CombTable =
+{
+   //Number of teeth
+   EC_COMB_WIDTH,
+   //Distance between two consecutive teeth
+#if (EC_COMB_WIDTH == 4)
+   64,
+#elif (EC_COMB_WIDTH == 5)
+   52,
+#else
+   43,
+#endif
+   //Length of a coordinate
+   8,
+   //Precomputed points
+   secp256k1CombPoints
+};
+
+#endif
+#if (SECP256R1_SUPPORT == ENABLED)
+
+/**
+ * @brief Fixed-base comb table (secp256r1 curve)
+ **/
+
+static const uint32_t secp256r1CombPoints[] =
+{
+#if (EC_COMB_WIDTH == 4)
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81, 0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2,
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357, 0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2,
+   0x8E14DB63, 0x90E75CB4, 0xAD651F7E, 0x29493BAA, 0x326E25DE, 0x8492592E, 0x2811AAA5, 0x0FA822BC,
+   0x5F462EE7, 0xE4112454, 0x50FE82F5, 0x34B1A650, 0xB3DF188B, 0x6F4AD4BC, 0xF5DBA80D, 0xBFF44AE8,
+   0x097992AF, 0x93391CE2, 0x0D35F1FA, 0xE96C98FD, 0x95E02789, 0xB257C0DE, 0x89D6726F, 0x300A4BBC,
+   0xC08127A0, 0xAA54A291, 0xA9D806A5, 0x5BB1EEAD, 0xFF1E3C6F, 0x7F1DDB25, 0xD09B4644, 0x72AAC7E0,
+   0xD789BD85, 0x57C84FC9, 0xC297EAC3, 0xFC35FF7D, 0x88C6766E, 0xFB982FD5, 0xEEDB5E67, 0x447D739B,
+   0x72E25B32, 0x0C7E33C9, 0xA7FAE500, 0x3D349B95, 0x3A4AAFF7, 0xE12E9D95, 0x834131EE, 0x2D4825AB,
+   0x2A1D367F, 0x13949C93, 0x1A0A11B7, 0xEF7FBD2B, 0xB91DFC60, 0xDDC6068B, 0x8A9C72FF, 0xEF951932,
+   0x7376D8A8, 0x196035A7, 0x95CA1740, 0x23183B08, 0x022C219C, 0xC1EE9807, 0x7DBB2C9B, 0x611E9FC3,
+   0x0B57F4BC, 0xCAE2B192, 0xC6C9BC36, 0x2936DF5E, 0xE11238BF, 0x7DEA6482, 0x7B51F5D8, 0x55066379,
+   0x348A964C, 0x44FFE216, 0xDBDEFBE1, 0x9FB3D576, 0x8D9D50E5, 0x0AFA4001, 0x8AECB851, 0x15716484,
+   0xFC5CDE01, 0xE48ECAFF, 0x0D715F26, 0x7CCD84E7, 0xF43E4391, 0xA2E8F483, 0xB21141EA, 0xEB5D7745,
+   0x731A3479, 0xCAC917E2, 0x2844B645, 0x85F22CFE, 0x58006CEE, 0x0990E6A1, 0xDBECC17B, 0xEAFD72EB,
+   0x313728BE, 0x6CF20FFB, 0xA3C6B94A, 0x96439591, 0x44315FC5, 0x2736FF83, 0xA7849276, 0xA6D39677,
+   0xC357F5F4, 0xF2BAB833, 0x2284059B, 0x824A920C, 0x2D27ECDF, 0x66B8BABD, 0x9B0B8816, 0x674F8474,
+   0x677C8A3E, 0x2DF48C04, 0x0203A56B, 0x74E02F08, 0xB8C7FEDB, 0x31855F7D, 0x72C9DDAD, 0x4E769E76,
+   0xB824BBB0, 0xA4C36165, 0x3B9122A5, 0xFB9AE16F, 0x06947281, 0x1EC00572, 0xDE830663, 0x42B99082,
+   0xDDA868B9, 0x6EF95150, 0x9C0CE131, 0xD1F89E79, 0x08A1C478, 0x7FDC1CA0, 0x1C6CE04D, 0x78878EF6,
+   0x1FE0D976, 0x9C62B912, 0xBDE08D4F, 0x6ACE570E, 0x12309DEF, 0xDE53142C, 0x7B72C321, 0xB6CB3F5D,
+   0xC31A3573, 0x7F991ED2, 0xD54FB496, 0x5B82DD5B, 0x812FFCAE, 0x595C5220, 0x716B1287, 0x0C88BC4D,
+   0x5F48ACA8, 0x3A57BF63, 0xDF2564F3, 0x7C8181F4, 0x9C04E6AA, 0x18D1B5B3, 0xF3901DC6, 0xDD5DDEA3,
+   0x3E72AD0C, 0xE96A79FB, 0x42BA792F, 0x43A0A28C, 0x083E49F3, 0xEFE0A423, 0x6B317466, 0x68F344AF,
+   0x3FB24D4A, 0xCDFE17DB, 0x71F5C626, 0x668BFC22, 0x24D67FF3, 0x604ED93C, 0xF8540A20, 0x31B9C405,
+   0xA2582E7F, 0xD36B4789, 0x4EC39C28, 0x0D1A1014, 0xEDBAD7A0, 0x663C62C3, 0x6F461DB9, 0x4052BF4B,
+   0x188D25EB, 0x235A27C3, 0x99BFCC5B, 0xE724F339, 0x71D70CC8, 0x862BE6BD, 0x90B0FC61, 0xFECF4D51,
+   0xA1D4CFAC, 0x74346C10, 0x8526A7A4, 0xAFDF5CC0, 0xF62BFF7A, 0x123202A8, 0xC802E41A, 0x1EDDBAE2,
+   0xD603F844, 0x8FA0AF2D, 0x4C701917, 0x36E06B7E, 0x73DB33A0, 0x0C45F452, 0x560EBCFC, 0x43104D86,
+   0x0D1D78E5, 0x9615B511, 0x25C4744B, 0x66B0DE32, 0x6AAF363A, 0x0A4A46FB, 0x84F7A21C, 0xB48E26B4,
+   0x21A01B2D, 0x06EBB0F6, 0x8B7B0F98, 0xC004E404, 0xFED6F668, 0x64131BCD, 0x4D4D3DAB, 0xFAC01540
+#elif (EC_COMB_WIDTH == 5)
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81, 0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2,
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357, 0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2,
+   0x071E5C83, 0xEEA6BC92, 0x8542A0BE, 0x8BD27F19, 0x2A58E5B1, 0x20A845B7, 0x5026D73F, 0x54CCC941,
+   0x140916A1, 0xCFD08EF7, 0x5D8EE496, 0x929E0BCC, 0xDAD2BF22, 0x3A8F8715, 0xB4514532, 0x1C433F45,
+   0x04BAC870, 0xF7D24BB7, 0x3A23C6AB, 0x593A09A0, 0xF94C9D1D, 0xDFCC2358, 0x297BED02, 0x3CFA0F87,
+   0x40F26940, 0xCE98A30B, 0x0248A8AF, 0x62121C0D, 0x8309AF9B, 0xA758AA80, 0x70BE12C6, 0xE4E37694,
+   0x3ECCA7E0, 0xC739A5EA, 0x6743333E, 0xA7D2C98F, 0x224D9428, 0x0FEF6335, 0x5C792A0C, 0x7EF2EE3C,
+   0x552AC094, 0x302B22DD, 0xDFBD3D20, 0x81B21450, 0xD5E609DB, 0xA4F67F51, 0x30ACC011, 0xAFB68627,
+   0x86EF7D7D, 0xDD37E3FF, 0x088B86DB, 0xF6D77C27, 0x254C5491, 0x28FE9A4F, 0x6DF0FD5E, 0xD6690337,
+   0xADDAD596, 0x9FF04992, 0x9E4373F9, 0xF3D1A7AF, 0xDF074167, 0xA13E9578, 0xE6D13D22, 0x20E2A53C,
+   0xB0879605, 0xD7B86AEE, 0xBE3C7265, 0xA424EC2D, 0x12F01E9E, 0x276203C2, 0xB77E46E9, 0xB666FAC5,
+   0x3BF0C52D, 0xF431BB1A, 0x726CD8B6, 0xEF46A44A, 0xEE3DE5A9, 0xEB5ABC19, 0x90246904, 0x38AAA380,
+   0x525D6ABF, 0xAEBFD735, 0x96BEA25A, 0xC302F8F4, 0x544920A4, 0xDB82B3EA, 0x02EADB2E, 0x621C75D1,
+   0x9EF485F0, 0x8939DC4C, 0x57C46D63, 0x225D03D8, 0x522D7F70, 0x4FDAC96F, 0xB4FA649D, 0xD7C4A4FE,
+   0x943E832A, 0x9C762EF1, 0x1786DF70, 0x07E50AB0, 0x2589F18E, 0x90F573A8, 0xA7C2A51A, 0x0D2BF28B,
+   0x5B20D37C, 0x48263AF1, 0x60551446, 0x27EC9DB9, 0x94B4E7ED, 0x7087A10A, 0x13BD00AC, 0x0CAC3F43,
+   0xC0B9372A, 0x8BC659AA, 0xEDD9583F, 0xF7659958, 0x8C267D88, 0x9F05F94A, 0xC99A739D, 0x00DC46E7,
+   0xDF55D0F2, 0x4AF50A00, 0x8156BF6A, 0xB5EB202D, 0x5228C111, 0x40D1E3AB, 0x45793424, 0x0312A557,
+   0x9E6486E0, 0x9D90CDA8, 0x1C7522C0, 0xC8A820BD, 0x08DCD7AB, 0x867C5580, 0x882A7892, 0x3C510CE2,
+   0x646D54C6, 0x0E283334, 0xEDA4E046, 0x33392776, 0x5BA997B0, 0xC3A7FC08, 0x5ACF053F, 0xD35E620F,
+   0x7EB8CFEE, 0x8D9692F7, 0x0D8C013D, 0x05E3F223, 0x84E32E59, 0x76347A52, 0x15B0A1E5, 0x3C53E290,
+   0xFAE798D4, 0x538B7DA5, 0x00D23591, 0x1B9F1BD1, 0x9A08693F, 0x11A9F072, 0x140EFEB3, 0xD30E7CDA,
+   0x4DD6C004, 0x81DEC926, 0xDAD210D5, 0xBFED14FE, 0xB96B9911, 0x39F9FF69, 0x29C2024D, 0x02FD7B73,
+   0x715D29FC, 0x50CFCEB8, 0x0C236311, 0xB682B999, 0xC7797831, 0x00F34ADD, 0x59927DF3, 0x42EBD3CB,
+   0xF8E8F683, 0x6DFCF787, 0x3F7FBE90, 0x13D72B7A, 0x2DF232CF, 0xFD426D94, 0x5FE39AAD, 0xED84BB42,
+   0x732995FC, 0x023E67A1, 0x355430E3, 0x67DD0A8E, 0x97A1D703, 0x0CF83B61, 0x583C33F2, 0xA3233455,
+   0x68142904, 0x27014AB4, 0x00CFA617, 0xFB500882, 0x7009B958, 0x6745FF87, 0xD449242D, 0x9E9889BC,
+   0x575616C8, 0x035B613B, 0x138E99E2, 0x00855156, 0x292E6AA0, 0x94C0D24B, 0x7E79B3A2, 0xD9BA5B68,
+   0x5F165D99, 0xCEBBBC7B, 0x8A4EEE61, 0x50CC51C1, 0x1B4D0D1F, 0xB31D2353, 0x66382ADA, 0x95E18452,
+   0x0A839B5B, 0xACAD4F81, 0x4142FF0F, 0xA0A2A96E, 0x1F4FA12F, 0x3EAA8289, 0x6B0FB8F3, 0x68D68C8F,
+   0x839BB85F, 0x320F09C3, 0xA050E62C, 0x0101FB06, 0x9AD53458, 0x557582C9, 0x1666432B, 0x55D5398D,
+   0x4FED936F, 0xF7F63118, 0x1833D9E1, 0xD90D6A7F, 0x8EBAA72A, 0x059C6A9E, 0x49FF8E2D, 0x576E2290,
+   0x51BBB3F1, 0x9311A269, 0x8D0F4F65, 0xE80F26BD, 0x6BECCBB9, 0x9D3DC334, 0x101E5DE4, 0x54E244D5,
+   0xF1B19E28, 0xB3AD4C6E, 0x58C2E3B7, 0x4334FBC0, 0x35DF9C25, 0x19BD4107, 0xEC106EB6, 0xD6BBEC0E,
+   0xE5046DC5, 0x788251C7, 0xF179327B, 0x12839B95, 0x4A8CB46E, 0xF1C05D98, 0x3C00736B, 0x443737CD,
+   0x12CD8FE5, 0xA760A456, 0x0817BDD9, 0x797489DE, 0xF42C23E8, 0xC56EB80A, 0xE6FE7AF5, 0x83719DD7,
+   0x3FEFCFC8, 0xE8881A83, 0xB9B5290B, 0xAEA3C9E0, 0x771E4688, 0x10B37ECD, 0xD4D021B6, 0xEE0816A3,
+   0xB3A8CAA1, 0x8E9929BF, 0xC105F2D1, 0x48915DCF, 0xDB49019F, 0x3A5FDF82, 0xAD9006E1, 0xC4A438E3,
+   0x87DE4B29, 0x5DB9620F, 0xD91ECB2E, 0xD7420C18, 0x32ACF105, 0x301BA1B2, 0x7853A937, 0xDB96BB0C,
+   0xC359AC34, 0xD84BFEF6, 0x64852A1D, 0xAB80CEF0, 0xB9DA1717, 0x3FBEE4D3, 0x7A13222C, 0xB325074E,
+   0xE83AD2C9, 0x5D6DC503, 0xAED035BE, 0xCA9F7A1D, 0xCBD21E33, 0x552788AC, 0xE09CB9F0, 0x8699DD31,
+   0x329BF961, 0x38584196, 0xB82A5AF9, 0x4CB20E96, 0xC72C78C1, 0x24199908, 0xE92859B7, 0x16E65484,
+   0x052FDE29, 0x6A201C4B, 0x0031DBB4, 0x6C897123, 0x16C1DA96, 0x4A759982, 0x2CC67214, 0xEEC0B975,
+   0x812C864E, 0xB908B9F1, 0x8439F6BA, 0x367FB66A, 0xF966F329, 0x789D664B, 0xF7F1D283, 0xE02AF770,
+   0xDB3038DD, 0xA20A2C70, 0xE99D5C7C, 0x5F0B46D5, 0x4B600B83, 0xC9B97D37, 0x3DF3245E, 0x186C7F79,
+   0x4F1CE57F, 0x2AF72460, 0x91E2D8ED, 0x9249897F, 0x8D2EA797, 0x8139B36A, 0x9AB58913, 0x9C428DB8,
+   0x6471AAA0, 0xB4A196FB, 0x1B6B9730, 0xDCBAB650, 0x295B57D2, 0x7AFCCC8A, 0x4E33A65D, 0xEE2280F4,
+   0x890FCD12, 0xC47A0803, 0x82604F6B, 0x4E98A98D, 0xED5FBBD2, 0x0D598F06, 0xA6A1EB84, 0xCE46EC91,
+   0x4BE6458D, 0x1F1E4F3F, 0x595E6547, 0x5F72CC22, 0x271A93F1, 0x5BC5341E, 0x58A5F263, 0xC62E155C,
+   0x58BA7FF4, 0x5F6F845A, 0x7E36A6AD, 0x67E1F7DC, 0xEEAA4D04, 0xD33A7657, 0x18267E4E, 0xFF9F2322,
+   0x4A53789F, 0xD369F11F, 0x3696B437, 0xC7876FB6, 0x0BABA29A, 0xA0E8F0A7, 0x32F6E514, 0xA0318A5F,
+   0x11775A08, 0x5C4A43D1, 0x362EEBB1, 0x418C507C, 0x09A325AA, 0xFD08903F, 0xF0EEBB3A, 0xF320B8FC,
+   0xC7644C1D, 0xE33F0255, 0xBB9002D8, 0x4030ECC3, 0xF4646F9F, 0xA4486916, 0x959C44FA, 0x5E677D0C,
+   0xD88B9144, 0xE2E7D7D0, 0x6248F91F, 0x5D93A86F, 0x02993AEA, 0xE33D0BD5, 0x3100D31E, 0x449F0CE6,
+   0x73CF2678, 0x3FCD925A, 0xA6D0AFC7, 0x34CA923B, 0x3067791F, 0x9011091D, 0x5A7941E4, 0x8C568874,
+   0xFC339800, 0x34D37180, 0x595C51F4, 0x7744316B, 0xE88C6420, 0xF2DDB693, 0x5BAD14D2, 0xFB3A48B1,
+   0xFDAAB256, 0x52DF1588, 0x3127354C, 0x68C0CD44, 0xA591F853, 0x2A849471, 0x93D0CB92, 0xE4DA88E9,
+   0x1639C624, 0x6D1EA35D, 0x263707BA, 0x60FE2A36, 0xD0F3BC51, 0x97FC50DE, 0x10062E80, 0xF7FA4D15,
+   0x024C168D, 0xC429A113, 0x3FEAA272, 0xB6C935FB, 0xE639EC09, 0xB58A6071, 0xF9C13DE7, 0x4B59253A,
+   0xFBFB8955, 0x6D2D68F2, 0x50723FE2, 0xF0064C12, 0x01F185F5, 0xE85D7820, 0x7FA79C93, 0xAA0307BF,
+   0x5B696527, 0x2E75A266, 0x5A00169C, 0x1A2530B0, 0x4286FB42, 0x76C4C180, 0x8E831D5B, 0x825F0194,
+   0xEF703739, 0xDBF0A11F, 0xCE5B106A, 0x106F9BC4, 0x24111150, 0x61794C4F, 0xBC723A17, 0x435872FE
+#else
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81, 0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2,
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357, 0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2,
+   0xB049E7CD, 0xCD013F88, 0xE57FDC00, 0xE8F9257A, 0xFC3A9301, 0x3BE71969, 0x58CFF937, 0x987F256D,
+   0x6EFA35D6, 0xB7254BBC, 0x07AAFFDB, 0x47B46052, 0x0007E39E, 0xE860EBD6, 0x94EC505C, 0x8E926956,
+   0x5A1C3FB1, 0x59DB167C, 0xBF318EB2, 0x98B3CE2A, 0xD2BC2FA6, 0x2DF1C41E, 0x6ED1B2AF, 0xEFCC2C43,
+   0x97B25513, 0x17FE07F1, 0x3734A589, 0x46824533, 0xED34F543, 0xA5384A77, 0x8D9F3863, 0xF3684F9C,
+   0xBF780C2C, 0xFDC73E83, 0x2D666817, 0xFFDC6794, 0x02436893, 0xC14B66DD, 0x0D54650C, 0x6EEC9567,
+   0xEDBFCD32, 0x089EC1A1, 0x3A07FF89, 0x79AB6615, 0x65EA0105, 0xFC281DE0, 0x997732C2, 0x14BB5350,
+   0x7318188E, 0xAEC90264, 0xCA167099, 0x410BEC28, 0x099C202B, 0xBF664D2F, 0x55FA625C, 0x13CCCA34,
+   0x05421C0C, 0xAA84C231, 0x6CDB0D71, 0x6B647521, 0xFB216A5E, 0xE90446B1, 0xAF46893D, 0x4B5BA5A5,
+   0x4862C5DB, 0xACA2FA08, 0xA1717F8A, 0xDDFFC222, 0xE4E09FD2, 0xAB839A14, 0x980330F5, 0xF86A9078,
+   0xC1DD7DCC, 0x6890F24C, 0xEA6EFD98, 0xF75DCCFA, 0xFF9A093B, 0xBA2612B8, 0x2568653C, 0x20347D0C,
+   0xCBDB1C78, 0xD3B22809, 0x30F6CDA4, 0x5591C8EB, 0xBFE80F8B, 0xB6E28740, 0x40E7E7E7, 0x0F74342A,
+   0x351C51F2, 0xD2968E87, 0xF5E17B5E, 0x65C5C581, 0x9D994E2E, 0x6F58F02A, 0xF5C1EC07, 0x531C0B00,
+   0x1A6B665E, 0xEB042121, 0xA7F6803A, 0x802F779E, 0x3C0804C3, 0x47501F2A, 0x4945A1D4, 0xA263919B,
+   0x30BCDCFB, 0x9EE40400, 0x4C00EFE2, 0xAC3F83DF, 0xE60D60C5, 0x2E9D3C9D, 0x2AED20FC, 0x873200BD,
+   0x8B21AA51, 0x2B52C47D, 0x5A7E870D, 0x0F503629, 0x88B45127, 0xBAA92814, 0xC402E050, 0x27D6451E,
+   0x5567432D, 0x5C96EC14, 0x0F4150C7, 0xCDEB9829, 0xCDEEF566, 0x5D91740C, 0x1BE9E583, 0x2A58FA5E,
+   0x5788C0F6, 0xD8142DFF, 0x247FDE25, 0x89BF5229, 0x14E2280F, 0x5C971DDB, 0x09904E3F, 0x785B7E91,
+   0x2E7E6F0B, 0x445E4519, 0x4CE293DD, 0x8789440E, 0xC797BE30, 0x96B84F57, 0xFA3EA32D, 0x6B44059D,
+   0x2195A979, 0x73B7C550, 0xB8DD5813, 0x2D7ED474, 0xE104E9AC, 0xC0B9ECD2, 0xA2BD0ED8, 0xDC90D975,
+   0x4DD6EB2E, 0x9FB55203, 0xC01DFDE8, 0x50D554BB, 0xF0977A30, 0x4CFD3277, 0x815374C4, 0xC87CE232,
+   0xCF9A3CA9, 0xE4B541B6, 0x08B49B2F, 0x1C650587, 0xF552641E, 0xB95F91B3, 0x5C301277, 0xBDDC23AC,
+   0x04DABA43, 0x519D0700, 0x8450CFA2, 0xC003DCC3, 0x4E48EFDE, 0x73A1C8F5, 0x5B04F761, 0x7D0CA942,
+   0x1703406D, 0xCB4DC35B, 0x75DAC54C, 0x4FD3AFC9, 0x29F02878, 0x112321EB, 0xAD6B225F, 0xAFB18D2F,
+   0xF1776A67, 0xDDF58273, 0xF6B96C2F, 0x96889755, 0x22208FFB, 0x31A8D663, 0xFCCA4877, 0x5ED81C10,
+   0xE834A3C4, 0xFF0E1F34, 0x1C4AB236, 0x0D59B6AE, 0x015A211B, 0x10EB194A, 0x3892DDC5, 0xED6E13E0,
+   0xFB3F678D, 0xAC88DF04, 0x544026A9, 0x6F0FBF44, 0x619CECBA, 0xCDE8CD7A, 0x80D9A8CC, 0x02F322E5,
+   0x336AAF40, 0x2DC61E1B, 0x4251F5B7, 0x897E87BD, 0x6511B370, 0x2FB32023, 0x2341F499, 0x460FA9CF,
+   0xCBAF01A7, 0x03E63B79, 0x44157434, 0x937E123F, 0x809E4A1A, 0x9D59226E, 0x41775E62, 0x18D6F63A,
+   0xA9AA52DF, 0x3CD5F4E4, 0xB42A627F, 0x18C452B1, 0xD991ECE6, 0x6DBC4189, 0x7F608BF7, 0x45A511C9,
+   0x125EC16C, 0x7B52BD12, 0xD22955CE, 0x5A919B27, 0xCB625AD2, 0x3FE3337F, 0x73EA9B6D, 0x73BE0EC7,
+   0x016476EA, 0xC6E4B6D0, 0xD4EC2510, 0x71B9A7E5, 0xCBE490D2, 0x1975B71E, 0xB52ACD25, 0xDF6B472F,
+   0x784055EB, 0xF1738716, 0xB87D399E, 0xCCC7B0B3, 0x1BB51119, 0x3C9A1337, 0xA88FD593, 0xB42639E1,
+   0xC219C20B, 0x86A38D54, 0xB50A4733, 0xAFCDD2CA, 0x72096638, 0xF4CF8797, 0x24CE0E94, 0xD949CAA2,
+   0x96F9AE13, 0x678664AE, 0xC984DE46, 0x00EF5BA9, 0x8D549567, 0x622ABC7F, 0x57DB924D, 0x673ED500,
+   0x20B4D697, 0x41E94206, 0x29FA0DF9, 0xA10FD0D9, 0x76022C38, 0xF11EB0A7, 0xA5621C63, 0xFFCB7DDC,
+   0x0927965A, 0x24E37B1B, 0xBD2C199E, 0x8D9FC102, 0x907F3F85, 0x862DE75E, 0x5A9C778E, 0xD3985129,
+   0xB56BC451, 0x48D63748, 0xA939440A, 0x0544DE81, 0x664EC19C, 0xDA24EB0B, 0x41F42BF6, 0x4FB6E562,
+   0x66BB5D6B, 0x21B2C80E, 0xD25BD41B, 0xA4123924, 0xBCE2D418, 0x6F95F5F2, 0x4D6D91D8, 0xA9232776,
+   0xF119B8CC, 0x546A08E7, 0x8AFC696A, 0x03B7D523, 0x459F70B4, 0x0A896132, 0xA86A9116, 0x57A46257,
+   0xBB314C65, 0xFAA56FEF, 0x74795C6D, 0xF4E61F40, 0x437850D6, 0x1A3C5652, 0x6621EC11, 0x7C4B127D,
+   0xE83CFA35, 0x6DD25E26, 0x1FF3BDDC, 0x61E44DA0, 0x121733FA, 0xB7B67B02, 0xFCD798CA, 0x7C48F60D,
+   0x090F5154, 0x244D234A, 0x8CAE33BB, 0x93B7F2FB, 0x426D1516, 0x158BF2F6, 0xA801E86E, 0xA8A947A8,
+   0x56C8815E, 0xF41E0307, 0x7D37A2F1, 0xBAF647E3, 0xFEFAFBF5, 0x7791EB36, 0x35B7F606, 0x158262FB,
+   0x32DCE9E5, 0xF6C32255, 0x361B4780, 0x6C7CD4CE, 0x3F85288F, 0xE5BE5E70, 0xC98E624A, 0x4C281AA3,
+   0x7FD58AE5, 0x9D7F749E, 0x37EA57A2, 0xC78BA263, 0x4F5AB5B7, 0xB5C05127, 0x5F2D643B, 0x6FD3F54D,
+   0x2116B8CE, 0x3428E311, 0x71B28987, 0xC52D1D24, 0x8299421F, 0x87F70BE9, 0x64F49798, 0x0A5FD098,
+   0x4D6A3DEF, 0x5B2911DD, 0xB96008F1, 0x4BEDD07C, 0xE36E7D64, 0xEE748A6F, 0x4BBF5CF4, 0xBFC49934,
+   0x8E74750F, 0x55C6F62D, 0x48919902, 0x22639F87, 0x958A248F, 0xFA01AA94, 0xED51AA40, 0x2743AE8A,
+   0xE76CCBC0, 0x75EA69CB, 0xA762DEB7, 0xC9736051, 0xAF2BFF4C, 0xA720D4C6, 0xBE6D6DBA, 0x8E4C7B10,
+   0x2F128433, 0xAF5C0EFE, 0xA1FE85EC, 0x834CBF1F, 0x2685F018, 0xD321C5A6, 0x717A5340, 0xB5B09CF6,
+   0x86EB7815, 0x9CDDA821, 0xCE413265, 0x8C003612, 0x91B577F5, 0x8BCE1FAB, 0x488F730C, 0x0F3F29FF,
+   0xE6960D55, 0xEBB08063, 0xAECBF467, 0x1A9699E2, 0x4CE5761B, 0x6B1564A4, 0x81382996, 0x08F00EA5,
+   0x96BF8EA5, 0x6C10CDD2, 0xE8CD868F, 0xE28C488A, 0x46442D00, 0xBA9226C3, 0xFA1F864B, 0x9125CAED,
+   0x2E21B4AF, 0xF33BD66E, 0x68DBE58C, 0x12DC5537, 0xE5353044, 0xD9B85123, 0x07BC6B60, 0xF4925BDE,
+   0x70514A21, 0x0D17FF39, 0xDADD80EE, 0xD2A7B5BA, 0x8126C8C4, 0x941E33C3, 0x1D57C1DE, 0xB9E156D0,
+   0xEA8105AD, 0x220D500D, 0x0202F3AE, 0x6A2AA462, 0x3DC96356, 0x450056AB, 0x452142C3, 0x506AB6AA,
+   0x1B20D599, 0xE0CB1029, 0x10A5FBA0, 0x7B1ED83D, 0x04007713, 0x7D5FB32B, 0x79C82639, 0x93BAB590,
+   0x49B97D9D, 0x977FA5A6, 0x3551254A, 0xA3592333, 0xA9F7A3EB, 0x8F277388, 0xE3026E2C, 0x36ABA935,
+   0xC05131CD, 0xF197735B, 0x22BEB567, 0x05650768, 0xF7F55B1F, 0xDBF2B189, 0x132C2614, 0xAA144C82,
+   0xB3822251, 0xF41CBE14, 0xFFD0AFBE, 0xB1CE72B2, 0x844743FA, 0x01A14D18, 0x923739B8, 0xC1D89FE3,
+   0x0B79847D, 0xF0F679F1, 0x6BB19BE6, 0x3719A8B6, 0xDC7F43D5, 0x2DDB6C3D, 0xDA0982E2, 0x2800043A,
+   0x908D9EDA, 0xFE5B0083, 0xB8513AE9, 0xA87058DB, 0x84A4DC3B, 0xB6C07965, 0x67E82909, 0x0F991746,
+   0x5F3F5B80, 0x12416A5C, 0xDA522422, 0x58E903DB, 0x4291867E, 0x18CC80F1, 0x7A152C2B, 0xB2035CF8,
+   0x95C80EDE, 0x71125691, 0xAF97C5B0, 0xBFE02568, 0x8A14E493, 0x603E1DC5, 0x749680DE, 0xF12F359C,
+   0x6AA2B49D, 0x1CAAB0BA, 0x6F7FC502, 0x6A75A768, 0x57EA120F, 0x6A5EA5A8, 0xDB6BDF96, 0x998CD5F9,
+   0x467184A9, 0xD2D7BA4C, 0x25C03723, 0xBE178E54, 0xBC389EF3, 0x6BFC1707, 0x7B7D9FB3, 0x3256A8A0,
+   0xFEA77B0C, 0x40429D1B, 0x595E9A31, 0x4651A4DC, 0xE712693A, 0x8900AAB1, 0x84BF612D, 0x90EA7767,
+   0x0D02F2B6, 0xBDD10425, 0xFB4D594F, 0xF5583BCC, 0x5BA7B6A1, 0x75754462, 0x101E86F4, 0xD1A321D3,
+   0x5AC0B3DB, 0x7A2F10B2, 0xF0B98928, 0xE6DEFFA0, 0xE6B0B01A, 0xB4B2939B, 0x0A3F2CA8, 0xA03E1D52,
+   0x2CBEAD24, 0xFC779531, 0xD30FA3F9, 0xE8362908, 0xF23B00BB, 0x6F29D6F4, 0xEBB82E0A, 0xEA1AD22F,
+   0xE62DA069, 0x6890B26C, 0x7C586265, 0xA5702319, 0x865672AB, 0xE64E19BF, 0xA07D9893, 0xA66503F5,
+   0x21FE4743, 0xE4DEB7C0, 0x7D7100BE, 0x3BAE847D, 0xE17B1D29, 0x1769FCA7, 0x320AFC60, 0xADBA60EC,
+   0x89806E19, 0x74814E1C, 0xF9EC85DE, 0x9135FC8D, 0x09AFD25B, 0x0EE660A6, 0x6740A284, 0x943DE3B7,
+   0x622227D9, 0xDBA0327F, 0xD4C486E8, 0xA524C6D6, 0x7134581A, 0x217FB779, 0xE4254A7E, 0xAFA3B65F,
+   0xC4E48158, 0xA3C9D614, 0xAE8FC508, 0xB26B4A98, 0x38B68E18, 0x44EF8BE0, 0xDB271FCD, 0xBE9CF596,
+   0x8E6F95AD, 0x737B653E, 0x9B9E4D0A, 0x73DBE6FF, 0xA4139F59, 0x4B772A8C, 0x66C67E8A, 0xA1F335E5,
+   0x2D00715B, 0x0ABFA3EE, 0xC8297B47, 0xF3F65DC1, 0x00669E85, 0x4199B659, 0x23C09567, 0x7588DF7F,
+   0x868D3227, 0xABDF62FA, 0x8099A8FC, 0xA0844D34, 0x3BABBC72, 0x3361B9C0, 0x6D5BF03B, 0xBB0357A4,
+   0xF77CF152, 0xC0B161FB, 0x8CE30043, 0x243C4FED, 0x050E20DF, 0xB1B4A2D0, 0xC34999AE, 0x5A61A286,
+   0x70214EB7, 0x8C7BAF68, 0xF2C261FE, 0x975BCA7D, 0x1ED91AE8, 0x03C6DF31, 0xA1380D38, 0xE8CFAAAD,
+   0x016F613C, 0xA6BCC84D, 0xC2EC4E56, 0xAE5CE038, 0xF8BE76B4, 0xAD80F035, 0x84642DD4, 0x00456C5C,
+   0xDE3648C8, 0x0EF7079F, 0x68D0A170, 0x7BF0B3AB, 0x56C684E3, 0xA85C96B8, 0x91D65C88, 0xFD39B0F2,
+   0x966D28DD, 0xC79E3178, 0x89F8A2C1, 0x67BA8686, 0x4ACF8D42, 0xAF1F9C6D, 0xE0847F7D, 0x2D2B4273,
+   0x69130CEC, 0x1D9E1A90, 0x9383E7B5, 0x95CB10FD, 0x44CC71AE, 0x73438A26, 0x1EE4EA49, 0x37EAEB10,
+   0x620C767B, 0x2A675B54, 0x5AE6598E, 0xF1235F08, 0x48A35E9B, 0x3CF6A1CD, 0xD8A1B5F8, 0xF11A113E,
+   0x1742A887, 0xA401985D, 0xB6A73D9B, 0x3F83BD07, 0x82736067, 0x3C7307A0, 0x1F12FBB6, 0x64A1A66D,
+   0xD84A37DE, 0x1C12B5CB, 0xC7B1EA1A, 0x56D66DB4, 0x2CE31E9A, 0x852BE420, 0xE40FAF48, 0x17BE9C2D,
+   0x38CC8797, 0x735B3CCB, 0x34B1093E, 0x1F8D9D80, 0xE75B81C0, 0xD8CC6E86, 0x3FDBE697, 0x6914BF94,
+   0x0CCF3981, 0x422618C9, 0x8DAB3936, 0x7F5F9610, 0x8E0A6A28, 0xCA4AB750, 0xD5BAB133, 0x8266E2FE,
+   0xAB5500F6, 0xFAA7545B, 0x5D994D86, 0xA91EDAEB, 0x67FB462D, 0x0A5B194B, 0x287178CE, 0x089CFD68,
+   0x00B16F35, 0x54B44D33, 0x002D5707, 0x59988EF3, 0xD0494F94, 0x256FE1EB, 0x7F710DE4, 0xAEF84169,
+   0x8BD49604, 0xCA38FB1F, 0xBFA0B15C, 0xAEC9DAAE, 0x642CF6DD, 0x1551365E, 0x160E8FFF, 0x75B8B0FA,
+   0x01FEEA35, 0xB2466027, 0x317C61F1, 0xEA17F580, 0x786AACEB, 0x8D71EABA, 0x1CC47DAB, 0x7DE7454A,
+   0xFF1B1266, 0x10B69D62, 0xB9AB079C, 0xE22CC59B, 0x42B2D441, 0x9A57E43F, 0xE8C85F85, 0x22340FEC,
+   0xEDAB9CB9, 0x6033D113, 0xE69D45EE, 0x1DF87BA3, 0xE4D65A03, 0x93436236, 0x3F98A508, 0x5893F6F9,
+   0xAAD54FAB, 0xB3832E15, 0x6BC7365E, 0x3277FF0D, 0x200C4FB8, 0xE8301118, 0xD4E9384D, 0x26E471BC,
+   0x68C28F39, 0x1C1DD91A, 0xF35669CA, 0xFA494334, 0x51ABB743, 0x77B40ABD, 0xE7873A25, 0xEE7400BA,
+   0xED2309D9, 0xF15D9BF5, 0x3DA8785A, 0x8A90D13F, 0x1BE8B67D, 0x7E4FB96C, 0xCAE9ED81, 0x196C1BA4,
+   0xC52427D8, 0x3276C5A4, 0xF5A34B64, 0x66958243, 0xF36E0D92, 0x04166798, 0xC6E9E63F, 0x43E33927,
+   0xF0CA8D2B, 0x899AED76, 0x0AF50DD8, 0x43B89CDE, 0x5951E13B, 0x805EA21E, 0x28413043, 0xE210DAA4,
+   0x98A174FC, 0xE17F627B, 0x4DFA285E, 0x5EBCE1FF, 0x54C5F925, 0xC95FE23D, 0x3188BA78, 0x5EA59A09,
+   0x2D2D8163, 0x6615BB54, 0x5DB03D95, 0x37BE4A1E, 0x4FC47762, 0xC51B5692, 0xD142931D, 0xB994CA42,
+   0x0758035B, 0xCE46A165, 0xE070A0C9, 0xB33DF1AD, 0x686934C9, 0xBF01FB38, 0xF0F16ED0, 0x1CBA6257,
+   0xEE93409C, 0xE538A9B6, 0x4A6B38DA, 0xD82429A1, 0xA5C215B1, 0x1488770D, 0x891D7658, 0x4ADE1F8E,
+   0x51A03105, 0xBF93CDA8, 0x7BE433ED, 0xB14F4A60, 0xFA1C97A1, 0x0AA4C4C3, 0xBCED726E, 0xFE1A6375,
+   0x0409C304, 0x4DB68287, 0xEBF37AF4, 0x08FB9622, 0xF6ABDFF4, 0x677003EC, 0x3FB7CC37, 0xE6B2E872,
+   0x27ADE63F, 0xFE702B4B, 0xA105673A, 0x5DF11A33, 0xA362B9CE, 0x0D33CB80, 0x855BB209, 0xA7BB42F5,
+   0xC95FE575, 0xFDCC6096, 0x2351DEC6, 0xFF0E08D7, 0xBB6A5B28, 0xA3323FF5, 0x89F7A2AB, 0x2CAA2DAE,
+   0x51FF89BB, 0x252566B6, 0xDB973DDC, 0x453C333E, 0xD83F2CC2, 0xFBCD5A09, 0x3121DBD5, 0x187818EC,
+   0x3B46B949, 0xAEA1B45F, 0x55F753E0, 0x42314623, 0xB09991FA, 0xD59AB00B, 0x0AE0C8D7, 0xEE05650D,
+   0x2DA7EB49, 0x2096D676, 0xFB775E41, 0x6E04768E, 0xAF24F76C, 0xC3349C3D, 0xDE0C90F6, 0xE6DB6CCA,
+   0xA416FD87, 0x98AA01F5, 0x781EC427, 0x84C3270B, 0x021034B2, 0x37680F04, 0x654BF735, 0xEB90FE3C,
+   0xE4976DD8, 0xEAF7623C, 0xE29BD0B4, 0x92528B1A, 0x645CEC2A, 0x78158ECD, 0xB11325E9, 0x3265EAD8,
+   0xC04780B7, 0x1CA27AF8, 0x2465867D, 0x14EF0845, 0x2FEEFE38, 0xB45C1887, 0x5D8730E9, 0x7C4D96BC,
+   0xB3571976, 0x8E35BF16, 0x346864E7, 0xE2EB0C63, 0x7E9B6C7F, 0x2B7B57E0, 0x70B35A98, 0x3157CF6F,
+   0x5AC49EA5, 0xFEC24C14, 0x6B1A32AE, 0xC20C5690, 0x345FA335, 0xEAEF7B4E, 0x4077475F, 0xB4C9655D,
+   0x6C38B3DA, 0x3C3D8C9B, 0x754433E3, 0x80818302, 0xE29E542A, 0xFE68AB07, 0xD12CBB2C, 0x81A25A61,
+   0x8F685647, 0x559948A7, 0x83A56574, 0xE14EBCF6, 0x7A77DB0F, 0x1A606632, 0x0892CE93, 0xF49D838F,
+   0xFCF866B9, 0xF3F4E3FE, 0xE18B0AD5, 0x152A0807, 0x1B9B2E7B, 0x2EC4C706, 0xDADD006F, 0x41D7E92B,
+   0x1D4B6EF7, 0xFF0A8A79, 0xB2AA2F47, 0x02344DFF, 0x357A0681, 0x1726D704, 0xC1BC85F4, 0x4CE6BB77,
+   0x8916A00D, 0x651EBB86, 0x001E908D, 0xBA4D2DA9, 0x1684FCB0, 0x5F2B68E6, 0x10AC6EDF, 0xC3FF8D75,
+   0xF5C49A61, 0x6997E3EA, 0xB1A4DC68, 0x8F4FF372, 0xC95C2DB2, 0xBEA7CE04, 0x9D10F761, 0x2ACCB4F4,
+   0xAFCC2BEF, 0xB9E437F4, 0x3ADA2B53, 0x4F1FB2D6, 0xBB580C9A, 0xE6C0E12D, 0x33C7546D, 0x25183734,
+   0xBFD92FB9, 0xAB12D90F, 0xA185AE46, 0x2CB9B9B3, 0x9CE6F49F, 0x2A0C7A7E, 0xB48F21F2, 0x531F307F
+#endif
+};
+
+const EcCombTable secp256r1CombTable =
+{
+   //Number of teeth
+   EC_COMB_WIDTH,
+   //Distance between two consecutive teeth
+#if (EC_COMB_WIDTH == 4)
+   64,
+#elif (EC_COMB_WIDTH == 5)
+   52,
+#else
+   43,
+#endif
+   //Length of a coordinate
+   8,
+   //Precomputed points
+   secp256r1CombPoints
+};
+
+#endif
+#if (SECP384R1_SUPPORT == ENABLED)
+
+/**
+ * @brief Fixed-base comb table (secp384r1 curve)
+ **/
+
+static const uint32_t secp384r1CombPoints[] =
+{
+#if (EC_COMB_WIDTH == 4)
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D, 0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22,
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE, 0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A,
+   0xD8EE21C9, 0x39C1B328, 0x558717DB, 0x2C3E0C91, 0x3F8686A9, 0x4B58808B, 0x18141B1A, 0x43603909,
+   0x37CA7ABC, 0xD6E98B0D, 0x060CBD1B, 0xF532389A,
+   0x23D86ECD, 0x7A7E1839, 0x085A4E9A, 0x31EA31B1, 0xBE643603, 0xBC40CE5A, 0xA2124163, 0xBD22CFB2,
+   0xDE3A82BA, 0x6F04CAA2, 0xC3B38E69, 0xB9D2852C,
+   0xEB09A0E5, 0x264E5246, 0x32CDF03C, 0xF8F4BE11, 0x5FAEFA4F, 0xDA9D5483, 0x17A31B22, 0xBBBC4FD0,
+   0x86F06145, 0xC3DECD0C, 0x0A5F2CAB, 0x528EF167,
+   0xC14F0DD6, 0x8A1E9858, 0x09CB7524, 0x550538A8, 0xC87FED22, 0xBD60CAB4, 0x631D058D, 0xF8B76FDD,
+   0x1A1DCF14, 0x5803EAA1, 0x7BCCF56C, 0x7B9B1FBE,
+   0xAA03BD53, 0xA628B09A, 0xA4F52D78, 0xBA065458, 0x4D10DDEA, 0xDB298789, 0x8A3E297D, 0xB42A31AF,
+   0x06421279, 0x40F7F9E7, 0x800119C4, 0xC19E0B4C,
+   0xE6C88C41, 0x822D0FC5, 0xE639D858, 0xAF68AA6D, 0x35F6EBF2, 0xC1C7CAD1, 0xE3567AF9, 0x577A30EA,
+   0x1F5B77F6, 0xE5A0191D, 0x0356B301, 0x16F3FDBF,
+   0xAA133909, 0x30991560, 0xC6CB0017, 0x9097DBB1, 0xB860FAE6, 0xD37DE424, 0x70B375DD, 0x9BB183B2,
+   0xCD6CE3A3, 0x567A6233, 0x0FDC3088, 0xAAB8BB9F,
+   0x600AD5A6, 0x16C5B981, 0xD62FAA44, 0xEBDF73F2, 0xC9747BF3, 0x6D955BB3, 0x15EB04AC, 0xF6005FC8,
+   0x282050B5, 0xF0AF01D1, 0x314F6D28, 0x48942F81,
+   0x7716605E, 0x20221121, 0x9EF281C8, 0x2347D2C8, 0x567D6342, 0x54BA4599, 0x77C0F03F, 0xCE0FBA30,
+   0xCB367444, 0x7022F802, 0xA9A6A052, 0x7334A936,
+   0xD658A01A, 0xB5461F68, 0xC2BD0EFA, 0x0A64D519, 0x697A9280, 0x9E2EEE8F, 0x7D0E017A, 0x8E5D9B89,
+   0x7CBD4CCD, 0x1F7C5C36, 0xF632C926, 0x7FFCEFF7,
+   0x0E758344, 0x300AE2E6, 0x371A2CA5, 0x451C707A, 0x5052DD32, 0x25651D10, 0x4862B954, 0xBF88DE7F,
+   0x0381EF13, 0xFAFCE26E, 0x960E090E, 0xDC916C17,
+   0x026B0889, 0xED17CC44, 0x9B42441B, 0x95C01FF1, 0xCC160697, 0x40896478, 0x0BA04A35, 0x52D154B8,
+   0x701C2952, 0xB3D92EA4, 0xD69ECA0A, 0x266E8A40,
+   0x4905CA71, 0xE4BFC2C0, 0xD156F761, 0xF33A450A, 0xD08848C2, 0x3D8B29DB, 0xA2309686, 0x097DA395,
+   0x5F4972D7, 0x21190503, 0x17CBAA12, 0xB2D10558,
+   0x753EE324, 0xDDCEBB55, 0x6924666F, 0xE87AB07C, 0x4ECF1A68, 0x9B475D74, 0x2E6236C0, 0xF82BE8F5,
+   0x3CFD056B, 0x237C0DBA, 0xC3C6CBD2, 0x354CD872,
+   0x708D4CEE, 0x8D104D24, 0x819CF043, 0x197D6958, 0xF0712210, 0x47FC87FA, 0x5C201558, 0x103DF785,
+   0x611EF638, 0x30B0A9E8, 0xFDFEBFEC, 0x00B19AC8,
+   0xD201E03E, 0xD40E8D6F, 0x2228FF5F, 0xBB7C969C, 0x636164C5, 0x68810282, 0xE754220D, 0xCDBB3CD2,
+   0xE9F6EDC4, 0x1418FE25, 0x9EE36031, 0xA72F9105,
+   0xB769737A, 0x64D2C273, 0x97D53FFD, 0x2CC02451, 0xE86C46BD, 0xC3B6AC4B, 0x685E926D, 0x17E9411F,
+   0x75203A36, 0x136DF36B, 0x8BF0B27E, 0x3F9561E0,
+   0x27E990A7, 0xDD6FF8D5, 0xF9867A60, 0xC34BE586, 0x8554E014, 0xEA088747, 0x6F52E4CB, 0xCFCED664,
+   0x412AB641, 0x4B1A5A20, 0x39629587, 0x0B06F006,
+   0x85651F82, 0x044C0DD2, 0x785D3EF7, 0x325C51E7, 0x88E95532, 0xB83A1861, 0x522C2931, 0x539F94AD,
+   0x8980F137, 0x15274E5B, 0xDF0F66D7, 0x9FD7B010,
+   0x4064E4C0, 0xE4A7B94A, 0x25D7D211, 0xD44EBA45, 0xBE8A04E3, 0x0A806B54, 0x149033DE, 0x929226BD,
+   0xC9739246, 0x795F6FA3, 0xB9260225, 0x321AA9A3,
+   0x8B707B8E, 0x49BCC2F5, 0x1D928983, 0x2901B519, 0x7D49C780, 0x2E4C2956, 0x4C6A9964, 0xEBD1CFF8,
+   0x16EE3E13, 0x2CAEBBD3, 0xA87A68F7, 0x36A543EE,
+   0xB569946D, 0x75B41C29, 0x3EF2267E, 0x1510E7D4, 0xD4B3394D, 0x91235072, 0x8FBD85D1, 0x58EAFF04,
+   0x78A67847, 0xD349AB03, 0xA50EE41C, 0xF277BACD,
+   0x5F863BBD, 0x10B05658, 0xB483283D, 0xE92CDC5A, 0xDC7C421D, 0xEBB31209, 0x6D01A5A8, 0x3AFCBD79,
+   0xA08B6A51, 0xE2B067CA, 0xE8CB7AEB, 0x026E0DC2,
+   0x02DDE18A, 0xD8C35029, 0xD8C6CF36, 0x64C15FAC, 0x10781E45, 0x17EA2701, 0x1F3443D8, 0xD68D1FFC,
+   0x8C7461A5, 0x4BE25637, 0xD8EF24E1, 0xAE8866BA,
+   0xD265A91C, 0xAC3A78D0, 0x6C8F83D3, 0x1A29F8EF, 0x8FD8D817, 0xEF98FDDE, 0xC42BF748, 0xDF459EA1,
+   0x81A73DC7, 0x14DAFC39, 0xC52AFA2D, 0xB03DFA54,
+   0x6C0D2CE7, 0xCC406F6E, 0x41FD72CA, 0xCD120B2B, 0x78F602DD, 0xEF5D9006, 0x8ACCF229, 0xF5F8A2D1,
+   0xCE6D908A, 0xAAFD1FCF, 0x0E6D85F2, 0x2CE2885A,
+   0xC62666DE, 0x89109A0E, 0x7FFCD01E, 0xC8C12E75, 0xC48B5AB0, 0xA8206169, 0xF983AC6C, 0x4BC2FDCF,
+   0x55977D23, 0x59CFCA71, 0x5766C96A, 0x1264CB33,
+   0x2E014B4B, 0x6B691381, 0xE4483EC5, 0x31D28707, 0xFFB19758, 0xCBF7190C, 0x65A5F248, 0xB66717A0,
+   0xC53B4F69, 0xD94AD8FA, 0xA1A1A376, 0x119EBEEE
+#elif (EC_COMB_WIDTH == 5)
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D, 0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22,
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE, 0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A,
+   0x574A2D7A, 0x214A5541, 0x0BAFF67E, 0x8BB26B1F, 0x685CB49E, 0xE8E8A314, 0x05F1DBE9, 0x6AD56435,
+   0x415B4393, 0xB2128765, 0xE52E83A1, 0xFDFF5D78,
+   0x978E2B11, 0xE715E976, 0xD4D391B8, 0xDCC72E10, 0xDD2D7EC4, 0xEF01A9D8, 0x5963C951, 0x00377F99,
+   0xF10B944A, 0x13F5D41F, 0x7857AA4C, 0x4DB0BC42,
+   0x8E8CF6BD, 0x4DF624DB, 0x8547E6B6, 0x8244132B, 0xEAAC9420, 0xA9D5E399, 0x21AD8066, 0x0A9B91BD,
+   0x3EEE915B, 0x492ECEBD, 0x0FDD804E, 0x5E54D953,
+   0xCC5A43B2, 0x44288C00, 0x42727FD7, 0xF66D7125, 0x89A66C33, 0x6F98B352, 0x95821B09, 0x5009A4B4,
+   0x0E8131D0, 0xB5E534AC, 0x4BA24BC0, 0x4A3D7763,
+   0xE0BDE8C2, 0xD490B021, 0xCA52B096, 0x6CC28A6C, 0xC30BD659, 0xCF1DF4FD, 0x50FEAF12, 0x0E63F460,
+   0x7F52C6E5, 0xCD958F85, 0x34CB8FA1, 0x2913D4EB,
+   0xB083DCB0, 0xCBF987E9, 0xB1A874D8, 0xB47F863A, 0xB3BB7DA7, 0x2D48722E, 0x7603FD5F, 0x27855D53,
+   0x7765A132, 0xA5CCE5A0, 0x5A14FFB1, 0x047B885F,
+   0x931694D6, 0x3311EC54, 0xD26C55B2, 0x66004EC3, 0x1F2CCD66, 0xD50A0AC4, 0x4B047385, 0x274E6260,
+   0xB7FD6664, 0xD96204E4, 0x6AA71294, 0xD23B746B,
+   0x46B64ADD, 0x9A7231A7, 0xBE780847, 0x47709B8E, 0xAA3AEC73, 0xC5BE101D, 0xB89D3090, 0x2786BD19,
+   0x09A71BA8, 0x5F348F1D, 0x0169076A, 0xE2F2CDA7,
+   0x12D256E1, 0x0DB699E4, 0xA526F3F5, 0xCC589514, 0xB6F8C073, 0xE7EA29A0, 0xADBA7324, 0x50359755,
+   0xE672C579, 0x0FD7FC38, 0xF5D93F24, 0xE9FB6A4D,
+   0x910A0FB5, 0x9103B778, 0x1DE052BE, 0x6E7107BD, 0xDBDBAE3D, 0x6C24C094, 0x66F0CD5A, 0x6F5424A9,
+   0xD171104B, 0xEAB70FFA, 0xE51210F9, 0x52AD7C38,
+   0x1A465EE0, 0x70CB8A4C, 0xF8EE3F37, 0xF04BA246, 0xC81EE126, 0xD6BEAEB6, 0xDC50393C, 0x5FC113E8,
+   0xD094B6A7, 0xD0472DD3, 0xDA1C1669, 0xB769B0BE,
+   0x4157BCA1, 0x772481FA, 0x96BEEEC6, 0xDE0AED5E, 0x284569C0, 0xB9C04F16, 0x8B36D601, 0xA2415911,
+   0xD415E1CA, 0x81D51B7F, 0xEBAAD0A2, 0x4FE542B9,
+   0xA93C10A7, 0xCB610182, 0x036AFB3B, 0xBD5059C9, 0xFAAC375A, 0xCB538303, 0xAC1B02F4, 0xC35A94E6,
+   0x8AE7D58B, 0x8B5D4209, 0x004241BD, 0xA8EB2114,
+   0x262FAC2C, 0xAA3C554A, 0x31306B48, 0xC6D2BCDF, 0xFAB6BE4D, 0x0ADAE8A9, 0x0EA77D12, 0x89B18AED,
+   0xA2675D24, 0x2C4382FF, 0x105529BA, 0xABB60CE6,
+   0xEDF8C996, 0x7FFAF718, 0xC58B999A, 0x4EE49986, 0xBA5328E9, 0x5FDC0C0F, 0x4DE7B0B3, 0x22BB9F3B,
+   0x79A8B5AB, 0x59BDB661, 0x5B46960B, 0xA41CEB96,
+   0x673F565B, 0xF95FD896, 0x5546575D, 0x1682F977, 0x725E981D, 0x985159D4, 0x82EDFF44, 0x2CFE484D,
+   0xE5EFAAD0, 0x785CB625, 0x10E28346, 0xC6E94CF8,
+   0xE79FC953, 0xCFA78FCC, 0x62A76A5B, 0xD8503095, 0x4AB1FB6E, 0xDF363E09, 0xA506B01A, 0x907E97BA,
+   0xA15AF7C1, 0x9BEFB795, 0xEAC69987, 0xC7FA7869,
+   0x1C404FE9, 0xDE4D11B2, 0x2E6D0FB8, 0xB0917D3B, 0xAEE80FB9, 0xB37CC365, 0xF87F9262, 0x306C8470,
+   0x43FC91F8, 0x87519B7F, 0x0A61CDF5, 0x9D434DBE,
+   0xB33139E7, 0x49BF609F, 0xAC820A90, 0x60FD2CEB, 0x164A20F6, 0xA1344AD0, 0xCED42AB2, 0xC8A16564,
+   0x87F81DB5, 0xC778EF62, 0xDA05DE0C, 0x81C02C3E,
+   0xC17D28B9, 0x924D0E64, 0x90E31340, 0x8BF310B1, 0xA9CE292C, 0x9DDAD413, 0xC42F9A8E, 0x46A2A12D,
+   0x69CB4B1D, 0x0C345297, 0x4C3EF2D3, 0x1CE0028A,
+   0x4484249F, 0x7B2EA237, 0xDE8D2145, 0xCDC53530, 0x225A3DD1, 0x8B6136DD, 0x53740EC9, 0xB18E9E73,
+   0x5F27C64A, 0x644E97B7, 0xA9CEA0C5, 0xA7208E9D,
+   0xA48B98EC, 0x6BB544BD, 0x57C5F037, 0x1DEBA7F3, 0x1F068FB5, 0xBCC87131, 0x11CF7C4B, 0xAE719373,
+   0x2CB2EC36, 0x74A95C5B, 0x335D77B6, 0x65BE9E50,
+   0xB2319168, 0xF9A6E7F2, 0x51D144A0, 0xEDD5F953, 0xAD2AD161, 0x7171C038, 0xF7215966, 0x5C01A2BE,
+   0xB978FA06, 0xF696C756, 0x6579D248, 0x714398BB,
+   0xAB1FB325, 0x4ADE5706, 0xFF0C1846, 0x818B42B4, 0xD6EE937E, 0x7F0C9F34, 0x90CD7784, 0x54AC28C5,
+   0xE17F0476, 0x8701F645, 0xA4B5D7B8, 0x6545AA51,
+   0x775226D6, 0x880F880F, 0x9CB06473, 0xDF312F51, 0x4644DBC4, 0xAAE46B81, 0x7654C263, 0x40371DC1,
+   0xBEB9F7AF, 0xC747F85F, 0xCC281C52, 0xF4B35B77,
+   0x8C15E275, 0x28EC4AC0, 0xFBF5433B, 0x51537CA3, 0xFD212D3F, 0x28CF7BC3, 0xE1B6365E, 0xD2D86E75,
+   0x120328CE, 0x047BBCF0, 0xF07414D3, 0x33E139EF,
+   0xCB38E86D, 0xE2A2F4FC, 0x5382ED59, 0xCB5357BA, 0x1B5076C2, 0x6BE08D5D, 0x4D83E11C, 0xC62DF637,
+   0x60969A97, 0xD6958C1E, 0x54DBFC48, 0xA49B602C,
+   0x51914BCA, 0xFB97D2EE, 0xAA211719, 0xB4BC64C9, 0x00644D20, 0x0ADCD952, 0xA75F0046, 0xB8E8CA59,
+   0x17A818F2, 0x9F5E1FE2, 0xB5CF54D1, 0x7E1D2F2E,
+   0x31E76220, 0x3992D2A1, 0xFF7003C6, 0x7AD2A60B, 0x8F1546BE, 0xDB6A4D39, 0xE8A1A2A3, 0xB13228B1,
+   0x993D3A02, 0x1470159C, 0x9E9BF4D9, 0x5B4E8B1D,
+   0x0CD001D1, 0x6FCB85E9, 0x3DF1DFE2, 0xE0781A9D, 0xC8A2265B, 0xF650285A, 0x37A9B579, 0x8727088A,
+   0x22C74609, 0xBB844DF2, 0xD5476D33, 0xC3742094,
+   0x1E060165, 0x79FE2465, 0xB6B90F17, 0x5130BDE7, 0x853CB459, 0xCE254CFD, 0xBA440754, 0xA8782B8E,
+   0xDAF8AA6C, 0x7D81F68F, 0x44B8BF68, 0xAA0E19AA,
+   0x2664A487, 0x6E3EE96F, 0x4E9FEA80, 0x8F1B7D25, 0x131C050D, 0x7A282A2A, 0xCA81498E, 0xD986B357,
+   0x154EC895, 0xC4750753, 0xCB3C35A3, 0x65DB0B8A,
+   0xCE9499EB, 0x4AC90B15, 0x91AEE266, 0xBF5777FA, 0x4615CE5F, 0xD87272F9, 0xFF3C56CE, 0xB92110A3,
+   0xCCA3B289, 0xB327638E, 0x3D0A9F44, 0x396B35A9,
+   0x8AD619EF, 0x0DAD5514, 0x3F9AA00A, 0x44242D55, 0xB843CDE9, 0xD7E221ED, 0x071DDE46, 0xA3C20977,
+   0xA5B4CD7A, 0x16DD93B9, 0x021460CA, 0xCCD5DF68,
+   0x6A570F04, 0x1D21128B, 0x394FE427, 0xE917B31C, 0x6BA2D13C, 0xC0FE28DE, 0x7F08EBA2, 0x2D31795F,
+   0x88492CB7, 0xDABB8957, 0xC82A64C1, 0x5B6478B4,
+   0xCD430E4C, 0x5D14F518, 0x217D14F8, 0x552992D1, 0x95033367, 0xB38D3C11, 0xAE07E0E5, 0xACBB2DDC,
+   0x7B50F818, 0x7093124C, 0x7E9CC15B, 0x0AE3337F,
+   0x428E5500, 0x505F49BA, 0x20E83E0D, 0x4FEB246B, 0x7C632779, 0x8D18AB7D, 0xD299BC0D, 0xFB435379,
+   0x89E66C63, 0xDEA8F23F, 0xD93C74A3, 0xDD790987,
+   0x4B79ADF6, 0xA9AC8F10, 0x677F9849, 0xFF4CAA4A, 0x80C84B38, 0x4E1BB75C, 0x105393D3, 0x52D2575D,
+   0x4569D2D3, 0x4F465F5F, 0x41E36869, 0xABAD1376,
+   0xEB3F72ED, 0xB8566746, 0x08E114AE, 0x53316ED1, 0x91AEA8C6, 0x45E5B481, 0x2857A9D5, 0x73C30BF5,
+   0xFD1F7C82, 0x26DB96AF, 0xDF1822B5, 0x8C9010D0,
+   0x20428D3D, 0x246624AB, 0x6A02C7CD, 0xA3A48C9F, 0x34CD1BDD, 0x1298B738, 0x1B71B3BD, 0x664833BC,
+   0x070A6E08, 0xD9365CD7, 0xD610B66B, 0xA44AD979,
+   0xA6690FC0, 0xCC174EB1, 0xC9196D36, 0x5883B4BE, 0x4FF222D2, 0x6507BBC3, 0x8506370B, 0xF90DAD22,
+   0x235C94E5, 0xD5B17CEC, 0x4F1D0704, 0x15C31CD6,
+   0x83692E96, 0xA45E13E0, 0x23632198, 0x30CA9241, 0x68C5D526, 0xFB14B0B9, 0x53FF8F7F, 0x1CB6AADE,
+   0x9277F031, 0x64B1D3AA, 0xB57A14DD, 0x92504AAD,
+   0x6F824A23, 0xA651A249, 0xBC1B0886, 0xABA60A2B, 0x67E331A8, 0xC632EF51, 0xD3432743, 0x386CAB94,
+   0x24DBDACC, 0x644657CD, 0xEA9D8EEB, 0x79BAEFE3,
+   0x7C0022A9, 0xCE100B59, 0xB5552550, 0xC72C67D5, 0xC625D47F, 0xCC7C468D, 0x43B94872, 0x54376AE2,
+   0xFD91B733, 0x86116D31, 0xC07AB981, 0xC33E942E,
+   0xC1A90C5B, 0x7E0181B9, 0xEF64936E, 0x4B2E6511, 0xAA71BE85, 0x9187E8D4, 0xB683D1DB, 0x9F03A529,
+   0xE63B581E, 0xE9825AAC, 0x4B8A03BA, 0x05E6B0A8,
+   0xF3938636, 0x61907C78, 0x7CCADF9D, 0x2DDA27D3, 0x9787C6AE, 0x1E7B1E07, 0xA645CA8F, 0x6E6A6097,
+   0x3B950770, 0xA152690C, 0x80453061, 0xCC813D19,
+   0xDC9BB565, 0x5026D3E0, 0xA41DAC8D, 0x3A345564, 0xCF05440B, 0x092B8073, 0xE7E95F9A, 0xDE1F971D,
+   0xBCB04838, 0x177D47C6, 0x37393D29, 0xB2A0C449,
+   0xE77340CD, 0x00224C3D, 0x6A4E526E, 0x31E37B98, 0xBC55A51B, 0xEE98B785, 0x091BC664, 0x4ED22126,
+   0x98C7090F, 0x59C178BA, 0xA14CE4D5, 0x597FC7F4,
+   0xA623862F, 0x0DE0AED2, 0x49106B56, 0x9195ACAF, 0x939A89D1, 0x8703E4AF, 0x2AF3BFB2, 0xDA07A303,
+   0xEB51AB60, 0x72817277, 0xFA0CB48F, 0x5AEEDCB5,
+   0x6A386DA2, 0x43E24139, 0xA6284E47, 0x09157D8F, 0xDCB7B7F6, 0x10D3ABFF, 0xC4A4EF51, 0x4FEC85D9,
+   0xE11640B5, 0x6BEFAF87, 0x0AFBA91C, 0xB05FF572,
+   0xFEDF311D, 0x00F305D9, 0x6082A9F9, 0x2322592A, 0xDFC76F75, 0xF1841C28, 0x10AF674E, 0xF0714D17,
+   0xAF895173, 0xCD871803, 0x94F5571C, 0x110AB6A9,
+   0x22D4D124, 0x5AA3B421, 0xA2FE7A5F, 0xCB6EB594, 0xB6B4AC39, 0xBBE918BA, 0x3A31C961, 0x19E5161E,
+   0x3FFFC9CD, 0xC2A7A2CB, 0xC67BBAA3, 0x1A0825B1,
+   0xA02D4BB0, 0x283C9073, 0xE05DA927, 0x1C06EEBC, 0xA7CE557B, 0xEE920D22, 0xF79AEC92, 0xF137A49C,
+   0xF7E0C93D, 0xAC949AA9, 0xD2E5D915, 0x1D7481E4,
+   0x5CBE77D3, 0xAA5A8228, 0x128145FD, 0x02459758, 0x1BDB11F5, 0xF2096E10, 0xA5DC4090, 0x2B4ECB07,
+   0x4C110C19, 0xD335126C, 0x27EFAC4C, 0xD1B5960E,
+   0x77E930E1, 0x3D4100E8, 0xADC4C838, 0x0899BAAD, 0xF6B3097E, 0x5B64899F, 0x2790439D, 0x7C060A89,
+   0x513497C6, 0x40AB25D0, 0x202D8833, 0xDFA74FE2,
+   0x2466F95B, 0x689CCEC5, 0xE0B8E88E, 0xE757107A, 0x56A78F16, 0x38D0D513, 0x5DA9F7C2, 0x47C8301C,
+   0x31956F2B, 0xE8C55CC6, 0x0C8D4931, 0x6DA590D6,
+   0x374E2772, 0xFFEFF253, 0x2AFEDDA2, 0xC0132D35, 0x6C782F3C, 0xC6211452, 0xC98A97E8, 0x7D7F61CD,
+   0x74DB0E01, 0xF0602625, 0x5D0D215D, 0x36C1AC6A,
+   0x59A579DE, 0x88CBE3CF, 0xC2C17408, 0x8DDEEC0B, 0x034D07D8, 0x6D87FCED, 0x656A1F61, 0x9066AFE4,
+   0xFBC82854, 0x758AE55F, 0x0F73DFE9, 0x0BC110FA,
+   0x679A2ABA, 0x96EDF50F, 0x7FA01880, 0x31B92B91, 0x72495766, 0xFDA047EB, 0xCB1299C9, 0xE8C663C5,
+   0x91DBE668, 0x15798146, 0x9DA9121C, 0x25E209C5,
+   0xF69B64DA, 0x9AD033A2, 0xD82ADB97, 0x6366E8F3, 0xE9103189, 0x96052F28, 0x6E6CE744, 0x6C279054,
+   0xFE5D6697, 0xDA53B069, 0xDA09FB6A, 0x553200B9
+#else
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D, 0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22,
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE, 0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A,
+   0xD74D9642, 0x06BA5918, 0xDFA0F56D, 0x92DD9CDE, 0x8CBAE3EF, 0x74C1AC3D, 0x5F6F39BF, 0x2FCE93BF,
+   0xE2CFE67C, 0xFF348797, 0x510CC718, 0x079DC566,
+   0xC16BB523, 0xA0ECD5D0, 0xCC51C42F, 0x29F49D50, 0x892459A9, 0x36275538, 0x8484B5F1, 0x62637770,
+   0x5C806F88, 0x89A8437E, 0x5D9087BC, 0xA64DA09A,
+   0x2C009246, 0x371FDB78, 0xB7EBF317, 0xBCB6F706, 0xCF2CBC3D, 0xE753EDD8, 0xA37B7552, 0x852CC3AB,
+   0x41789DE5, 0xAC8476F6, 0x52E85654, 0xBDA8CBB3,
+   0xA4AEF26D, 0xDA1B89B6, 0x1CCE0F01, 0x4C50F67C, 0xE690EB4C, 0x7AD4C74D, 0x8A2D49D1, 0x94609901,
+   0x9B9B805F, 0xD907B06A, 0x59EEA2C2, 0x23BC95BE,
+   0x0020362E, 0x84A2AE35, 0x19BF5F49, 0xEA2B1DF4, 0x287C9B53, 0x2BB64E18, 0x2B7B03E9, 0x11C2DF65,
+   0x85D5A524, 0x23A42EA4, 0x11CD506E, 0xE10CB36D,
+   0x2ADAEFC2, 0xE5F50BFE, 0x36ADB53E, 0x64666B55, 0xE90ED2A4, 0x7768FB7F, 0x06CC84C0, 0x425D7817,
+   0x31D6AB0B, 0x52EC806A, 0x4697D363, 0xD7E67972,
+   0xAE569DE6, 0x981FFB59, 0x8091ACCF, 0x586EA887, 0x08A70830, 0x67FC3294, 0x849E299F, 0x7E6EE5F4,
+   0x50B92155, 0xC79CF824, 0xC2010434, 0xDE3E77FB,
+   0xE3EE3800, 0xA6EC9DC7, 0x43CF88B6, 0x8E5E92FA, 0xF843CAE9, 0x757E493B, 0x17EBE71C, 0xE1C28645,
+   0x32576992, 0x00D19CE0, 0x4DB810D9, 0xE30DF4B8,
+   0x780E56F3, 0xF6DA53E1, 0xAF4D2766, 0xFD5F2FB0, 0xE383BF0D, 0x52922DE8, 0x58EE4DDC, 0x1C92ABA0,
+   0x238E7643, 0x3B2384C0, 0x0D6AC898, 0x2D350FA2,
+   0xFB35AA8B, 0x2929929E, 0xA6E54797, 0xA8743694, 0xC525C526, 0x67F4174C, 0xE0E2F34D, 0x8CF8B3C9,
+   0x0B8F32EE, 0x80CCBCE7, 0x689DE2FA, 0xF15779E6,
+   0xB29ADC60, 0x16273979, 0x3BE4714F, 0xA30C604D, 0x4019BD55, 0x5A2A19FA, 0x431EF84D, 0xEF8D50A1,
+   0x417C18A3, 0x581B7CFA, 0xC4245900, 0xADD3B7E9,
+   0x633D01BB, 0xB76F4554, 0xA319B27B, 0x34421D86, 0x18870284, 0x711A5292, 0x5DB1186C, 0xFE371B18,
+   0xBA6174F4, 0x3040AF18, 0x523C7DDA, 0x6FB0070F,
+   0xAA03BD53, 0xA628B09A, 0xA4F52D78, 0xBA065458, 0x4D10DDEA, 0xDB298789, 0x8A3E297D, 0xB42A31AF,
+   0x06421279, 0x40F7F9E7, 0x800119C4, 0xC19E0B4C,
+   0xE6C88C41, 0x822D0FC5, 0xE639D858, 0xAF68AA6D, 0x35F6EBF2, 0xC1C7CAD1, 0xE3567AF9, 0x577A30EA,
+   0x1F5B77F6, 0xE5A0191D, 0x0356B301, 0x16F3FDBF,
+   0xAA133909, 0x30991560, 0xC6CB0017, 0x9097DBB1, 0xB860FAE6, 0xD37DE424, 0x70B375DD, 0x9BB183B2,
+   0xCD6CE3A3, 0x567A6233, 0x0FDC3088, 0xAAB8BB9F,
+   0x600AD5A6, 0x16C5B981, 0xD62FAA44, 0xEBDF73F2, 0xC9747BF3, 0x6D955BB3, 0x15EB04AC, 0xF6005FC8,
+   0x282050B5, 0xF0AF01D1, 0x314F6D28, 0x48942F81,
+   0x4AB018D9, 0xF5B4350F, 0x4F890F56, 0x03D42BFA, 0x472ABCBE, 0xA59802AB, 0xAB00B039, 0xC49DC552,
+   0x4905EDEB, 0x5BDBFA1B, 0xAADAF829, 0x8B714479,
+   0x10903577, 0xB69F6121, 0xCAA17043, 0xFFCF3103, 0x12B7D6F0, 0x194BEFCC, 0x44FA539F, 0xC2315CA2,
+   0x27D7AA39, 0x330A336C, 0x5E7E1A8E, 0xD67B4141,
+   0xB6D82F46, 0x50E97C63, 0x14B98CD9, 0xDE6337D9, 0x46B80210, 0x387BCEAD, 0x662D4782, 0x2333E9A7,
+   0x9493F992, 0x4FB348A8, 0x51AC4AE9, 0x1A2F7208,
+   0xF9A0ADDA, 0x9778E181, 0xD8639A3A, 0x171A79BA, 0x7A7B3134, 0x2D7D5D5A, 0x4B129683, 0xB7E00919,
+   0xEE578A55, 0xEC7E6E4E, 0xDC699D11, 0x08D8DAB3,
+   0x09331EE2, 0x50938B9B, 0x01C84DEA, 0xB5EA6C18, 0xD5A6BD1F, 0xBE617A0F, 0x8F79292B, 0x78BB665F,
+   0x58E00408, 0xB942F765, 0x866F2B6E, 0xF8B838B2,
+   0x3780EDA2, 0x2A518D48, 0x5F9FCB09, 0x2A58627F, 0x8EB96EB4, 0x48F510FA, 0x15802F8F, 0x97DDED6D,
+   0xAAABA84B, 0xE75CD28D, 0x7EDE1244, 0xACD28AFA,
+   0x03034968, 0x4A286F33, 0x05A7DB5D, 0xFB4DF38C, 0xA8B1928E, 0x3B640DEC, 0xD0FDFC4E, 0x5D1B884B,
+   0x69519C83, 0xF57371CE, 0x23145AB8, 0x5F63461A,
+   0x44704CBC, 0xEDEFCD18, 0x64DD49C2, 0x924D7E7E, 0x097C32A2, 0x2CD63FD0, 0x654FE06D, 0x3E547A0C,
+   0x4AFBFA16, 0x8C5A79B4, 0x2B1B5D04, 0x749ABCDA,
+   0x4FEE705E, 0x06F6CFF7, 0x4B772C5B, 0x315FC16F, 0x68592FF1, 0x4B2FDF35, 0xE9BCBEBB, 0x0AD35E83,
+   0x690B01A1, 0x1BBCC1E0, 0x0774EA13, 0x69F7B65F,
+   0x68FBC242, 0xEAA68FC8, 0x4C78BCF9, 0x749FA469, 0xCBBDFC33, 0xCF3AF279, 0x020525CC, 0x50F52CDE,
+   0x64CBEDC0, 0xCEBE1959, 0x3DF78387, 0x1D8D9C44,
+   0xF756AC51, 0x0B68515F, 0xBC1DE0C6, 0x03AC4E13, 0xE6C5F5B7, 0xCBBA88D2, 0x23280EFA, 0xEEFA6758,
+   0xD84B809E, 0xE415DFC4, 0xE6580EF1, 0x03C2592C,
+   0x9927269B, 0x0B222B16, 0xC38FF3BA, 0x38FC9B2A, 0x3D832EFC, 0x1B3C9EFE, 0x2DCD5708, 0xB53849C1,
+   0x338B4295, 0x01EA1F89, 0xD7131DAA, 0xEB3EBB50,
+   0x1A9BB0AA, 0x31EFC132, 0xBB0F6CA7, 0xDA74BDF2, 0xCD3D0497, 0x1AF000F8, 0x2AAA3451, 0x39ACB8F2,
+   0xEDFB898D, 0x23EAF4CD, 0xCAD3D109, 0xE7B3F42D,
+   0x5E695394, 0x98CA61B5, 0x0E70A633, 0x6F591102, 0x216B71D5, 0x80A93EC7, 0xC463E3B8, 0xBBB25C8F,
+   0x8615E7A5, 0xB18E3FBA, 0xFC212920, 0x5A5D5C5F,
+   0xD2529AD2, 0xF2977C54, 0xED6E33E0, 0xC55087D9, 0x167E355A, 0xB8831540, 0xABA42B33, 0xFEEA9103,
+   0xEF3947C1, 0x90D05905, 0x760D24BF, 0xAF085311,
+   0xBDDD2F1F, 0xE5B14850, 0x55841C80, 0xF6EB1478, 0xA63E5ED9, 0x04C7F6AF, 0x65E211E7, 0x3B9541CA,
+   0xE6D883AE, 0x2D06224D, 0x2A257FFA, 0x974628AA,
+   0x45F5B090, 0x1D12EE6D, 0x485B3A1F, 0x4B71091F, 0xF5B0B2A7, 0x86D41F81, 0x2613A770, 0x0B230B2A,
+   0xD7C428DB, 0x57D0106C, 0x9DF04A3C, 0xF277B4BC,
+   0x0A32A7E5, 0xFC506E66, 0xD317047C, 0x846CE285, 0xCC394C36, 0xCEB4D115, 0x97182DB4, 0xEF860BEC,
+   0x2F49ED16, 0x772D38D7, 0x27E042EA, 0x0CC65D74,
+   0x5615DB79, 0x56C0CB84, 0x080EDB56, 0x9ED4F5C9, 0x1AD062E6, 0x07D5137C, 0xE053AD7D, 0xC0A02132,
+   0x218138C5, 0xBBD20E23, 0xD005511C, 0x71A9821E,
+   0xBF27C3A7, 0xB9B7AAC6, 0xDF4565CB, 0x461746B9, 0xB23F38F5, 0x1CCA5DB1, 0x636C2988, 0xB848D7E9,
+   0x99D7F1BC, 0x9905C28C, 0x825EE66D, 0xD57EE56D,
+   0xABE86F94, 0xCD8127FD, 0xC4AA703D, 0x1D082A02, 0x856805E7, 0xE4C033A6, 0x4CFFCBDF, 0x7F9803EA,
+   0x456F325C, 0x08F01BE4, 0x56899A2C, 0x14E4E4D0,
+   0x68450D6A, 0xC220C4E3, 0x348C7C8A, 0x7100595D, 0x260EB12A, 0x42734E23, 0x5C2DB9E8, 0x6D1B51F8,
+   0xDA5A3AB7, 0x983E3BAF, 0x8E12B7E4, 0x997C7DAA,
+   0x7DFA617B, 0x63B6DB01, 0x3958C611, 0x2382C6F4, 0x807A5A47, 0xD8AACD08, 0x3FC68CDA, 0xF468A53C,
+   0x17D5F5BB, 0x8AD836AE, 0xC592ADC7, 0x91DA6C57,
+   0xC01767E8, 0x848C7840, 0xAAF49F7E, 0xB27E5CDA, 0x3E42DB96, 0x67A06472, 0x1741F927, 0xA8E8E343,
+   0x43CCDD66, 0x0305167E, 0x48CF4B36, 0xE590418F,
+   0x87667E11, 0xBB31F603, 0x7E745458, 0xFD4F93F5, 0x309A7D39, 0xBF08A73C, 0x23AD2F18, 0xE7E2EEF3,
+   0x40360944, 0x0CAD3305, 0x48664803, 0xA2B3ACA7,
+   0xBA1FCE75, 0x87675CE3, 0x4D64D1CD, 0xBB409FF6, 0xDE117C49, 0x0F13E3E4, 0x7414266B, 0x31D85EBC,
+   0x271AB0FE, 0x8CA52DD3, 0x964295DF, 0xC22174F5,
+   0x9D6B0C98, 0x5CBC0422, 0x2F796386, 0xDE8A0E6A, 0x023F6729, 0x747F91B8, 0xA06414FC, 0x506BF433,
+   0x8771441C, 0x453F88B8, 0x05852B1B, 0x155344C5,
+   0xD1FE2B3E, 0x2EE3731C, 0xD3A13366, 0xD29D1C69, 0xB6BA5AE0, 0x04941BAE, 0x5C9074AF, 0x453AB057,
+   0x20932FDD, 0x8D1D5424, 0x719D78FA, 0x98495D67,
+   0x9E3303A4, 0xAD7F8AEC, 0xFB283BA5, 0xADCBCA0F, 0x03FD29C7, 0x7BA99251, 0x735503EF, 0x2E31CF2A,
+   0x5DAD58FC, 0x60D66A8A, 0x72F7FC70, 0x9C050815,
+   0xC76BFE85, 0x35F5C4F6, 0x4CAFB0E7, 0xBB04BA18, 0x828C22D7, 0x8D19A621, 0xFDEF9916, 0x50E7BD15,
+   0x8B0C751C, 0x2185491F, 0xDB05F5AA, 0x1CF397CD,
+   0x110EC812, 0x698FE08D, 0x6C797F59, 0xB1BCB75F, 0x3C83E188, 0x96EEBB12, 0x1BC4C22A, 0x17B97141,
+   0x1DBBEEB0, 0xF2885089, 0x74551CFC, 0x3F92DEEB,
+   0x0692389C, 0xB2B3D019, 0xA326992A, 0x81C1E25F, 0xC3FDFC75, 0x8F2426B6, 0x49E7ADAF, 0x964B64B7,
+   0xAD954E6C, 0x30B6FE07, 0x2DE7154F, 0x1008A919,
+   0xFFDCDECE, 0xB5406AEB, 0x1AC67153, 0x505D7D43, 0x0433839B, 0xD4CD4991, 0x54540A3F, 0x3D981F00,
+   0x036E1CF2, 0x055F14E6, 0xC33A23E5, 0xFC45ACB0,
+   0x1D129997, 0x04B8D16B, 0xBB8B42C8, 0x086062F1, 0x40AECCEE, 0xAEBCF8A0, 0xB96D5265, 0x139CCDBF,
+   0x0134A1D2, 0xBA482874, 0x5F0E60E7, 0xCE949A4C,
+   0x0AACBDBE, 0xFAFF6B3F, 0x1474E4E0, 0x711D70D9, 0xBB71B0F2, 0x2B9618D8, 0x9019B8DA, 0x01EEB580,
+   0xA6202191, 0x6F034817, 0x6DBB1DE3, 0xF1342094,
+   0x4B678259, 0xE2BE4E8E, 0xF877DABE, 0x2D2B5523, 0x25DE025C, 0x51742D35, 0x0BB80CD0, 0x04ADBA39,
+   0x4D280EA6, 0x1BE43DE1, 0xD40AEC5D, 0xB08DC4B8,
+   0x9C8E4278, 0xD165CD21, 0xBE3074CF, 0xD464F8BA, 0x596C7E37, 0xE880163D, 0x3B71CDBF, 0xFF21CF57,
+   0xABB38EAC, 0x104C1028, 0x092EE0C5, 0x86D1BDCF,
+   0xCD619224, 0x48F6C554, 0xC9B564E6, 0xCBDDA09F, 0x40245EE6, 0xD0160020, 0x386AAE10, 0x058DF586,
+   0x8FCF7688, 0x8052FB31, 0xEA5B86C3, 0xF957DAEB,
+   0xC2CE683E, 0x6D0C4D55, 0x3293209B, 0x47AED690, 0x43AB78DD, 0xAE73EB9E, 0x83C397ED, 0xBFF13CA6,
+   0x6625250F, 0x4BFA2608, 0x5D44FB41, 0xAC3BEC82,
+   0xB5EA9058, 0x69D09904, 0xA022F24A, 0x8745FDEB, 0x3281A45D, 0x5BEEFAFC, 0x6AA4BB27, 0x1D5C4177,
+   0x4FAA1EA1, 0x50B310F0, 0x14137409, 0xE6D7909E,
+   0xB002667C, 0x9857F321, 0x5F935341, 0x9FC75306, 0x7469ADF5, 0xFF0B96FA, 0xFAAB0698, 0xB409FF5B,
+   0x6D15C913, 0x39E82032, 0xEB2CFB46, 0x86DC3FA0,
+   0x3E1E3FD2, 0x69BEE69D, 0x66C61037, 0x2CDBF99D, 0xC1B13717, 0x223FA09F, 0x73840224, 0x1D4E2D20,
+   0x18B74223, 0xF8D1807F, 0x1190C01C, 0x107A3BD9,
+   0x4F70BDDB, 0x2C06D1A8, 0x682E4E19, 0x50FA35FC, 0xED755360, 0xEBC25FF2, 0x9F6B8739, 0x9322E205,
+   0xB7A81A4F, 0x7C6D9E03, 0x8869D0CB, 0x3A9E39A8,
+   0xFE68EFF8, 0x150824EC, 0x924B06A1, 0x7434B70D, 0x1ADDF43E, 0x45E44AA0, 0x4F4F63C3, 0xD3D6BBCE,
+   0xDF8DEECD, 0xACB7733F, 0x80B606DF, 0x53D9814D,
+   0x968B4A5F, 0x110162F2, 0xBA0F8B3D, 0x1323FEFF, 0xB1666EAA, 0x89ACC4C0, 0x3007A482, 0x85DFB383,
+   0x5C7A9BA1, 0x5F5449E7, 0x6BFCF21E, 0x38174A00,
+   0x4F0474FC, 0x9F7DC254, 0x40CB718B, 0x13F390D7, 0x3A45AD17, 0xE6091C18, 0x1605976D, 0x9B795D80,
+   0x2055EE90, 0xE0BCD7AF, 0x92EE7C2E, 0xD637FBF6,
+   0xDF13F515, 0x94971913, 0x33B3F908, 0xFE218266, 0x1639FCF5, 0x0E764323, 0xA1254809, 0x2F1C9564,
+   0x5715AC43, 0x28A0DED9, 0x3DB85F16, 0xCC249148,
+   0x54C8F22D, 0xC4BD32D1, 0xAAF03B8A, 0x20F4D89D, 0x6CBBC34F, 0x2D25AC66, 0xB210256F, 0x1DDE41E1,
+   0xB830E83C, 0x982ABC37, 0x4A0157BA, 0x859F781E,
+   0xDAF70CC5, 0x3741A3D0, 0x1949DCA9, 0x4F89C256, 0x4209B8BB, 0x84D76E8E, 0x61AA033D, 0x89D03A28,
+   0x62EB53A5, 0x2BB8225A, 0xDD131005, 0xF16CAEC4,
+   0xB3F85850, 0xFB3DA605, 0x9705C612, 0xA894E851, 0xB6E52255, 0xD3C477F5, 0x609DE217, 0x275B8DC4,
+   0x17CCD6D8, 0x836E2886, 0x7626B688, 0xBEFEB474,
+   0x12CD19BD, 0x564F510B, 0x243D4B30, 0x055916A4, 0x59D3EBAC, 0x017C752E, 0xA5B4B98C, 0x4C292ED9,
+   0x75051686, 0xEE06B302, 0x799F7CAB, 0x234FF191,
+   0x847C9865, 0x7730FFE1, 0x5FC2E271, 0xCDBD4055, 0x3F876569, 0x5724C2C4, 0x600A300E, 0x4824D115,
+   0xB6D99957, 0x1DAFB1AE, 0xA2EE809B, 0xF3B9740F,
+   0xAE3C5C76, 0x0A289321, 0xA1A23A44, 0xD35FBDC6, 0x27340D10, 0x72BD5E91, 0xFCA6AA42, 0x38DF4F70,
+   0x50546B32, 0xD9F2612F, 0x5C98FDF6, 0xC3819702,
+   0x7476A566, 0x6A2544DF, 0x9A396E7F, 0x5DF6ECFF, 0xEAD8F18C, 0x4522F408, 0x3A8C0E3E, 0xCBF8CDA2,
+   0x51C4A7D1, 0x3BE9ABF2, 0xAD0790EA, 0x634CD141,
+   0x370FE603, 0x1E9910C1, 0x5D9DAD61, 0xFEA60180, 0x2A100FB0, 0xEB38209D, 0xCECB606C, 0x32A7A05A,
+   0xDF14CFBA, 0x2D74E5BF, 0xDD1A12B5, 0xC65D0259,
+   0xF5F8C9C8, 0x7B4D13B6, 0x93B145ED, 0xDC79A2B3, 0xF7CFF674, 0xCC9C29E6, 0x80655087, 0x590A59BC,
+   0x3524F00E, 0x0CF046A2, 0x9DC026BD, 0x67625661,
+   0x535B9874, 0x217AFFC5, 0xD7396B2B, 0xD0F3DA4A, 0x5189F1D9, 0xC2F3120A, 0x13BE9D9D, 0x640D40A5,
+   0x7EA25C0B, 0xC65AEEC0, 0xAC1B42F6, 0x148AC3C9,
+   0x7C4C23E0, 0x949C94D4, 0x75B629E8, 0x4C25D7A6, 0xFA279B86, 0xBAA85BFC, 0x2A18AAFD, 0x3E066E81,
+   0x51BBAEAD, 0x9F3AB93D, 0x095C11E2, 0x1665215E,
+   0x24C2BB10, 0x54372E43, 0x35CEF78A, 0x3FF377FC, 0xD5963475, 0x6B9D764A, 0xEA0F3BB8, 0x220B12A8,
+   0x2D5D3F66, 0xFB9ED41C, 0xC7DD2E7D, 0xDCAFAB6E,
+   0x0C7BB28C, 0x598E839A, 0x92905130, 0xC3193279, 0xD0F989EE, 0x8FA52CCF, 0xDE21507B, 0x819D4150,
+   0x9E2B7DE0, 0xE3A8959D, 0x8720A5D8, 0xAA5F9788,
+   0xF2185961, 0x69FE6DE0, 0xCAB2F970, 0xAC246678, 0xD1FA56CB, 0xEAA8FDC7, 0x95E4CA40, 0xF46115F6,
+   0x884B0B69, 0x408B8231, 0x861CC448, 0x740A16F9,
+   0xE63B89DD, 0x7C2024CD, 0x15B8BC28, 0x43399555, 0xE993CCAD, 0x3A25EFB9, 0x35DBB862, 0x0E01859A,
+   0x3521322C, 0x916982EA, 0x19F5F297, 0xD25B20D6,
+   0x66B45964, 0x605AE87E, 0xB27E5CA5, 0xDAC9D9AD, 0xA3499782, 0x2E078313, 0x13C7265A, 0x6BB00D35,
+   0xFAAB601E, 0x2C18934B, 0x311C2D54, 0xAE61E44C,
+   0x511E4DDE, 0xC5916E59, 0x514D5438, 0x60CC36ED, 0xC756A818, 0xC5332778, 0xC995B742, 0xBC6AC88B,
+   0x9613E95E, 0xEEF9E1B3, 0x5EB046F5, 0x050394C3,
+   0x292DB8D6, 0xA7336B4C, 0xFB3F71A7, 0x0D03E76F, 0xB272DEDF, 0xCFF0E362, 0x46E3FE2C, 0xBA4575E3,
+   0xE7055F43, 0xB38ACD7A, 0x612DB2A9, 0x8510FD43,
+   0x9BC4AAD3, 0x189C8DCD, 0xCBFB868A, 0xDB5D782B, 0x37EF7C9A, 0x5B915B8E, 0x702C0828, 0x05698EBC,
+   0x62D4BF9F, 0x687BEAB1, 0x66F63C3E, 0x3F00C98A,
+   0x30295B6D, 0xB69E1A41, 0x3183CA76, 0x42CBA75B, 0x44504121, 0x8931644D, 0x5DC284CF, 0x183CA597,
+   0xFDA50FF0, 0x2C475A8E, 0x2D02587C, 0xBA0BB140,
+   0x678C33DA, 0x994323CE, 0x72475384, 0x2A5B1F44, 0xA4D9C1AE, 0x18638850, 0x6975F27C, 0x31C40073,
+   0xDF1D904B, 0x69D8001A, 0x4889B105, 0xEF6270A8,
+   0x1D808BF2, 0x9CB26205, 0x7FA50C45, 0x82DFBF8D, 0xFE6665B4, 0xF7615A8B, 0xB0CEB476, 0xFD616CC2,
+   0x0B9AF731, 0xD1BBF01D, 0x322C4CC3, 0x2D429B8F,
+   0x943B6FFB, 0x8B877CC0, 0x26857E49, 0x931B0790, 0x7DB914FC, 0x61613D73, 0x325E0B06, 0xE7C95092,
+   0x91C5A80C, 0x4236049C, 0xED476D14, 0x8A6C523C,
+   0x50558A7E, 0x3C8AEF7B, 0x48231BFE, 0xB6916323, 0x3C54040D, 0x9AC79B24, 0x84C33825, 0x499FFFFB,
+   0x6DE02A66, 0xCB5C8A68, 0x855393C4, 0x63AF0DA1,
+   0x4C95881B, 0x5106D00B, 0x498DAF92, 0xE0B4C8A2, 0x09537675, 0xCA874388, 0x3F77A490, 0x0AB4215E,
+   0x64869E35, 0x77C191CC, 0xCB5617C1, 0xB15B7DC3,
+   0xEF74F723, 0x94DC664C, 0xCBBAFF21, 0x7BC91861, 0x1AE6DFC8, 0x2690C784, 0xDF65AE68, 0x4DF56FBC,
+   0xA3730712, 0xDCB40A65, 0xB51D6A88, 0x2827BF67,
+   0x83DFAC3C, 0xD7ACB374, 0xC9C0488C, 0x45B47C9C, 0x0913903C, 0x5C9BAC55, 0x669F2BC7, 0xBA001680,
+   0x187805AE, 0xED4E6D4E, 0x98EABBC9, 0xCA2E18BD,
+   0xB59F7464, 0x1CB12191, 0x11E1ED1E, 0xC1AF45EF, 0xB2BE31E0, 0x1F6572BC, 0x778C4BB1, 0xB5421ECE,
+   0xB9AAC9FF, 0x559986D9, 0xC6802365, 0x6D0B354E,
+   0x0AA2D847, 0x231D3239, 0xF186C861, 0x054A9A12, 0xAA7CF18D, 0x01BC8E70, 0x8F470162, 0xC8A58BDD,
+   0xF42108DB, 0x96F5C7AB, 0x95A5760A, 0x1D880FC4,
+   0x9DE8A87C, 0x2FDCB313, 0x5A427D95, 0x5B930738, 0x5B8CD3F8, 0xA2B8E9AA, 0xC983DFC7, 0xEB1C24AB,
+   0x88113586, 0xFB9FD3CE, 0x85121157, 0x66C8E652,
+   0x84A0210F, 0xD83BE656, 0x9535D285, 0x59034061, 0x84061F0E, 0x18CAF847, 0x60314751, 0xBAB7A9A8,
+   0xE22CD7BE, 0x93A603C9, 0x52B5E890, 0x1EEA6997,
+   0x522A423F, 0x495175CD, 0x04E53690, 0xEFC6442B, 0x1316EE5C, 0x30B58307, 0xA2C65976, 0xC6D30519,
+   0x16A88BB6, 0xD6EAB709, 0xAF14EE70, 0xEFD0FDB5,
+   0x71CA7C18, 0x75666E3E, 0x3F0E31BE, 0x7FC491E5, 0x3EC23D8E, 0x2B583795, 0x03021F01, 0x66EEEFF3,
+   0xFC1A5B28, 0x24E8CD38, 0x85425712, 0x716821C6,
+   0x7852A8B0, 0xE5B1A0D5, 0xD0FF8140, 0xD2E22EC0, 0x75476490, 0x0DA6B7A8, 0xDA4A513C, 0x53120134,
+   0xAFF54C16, 0x78FBB953, 0xE2A40FAA, 0x3BD530A3,
+   0x087F83D8, 0xA46D2742, 0x7CE1BC46, 0xC47F329C, 0xCA917D28, 0x68C4944F, 0xEE1C8C08, 0xE0D8B028,
+   0x20DBF9BE, 0xED86ABE0, 0x7AAE428A, 0xD8B9040A,
+   0x664AA28D, 0xC0E60AB1, 0x9D940C86, 0xCEB2995E, 0xCA4003AD, 0x5530B3B2, 0x27487874, 0x42E21E34,
+   0xAC5B72AE, 0x82E36DC1, 0xCB46AB57, 0x0B4B5EEA,
+   0x4EAD08FC, 0x522A9F51, 0x4C7D5C68, 0x02DDCFD6, 0xE02676D8, 0x7CD9108B, 0x4E23A730, 0x1742D25F,
+   0xECA4E5D1, 0x28342177, 0xEA65145C, 0x2FC3854A,
+   0x193F489A, 0x253E8C05, 0x188E2307, 0x24BDF941, 0xD2A64C9B, 0xA6CCFB9B, 0x1A71A7E6, 0x26E0868D,
+   0x1D99DFE4, 0x89A2A4FD, 0x12095CF4, 0xA012E8CB,
+   0x1BD5EE20, 0x425A5C1B, 0x212C5B5B, 0x429411F5, 0x7D1A996E, 0x100FB60F, 0xED4E5B27, 0xD429D128,
+   0xCDA181A2, 0x1261F141, 0x94C8B1BB, 0x763ABFC4,
+   0x2740D819, 0x657E1573, 0x7E53BBF6, 0xD4C8400F, 0x731937EA, 0x045E5AEF, 0x492B739C, 0x5C97AC7E,
+   0x1EC3B215, 0x21D2E70E, 0xDDD6088A, 0x3ED621AC,
+   0x6DBE26A9, 0x3F38F26D, 0xA7316C08, 0x893A5049, 0xF5C699C3, 0x5A30C2D2, 0x8BF6E42A, 0xB2E9978B,
+   0x0DB721DD, 0x0B5415FC, 0xA41C8365, 0xF29D6BCD,
+   0x21228AB2, 0xFAF24E1D, 0xE1452DF2, 0x78DEBE84, 0x9E7F135A, 0xBEF7D924, 0xE7F8D0E0, 0x149F1F4A,
+   0x2762544E, 0x128B813D, 0x9C390A58, 0xEBDA14BF,
+   0x2D14FE1B, 0xF4C4561F, 0xB3F24F5E, 0xAE8CFC1C, 0x9B76389A, 0x68E81B1E, 0x5E63E131, 0x8F9DDD40,
+   0x734115CD, 0x3FDF4533, 0x2D23CAFE, 0xF2B4AF6D,
+   0x484CE8D6, 0x9369AAE4, 0xFC277A27, 0x7B1A9637, 0xA530E76F, 0x5C4613CF, 0x74AFD88C, 0x84564D23,
+   0x14443D32, 0xF083971B, 0x5FD747FA, 0xF73898FD,
+   0x366473A3, 0x15C17BFD, 0xD2325DEA, 0x2D899447, 0xAC30E951, 0x0465C806, 0x1BB96CFA, 0x534961F7,
+   0x4332FFD7, 0xB1A6DA80, 0x0104F8AC, 0x21CE3595,
+   0x241F665B, 0x81A55FA1, 0x64634B7E, 0xA0EA6092, 0xEB475504, 0xD0C389C4, 0x8D1E0203, 0x2CD1C98F,
+   0x84A47688, 0xF359AFAB, 0x7A41C64C, 0x59BCD346,
+   0xE64BC28E, 0x3AA100E8, 0xD156E143, 0x6E9EEA3F, 0xC8C5471F, 0x9C5A311D, 0xE8940BF8, 0xF0E607EB,
+   0xC47A8F0B, 0x4CDD06D1, 0xCD527795, 0x5106CAA8,
+   0x0D46066D, 0xACD8E251, 0x6F1D5714, 0xA6CDA079, 0xCA36FBDF, 0x419EF5AD, 0x9E1D7A6F, 0xDC48951D,
+   0xB7A52681, 0xC6C22C15, 0xAA724286, 0xB6C9DC11,
+   0xA7646C3F, 0xD4AB3C62, 0xD8446A48, 0x80A8C060, 0x12587682, 0x46893C57, 0xCE834F82, 0x2CD0B8CB,
+   0xB004849A, 0xDFFAEBAD, 0x41C3A434, 0x3E654E44,
+   0xB0E01600, 0x7765EBE9, 0x25C62AFC, 0x1492AC19, 0x16DB2DB3, 0xF914062A, 0xF9417106, 0x2C552735,
+   0x945F1DCA, 0x675B4089, 0x9590219D, 0x1CB8DFE5,
+   0x41FAB175, 0xCEF9BDCA, 0xE236B88D, 0x349AA2D4, 0x466B69D0, 0x07AAEAB6, 0xC27DD5D2, 0xB899491C,
+   0x5099C372, 0x81F42547, 0x510EF1A2, 0x5D60F35E,
+   0x1CA916B6, 0xC12065E7, 0xF8325358, 0x2CBDA6C0, 0x57E6F0B7, 0x6F26CC31, 0x1C54E327, 0xBC17D334,
+   0xFBEDAEF5, 0x9F1EE7CD, 0x341C165A, 0xB61F0040,
+   0xC200326A, 0x091A3BD4, 0x8F99E034, 0x44164A0C, 0x1B187383, 0x622994D4, 0xB12DA429, 0x6732749D,
+   0x0CB1F4BF, 0x668B6237, 0xE2DAFFC9, 0x42B6A335,
+   0x4BFB949B, 0x34C95B84, 0x2F8BAC59, 0x4A1156C0, 0x95F2A511, 0xBFB266EB, 0x528F0A1D, 0x333C1450,
+   0x361D12B2, 0xC23DC688, 0x3BC7FA44, 0x6575994A,
+   0xC2CCE9ED, 0xC45D8DB0, 0xDED49C21, 0x14D197FE, 0xB2C46C12, 0x56C11EB8, 0x8ADD12FC, 0x6B7F9371,
+   0x3B5BD8E4, 0xC3C27C16, 0x40D43DF2, 0xAD81EE03,
+   0x65994991, 0xEF16EDC5, 0xF39A4279, 0x2B6F4EA7, 0xC07E0A7B, 0x55074ED7, 0x69317AD6, 0x3415B9A6,
+   0xA472E0A8, 0x0CF8B93F, 0x8532752B, 0x1237DEA2,
+   0xCF0DC0BC, 0xF4A44125, 0x48B2FC9B, 0x4B8385C3, 0x580BBE2B, 0x629A7A2D, 0x1881F3C5, 0x2C4F741B,
+   0x0AA343E2, 0x1EA38B16, 0x7B81184A, 0x7735A28D,
+   0xEBC7A05A, 0xEDFA66B6, 0xD005432C, 0xE12F0B82, 0x9051E2A6, 0xEFBC796E, 0x1A964862, 0xC6658E67,
+   0x2D6041D1, 0xC2B42159, 0x557CCA45, 0xC0F39509,
+   0x9509F4CE, 0x42486F73, 0xD60FB23C, 0xFA10BA0D, 0x22D97E5C, 0xF55A55A9, 0x8D750955, 0x8EF47B07,
+   0x3F540AA1, 0x1E61B410, 0xC56B7257, 0xFA6F0EB0,
+   0x2C3FC486, 0x03995FE7, 0xB6B72BF0, 0xFF565AAD, 0x48A40004, 0xBFBAE8C8, 0x13B5A1E8, 0x9C99CD5A,
+   0xFCAD95B0, 0xFEE77EE2, 0x34D16B96, 0x0B635399,
+   0x5D778A19, 0x2801AB2B, 0xD5D0854E, 0x604D8349, 0x3091C681, 0x7AAF003B, 0x0761AE3A, 0xC9E2B6E1,
+   0xFE414395, 0xA5F0B69B, 0xADAE97B4, 0x419E8889
+#endif
+};
+
+const EcCombTable secp384r1CombTable =
+{
+   //Number of teeth
+   EC_COMB_WIDTH,
+   //Distance between two consecutive teeth
+#if (EC_COMB_WIDTH == 4)
+   96,
+#elif (EC_COMB_WIDTH == 5)
+   77,
+#else
+   64,
+#endif
+   //Length of a coordinate
+   12,
+   //Precomputed points
+   secp384r1CombPoints
+};
+
+#endif
+#if (SECP521R1_SUPPORT == ENABLED)
+
+/**
+ * @brief Fixed-base comb table (secp521r1 curve)
+ **/
+
+static const uint32_t secp521r1CombPoints[] =
+{
+#if (EC_COMB_WIDTH == 4)
+   0xC2E5BD66, 0xF97E7E31, 0x856A429B, 0x3348B3C1, 0xA2FFA8DE, 0xFE1DC127, 0xEFE75928, 0xA14B5E77,
+   0x6B4D3DBA, 0xF828AF60, 0x053FB521, 0x9C648139, 0x2395B442, 0x9E3ECB66, 0x0404E9CD, 0x858E06B7,
+   0x000000C6,
+   0x9FD16650, 0x88BE9476, 0xA272C240, 0x353C7086, 0x3FAD0761, 0xC550B901, 0x5EF42640, 0x97EE7299,
+   0x273E662C, 0x17AFBD17, 0x579B4468, 0x98F54449, 0x2C7D1BD9, 0x5C8A5FB4, 0x9A3BC004, 0x39296A78,
+   0x00000118,
+   0x66FD07CA, 0x1036EB9B, 0x6B7FB490, 0x6CA52CC1, 0xD3E0C270, 0x512E973E, 0x73D92D11, 0x889980BF,
+   0xA4005EEA, 0x38B4CFE4, 0x8CEB4313, 0xB6F992CC, 0x6DAF7C23, 0xD0AC2F8D, 0xE32A93CB, 0x1CCFBF17,
+   0x000000C2,
+   0x2F508CCA, 0x7BD9D6F1, 0x595A72AF, 0xE82D7171, 0x97512873, 0x25D02976, 0x8CF39FBC, 0xEFC1DE8B,
+   0x9A1237F4, 0x25E6B77F, 0xD4D98B5D, 0x9F3B73E7, 0xECCB07FE, 0xE1FDA62B, 0x625350CF, 0xDB813B03,
+   0x00000014,
+   0x9B27BD61, 0x415A1C9B, 0x606854D6, 0x74522753, 0x92E73538, 0x9E331EF4, 0x817E7A6D, 0x0B3DBA85,
+   0x49AC273B, 0x55C4BD53, 0xFCB5417F, 0xAD42C78D, 0x92E08D38, 0x528998B9, 0xCC1914CC, 0x14C2FFF6,
+   0x000000C1,
+   0x767E9645, 0x35B26FB0, 0xC5E5A659, 0x162B512F, 0xCC47FBB8, 0xA6E03696, 0x0A29A69B, 0x732DB065,
+   0xD56BDF5D, 0x058A74ED, 0x25C858D9, 0x4B7B60A0, 0xBD43373D, 0x17F8A6D4, 0xEDF610B4, 0x7B968F51,
+   0x0000011F,
+   0x1BC0FA77, 0x5F56B5A4, 0x64FD36F5, 0x6CDD6BB5, 0x8A5B7C7F, 0xD0AC68B5, 0x09919EF9, 0x4A92D9BF,
+   0x71C3C520, 0xC305E12B, 0xDB699AEE, 0x554A9D1C, 0x61F54643, 0x7FDE0077, 0x479115CE, 0x99C13124,
+   0x00000039,
+   0xC271AC2D, 0x25F890E1, 0x94B370AC, 0x1353CCD3, 0x744D4011, 0xC7B5ADF6, 0xBE378127, 0x9CCD7687,
+   0x06C4E3CD, 0xA8489B5C, 0x305505F9, 0x1945580A, 0x4AB3B12B, 0x07190A20, 0x1534EA4D, 0x0FF53EB1,
+   0x00000159,
+   0x91798548, 0x877D4EDD, 0x031D657A, 0xC43C7B25, 0xFAB18A04, 0x47603671, 0xF670B476, 0x7E39E7F2,
+   0xB02FCC03, 0xF7B76431, 0x877F46F5, 0x7C5662F3, 0x1C8B0C61, 0x5BF8327E, 0x4A8BE322, 0xE9CDB353,
+   0x000001AE,
+   0x9D264420, 0xA2D7092E, 0x533FF3DB, 0x1F970352, 0x99B5B52E, 0x31DD232B, 0x850F45E9, 0x8A9CE16B,
+   0xC3011849, 0x01C99023, 0xC8E9301E, 0x4BC30989, 0xCD95F64C, 0x77A4DE70, 0x1026F289, 0xBC8797BB,
+   0x000000D7,
+   0x2BE9EDF8, 0x98EA0934, 0xFCB98199, 0x6C2F3132, 0xFAF83AEB, 0xF579893D, 0xC73FDA0F, 0x858E87BB,
+   0x7A0B9D1C, 0xD3C0B3FB, 0x71EE68B1, 0x21FE6305, 0x66AA6F16, 0x5BF8F01F, 0xBCA825ED, 0x30934C99,
+   0x000000D1,
+   0x913022F2, 0xE4309850, 0xDE5B80CE, 0xFDC336C9, 0x8B6130EF, 0xB716D689, 0xA758D2F4, 0x8A58B405,
+   0xAA5CBC1C, 0x98879DF8, 0xC12CE0BB, 0x847CFD06, 0x8C02FF3C, 0xA1006360, 0x3438695B, 0x836E906A,
+   0x00000136,
+   0x259CE02D, 0xAC8FE351, 0xDAE5E0F7, 0xA506DA0C, 0xF043421D, 0x77B56E98, 0xA1647490, 0xE0D041C7,
+   0x9CB90101, 0xE41F0789, 0xDA3E72E6, 0x29BBF572, 0x04A14DF0, 0x6B635C47, 0xE81EF5D3, 0x56873F58,
+   0x000001DD,
+   0x5CF9E33F, 0x77ABE79E, 0x0A1117FD, 0x91AAB581, 0xCBAC2FE1, 0x11EDF3B1, 0xD72113B7, 0xEF43E017,
+   0x06B74002, 0xF9AD685C, 0x8FBD3B1A, 0x7E6370CE, 0x42F73A82, 0x550DD50B, 0xC5E64A9B, 0x8F2146BE,
+   0x000001F2,
+   0x2934ED82, 0x05A704CC, 0x989EDD8C, 0x647089FB, 0x0CE7C62D, 0xE0B239D4, 0x105A5EFF, 0x4C892EA6,
+   0xD5ED6B04, 0xA519395F, 0x509ED794, 0x806C7003, 0xE70CE5C4, 0x882E9886, 0xFF01F6A9, 0x50730CA1,
+   0x00000088,
+   0xDBCC5484, 0x90A78A16, 0xFD454B50, 0xC1AB078C, 0xCB09E525, 0x6F488252, 0xE19B2ED7, 0xDD663F53,
+   0xA67BF59C, 0x16B10DA1, 0x36BB770A, 0xB47F6B95, 0x777B2BCE, 0x6BDC8428, 0x561553F8, 0xCD02AE3D,
+   0x00000017,
+   0x1579D15A, 0x1E3633A0, 0x3E98CD1F, 0x574F0C23, 0xC60F4F99, 0x45969DCA, 0x49FB9F24, 0x10062C93,
+   0xD378F640, 0xD29A29D7, 0xD7D48C2F, 0xEC941760, 0x31FBEA5C, 0xF0591C59, 0xB40F9EBF, 0xD6173E6B,
+   0x00000063,
+   0x5A984A72, 0x220F4F39, 0x32510F26, 0x9A3F82CE, 0x8C069A1D, 0xF3D04C76, 0x69A21E57, 0xF1D6D891,
+   0xDC4DB601, 0x6B96B30B, 0x64DCF3E0, 0x71EEB728, 0xC7CAAFF3, 0x6F80C483, 0x571B66E4, 0x45533092,
+   0x000000B0,
+   0x87140DAD, 0x49AE4521, 0x57E2803E, 0xDA73032B, 0x026EA20A, 0x13F5E5EB, 0x6E00AFB9, 0x2D54C4B0,
+   0x7A150474, 0x4393B92B, 0x13F1A7DA, 0xB5B41BF8, 0x02B5867A, 0x6D786907, 0xAF2EA4D1, 0x5193A9AC,
+   0x000001B3,
+   0xA6B186CB, 0x2A1563F7, 0xE28E57B6, 0x73A70A44, 0x78FC8A1D, 0xD7C4FC6D, 0xDF3D6D99, 0x4C9B4581,
+   0x1E373AAB, 0x544F5249, 0xE913498E, 0xE99434A2, 0xC4700F4C, 0x30159749, 0xE5142766, 0xB8EF02CC,
+   0x000001D0,
+   0xB9E6FFC9, 0xE99805A6, 0xF74D977B, 0x1A357F05, 0x5C9941BC, 0xC8DDEF31, 0xCBE842E7, 0x4B6D66CA,
+   0xA20DC12D, 0x84E1F75F, 0x5F0C02FC, 0x8B1B2C50, 0x037B493D, 0x3FA1889E, 0x95705046, 0x720BD9E0,
+   0x000001C2,
+   0x93AB9309, 0x1A1F3378, 0x226A8F94, 0xE05A30A2, 0x4045F1BD, 0x2C01A52D, 0xAB5F5115, 0xF42E8FD5,
+   0x0C05FECF, 0x954D1D09, 0x8D0650D3, 0x47E964D1, 0x3C860801, 0x6866FA5D, 0x5ABBB4AF, 0xAC2FECBF,
+   0x0000012C,
+   0xE5537747, 0x846DC3D2, 0x1F5F9F46, 0xE28E00DF, 0x3F31E42D, 0x041AF624, 0x256AF225, 0x4948947F,
+   0xFF4F9550, 0x3896C61A, 0x34BB5A3E, 0xCB40C773, 0xECEAFACC, 0xB9BECB07, 0x4D45E83E, 0xFE29F049,
+   0x000001AA,
+   0x6B5578DB, 0x83FB71B3, 0x0A710526, 0x3017F115, 0x5F220D77, 0x189EC946, 0x48465E68, 0xBA87AE07,
+   0x70E0CBEA, 0x1DA474D5, 0x2B2BA7C5, 0xB92CB0A6, 0x8B1FB7E2, 0x35CB356D, 0x2CC8CB18, 0x1155296A,
+   0x0000000F,
+   0x6ED0F604, 0x7F9C9D9B, 0xCB49C6D7, 0x765E43E9, 0xAE9BE5CA, 0x03C4DD67, 0x405AED36, 0x5480888B,
+   0x920CCDDB, 0x3A69EBB2, 0x03F0C7CC, 0x44EC0573, 0xCE89B026, 0x158E2437, 0x4F179A17, 0x86795029,
+   0x0000003A,
+   0x9F193DD9, 0xF7854032, 0xDCC158A9, 0x531E4068, 0x3642B1A5, 0x774171BF, 0xC1E53AA3, 0x12B4920F,
+   0xFD87478D, 0xD1C5FB53, 0xA7CBA7CA, 0x48958C58, 0x3F66F2C7, 0x375B2CB2, 0x598899BD, 0x1B510D0F,
+   0x000001B8,
+   0x52007E41, 0xFE96299D, 0xCD708DCD, 0x997140B5, 0xF655F6FA, 0xE9294EED, 0xD58B839D, 0x7701D45D,
+   0xB6F77CDB, 0x5DBDF5AD, 0x95A572F0, 0x265189F4, 0xB3515E7B, 0xC162794E, 0x72655E0B, 0xBFB571E0,
+   0x00000168,
+   0xBDA82A6B, 0xF0D2B863, 0x390A9CC7, 0x3DF5B283, 0x700FCD7B, 0xBAB9995A, 0xFA4E6C06, 0xC01EF0AF,
+   0x76A392D4, 0x10A98513, 0x955392F0, 0xA7E3FC72, 0x1D7A8550, 0x8E3C0128, 0x361898A8, 0xCBCA551A,
+   0x0000010F,
+   0x3AB71115, 0xC8A4CD40, 0xBCB9B55B, 0xB783170D, 0xABD9B426, 0x1BE20F6A, 0x5377B714, 0x32D2EA64,
+   0x6B358BBF, 0xDA342480, 0x6E202211, 0x782BC800, 0xAA27C499, 0xF80974C4, 0x50341CDE, 0xC2E66FA9,
+   0x0000004E,
+   0x24AE60C3, 0x082CB95B, 0x83AD7484, 0xD4B80AF4, 0x6205256B, 0x84B739CE, 0xAE1FE063, 0x616F505E,
+   0x342F218F, 0xEF14EA68, 0x64A01186, 0x2B17D66C, 0x50858BCE, 0x60E889CE, 0xD5881005, 0xDB046C59,
+   0x000001E1
+#elif (EC_COMB_WIDTH == 5)
+   0xC2E5BD66, 0xF97E7E31, 0x856A429B, 0x3348B3C1, 0xA2FFA8DE, 0xFE1DC127, 0xEFE75928, 0xA14B5E77,
+   0x6B4D3DBA, 0xF828AF60, 0x053FB521, 0x9C648139, 0x2395B442, 0x9E3ECB66, 0x0404E9CD, 0x858E06B7,
+   0x000000C6,
+   0x9FD16650, 0x88BE9476, 0xA272C240, 0x353C7086, 0x3FAD0761, 0xC550B901, 0x5EF42640, 0x97EE7299,
+   0x273E662C, 0x17AFBD17, 0x579B4468, 0x98F54449, 0x2C7D1BD9, 0x5C8A5FB4, 0x9A3BC004, 0x39296A78,
+   0x00000118,
+   0x876B33AC, 0x45D90CF8, 0x3ED58F0B, 0xE53E1A99, 0x49D916B3, 0xD5D181F5, 0x2EC09BE2, 0x1B1EF040,
+   0xB2113B57, 0xE5787176, 0x8073044E, 0x11D02E70, 0xA2AE38DD, 0x9D1C19E7, 0x3634F6FA, 0x2662D494,
+   0x00000130,
+   0x6BD6208E, 0x454C8A73, 0xAE37911A, 0xD2447CEF, 0x69B8C5AE, 0x56AC592E, 0x9B615BFC, 0xE7F56483,
+   0xBBE7FE62, 0xFAC066E1, 0xB7777B32, 0xB2AC3EE1, 0x15114ADA, 0x55F86533, 0x46497CC9, 0x15CBA83E,
+   0x000001EF,
+   0xE371375D, 0x863B3ADB, 0x89CF187B, 0xF2DDD842, 0x6AB24B10, 0x80CF70E7, 0x57D81A93, 0x78063AE6,
+   0xC87491C5, 0x88AEB0B1, 0x2E17FBF9, 0x5EBE733A, 0x52AD31BA, 0xC205CBCD, 0xED66A7F8, 0xA13230F9,
+   0x00000117,
+   0x03A6EC5D, 0x224D9A3B, 0xBE627BE3, 0xE1EFCA41, 0x22ABCA89, 0x34DF229C, 0x8153B848, 0x11C526A0,
+   0xCBB59E96, 0x26879BD9, 0x8D1298ED, 0x77ECCC36, 0xD6560F21, 0xAF68677B, 0x242B365B, 0xE5DDC615,
+   0x0000017F,
+   0x155C337B, 0x7EAEFE12, 0xC7186596, 0x357F27CE, 0x654DBBEB, 0x90C26C69, 0xA1B63A6A, 0x6BCCA278,
+   0x8EDD9123, 0x776B7A92, 0x6C6DA5E9, 0xB2BEF507, 0x0E3C747B, 0x805ED3AA, 0x659DF2EF, 0x298EF458,
+   0x00000098,
+   0x35A79F8D, 0xE3DD8939, 0xA1972C6B, 0x672B109C, 0x07953A4D, 0xAD41CBAE, 0xD206DE77, 0xDE07527F,
+   0xB61D9811, 0x1F55A4C0, 0x7A75360E, 0x929D56D5, 0x5032EFE6, 0x9F2BECFF, 0x60F0622C, 0x0DE654C7,
+   0x00000018,
+   0x8445216B, 0xD9E465AF, 0xC57AE51B, 0x7D12C12B, 0xAB01F4D2, 0xAF65FD9B, 0xB3C1D722, 0xF2FD8A84,
+   0xF5123832, 0x8870DC27, 0x8C85325E, 0xE8B51D16, 0x92E31759, 0x1A03D5DF, 0xEFDB49C3, 0x7B5E6C46,
+   0x0000005E,
+   0x137A651A, 0xB427174D, 0x256229CB, 0xF9E661D4, 0xED3AEB3F, 0xBBD04D0F, 0x5BB3FAE1, 0xC31EEF45,
+   0x07A35089, 0x52DF99E4, 0xED429E1A, 0x6514B9BD, 0x67ECBD97, 0x757977BF, 0xB2725C6D, 0x70A2B55F,
+   0x000000A7,
+   0x8913355A, 0xDD2CD8AE, 0xBA2F3522, 0x02114BFC, 0x22446ABF, 0xE62184F5, 0x68E6D0C5, 0xE8D75651,
+   0x19AD9EBC, 0x580F6C03, 0xC2953557, 0x8B9D5D55, 0x618534DF, 0x234640A5, 0xFED9E6B6, 0xF452A772,
+   0x000001B7,
+   0x16211BB5, 0x0952E477, 0x5CEDF594, 0xD3D874AE, 0x85328765, 0x2C21A7BD, 0xEC333D98, 0x44B3033C,
+   0x3C587CD5, 0x0474258D, 0x4962E19E, 0x527C162F, 0x5B356DD3, 0x0DBF0F7A, 0x95BBFC9B, 0x8D683B71,
+   0x000001BC,
+   0x94BB174C, 0xFF99F7CD, 0x96566E5E, 0x905B42BD, 0xEBAE3BAA, 0xDA1ABF35, 0x7644CE21, 0x15DDF71B,
+   0x50E83A0C, 0x2920C1C0, 0x0F7B1973, 0x237776ED, 0x57ADF3A6, 0x7E393449, 0x9160EAD0, 0xD9E08CF9,
+   0x00000100,
+   0x675707DA, 0x54F0135E, 0x2E5596B0, 0x5976788E, 0xF3AC4001, 0x73DD4B88, 0xFBACBFE7, 0x7F5453E3,
+   0x426B2080, 0x551DC249, 0xE33F8F92, 0x528FF571, 0x95834F88, 0xD78D1E40, 0x7D07A77C, 0x20405C91,
+   0x00000114,
+   0xEC3D1383, 0xD1CE126E, 0x4805B18E, 0x0C7F980A, 0xFC1B1F4E, 0x65945086, 0x092E0CA0, 0xAC1703AE,
+   0x8B5EE5C0, 0x834C77F9, 0x6D19FBB5, 0x3E722F57, 0xF6770BD1, 0xAE8A944A, 0x2A7C7101, 0xE1D11050,
+   0x000000D7,
+   0xCA303000, 0x62029FD2, 0xACB52ECD, 0x366C72C9, 0xCC8DD8A2, 0xCF89C1AA, 0x5D1B984D, 0x95C235BF,
+   0xD1A80D52, 0x3434D10D, 0x77E95ADD, 0x094D0A8F, 0xD1203660, 0x03890027, 0x29791AB3, 0x32FAF273,
+   0x00000075,
+   0x075A4208, 0x9281B5C1, 0x471C7FCC, 0xAFC5E0E5, 0xC8704F00, 0x9A6E82F3, 0x62960946, 0x4320C31A,
+   0x513C571F, 0xE673B4BD, 0x3DC4D8FB, 0x9B68532A, 0x2C95DBE9, 0xA8CBE344, 0x229C47B7, 0x0F6AC257,
+   0x0000014A,
+   0xC1411542, 0x1B4C092D, 0x7747BEAF, 0xC4BB45D6, 0x8D55735E, 0x685C4BE4, 0x6383FD44, 0x9E72FCC8,
+   0x203FF740, 0x615BDC52, 0x5B1A64AD, 0xCC19DAFB, 0x2B782E96, 0x28EF0D34, 0x05E3AE87, 0x21D84532,
+   0x00000052,
+   0x72656971, 0x6A884570, 0xA7F20EFE, 0xDC4FCB92, 0xDC31417C, 0x759DB4FF, 0xF95DC14F, 0xF1BF0345,
+   0x0FD656F0, 0x0686BD5B, 0x6F4440F7, 0x9C5EA036, 0x3887F6E1, 0x207619CE, 0xA211DE2D, 0xA9EF8D60,
+   0x0000007D,
+   0x8E5A6C11, 0xD0BCE7F9, 0xEDC82B6C, 0xAB338406, 0x7CB589B2, 0x36726A50, 0x02CC7EB7, 0x887B6CFC,
+   0x28ACE2AB, 0x651F7903, 0x06BA6057, 0x8E7F8436, 0xBFF72AFE, 0xD103B1B2, 0x46959145, 0x942CF0C6,
+   0x00000033,
+   0x5805D03E, 0x204B0833, 0x5A1AB8CF, 0x3C03AE7A, 0xEAD6F888, 0x3376E27B, 0x94A53E60, 0xB0E6713A,
+   0x3F0B8EE9, 0x790F9E81, 0x4B4896E3, 0x21B2AC27, 0xE7FAFECC, 0xCE7C291B, 0x1C1049CA, 0x10FE14A2,
+   0x0000004D,
+   0xD2130D68, 0x95BB30A7, 0x4C891468, 0xC2A8F2A5, 0xB1608A4A, 0x5236AE15, 0xC50F2485, 0xBD832829,
+   0x435254ED, 0xC87AF748, 0x3A80DC29, 0xC76D7DF6, 0x5D881936, 0x7CE57B49, 0xC0AEAA0D, 0x8E95CB82,
+   0x0000017F,
+   0x829A40A3, 0x21A193C7, 0x05F32F41, 0x87B759A9, 0x6E143537, 0xBA154763, 0x6B5A6433, 0xFB951864,
+   0xD8E9BE43, 0x81C1DADF, 0xB5173D47, 0x3145A42C, 0xE5C9B799, 0x22D5EF4B, 0xFFE36EE4, 0x0BDE5942,
+   0x0000010A,
+   0xF4BC58E5, 0xAFC83BA5, 0xD58698E3, 0xB418E478, 0x1726D889, 0x1F60371A, 0x2F0A291A, 0xA5A58B57,
+   0xFD356626, 0x0E44DA0A, 0x2D89342F, 0xA3E9BE34, 0xC3C1B4A2, 0x9195921B, 0x25E4191E, 0xBCB21228,
+   0x00000135,
+   0x0EBA209A, 0xA1B5F88D, 0x3C5E2880, 0x04B54668, 0xEFBB25F1, 0xE93591A0, 0xE9729982, 0x1678D5F7,
+   0x7D430831, 0x6EB992DA, 0x0B7C198F, 0x1A4A91F7, 0x6ED1FF3E, 0x3A679847, 0x5465E131, 0x18A5E132,
+   0x00000042,
+   0x59486FC8, 0xAF8471EB, 0x9B6AB9E2, 0x397D8CAB, 0x10C0F9EA, 0x942279C2, 0xDDDF11B9, 0xB3186547,
+   0x7E0E49B0, 0x2910861A, 0x4C374108, 0x0AC066AB, 0x9C34F007, 0x67C76F4C, 0x6A9E031F, 0x3635EDBE,
+   0x000000F7,
+   0x4CCFA596, 0x2E91929F, 0x844098CF, 0x3B168733, 0x616A36DF, 0x0FEA437E, 0xE0DC39AE, 0xBEA5755D,
+   0xCA20C73A, 0x721050E6, 0xA6534DE2, 0x5D86BB64, 0xAF758AEF, 0x0C65FF4F, 0x33832CCA, 0x38D7BD4D,
+   0x00000127,
+   0xF7B22FC2, 0xAABE7E25, 0x138537BE, 0x44EC7B6E, 0x5AD7C324, 0x33CD05C9, 0xC1602459, 0x28A6115C,
+   0xDF229461, 0x05C1AA34, 0xBDB1D24D, 0x39FC35D8, 0x4B5F6223, 0x536AA0D5, 0x703BD0F3, 0x1D5287E3,
+   0x00000186,
+   0x5E6A7807, 0x9F9A072D, 0x39EEB105, 0xF9A38A83, 0x17DDB1B4, 0x1503495F, 0x732310B4, 0xDA780A6C,
+   0x403A5D57, 0x7B287813, 0xE7C481E7, 0x6BB08815, 0x574C23E2, 0x1198C8A4, 0x673DFC44, 0xA8DA92A4,
+   0x0000002A,
+   0xBFB7CE31, 0x92DF33AE, 0x4A686F13, 0x1648E528, 0xE45BA7F2, 0x4429B3AF, 0x397C1D83, 0x216C5137,
+   0xC8C8EE26, 0xCAC9D3C3, 0x40C73424, 0x0711605E, 0x219C8C3F, 0x008B93A5, 0xC6F10BB3, 0xAB1EE7B8,
+   0x000000E0,
+   0x10A8C4FB, 0x73A6BA38, 0xECC93E5D, 0x5153D959, 0xB59E9871, 0x7CA58012, 0xAFD442F1, 0xEDC0DBEF,
+   0xB9CF7691, 0xB9050A22, 0x464D017D, 0x3D1E96FE, 0x82074DCA, 0x541781A4, 0x8B355413, 0xEDCE0DB3,
+   0x0000006B,
+   0xAE2B39C2, 0x1A13E3EE, 0x3C218179, 0xC431081D, 0xAE68B7C6, 0x5CBC14C1, 0x9005A304, 0xCF2559BB,
+   0x2EC7AED5, 0x14D7C1E9, 0x1E2E2F0D, 0x5C379BFE, 0x886F0CF9, 0xFC33E4D2, 0xAC4E1D17, 0x2F14E7D0,
+   0x00000071,
+   0xEDDE488A, 0x2F1F1497, 0x31EE698E, 0x3D0364B2, 0xA47E048E, 0x88A32C39, 0x86DA37C4, 0x80ABD8DE,
+   0x07895C9C, 0x6608EED9, 0xD18A7081, 0xCCA6B9E6, 0x0CA87303, 0x44F63AA9, 0x094F9789, 0x84281EED,
+   0x0000017F,
+   0x6AA5F7A3, 0x5703727D, 0x09DA94A2, 0xD9C33512, 0xADDCCFD6, 0x80572F9E, 0x45FEBCC1, 0xF95BF8B0,
+   0x30A48DAC, 0x4BCD4B12, 0xF00F8619, 0x32A16A21, 0x1BCAD341, 0x612D82B9, 0xE2BABC4A, 0xF42138DA,
+   0x0000014B,
+   0x1510E086, 0x7E9364EA, 0x31D0F679, 0x524B63B1, 0x9AEAE146, 0xF8F3CC52, 0x36F90818, 0x8C05C88D,
+   0x80D7DAB5, 0x16ED75E5, 0x54000C49, 0x8F872700, 0x843C5F7A, 0x9740A2A1, 0x6E680411, 0x8DC46AC5,
+   0x000000D8,
+   0xBAC1FCBC, 0x9492A1D6, 0x8A9CA207, 0xCD7CD811, 0xCDED0753, 0xD61403A1, 0x6702B3FA, 0x2D232E49,
+   0x83E33229, 0x5BD01FC9, 0x4DBE98F9, 0x157C427C, 0x1C5B4229, 0xD2594A9F, 0xE6318047, 0xE0207B85,
+   0x000001F5,
+   0x71AAEF75, 0x6BF98381, 0xC14B076A, 0x479CC2A8, 0xCC783DC5, 0xC0466EC4, 0x682E48F9, 0x7F120DA2,
+   0x4A4ED12F, 0xE02258AC, 0x83DA05ED, 0x8D8AB9B9, 0x394701B0, 0xB1B1EC54, 0x82D2C76E, 0x8FC99926,
+   0x00000079,
+   0x96C5465A, 0x0A611BF4, 0x74F20F8F, 0xD0A6B210, 0xB7200111, 0x2178F283, 0x48705A27, 0xBD71855C,
+   0xE797AA46, 0x204B17EB, 0x1A418C95, 0x8200553C, 0x7C5363E9, 0x0AC39A6A, 0x38E587EC, 0x41E58BA1,
+   0x00000092,
+   0xD580C2BF, 0x7A1128D3, 0x33CB48FF, 0x54CB80B9, 0x124988A8, 0x12E00E24, 0x8973B0B6, 0x2E41BD3E,
+   0x0729F811, 0x81F9B249, 0x0B26F7D0, 0x82B1E837, 0x453D977E, 0x66102520, 0x76AF2FF3, 0x86404FBF,
+   0x00000122,
+   0xDA706520, 0x935EED87, 0x72990FDC, 0x35AEFF20, 0x75F99B1D, 0xF65CFB16, 0x8369D686, 0x0E6D254D,
+   0x0882827E, 0xC3493C5E, 0x4F166119, 0xA0EDF2DA, 0x59363A25, 0x7638D201, 0x76088E6B, 0xECE18042,
+   0x00000138,
+   0xF8913CC2, 0x02FB999B, 0xC961F4D7, 0x81688347, 0x8D0435C3, 0xD54C91F7, 0x990E6AB3, 0xCBD0BCCA,
+   0xD848398A, 0x3C8BCE08, 0xD5370ED6, 0x83F3F979, 0x74FD3AC3, 0x7449BBD2, 0x4E73CFAA, 0xE6145DB8,
+   0x0000015E,
+   0x58044777, 0x8A435E24, 0x937E7687, 0x29B9D279, 0xE44D2874, 0x42C2E303, 0x9845F55F, 0xFDE623CA,
+   0x2FA1BC3E, 0x752C258F, 0xCE8A096A, 0x198DB2B3, 0x6F2EC50F, 0x59B5361B, 0x1A2AA43F, 0x5A4F209C,
+   0x0000014A,
+   0x4F005DA0, 0xFCBB48B5, 0x50CBC0C5, 0x2A8D3120, 0xE9AC811D, 0xB33C1526, 0x586013F2, 0x91E493CE,
+   0x488D1688, 0x99412264, 0x875C45E1, 0x7966C1C1, 0xBE0D5B72, 0x9DBC86D2, 0x1553D029, 0x63A83498,
+   0x00000068,
+   0x9D44055B, 0x184F3300, 0xD232A2F5, 0xADBEC2BB, 0x5A2A5EB5, 0x4E0B32A8, 0xE3535F4C, 0x938D776C,
+   0x0F169CF8, 0xD2591A1A, 0xE7A2093D, 0x8DCA29F4, 0x145F902B, 0xB8746330, 0xFE2CEBEC, 0x816D6F86,
+   0x00000068,
+   0x2A7FABD6, 0x5B774088, 0x826F236E, 0x0911E7F0, 0x84F0BBD3, 0xBC4D014C, 0x2E000C1A, 0x0B8BCD8F,
+   0x2DDEB721, 0xD5FF7778, 0x7EF826A9, 0x0F7A76F9, 0x644D2F94, 0x031CE26F, 0x78FDC7ED, 0x1EAFDC82,
+   0x000001E2,
+   0xA60BC2A1, 0x16BF1952, 0x3DD7DCD5, 0x2CE4110C, 0x78E260C3, 0x3DF02BF1, 0x3944B29C, 0x132208C2,
+   0x59682E01, 0x13ADD246, 0x133B08C5, 0x87922B46, 0x51C7AEA4, 0x5B3E4932, 0x9380BDFF, 0x9E77C83B,
+   0x000000E0,
+   0x54746586, 0x3CE44040, 0x31E2CB31, 0x5260F1BE, 0x1C0A1DC6, 0x802E6890, 0xF84363BB, 0x5E9AAEA8,
+   0x4CCCCA39, 0xFFD8A962, 0xFA9EF6E4, 0xE12A8BE6, 0x31BE868F, 0x85338185, 0xA23A3B36, 0x25878406,
+   0x0000003C,
+   0x96E54499, 0x14827414, 0x8E050034, 0xA0732F96, 0x467CADC7, 0x1C6FA676, 0x98D6927C, 0xA63BA10C,
+   0xDCC2500F, 0x58CB6F96, 0xEA4FD9C5, 0xACCB76D6, 0x30786990, 0xE2A2F59B, 0xD224CCFE, 0xD8B24679,
+   0x000001B2,
+   0xA84D476C, 0xDBE7BC43, 0x0DF0F82F, 0x80C66135, 0x7996B3DD, 0xFDA3915E, 0x5460B6A5, 0xD309856F,
+   0xFB5F2A03, 0xDA60ECFB, 0x87F5C81E, 0xB45421CC, 0x93297E69, 0xE78F50B7, 0x92B7AB1B, 0xB57EF6E0,
+   0x00000020,
+   0xD5A7E947, 0x2FAC246B, 0x3C2C0E9E, 0xA3560F17, 0x99A15EDC, 0x36F3BEA7, 0xF6DF7626, 0x51E0953F,
+   0xE181410F, 0x791FB8F1, 0x065B1CD7, 0x9E592427, 0x6E9A54B5, 0x492C7736, 0xF664EAD5, 0x8F186347,
+   0x000001DE,
+   0xCC9F295B, 0xF8B25DE3, 0xD481F758, 0x6A3A6AFD, 0xD7194DD7, 0x0F362D65, 0x72839C8B, 0xD0706B14,
+   0x86E79D73, 0x863FC677, 0xBD51AA66, 0x7A312DD4, 0xE2FB1520, 0x4F54148B, 0xD3FAFAA8, 0xF819350E,
+   0x000000A5,
+   0xD0BA1319, 0xDADE2B22, 0x0E128DE4, 0xEC0DF712, 0xA47D34B8, 0xBFBB4A30, 0x6C0FE4B4, 0x27A996FE,
+   0xFC390C4C, 0xF37AC376, 0x8F1D9559, 0xA28F1992, 0x7917FB9E, 0x59A81149, 0x24E5BB5E, 0x5658B74F,
+   0x000001C1,
+   0xE090CB47, 0x0B8C54ED, 0xABACC4B9, 0xDDCEF543, 0x6F45D144, 0xAA5D9F95, 0x6D5B0B7D, 0x5829EA88,
+   0x5D9B5A9B, 0xA08415C0, 0x9D469207, 0x0DCDD858, 0xAD47D576, 0x91EF5090, 0xFC9C5403, 0x286B59F7,
+   0x000000A4,
+   0x681A6033, 0x51F28B4E, 0x5586A02D, 0x92C8812F, 0x37F75BE9, 0x65497752, 0xE465AC3D, 0x39ED9C48,
+   0xEA5746A3, 0x52B0558D, 0x2281BF57, 0xB1AD72EA, 0xC29BC5BA, 0xFA48BE23, 0xB11E0B1A, 0x5DDD7E6B,
+   0x00000144,
+   0xDFBF1C5D, 0x6B91BD8F, 0x35CBBE74, 0x29CBC8C5, 0xECA1F1E8, 0xF2BF1BF0, 0x8B74129C, 0x64BC1B61,
+   0xA26DB0BA, 0x5701D92D, 0x629C49B0, 0x3BBBDA1D, 0x628F9CF9, 0x77932B00, 0xE3B93FD6, 0xF4DD2F98,
+   0x0000004E,
+   0xE84D1AA9, 0x50D3F239, 0x80BE7733, 0x76243D29, 0x5F3A7F3E, 0x8F1F1050, 0xFCEF3C41, 0x5B49D4A6,
+   0x15608CF3, 0x97025D37, 0x0ADCFFE2, 0x8CE7FBDA, 0xF8EFC79A, 0xDB4849EC, 0x67855D5B, 0xFE454312,
+   0x00000087,
+   0x643FA4EF, 0xC6D4508A, 0x2F666F82, 0xA54E8CC0, 0x2DC798A4, 0x34A01969, 0x111EBEC5, 0x3B92FC56,
+   0xCE2FEDD7, 0x8F6BDC34, 0x57CC1DC0, 0x9D5D1B75, 0xB8FEF3F8, 0x8019D044, 0xA5F3C3DA, 0x8CB35753,
+   0x00000091,
+   0x1D608111, 0x81975CB9, 0x6D5131E8, 0x423B14C7, 0x9822E028, 0xCD872107, 0x55997E16, 0x3B325E7E,
+   0x77CB3C94, 0x076A9D7A, 0xA0038852, 0xBC1550AA, 0xF47B925F, 0x4F0E3B8E, 0xDAA979F8, 0xEFD3DA16,
+   0x00000117,
+   0x8D320182, 0x39D27F3B, 0x57F13AD2, 0xAF725A25, 0x21F64D54, 0x776680A4, 0x346AD04E, 0x8C76F109,
+   0x02313957, 0x1C57732C, 0x0026D082, 0xD610C412, 0x9F070119, 0xBF2AFD03, 0x0FE119E2, 0xB78AB112,
+   0x00000195,
+   0xDE80E59F, 0x6759CF0F, 0x1C569A55, 0xBC9C518D, 0x6CCC33E7, 0x9EF3AFB2, 0x3B2B65A2, 0x54CD7E1C,
+   0x89020840, 0x056D2549, 0xEA20691F, 0x2B8C3C49, 0xECF9ED3D, 0xDD6F6CAD, 0xCD81C6B2, 0x0287ED9E,
+   0x000001AA,
+   0x0886FCE5, 0x0932A85E, 0x539E0749, 0xF22990FC, 0x9622B480, 0x0900525D, 0x2322A79E, 0xF8159FB8,
+   0x52225E4A, 0x16BC8FBA, 0x3A8B6083, 0x80AED84F, 0x7C8B52D4, 0x0EC2EA9E, 0x8C474025, 0x88586280,
+   0x00000122,
+   0x1FA537FC, 0x7E82B98A, 0xB07AEE91, 0x06814D94, 0x39BBF49E, 0x2ACE89A4, 0x572F35DE, 0x4272B632,
+   0xA6132D49, 0x4AA5EC9C, 0x0AC0CC3E, 0x6DA8505B, 0xF0B72ACE, 0xE50B950F, 0xEB7A6DCB, 0x38D4E07D,
+   0x000000BB
+#else
+   0xC2E5BD66, 0xF97E7E31, 0x856A429B, 0x3348B3C1, 0xA2FFA8DE, 0xFE1DC127, 0xEFE75928, 0xA14B5E77,
+   0x6B4D3DBA, 0xF828AF60, 0x053FB521, 0x9C648139, 0x2395B442, 0x9E3ECB66, 0x0404E9CD, 0x858E06B7,
+   0x000000C6,
+   0x9FD16650, 0x88BE9476, 0xA272C240, 0x353C7086, 0x3FAD0761, 0xC550B901, 0x5EF42640, 0x97EE7299,
+   0x273E662C, 0x17AFBD17, 0x579B4468, 0x98F54449, 0x2C7D1BD9, 0x5C8A5FB4, 0x9A3BC004, 0x39296A78,
+   0x00000118,
+   0xF3D7286A, 0xB4C52F11, 0xBBF67A41, 0xEC47CB5C, 0xAAFB10A4, 0x89D3382E, 0x06222B90, 0x4AFD8768,
+   0xFEB5416D, 0xFA16B295, 0x5D095B7C, 0x0946F9D4, 0xFF975E3D, 0x18526B28, 0xB2F1C609, 0x259CEC2F,
+   0x00000104,
+   0x62E36127, 0x545642A0, 0x1C38E6F5, 0xC3E4C6F7, 0x1BF9D6C4, 0x1D0E02C4, 0x483BA43D, 0x8A7A6FB6,
+   0xCF390B9C, 0x7104AEE9, 0x2578E2FB, 0x4ACDCCDF, 0x73B3FEB4, 0xC17AF6DF, 0x7977FA95, 0x2FB789D7,
+   0x000001D6,
+   0xEB2DB12F, 0xDAE82F27, 0x25444B98, 0x675F5CDB, 0x78288513, 0x3234752E, 0x730F5769, 0x53E37A78,
+   0xDCECD88D, 0xABAD04DA, 0xF3098A34, 0x29D87958, 0x50CB0363, 0x00567F1A, 0x3878A6F6, 0x400B6785,
+   0x00000183,
+   0x22D2D58A, 0xBA3B00C4, 0x7B0E93D5, 0x06C35185, 0x545FA63D, 0x78810249, 0x3A6BE922, 0x1D72E792,
+   0x9E285F6F, 0xE3882791, 0xB33128EF, 0x3212CA84, 0x22ACF93D, 0x41640A10, 0x1F33C6E9, 0xBF181969,
+   0x000001BE,
+   0x40B0A066, 0x0CFA67A6, 0x8057A710, 0xE97C179E, 0x27CCE600, 0xB69D2852, 0x419687D1, 0xF7DDE8C5,
+   0x5D5B039E, 0xDBCB1518, 0xD99ABBE0, 0x3E47772F, 0xB2A9C6A0, 0x71C9C23A, 0x94496951, 0x5AF10B9B,
+   0x00000152,
+   0x2C91F83A, 0x0F96137F, 0x49F15B33, 0x1F743FA4, 0xCCB4C1B1, 0xD43B3EC0, 0xCFEEA9B0, 0x895A3BE3,
+   0x9EEFEE4D, 0x27C3B495, 0x12E344EE, 0xF1B42127, 0xFF929C1E, 0x023AFA76, 0x86D07325, 0x30780976,
+   0x00000166,
+   0xC7B848A0, 0x36005A37, 0xE032CC07, 0xBAC203EE, 0xE4C229C4, 0x8D20246E, 0x7B7F6B06, 0x13B8B0F9,
+   0xE13C7B1D, 0x0223A119, 0x53C2E32A, 0xA91307C0, 0x3536FE07, 0xCE595E9F, 0x8489551D, 0xC2A2EFBC,
+   0x00000019,
+   0x67081AFD, 0xED22E7B4, 0x81DF2676, 0xDA1C5F3C, 0x0AD04DE0, 0x48F40648, 0xF7391873, 0x8D7720D1,
+   0x13448F78, 0x111178CB, 0xEA49E233, 0x39087943, 0x73D8D101, 0x692F712C, 0xF4E7E521, 0xCA20AB46,
+   0x0000005A,
+   0x7AF706C0, 0xFD0C6717, 0x52EBDF4A, 0xC5004165, 0x8FF0BF03, 0x33267570, 0xD2CDCF58, 0x3F282DDD,
+   0xBF766C2F, 0x93B60398, 0x70748A8C, 0x124F1FD9, 0x20EF5BAD, 0x05422ECB, 0x3EAFB2DC, 0x9FEF00A6,
+   0x000001D8,
+   0xE4D1AE24, 0xCD2D1F04, 0xE44BAE9A, 0x099AFD68, 0xA4880B2A, 0x669B9BA3, 0xAB513FCB, 0x5608536C,
+   0x30D8ACE2, 0xFD7DE6A3, 0xEB95E59E, 0xEBC44B8D, 0x64969883, 0x2302405E, 0x9B276F35, 0xBEA96FF0,
+   0x000001B6,
+   0x71B90B8C, 0xA7B7271A, 0xD12CA22A, 0xBDC1BCDA, 0x1F10A310, 0x52A5F290, 0xF420FB28, 0xF5C070C0,
+   0xF099A78F, 0xDD09D3A5, 0x3914E826, 0xAF60CBBE, 0xA914D69F, 0xEAC320C9, 0xFD5BA85D, 0x78BC962D,
+   0x000001C0,
+   0xBE45049D, 0xF69575CE, 0x4958DACC, 0x418D0935, 0x36C0F076, 0x142DA6F2, 0xA83DFCE7, 0x51D23CFB,
+   0x09714D01, 0x2DF04218, 0x9ECEC18D, 0x1260496A, 0xF700B1AD, 0xB4317AA1, 0xCD86C341, 0x86174A20,
+   0x0000016C,
+   0x9102B570, 0xC2453D60, 0x142C3E23, 0x70840E5C, 0xC30037D9, 0x7294B1F1, 0x1DBF5AB6, 0xA2500F12,
+   0xC9C8EE6E, 0x03ECEB67, 0x30820ABB, 0xA19C3193, 0x7DA6B820, 0x7AAD59E8, 0xC38D842F, 0xE97823F8,
+   0x0000006D,
+   0xA7B6BB9E, 0xCE5BB75E, 0x569C9EDD, 0x9090358D, 0x9CD0C065, 0xA8B5EC36, 0xF81C82B8, 0xB2B5AC1C,
+   0x3FFCEB86, 0x8FEB364C, 0xDF4F9F7E, 0x355ED9EC, 0x5CE12FF4, 0x6F2EFE42, 0x0155070D, 0xB2316878,
+   0x00000035,
+   0x478BAB98, 0x5BA6AA8D, 0xBCF097C4, 0x849DDC2D, 0x74B08601, 0x67F6F4B2, 0xE3ACBDAC, 0xB15C438F,
+   0x6EE2C337, 0x0BCD4925, 0xB3085E64, 0xD15FACB9, 0xF4D1B708, 0xC8E919DC, 0xE1FAE449, 0x6EED3E36,
+   0x0000000A,
+   0x84926700, 0x5103486E, 0x8FEF959E, 0x1C6B82B2, 0x55B9FA8D, 0xB309FE23, 0x4B8579EF, 0xDB35D40E,
+   0x8145279A, 0xAD5288E0, 0x4BA26317, 0x92B15DBC, 0xD9838C28, 0xDA42D33E, 0x313A0399, 0xD13AE9BA,
+   0x00000047,
+   0xD0851F6A, 0xE2FA0B39, 0x263539C6, 0x2F7F00E5, 0x1F107130, 0x46A066B8, 0x7DBE9579, 0xE7CC14F8,
+   0xD0607B55, 0x61F1E5C2, 0x07A4C0B8, 0x539A9C4D, 0x9FDC8D6F, 0x9B689382, 0x847245FC, 0x684725A9,
+   0x00000020,
+   0xD9DE1E07, 0x98DD1588, 0x4F6DC491, 0xBE9ED115, 0xF2B85D2B, 0xD4605724, 0x93AA2D3F, 0xF94DA3BA,
+   0x8D489608, 0x81229B61, 0xD9EAF52C, 0xB7E6A31E, 0xAB03E098, 0x787D526D, 0xE5B06C1B, 0xC16EE426,
+   0x00000171,
+   0x2DCD1035, 0xA732FE00, 0xDA1F6EE4, 0x034D6FF8, 0x097D7909, 0x2103D3E5, 0xDFBEC358, 0xCC496507,
+   0xEF335708, 0x27044FAE, 0xFE9BE99A, 0xF685E6BF, 0x06AABABD, 0x57B8C6C4, 0xA901830C, 0xB8E751F6,
+   0x0000011B,
+   0x8E15A6B9, 0x87101FAB, 0x1A270874, 0xF5AD21A1, 0x6E900902, 0x5D9A9050, 0xD7FE9A86, 0x15A2F5A1,
+   0xDCE37DE8, 0x7BA4FB21, 0xFF07BFB9, 0x7751DF45, 0x02345C0B, 0x12089B62, 0x6A9ACE86, 0x46F675EC,
+   0x0000006D,
+   0xA08E3299, 0x689A234B, 0xC4CF87AA, 0x941F6F05, 0x9FFDCB65, 0x3A98121B, 0x1623B72C, 0x3252B848,
+   0xC6BAE311, 0x65F531B5, 0xC383DF2C, 0x4C5005A1, 0x5826C457, 0x13C01179, 0xEE3B03DE, 0x90EA82A2,
+   0x000001D3,
+   0x8C0A1261, 0x582B7925, 0x788BA98E, 0x859C8A11, 0x9A3AD4F7, 0x693C1E14, 0x2D62063C, 0xD3F4B803,
+   0x0DDC5607, 0x6AFFCCFA, 0x1EB6C797, 0x63A3CD82, 0x6FB0C290, 0xA94CE4AE, 0x612CF5D1, 0xCE9479C1,
+   0x00000190,
+   0x78F459E6, 0x4AB1603C, 0x6A84373E, 0x7D9AF2DC, 0x159A9A40, 0x2D2BE036, 0x509C38EC, 0x82371E3D,
+   0x92F079B7, 0x82188BF2, 0x1E82E017, 0xD74B8280, 0x6B59BBFA, 0x4041778A, 0xB8D4F9A7, 0x40CF824A,
+   0x0000005D,
+   0x9BC88C1E, 0xF9F79E72, 0x77E9CEB8, 0x8459190A, 0x6A41A19D, 0xDCB44B72, 0xE243350B, 0xE30DBE8C,
+   0xF3ADEBC1, 0xA168A6A9, 0x48E22F81, 0x421FDB0C, 0x9B601ED1, 0x3CC1D22A, 0xD2B564C0, 0x226EF6F6,
+   0x00000170,
+   0x0A80F0B9, 0x0EEDF715, 0xEB322905, 0x7F78EE5B, 0x83498544, 0x15D53757, 0xB66D249A, 0xFF081204,
+   0x2BD0D1FC, 0xB9543486, 0x1899B952, 0x6404F132, 0xCDD8789C, 0x1DE3AA0C, 0x1A7153A4, 0x8B6F0138,
+   0x000001BE,
+   0xFE536313, 0x12D645E1, 0x373AF74B, 0x14F4969E, 0x30D498CC, 0xA56F032A, 0x0A666B8C, 0xF30E4FE5,
+   0x3FB31A5E, 0xFB42284E, 0xEFBA6B77, 0x065215A7, 0x6FA31B46, 0x217CA76C, 0x1FC38BFD, 0x13A6F6F9,
+   0x00000007,
+   0x78303DC6, 0x51411810, 0xE01C1D96, 0x93D1836D, 0xF50B037B, 0x98046C2F, 0xFCD53E6C, 0xEB3A5B31,
+   0xFB2F8250, 0x3976F8FE, 0x9CDA2685, 0xD193F536, 0xD26EE74C, 0xC609817D, 0x58F903D3, 0xEEA22448,
+   0x000000E9,
+   0x8E0C791B, 0xC4F3956B, 0x875C10F4, 0x68CF3903, 0xC1F7F0AD, 0x3FF4A407, 0x8902E832, 0x3672C465,
+   0x96EA88B4, 0xDF5D0B67, 0xA86075A8, 0x68DF74BD, 0x5071E56E, 0xE6D2D067, 0xC7E5FCD5, 0x8C7FB077,
+   0x000001F1,
+   0x35210DF1, 0x1E2DF236, 0x9AACE566, 0x387B5C56, 0xEE401323, 0xDD8152C9, 0x9CAC0076, 0x56FE9EC9,
+   0xE1A9F782, 0x88ED7FC1, 0x681F0428, 0x6551487D, 0x97689006, 0xEAACC101, 0x3B7E7FE6, 0x626BCAD1,
+   0x0000015E,
+   0x7ACB23CA, 0xE1B3574A, 0x3636A1C2, 0xADDA7C9E, 0x9F3D947C, 0xFC998CF8, 0x1BA0511B, 0x38EE4DF4,
+   0x03E4694B, 0x1F40CC14, 0x800FB6D9, 0xCCECF4E0, 0xE1665D06, 0x021F708A, 0xC492D329, 0x2BCD7975,
+   0x00000063,
+   0xCD698697, 0x66BD9A0D, 0xBBBC1758, 0x0E7D8559, 0xAC76A88D, 0xE072A980, 0xE2C17874, 0x3CF9AF4D,
+   0x748E97AD, 0x85B24BC4, 0xF3F6D8EA, 0xE5522FAF, 0xCEF45795, 0x60ED43EE, 0xDE38467D, 0x1859FD20,
+   0x000001D7,
+   0x58E8181C, 0xE62C76B9, 0xFEE454ED, 0x3731BCC7, 0xEE89F8F5, 0x2CB0B570, 0x9A262283, 0x0A38B953,
+   0x8C19A774, 0x46887E74, 0xE80ADAB4, 0x1DBEA5DA, 0xB1F75C90, 0x09FB720C, 0xE723E278, 0x91E0B746,
+   0x000001C5,
+   0x1BAC59F3, 0x6FA72277, 0x520791AD, 0x72358865, 0xE32463D8, 0x8DA1C8C4, 0xD41001A5, 0xE0E75863,
+   0x48E602DB, 0xCEA164F7, 0xCC294CFE, 0x93CB5F21, 0x941CBEFA, 0x28A3168A, 0xAB807177, 0x018FFF3B,
+   0x000001E0,
+   0x6A145377, 0x3DA70934, 0xD16E2B7C, 0x1FB17F7F, 0xC0469077, 0xEF6432FC, 0xD6660F5E, 0x62A59A97,
+   0x5E2A0275, 0x8DDC7550, 0x5B88DCE7, 0x2E65B1F7, 0x066F2C44, 0x0F4283DA, 0xCE4B84A2, 0x561B9E15,
+   0x000000CE,
+   0xBDBC363A, 0x728E1148, 0xF7A1BBAB, 0xDFBF9E0B, 0xA2E12868, 0xD6FCFC8F, 0x0A19FE81, 0x3969E7E5,
+   0xF512CD5E, 0xF104D3BE, 0x810DA8F5, 0x9879C459, 0x924BF3A3, 0xAD31C365, 0x4D4FB575, 0xB2E2D491,
+   0x00000151,
+   0x79410972, 0x330D4D1D, 0xBA1831BB, 0x7E6EF2A0, 0x4F4D5B93, 0xA18CC9AF, 0x069C9948, 0x29D8DE68,
+   0xB5E104A0, 0xB8BC009D, 0x8D929561, 0x4237D372, 0xA2274BAB, 0xA126A4E8, 0xA99C454F, 0x85BA9FCB,
+   0x000000CB,
+   0xE18BD1D3, 0x954376CE, 0x9C8E4D95, 0x350613FC, 0x73323968, 0xA60D5956, 0xA044CDBC, 0x4F6AC836,
+   0x881B8E40, 0xF38D747B, 0x0426AFE2, 0x79F7FAF0, 0x2AE12787, 0xF6E7403D, 0x726AE667, 0x721445A6,
+   0x00000141,
+   0x306787CB, 0x9E0D2F66, 0xFCE146F5, 0xE2E3C834, 0x2FDBE2B4, 0x4B62143F, 0x5ACB5238, 0x19DAB774,
+   0x7E138359, 0xEE46BFCD, 0x75966B0F, 0x29DBFA66, 0x2D601936, 0xCDE19C03, 0xF2AA4F6F, 0xF7DAF7B4,
+   0x0000019C,
+   0x641B7E08, 0x55A5E8F4, 0xCAA920F7, 0xE1E589F3, 0xABFCED83, 0x07B90AD9, 0x7C466F08, 0x05FF78CD,
+   0x5A71AB69, 0x2020AB94, 0x87EE2EC2, 0xD3AD1F57, 0xFB3D4C91, 0x078BA17E, 0x8607CF69, 0xCF3753BA,
+   0x00000138,
+   0xB9B22600, 0xB5E391E2, 0x8454C979, 0xD20B3D08, 0x2F77A85D, 0x4C994564, 0x1F169687, 0x972896DB,
+   0xFF8D2B83, 0xD3554FA2, 0xBD48E671, 0x57123D99, 0xDA59843F, 0x1266B6B9, 0x9241786D, 0x633FF4DF,
+   0x0000011F,
+   0xA1E06F89, 0x071492BB, 0x734CC62A, 0x6F3F72DE, 0x9D477637, 0xB50A1130, 0xA5CE54F0, 0x5F6B0546,
+   0x698626ED, 0xC1CDE769, 0x64ADE3D0, 0xE43AF795, 0x97A20D2B, 0x30671617, 0x8C48495B, 0xDF582167,
+   0x00000129,
+   0x4790D91F, 0x544A6528, 0x3F2924BD, 0xF71C9098, 0x3E5C39E1, 0xD5ADB1D6, 0xD8CACD81, 0xEBA20528,
+   0xC728E735, 0xAC72518A, 0x565CC9A0, 0x789A0BDF, 0xC922BCE2, 0x4B320C80, 0xE458F8AD, 0x99B26C84,
+   0x00000138,
+   0x4F6F867E, 0x2FDF67BF, 0x5F1E2BF2, 0x56F6EA00, 0x896AB990, 0xA7D7C0D8, 0x23329ACB, 0x589102A0,
+   0x156A7F42, 0xBB8B6A64, 0x5882578A, 0xFBB556A9, 0x609250DD, 0xA82481CC, 0xDAAD3D36, 0x573E51D9,
+   0x0000005D,
+   0xB08FFEEC, 0x7E2EDE0B, 0xEFBED279, 0xA37176AC, 0x0B72E855, 0x5ACAFEAC, 0xFCC75BAD, 0x4C7C3CE3,
+   0xB9A704A1, 0x2FC0939B, 0x8E4B4841, 0x6BF0C532, 0xC10742B0, 0x5B72F1F2, 0x9C54371E, 0xAA62D288,
+   0x000001C1,
+   0xC7D40B83, 0xD3A8C547, 0x85002A83, 0xD9FD1102, 0x97F61840, 0x4BD9516C, 0x448C4851, 0x8C628537,
+   0xC90925AD, 0x5CAE5AA1, 0x72319740, 0x356195C5, 0xA2B5BE38, 0x8CB6E19B, 0x6D9C8C33, 0x68626A4B,
+   0x000001C5,
+   0xED58B48C, 0xA0C846A9, 0xE2590D05, 0xEBE6013A, 0xDA2FC481, 0x60C5D677, 0x9252E895, 0xB6A0897B,
+   0x218BF72D, 0xB84595BE, 0x0DD1B9B1, 0xF1C52796, 0x6D38442A, 0x3F1583A8, 0xC4DE5FDF, 0xCDA593DE,
+   0x0000010A,
+   0x898A19C2, 0xDB0FA258, 0x974CCC01, 0x26346630, 0x1F1E6A83, 0x135EC9DB, 0xFF494D1B, 0x9BAC9C9B,
+   0xF24BE4D7, 0x78D21AD4, 0x61E8DACD, 0x3249C89F, 0x2DF2CB51, 0x528DF685, 0x2CCDC5B7, 0x4F0EC679,
+   0x000001DB,
+   0x0F551D73, 0x789F22F8, 0xE7BA5676, 0x42EC3257, 0x4CC69A65, 0x3F52C409, 0xF46F1EB6, 0xAFDD277D,
+   0xEC161194, 0xAEAD8379, 0x1F924E46, 0xDC657D19, 0x1578FF09, 0xE4326345, 0x78D091BF, 0x4750DA58,
+   0x00000173,
+   0x83FE19B9, 0xDF886F22, 0x5DBA4F8E, 0x74058688, 0xA13F8DC7, 0x3C04AF37, 0x3B99DCBC, 0x21771E2B,
+   0x55C5B6A7, 0x1E77950D, 0x1B1338E1, 0x20A6975B, 0xD276D114, 0x4956E06B, 0xB0D3B14C, 0x56686808,
+   0x0000016C,
+   0x5182063F, 0x08F3F2A2, 0x75992149, 0xDEA422B7, 0xD5CD158C, 0x845260B0, 0x7C353C5A, 0x6E0768E0,
+   0x3AFA81CA, 0x5718A1C2, 0x3CA2A17C, 0x522F094D, 0x7D93EBFD, 0x96A361F7, 0x95C76942, 0x75C32DB5,
+   0x00000095,
+   0xF640DE23, 0x953BB441, 0xE1E08DC6, 0x5D35F0A9, 0x7BBAD4E6, 0x323A1BCC, 0x742E5AD0, 0x4DC31447,
+   0x068BF07D, 0xCA0E8E15, 0x97EBD2B5, 0xFC317D50, 0xDB4C9342, 0xF5447997, 0x0BA0A29C, 0xF98A3AC8,
+   0x00000061,
+   0x9E925079, 0x4CCB1F24, 0xC5C916D3, 0x97AF5A3D, 0xE497E318, 0x7EF650A8, 0x42975745, 0x0D499278,
+   0x2462EBA5, 0xCF328FFB, 0x6E360CF3, 0x8EE8E88F, 0xC77CD3C2, 0xE15C3F8D, 0x736A646A, 0x5AB87910,
+   0x000001CB,
+   0x81E3D610, 0xA2D5FDB9, 0x456DDF1C, 0x0127B05C, 0xBD5BD8A4, 0x29E247D9, 0xF5959D68, 0x5758D126,
+   0x2B28EB19, 0x9B0FB7FB, 0x1D312140, 0x1D8AA23A, 0x281B4D2C, 0xF8B9E467, 0xDA959B8F, 0xEA57464C,
+   0x00000028,
+   0xA87D4633, 0x8E118540, 0x15200B8C, 0x3AF88A08, 0x88F790E1, 0xCA1806B4, 0x19CD9554, 0x605032A9,
+   0x67D0CEFD, 0xF6716278, 0xD1676085, 0xB58E8671, 0x08DECF4C, 0x51098DC3, 0xA50E312D, 0x5A6CB932,
+   0x000001FB,
+   0xA5EFF951, 0xA15C4A20, 0x49F4F32F, 0x1BAA735B, 0x0FEAF2C6, 0xAB53AD00, 0xED66B803, 0x354C2BC4,
+   0x9AC12F3A, 0x587FD237, 0x3881A729, 0x3837C964, 0x9F6C3BBE, 0x1D8BD95B, 0x08D914B6, 0x237ED2D8,
+   0x0000001C,
+   0x3DE67115, 0xCDE7B0D1, 0xEC23815B, 0xE645422D, 0x6B445B51, 0x28670389, 0x80AE2784, 0x11BE335A,
+   0x1A64B6E3, 0x9185D3DF, 0xBA228C67, 0xA0CCBDD0, 0x3A013CF7, 0x6BC79DFF, 0xB464C70C, 0x229F4E59,
+   0x00000185,
+   0x1CF1A11F, 0x3F621DE5, 0x0658152D, 0x18B004FD, 0x5DF479B5, 0x1BC8A945, 0x3DA586AC, 0x90171947,
+   0xAA2F052F, 0x06FE325B, 0xB6323A69, 0x4A2FC982, 0xD4F0B34C, 0xA975E8BC, 0x14ED1D56, 0xFE3F2719,
+   0x0000001F,
+   0x92F826D9, 0xEB6045D1, 0x5FACF02F, 0xBD7C962E, 0x35FA1278, 0x87A5CFBD, 0xDEDA7159, 0xFD1FF1CB,
+   0xA1287202, 0x1B0F6638, 0xE1FCD5DE, 0x861E7CBA, 0xB9822A98, 0x33709B6B, 0x8B2AE55D, 0x171B15BA,
+   0x00000130,
+   0x410A34A1, 0xB7F2A894, 0xF0E4D4F6, 0xCA6D4597, 0x6D4D1F8F, 0x84C4A0FE, 0x405C281D, 0x42D465BB,
+   0x3587A898, 0x44893A20, 0xAB4FFDD6, 0xC0D0D12D, 0xFC00E886, 0xD5F85269, 0xE1999AE1, 0xD93F9CDC,
+   0x00000199,
+   0xD9980812, 0xA9D573CA, 0xA7E02CB9, 0x87D7913E, 0x54B00468, 0xB772F409, 0xCC28EEC8, 0x207850E8,
+   0x7603910D, 0x772468DB, 0xB256E07A, 0xB5D3125D, 0x8B59420D, 0xBEB567DF, 0x31E5CCD1, 0xB3467A53,
+   0x000001DA,
+   0x85F45EDD, 0x3A44DDE0, 0x98309156, 0xC543BB64, 0x7597D0D0, 0x82D1CE82, 0x8106CA3E, 0xB2DC0F22,
+   0x2C3A313A, 0x66F39447, 0xA6CF2E03, 0xD8F6FCDA, 0x9E6BF40B, 0xED6E0E27, 0x5B9A41AF, 0x7DCD3A30,
+   0x00000095,
+   0x12BE5B78, 0x0A870CEC, 0x1406E140, 0x912C21C5, 0xD5E13CA1, 0x977417FD, 0xB9E21E28, 0x9EDBAE8A,
+   0x13B2F069, 0x9FCE45EA, 0x84F3CBF2, 0x25BD760B, 0x2489FD01, 0x29E0C3CE, 0xEC62A766, 0xE16D31C1,
+   0x00000061,
+   0xB5598DCC, 0xAFF40F1B, 0x2CD12FD9, 0xEF04D8E0, 0xBAD7F4AC, 0xC97EA3B0, 0x565108CD, 0x336776A6,
+   0xFE63178C, 0x71D9D056, 0x14C3F6AA, 0x31A7C547, 0xF6804C72, 0x5DA757A2, 0xF87BB311, 0x7B3EE12F,
+   0x000001FA,
+   0x6BF9F426, 0x30DF907B, 0x62EF821F, 0xCA534CA1, 0x017699E6, 0x540F8DBA, 0x7358F4AF, 0x7CDDFE56,
+   0xE8F9CEF6, 0x5BC334A1, 0x6ADC5F09, 0x427FD83D, 0xB851F4C2, 0x2FD7C1B8, 0xD1587DAE, 0x234D1BD4,
+   0x000000D3,
+   0x0399F8CC, 0xFFEF7D4F, 0x9DA4C3FA, 0x1E2708D9, 0xA9474303, 0x5792EBD0, 0x6812A436, 0x21AA73F5,
+   0xC052973D, 0xF61F60FB, 0xFC874833, 0x7061BE89, 0x2638329D, 0xE65C7EBE, 0x032852D9, 0xE728D78B,
+   0x000001E5,
+   0x27C9F6A6, 0xB633DF4E, 0xCC406457, 0xDEA08843, 0x3CB011BC, 0x75F68818, 0xD5603044, 0x234D1B4A,
+   0xB6A4D089, 0x2A156AE5, 0x95E9F0F1, 0x9021AF3B, 0x968BE7D3, 0x90E987DF, 0x781EF8AB, 0x0821A4D3,
+   0x00000027,
+   0x00DF95B9, 0x94DE21D8, 0xC33C47F7, 0x5D5301B2, 0x2343171E, 0xF271CABD, 0x4F0FBA70, 0xBE5441DC,
+   0x702639D6, 0x11183253, 0x97074632, 0x01E0573A, 0xCE4F92D6, 0x268025DF, 0x039A6F5B, 0x47D14B05,
+   0x0000015D,
+   0x30720125, 0x20511790, 0x6541FB74, 0xEE2DB45C, 0xAACDCD66, 0x07BBCC41, 0x0A08CED4, 0xFFA2E963,
+   0x7F21A83D, 0x819B5B7A, 0x44896B10, 0x5F857F0A, 0x197CDE7D, 0x6126655C, 0x2962ACD7, 0x81D0F14A,
+   0x00000138,
+   0xBB82FC5D, 0x0B7A0B9E, 0x4FF667A2, 0x7F2E7AF1, 0x07A17AEC, 0x5CC3DF39, 0x398FB92A, 0x91465AF2,
+   0x98CF002E, 0x785B7490, 0x7380CFB0, 0xFE22218F, 0x7F4F03A8, 0x32BD1799, 0x1209F39A, 0x1C78BD79,
+   0x000000E4,
+   0xE8B69225, 0x90389734, 0xFC69C2F9, 0x26DC02B5, 0xFF349339, 0x37EEEA93, 0xC05EC9E4, 0x642556BF,
+   0x4BD93EF1, 0xAA5744B6, 0xBFE9D602, 0xC29F3C91, 0xAEA4F871, 0x399CBF01, 0xF485B047, 0xC02B2B1C,
+   0x000000BE,
+   0x87400032, 0x5658A9EB, 0xFF0B51AF, 0xB3513556, 0x9408AC7B, 0x99ECDA71, 0x7BC54D5F, 0x5E8D8B31,
+   0x3EF10515, 0x8F178F9E, 0x624B9CF0, 0xFC49AD94, 0x8FC6C90F, 0x344433FD, 0x7F17965F, 0x0DF7BE42,
+   0x000000D4,
+   0x133929FB, 0x47918D08, 0x2FF979F6, 0xD6CF0AA9, 0xA37A87AB, 0xAD55AB19, 0xC5010BE8, 0x9E9D1956,
+   0x3B82DE19, 0x8C0BD3EA, 0xF3C76B65, 0x6C87820F, 0xF2232ED8, 0x70499D39, 0x7AAFDE31, 0x70DAB0EE,
+   0x00000163,
+   0x81D6751D, 0x5BA4B100, 0xB96A5495, 0xEB0319DC, 0x654729D3, 0x56407C25, 0x9330D3FC, 0x3DE52019,
+   0x28998BC4, 0xB3F8A00E, 0x77DDD518, 0xEEEA2209, 0xCB758F5E, 0xC1429A49, 0x71834361, 0xA86982A2,
+   0x00000040,
+   0xC36A0150, 0x7472FD7A, 0x0138D406, 0xFB61AB94, 0xB30829F5, 0x0CEF5DD5, 0xAEF599F4, 0xA8EA3257,
+   0x7FA063BC, 0x593011DF, 0xD774CB2C, 0xEA4C19CE, 0xB85E8883, 0xAD0EEEE6, 0x2ABA018B, 0xB5EF126B,
+   0x0000014D,
+   0x502A4E76, 0xEBC08EFD, 0x767C0F52, 0x4589D863, 0x4EB92DEC, 0xCF85EEF4, 0x965C95C1, 0x0B59AA5D,
+   0x68D2DBCA, 0x60945A8E, 0x77BF02D9, 0xC94CB99F, 0xCFC0DC2D, 0x6CC41E81, 0x8637CC2B, 0x7264E2DC,
+   0x000000D5,
+   0x59B1302C, 0x28989D20, 0xF89D0C77, 0xBA90DC20, 0xE7F4A0B1, 0xA29E9C3E, 0xB0A225B5, 0x332ECD54,
+   0xB042D9EA, 0x38A3B080, 0x8D9DFE9F, 0x6D27FF40, 0x88A69D3A, 0x146F8B3A, 0x1FEE39B6, 0x634FB13F,
+   0x00000031,
+   0xF76D4173, 0x2CD49AF1, 0xA89ACEF1, 0x269B00CE, 0xA015990B, 0xB60E2977, 0x85F72CEF, 0xBE864996,
+   0x4D5B0156, 0x4E23B9DB, 0x6BB926BA, 0xFA92C71C, 0xE2F815B2, 0xF4A8FF2F, 0xA5CD2E72, 0x543EEE4A,
+   0x0000003A,
+   0xECB67B4B, 0x9CF75FB5, 0x91A51DBC, 0x01320190, 0x77225C2B, 0x0557FCD3, 0xEEC94860, 0xE2E69807,
+   0xE6C35624, 0x58CCAE9F, 0xE8C2FF7C, 0xECA667A6, 0xA37B64A3, 0xF6939F23, 0x0D225B40, 0x2EAABBB7,
+   0x000001E7,
+   0xFF9ED76D, 0x036735D2, 0x5D154FCA, 0x8653E8E3, 0x9824F792, 0x6811CBA2, 0xE1252E06, 0x96A3C594,
+   0xBA6E82E0, 0xB02543E7, 0x49B46518, 0x54351873, 0x62BC5B59, 0xB7C14C86, 0xA295F29B, 0x6535A2BB,
+   0x000000BF,
+   0xB0625972, 0xD8B41E4B, 0xB0CE550D, 0x1063BA69, 0xDB86696E, 0x64687D34, 0x55CA06DA, 0xBA2B3644,
+   0x3DC4D46C, 0xA4699ECD, 0xBFE4443F, 0x9F40E631, 0x75FA4F7E, 0x0E97FBE3, 0x1CBDC008, 0xD026B048,
+   0x000001D2,
+   0xD75CF083, 0x042191FA, 0x9BD72C49, 0xAFFC0840, 0x67FAF055, 0x8F5B9E3F, 0xC9794F77, 0xA99FA2DF,
+   0xA9EF6764, 0x1CCBE885, 0x6880EB3C, 0x5FD1E3D6, 0x06FD7BFA, 0xBEF622BE, 0x9B10C7F8, 0x80D418FE,
+   0x000001A9,
+   0x18148FCE, 0x66377320, 0x45C2A46F, 0x9655F8B3, 0x8CAF763D, 0xDC295240, 0x2816A721, 0x4313D4B7,
+   0x50DA95ED, 0x6FF4AA0A, 0xD4F9E551, 0x66CBCAD2, 0xE6993438, 0x0FF11D35, 0xB9A4F5F1, 0x93DAB445,
+   0x000000B4,
+   0xFA327B1C, 0x8E846DF2, 0x1D0321A0, 0x6755220D, 0x0342F918, 0xBACBC29C, 0xD996A1F8, 0xBE6F119D,
+   0xEB5740FF, 0x11C02D40, 0x4FBB962F, 0x28A8232F, 0x2185293A, 0x066250A5, 0xCF927DC9, 0xF9220C87,
+   0x000001C9,
+   0x32A50E5A, 0xD59CDF5B, 0x2C379627, 0xA1303588, 0xFF69B440, 0x0894C6EB, 0xAD6055C9, 0x881458AA,
+   0xB2F2FF3C, 0x27D9A7D5, 0xD254AE2D, 0x15F33160, 0xE38392BB, 0x6E8342F1, 0xB7C8D249, 0x7D7F4576,
+   0x00000104,
+   0x774512BF, 0xD63C86D1, 0x624719E4, 0x1524C2D8, 0x86D00E48, 0x2F7568D4, 0xCB9CF033, 0x02140D74,
+   0x0CAE0CCE, 0x3FFF92DD, 0x13941889, 0x7EC60686, 0x5B8BF2B0, 0x791633AC, 0xCA54EA3D, 0x43C98854,
+   0x00000027,
+   0xE40EB5E3, 0x15A79B14, 0x5EEB2285, 0xCCBBB5C7, 0x5686232D, 0xC67C8DFF, 0xA83196EF, 0x8B45A2C1,
+   0x9B2ACFB3, 0xA274BF93, 0x6E56B741, 0x35C2B548, 0x4C1F5672, 0xC93963B2, 0xDF0E741B, 0xBE9D6F8E,
+   0x000001CA,
+   0xFBA4114A, 0xC8BC017A, 0x8D7327CD, 0x8E279102, 0xDDF662A4, 0xB95BFA6B, 0x44A2CAEF, 0xD828F02C,
+   0xA27AF13C, 0xC6504C42, 0x503E832D, 0x67F79CAB, 0xCB78ED1D, 0x42DA6976, 0x431E01DB, 0xDA6E4727,
+   0x00000094,
+   0xB9544FD3, 0x44D5BD3E, 0x694035C9, 0x329D747F, 0x676F065A, 0x104D2B68, 0xFC4165C6, 0xC8E81E7C,
+   0xAF3779F2, 0x4CDAD2FD, 0x5669A833, 0xA3E4A462, 0x21737142, 0xA281178A, 0x7B8F5514, 0x86F7AFB8,
+   0x000001AA,
+   0x4DEACC7C, 0x407A7013, 0x94FAF272, 0xA2540E3C, 0x34B43FA8, 0x4246BEB9, 0x3BA9F184, 0x157B03F4,
+   0xB939BA99, 0xF7898D60, 0x3A5F62B4, 0x0F7E245E, 0xEAF7A575, 0x2DB5A341, 0x1278C0F7, 0xD3ADEA09,
+   0x000000D2,
+   0xDA687094, 0x2CBA440A, 0x767E75D2, 0x3B478947, 0x078F23A0, 0x07C7DE48, 0xD7252108, 0xCA6D86D8,
+   0x6A7FBE1A, 0x5FD954FC, 0xC9A2A901, 0x4D552BBE, 0x59E75804, 0x71AB2701, 0x5413091C, 0x294298FA,
+   0x00000149,
+   0xBEBDD14B, 0x6E60BC8C, 0x8C57A662, 0xFE195CAE, 0xD9E4437A, 0x41E77BD8, 0x85E4B9ED, 0x20FC2E7C,
+   0x2A012E02, 0x97BE566D, 0x9B250C6A, 0x433786AE, 0xCBB3224A, 0x9EB76699, 0xF090F756, 0xF727091B,
+   0x000000C8,
+   0xEF08161C, 0x31496439, 0x97E3A008, 0x265407A9, 0x00E2FFCD, 0x20882107, 0x5359FD16, 0x27426C05,
+   0x5C39F78F, 0x03E83682, 0xE2A8832E, 0x380743A8, 0x792BAFE6, 0x8739D8ED, 0x7A912015, 0x6CEF07C4,
+   0x00000128,
+   0x0FD83ACC, 0xF2978009, 0x630645DB, 0x247593DF, 0x9E2DB252, 0x171E6B9F, 0xC30AEC58, 0x3A6342A3,
+   0xFDD7151C, 0x23524040, 0x8B15FEE7, 0x2589B698, 0x17DCA917, 0xCA588F0A, 0x677CAD49, 0xB2CF2FE7,
+   0x000001DC,
+   0xC8573626, 0x14332D38, 0x4ADEDD4D, 0xD4FE66FD, 0xBB83B706, 0xC5D8F397, 0x3AA8A4C9, 0x00AACEE4,
+   0x107C81A9, 0xE90383FF, 0x18ABDF47, 0x6CF1FB2F, 0xF17C55BA, 0x9BF5444D, 0x3659322A, 0x8251EC25,
+   0x000001DE,
+   0xAA2F106A, 0x5A0E940C, 0x418781B7, 0x7C55EB23, 0x79CC53B8, 0xCC6CEBB6, 0x9D7377F4, 0x7F6F64FC,
+   0x6DE3403C, 0x1571161C, 0xFF1BF45A, 0xD7A52F1C, 0x110B0E06, 0xAF938DF4, 0x6F64C558, 0x9BF21924,
+   0x0000001C,
+   0xA5AFB352, 0xE15E4F0E, 0xF2CA770F, 0x9FF6C56D, 0x338E1890, 0xE0E86C68, 0x90808BFC, 0x96907F19,
+   0x686B805B, 0xD0D47DE2, 0xB367C12A, 0x2FBFCB72, 0x1DD3D54F, 0x800A5814, 0x98657A79, 0x2F4B07B3,
+   0x000001F3,
+   0xF31CB1DA, 0x3340FB54, 0xE1752360, 0xC1E88317, 0x121667B1, 0x183AE7F8, 0xBFD7BAE9, 0x1F271FA2,
+   0x2B745D3D, 0xB31175B9, 0x40B13E3E, 0x22250CC5, 0x0D01026F, 0x63AABBB7, 0xB428CD91, 0xAB63C0F1,
+   0x00000018,
+   0x988D425A, 0x7435EAF9, 0xFCC441F4, 0xF9F323C7, 0x3E4DE08E, 0x8DE16B8C, 0xE495B0F0, 0x2E603853,
+   0x4B3F0024, 0x20460220, 0xB43CDB09, 0x8AFF3F40, 0x4D00E185, 0x409DF7AF, 0xF1637F16, 0xC681D091,
+   0x0000019F,
+   0x5F0F872A, 0x0801A2CF, 0x6EC8C90C, 0x67A58735, 0xA0913E94, 0xF21E24AB, 0x3502BCB9, 0x985FC170,
+   0x50A05926, 0x85528004, 0x426E56F8, 0x65918C8F, 0xA5CBA2AC, 0x382414DE, 0x2874CB00, 0xC3E7A7E6,
+   0x0000005F,
+   0x8FA87335, 0x96630E9E, 0xC7771BC8, 0xDCF938C1, 0xA8CF3CD8, 0xC4F3D77A, 0xC99A5FDD, 0x931AE9AD,
+   0x5E2BCFFC, 0xA89581D5, 0x29758819, 0xD0C7C71F, 0x4D5AA9D8, 0x4EF99563, 0x8F04CDEB, 0xC6DE91CD,
+   0x00000171,
+   0x35C6448E, 0x24B42A1C, 0x1F4E7B86, 0x129A536E, 0x7E48D8F6, 0x7CA12DB8, 0x587D6577, 0xA827ACF3,
+   0xB1CCE77E, 0xFC62BF4B, 0x0F45A823, 0x702EE580, 0xCC7A73A3, 0xB4989843, 0x6C0AFB5B, 0x3D49A232,
+   0x000000A6,
+   0x55086DC5, 0x7055C612, 0x3CF49868, 0x0622AF5A, 0xE695B064, 0x113DC4CB, 0x479FF727, 0x65B33365,
+   0x336BC622, 0x156AB542, 0x3014770D, 0xF5A2EF70, 0x6DED88EE, 0x486F7455, 0x8C8A7452, 0xBB461948,
+   0x0000005A,
+   0x25FDD488, 0xEA6E9911, 0x3D0183B0, 0x4EA556FB, 0x74DC3AC2, 0xE8CFD7C2, 0xDDF1BD8F, 0xE20307A3,
+   0x2EE9BE7B, 0xFC668458, 0x37782071, 0x64A60B79, 0x65ACF2E3, 0x612FC9C8, 0x0DE59326, 0xCBB8C60C,
+   0x0000009C,
+   0x195CAD69, 0x250E6112, 0x1F0B4F39, 0x81CD7E49, 0x61302E46, 0x9B6808DB, 0xB3AF7841, 0xE569C108,
+   0xC15D5FC4, 0x34D86F57, 0xF76AD338, 0xB3E586FD, 0x70BD63A8, 0x6DE8477B, 0x7EC86218, 0xA52B119D,
+   0x000000B6,
+   0x27806255, 0xE51F8ACA, 0x101B2DBC, 0xCB4DA51A, 0xE08B3553, 0x27B8A0DF, 0x6AD56AC8, 0x6E2A0D06,
+   0xEC44486D, 0xA751CBED, 0xC5B2AE67, 0xF574538E, 0x827536E2, 0x64E1E3C3, 0x707A8B39, 0x652FA060,
+   0x00000170,
+   0x684C6E53, 0xE17A85D7, 0x72D0D747, 0xC9574772, 0x58D12EDB, 0xF8928665, 0xC815DB67, 0x7FB212C8,
+   0xF3E66186, 0x44B676EF, 0x998EF4D3, 0x15B57BB3, 0x815C5036, 0xB71F3B8E, 0x73BCB190, 0x3FE97965,
+   0x00000162,
+   0xD5FD84E2, 0x5C7F569A, 0x6FA4BB7C, 0xF84D6E12, 0x82A1081D, 0x7B74629C, 0x0522589E, 0x7935151D,
+   0x5CCF889A, 0x94FB7805, 0x792F6BAC, 0xEC677309, 0xD880A0D8, 0x42FBECE8, 0xB70BE7F5, 0xD97B4881,
+   0x000000E3,
+   0xEDA953E8, 0x85D79261, 0x5DD94926, 0x35894E9B, 0x9AEB12B8, 0x95C1CBC9, 0x1695DC35, 0x017029FE,
+   0xD6B13364, 0x36E2B978, 0xC388CE34, 0xB86B7AFD, 0x1E501E40, 0x2D25B1AF, 0xD5D7E7C1, 0xF9127ABD,
+   0x00000031,
+   0x1BB9A390, 0xA18A458F, 0x2062E5D6, 0x916FC4B6, 0xE16DB823, 0x7040176B, 0x01177EFE, 0x25DE9663,
+   0xB778335C, 0x2B679DDE, 0x862622EB, 0x6ECF1689, 0xCB8A74EB, 0xA191FFB5, 0x019FF743, 0x4CC26680,
+   0x00000047,
+   0x047D9854, 0xFA5B847E, 0x6527D4D7, 0x6151153B, 0x5BDDA4C9, 0xF7272118, 0xF17C7E63, 0xDDE383C5,
+   0x2A82EDB4, 0xC4404039, 0x81853B97, 0xD1355D97, 0xB211C3B0, 0xCB503386, 0x2C17C154, 0x0F9DBD60,
+   0x00000107,
+   0x80A2AA22, 0xC8CD8F5D, 0x64793948, 0xB73C67A1, 0xFF49C73D, 0x55ABAC7F, 0x833E5481, 0xB5BC3DF0,
+   0x384A9287, 0xF6AB8A42, 0xEE4F0BE7, 0xBEA5929E, 0x9619DDBA, 0x2E6BF0F2, 0xB2DDFCBE, 0x224CE58A,
+   0x000001D4,
+   0xAC4906B7, 0x12F87E99, 0x5101C876, 0xE752F6EA, 0x2B668943, 0xA32A9B1F, 0x07950FDF, 0x9E6E6C2B,
+   0xBBB4C324, 0x72A31F91, 0x28546E5F, 0x2E799C7B, 0xA6FF4503, 0x7183A2DA, 0x178FDEEB, 0xE2CB8237,
+   0x00000030,
+   0xBCD89552, 0x140767D0, 0xF10FDF7F, 0x31548634, 0x210355FC, 0x2C4CDCCC, 0x55704A76, 0x49298889,
+   0x0F1D3E5E, 0x7102E882, 0x92691F55, 0x4AFC5882, 0xE9E34260, 0x4CFF09ED, 0x32CD76CC, 0x49D3A329,
+   0x00000063,
+   0xFBDC0C1E, 0x6ADBD32E, 0x0EBEFE86, 0xE3FE998B, 0xBC2A7085, 0x78099D79, 0x5ADEAB44, 0x333C3009,
+   0x07AE4B5F, 0x45E4D96F, 0x9DE88636, 0x4BD1F0D2, 0xBF2020A9, 0x8C7E69D7, 0xC3C5A340, 0x126A5886,
+   0x00000000,
+   0x263F94D8, 0xAED91DC9, 0x20289709, 0x40F3C1CD, 0x60B5C995, 0x74DC1E9B, 0x7D5BB95B, 0xF08CB2A0,
+   0xE642D133, 0xBB6D3339, 0xD2FCC05D, 0x3C3E5D14, 0x403E4A78, 0xCF159316, 0x27C124FA, 0xD84BE527,
+   0x000000D4,
+   0xBCD8501D, 0xBB2246C1, 0xA1600EAD, 0x86D450B3, 0xB626B180, 0x6F5A476D, 0x3511AC45, 0x01F4B93E,
+   0xBBFA9758, 0xD813396B, 0x12347B15, 0xC69B8E75, 0x29CD9E2C, 0x108DEFB6, 0x25E9AC47, 0x4778BB27,
+   0x0000012F,
+   0xEA9F1213, 0x140CE283, 0xAF8D7BC8, 0x2326CE38, 0x914AC8B5, 0x90D21012, 0xE255C0E1, 0x0B07CEA5,
+   0x2DCCCB43, 0x93CC5E97, 0xEE9885EF, 0xB89B14F2, 0xDC56967C, 0xA35AFC40, 0xEE2E3671, 0x8125D749,
+   0x00000101,
+   0x55902052, 0x1855E97A, 0xE6F0DB6C, 0x8A572E69, 0xFCFA3F3C, 0xB1BB6014, 0xF5B2440B, 0xE77EB435,
+   0x2DF3F74A, 0x9045DD30, 0x590EE6E0, 0x7853068B, 0x3B9DDEC5, 0x5714E1F0, 0x86086F6B, 0x9810D775,
+   0x00000008,
+   0xD3A87A30, 0x66E566E3, 0x2CC44C2F, 0x32508176, 0xB80871EE, 0xDCAF7C52, 0xDD245945, 0xDAD02FFB,
+   0xE956CDB7, 0xB9E691AC, 0xC62064E5, 0xDFEFE49F, 0x8C8F2C6D, 0xC322F697, 0xAA88F4AC, 0x68A5D7A8,
+   0x000000DE,
+   0x83AE6C21, 0xEE5555B1, 0x478467B0, 0x895C837C, 0xDD4D105B, 0xE6B06030, 0x7636A759, 0x9D9F3224,
+   0xFB8142DD, 0x68132EA4, 0xFF919487, 0x6109A099, 0x76A1835D, 0x775C37AF, 0x8604A81E, 0x4279A9C4,
+   0x00000093,
+   0x8DF31C84, 0xB7285998, 0xCF37C1C3, 0x0489BF6F, 0xE4C102D7, 0x4CCD18D9, 0xAC3E23C9, 0x8B1D6C45,
+   0x5744D781, 0x7B7D259A, 0xB4778129, 0xA0033649, 0x9FBF3E2C, 0x5C7414D9, 0x20774C25, 0xFA78A7FE,
+   0x00000043,
+   0x8E69FD50, 0x9B46685F, 0x3E47D4DE, 0x2632CF3C, 0x0238FED0, 0x44FD8F9F, 0xE03F169D, 0x2FBC3F42,
+   0xB7DCD132, 0x0C9DF28E, 0x3D18592A, 0x5DEAE7CC, 0x406ADF0B, 0x3034FB93, 0xAE059280, 0xBF5A3A75,
+   0x0000010A,
+   0x34C28CB6, 0x272883FB, 0x5E7D03A4, 0x22B00E9E, 0x7F4602A2, 0x23BBACB9, 0xC248ED06, 0x27564D96,
+   0xD1C5B544, 0x9B7E1CE6, 0x71182E92, 0xB3D77B2D, 0xDE9D46AB, 0xB18E78AA, 0x2E69D74D, 0xDE48D9E1,
+   0x000001FB,
+   0x099EFFAF, 0x8DE62222, 0x1328146C, 0x2212621B, 0x03677FCC, 0x05F3C0B0, 0xFB0FC3C0, 0xF43E4825,
+   0x98536E0B, 0x94D3B336, 0x225481EB, 0x22C1CCA4, 0xA9FCBAF5, 0x2B8668DF, 0xC30E9271, 0x51E858F2,
+   0x000001E9
+#endif
+};
+
+const EcCombTable secp521r1CombTable =
+{
+   //Number of teeth
+   EC_COMB_WIDTH,
+   //Distance between two consecutive teeth
+#if (EC_COMB_WIDTH == 4)
+   131,
+#elif (EC_COMB_WIDTH == 5)
+   105,
+#else
+   87,
+#endif
+   //Length of a coordinate
+   17,
+   //Precomputed points
+   secp521r1CombPoints
+};
+
+#endif
+#endif
+
 #endif
@@ -123,6 +123,15 @@
    #error SECP256R1_SUPPORT parameter is not valid
 #endif
 
+//Dedicated constant-time implementation of the secp256r1 curve
+#ifndef P256_ENGINE_SUPPORT
+   #define P256_ENGINE_SUPPORT DISABLED
+#elif (P256_ENGINE_SUPPORT != ENABLED && P256_ENGINE_SUPPORT != DISABLED)
+   #error P256_ENGINE_SUPPORT parameter is not valid
+#elif (P256_ENGINE_SUPPORT == ENABLED && SECP256R1_SUPPORT == DISABLED)
+   #error P256_ENGINE_SUPPORT requires SECP256R1_SUPPORT
+#endif
+
 //secp384r1 elliptic curve support (NIST P-384)
 #ifndef SECP384R1_SUPPORT
    #define SECP384R1_SUPPORT ENABLED
@@ -221,6 +230,20 @@
    #error ED448_SUPPORT parameter is not valid
 #endif
 
+//Fixed-base comb support
+#ifndef EC_COMB_SUPPORT
+   #define EC_COMB_SUPPORT ENABLED
+#elif (EC_COMB_SUPPORT != ENABLED && EC_COMB_SUPPORT != DISABLED)
+   #error EC_COMB_SUPPORT parameter is not valid
+#endif
+
+//Number of teeth of the comb (2^w - 1 precomputed points per curve)
+#ifndef EC_COMB_WIDTH
+   #define EC_COMB_WIDTH 5
+#elif (EC_COMB_WIDTH < 4 || EC_COMB_WIDTH > 6)
+   #error EC_COMB_WIDTH parameter is not valid
+#endif
+
 //Elliptic curves
 #define SECP112R1_CURVE (&secp112r1Curve)
 #define SECP112R2_CURVE (&secp112r2Curve)
@@ -284,30 +307,48 @@ typedef enum
 typedef error_t (*EcFastModAlgo)(Mpi *a, const Mpi *p);
 
 
+/**
+ * @brief Fixed-base comb table
+ *
+ * Entry j (1 <= j < 2^w) holds the affine point sum of 2^(i * spacing).G
+ * over the bits i set in j. Coordinates are stored least significant
+ * word first
+ **/
+
+typedef struct
+{
+   uint_t width;           ///<Number of teeth
+   uint_t spacing;         ///<Distance between two consecutive teeth, in bits
+   uint_t wordLen;         ///<Length of a coordinate, in 32-bit words
+   const uint32_t *points; ///<Precomputed points (x, y)
+} EcCombTable;
+
+
 /**
  * @brief Elliptic curve parameters
  **/
 
 typedef struct
 {
-   const char_t *name;   ///<Curve name
-   const uint8_t *oid;   ///<Object identifier
-   size_t oidSize;       ///<OID size
-   EcCurveType type;     ///<Curve type
-   const uint8_t p[66];  ///<Prime modulus p
-   size_t pLen;          ///<Length of p
-   const uint8_t a[66];  ///<Curve parameter a
-   size_t aLen;          ///<Length of a
-   const uint8_t b[66];  ///<Curve parameter b
-   size_t bLen;          ///<Length of b
-   const uint8_t gx[66]; ///<x-coordinate of the base point G
-   size_t gxLen;         ///<Length of Gx
-   const uint8_t gy[66]; ///<y-coordinate of the base point G
-   size_t gyLen;         ///<Length of Gy
-   const uint8_t q[66];  ///<Order of the base point G
-   size_t qLen;          ///<Length of q
-   uint32_t h;           ///<Cofactor h
-   EcFastModAlgo mod;    ///<Fast modular reduction
+   const char_t *name;      ///<Curve name
+   const uint8_t *oid;      ///<Object identifier
+   size_t oidSize;          ///<OID size
+   EcCurveType type;        ///<Curve type
+   const uint8_t p[66];     ///<Prime modulus p
+   size_t pLen;             ///<Length of p
+   const uint8_t a[66];     ///<Curve parameter a
+   size_t aLen;             ///<Length of a
+   const uint8_t b[66];     ///<Curve parameter b
+   size_t bLen;             ///<Length of b
+   const uint8_t gx[66];    ///<x-coordinate of the base point G
+   size_t gxLen;            ///<Length of Gx
+   const uint8_t gy[66];    ///<y-coordinate of the base point G
+   size_t gyLen;            ///<Length of Gy
+   const uint8_t q[66];     ///<Order of the base point G
+   size_t qLen;             ///<Length of q
+   uint32_t h;              ///<Cofactor h
+   EcFastModAlgo mod;       ///<Fast modular reduction
+   const EcCombTable *comb; ///<Fixed-base comb table
 } EcCurveInfo;
 
 
@@ -368,6 +409,11 @@ extern const EcCurveInfo x448Curve;
 extern const EcCurveInfo ed25519Curve;
 extern const EcCurveInfo ed448Curve;
 
+extern const EcCombTable secp256k1CombTable;
+extern const EcCombTable secp256r1CombTable;
+extern const EcCombTable secp384r1CombTable;
+extern const EcCombTable secp521r1CombTable;
+
 //Fast modular reduction
 error_t secp128r1Mod(Mpi *a, const Mpi *p);
 error_t secp128r2Mod(Mpi *a, const Mpi *p);
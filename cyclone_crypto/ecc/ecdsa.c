@@ -31,6 +31,7 @@
 //Dependencies
 #include "core/crypto.h"
 #include "ecc/ecdsa.h"
+#include "ecc/p256.h"
 #include "mpi/mpi.h"
 #include "encoding/asn1.h"
 #include "debug.h"
@@ -412,6 +413,16 @@ __weak_func error_t ecdsaGenerateSignature(const PrngAlgo *prngAlgo, void *prngC
    TRACE_DEBUG("  digest:\r\n");
    TRACE_DEBUG_ARRAY("    ", digest, digestLen);
 
+#if (P256_ENGINE_SUPPORT == ENABLED)
+   //NIST P-256 elliptic curve?
+   if(params->mod == secp256r1Mod)
+   {
+      //Use the dedicated constant-time implementation
+      return ecdsaGenerateSignatureP256(prngAlgo, prngContext, privateKey,
+         digest, digestLen, signature);
+   }
+#endif
+
    //Initialize multiple precision integers
    mpiInit(&k);
    mpiInit(&z);
@@ -548,6 +559,15 @@ __weak_func error_t ecdsaVerifySignature(const EcDomainParameters *params,
       return ERROR_INVALID_SIGNATURE;
    }
 
+#if (P256_ENGINE_SUPPORT == ENABLED)
+   //NIST P-256 elliptic curve?
+   if(params->mod == secp256r1Mod)
+   {
+      //Use the dedicated implementation
+      return ecdsaVerifySignatureP256(publicKey, digest, digestLen, signature);
+   }
+#endif
+
    //Initialize multiple precision integers
    mpiInit(&w);
    mpiInit(&z);
@@ -623,4 +643,137 @@ end:
    return error;
 }
 
+#if (P256_ENGINE_SUPPORT == ENABLED)
+
+/**
+ * @brief ECDSA signature generation (secp256r1 curve)
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @param[in] privateKey Signer's EC private key
+ * @param[in] digest Digest of the message to be signed
+ * @param[in] digestLen Length in octets of the digest
+ * @param[out] signature (R, S) integer pair
+ * @return Error code
+ **/
+
+error_t ecdsaGenerateSignatureP256(const PrngAlgo *prngAlgo,
+   void *prngContext, const EcPrivateKey *privateKey, const uint8_t *digest,
+   size_t digestLen, EcdsaSignature *signature)
+{
+   error_t error;
+   uint8_t d[P256_BYTE_LEN];
+   uint8_t r[P256_BYTE_LEN];
+   uint8_t s[P256_BYTE_LEN];
+
+   //Export the private key
+   error = mpiExport(&privateKey->d, d, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN);
+
+   //Check status code
+   if(!error)
+   {
+      //Generate ECDSA signature
+      error = p256EcdsaSign(prngAlgo, prngContext, d, digest, digestLen, r, s);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Return the (R, S) integer pair
+      error = mpiImport(&signature->r, r, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      error = mpiImport(&signature->s, s, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN);
+   }
+
+   //Clear the private key from the stack
+   osMemset(d, 0, sizeof(d));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief ECDSA signature verification (secp256r1 curve)
+ * @param[in] publicKey Signer's EC public key
+ * @param[in] digest Digest of the message whose signature is to be verified
+ * @param[in] digestLen Length in octets of the digest
+ * @param[in] signature (R, S) integer pair
+ * @return Error code
+ **/
+
+error_t ecdsaVerifySignatureP256(const EcPublicKey *publicKey,
+   const uint8_t *digest, size_t digestLen, const EcdsaSignature *signature)
+{
+   uint8_t qx[P256_BYTE_LEN];
+   uint8_t qy[P256_BYTE_LEN];
+   uint8_t r[P256_BYTE_LEN];
+   uint8_t s[P256_BYTE_LEN];
+
+   //The public key must be in affine representation
+   if(mpiExport(&publicKey->q.x, qx, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN) ||
+      mpiExport(&publicKey->q.y, qy, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN))
+   {
+      return ERROR_INVALID_SIGNATURE;
+   }
+
+   //Out-of-range integers are rejected
+   if(mpiExport(&signature->r, r, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN) ||
+      mpiExport(&signature->s, s, P256_BYTE_LEN, MPI_FORMAT_BIG_ENDIAN))
+   {
+      return ERROR_INVALID_SIGNATURE;
+   }
+
+   //Verify ECDSA signature
+   return p256EcdsaVerify(qx, qy, digest, digestLen, r, s);
+}
+
+#endif
+
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief ECDSA signature verification using a caller-supplied arena
+ *
+ * All the temporary multiple precision integers and EC points are carved
+ * out of the arena, which is wiped and rewound before returning
+ *
+ * @param[in] params EC domain parameters
+ * @param[in] publicKey Signer's EC public key
+ * @param[in] digest Digest of the message whose signature is to be verified
+ * @param[in] digestLen Length in octets of the digest
+ * @param[in] signature (R, S) integer pair
+ * @param[in] arena Arena used to allocate temporary integers
+ * @return Error code
+ **/
+
+error_t ecdsaVerifySignatureArena(const EcDomainParameters *params,
+   const EcPublicKey *publicKey, const uint8_t *digest, size_t digestLen,
+   const EcdsaSignature *signature, MpiArena *arena)
+{
+   error_t error;
+
+   //Check parameters
+   if(arena == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Route temporary allocations to the arena
+   mpiArenaEnter(arena);
+
+   //Verify ECDSA signature
+   error = ecdsaVerifySignature(params, publicKey, digest, digestLen,
+      signature);
+
+   //Release the arena
+   mpiArenaLeave(arena);
+
+   //Return status code
+   return error;
+}
+
+#endif
 #endif
@@ -78,6 +78,25 @@ error_t ecdsaVerifySignature(const EcDomainParameters *params,
    const EcPublicKey *publicKey, const uint8_t *digest, size_t digestLen,
    const EcdsaSignature *signature);
 
+#if (P256_ENGINE_SUPPORT == ENABLED)
+
+error_t ecdsaGenerateSignatureP256(const PrngAlgo *prngAlgo,
+   void *prngContext, const EcPrivateKey *privateKey, const uint8_t *digest,
+   size_t digestLen, EcdsaSignature *signature);
+
+error_t ecdsaVerifySignatureP256(const EcPublicKey *publicKey,
+   const uint8_t *digest, size_t digestLen, const EcdsaSignature *signature);
+
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+error_t ecdsaVerifySignatureArena(const EcDomainParameters *params,
+   const EcPublicKey *publicKey, const uint8_t *digest, size_t digestLen,
+   const EcdsaSignature *signature, MpiArena *arena);
+
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 }
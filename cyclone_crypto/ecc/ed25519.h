@@ -30,6 +30,7 @@
 
 //Dependencies
 #include "core/crypto.h"
+#include "ecc/curve25519.h"
 #include "ecc/eddsa.h"
 #include "hash/sha512.h"
 
@@ -45,6 +46,13 @@
 //Prehash function output size
 #define ED25519_PH_SIZE 64
 
+//Maximum number of signatures verified by a single multi-scalar multiplication
+#ifndef ED25519_MAX_BATCH_SIZE
+   #define ED25519_MAX_BATCH_SIZE 16
+#elif (ED25519_MAX_BATCH_SIZE < 1)
+   #error ED25519_MAX_BATCH_SIZE parameter is not valid
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +72,48 @@ typedef struct
 } Ed25519Point;
 
 
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+
+/**
+ * @brief Extended point representation (radix-2^51)
+ **/
+
+typedef struct
+{
+   uint64_t x[5];
+   uint64_t y[5];
+   uint64_t z[5];
+   uint64_t t[5];
+} Ed25519Point51;
+
+
+/**
+ * @brief Cached point representation (radix-2^51)
+ **/
+
+typedef struct
+{
+   uint64_t yPlusX[5];
+   uint64_t yMinusX[5];
+   uint64_t z[5];
+   uint64_t t2d[5];
+} Ed25519CachedPoint51;
+
+
+/**
+ * @brief Precomputed affine point representation (radix-2^51)
+ **/
+
+typedef struct
+{
+   uint64_t yPlusX[5];
+   uint64_t yMinusX[5];
+   uint64_t xy2d[5];
+} Ed25519PrecompPoint51;
+
+#endif
+
+
 /**
  * @brief Ed25519 working state
  **/
@@ -88,9 +138,56 @@ typedef struct
    uint32_t f[8];
    uint32_t g[8];
    uint32_t h[8];
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+   Ed25519Point51 u51;
+   Ed25519Point51 v51;
+#endif
 } Ed25519State;
 
 
+/**
+ * @brief Signature to be verified as part of a batch
+ *
+ * The batch checks the cofactored verification equation, so it may accept a
+ * crafted signature that ed25519VerifySignature() rejects (see
+ * ed25519VerifyBatch())
+ **/
+
+typedef struct
+{
+   const uint8_t *publicKey; ///<Signer's EdDSA public key (32 bytes)
+   const void *message;      ///<Message whose signature is to be verified
+   size_t messageLen;        ///<Length of the message, in bytes
+   const uint8_t *signature; ///<EdDSA signature (64 bytes)
+} Ed25519BatchItem;
+
+
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+
+/**
+ * @brief Ed25519 batch verification working state
+ **/
+
+typedef struct
+{
+   Sha512Context sha512Context;
+   Sha512Context transcriptContext;
+   uint8_t h[64];
+   uint8_t k[64];
+   uint8_t t[32];
+   uint8_t b[32];
+   uint8_t z[ED25519_MAX_BATCH_SIZE][32];
+   uint8_t c[ED25519_MAX_BATCH_SIZE][32];
+   int8_t naf[2 * ED25519_MAX_BATCH_SIZE + 1][256];
+   Ed25519Point51 p[2 * ED25519_MAX_BATCH_SIZE];
+   Ed25519CachedPoint51 table[2 * ED25519_MAX_BATCH_SIZE][8];
+   Ed25519CachedPoint51 w;
+   Ed25519Point51 u;
+} Ed25519BatchState;
+
+#endif
+
+
 //Ed25519 related functions
 error_t ed25519GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
    uint8_t *privateKey, uint8_t *publicKey);
@@ -116,6 +213,8 @@ error_t ed25519VerifySignatureEx(const uint8_t *publicKey,
    const EddsaMessageChunk *messageChunks, const void *context,
    uint8_t contextLen, uint8_t flag, const uint8_t *signature);
 
+error_t ed25519VerifyBatch(const Ed25519BatchItem *items, uint_t count);
+
 void ed25519Mul(Ed25519State *state, Ed25519Point *r, const uint8_t *k,
    const Ed25519Point *p);
 
@@ -142,6 +241,45 @@ void ed25519SelectInt(uint8_t *r, const uint8_t *a, const uint8_t *b,
 
 uint8_t ed25519CompInt(const uint8_t *a, const uint8_t *b, uint_t n);
 
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+
+error_t ed25519VerifyBatchChunk(Ed25519BatchState *state,
+   const Ed25519BatchItem *items, uint_t count);
+
+void ed25519MulBase51(Ed25519Point51 *r, const uint8_t *k);
+void ed25519Mul51(Ed25519Point51 *r, const uint8_t *k, const Ed25519Point51 *p);
+
+void ed25519Add51(Ed25519Point51 *r, const Ed25519Point51 *p,
+   const Ed25519CachedPoint51 *q);
+
+void ed25519Sub51(Ed25519Point51 *r, const Ed25519Point51 *p,
+   const Ed25519CachedPoint51 *q);
+
+void ed25519AddPrecomp51(Ed25519Point51 *r, const Ed25519Point51 *p,
+   const Ed25519PrecompPoint51 *q);
+
+void ed25519SubPrecomp51(Ed25519Point51 *r, const Ed25519Point51 *p,
+   const Ed25519PrecompPoint51 *q);
+
+void ed25519Double51(Ed25519Point51 *r, const Ed25519Point51 *p);
+void ed25519ToCached51(Ed25519CachedPoint51 *r, const Ed25519Point51 *p);
+
+void ed25519SelectCached51(Ed25519CachedPoint51 *r,
+   const Ed25519CachedPoint51 *a, uint32_t c);
+
+void ed25519SelectPrecomp51(Ed25519PrecompPoint51 *r,
+   const Ed25519PrecompPoint51 *a, uint32_t c);
+
+uint32_t ed25519Decode51(Ed25519Point51 *p, const uint8_t *data);
+
+void ed25519Load51(Ed25519Point51 *r, const Ed25519Point *p);
+void ed25519Store51(Ed25519Point *r, const Ed25519Point51 *p);
+
+void ed25519RecodeScalar(int8_t *e, const uint8_t *k);
+void ed25519ComputeNaf(int8_t *r, const uint8_t *k);
+
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -0,0 +1,1185 @@
+/**
+ * @file p256.c
+ * @brief NIST P-256 elliptic curve (constant-time implementation)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * Field elements and scalars are held in fixed 8 x 32-bit arrays and all the
+ * arithmetic is performed in Montgomery representation. Point operations use
+ * the complete addition formulas of Renes, Costello and Batina (a = -3), so
+ * that no special case needs to be handled and no memory is allocated
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec_curves.h"
+#include "ecc/p256.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (P256_ENGINE_SUPPORT == ENABLED)
+
+//Field arithmetic
+#define P256_ADD(r, a, b) p256ModAdd(r, a, b, P256_P)
+#define P256_SUB(r, a, b) p256ModSub(r, a, b, P256_P)
+#define P256_MUL(r, a, b) p256MontMul(r, a, b, P256_P, P256_P_INV)
+
+//-p^-1 mod 2^32
+#define P256_P_INV 0x00000001
+//-n^-1 mod 2^32
+#define P256_N_INV 0xEE00BC4F
+
+//Prime modulus p
+const uint32_t P256_P[8] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+   0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+//Order of the base point G
+const uint32_t P256_N[8] =
+{
+   0xFC632551, 0xF3B9CAC2, 0xA7179E84, 0xBCE6FAAD,
+   0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF
+};
+
+//R mod p
+static const uint32_t P256_ONE_P[8] =
+{
+   0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0x00000000
+};
+
+//R^2 mod p
+static const uint32_t P256_R2_P[8] =
+{
+   0x00000003, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFB,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFD, 0x00000004
+};
+
+//R mod n
+static const uint32_t P256_ONE_N[8] =
+{
+   0x039CDAAF, 0x0C46353D, 0x58E8617B, 0x43190552,
+   0x00000000, 0x00000000, 0xFFFFFFFF, 0x00000000
+};
+
+//R^2 mod n
+static const uint32_t P256_R2_N[8] =
+{
+   0xBE79EEA2, 0x83244C95, 0x49BD6FA6, 0x4699799C,
+   0x2B6BEC59, 0x2845B239, 0xF3D95620, 0x66E12D94
+};
+
+//Curve parameter b (Montgomery representation)
+static const uint32_t P256_B[8] =
+{
+   0x29C4BDDF, 0xD89CDF62, 0x78843090, 0xACF005CD,
+   0xF7212ED6, 0xE5A220AB, 0x04874834, 0xDC30061D
+};
+
+//p - n
+static const uint32_t P256_P_MINUS_N[8] =
+{
+   0x039CDAAE, 0x0C46353D, 0x58E8617B, 0x43190553,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+
+#if (EC_COMB_SUPPORT == DISABLED)
+
+//x-coordinate of the base point G
+static const uint32_t P256_GX[8] =
+{
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81,
+   0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2
+};
+
+//y-coordinate of the base point G
+static const uint32_t P256_GY[8] =
+{
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357,
+   0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2
+};
+
+#endif
+
+
+/**
+ * @brief Modular addition
+ * @param[out] r Resulting integer R = (A + B) mod M
+ * @param[in] a An integer such as 0 <= A < M
+ * @param[in] b An integer such as 0 <= B < M
+ * @param[in] m Modulus
+ **/
+
+void p256ModAdd(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   const uint32_t *m)
+{
+   uint_t i;
+   uint32_t c;
+   uint64_t temp;
+   int64_t temp2;
+   uint32_t t[8];
+
+   //Compute R = A + B
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += a[i];
+      temp += b[i];
+      r[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Save the carry
+   c = temp & 0xFFFFFFFF;
+
+   //Compute T = R - M
+   for(temp2 = 0, i = 0; i < 8; i++)
+   {
+      temp2 += r[i];
+      temp2 -= m[i];
+      t[i] = temp2 & 0xFFFFFFFF;
+      temp2 >>= 32;
+   }
+
+   //Keep T if A + B >= M
+   c |= (temp2 + 1) & 0xFFFFFFFF;
+   p256Select(r, r, t, c);
+}
+
+
+/**
+ * @brief Modular subtraction
+ * @param[out] r Resulting integer R = (A - B) mod M
+ * @param[in] a An integer such as 0 <= A < M
+ * @param[in] b An integer such as 0 <= B < M
+ * @param[in] m Modulus
+ **/
+
+void p256ModSub(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   const uint32_t *m)
+{
+   uint_t i;
+   uint32_t c;
+   uint64_t temp;
+   int64_t temp2;
+   uint32_t t[8];
+
+   //Compute R = A - B
+   for(temp2 = 0, i = 0; i < 8; i++)
+   {
+      temp2 += a[i];
+      temp2 -= b[i];
+      r[i] = temp2 & 0xFFFFFFFF;
+      temp2 >>= 32;
+   }
+
+   //Save the borrow
+   c = temp2 & 1;
+
+   //Compute T = R + M
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += r[i];
+      temp += m[i];
+      t[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Keep T if A < B
+   p256Select(r, r, t, c);
+}
+
+
+/**
+ * @brief Montgomery multiplication
+ * @param[out] r Resulting integer R = A * B / 2^256 mod M
+ * @param[in] a An integer such as 0 <= A < M
+ * @param[in] b An integer such as 0 <= B < M
+ * @param[in] m Modulus
+ * @param[in] mInv Precomputed value -M^-1 mod 2^32
+ **/
+
+void p256MontMul(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   const uint32_t *m, uint32_t mInv)
+{
+   uint_t i;
+   uint_t j;
+   uint32_t u;
+   uint64_t temp;
+   int64_t temp2;
+   uint32_t t[10];
+
+   //Clear the accumulator
+   for(i = 0; i < 10; i++)
+   {
+      t[i] = 0;
+   }
+
+   //Coarsely integrated operand scanning
+   for(i = 0; i < 8; i++)
+   {
+      //Compute T = T + A * B(i)
+      for(temp = 0, j = 0; j < 8; j++)
+      {
+         temp += t[j];
+         temp += (uint64_t) a[j] * b[i];
+         t[j] = temp & 0xFFFFFFFF;
+         temp >>= 32;
+      }
+
+      temp += t[8];
+      t[8] = temp & 0xFFFFFFFF;
+      t[9] = temp >> 32;
+
+      //Compute U = T(0) * M' mod 2^32
+      u = t[0] * mInv;
+
+      //Compute T = (T + U * M) / 2^32
+      temp = t[0];
+      temp += (uint64_t) u * m[0];
+      temp >>= 32;
+
+      for(j = 1; j < 8; j++)
+      {
+         temp += t[j];
+         temp += (uint64_t) u * m[j];
+         t[j - 1] = temp & 0xFFFFFFFF;
+         temp >>= 32;
+      }
+
+      temp += t[8];
+      t[7] = temp & 0xFFFFFFFF;
+      t[8] = t[9] + (uint32_t) (temp >> 32);
+   }
+
+   //Compute R = T - M
+   for(temp2 = 0, i = 0; i < 8; i++)
+   {
+      temp2 += t[i];
+      temp2 -= m[i];
+      r[i] = temp2 & 0xFFFFFFFF;
+      temp2 >>= 32;
+   }
+
+   //The intermediate result is lower than 2 * M. If T < M, then R = T
+   p256Select(r, t, r, t[8] | ((temp2 + 1) & 0xFFFFFFFF));
+}
+
+
+/**
+ * @brief Modular inversion
+ * @param[out] r Resulting integer R = A^-1 (Montgomery representation)
+ * @param[in] a An integer such as 0 < A < M (Montgomery representation)
+ * @param[in] m Prime modulus
+ * @param[in] mInv Precomputed value -M^-1 mod 2^32
+ * @param[in] one Montgomery representation of 1
+ **/
+
+void p256MontInv(uint32_t *r, const uint32_t *a, const uint32_t *m,
+   uint32_t mInv, const uint32_t *one)
+{
+   int_t i;
+   int64_t temp;
+   uint32_t e[8];
+   uint32_t b[8];
+   uint32_t t[8];
+
+   //Compute the exponent E = M - 2
+   for(temp = -2, i = 0; i < 8; i++)
+   {
+      temp += m[i];
+      e[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Save the value of A
+   p256Copy(b, a);
+   p256Copy(t, one);
+
+   //Fermat's little theorem: compute A^(M - 2) mod M. The exponent is
+   //public, so the sequence of operations does not depend on A
+   for(i = 255; i >= 0; i--)
+   {
+      //Square the intermediate result
+      p256MontMul(t, t, t, m, mInv);
+
+      //Multiply by A if the current bit of the exponent is set
+      if(((e[i / 32] >> (i % 32)) & 1) != 0)
+      {
+         p256MontMul(t, t, b, m, mInv);
+      }
+   }
+
+   //Copy the resulting integer
+   p256Copy(r, t);
+}
+
+
+/**
+ * @brief Final reduction
+ * @param[out] r Resulting integer R = A mod M
+ * @param[in] a An integer such as 0 <= A < 2 * M
+ * @param[in] m Modulus
+ **/
+
+void p256Red(uint32_t *r, const uint32_t *a, const uint32_t *m)
+{
+   uint_t i;
+   int64_t temp;
+   uint32_t t[8];
+
+   //Compute T = A - M
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += a[i];
+      temp -= m[i];
+      t[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //If A < M, then R = A. Else R = A - M
+   p256Select(r, t, a, temp & 1);
+}
+
+
+/**
+ * @brief Set integer value
+ * @param[out] a Pointer to the integer to be initialized
+ * @param[in] b Initial value
+ **/
+
+void p256SetInt(uint32_t *a, uint32_t b)
+{
+   uint_t i;
+
+   //Set the value of the least significant word
+   a[0] = b;
+
+   //Initialize the rest of the integer
+   for(i = 1; i < 8; i++)
+   {
+      a[i] = 0;
+   }
+}
+
+
+/**
+ * @brief Copy an integer
+ * @param[out] a Pointer to the destination integer
+ * @param[in] b Pointer to the source integer
+ **/
+
+void p256Copy(uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+
+   //Copy the value of the integer
+   for(i = 0; i < 8; i++)
+   {
+      a[i] = b[i];
+   }
+}
+
+
+/**
+ * @brief Select an integer
+ * @param[out] r Pointer to the destination integer
+ * @param[in] a Pointer to the first source integer
+ * @param[in] b Pointer to the second source integer
+ * @param[in] c Condition variable
+ **/
+
+void p256Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //The mask is the all-1 or all-0 word
+   mask = c - 1;
+
+   //Select between A and B
+   for(i = 0; i < 8; i++)
+   {
+      //Constant time implementation
+      r[i] = (a[i] & mask) | (b[i] & ~mask);
+   }
+}
+
+
+/**
+ * @brief Compare integers
+ * @param[in] a Pointer to the first integer
+ * @param[in] b Pointer to the second integer
+ * @return The function returns 0 if the A = B, else 1
+ **/
+
+uint32_t p256Comp(const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //Initialize mask
+   mask = 0;
+
+   //Compare A and B
+   for(i = 0; i < 8; i++)
+   {
+      //Constant time implementation
+      mask |= a[i] ^ b[i];
+   }
+
+   //Return 0 if A = B, else 1
+   return ((uint32_t) (mask | (~mask + 1))) >> 31;
+}
+
+
+/**
+ * @brief Import an octet string
+ * @param[out] a Pointer to resulting integer
+ * @param[in] data Octet string to be converted (big-endian)
+ **/
+
+void p256Import(uint32_t *a, const uint8_t *data)
+{
+   uint_t i;
+
+   //Import the octet string
+   for(i = 0; i < 8; i++)
+   {
+      a[i] = LOAD32BE(data + 28 - i * 4);
+   }
+}
+
+
+/**
+ * @brief Export an octet string
+ * @param[in] a Pointer to the integer to be exported
+ * @param[out] data Octet string resulting from the conversion (big-endian)
+ **/
+
+void p256Export(uint32_t *a, uint8_t *data)
+{
+   uint_t i;
+
+   //Export the octet string
+   for(i = 0; i < 8; i++)
+   {
+      STORE32BE(a[i], data + 28 - i * 4);
+   }
+}
+
+
+/**
+ * @brief Set a point to the point at infinity
+ * @param[out] r Point at infinity (0, 1, 0)
+ **/
+
+void p256SetInfinity(P256Point *r)
+{
+   uint_t i;
+
+   //Set X = 0 and Z = 0
+   for(i = 0; i < 8; i++)
+   {
+      r->x[i] = 0;
+      r->z[i] = 0;
+   }
+
+   //Set Y = 1
+   p256Copy(r->y, P256_ONE_P);
+}
+
+
+/**
+ * @brief Select a point
+ * @param[out] r Pointer to the destination point
+ * @param[in] a Pointer to the first source point
+ * @param[in] b Pointer to the second source point
+ * @param[in] c Condition variable
+ **/
+
+void p256PointSelect(P256Point *r, const P256Point *a, const P256Point *b,
+   uint32_t c)
+{
+   //R = (C == 0) ? A : B
+   p256Select(r->x, a->x, b->x, c);
+   p256Select(r->y, a->y, b->y, c);
+   p256Select(r->z, a->z, b->z, c);
+}
+
+
+/**
+ * @brief Point doubling (complete formula)
+ * @param[out] r Resulting point R = 2S
+ * @param[in] s Point S
+ **/
+
+void p256Double(P256Point *r, const P256Point *s)
+{
+   uint32_t t0[8];
+   uint32_t t1[8];
+   uint32_t t2[8];
+   uint32_t t3[8];
+   uint32_t x3[8];
+   uint32_t y3[8];
+   uint32_t z3[8];
+
+   //Algorithm 6 from "Complete addition formulas for prime order elliptic
+   //curves" (Renes, Costello, Batina)
+   P256_MUL(t0, s->x, s->x);
+   P256_MUL(t1, s->y, s->y);
+   P256_MUL(t2, s->z, s->z);
+   P256_MUL(t3, s->x, s->y);
+   P256_ADD(t3, t3, t3);
+   P256_MUL(z3, s->x, s->z);
+   P256_ADD(z3, z3, z3);
+   P256_MUL(y3, P256_B, t2);
+   P256_SUB(y3, y3, z3);
+   P256_ADD(x3, y3, y3);
+   P256_ADD(y3, x3, y3);
+   P256_SUB(x3, t1, y3);
+   P256_ADD(y3, t1, y3);
+   P256_MUL(y3, x3, y3);
+   P256_MUL(x3, x3, t3);
+   P256_ADD(t3, t2, t2);
+   P256_ADD(t2, t2, t3);
+   P256_MUL(z3, P256_B, z3);
+   P256_SUB(z3, z3, t2);
+   P256_SUB(z3, z3, t0);
+   P256_ADD(t3, z3, z3);
+   P256_ADD(z3, z3, t3);
+   P256_ADD(t3, t0, t0);
+   P256_ADD(t0, t3, t0);
+   P256_SUB(t0, t0, t2);
+   P256_MUL(t0, t0, z3);
+   P256_ADD(y3, y3, t0);
+   P256_MUL(t0, s->y, s->z);
+   P256_ADD(t0, t0, t0);
+   P256_MUL(z3, t0, z3);
+   P256_SUB(x3, x3, z3);
+   P256_MUL(z3, t0, t1);
+   P256_ADD(z3, z3, z3);
+   P256_ADD(z3, z3, z3);
+
+   //Copy the resulting point
+   p256Copy(r->x, x3);
+   p256Copy(r->y, y3);
+   p256Copy(r->z, z3);
+}
+
+
+/**
+ * @brief Point addition (complete formula)
+ * @param[out] r Resulting point R = S + T
+ * @param[in] s First operand
+ * @param[in] t Second operand
+ **/
+
+void p256Add(P256Point *r, const P256Point *s, const P256Point *t)
+{
+   uint32_t t0[8];
+   uint32_t t1[8];
+   uint32_t t2[8];
+   uint32_t t3[8];
+   uint32_t t4[8];
+   uint32_t x3[8];
+   uint32_t y3[8];
+   uint32_t z3[8];
+
+   //Algorithm 4 from "Complete addition formulas for prime order elliptic
+   //curves" (Renes, Costello, Batina)
+   P256_MUL(t0, s->x, t->x);
+   P256_MUL(t1, s->y, t->y);
+   P256_MUL(t2, s->z, t->z);
+   P256_ADD(t3, s->x, s->y);
+   P256_ADD(t4, t->x, t->y);
+   P256_MUL(t3, t3, t4);
+   P256_ADD(t4, t0, t1);
+   P256_SUB(t3, t3, t4);
+   P256_ADD(t4, s->y, s->z);
+   P256_ADD(x3, t->y, t->z);
+   P256_MUL(t4, t4, x3);
+   P256_ADD(x3, t1, t2);
+   P256_SUB(t4, t4, x3);
+   P256_ADD(x3, s->x, s->z);
+   P256_ADD(y3, t->x, t->z);
+   P256_MUL(x3, x3, y3);
+   P256_ADD(y3, t0, t2);
+   P256_SUB(y3, x3, y3);
+   P256_MUL(z3, P256_B, t2);
+   P256_SUB(x3, y3, z3);
+   P256_ADD(z3, x3, x3);
+   P256_ADD(x3, x3, z3);
+   P256_SUB(z3, t1, x3);
+   P256_ADD(x3, t1, x3);
+   P256_MUL(y3, P256_B, y3);
+   P256_ADD(t1, t2, t2);
+   P256_ADD(t2, t1, t2);
+   P256_SUB(y3, y3, t2);
+   P256_SUB(y3, y3, t0);
+   P256_ADD(t1, y3, y3);
+   P256_ADD(y3, t1, y3);
+   P256_ADD(t1, t0, t0);
+   P256_ADD(t0, t1, t0);
+   P256_SUB(t0, t0, t2);
+   P256_MUL(t1, t4, y3);
+   P256_MUL(t2, t0, y3);
+   P256_MUL(y3, x3, z3);
+   P256_ADD(y3, y3, t2);
+   P256_MUL(x3, t3, x3);
+   P256_SUB(x3, x3, t1);
+   P256_MUL(z3, t4, z3);
+   P256_MUL(t1, t3, t0);
+   P256_ADD(z3, z3, t1);
+
+   //Copy the resulting point
+   p256Copy(r->x, x3);
+   p256Copy(r->y, y3);
+   p256Copy(r->z, z3);
+}
+
+
+/**
+ * @brief Mixed point addition
+ *
+ * The formula is complete as long as T is not the point at infinity
+ *
+ * @param[out] r Resulting point R = S + T
+ * @param[in] s First operand
+ * @param[in] t Second operand (affine point, the z-coordinate is ignored)
+ **/
+
+void p256AddMixed(P256Point *r, const P256Point *s, const P256Point *t)
+{
+   uint32_t t0[8];
+   uint32_t t1[8];
+   uint32_t t2[8];
+   uint32_t t3[8];
+   uint32_t t4[8];
+   uint32_t x3[8];
+   uint32_t y3[8];
+   uint32_t z3[8];
+
+   //Algorithm 5 from "Complete addition formulas for prime order elliptic
+   //curves" (Renes, Costello, Batina)
+   P256_MUL(t0, s->x, t->x);
+   P256_MUL(t1, s->y, t->y);
+   P256_ADD(t3, t->x, t->y);
+   P256_ADD(t4, s->x, s->y);
+   P256_MUL(t3, t3, t4);
+   P256_ADD(t4, t0, t1);
+   P256_SUB(t3, t3, t4);
+   P256_MUL(t4, t->y, s->z);
+   P256_ADD(t4, t4, s->y);
+   P256_MUL(y3, t->x, s->z);
+   P256_ADD(y3, y3, s->x);
+   P256_MUL(z3, P256_B, s->z);
+   P256_SUB(x3, y3, z3);
+   P256_ADD(z3, x3, x3);
+   P256_ADD(x3, x3, z3);
+   P256_SUB(z3, t1, x3);
+   P256_ADD(x3, t1, x3);
+   P256_MUL(y3, P256_B, y3);
+   P256_ADD(t1, s->z, s->z);
+   P256_ADD(t2, t1, s->z);
+   P256_SUB(y3, y3, t2);
+   P256_SUB(y3, y3, t0);
+   P256_ADD(t1, y3, y3);
+   P256_ADD(y3, t1, y3);
+   P256_ADD(t1, t0, t0);
+   P256_ADD(t0, t1, t0);
+   P256_SUB(t0, t0, t2);
+   P256_MUL(t1, t4, y3);
+   P256_MUL(t2, t0, y3);
+   P256_MUL(y3, x3, z3);
+   P256_ADD(y3, y3, t2);
+   P256_MUL(x3, t3, x3);
+   P256_SUB(x3, x3, t1);
+   P256_MUL(z3, t4, z3);
+   P256_MUL(t1, t3, t0);
+   P256_ADD(z3, z3, t1);
+
+   //Copy the resulting point
+   p256Copy(r->x, x3);
+   p256Copy(r->y, y3);
+   p256Copy(r->z, z3);
+}
+
+
+/**
+ * @brief Scalar multiplication (fixed window method)
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < 2^256
+ * @param[in] s EC point
+ **/
+
+void p256Mult(P256Point *r, const uint32_t *d, const P256Point *s)
+{
+   int_t i;
+   uint32_t j;
+   uint32_t k;
+   P256Point a;
+   P256Point t;
+   P256Point table[16];
+
+   //Precompute T(i) = i.S for 0 <= i < 16
+   p256SetInfinity(&table[0]);
+   table[1] = *s;
+
+   for(i = 2; i < 16; i++)
+   {
+      //Doubling is cheaper than addition
+      if((i % 2) == 0)
+      {
+         p256Double(&table[i], &table[i / 2]);
+      }
+      else
+      {
+         p256Add(&table[i], &table[i - 1], s);
+      }
+   }
+
+   //Set A = 0
+   p256SetInfinity(&a);
+
+   //Process the scalar 4 bits at a time, most significant window first
+   for(i = 63; i >= 0; i--)
+   {
+      //Compute A = 16.A
+      p256Double(&a, &a);
+      p256Double(&a, &a);
+      p256Double(&a, &a);
+      p256Double(&a, &a);
+
+      //Extract the current window
+      k = (d[i / 8] >> ((i % 8) * 4)) & 0x0F;
+
+      //Read T(k) without leaking the value of k
+      t = table[0];
+
+      for(j = 1; j < 16; j++)
+      {
+         p256PointSelect(&t, &t, &table[j], ((j ^ k) - 1) >> 31);
+      }
+
+      //Compute A = A + T(k)
+      p256Add(&a, &a, &t);
+   }
+
+   //Copy the resulting point
+   *r = a;
+}
+
+
+/**
+ * @brief Scalar multiplication of the base point G
+ * @param[out] r Resulting point R = d.G
+ * @param[in] d An integer d such as 0 <= d < 2^256
+ **/
+
+void p256MultBase(P256Point *r, const uint32_t *d)
+{
+#if (EC_COMB_SUPPORT == ENABLED)
+   int_t i;
+   uint_t j;
+   uint_t n;
+   uint32_t k;
+   uint_t pos;
+   const uint32_t *p;
+   const EcCombTable *comb;
+   P256Point a;
+   P256Point t;
+   P256Point u;
+
+   //Point to the fixed-base comb table of the secp256r1 curve
+   comb = &secp256r1CombTable;
+   //Number of precomputed points
+   n = (1U << comb->width) - 1;
+
+   //Set A = 0
+   p256SetInfinity(&a);
+   //Precomputed points are in affine representation
+   p256Copy(t.z, P256_ONE_P);
+
+   //Process the columns of the comb, most significant first
+   for(i = comb->spacing - 1; i >= 0; i--)
+   {
+      //Compute A = 2.A
+      p256Double(&a, &a);
+
+      //Gather the bits of d located at positions i + j * spacing
+      for(k = 0, j = 0; j < comb->width; j++)
+      {
+         pos = i + j * comb->spacing;
+
+         if(pos < 256)
+         {
+            k |= ((d[pos / 32] >> (pos % 32)) & 1) << j;
+         }
+      }
+
+      //Read T(k) without leaking the value of k
+      p256Copy(t.x, comb->points);
+      p256Copy(t.y, comb->points + 8);
+
+      for(j = 2; j <= n; j++)
+      {
+         p = comb->points + (j - 1) * 16;
+         p256Select(t.x, t.x, p, ((j ^ k) - 1) >> 31);
+         p256Select(t.y, t.y, p + 8, ((j ^ k) - 1) >> 31);
+      }
+
+      //Convert T(k) to Montgomery representation
+      P256_MUL(t.x, t.x, P256_R2_P);
+      P256_MUL(t.y, t.y, P256_R2_P);
+
+      //Compute A = A + T(k), unless the column is empty
+      p256AddMixed(&u, &a, &t);
+      p256PointSelect(&a, &a, &u, (k | (~k + 1)) >> 31);
+   }
+
+   //Copy the resulting point
+   *r = a;
+#else
+   P256Point g;
+
+   //Load the base point G
+   P256_MUL(g.x, P256_GX, P256_R2_P);
+   P256_MUL(g.y, P256_GY, P256_R2_P);
+   p256Copy(g.z, P256_ONE_P);
+
+   //Compute R = d.G
+   p256Mult(r, d, &g);
+#endif
+}
+
+
+/**
+ * @brief Import an affine point
+ * @param[out] r Resulting point
+ * @param[in] x x-coordinate (big-endian)
+ * @param[in] y y-coordinate (big-endian)
+ * @return Error code
+ **/
+
+error_t p256ImportPoint(P256Point *r, const uint8_t *x, const uint8_t *y)
+{
+   uint32_t t[8];
+   uint32_t u[8];
+   uint32_t c;
+
+   //Import the coordinates
+   p256Import(r->x, x);
+   p256Import(r->y, y);
+
+   //The coordinates must be lower than p
+   p256Red(t, r->x, P256_P);
+   c = p256Comp(t, r->x);
+   p256Red(t, r->y, P256_P);
+   c |= p256Comp(t, r->y);
+
+   //Convert the coordinates to Montgomery representation
+   P256_MUL(r->x, r->x, P256_R2_P);
+   P256_MUL(r->y, r->y, P256_R2_P);
+   p256Copy(r->z, P256_ONE_P);
+
+   //Compute x^3 - 3.x + b
+   P256_MUL(t, r->x, r->x);
+   P256_MUL(t, t, r->x);
+   P256_ADD(u, r->x, r->x);
+   P256_ADD(u, u, r->x);
+   P256_SUB(t, t, u);
+   P256_ADD(t, t, P256_B);
+
+   //Compute y^2
+   P256_MUL(u, r->y, r->y);
+
+   //Make sure the point lies on the curve
+   c |= p256Comp(t, u);
+
+   //Return status code
+   return (c == 0) ? NO_ERROR : ERROR_INVALID_PARAMETER;
+}
+
+
+/**
+ * @brief Export a point in affine representation
+ * @param[in] a Point to be exported
+ * @param[out] x x-coordinate (big-endian)
+ * @param[out] y y-coordinate (big-endian, optional parameter)
+ * @return Error code
+ **/
+
+error_t p256ExportPoint(const P256Point *a, uint8_t *x, uint8_t *y)
+{
+   uint32_t t[8];
+   uint32_t u[8];
+
+   //The point at infinity has no affine representation
+   p256SetInt(u, 0);
+
+   if(p256Comp(a->z, u) == 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Compute Z^-1
+   p256MontInv(t, a->z, P256_P, P256_P_INV, P256_ONE_P);
+
+   //Convert the x-coordinate back to normal representation
+   p256SetInt(u, 1);
+   P256_MUL(t, t, u);
+   P256_MUL(u, a->x, t);
+   p256Export(u, x);
+
+   //The y-coordinate is optional
+   if(y != NULL)
+   {
+      P256_MUL(u, a->y, t);
+      p256Export(u, y);
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Convert a digest to an integer modulo n
+ * @param[out] z Resulting integer
+ * @param[in] digest Digest of the message
+ * @param[in] digestLen Length in octets of the digest
+ **/
+
+void p256ImportDigest(uint32_t *z, const uint8_t *digest, size_t digestLen)
+{
+   uint8_t buffer[32];
+
+   //Keep the leftmost 256 bits of the hash value
+   digestLen = MIN(digestLen, 32);
+
+   //Convert the digest to an integer
+   osMemset(buffer, 0, 32);
+   osMemcpy(buffer + 32 - digestLen, digest, digestLen);
+   p256Import(z, buffer);
+
+   //Reduce the integer modulo n
+   p256Red(z, z, P256_N);
+}
+
+
+/**
+ * @brief ECDSA signature generation
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @param[in] d Signer's private key (big-endian)
+ * @param[in] digest Digest of the message to be signed
+ * @param[in] digestLen Length in octets of the digest
+ * @param[out] r Integer R of the signature (big-endian)
+ * @param[out] s Integer S of the signature (big-endian)
+ * @return Error code
+ **/
+
+error_t p256EcdsaSign(const PrngAlgo *prngAlgo, void *prngContext,
+   const uint8_t *d, const uint8_t *digest, size_t digestLen, uint8_t *r,
+   uint8_t *s)
+{
+   error_t error;
+   uint8_t buffer[32];
+   uint32_t k[8];
+   uint32_t t[8];
+   uint32_t u[8];
+   uint32_t z[8];
+   P256Point r1;
+
+   //Generate a random number k such as 0 < k < n
+   do
+   {
+      //Read 256 random bits
+      error = prngAlgo->read(prngContext, buffer, 32);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Convert the random string to an integer
+      p256Import(k, buffer);
+
+      //Reject k = 0 and k >= n
+      p256SetInt(t, 0);
+      p256Red(u, k, P256_N);
+
+   } while(p256Comp(k, t) == 0 || p256Comp(k, u) != 0);
+
+   //Convert the digest to an integer
+   p256ImportDigest(z, digest, digestLen);
+
+   //Compute R1 = (x1, y1) = k.G
+   p256MultBase(&r1, k);
+   error = p256ExportPoint(&r1, buffer, NULL);
+
+   //Check status code
+   if(!error)
+   {
+      //Compute r = x1 mod n
+      p256Import(t, buffer);
+      p256Red(t, t, P256_N);
+      p256Export(t, r);
+
+      //Compute r * d mod n
+      p256Import(u, d);
+      p256Red(u, u, P256_N);
+      p256MontMul(t, t, P256_R2_N, P256_N, P256_N_INV);
+      p256MontMul(u, t, u, P256_N, P256_N_INV);
+
+      //Compute z + r * d mod n
+      p256ModAdd(z, z, u, P256_N);
+
+      //Compute k ^ -1 mod n (Montgomery representation)
+      p256MontMul(k, k, P256_R2_N, P256_N, P256_N_INV);
+      p256MontInv(k, k, P256_N, P256_N_INV, P256_ONE_N);
+
+      //Compute s = k ^ -1 * (z + r * d) mod n
+      p256MontMul(t, k, z, P256_N, P256_N_INV);
+      p256Export(t, s);
+   }
+
+   //Clear secret values
+   osMemset(k, 0, sizeof(k));
+   osMemset(u, 0, sizeof(u));
+   osMemset(z, 0, sizeof(z));
+   osMemset(buffer, 0, sizeof(buffer));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief ECDSA signature verification
+ * @param[in] qx x-coordinate of the signer's public key (big-endian)
+ * @param[in] qy y-coordinate of the signer's public key (big-endian)
+ * @param[in] digest Digest of the message whose signature is to be verified
+ * @param[in] digestLen Length in octets of the digest
+ * @param[in] r Integer R of the signature (big-endian)
+ * @param[in] s Integer S of the signature (big-endian)
+ * @return Error code
+ **/
+
+error_t p256EcdsaVerify(const uint8_t *qx, const uint8_t *qy,
+   const uint8_t *digest, size_t digestLen, const uint8_t *r,
+   const uint8_t *s)
+{
+   error_t error;
+   uint_t i;
+   int64_t temp;
+   uint32_t a[8];
+   uint32_t b[8];
+   uint32_t w[8];
+   uint32_t u1[8];
+   uint32_t u2[8];
+   uint32_t zero[8];
+   P256Point q;
+   P256Point v0;
+   P256Point v1;
+
+   //Import the integers r and s
+   p256Import(a, r);
+   p256Import(b, s);
+
+   //The verifier shall check that 0 < r < n and 0 < s < n
+   p256SetInt(zero, 0);
+   p256Red(w, a, P256_N);
+   p256Red(u1, b, P256_N);
+
+   if(p256Comp(a, zero) == 0 || p256Comp(a, w) != 0 ||
+      p256Comp(b, zero) == 0 || p256Comp(b, u1) != 0)
+   {
+      return ERROR_INVALID_SIGNATURE;
+   }
+
+   //Import the public key
+   error = p256ImportPoint(&q, qx, qy);
+   //The public key must lie on the curve
+   if(error)
+      return ERROR_INVALID_SIGNATURE;
+
+   //Compute w = s ^ -1 mod n (Montgomery representation)
+   p256MontMul(w, b, P256_R2_N, P256_N, P256_N_INV);
+   p256MontInv(w, w, P256_N, P256_N_INV, P256_ONE_N);
+
+   //Compute u1 = z * w mod n
+   p256ImportDigest(u1, digest, digestLen);
+   p256MontMul(u1, u1, w, P256_N, P256_N_INV);
+   //Compute u2 = r * w mod n
+   p256MontMul(u2, a, w, P256_N, P256_N_INV);
+
+   //Compute V0 = (x0, y0) = u1.G + u2.Q
+   p256MultBase(&v0, u1);
+   p256Mult(&v1, u2, &q);
+   p256Add(&v0, &v0, &v1);
+
+   //The signature is invalid if V0 is the point at infinity
+   if(p256Comp(v0.z, zero) == 0)
+      return ERROR_INVALID_SIGNATURE;
+
+   //The check x0 mod n = r is performed in projective coordinates, which
+   //saves a field inversion. Since p < 2n, x0 is either r or r + n
+   P256_MUL(b, a, P256_R2_P);
+   P256_MUL(b, b, v0.z);
+
+   //Check whether x0 = r
+   if(p256Comp(b, v0.x) == 0)
+      return NO_ERROR;
+
+   //Check whether r + n < p, i.e. r < p - n
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += a[i];
+      temp -= P256_P_MINUS_N[i];
+      temp >>= 32;
+   }
+
+   //A borrow indicates that r + n is a valid field element
+   if(temp < 0)
+   {
+      //Compute r + n
+      p256ModAdd(a, a, P256_N, P256_P);
+
+      //Check whether x0 = r + n
+      P256_MUL(b, a, P256_R2_P);
+      P256_MUL(b, b, v0.z);
+
+      if(p256Comp(b, v0.x) == 0)
+         return NO_ERROR;
+   }
+
+   //The signature is not valid
+   return ERROR_INVALID_SIGNATURE;
+}
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * @file p256.h
+ * @brief NIST P-256 elliptic curve (constant-time implementation)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _P256_H
+#define _P256_H
+
+//Dependencies
+#include "core/crypto.h"
+
+//Length of the elliptic curve
+#define P256_BIT_LEN 256
+#define P256_BYTE_LEN 32
+#define P256_WORD_LEN 8
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief P-256 point (projective coordinates, Montgomery representation)
+ **/
+
+typedef struct
+{
+   uint32_t x[8]; ///<x-coordinate
+   uint32_t y[8]; ///<y-coordinate
+   uint32_t z[8]; ///<z-coordinate
+} P256Point;
+
+
+//P-256 related constants
+extern const uint32_t P256_P[8];
+extern const uint32_t P256_N[8];
+
+//P-256 related functions
+void p256ModAdd(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   const uint32_t *m);
+
+void p256ModSub(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   const uint32_t *m);
+
+void p256MontMul(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   const uint32_t *m, uint32_t mInv);
+
+void p256MontInv(uint32_t *r, const uint32_t *a, const uint32_t *m,
+   uint32_t mInv, const uint32_t *one);
+
+void p256Red(uint32_t *r, const uint32_t *a, const uint32_t *m);
+
+void p256SetInt(uint32_t *a, uint32_t b);
+
+void p256Copy(uint32_t *a, const uint32_t *b);
+
+void p256Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c);
+
+uint32_t p256Comp(const uint32_t *a, const uint32_t *b);
+
+void p256Import(uint32_t *a, const uint8_t *data);
+void p256Export(uint32_t *a, uint8_t *data);
+
+void p256SetInfinity(P256Point *r);
+
+void p256PointSelect(P256Point *r, const P256Point *a, const P256Point *b,
+   uint32_t c);
+
+void p256Double(P256Point *r, const P256Point *s);
+void p256Add(P256Point *r, const P256Point *s, const P256Point *t);
+void p256AddMixed(P256Point *r, const P256Point *s, const P256Point *t);
+
+void p256Mult(P256Point *r, const uint32_t *d, const P256Point *s);
+void p256MultBase(P256Point *r, const uint32_t *d);
+
+error_t p256ImportPoint(P256Point *r, const uint8_t *x, const uint8_t *y);
+error_t p256ExportPoint(const P256Point *a, uint8_t *x, uint8_t *y);
+
+void p256ImportDigest(uint32_t *z, const uint8_t *digest, size_t digestLen);
+
+error_t p256EcdsaSign(const PrngAlgo *prngAlgo, void *prngContext,
+   const uint8_t *d, const uint8_t *digest, size_t digestLen, uint8_t *r,
+   uint8_t *s);
+
+error_t p256EcdsaVerify(const uint8_t *qx, const uint8_t *qy,
+   const uint8_t *digest, size_t digestLen, const uint8_t *r,
+   const uint8_t *s);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -91,6 +91,85 @@ error_t x25519(uint8_t *r, const uint8_t *k, const uint8_t *u)
    //section 5)
    curve25519Red(state->u, state->u);
 
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+   //Convert the u-coordinate to radix-2^51 representation
+   curve25519Load51(state->v, state->u);
+
+   //Set X1 = 1
+   curve25519SetInt51(state->x1, 1);
+   //Set Z1 = 0
+   curve25519SetInt51(state->z1, 0);
+   //Set X2 = U
+   curve25519Copy51(state->x2, state->v);
+   //Set Z2 = 1
+   curve25519SetInt51(state->z2, 1);
+
+   //Set swap = 0
+   swap = 0;
+
+   //Montgomery ladder
+   for(i = CURVE25519_BIT_LEN - 1; i >= 0; i--)
+   {
+      //The scalar is processed in a left-to-right fashion
+      b = (state->k[i / 32] >> (i % 32)) & 1;
+
+      //Conditional swap
+      curve25519Swap51(state->x1, state->x2, swap ^ b);
+      curve25519Swap51(state->z1, state->z2, swap ^ b);
+
+      //Save current bit value
+      swap = b;
+
+      //Compute T1 = X2 + Z2
+      curve25519Add51(state->t1, state->x2, state->z2);
+      //Compute X2 = X2 - Z2
+      curve25519Sub51(state->x2, state->x2, state->z2);
+      //Compute Z2 = X1 + Z1
+      curve25519Add51(state->z2, state->x1, state->z1);
+      //Compute X1 = X1 - Z1
+      curve25519Sub51(state->x1, state->x1, state->z1);
+      //Compute T1 = T1 * X1
+      curve25519Mul51(state->t1, state->t1, state->x1);
+      //Compute X2 = X2 * Z2
+      curve25519Mul51(state->x2, state->x2, state->z2);
+      //Compute Z2 = Z2 * Z2
+      curve25519Sqr51(state->z2, state->z2);
+      //Compute X1 = X1 * X1
+      curve25519Sqr51(state->x1, state->x1);
+      //Compute T2 = Z2 - X1
+      curve25519Sub51(state->t2, state->z2, state->x1);
+      //Compute Z1 = T2 * a24
+      curve25519MulInt51(state->z1, state->t2, CURVE25519_A24);
+      //Compute Z1 = Z1 + X1
+      curve25519Add51(state->z1, state->z1, state->x1);
+      //Compute Z1 = Z1 * T2
+      curve25519Mul51(state->z1, state->z1, state->t2);
+      //Compute X1 = X1 * Z2
+      curve25519Mul51(state->x1, state->x1, state->z2);
+      //Compute Z2 = T1 - X2
+      curve25519Sub51(state->z2, state->t1, state->x2);
+      //Compute Z2 = Z2 * Z2
+      curve25519Sqr51(state->z2, state->z2);
+      //Compute Z2 = Z2 * U
+      curve25519Mul51(state->z2, state->z2, state->v);
+      //Compute X2 = X2 + T1
+      curve25519Add51(state->x2, state->x2, state->t1);
+      //Compute X2 = X2 * X2
+      curve25519Sqr51(state->x2, state->x2);
+   }
+
+   //Conditional swap
+   curve25519Swap51(state->x1, state->x2, swap);
+   curve25519Swap51(state->z1, state->z2, swap);
+
+   //Retrieve affine representation
+   curve25519Inv51(state->v, state->z1);
+   curve25519Mul51(state->v, state->v, state->x1);
+
+   //Convert the u-coordinate back to radix-2^32 representation
+   curve25519Store51(state->u, state->v);
+
+#else
    //Set X1 = 1
    curve25519SetInt(state->x1, 1);
    //Set Z1 = 0
@@ -162,6 +241,8 @@ error_t x25519(uint8_t *r, const uint8_t *k, const uint8_t *u)
    curve25519Inv(state->u, state->z1);
    curve25519Mul(state->u, state->u, state->x1);
 
+#endif
+
    //Copy output u-coordinate
    curve25519Export(state->u, r);
 
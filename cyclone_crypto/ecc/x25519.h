@@ -46,12 +46,22 @@ typedef struct
 {
    uint32_t k[8];
    uint32_t u[8];
+#if (CURVE25519_RADIX51_SUPPORT == ENABLED)
+   uint64_t v[5];
+   uint64_t x1[5];
+   uint64_t z1[5];
+   uint64_t x2[5];
+   uint64_t z2[5];
+   uint64_t t1[5];
+   uint64_t t2[5];
+#else
    uint32_t x1[8];
    uint32_t z1[8];
    uint32_t x2[8];
    uint32_t z2[8];
    uint32_t t1[8];
    uint32_t t2[8];
+#endif
 } X25519State;
 
 
@@ -254,6 +254,7 @@ error_t base64Decode(const char_t *input, size_t inputLen, void *output,
    uint_t c;
    size_t i;
    size_t j;
+   size_t m;
    size_t n;
    size_t padLen;
    uint8_t *p;
@@ -279,6 +280,23 @@ error_t base64Decode(const char_t *input, size_t inputLen, void *output,
    //Process the Base64-encoded string
    for(i = 0; i < inputLen && !error; i++)
    {
+      //Complete blocks of 4 characters from the base alphabet are decoded
+      //in a single step
+      if(j == 0 && padLen == 0)
+      {
+         //Decode as many blocks as possible
+         m = base64DecodeBlocks(input + i, inputLen - i,
+            (p != NULL) ? p + n : NULL);
+
+         //Adjust the length of the decoded data
+         i += m;
+         n += (m / 4) * 3;
+
+         //End of string?
+         if(i >= inputLen)
+            break;
+      }
+
       //Get current character
       c = (uint_t) input[i];
 
@@ -374,4 +392,68 @@ error_t base64Decode(const char_t *input, size_t inputLen, void *output,
    return error;
 }
 
+
+/**
+ * @brief Decode consecutive blocks of 4 Base64 characters
+ *
+ * Decoding stops at the first block that contains a character outside the
+ * base alphabet (line break, padding or invalid character), which is left to
+ * the caller
+ *
+ * @param[in] input Base64-encoded string
+ * @param[in] inputLen Length of the encoded string
+ * @param[out] output Resulting decoded data (optional parameter)
+ * @return Number of characters that have been decoded (multiple of 4)
+ **/
+
+size_t base64DecodeBlocks(const char_t *input, size_t inputLen,
+   uint8_t *output)
+{
+   size_t i;
+   uint8_t a;
+   uint8_t b;
+   uint8_t c;
+   uint8_t d;
+   uint32_t value;
+
+   //Process the input string block by block
+   for(i = 0; (i + 4) <= inputLen; i += 4)
+   {
+      //Characters outside the ASCII range are handled by the caller
+      if((((uint8_t) input[i] | (uint8_t) input[i + 1] | (uint8_t) input[i + 2] |
+         (uint8_t) input[i + 3]) & 0x80) != 0)
+      {
+         break;
+      }
+
+      //Decode the 4 characters
+      a = base64DecTable[(uint8_t) input[i]];
+      b = base64DecTable[(uint8_t) input[i + 1]];
+      c = base64DecTable[(uint8_t) input[i + 2]];
+      d = base64DecTable[(uint8_t) input[i + 3]];
+
+      //Invalid entries of the decoding table are all set to 0xFF, so a single
+      //test catches any character outside the base alphabet
+      if(((a | b | c | d) & 0xC0) != 0)
+         break;
+
+      //Map the 4-character block to 3 bytes
+      if(output != NULL)
+      {
+         value = ((uint32_t) a << 18) | ((uint32_t) b << 12) |
+            ((uint32_t) c << 6) | d;
+
+         output[0] = (value >> 16) & 0xFF;
+         output[1] = (value >> 8) & 0xFF;
+         output[2] = value & 0xFF;
+
+         //Advance data pointer
+         output += 3;
+      }
+   }
+
+   //Return the number of characters that have been decoded
+   return i;
+}
+
 #endif
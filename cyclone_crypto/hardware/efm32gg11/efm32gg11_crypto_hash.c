@@ -65,6 +65,33 @@ error_t sha1Compute(const void *data, size_t length, uint8_t *digest)
 }
 
 
+/**
+ * @brief Process message in 16-word blocks
+ * @param[in] context Pointer to the SHA-1 context
+ * @param[in] data Pointer to the input blocks
+ * @param[in] n Number of 64-byte blocks to process
+ **/
+
+void sha1ProcessBlocks(Sha1Context *context, const uint8_t *data,
+   size_t n)
+{
+   //Process the input blocks
+   for(; n > 0; n--)
+   {
+      //The CRYPTO module reads the block from the context
+      if(data != context->buffer)
+      {
+         osMemcpy(context->buffer, data, 64);
+      }
+
+      //Process the current block
+      sha1ProcessBlock(context);
+      //Advance data pointer
+      data += 64;
+   }
+}
+
+
 /**
  * @brief Process message in 16-word blocks
  * @param[in] context Pointer to the SHA-1 context
@@ -153,6 +180,33 @@ error_t sha256Compute(const void *data, size_t length, uint8_t *digest)
 }
 
 
+/**
+ * @brief Process message in 16-word blocks
+ * @param[in] context Pointer to the SHA-256 context
+ * @param[in] data Pointer to the input blocks
+ * @param[in] n Number of 64-byte blocks to process
+ **/
+
+void sha256ProcessBlocks(Sha256Context *context, const uint8_t *data,
+   size_t n)
+{
+   //Process the input blocks
+   for(; n > 0; n--)
+   {
+      //The CRYPTO module reads the block from the context
+      if(data != context->buffer)
+      {
+         osMemcpy(context->buffer, data, 64);
+      }
+
+      //Process the current block
+      sha256ProcessBlock(context);
+      //Advance data pointer
+      data += 64;
+   }
+}
+
+
 /**
  * @brief Process message in 16-word blocks
  * @param[in] context Pointer to the SHA-256 context
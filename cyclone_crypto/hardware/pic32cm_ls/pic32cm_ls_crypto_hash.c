@@ -43,16 +43,27 @@
 /**
  * @brief Process message in 16-word blocks
  * @param[in] context Pointer to the SHA-256 context
+ * @param[in] data Pointer to the input blocks
+ * @param[in] n Number of 64-byte blocks to process
  **/
 
-void sha256ProcessBlock(Sha256Context *context)
+void sha256ProcessBlocks(Sha256Context *context, const uint8_t *data,
+   size_t n)
 {
    static uint32_t buffer[64];
 
    //Acquire exclusive access to the CRYA module
    osAcquireMutex(&pic32cmlsCryptoMutex);
-   //Accelerate SHA-256 inner compression loop
-   crya_sha_process(context->h, context->buffer, buffer);
+
+   //Process the input blocks
+   for(; n > 0; n--)
+   {
+      //Accelerate SHA-256 inner compression loop
+      crya_sha_process(context->h, data, buffer);
+      //Advance data pointer
+      data += 64;
+   }
+
    //Release exclusive access to the CRYA module
    osReleaseMutex(&pic32cmlsCryptoMutex);
 }
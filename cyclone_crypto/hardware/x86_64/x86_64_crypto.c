@@ -0,0 +1,184 @@
+/**
+ * @file x86_64_crypto.c
+ * @brief x86-64 instruction set extensions (AES-NI, PCLMULQDQ, SHA, AVX2)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#if defined(_MSC_VER)
+   #include <intrin.h>
+#else
+   #include <cpuid.h>
+#endif
+
+#include "core/crypto.h"
+#include "hardware/x86_64/x86_64_crypto.h"
+#include "hardware/x86_64/x86_64_crypto_hash.h"
+#include "hardware/x86_64/x86_64_crypto_cipher.h"
+#include "debug.h"
+
+//Global variables
+uint32_t x86_64CryptoFeatures = 0;
+
+
+/**
+ * @brief Execute CPUID instruction
+ * @param[in] leaf Value of EAX register
+ * @param[in] subleaf Value of ECX register
+ * @param[out] regs Values of EAX, EBX, ECX and EDX registers
+ **/
+
+static void x86_64Cpuid(uint32_t leaf, uint32_t subleaf, uint32_t *regs)
+{
+#if defined(_MSC_VER)
+   int temp[4];
+
+   //Query processor information
+   __cpuidex(temp, leaf, subleaf);
+
+   //Return the contents of the registers
+   regs[0] = temp[0];
+   regs[1] = temp[1];
+   regs[2] = temp[2];
+   regs[3] = temp[3];
+#else
+   //Query processor information
+   __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+
+/**
+ * @brief Read extended control register XCR0
+ * @return Value of XCR0
+ **/
+
+static uint64_t x86_64Xgetbv(void)
+{
+#if defined(_MSC_VER)
+   //Read XCR0 register
+   return _xgetbv(0);
+#else
+   uint32_t eax;
+   uint32_t edx;
+
+   //Read XCR0 register
+   __asm__ __volatile__("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+
+   //Return the 64-bit value
+   return ((uint64_t) edx << 32) | eax;
+#endif
+}
+
+
+/**
+ * @brief Detect the instruction set extensions supported by the CPU
+ * @return Error code
+ **/
+
+error_t x86_64CryptoInit(void)
+{
+   uint32_t features;
+   uint32_t maxLeaf;
+   uint32_t regs[4];
+
+   //Clear CPU features
+   features = 0;
+
+   //Retrieve the highest supported leaf
+   x86_64Cpuid(0, 0, regs);
+   maxLeaf = regs[0];
+
+   //Check whether the processor information leaf is available
+   if(maxLeaf >= 1)
+   {
+      //Retrieve feature flags
+      x86_64Cpuid(1, 0, regs);
+
+      //SSSE3 and SSE4.1 are required by all the accelerated functions
+      if((regs[2] & (1 << 9)) != 0 && (regs[2] & (1 << 19)) != 0)
+      {
+         features |= X86_64_CPU_FEATURE_SSSE3 | X86_64_CPU_FEATURE_SSE41;
+
+         //AES instruction set
+         if((regs[2] & (1 << 25)) != 0)
+         {
+            features |= X86_64_CPU_FEATURE_AES;
+         }
+
+         //Carry-less multiplication
+         if((regs[2] & (1 << 1)) != 0)
+         {
+            features |= X86_64_CPU_FEATURE_PCLMUL;
+         }
+
+         //Check whether the OS saves the YMM registers on context switches
+         if((regs[2] & (1 << 27)) != 0 && (x86_64Xgetbv() & 0x06) == 0x06)
+         {
+            features |= X86_64_CPU_FEATURE_AVX2;
+         }
+
+         //Check whether the structured extended feature flags are available
+         if(maxLeaf >= 7)
+         {
+            //Retrieve extended feature flags
+            x86_64Cpuid(7, 0, regs);
+
+            //AVX2 instruction set
+            if((regs[1] & (1 << 5)) == 0)
+            {
+               features &= ~X86_64_CPU_FEATURE_AVX2;
+            }
+
+            //SHA extensions
+            if((regs[1] & (1 << 29)) != 0)
+            {
+               features |= X86_64_CPU_FEATURE_SHA;
+            }
+         }
+         else
+         {
+            //AVX2 is not supported
+            features &= ~X86_64_CPU_FEATURE_AVX2;
+         }
+      }
+   }
+
+   //Debug message
+   TRACE_INFO("x86-64 CPU features: AES-NI=%u PCLMUL=%u SHA=%u AVX2=%u\r\n",
+      (features & X86_64_CPU_FEATURE_AES) ? 1 : 0,
+      (features & X86_64_CPU_FEATURE_PCLMUL) ? 1 : 0,
+      (features & X86_64_CPU_FEATURE_SHA) ? 1 : 0,
+      (features & X86_64_CPU_FEATURE_AVX2) ? 1 : 0);
+
+   //Accelerated functions fall back to the portable implementation as long as
+   //the corresponding feature has not been detected
+   x86_64CryptoFeatures = features;
+
+   //Successful processing
+   return NO_ERROR;
+}
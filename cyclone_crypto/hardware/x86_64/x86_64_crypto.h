@@ -0,0 +1,65 @@
+/**
+ * @file x86_64_crypto.h
+ * @brief x86-64 instruction set extensions (AES-NI, PCLMULQDQ, SHA, AVX2)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _X86_64_CRYPTO_H
+#define _X86_64_CRYPTO_H
+
+//Dependencies
+#include "core/crypto.h"
+
+//CPU features
+#define X86_64_CPU_FEATURE_SSSE3  0x0001
+#define X86_64_CPU_FEATURE_SSE41  0x0002
+#define X86_64_CPU_FEATURE_AES    0x0004
+#define X86_64_CPU_FEATURE_PCLMUL 0x0008
+#define X86_64_CPU_FEATURE_SHA    0x0010
+#define X86_64_CPU_FEATURE_AVX2   0x0020
+
+//Instruction set extensions required by a given function
+#if defined(__GNUC__) || defined(__clang__)
+   #define X86_64_TARGET(s) __attribute__((target(s)))
+#else
+   #define X86_64_TARGET(s)
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Global variables
+extern uint32_t x86_64CryptoFeatures;
+
+//x86-64 instruction set extensions related functions
+error_t x86_64CryptoInit(void);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,747 @@
+/**
+ * @file x86_64_crypto_cipher.c
+ * @brief x86-64 AES-NI, PCLMULQDQ and AVX2 accelerated ciphers
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <immintrin.h>
+#include "core/crypto.h"
+#include "hardware/x86_64/x86_64_crypto.h"
+#include "hardware/x86_64/x86_64_crypto_cipher.h"
+#include "cipher/cipher_algorithms.h"
+#include "aead/aead_algorithms.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (X86_64_CRYPTO_CIPHER_SUPPORT == ENABLED)
+#if (AES_SUPPORT == ENABLED)
+
+/**
+ * @brief Encrypt several 16-byte blocks using AES-NI
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Plaintext blocks to encrypt
+ * @param[out] output Ciphertext blocks resulting from encryption
+ * @param[in] n Number of blocks
+ **/
+
+X86_64_TARGET("aes,sse4.1")
+static void aesniEncryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n)
+{
+   uint_t i;
+   uint_t j;
+   __m128i k[15];
+   __m128i b[8];
+
+   //The key schedule computed by aesInit matches the layout expected by the
+   //AESENC instruction
+   for(i = 0; i <= context->nr; i++)
+   {
+      k[i] = _mm_loadu_si128((const __m128i *) (context->ek + i * 4));
+   }
+
+   //Interleave 8 blocks so that the latency of the AESENC instruction is
+   //hidden
+   while(n >= 8)
+   {
+      //Initial round key addition
+      for(j = 0; j < 8; j++)
+      {
+         b[j] = _mm_loadu_si128((const __m128i *) (input + j * 16));
+         b[j] = _mm_xor_si128(b[j], k[0]);
+      }
+
+      //Apply round function
+      for(i = 1; i < context->nr; i++)
+      {
+         for(j = 0; j < 8; j++)
+         {
+            b[j] = _mm_aesenc_si128(b[j], k[i]);
+         }
+      }
+
+      //The last round differs slightly from the first rounds
+      for(j = 0; j < 8; j++)
+      {
+         b[j] = _mm_aesenclast_si128(b[j], k[context->nr]);
+         _mm_storeu_si128((__m128i *) (output + j * 16), b[j]);
+      }
+
+      //Next blocks
+      input += 8 * AES_BLOCK_SIZE;
+      output += 8 * AES_BLOCK_SIZE;
+      n -= 8;
+   }
+
+   //Process the remaining blocks
+   while(n > 0)
+   {
+      //Initial round key addition
+      b[0] = _mm_loadu_si128((const __m128i *) input);
+      b[0] = _mm_xor_si128(b[0], k[0]);
+
+      //Apply round function
+      for(i = 1; i < context->nr; i++)
+      {
+         b[0] = _mm_aesenc_si128(b[0], k[i]);
+      }
+
+      //The last round differs slightly from the first rounds
+      b[0] = _mm_aesenclast_si128(b[0], k[context->nr]);
+      _mm_storeu_si128((__m128i *) output, b[0]);
+
+      //Next block
+      input += AES_BLOCK_SIZE;
+      output += AES_BLOCK_SIZE;
+      n--;
+   }
+}
+
+
+/**
+ * @brief Decrypt several 16-byte blocks using AES-NI
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Ciphertext blocks to decrypt
+ * @param[out] output Plaintext blocks resulting from decryption
+ * @param[in] n Number of blocks
+ **/
+
+X86_64_TARGET("aes,sse4.1")
+static void aesniDecryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n)
+{
+   uint_t i;
+   uint_t j;
+   __m128i k[15];
+   __m128i b[8];
+
+   //The decryption key schedule already has the InvMixColumns transformation
+   //applied to the inner round keys, as required by the AESDEC instruction
+   for(i = 0; i <= context->nr; i++)
+   {
+      k[i] = _mm_loadu_si128((const __m128i *) (context->dk + i * 4));
+   }
+
+   //Interleave 8 blocks so that the latency of the AESDEC instruction is
+   //hidden
+   while(n >= 8)
+   {
+      //Initial round key addition
+      for(j = 0; j < 8; j++)
+      {
+         b[j] = _mm_loadu_si128((const __m128i *) (input + j * 16));
+         b[j] = _mm_xor_si128(b[j], k[context->nr]);
+      }
+
+      //Apply round function
+      for(i = context->nr - 1; i >= 1; i--)
+      {
+         for(j = 0; j < 8; j++)
+         {
+            b[j] = _mm_aesdec_si128(b[j], k[i]);
+         }
+      }
+
+      //The last round differs slightly from the first rounds
+      for(j = 0; j < 8; j++)
+      {
+         b[j] = _mm_aesdeclast_si128(b[j], k[0]);
+         _mm_storeu_si128((__m128i *) (output + j * 16), b[j]);
+      }
+
+      //Next blocks
+      input += 8 * AES_BLOCK_SIZE;
+      output += 8 * AES_BLOCK_SIZE;
+      n -= 8;
+   }
+
+   //Process the remaining blocks
+   while(n > 0)
+   {
+      //Initial round key addition
+      b[0] = _mm_loadu_si128((const __m128i *) input);
+      b[0] = _mm_xor_si128(b[0], k[context->nr]);
+
+      //Apply round function
+      for(i = context->nr - 1; i >= 1; i--)
+      {
+         b[0] = _mm_aesdec_si128(b[0], k[i]);
+      }
+
+      //The last round differs slightly from the first rounds
+      b[0] = _mm_aesdeclast_si128(b[0], k[0]);
+      _mm_storeu_si128((__m128i *) output, b[0]);
+
+      //Next block
+      input += AES_BLOCK_SIZE;
+      output += AES_BLOCK_SIZE;
+      n--;
+   }
+}
+
+
+/**
+ * @brief Encrypt a 16-byte block using AES algorithm
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Plaintext block to encrypt
+ * @param[out] output Ciphertext block resulting from encryption
+ **/
+
+void aesEncryptBlock(AesContext *context, const uint8_t *input, uint8_t *output)
+{
+   //Check whether AES-NI is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AES) != 0)
+   {
+      aesniEncryptBlocks(context, input, output, 1);
+   }
+   else
+   {
+      aesSoftEncryptBlock(context, input, output);
+   }
+}
+
+
+/**
+ * @brief Decrypt a 16-byte block using AES algorithm
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Ciphertext block to decrypt
+ * @param[out] output Plaintext block resulting from decryption
+ **/
+
+void aesDecryptBlock(AesContext *context, const uint8_t *input, uint8_t *output)
+{
+   //Check whether AES-NI is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AES) != 0)
+   {
+      aesniDecryptBlocks(context, input, output, 1);
+   }
+   else
+   {
+      aesSoftDecryptBlock(context, input, output);
+   }
+}
+
+
+/**
+ * @brief Encrypt several 16-byte blocks using AES algorithm
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Plaintext blocks to encrypt
+ * @param[out] output Ciphertext blocks resulting from encryption
+ * @param[in] n Number of blocks
+ **/
+
+void aesEncryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n)
+{
+   //Check whether AES-NI is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AES) != 0)
+   {
+      aesniEncryptBlocks(context, input, output, n);
+   }
+   else
+   {
+      //Process the blocks one at a time
+      for(; n > 0; n--)
+      {
+         aesSoftEncryptBlock(context, input, output);
+         input += AES_BLOCK_SIZE;
+         output += AES_BLOCK_SIZE;
+      }
+   }
+}
+
+
+/**
+ * @brief Decrypt several 16-byte blocks using AES algorithm
+ * @param[in] context Pointer to the AES context
+ * @param[in] input Ciphertext blocks to decrypt
+ * @param[out] output Plaintext blocks resulting from decryption
+ * @param[in] n Number of blocks
+ **/
+
+void aesDecryptBlocks(AesContext *context, const uint8_t *input,
+   uint8_t *output, size_t n)
+{
+   //Check whether AES-NI is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AES) != 0)
+   {
+      aesniDecryptBlocks(context, input, output, n);
+   }
+   else
+   {
+      //Process the blocks one at a time
+      for(; n > 0; n--)
+      {
+         aesSoftDecryptBlock(context, input, output);
+         input += AES_BLOCK_SIZE;
+         output += AES_BLOCK_SIZE;
+      }
+   }
+}
+
+#endif
+#if (GCM_SUPPORT == ENABLED)
+
+/**
+ * @brief Reduction of a 256-bit carry-less product modulo the GCM polynomial
+ * @param[in] t0 Lower half of the product (bit-reflected representation)
+ * @param[in] t3 Upper half of the product (bit-reflected representation)
+ * @return Resulting value
+ **/
+
+X86_64_TARGET("pclmul,sse4.1")
+static __m128i pclmulGfReduce(__m128i t0, __m128i t3)
+{
+   __m128i t1;
+   __m128i t2;
+   __m128i t4;
+
+   //Shift the 256-bit product left by one bit, since the operands are
+   //bit-reflected
+   t1 = _mm_srli_epi32(t0, 31);
+   t2 = _mm_srli_epi32(t3, 31);
+   t0 = _mm_slli_epi32(t0, 1);
+   t3 = _mm_slli_epi32(t3, 1);
+   t4 = _mm_srli_si128(t1, 12);
+   t2 = _mm_slli_si128(t2, 4);
+   t1 = _mm_slli_si128(t1, 4);
+   t0 = _mm_or_si128(t0, t1);
+   t3 = _mm_or_si128(t3, t2);
+   t3 = _mm_or_si128(t3, t4);
+
+   //Reduce the result modulo x^128 + x^7 + x^2 + x + 1 (first phase)
+   t1 = _mm_slli_epi32(t0, 31);
+   t2 = _mm_slli_epi32(t0, 30);
+   t4 = _mm_slli_epi32(t0, 25);
+   t1 = _mm_xor_si128(t1, t2);
+   t1 = _mm_xor_si128(t1, t4);
+   t2 = _mm_srli_si128(t1, 4);
+   t1 = _mm_slli_si128(t1, 12);
+   t0 = _mm_xor_si128(t0, t1);
+
+   //Second phase of the reduction
+   t1 = _mm_srli_epi32(t0, 1);
+   t4 = _mm_srli_epi32(t0, 2);
+   t1 = _mm_xor_si128(t1, t4);
+   t4 = _mm_srli_epi32(t0, 7);
+   t1 = _mm_xor_si128(t1, t4);
+   t1 = _mm_xor_si128(t1, t2);
+   t0 = _mm_xor_si128(t0, t1);
+
+   //Return the resulting value
+   return _mm_xor_si128(t3, t0);
+}
+
+
+/**
+ * @brief Apply GHASH function to several blocks using PCLMULQDQ
+ *
+ * Up to 8 blocks are multiplied by the matching powers of H and summed
+ * before a single reduction takes place (aggregated reduction)
+ *
+ * @param[in] context Pointer to the GCM context
+ * @param[in,out] s GHASH state
+ * @param[in] x Pointer to the 16-byte blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+X86_64_TARGET("pclmul,ssse3,sse4.1")
+static void pclmulGhash(GcmContext *context, uint8_t *s, const uint8_t *x,
+   size_t n)
+{
+   uint_t i;
+   uint_t m;
+   __m128i a;
+   __m128i h;
+   __m128i y;
+   __m128i lo;
+   __m128i mid;
+   __m128i hi;
+   __m128i mask;
+
+   //Byte-reversal mask
+   mask = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+   //Load the GHASH state
+   y = _mm_loadu_si128((const __m128i *) s);
+   y = _mm_shuffle_epi8(y, mask);
+
+   //Process the blocks by groups of 8
+   while(n > 0)
+   {
+      //Number of blocks in the current group
+      m = (uint_t) MIN(n, 8);
+
+      //Clear the accumulators
+      lo = _mm_setzero_si128();
+      mid = _mm_setzero_si128();
+      hi = _mm_setzero_si128();
+
+      //Compute the sum of X(i) * H^(m - i) without intermediate reduction
+      for(i = 0; i < m; i++)
+      {
+         //Load the current block
+         a = _mm_loadu_si128((const __m128i *) (x + i * 16));
+         a = _mm_shuffle_epi8(a, mask);
+
+         //The GHASH state is added to the first block of the group
+         if(i == 0)
+         {
+            a = _mm_xor_si128(a, y);
+         }
+
+         //Load the matching power of H
+         h = _mm_loadu_si128((const __m128i *) context->hPowers[m - 1 - i]);
+
+         //Accumulate the 256-bit carry-less product (schoolbook method)
+         lo = _mm_xor_si128(lo, _mm_clmulepi64_si128(a, h, 0x00));
+         mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, h, 0x10));
+         mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, h, 0x01));
+         hi = _mm_xor_si128(hi, _mm_clmulepi64_si128(a, h, 0x11));
+      }
+
+      //Fold the middle terms
+      lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+      hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+      //Perform a single reduction for the whole group
+      y = pclmulGfReduce(lo, hi);
+
+      //Next group
+      x += m * 16;
+      n -= m;
+   }
+
+   //Save the GHASH state
+   y = _mm_shuffle_epi8(y, mask);
+   _mm_storeu_si128((__m128i *) s, y);
+}
+
+
+/**
+ * @brief Initialize GCM context
+ * @param[in] context Pointer to the GCM context
+ * @param[in] cipherAlgo Cipher algorithm
+ * @param[in] cipherContext Pointer to the cipher algorithm context
+ * @return Error code
+ **/
+
+error_t gcmInit(GcmContext *context, const CipherAlgo *cipherAlgo,
+   void *cipherContext)
+{
+   error_t error;
+   uint_t i;
+   uint8_t h[16];
+
+   //Initialize the precalculated table
+   error = gcmSoftInit(context, cipherAlgo, cipherContext);
+
+   //Check status code
+   if(!error)
+   {
+      //Generate the hash subkey H
+      osMemset(h, 0, 16);
+      cipherAlgo->encryptBlock(cipherContext, h, h);
+
+      //Pre-compute H^1 to H^8 (byte-reversed representation)
+      for(i = 0; i < 8; i++)
+      {
+         //Compute H^(i + 1) = H^i * H
+         if(i > 0)
+         {
+            gcmSoftMul(context, h);
+         }
+
+         //Save the current power of H
+         context->hPowers[i][0] = LOAD32BE(h + 12);
+         context->hPowers[i][1] = LOAD32BE(h + 8);
+         context->hPowers[i][2] = LOAD32BE(h + 4);
+         context->hPowers[i][3] = LOAD32BE(h);
+      }
+
+      //Clear the local copy of the hash subkey
+      osMemset(h, 0, 16);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Multiplication operation in GF(2^128)
+ * @param[in] context Pointer to the GCM context
+ * @param[in, out] x 16-byte block to be multiplied by H
+ **/
+
+void gcmMul(GcmContext *context, uint8_t *x)
+{
+   uint8_t s[16];
+
+   //Check whether PCLMULQDQ is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_PCLMUL) != 0)
+   {
+      //Compute X * H = (0 + X) * H
+      osMemset(s, 0, 16);
+      pclmulGhash(context, s, x, 1);
+      osMemcpy(x, s, 16);
+   }
+   else
+   {
+      gcmSoftMul(context, x);
+   }
+}
+
+
+/**
+ * @brief Apply GHASH function to several complete blocks
+ * @param[in] context Pointer to the GCM context
+ * @param[in,out] s GHASH state
+ * @param[in] x Pointer to the 16-byte blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+void gcmGhash(GcmContext *context, uint8_t *s, const uint8_t *x, size_t n)
+{
+   //Check whether PCLMULQDQ is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_PCLMUL) != 0)
+   {
+      pclmulGhash(context, s, x, n);
+   }
+   else
+   {
+      //Process the blocks one after the other
+      for(; n > 0; n--)
+      {
+         gcmXorBlock(s, s, x, 16);
+         gcmSoftMul(context, s);
+         x += 16;
+      }
+   }
+}
+
+#endif
+#if (CHACHA_SUPPORT == ENABLED)
+
+//Rotate the 32-bit lanes of a 256-bit vector
+#define AVX2_ROL32(a, n) _mm256_or_si256(_mm256_slli_epi32(a, n), \
+   _mm256_srli_epi32(a, 32 - (n)))
+
+//Quarter-round function (8 blocks at a time)
+#define AVX2_QUARTER_ROUND(a, b, c, d) \
+{ \
+   a = _mm256_add_epi32(a, b); \
+   d = _mm256_xor_si256(d, a); \
+   d = _mm256_shuffle_epi8(d, rot16); \
+   c = _mm256_add_epi32(c, d); \
+   b = _mm256_xor_si256(b, c); \
+   b = AVX2_ROL32(b, 12); \
+   a = _mm256_add_epi32(a, b); \
+   d = _mm256_xor_si256(d, a); \
+   d = _mm256_shuffle_epi8(d, rot8); \
+   c = _mm256_add_epi32(c, d); \
+   b = _mm256_xor_si256(b, c); \
+   b = AVX2_ROL32(b, 7); \
+}
+
+
+/**
+ * @brief Generate 8 keystream blocks and XOR them with the input using AVX2
+ * @param[in] context Pointer to the ChaCha context
+ * @param[in] input Pointer to the data to encrypt/decrypt (optional)
+ * @param[out] output Pointer to the resulting data
+ **/
+
+X86_64_TARGET("avx2")
+static void avx2ChachaProcessBlocks(ChachaContext *context,
+   const uint8_t *input, uint8_t *output)
+{
+   uint_t i;
+   uint32_t ctr[2][8];
+   __m256i rot8;
+   __m256i rot16;
+   __m256i t[8];
+   __m256i u[8];
+   __m256i v[16];
+   __m256i w[16];
+
+   //Byte shuffle masks for 8-bit and 16-bit rotations
+   rot8 = _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0,
+      3, 14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+   rot16 = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3,
+      2, 13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+
+   //Each lane uses its own block counter
+   for(i = 0; i < 8; i++)
+   {
+      ctr[0][i] = context->state[12] + i;
+      ctr[1][i] = context->state[13] + (ctr[0][i] < context->state[12]);
+   }
+
+   //Broadcast the state
+   for(i = 0; i < 16; i++)
+   {
+      v[i] = _mm256_set1_epi32(context->state[i]);
+   }
+
+   //Load the block counters
+   v[12] = _mm256_loadu_si256((const __m256i *) ctr[0]);
+   v[13] = _mm256_loadu_si256((const __m256i *) ctr[1]);
+
+   //Copy the state to the working state
+   for(i = 0; i < 16; i++)
+   {
+      w[i] = v[i];
+   }
+
+   //ChaCha runs 8, 12 or 20 rounds, alternating between column rounds and
+   //diagonal rounds
+   for(i = 0; i < context->nr; i += 2)
+   {
+      AVX2_QUARTER_ROUND(w[0], w[4], w[8], w[12]);
+      AVX2_QUARTER_ROUND(w[1], w[5], w[9], w[13]);
+      AVX2_QUARTER_ROUND(w[2], w[6], w[10], w[14]);
+      AVX2_QUARTER_ROUND(w[3], w[7], w[11], w[15]);
+
+      AVX2_QUARTER_ROUND(w[0], w[5], w[10], w[15]);
+      AVX2_QUARTER_ROUND(w[1], w[6], w[11], w[12]);
+      AVX2_QUARTER_ROUND(w[2], w[7], w[8], w[13]);
+      AVX2_QUARTER_ROUND(w[3], w[4], w[9], w[14]);
+   }
+
+   //Add the original input words to the output words
+   for(i = 0; i < 16; i++)
+   {
+      w[i] = _mm256_add_epi32(w[i], v[i]);
+   }
+
+   //Each vector holds the same word of 8 consecutive blocks. Transpose the
+   //two 8x8 matrices so that each vector holds 8 consecutive words of a block
+   for(i = 0; i < 16; i += 8)
+   {
+      t[0] = _mm256_unpacklo_epi32(w[i], w[i + 1]);
+      t[1] = _mm256_unpackhi_epi32(w[i], w[i + 1]);
+      t[2] = _mm256_unpacklo_epi32(w[i + 2], w[i + 3]);
+      t[3] = _mm256_unpackhi_epi32(w[i + 2], w[i + 3]);
+      t[4] = _mm256_unpacklo_epi32(w[i + 4], w[i + 5]);
+      t[5] = _mm256_unpackhi_epi32(w[i + 4], w[i + 5]);
+      t[6] = _mm256_unpacklo_epi32(w[i + 6], w[i + 7]);
+      t[7] = _mm256_unpackhi_epi32(w[i + 6], w[i + 7]);
+
+      u[0] = _mm256_unpacklo_epi64(t[0], t[2]);
+      u[1] = _mm256_unpackhi_epi64(t[0], t[2]);
+      u[2] = _mm256_unpacklo_epi64(t[1], t[3]);
+      u[3] = _mm256_unpackhi_epi64(t[1], t[3]);
+      u[4] = _mm256_unpacklo_epi64(t[4], t[6]);
+      u[5] = _mm256_unpackhi_epi64(t[4], t[6]);
+      u[6] = _mm256_unpacklo_epi64(t[5], t[7]);
+      u[7] = _mm256_unpackhi_epi64(t[5], t[7]);
+
+      w[i] = _mm256_permute2x128_si256(u[0], u[4], 0x20);
+      w[i + 1] = _mm256_permute2x128_si256(u[1], u[5], 0x20);
+      w[i + 2] = _mm256_permute2x128_si256(u[2], u[6], 0x20);
+      w[i + 3] = _mm256_permute2x128_si256(u[3], u[7], 0x20);
+      w[i + 4] = _mm256_permute2x128_si256(u[0], u[4], 0x31);
+      w[i + 5] = _mm256_permute2x128_si256(u[1], u[5], 0x31);
+      w[i + 6] = _mm256_permute2x128_si256(u[2], u[6], 0x31);
+      w[i + 7] = _mm256_permute2x128_si256(u[3], u[7], 0x31);
+   }
+
+   //Serialize the keystream blocks (little-endian order)
+   for(i = 0; i < 8; i++)
+   {
+      //Valid input pointer?
+      if(input != NULL)
+      {
+         //XOR the input data with the keystream
+         w[i] = _mm256_xor_si256(w[i], _mm256_loadu_si256(
+            (const __m256i *) (input + i * 64)));
+
+         w[i + 8] = _mm256_xor_si256(w[i + 8], _mm256_loadu_si256(
+            (const __m256i *) (input + i * 64 + 32)));
+      }
+
+      //Save the resulting data
+      _mm256_storeu_si256((__m256i *) (output + i * 64), w[i]);
+      _mm256_storeu_si256((__m256i *) (output + i * 64 + 32), w[i + 8]);
+   }
+
+   //Update the block counter
+   context->state[12] = ctr[0][7] + 1;
+   context->state[13] = ctr[1][7] + (context->state[12] == 0);
+}
+
+
+/**
+ * @brief Encrypt/decrypt data with the ChaCha algorithm
+ * @param[in] context Pointer to the ChaCha context
+ * @param[in] input Pointer to the data to encrypt/decrypt (optional)
+ * @param[in] output Pointer to the resulting data (optional)
+ * @param[in] length Number of bytes to be processed
+ **/
+
+void chachaCipher(ChachaContext *context, const uint8_t *input,
+   uint8_t *output, size_t length)
+{
+   //Check whether AVX2 is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AVX2) != 0 && output != NULL)
+   {
+      //Consume the remaining bytes of the current keystream block first
+      if(context->pos != 0 && context->pos < 64)
+      {
+         //Compute the number of bytes to process
+         size_t n = MIN(length, 64 - context->pos);
+
+         //Use the portable implementation
+         chachaSoftCipher(context, input, output, n);
+
+         //Advance data pointers
+         input = (input != NULL) ? input + n : NULL;
+         output += n;
+         length -= n;
+      }
+
+      //Process 8 blocks at a time
+      while(length >= 512)
+      {
+         //Generate the keystream
+         avx2ChachaProcessBlocks(context, input, output);
+
+         //Advance data pointers
+         input = (input != NULL) ? input + 512 : NULL;
+         output += 512;
+         length -= 512;
+      }
+   }
+
+   //Process the remaining bytes
+   chachaSoftCipher(context, input, output, length);
+}
+
+#endif
+#endif
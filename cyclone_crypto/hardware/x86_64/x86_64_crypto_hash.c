@@ -0,0 +1,979 @@
+/**
+ * @file x86_64_crypto_hash.c
+ * @brief x86-64 SHA extensions and AVX2 accelerated hash functions
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <immintrin.h>
+#include "core/crypto.h"
+#include "hardware/x86_64/x86_64_crypto.h"
+#include "hardware/x86_64/x86_64_crypto_hash.h"
+#include "hash/hash_algorithms.h"
+#include "xof/keccak.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (X86_64_CRYPTO_HASH_SUPPORT == ENABLED)
+
+//AVX2 rotate right operations
+#define AVX2_ROR32(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), \
+   _mm256_slli_epi32(x, 32 - (n)))
+#define AVX2_ROR64(x, n) _mm256_or_si256(_mm256_srli_epi64(x, n), \
+   _mm256_slli_epi64(x, 64 - (n)))
+
+//AVX2 auxiliary functions (shared by SHA-256 and SHA-512)
+#define AVX2_CH(x, y, z) _mm256_xor_si256(_mm256_and_si256(x, y), \
+   _mm256_andnot_si256(x, z))
+#define AVX2_MAJ(x, y, z) _mm256_or_si256(_mm256_and_si256(x, y), \
+   _mm256_and_si256(z, _mm256_or_si256(x, y)))
+
+#if (SHA1_SUPPORT == ENABLED)
+
+/**
+ * @brief Process several 16-word blocks using SHA extensions
+ * @param[in] context Pointer to the SHA-1 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+X86_64_TARGET("sha,ssse3,sse4.1")
+static void shaniSha1ProcessBlocks(Sha1Context *context, const uint8_t *data,
+   size_t n)
+{
+   uint_t i;
+   __m128i abcd;
+   __m128i abcdSave;
+   __m128i e[2];
+   __m128i eSave;
+   __m128i m[4];
+   __m128i mask;
+
+   //Byte-reversal mask
+   mask = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+   //Load the intermediate hash value
+   abcd = _mm_loadu_si128((const __m128i *) context->h);
+   abcd = _mm_shuffle_epi32(abcd, 0x1B);
+   e[0] = _mm_set_epi32(context->h[4], 0, 0, 0);
+
+   //Process the message blocks one after the other
+   for(; n > 0; n--)
+   {
+      //Save the intermediate hash value
+      abcdSave = abcd;
+      eSave = e[0];
+
+      //SHA-1 operates on 20 groups of 4 rounds
+      for(i = 0; i < 20; i++)
+      {
+         //The first 16 words are read from the message block
+         if(i < 4)
+         {
+            m[i] = _mm_loadu_si128((const __m128i *) (data + i * 16));
+            m[i] = _mm_shuffle_epi8(m[i], mask);
+         }
+
+         //Add the message words to the E value
+         if(i == 0)
+         {
+            e[0] = _mm_add_epi32(e[0], m[0]);
+         }
+         else
+         {
+            e[i % 2] = _mm_sha1nexte_epu32(e[i % 2], m[i % 4]);
+         }
+
+         //Save the current value of ABCD
+         e[(i + 1) % 2] = abcd;
+
+         //Complete the message schedule of the next group
+         if(i >= 3 && i <= 18)
+         {
+            m[(i + 1) % 4] = _mm_sha1msg2_epu32(m[(i + 1) % 4], m[i % 4]);
+         }
+
+         //Perform 4 rounds
+         switch(i / 5)
+         {
+         case 0:
+            abcd = _mm_sha1rnds4_epu32(abcd, e[i % 2], 0);
+            break;
+         case 1:
+            abcd = _mm_sha1rnds4_epu32(abcd, e[i % 2], 1);
+            break;
+         case 2:
+            abcd = _mm_sha1rnds4_epu32(abcd, e[i % 2], 2);
+            break;
+         default:
+            abcd = _mm_sha1rnds4_epu32(abcd, e[i % 2], 3);
+            break;
+         }
+
+         //Prepare the message schedule of the subsequent groups
+         if(i >= 1 && i <= 16)
+         {
+            m[(i + 3) % 4] = _mm_sha1msg1_epu32(m[(i + 3) % 4], m[i % 4]);
+         }
+
+         if(i >= 2 && i <= 17)
+         {
+            m[(i + 2) % 4] = _mm_xor_si128(m[(i + 2) % 4], m[i % 4]);
+         }
+      }
+
+      //Update the hash value
+      e[0] = _mm_sha1nexte_epu32(e[0], eSave);
+      abcd = _mm_add_epi32(abcd, abcdSave);
+
+      //Next block
+      data += 64;
+   }
+
+   //Save the intermediate hash value
+   abcd = _mm_shuffle_epi32(abcd, 0x1B);
+   _mm_storeu_si128((__m128i *) context->h, abcd);
+   context->h[4] = _mm_extract_epi32(e[0], 3);
+}
+
+
+/**
+ * @brief Process several consecutive 16-word blocks
+ * @param[in] context Pointer to the SHA-1 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+void sha1ProcessBlocks(Sha1Context *context, const uint8_t *data, size_t n)
+{
+   //Check whether the SHA extensions are supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_SHA) != 0)
+   {
+      shaniSha1ProcessBlocks(context, data, n);
+   }
+   else
+   {
+      sha1SoftProcessBlocks(context, data, n);
+   }
+}
+
+#endif
+#if (SHA256_SUPPORT == ENABLED || SHA224_SUPPORT == ENABLED)
+
+//SHA-256 constants
+static const uint32_t k[64] =
+{
+   0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+   0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+   0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+   0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+   0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+   0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+   0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+   0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+
+/**
+ * @brief Process several 16-word blocks using SHA extensions
+ * @param[in] context Pointer to the SHA-256 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+X86_64_TARGET("sha,ssse3,sse4.1")
+static void shaniSha256ProcessBlocks(Sha256Context *context,
+   const uint8_t *data, size_t n)
+{
+   uint_t i;
+   __m128i s0;
+   __m128i s1;
+   __m128i s0Save;
+   __m128i s1Save;
+   __m128i temp;
+   __m128i msg;
+   __m128i m[4];
+   __m128i mask;
+
+   //Byte-reversal mask (32-bit words)
+   mask = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+   //The SHA256RNDS2 instruction operates on the ABEF and CDGH words
+   temp = _mm_loadu_si128((const __m128i *) context->h);
+   s1 = _mm_loadu_si128((const __m128i *) (context->h + 4));
+   temp = _mm_shuffle_epi32(temp, 0xB1);
+   s1 = _mm_shuffle_epi32(s1, 0x1B);
+   s0 = _mm_alignr_epi8(temp, s1, 8);
+   s1 = _mm_blend_epi16(s1, temp, 0xF0);
+
+   //Process the message blocks one after the other
+   for(; n > 0; n--)
+   {
+      //Save the intermediate hash value
+      s0Save = s0;
+      s1Save = s1;
+
+      //SHA-256 operates on 16 groups of 4 rounds
+      for(i = 0; i < 16; i++)
+      {
+         //The first 16 words are read from the message block
+         if(i < 4)
+         {
+            m[i] = _mm_loadu_si128((const __m128i *) (data + i * 16));
+            m[i] = _mm_shuffle_epi8(m[i], mask);
+         }
+
+         //Add the round constants
+         msg = _mm_loadu_si128((const __m128i *) (k + i * 4));
+         msg = _mm_add_epi32(msg, m[i % 4]);
+
+         //Perform the first 2 rounds
+         s1 = _mm_sha256rnds2_epu32(s1, s0, msg);
+
+         //Complete the message schedule of the next group
+         if(i >= 3 && i <= 14)
+         {
+            temp = _mm_alignr_epi8(m[i % 4], m[(i + 3) % 4], 4);
+            m[(i + 1) % 4] = _mm_add_epi32(m[(i + 1) % 4], temp);
+            m[(i + 1) % 4] = _mm_sha256msg2_epu32(m[(i + 1) % 4], m[i % 4]);
+         }
+
+         //Perform the last 2 rounds
+         msg = _mm_shuffle_epi32(msg, 0x0E);
+         s0 = _mm_sha256rnds2_epu32(s0, s1, msg);
+
+         //Prepare the message schedule of the subsequent groups
+         if(i >= 1 && i <= 12)
+         {
+            m[(i + 3) % 4] = _mm_sha256msg1_epu32(m[(i + 3) % 4], m[i % 4]);
+         }
+      }
+
+      //Update the hash value
+      s0 = _mm_add_epi32(s0, s0Save);
+      s1 = _mm_add_epi32(s1, s1Save);
+
+      //Next block
+      data += 64;
+   }
+
+   //Convert back to the ABCD and EFGH words
+   temp = _mm_shuffle_epi32(s0, 0x1B);
+   s1 = _mm_shuffle_epi32(s1, 0xB1);
+   s0 = _mm_blend_epi16(temp, s1, 0xF0);
+   s1 = _mm_alignr_epi8(s1, temp, 8);
+
+   //Save the intermediate hash value
+   _mm_storeu_si128((__m128i *) context->h, s0);
+   _mm_storeu_si128((__m128i *) (context->h + 4), s1);
+}
+
+//SHA-256 auxiliary functions (8 lanes)
+#define AVX2_SHA256_SIGMA1(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR32(x, 2), AVX2_ROR32(x, 13)), AVX2_ROR32(x, 22))
+#define AVX2_SHA256_SIGMA2(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR32(x, 6), AVX2_ROR32(x, 11)), AVX2_ROR32(x, 25))
+#define AVX2_SHA256_SIGMA3(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR32(x, 7), AVX2_ROR32(x, 18)), _mm256_srli_epi32(x, 3))
+#define AVX2_SHA256_SIGMA4(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR32(x, 17), AVX2_ROR32(x, 19)), _mm256_srli_epi32(x, 10))
+
+//SHA-256 message schedule (8 lanes)
+#define AVX2_SHA256_W(i) (((i) < 16) ? w[(i) & 0x0F] : (w[(i) & 0x0F] = \
+   _mm256_add_epi32(_mm256_add_epi32(w[(i) & 0x0F], \
+   AVX2_SHA256_SIGMA4(w[((i) + 14) & 0x0F])), _mm256_add_epi32( \
+   w[((i) + 9) & 0x0F], AVX2_SHA256_SIGMA3(w[((i) + 1) & 0x0F])))))
+
+//SHA-256 round function (8 lanes)
+#define AVX2_SHA256_ROUND(a, b, c, d, e, f, g, h, i) \
+{ \
+   h = _mm256_add_epi32(h, _mm256_add_epi32(AVX2_SHA256_SIGMA2(e), \
+      AVX2_CH(e, f, g))); \
+   h = _mm256_add_epi32(h, _mm256_add_epi32(_mm256_set1_epi32(k[i]), \
+      AVX2_SHA256_W(i))); \
+   d = _mm256_add_epi32(d, h); \
+   h = _mm256_add_epi32(h, _mm256_add_epi32(AVX2_SHA256_SIGMA1(a), \
+      AVX2_MAJ(a, b, c))); \
+}
+
+
+/**
+ * @brief Process blocks from 8 messages in lockstep using AVX2
+ * @param[in] context Array of pointers to the SHA-256 contexts
+ * @param[in] data Array of pointers to the message blocks
+ * @param[in] count Number of contexts (at most 8)
+ * @param[in] n Number of blocks to process for each context
+ **/
+
+X86_64_TARGET("avx2")
+static void avx2Sha256ProcessBlocksMulti(Sha256Context *context[],
+   const uint8_t *data[], uint_t count, size_t n)
+{
+   uint_t i;
+   uint_t j;
+   size_t offset;
+   __m256i a;
+   __m256i b;
+   __m256i c;
+   __m256i d;
+   __m256i e;
+   __m256i f;
+   __m256i g;
+   __m256i h;
+   __m256i s[8];
+   __m256i t[8];
+   __m256i u[8];
+   __m256i w[16];
+   __m256i mask;
+   const uint8_t *p[8];
+   uint32_t temp[8];
+
+   //Byte-reversal mask
+   mask = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+      12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+   //Unused lanes duplicate the first message (the result is discarded)
+   for(j = 0; j < 8; j++)
+   {
+      p[j] = (j < count) ? data[j] : data[0];
+   }
+
+   //Gather the intermediate hash values (one lane per message)
+   for(i = 0; i < 8; i++)
+   {
+      for(j = 0; j < 8; j++)
+      {
+         temp[j] = context[(j < count) ? j : 0]->h[i];
+      }
+
+      s[i] = _mm256_loadu_si256((__m256i *) temp);
+   }
+
+   //Process the message blocks one after the other
+   for(offset = 0; n > 0; n--, offset += 64)
+   {
+      //Each block is loaded as two rows of 8 words
+      for(i = 0; i < 16; i += 8)
+      {
+         //Load one row per message and convert to host byte order
+         for(j = 0; j < 8; j++)
+         {
+            t[j] = _mm256_loadu_si256((__m256i *) (p[j] + offset + i * 4));
+            t[j] = _mm256_shuffle_epi8(t[j], mask);
+         }
+
+         //Transpose the 8x8 matrix so that each vector holds the same word
+         //of the 8 messages
+         for(j = 0; j < 8; j += 4)
+         {
+            u[j] = _mm256_unpacklo_epi32(t[j], t[j + 1]);
+            u[j + 1] = _mm256_unpackhi_epi32(t[j], t[j + 1]);
+            u[j + 2] = _mm256_unpacklo_epi32(t[j + 2], t[j + 3]);
+            u[j + 3] = _mm256_unpackhi_epi32(t[j + 2], t[j + 3]);
+
+            t[j] = _mm256_unpacklo_epi64(u[j], u[j + 2]);
+            t[j + 1] = _mm256_unpackhi_epi64(u[j], u[j + 2]);
+            t[j + 2] = _mm256_unpacklo_epi64(u[j + 1], u[j + 3]);
+            t[j + 3] = _mm256_unpackhi_epi64(u[j + 1], u[j + 3]);
+         }
+
+         for(j = 0; j < 4; j++)
+         {
+            w[i + j] = _mm256_permute2x128_si256(t[j], t[j + 4], 0x20);
+            w[i + j + 4] = _mm256_permute2x128_si256(t[j], t[j + 4], 0x31);
+         }
+      }
+
+      //Initialize the 8 working registers
+      a = s[0];
+      b = s[1];
+      c = s[2];
+      d = s[3];
+      e = s[4];
+      f = s[5];
+      g = s[6];
+      h = s[7];
+
+      //SHA-256 hash computation
+      for(i = 0; i < 64; i += 8)
+      {
+         AVX2_SHA256_ROUND(a, b, c, d, e, f, g, h, i);
+         AVX2_SHA256_ROUND(h, a, b, c, d, e, f, g, i + 1);
+         AVX2_SHA256_ROUND(g, h, a, b, c, d, e, f, i + 2);
+         AVX2_SHA256_ROUND(f, g, h, a, b, c, d, e, i + 3);
+         AVX2_SHA256_ROUND(e, f, g, h, a, b, c, d, i + 4);
+         AVX2_SHA256_ROUND(d, e, f, g, h, a, b, c, i + 5);
+         AVX2_SHA256_ROUND(c, d, e, f, g, h, a, b, i + 6);
+         AVX2_SHA256_ROUND(b, c, d, e, f, g, h, a, i + 7);
+      }
+
+      //Update the hash values
+      s[0] = _mm256_add_epi32(s[0], a);
+      s[1] = _mm256_add_epi32(s[1], b);
+      s[2] = _mm256_add_epi32(s[2], c);
+      s[3] = _mm256_add_epi32(s[3], d);
+      s[4] = _mm256_add_epi32(s[4], e);
+      s[5] = _mm256_add_epi32(s[5], f);
+      s[6] = _mm256_add_epi32(s[6], g);
+      s[7] = _mm256_add_epi32(s[7], h);
+   }
+
+   //Scatter the resulting hash values
+   for(i = 0; i < 8; i++)
+   {
+      _mm256_storeu_si256((__m256i *) temp, s[i]);
+
+      for(j = 0; j < count; j++)
+      {
+         context[j]->h[i] = temp[j];
+      }
+   }
+}
+
+
+
+/**
+ * @brief Process several consecutive 16-word blocks
+ * @param[in] context Pointer to the SHA-256 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+void sha256ProcessBlocks(Sha256Context *context, const uint8_t *data,
+   size_t n)
+{
+   //Check whether the SHA extensions are supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_SHA) != 0)
+   {
+      shaniSha256ProcessBlocks(context, data, n);
+   }
+   else
+   {
+      sha256SoftProcessBlocks(context, data, n);
+   }
+}
+
+
+/**
+ * @brief Process blocks from several messages in lockstep
+ * @param[in] context Array of pointers to the SHA-256 contexts
+ * @param[in] data Array of pointers to the message blocks
+ * @param[in] count Number of contexts (at most SHA256_LANES)
+ * @param[in] n Number of blocks to process for each context
+ **/
+
+void sha256ProcessBlocksMulti(Sha256Context *context[], const uint8_t *data[],
+   uint_t count, size_t n)
+{
+   uint_t i;
+   uint_t m;
+
+   //The SHA extensions outperform AVX2 unless all the lanes are in use
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_SHA) != 0)
+   {
+      m = 8;
+   }
+   else
+   {
+      m = 3;
+   }
+
+   //Check whether the AVX2 instruction set is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AVX2) != 0 && count >= m)
+   {
+      avx2Sha256ProcessBlocksMulti(context, data, count, n);
+   }
+   else if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_SHA) != 0)
+   {
+      //Transform the blocks of each message in turn
+      for(i = 0; i < count; i++)
+      {
+         shaniSha256ProcessBlocks(context[i], data[i], n);
+      }
+   }
+   else
+   {
+      sha256SoftProcessBlocksMulti(context, data, count, n);
+   }
+}
+
+#endif
+#if (SHA512_SUPPORT == ENABLED || SHA384_SUPPORT == ENABLED || \
+   SHA512_224_SUPPORT == ENABLED || SHA512_256_SUPPORT == ENABLED)
+
+//SHA-512 constants
+static const uint64_t k512[80] =
+{
+   0x428A2F98D728AE22, 0x7137449123EF65CD, 0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC,
+   0x3956C25BF348B538, 0x59F111F1B605D019, 0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
+   0xD807AA98A3030242, 0x12835B0145706FBE, 0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2,
+   0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1, 0x9BDC06A725C71235, 0xC19BF174CF692694,
+   0xE49B69C19EF14AD2, 0xEFBE4786384F25E3, 0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
+   0x2DE92C6F592B0275, 0x4A7484AA6EA6E483, 0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
+   0x983E5152EE66DFAB, 0xA831C66D2DB43210, 0xB00327C898FB213F, 0xBF597FC7BEEF0EE4,
+   0xC6E00BF33DA88FC2, 0xD5A79147930AA725, 0x06CA6351E003826F, 0x142929670A0E6E70,
+   0x27B70A8546D22FFC, 0x2E1B21385C26C926, 0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF,
+   0x650A73548BAF63DE, 0x766A0ABB3C77B2A8, 0x81C2C92E47EDAEE6, 0x92722C851482353B,
+   0xA2BFE8A14CF10364, 0xA81A664BBC423001, 0xC24B8B70D0F89791, 0xC76C51A30654BE30,
+   0xD192E819D6EF5218, 0xD69906245565A910, 0xF40E35855771202A, 0x106AA07032BBD1B8,
+   0x19A4C116B8D2D0C8, 0x1E376C085141AB53, 0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8,
+   0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB, 0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
+   0x748F82EE5DEFB2FC, 0x78A5636F43172F60, 0x84C87814A1F0AB72, 0x8CC702081A6439EC,
+   0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9, 0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
+   0xCA273ECEEA26619C, 0xD186B8C721C0C207, 0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178,
+   0x06F067AA72176FBA, 0x0A637DC5A2C898A6, 0x113F9804BEF90DAE, 0x1B710B35131C471B,
+   0x28DB77F523047D84, 0x32CAAB7B40C72493, 0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C,
+   0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A, 0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
+};
+
+//SHA-512 auxiliary functions (4 lanes)
+#define AVX2_SHA512_SIGMA1(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR64(x, 28), AVX2_ROR64(x, 34)), AVX2_ROR64(x, 39))
+#define AVX2_SHA512_SIGMA2(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR64(x, 14), AVX2_ROR64(x, 18)), AVX2_ROR64(x, 41))
+#define AVX2_SHA512_SIGMA3(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR64(x, 1), AVX2_ROR64(x, 8)), _mm256_srli_epi64(x, 7))
+#define AVX2_SHA512_SIGMA4(x) _mm256_xor_si256(_mm256_xor_si256( \
+   AVX2_ROR64(x, 19), AVX2_ROR64(x, 61)), _mm256_srli_epi64(x, 6))
+
+//SHA-512 message schedule (4 lanes)
+#define AVX2_SHA512_W(i) (((i) < 16) ? w[(i) & 0x0F] : (w[(i) & 0x0F] = \
+   _mm256_add_epi64(_mm256_add_epi64(w[(i) & 0x0F], \
+   AVX2_SHA512_SIGMA4(w[((i) + 14) & 0x0F])), _mm256_add_epi64( \
+   w[((i) + 9) & 0x0F], AVX2_SHA512_SIGMA3(w[((i) + 1) & 0x0F])))))
+
+//SHA-512 round function (4 lanes)
+#define AVX2_SHA512_ROUND(a, b, c, d, e, f, g, h, i) \
+{ \
+   h = _mm256_add_epi64(h, _mm256_add_epi64(AVX2_SHA512_SIGMA2(e), \
+      AVX2_CH(e, f, g))); \
+   h = _mm256_add_epi64(h, _mm256_add_epi64( \
+      _mm256_set1_epi64x((int64_t) k512[i]), AVX2_SHA512_W(i))); \
+   d = _mm256_add_epi64(d, h); \
+   h = _mm256_add_epi64(h, _mm256_add_epi64(AVX2_SHA512_SIGMA1(a), \
+      AVX2_MAJ(a, b, c))); \
+}
+
+
+/**
+ * @brief Process blocks from 4 messages in lockstep using AVX2
+ * @param[in] context Array of pointers to the SHA-512 contexts
+ * @param[in] data Array of pointers to the message blocks
+ * @param[in] count Number of contexts (at most 4)
+ * @param[in] n Number of blocks to process for each context
+ **/
+
+X86_64_TARGET("avx2")
+static void avx2Sha512ProcessBlocksMulti(Sha512Context *context[],
+   const uint8_t *data[], uint_t count, size_t n)
+{
+   uint_t i;
+   uint_t j;
+   size_t offset;
+   __m256i a;
+   __m256i b;
+   __m256i c;
+   __m256i d;
+   __m256i e;
+   __m256i f;
+   __m256i g;
+   __m256i h;
+   __m256i s[8];
+   __m256i t[4];
+   __m256i u[4];
+   __m256i w[16];
+   __m256i mask;
+   const uint8_t *p[4];
+   uint64_t temp[4];
+
+   //Byte-reversal mask
+   mask = _mm256_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7,
+      8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+
+   //Unused lanes duplicate the first message (the result is discarded)
+   for(j = 0; j < 4; j++)
+   {
+      p[j] = (j < count) ? data[j] : data[0];
+   }
+
+   //Gather the intermediate hash values (one lane per message)
+   for(i = 0; i < 8; i++)
+   {
+      for(j = 0; j < 4; j++)
+      {
+         temp[j] = context[(j < count) ? j : 0]->h[i];
+      }
+
+      s[i] = _mm256_loadu_si256((__m256i *) temp);
+   }
+
+   //Process the message blocks one after the other
+   for(offset = 0; n > 0; n--, offset += 128)
+   {
+      //Each block is loaded as four rows of 4 words
+      for(i = 0; i < 16; i += 4)
+      {
+         //Load one row per message and convert to host byte order
+         for(j = 0; j < 4; j++)
+         {
+            t[j] = _mm256_loadu_si256((__m256i *) (p[j] + offset + i * 8));
+            t[j] = _mm256_shuffle_epi8(t[j], mask);
+         }
+
+         //Transpose the 4x4 matrix so that each vector holds the same word
+         //of the 4 messages
+         u[0] = _mm256_unpacklo_epi64(t[0], t[1]);
+         u[1] = _mm256_unpackhi_epi64(t[0], t[1]);
+         u[2] = _mm256_unpacklo_epi64(t[2], t[3]);
+         u[3] = _mm256_unpackhi_epi64(t[2], t[3]);
+
+         w[i] = _mm256_permute2x128_si256(u[0], u[2], 0x20);
+         w[i + 1] = _mm256_permute2x128_si256(u[1], u[3], 0x20);
+         w[i + 2] = _mm256_permute2x128_si256(u[0], u[2], 0x31);
+         w[i + 3] = _mm256_permute2x128_si256(u[1], u[3], 0x31);
+      }
+
+      //Initialize the 8 working registers
+      a = s[0];
+      b = s[1];
+      c = s[2];
+      d = s[3];
+      e = s[4];
+      f = s[5];
+      g = s[6];
+      h = s[7];
+
+      //SHA-512 hash computation
+      for(i = 0; i < 80; i += 8)
+      {
+         AVX2_SHA512_ROUND(a, b, c, d, e, f, g, h, i);
+         AVX2_SHA512_ROUND(h, a, b, c, d, e, f, g, i + 1);
+         AVX2_SHA512_ROUND(g, h, a, b, c, d, e, f, i + 2);
+         AVX2_SHA512_ROUND(f, g, h, a, b, c, d, e, i + 3);
+         AVX2_SHA512_ROUND(e, f, g, h, a, b, c, d, i + 4);
+         AVX2_SHA512_ROUND(d, e, f, g, h, a, b, c, i + 5);
+         AVX2_SHA512_ROUND(c, d, e, f, g, h, a, b, i + 6);
+         AVX2_SHA512_ROUND(b, c, d, e, f, g, h, a, i + 7);
+      }
+
+      //Update the hash values
+      s[0] = _mm256_add_epi64(s[0], a);
+      s[1] = _mm256_add_epi64(s[1], b);
+      s[2] = _mm256_add_epi64(s[2], c);
+      s[3] = _mm256_add_epi64(s[3], d);
+      s[4] = _mm256_add_epi64(s[4], e);
+      s[5] = _mm256_add_epi64(s[5], f);
+      s[6] = _mm256_add_epi64(s[6], g);
+      s[7] = _mm256_add_epi64(s[7], h);
+   }
+
+   //Scatter the resulting hash values
+   for(i = 0; i < 8; i++)
+   {
+      _mm256_storeu_si256((__m256i *) temp, s[i]);
+
+      for(j = 0; j < count; j++)
+      {
+         context[j]->h[i] = temp[j];
+      }
+   }
+}
+
+
+/**
+ * @brief Process blocks from several messages in lockstep
+ * @param[in] context Array of pointers to the SHA-512 contexts
+ * @param[in] data Array of pointers to the message blocks
+ * @param[in] count Number of contexts (at most SHA512_LANES)
+ * @param[in] n Number of blocks to process for each context
+ **/
+
+void sha512ProcessBlocksMulti(Sha512Context *context[], const uint8_t *data[],
+   uint_t count, size_t n)
+{
+   //Check whether the AVX2 instruction set is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AVX2) != 0 && count >= 2)
+   {
+      avx2Sha512ProcessBlocksMulti(context, data, count, n);
+   }
+   else
+   {
+      sha512SoftProcessBlocksMulti(context, data, count, n);
+   }
+}
+
+#endif
+#if (KECCAK_SUPPORT == ENABLED && KECCAK_L == 6)
+
+//AVX2 rotate left operation
+#define AVX2_ROL64(x, n) _mm256_or_si256(_mm256_slli_epi64(x, n), \
+   _mm256_srli_epi64(x, 64 - (n)))
+
+//Keccak-p round function (4 lanes)
+#define AVX2_KECCAK_ROUND(A, E, i) \
+{ \
+   c0 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(A##ba, A##ga), \
+      _mm256_xor_si256(A##ka, A##ma)), A##sa); \
+   c1 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(A##be, A##ge), \
+      _mm256_xor_si256(A##ke, A##me)), A##se); \
+   c2 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(A##bi, A##gi), \
+      _mm256_xor_si256(A##ki, A##mi)), A##si); \
+   c3 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(A##bo, A##go), \
+      _mm256_xor_si256(A##ko, A##mo)), A##so); \
+   c4 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(A##bu, A##gu), \
+      _mm256_xor_si256(A##ku, A##mu)), A##su); \
+   d0 = _mm256_xor_si256(c4, AVX2_ROL64(c1, 1)); \
+   d1 = _mm256_xor_si256(c0, AVX2_ROL64(c2, 1)); \
+   d2 = _mm256_xor_si256(c1, AVX2_ROL64(c3, 1)); \
+   d3 = _mm256_xor_si256(c2, AVX2_ROL64(c4, 1)); \
+   d4 = _mm256_xor_si256(c3, AVX2_ROL64(c0, 1)); \
+   A##ba = _mm256_xor_si256(A##ba, d0); \
+   b0 = A##ba; \
+   A##ge = _mm256_xor_si256(A##ge, d1); \
+   b1 = AVX2_ROL64(A##ge, 44); \
+   A##ki = _mm256_xor_si256(A##ki, d2); \
+   b2 = AVX2_ROL64(A##ki, 43); \
+   A##mo = _mm256_xor_si256(A##mo, d3); \
+   b3 = AVX2_ROL64(A##mo, 21); \
+   A##su = _mm256_xor_si256(A##su, d4); \
+   b4 = AVX2_ROL64(A##su, 14); \
+   E##ba = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2)); \
+   E##be = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3)); \
+   E##bi = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4)); \
+   E##bo = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0)); \
+   E##bu = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1)); \
+   E##ba = _mm256_xor_si256(E##ba, _mm256_set1_epi64x(rc[i])); \
+   A##bo = _mm256_xor_si256(A##bo, d3); \
+   b0 = AVX2_ROL64(A##bo, 28); \
+   A##gu = _mm256_xor_si256(A##gu, d4); \
+   b1 = AVX2_ROL64(A##gu, 20); \
+   A##ka = _mm256_xor_si256(A##ka, d0); \
+   b2 = AVX2_ROL64(A##ka, 3); \
+   A##me = _mm256_xor_si256(A##me, d1); \
+   b3 = AVX2_ROL64(A##me, 45); \
+   A##si = _mm256_xor_si256(A##si, d2); \
+   b4 = AVX2_ROL64(A##si, 61); \
+   E##ga = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2)); \
+   E##ge = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3)); \
+   E##gi = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4)); \
+   E##go = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0)); \
+   E##gu = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1)); \
+   A##be = _mm256_xor_si256(A##be, d1); \
+   b0 = AVX2_ROL64(A##be, 1); \
+   A##gi = _mm256_xor_si256(A##gi, d2); \
+   b1 = AVX2_ROL64(A##gi, 6); \
+   A##ko = _mm256_xor_si256(A##ko, d3); \
+   b2 = AVX2_ROL64(A##ko, 25); \
+   A##mu = _mm256_xor_si256(A##mu, d4); \
+   b3 = AVX2_ROL64(A##mu, 8); \
+   A##sa = _mm256_xor_si256(A##sa, d0); \
+   b4 = AVX2_ROL64(A##sa, 18); \
+   E##ka = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2)); \
+   E##ke = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3)); \
+   E##ki = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4)); \
+   E##ko = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0)); \
+   E##ku = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1)); \
+   A##bu = _mm256_xor_si256(A##bu, d4); \
+   b0 = AVX2_ROL64(A##bu, 27); \
+   A##ga = _mm256_xor_si256(A##ga, d0); \
+   b1 = AVX2_ROL64(A##ga, 36); \
+   A##ke = _mm256_xor_si256(A##ke, d1); \
+   b2 = AVX2_ROL64(A##ke, 10); \
+   A##mi = _mm256_xor_si256(A##mi, d2); \
+   b3 = AVX2_ROL64(A##mi, 15); \
+   A##so = _mm256_xor_si256(A##so, d3); \
+   b4 = AVX2_ROL64(A##so, 56); \
+   E##ma = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2)); \
+   E##me = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3)); \
+   E##mi = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4)); \
+   E##mo = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0)); \
+   E##mu = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1)); \
+   A##bi = _mm256_xor_si256(A##bi, d2); \
+   b0 = AVX2_ROL64(A##bi, 62); \
+   A##go = _mm256_xor_si256(A##go, d3); \
+   b1 = AVX2_ROL64(A##go, 55); \
+   A##ku = _mm256_xor_si256(A##ku, d4); \
+   b2 = AVX2_ROL64(A##ku, 39); \
+   A##ma = _mm256_xor_si256(A##ma, d0); \
+   b3 = AVX2_ROL64(A##ma, 41); \
+   A##se = _mm256_xor_si256(A##se, d1); \
+   b4 = AVX2_ROL64(A##se, 2); \
+   E##sa = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2)); \
+   E##se = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3)); \
+   E##si = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4)); \
+   E##so = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0)); \
+   E##su = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1)); \
+}
+
+//Keccak round constants
+static const uint64_t rc[24] =
+{
+   0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+   0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+   0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+   0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+   0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+   0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+};
+
+
+/**
+ * @brief Permute the state arrays of 4 Keccak instances in lockstep using AVX2
+ * @param[in] context Array of pointers to the Keccak contexts
+ * @param[in] count Number of contexts (at most 4)
+ **/
+
+X86_64_TARGET("avx2")
+static void avx2KeccakPermutBlockMulti(KeccakContext *context[], uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   __m256i aba, abe, abi, abo, abu;
+   __m256i aga, age, agi, ago, agu;
+   __m256i aka, ake, aki, ako, aku;
+   __m256i ama, ame, ami, amo, amu;
+   __m256i asa, ase, asi, aso, asu;
+   __m256i eba, ebe, ebi, ebo, ebu;
+   __m256i ega, ege, egi, ego, egu;
+   __m256i eka, eke, eki, eko, eku;
+   __m256i ema, eme, emi, emo, emu;
+   __m256i esa, ese, esi, eso, esu;
+   __m256i c0, c1, c2, c3, c4;
+   __m256i d0, d1, d2, d3, d4;
+   __m256i b0, b1, b2, b3, b4;
+   __m256i s[25];
+   uint64_t temp[4];
+   KeccakContext *p[4];
+
+   //Unused lanes duplicate the first instance (the result is discarded)
+   for(j = 0; j < 4; j++)
+   {
+      p[j] = (j < count) ? context[j] : context[0];
+   }
+
+   //Gather the state arrays (one lane per instance)
+   for(i = 0; i < 25; i++)
+   {
+      s[i] = _mm256_set_epi64x(p[3]->a[i / 5][i % 5], p[2]->a[i / 5][i % 5],
+         p[1]->a[i / 5][i % 5], p[0]->a[i / 5][i % 5]);
+   }
+
+   //Load the state arrays
+   aba = s[0];
+   abe = s[1];
+   abi = s[2];
+   abo = s[3];
+   abu = s[4];
+   aga = s[5];
+   age = s[6];
+   agi = s[7];
+   ago = s[8];
+   agu = s[9];
+   aka = s[10];
+   ake = s[11];
+   aki = s[12];
+   ako = s[13];
+   aku = s[14];
+   ama = s[15];
+   ame = s[16];
+   ami = s[17];
+   amo = s[18];
+   amu = s[19];
+   asa = s[20];
+   ase = s[21];
+   asi = s[22];
+   aso = s[23];
+   asu = s[24];
+
+   //Keccak-p permutation (two rounds per iteration)
+   for(i = 0; i < 24; i += 2)
+   {
+      AVX2_KECCAK_ROUND(a, e, i);
+      AVX2_KECCAK_ROUND(e, a, i + 1);
+   }
+
+   //Save the state arrays
+   s[0] = aba;
+   s[1] = abe;
+   s[2] = abi;
+   s[3] = abo;
+   s[4] = abu;
+   s[5] = aga;
+   s[6] = age;
+   s[7] = agi;
+   s[8] = ago;
+   s[9] = agu;
+   s[10] = aka;
+   s[11] = ake;
+   s[12] = aki;
+   s[13] = ako;
+   s[14] = aku;
+   s[15] = ama;
+   s[16] = ame;
+   s[17] = ami;
+   s[18] = amo;
+   s[19] = amu;
+   s[20] = asa;
+   s[21] = ase;
+   s[22] = asi;
+   s[23] = aso;
+   s[24] = asu;
+
+   //Scatter the resulting state arrays
+   for(i = 0; i < 25; i++)
+   {
+      _mm256_storeu_si256((__m256i *) temp, s[i]);
+
+      for(j = 0; j < count; j++)
+      {
+         context[j]->a[i / 5][i % 5] = temp[j];
+      }
+   }
+}
+
+
+/**
+ * @brief Permute the state arrays of several Keccak instances in lockstep
+ * @param[in] context Array of pointers to the Keccak contexts
+ * @param[in] count Number of contexts (at most KECCAK_LANES)
+ **/
+
+void keccakPermutBlockMulti(KeccakContext *context[], uint_t count)
+{
+   //Check whether the AVX2 instruction set is supported by the CPU
+   if((x86_64CryptoFeatures & X86_64_CPU_FEATURE_AVX2) != 0 && count >= 2)
+   {
+      avx2KeccakPermutBlockMulti(context, count);
+   }
+   else
+   {
+      keccakSoftPermutBlockMulti(context, count);
+   }
+}
+
+#endif
+#endif
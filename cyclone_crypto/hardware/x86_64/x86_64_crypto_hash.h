@@ -0,0 +1,41 @@
+/**
+ * @file x86_64_crypto_hash.h
+ * @brief x86-64 SHA extensions and AVX2 accelerated hash functions
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _X86_64_CRYPTO_HASH_H
+#define _X86_64_CRYPTO_HASH_H
+
+//Dependencies
+#include "core/crypto.h"
+
+//Hash acceleration (SHA extensions and AVX2)
+#ifndef X86_64_CRYPTO_HASH_SUPPORT
+   #define X86_64_CRYPTO_HASH_SUPPORT DISABLED
+#elif (X86_64_CRYPTO_HASH_SUPPORT != ENABLED && X86_64_CRYPTO_HASH_SUPPORT != DISABLED)
+   #error X86_64_CRYPTO_HASH_SUPPORT parameter is not valid
+#endif
+
+#endif
@@ -43,6 +43,17 @@
 #define PARITY(x, y, z) ((x) ^ (y) ^ (z))
 #define MAJ(x, y, z) (((x) & (y)) | ((x) & (z)) | ((y) & (z)))
 
+//Message schedule
+#define SHA1_W(i) (((i) < 16) ? W(i) : (W(i) = ROL32(W((i) + 13) ^ \
+   W((i) + 8) ^ W((i) + 2) ^ W(i), 1)))
+
+//SHA-1 round function
+#define SHA1_ROUND(f, k, a, b, c, d, e, i) \
+{ \
+   e += ROL32(a, 5) + f(b, c, d) + (k) + SHA1_W(i); \
+   b = ROL32(b, 30); \
+}
+
 //SHA-1 padding
 static const uint8_t padding[64] =
 {
@@ -173,28 +184,45 @@ __weak_func void sha1Update(Sha1Context *context, const void *data, size_t lengt
    //Process the incoming data
    while(length > 0)
    {
-      //The buffer can hold at most 64 bytes
-      n = MIN(length, 64 - context->size);
+      //Complete blocks can be processed directly from the input buffer as
+      //long as no data is pending
+      if(context->size == 0 && length >= 64)
+      {
+         //Number of bytes that form complete blocks
+         n = length - (length % 64);
 
-      //Copy the data to the buffer
-      osMemcpy(context->buffer + context->size, data, n);
+         //Transform the 16-word blocks
+         sha1ProcessBlocks(context, data, n / 64);
+
+         //Update the SHA-1 context
+         context->totalSize += n;
+      }
+      else
+      {
+         //The buffer can hold at most 64 bytes
+         n = MIN(length, 64 - context->size);
+
+         //Copy the data to the buffer
+         osMemcpy(context->buffer + context->size, data, n);
+
+         //Update the SHA-1 context
+         context->size += n;
+         context->totalSize += n;
+
+         //Process message in 16-word blocks
+         if(context->size == 64)
+         {
+            //Transform the 16-word block
+            sha1ProcessBlock(context);
+            //Empty the buffer
+            context->size = 0;
+         }
+      }
 
-      //Update the SHA-1 context
-      context->size += n;
-      context->totalSize += n;
       //Advance the data pointer
       data = (uint8_t *) data + n;
       //Remaining bytes to process
       length -= n;
-
-      //Process message in 16-word blocks
-      if(context->size == 64)
-      {
-         //Transform the 16-word block
-         sha1ProcessBlock(context);
-         //Empty the buffer
-         context->size = 0;
-      }
    }
 }
 
@@ -282,66 +310,108 @@ __weak_func void sha1FinalRaw(Sha1Context *context, uint8_t *digest)
 
 __weak_func void sha1ProcessBlock(Sha1Context *context)
 {
-   uint_t i;
-   uint32_t temp;
+   //Transform the 16-word block held in the buffer
+   sha1ProcessBlocks(context, context->buffer, 1);
+}
 
-   //Initialize the 5 working registers
-   uint32_t a = context->h[0];
-   uint32_t b = context->h[1];
-   uint32_t c = context->h[2];
-   uint32_t d = context->h[3];
-   uint32_t e = context->h[4];
 
-   //Process message in 16-word blocks
-   uint32_t *w = context->w;
+/**
+ * @brief Process several consecutive 16-word blocks
+ * @param[in] context Pointer to the SHA-1 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
 
-   //Convert from big-endian byte order to host byte order
-   for(i = 0; i < 16; i++)
-   {
-      w[i] = betoh32(w[i]);
-   }
+__weak_func void sha1ProcessBlocks(Sha1Context *context, const uint8_t *data,
+   size_t n)
+{
+   //Portable implementation
+   sha1SoftProcessBlocks(context, data, n);
+}
+
+
+/**
+ * @brief Process several consecutive 16-word blocks (portable implementation)
+ * @param[in] context Pointer to the SHA-1 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
 
-   //SHA-1 hash computation (alternate method)
-   for(i = 0; i < 80; i++)
+void sha1SoftProcessBlocks(Sha1Context *context, const uint8_t *data,
+   size_t n)
+{
+   uint_t i;
+   uint32_t a;
+   uint32_t b;
+   uint32_t c;
+   uint32_t d;
+   uint32_t e;
+   uint32_t w[16];
+
+   //Process the message blocks one after the other
+   for(; n > 0; n--)
    {
-      //Prepare the message schedule
-      if(i >= 16)
+      //Initialize the 5 working registers
+      a = context->h[0];
+      b = context->h[1];
+      c = context->h[2];
+      d = context->h[3];
+      e = context->h[4];
+
+      //Convert from big-endian byte order to host byte order
+      for(i = 0; i < 16; i++)
       {
-         W(i) = ROL32(W(i + 13) ^ W(i + 8) ^ W(i + 2) ^ W(i), 1);
+         w[i] = LOAD32BE(data + i * 4);
       }
 
-      //Calculate T
-      if(i < 20)
+      //SHA-1 hash computation (the working registers are renamed rather
+      //than shifted, and the message schedule is computed on the fly)
+      for(i = 0; i < 20; i += 5)
       {
-         temp = ROL32(a, 5) + CH(b, c, d) + e + W(i) + k[0];
+         SHA1_ROUND(CH, k[0], a, b, c, d, e, i);
+         SHA1_ROUND(CH, k[0], e, a, b, c, d, i + 1);
+         SHA1_ROUND(CH, k[0], d, e, a, b, c, i + 2);
+         SHA1_ROUND(CH, k[0], c, d, e, a, b, i + 3);
+         SHA1_ROUND(CH, k[0], b, c, d, e, a, i + 4);
       }
-      else if(i < 40)
+
+      for(; i < 40; i += 5)
       {
-         temp = ROL32(a, 5) + PARITY(b, c, d) + e + W(i) + k[1];
+         SHA1_ROUND(PARITY, k[1], a, b, c, d, e, i);
+         SHA1_ROUND(PARITY, k[1], e, a, b, c, d, i + 1);
+         SHA1_ROUND(PARITY, k[1], d, e, a, b, c, i + 2);
+         SHA1_ROUND(PARITY, k[1], c, d, e, a, b, i + 3);
+         SHA1_ROUND(PARITY, k[1], b, c, d, e, a, i + 4);
       }
-      else if(i < 60)
+
+      for(; i < 60; i += 5)
       {
-         temp = ROL32(a, 5) + MAJ(b, c, d) + e + W(i) + k[2];
+         SHA1_ROUND(MAJ, k[2], a, b, c, d, e, i);
+         SHA1_ROUND(MAJ, k[2], e, a, b, c, d, i + 1);
+         SHA1_ROUND(MAJ, k[2], d, e, a, b, c, i + 2);
+         SHA1_ROUND(MAJ, k[2], c, d, e, a, b, i + 3);
+         SHA1_ROUND(MAJ, k[2], b, c, d, e, a, i + 4);
       }
-      else
+
+      for(; i < 80; i += 5)
       {
-         temp = ROL32(a, 5) + PARITY(b, c, d) + e + W(i) + k[3];
+         SHA1_ROUND(PARITY, k[3], a, b, c, d, e, i);
+         SHA1_ROUND(PARITY, k[3], e, a, b, c, d, i + 1);
+         SHA1_ROUND(PARITY, k[3], d, e, a, b, c, i + 2);
+         SHA1_ROUND(PARITY, k[3], c, d, e, a, b, i + 3);
+         SHA1_ROUND(PARITY, k[3], b, c, d, e, a, i + 4);
       }
 
-      //Update working registers
-      e = d;
-      d = c;
-      c = ROL32(b, 30);
-      b = a;
-      a = temp;
-   }
+      //Update the hash value
+      context->h[0] += a;
+      context->h[1] += b;
+      context->h[2] += c;
+      context->h[3] += d;
+      context->h[4] += e;
 
-   //Update the hash value
-   context->h[0] += a;
-   context->h[1] += b;
-   context->h[2] += c;
-   context->h[3] += d;
-   context->h[4] += e;
+      //Next block
+      data += 64;
+   }
 }
 
 #endif
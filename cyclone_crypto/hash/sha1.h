@@ -85,6 +85,12 @@ void sha1Final(Sha1Context *context, uint8_t *digest);
 void sha1FinalRaw(Sha1Context *context, uint8_t *digest);
 void sha1ProcessBlock(Sha1Context *context);
 
+void sha1ProcessBlocks(Sha1Context *context, const uint8_t *data,
+   size_t n);
+
+void sha1SoftProcessBlocks(Sha1Context *context, const uint8_t *data,
+   size_t n);
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -46,6 +46,23 @@
 #define SIGMA3(x) (ROR32(x, 7) ^ ROR32(x, 18) ^ SHR32(x, 3))
 #define SIGMA4(x) (ROR32(x, 17) ^ ROR32(x, 19) ^ SHR32(x, 10))
 
+//Message schedule
+#define SHA256_W(i) (((i) < 16) ? W(i) : (W(i) += SIGMA4(W((i) + 14)) + \
+   W((i) + 9) + SIGMA3(W((i) + 1))))
+
+//SHA-256 round function
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i) \
+{ \
+   h += SIGMA2(e) + CH(e, f, g) + k[i] + SHA256_W(i); \
+   d += h; \
+   h += SIGMA1(a) + MAJ(a, b, c); \
+}
+
+//Vector holding one 32-bit word per lane
+#if (HASH_VECTOR_SUPPORT == ENABLED)
+typedef uint32_t Sha256Vector __attribute__((vector_size(SHA256_LANES * 4)));
+#endif
+
 //SHA-256 padding
 static const uint8_t padding[64] =
 {
@@ -183,28 +200,45 @@ __weak_func void sha256Update(Sha256Context *context, const void *data, size_t l
    //Process the incoming data
    while(length > 0)
    {
-      //The buffer can hold at most 64 bytes
-      n = MIN(length, 64 - context->size);
+      //Complete blocks can be processed directly from the input buffer as
+      //long as no data is pending
+      if(context->size == 0 && length >= 64)
+      {
+         //Number of bytes that form complete blocks
+         n = length - (length % 64);
 
-      //Copy the data to the buffer
-      osMemcpy(context->buffer + context->size, data, n);
+         //Transform the 16-word blocks
+         sha256ProcessBlocks(context, data, n / 64);
+
+         //Update the SHA-256 context
+         context->totalSize += n;
+      }
+      else
+      {
+         //The buffer can hold at most 64 bytes
+         n = MIN(length, 64 - context->size);
+
+         //Copy the data to the buffer
+         osMemcpy(context->buffer + context->size, data, n);
+
+         //Update the SHA-256 context
+         context->size += n;
+         context->totalSize += n;
+
+         //Process message in 16-word blocks
+         if(context->size == 64)
+         {
+            //Transform the 16-word block
+            sha256ProcessBlock(context);
+            //Empty the buffer
+            context->size = 0;
+         }
+      }
 
-      //Update the SHA-256 context
-      context->size += n;
-      context->totalSize += n;
       //Advance the data pointer
       data = (uint8_t *) data + n;
       //Remaining bytes to process
       length -= n;
-
-      //Process message in 16-word blocks
-      if(context->size == 64)
-      {
-         //Transform the 16-word block
-         sha256ProcessBlock(context);
-         //Empty the buffer
-         context->size = 0;
-      }
    }
 }
 
@@ -285,6 +319,285 @@ __weak_func void sha256FinalRaw(Sha256Context *context, uint8_t *digest)
 }
 
 
+/**
+ * @brief Digest several messages of the same length in lockstep
+ * @param[in] data Array of pointers to the messages being hashed
+ * @param[in] length Length of each message
+ * @param[out] digest Array of pointers to the calculated digests
+ * @param[in] count Number of messages
+ * @return Error code
+ **/
+
+error_t sha256ComputeMulti(const void *data[], size_t length, uint8_t *digest[],
+   uint_t count)
+{
+   uint_t i;
+   uint_t m;
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   Sha256Context *context;
+#else
+   Sha256Context context[SHA256_LANES];
+#endif
+   Sha256Context *p[SHA256_LANES];
+
+   //Check parameters
+   if(data == NULL || digest == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a memory buffer to hold one SHA-256 context per lane
+   context = cryptoAllocMem(SHA256_LANES * sizeof(Sha256Context));
+   //Failed to allocate memory?
+   if(context == NULL)
+      return ERROR_OUT_OF_MEMORY;
+#endif
+
+   //Process the messages by groups of SHA256_LANES
+   for(; count > 0; count -= m)
+   {
+      //Number of messages in the current group
+      m = MIN(count, SHA256_LANES);
+
+      //Initialize the SHA-256 contexts
+      for(i = 0; i < m; i++)
+      {
+         p[i] = &context[i];
+         sha256Init(p[i]);
+      }
+
+      //Digest the messages
+      sha256UpdateMulti(p, data, length, m);
+      //Finalize the SHA-256 message digests
+      sha256FinalMulti(p, digest, m);
+
+      //Next group
+      data += m;
+      digest += m;
+   }
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Free previously allocated memory
+   cryptoFreeMem(context);
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Update several SHA-256 contexts in lockstep
+ *
+ * Each context is updated with the same number of bytes taken from its own
+ * buffer. Complete blocks are transformed SHA256_LANES lanes at a time. Contexts
+ * that do not hold the same amount of buffered data are updated one by one
+ *
+ * @param[in] context Array of pointers to the SHA-256 contexts
+ * @param[in] data Array of pointers to the buffers being hashed
+ * @param[in] length Length of each buffer
+ * @param[in] count Number of contexts
+ **/
+
+void sha256UpdateMulti(Sha256Context *context[], const void *data[], size_t length,
+   uint_t count)
+{
+   uint_t i;
+   uint_t m;
+   size_t n;
+   size_t offset;
+   const uint8_t *p[SHA256_LANES];
+
+   //Process the contexts by groups of SHA256_LANES
+   for(; count > 0; count -= m)
+   {
+      //Number of contexts in the current group
+      m = MIN(count, SHA256_LANES);
+
+      //Lockstep processing requires the buffers to be filled at the same level
+      for(i = 1; i < m && context[i]->size == context[0]->size; i++)
+      {
+      }
+
+      //Check whether the contexts can be advanced in lockstep
+      if(i < m)
+      {
+         //Update the contexts one by one
+         for(i = 0; i < m; i++)
+         {
+            sha256Update(context[i], data[i], length);
+         }
+      }
+      else
+      {
+         //Process the incoming data
+         for(offset = 0; offset < length; offset += n)
+         {
+            //Complete blocks are processed directly from the input buffers
+            //as long as no data is pending
+            if(context[0]->size == 0 && (length - offset) >= 64)
+            {
+               //Number of bytes that form complete blocks
+               n = (length - offset) - ((length - offset) % 64);
+
+               //Point to the input buffers
+               for(i = 0; i < m; i++)
+               {
+                  p[i] = (const uint8_t *) data[i] + offset;
+               }
+
+               //Transform the blocks
+               sha256ProcessBlocksMulti(context, p, m, n / 64);
+
+               //Update the SHA-256 contexts
+               for(i = 0; i < m; i++)
+               {
+                  context[i]->totalSize += n;
+               }
+            }
+            else
+            {
+               //The buffers can hold at most 64 bytes
+               n = MIN(length - offset, 64 - context[0]->size);
+
+               //Copy the data to the buffers
+               for(i = 0; i < m; i++)
+               {
+                  osMemcpy(context[i]->buffer + context[i]->size,
+                     (const uint8_t *) data[i] + offset, n);
+
+                  //Update the SHA-256 context
+                  context[i]->size += n;
+                  context[i]->totalSize += n;
+
+                  //Point to the buffered block
+                  p[i] = context[i]->buffer;
+               }
+
+               //Check whether the buffers are full
+               if(context[0]->size == 64)
+               {
+                  //Transform the buffered blocks
+                  sha256ProcessBlocksMulti(context, p, m, 1);
+
+                  //Empty the buffers
+                  for(i = 0; i < m; i++)
+                  {
+                     context[i]->size = 0;
+                  }
+               }
+            }
+         }
+      }
+
+      //Next group
+      context += m;
+      data += m;
+   }
+}
+
+
+/**
+ * @brief Finish several SHA-256 message digests in lockstep
+ * @param[in] context Array of pointers to the SHA-256 contexts
+ * @param[out] digest Array of pointers to the calculated digests (optional)
+ * @param[in] count Number of contexts
+ **/
+
+void sha256FinalMulti(Sha256Context *context[], uint8_t *digest[], uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   uint_t m;
+   size_t paddingSize;
+   uint64_t totalSize;
+   const void *p[SHA256_LANES];
+   const uint8_t *q[SHA256_LANES];
+
+   //Process the contexts by groups of SHA256_LANES
+   for(; count > 0; count -= m)
+   {
+      //Number of contexts in the current group
+      m = MIN(count, SHA256_LANES);
+
+      //Lockstep processing requires the buffers to be filled at the same level
+      for(i = 1; i < m && context[i]->size == context[0]->size; i++)
+      {
+      }
+
+      //Check whether the contexts can be finalized in lockstep
+      if(i < m)
+      {
+         //Finalize the contexts one by one
+         for(i = 0; i < m; i++)
+         {
+            sha256Final(context[i], (digest != NULL) ? digest[i] : NULL);
+         }
+      }
+      else
+      {
+         //Pad the messages so that their length is congruent to 56 modulo 64
+         if(context[0]->size < 56)
+         {
+            paddingSize = 56 - context[0]->size;
+         }
+         else
+         {
+            paddingSize = 64 + 56 - context[0]->size;
+         }
+
+         //All the messages share the same padding string
+         for(i = 0; i < m; i++)
+         {
+            p[i] = padding;
+         }
+
+         //Append padding
+         sha256UpdateMulti(context, p, paddingSize, m);
+
+         //Append the length of the original messages
+         for(i = 0; i < m; i++)
+         {
+            //Length of the original message (before padding)
+            totalSize = (context[i]->totalSize - paddingSize) * 8;
+
+            context[i]->w[14] = htobe32((uint32_t) (totalSize >> 32));
+            context[i]->w[15] = htobe32((uint32_t) totalSize);
+
+            //Point to the last block
+            q[i] = context[i]->buffer;
+         }
+
+         //Calculate the message digests
+         sha256ProcessBlocksMulti(context, q, m, 1);
+
+         //Convert from host byte order to big-endian byte order
+         for(i = 0; i < m; i++)
+         {
+            for(j = 0; j < 8; j++)
+            {
+               context[i]->h[j] = htobe32(context[i]->h[j]);
+            }
+
+            //Copy the resulting digest
+            if(digest != NULL && digest[i] != NULL)
+            {
+               osMemcpy(digest[i], context[i]->digest, SHA256_DIGEST_SIZE);
+            }
+         }
+      }
+
+      //Next group
+      context += m;
+
+      //Advance the digest pointer
+      if(digest != NULL)
+      {
+         digest += m;
+      }
+   }
+}
+
+
 /**
  * @brief Process message in 16-word blocks
  * @param[in] context Pointer to the SHA-256 context
@@ -292,62 +605,230 @@ __weak_func void sha256FinalRaw(Sha256Context *context, uint8_t *digest)
 
 __weak_func void sha256ProcessBlock(Sha256Context *context)
 {
-   uint_t i;
-   uint32_t temp1;
-   uint32_t temp2;
-
-   //Initialize the 8 working registers
-   uint32_t a = context->h[0];
-   uint32_t b = context->h[1];
-   uint32_t c = context->h[2];
-   uint32_t d = context->h[3];
-   uint32_t e = context->h[4];
-   uint32_t f = context->h[5];
-   uint32_t g = context->h[6];
-   uint32_t h = context->h[7];
-
-   //Process message in 16-word blocks
-   uint32_t *w = context->w;
+   //Transform the 16-word block held in the buffer
+   sha256ProcessBlocks(context, context->buffer, 1);
+}
 
-   //Convert from big-endian byte order to host byte order
-   for(i = 0; i < 16; i++)
+
+/**
+ * @brief Process several consecutive 16-word blocks
+ * @param[in] context Pointer to the SHA-256 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+__weak_func void sha256ProcessBlocks(Sha256Context *context, const uint8_t *data,
+   size_t n)
+{
+   //Portable implementation
+   sha256SoftProcessBlocks(context, data, n);
+}
+
+
+/**
+ * @brief Process several consecutive 16-word blocks (portable implementation)
+ * @param[in] context Pointer to the SHA-256 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+void sha256SoftProcessBlocks(Sha256Context *context, const uint8_t *data,
+   size_t n)
+{
+   uint_t i;
+   uint32_t a;
+   uint32_t b;
+   uint32_t c;
+   uint32_t d;
+   uint32_t e;
+   uint32_t f;
+   uint32_t g;
+   uint32_t h;
+   uint32_t w[16];
+
+   //Process the message blocks one after the other
+   for(; n > 0; n--)
    {
-      w[i] = betoh32(w[i]);
+      //Initialize the 8 working registers
+      a = context->h[0];
+      b = context->h[1];
+      c = context->h[2];
+      d = context->h[3];
+      e = context->h[4];
+      f = context->h[5];
+      g = context->h[6];
+      h = context->h[7];
+
+      //Convert from big-endian byte order to host byte order
+      for(i = 0; i < 16; i++)
+      {
+         w[i] = LOAD32BE(data + i * 4);
+      }
+
+      //SHA-256 hash computation (the working registers are renamed rather
+      //than shifted, and the message schedule is computed on the fly)
+      for(i = 0; i < 64; i += 8)
+      {
+         SHA256_ROUND(a, b, c, d, e, f, g, h, i);
+         SHA256_ROUND(h, a, b, c, d, e, f, g, i + 1);
+         SHA256_ROUND(g, h, a, b, c, d, e, f, i + 2);
+         SHA256_ROUND(f, g, h, a, b, c, d, e, i + 3);
+         SHA256_ROUND(e, f, g, h, a, b, c, d, i + 4);
+         SHA256_ROUND(d, e, f, g, h, a, b, c, i + 5);
+         SHA256_ROUND(c, d, e, f, g, h, a, b, i + 6);
+         SHA256_ROUND(b, c, d, e, f, g, h, a, i + 7);
+      }
+
+      //Update the hash value
+      context->h[0] += a;
+      context->h[1] += b;
+      context->h[2] += c;
+      context->h[3] += d;
+      context->h[4] += e;
+      context->h[5] += f;
+      context->h[6] += g;
+      context->h[7] += h;
+
+      //Next block
+      data += 64;
    }
+}
+
+
+
+/**
+ * @brief Process blocks from several messages in lockstep
+ * @param[in] context Array of pointers to the SHA-256 contexts
+ * @param[in] data Array of pointers to the message blocks (one per context)
+ * @param[in] count Number of contexts (at most SHA256_LANES)
+ * @param[in] n Number of blocks to process for each context
+ **/
+
+__weak_func void sha256ProcessBlocksMulti(Sha256Context *context[], const uint8_t *data[],
+   uint_t count, size_t n)
+{
+   //Portable implementation
+   sha256SoftProcessBlocksMulti(context, data, count, n);
+}
+
 
-   //SHA-256 hash computation (alternate method)
-   for(i = 0; i < 64; i++)
+/**
+ * @brief Process blocks from several messages in lockstep (portable
+ *   implementation)
+ * @param[in] context Array of pointers to the SHA-256 contexts
+ * @param[in] data Array of pointers to the message blocks (one per context)
+ * @param[in] count Number of contexts (at most SHA256_LANES)
+ * @param[in] n Number of blocks to process for each context
+ **/
+
+void sha256SoftProcessBlocksMulti(Sha256Context *context[], const uint8_t *data[],
+   uint_t count, size_t n)
+{
+#if (HASH_VECTOR_SUPPORT == ENABLED)
+   uint_t i;
+   uint_t j;
+   size_t offset;
+   Sha256Vector a;
+   Sha256Vector b;
+   Sha256Vector c;
+   Sha256Vector d;
+   Sha256Vector e;
+   Sha256Vector f;
+   Sha256Vector g;
+   Sha256Vector h;
+   Sha256Vector s[8];
+   Sha256Vector w[16];
+   const uint8_t *p[SHA256_LANES];
+
+   //Lockstep processing only pays off when most of the lanes are in use
+   if(count <= SHA256_LANES / 2)
    {
-      //Prepare the message schedule
-      if(i >= 16)
+      //Transform the blocks of each message in turn
+      for(i = 0; i < count; i++)
       {
-         W(i) += SIGMA4(W(i + 14)) + W(i + 9) + SIGMA3(W(i + 1));
+         sha256SoftProcessBlocks(context[i], data[i], n);
+      }
+   }
+   else
+   {
+      //Unused lanes duplicate the first message (the result is discarded)
+      for(j = 0; j < SHA256_LANES; j++)
+      {
+         p[j] = (j < count) ? data[j] : data[0];
       }
 
-      //Calculate T1 and T2
-      temp1 = h + SIGMA2(e) + CH(e, f, g) + k[i] + W(i);
-      temp2 = SIGMA1(a) + MAJ(a, b, c);
-
-      //Update working registers
-      h = g;
-      g = f;
-      f = e;
-      e = d + temp1;
-      d = c;
-      c = b;
-      b = a;
-      a = temp1 + temp2;
+      //Gather the intermediate hash values (one lane per message)
+      for(i = 0; i < 8; i++)
+      {
+         for(j = 0; j < SHA256_LANES; j++)
+         {
+            s[i][j] = context[(j < count) ? j : 0]->h[i];
+         }
+      }
+
+      //Process the message blocks one after the other
+      for(offset = 0; n > 0; n--, offset += 64)
+      {
+         //Convert from big-endian byte order to host byte order
+         for(i = 0; i < 16; i++)
+         {
+            for(j = 0; j < SHA256_LANES; j++)
+            {
+               w[i][j] = LOAD32BE(p[j] + offset + i * 4);
+            }
+         }
+
+         //Initialize the 8 working registers
+         a = s[0];
+         b = s[1];
+         c = s[2];
+         d = s[3];
+         e = s[4];
+         f = s[5];
+         g = s[6];
+         h = s[7];
+
+         //SHA-256 hash computation (all the lanes are processed at once)
+         for(i = 0; i < 64; i += 8)
+         {
+            SHA256_ROUND(a, b, c, d, e, f, g, h, i);
+            SHA256_ROUND(h, a, b, c, d, e, f, g, i + 1);
+            SHA256_ROUND(g, h, a, b, c, d, e, f, i + 2);
+            SHA256_ROUND(f, g, h, a, b, c, d, e, i + 3);
+            SHA256_ROUND(e, f, g, h, a, b, c, d, i + 4);
+            SHA256_ROUND(d, e, f, g, h, a, b, c, i + 5);
+            SHA256_ROUND(c, d, e, f, g, h, a, b, i + 6);
+            SHA256_ROUND(b, c, d, e, f, g, h, a, i + 7);
+         }
+
+         //Update the hash values
+         s[0] += a;
+         s[1] += b;
+         s[2] += c;
+         s[3] += d;
+         s[4] += e;
+         s[5] += f;
+         s[6] += g;
+         s[7] += h;
+      }
+
+      //Scatter the resulting hash values
+      for(i = 0; i < 8; i++)
+      {
+         for(j = 0; j < count; j++)
+         {
+            context[j]->h[i] = s[i][j];
+         }
+      }
    }
+#else
+   uint_t i;
 
-   //Update the hash value
-   context->h[0] += a;
-   context->h[1] += b;
-   context->h[2] += c;
-   context->h[3] += d;
-   context->h[4] += e;
-   context->h[5] += f;
-   context->h[6] += g;
-   context->h[7] += h;
+   //Transform the blocks of each message in turn
+   for(i = 0; i < count; i++)
+   {
+      sha256SoftProcessBlocks(context[i], data[i], n);
+   }
+#endif
 }
-
 #endif
@@ -42,6 +42,8 @@
 #define SHA256_DIGEST_SIZE 32
 //Minimum length of the padding string
 #define SHA256_MIN_PAD_SIZE 9
+//Number of messages processed in lockstep
+#define SHA256_LANES 8
 //Common interface for hash algorithms
 #define SHA256_HASH_ALGO (&sha256HashAlgo)
 
@@ -85,6 +87,26 @@ void sha256Final(Sha256Context *context, uint8_t *digest);
 void sha256FinalRaw(Sha256Context *context, uint8_t *digest);
 void sha256ProcessBlock(Sha256Context *context);
 
+void sha256ProcessBlocks(Sha256Context *context, const uint8_t *data,
+   size_t n);
+
+void sha256SoftProcessBlocks(Sha256Context *context, const uint8_t *data,
+   size_t n);
+
+error_t sha256ComputeMulti(const void *data[], size_t length, uint8_t *digest[],
+   uint_t count);
+
+void sha256UpdateMulti(Sha256Context *context[], const void *data[], size_t length,
+   uint_t count);
+
+void sha256FinalMulti(Sha256Context *context[], uint8_t *digest[], uint_t count);
+
+void sha256ProcessBlocksMulti(Sha256Context *context[], const uint8_t *data[],
+   uint_t count, size_t n);
+
+void sha256SoftProcessBlocksMulti(Sha256Context *context[], const uint8_t *data[],
+   uint_t count, size_t n);
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -47,6 +47,23 @@
 #define SIGMA3(x) (ROR64(x, 1) ^ ROR64(x, 8) ^ SHR64(x, 7))
 #define SIGMA4(x) (ROR64(x, 19) ^ ROR64(x, 61) ^ SHR64(x, 6))
 
+//Message schedule
+#define SHA512_W(i) (((i) < 16) ? W(i) : (W(i) += SIGMA4(W((i) + 14)) + \
+   W((i) + 9) + SIGMA3(W((i) + 1))))
+
+//SHA-512 round function
+#define SHA512_ROUND(a, b, c, d, e, f, g, h, i) \
+{ \
+   h += SIGMA2(e) + CH(e, f, g) + k[i] + SHA512_W(i); \
+   d += h; \
+   h += SIGMA1(a) + MAJ(a, b, c); \
+}
+
+//Vector holding one 64-bit word per lane
+#if (HASH_VECTOR_SUPPORT == ENABLED)
+typedef uint64_t Sha512Vector __attribute__((vector_size(SHA512_LANES * 8)));
+#endif
+
 //SHA-512 padding
 static const uint8_t padding[128] =
 {
@@ -193,28 +210,45 @@ __weak_func void sha512Update(Sha512Context *context, const void *data, size_t l
    //Process the incoming data
    while(length > 0)
    {
-      //The buffer can hold at most 128 bytes
-      n = MIN(length, 128 - context->size);
+      //Complete blocks can be processed directly from the input buffer as
+      //long as no data is pending
+      if(context->size == 0 && length >= 128)
+      {
+         //Number of bytes that form complete blocks
+         n = length - (length % 128);
 
-      //Copy the data to the buffer
-      osMemcpy(context->buffer + context->size, data, n);
+         //Transform the 16-word blocks
+         sha512ProcessBlocks(context, data, n / 128);
+
+         //Update the SHA-512 context
+         context->totalSize += n;
+      }
+      else
+      {
+         //The buffer can hold at most 128 bytes
+         n = MIN(length, 128 - context->size);
+
+         //Copy the data to the buffer
+         osMemcpy(context->buffer + context->size, data, n);
+
+         //Update the SHA-512 context
+         context->size += n;
+         context->totalSize += n;
+
+         //Process message in 16-word blocks
+         if(context->size == 128)
+         {
+            //Transform the 16-word block
+            sha512ProcessBlock(context);
+            //Empty the buffer
+            context->size = 0;
+         }
+      }
 
-      //Update the SHA-512 context
-      context->size += n;
-      context->totalSize += n;
       //Advance the data pointer
       data = (uint8_t *) data + n;
       //Remaining bytes to process
       length -= n;
-
-      //Process message in 16-word blocks
-      if(context->size == 128)
-      {
-         //Transform the 16-word block
-         sha512ProcessBlock(context);
-         //Empty the buffer
-         context->size = 0;
-      }
    }
 }
 
@@ -268,69 +302,516 @@ __weak_func void sha512Final(Sha512Context *context, uint8_t *digest)
 }
 
 
+/**
+ * @brief Digest several messages of the same length in lockstep
+ * @param[in] data Array of pointers to the messages being hashed
+ * @param[in] length Length of each message
+ * @param[out] digest Array of pointers to the calculated digests
+ * @param[in] count Number of messages
+ * @return Error code
+ **/
+
+error_t sha512ComputeMulti(const void *data[], size_t length, uint8_t *digest[],
+   uint_t count)
+{
+   uint_t i;
+   uint_t m;
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   Sha512Context *context;
+#else
+   Sha512Context context[SHA512_LANES];
+#endif
+   Sha512Context *p[SHA512_LANES];
+
+   //Check parameters
+   if(data == NULL || digest == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a memory buffer to hold one SHA-512 context per lane
+   context = cryptoAllocMem(SHA512_LANES * sizeof(Sha512Context));
+   //Failed to allocate memory?
+   if(context == NULL)
+      return ERROR_OUT_OF_MEMORY;
+#endif
+
+   //Process the messages by groups of SHA512_LANES
+   for(; count > 0; count -= m)
+   {
+      //Number of messages in the current group
+      m = MIN(count, SHA512_LANES);
+
+      //Initialize the SHA-512 contexts
+      for(i = 0; i < m; i++)
+      {
+         p[i] = &context[i];
+         sha512Init(p[i]);
+      }
+
+      //Digest the messages
+      sha512UpdateMulti(p, data, length, m);
+      //Finalize the SHA-512 message digests
+      sha512FinalMulti(p, digest, m);
+
+      //Next group
+      data += m;
+      digest += m;
+   }
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Free previously allocated memory
+   cryptoFreeMem(context);
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Update several SHA-512 contexts in lockstep
+ *
+ * Each context is updated with the same number of bytes taken from its own
+ * buffer. Complete blocks are transformed SHA512_LANES lanes at a time. Contexts
+ * that do not hold the same amount of buffered data are updated one by one
+ *
+ * @param[in] context Array of pointers to the SHA-512 contexts
+ * @param[in] data Array of pointers to the buffers being hashed
+ * @param[in] length Length of each buffer
+ * @param[in] count Number of contexts
+ **/
+
+void sha512UpdateMulti(Sha512Context *context[], const void *data[], size_t length,
+   uint_t count)
+{
+   uint_t i;
+   uint_t m;
+   size_t n;
+   size_t offset;
+   const uint8_t *p[SHA512_LANES];
+
+   //Process the contexts by groups of SHA512_LANES
+   for(; count > 0; count -= m)
+   {
+      //Number of contexts in the current group
+      m = MIN(count, SHA512_LANES);
+
+      //Lockstep processing requires the buffers to be filled at the same level
+      for(i = 1; i < m && context[i]->size == context[0]->size; i++)
+      {
+      }
+
+      //Check whether the contexts can be advanced in lockstep
+      if(i < m)
+      {
+         //Update the contexts one by one
+         for(i = 0; i < m; i++)
+         {
+            sha512Update(context[i], data[i], length);
+         }
+      }
+      else
+      {
+         //Process the incoming data
+         for(offset = 0; offset < length; offset += n)
+         {
+            //Complete blocks are processed directly from the input buffers
+            //as long as no data is pending
+            if(context[0]->size == 0 && (length - offset) >= 128)
+            {
+               //Number of bytes that form complete blocks
+               n = (length - offset) - ((length - offset) % 128);
+
+               //Point to the input buffers
+               for(i = 0; i < m; i++)
+               {
+                  p[i] = (const uint8_t *) data[i] + offset;
+               }
+
+               //Transform the blocks
+               sha512ProcessBlocksMulti(context, p, m, n / 128);
+
+               //Update the SHA-512 contexts
+               for(i = 0; i < m; i++)
+               {
+                  context[i]->totalSize += n;
+               }
+            }
+            else
+            {
+               //The buffers can hold at most 128 bytes
+               n = MIN(length - offset, 128 - context[0]->size);
+
+               //Copy the data to the buffers
+               for(i = 0; i < m; i++)
+               {
+                  osMemcpy(context[i]->buffer + context[i]->size,
+                     (const uint8_t *) data[i] + offset, n);
+
+                  //Update the SHA-512 context
+                  context[i]->size += n;
+                  context[i]->totalSize += n;
+
+                  //Point to the buffered block
+                  p[i] = context[i]->buffer;
+               }
+
+               //Check whether the buffers are full
+               if(context[0]->size == 128)
+               {
+                  //Transform the buffered blocks
+                  sha512ProcessBlocksMulti(context, p, m, 1);
+
+                  //Empty the buffers
+                  for(i = 0; i < m; i++)
+                  {
+                     context[i]->size = 0;
+                  }
+               }
+            }
+         }
+      }
+
+      //Next group
+      context += m;
+      data += m;
+   }
+}
+
+
+/**
+ * @brief Finish several SHA-512 message digests in lockstep
+ * @param[in] context Array of pointers to the SHA-512 contexts
+ * @param[out] digest Array of pointers to the calculated digests (optional)
+ * @param[in] count Number of contexts
+ **/
+
+void sha512FinalMulti(Sha512Context *context[], uint8_t *digest[], uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   uint_t m;
+   size_t paddingSize;
+   uint64_t totalSize;
+   const void *p[SHA512_LANES];
+   const uint8_t *q[SHA512_LANES];
+
+   //Process the contexts by groups of SHA512_LANES
+   for(; count > 0; count -= m)
+   {
+      //Number of contexts in the current group
+      m = MIN(count, SHA512_LANES);
+
+      //Lockstep processing requires the buffers to be filled at the same level
+      for(i = 1; i < m && context[i]->size == context[0]->size; i++)
+      {
+      }
+
+      //Check whether the contexts can be finalized in lockstep
+      if(i < m)
+      {
+         //Finalize the contexts one by one
+         for(i = 0; i < m; i++)
+         {
+            sha512Final(context[i], (digest != NULL) ? digest[i] : NULL);
+         }
+      }
+      else
+      {
+         //Pad the messages so that their length is congruent to 112 modulo 128
+         if(context[0]->size < 112)
+         {
+            paddingSize = 112 - context[0]->size;
+         }
+         else
+         {
+            paddingSize = 128 + 112 - context[0]->size;
+         }
+
+         //All the messages share the same padding string
+         for(i = 0; i < m; i++)
+         {
+            p[i] = padding;
+         }
+
+         //Append padding
+         sha512UpdateMulti(context, p, paddingSize, m);
+
+         //Append the length of the original messages
+         for(i = 0; i < m; i++)
+         {
+            //Length of the original message (before padding)
+            totalSize = (context[i]->totalSize - paddingSize) * 8;
+
+            context[i]->w[14] = 0;
+            context[i]->w[15] = htobe64(totalSize);
+
+            //Point to the last block
+            q[i] = context[i]->buffer;
+         }
+
+         //Calculate the message digests
+         sha512ProcessBlocksMulti(context, q, m, 1);
+
+         //Convert from host byte order to big-endian byte order
+         for(i = 0; i < m; i++)
+         {
+            for(j = 0; j < 8; j++)
+            {
+               context[i]->h[j] = htobe64(context[i]->h[j]);
+            }
+
+            //Copy the resulting digest
+            if(digest != NULL && digest[i] != NULL)
+            {
+               osMemcpy(digest[i], context[i]->digest, SHA512_DIGEST_SIZE);
+            }
+         }
+      }
+
+      //Next group
+      context += m;
+
+      //Advance the digest pointer
+      if(digest != NULL)
+      {
+         digest += m;
+      }
+   }
+}
+
+
 /**
  * @brief Process message in 16-word blocks
  * @param[in] context Pointer to the SHA-512 context
  **/
 
 __weak_func void sha512ProcessBlock(Sha512Context *context)
+{
+   //Transform the 16-word block held in the buffer
+   sha512ProcessBlocks(context, context->buffer, 1);
+}
+
+
+/**
+ * @brief Process several consecutive 16-word blocks
+ * @param[in] context Pointer to the SHA-512 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+__weak_func void sha512ProcessBlocks(Sha512Context *context, const uint8_t *data,
+   size_t n)
+{
+   //Portable implementation
+   sha512SoftProcessBlocks(context, data, n);
+}
+
+
+/**
+ * @brief Process several consecutive 16-word blocks (portable implementation)
+ * @param[in] context Pointer to the SHA-512 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+void sha512SoftProcessBlocks(Sha512Context *context, const uint8_t *data,
+   size_t n)
 {
    uint_t i;
-   uint64_t temp1;
-   uint64_t temp2;
-
-   //Initialize the 8 working registers
-   uint64_t a = context->h[0];
-   uint64_t b = context->h[1];
-   uint64_t c = context->h[2];
-   uint64_t d = context->h[3];
-   uint64_t e = context->h[4];
-   uint64_t f = context->h[5];
-   uint64_t g = context->h[6];
-   uint64_t h = context->h[7];
-
-   //Process message in 16-word blocks
-   uint64_t *w = context->w;
-
-   //Convert from big-endian byte order to host byte order
-   for(i = 0; i < 16; i++)
+   uint64_t a;
+   uint64_t b;
+   uint64_t c;
+   uint64_t d;
+   uint64_t e;
+   uint64_t f;
+   uint64_t g;
+   uint64_t h;
+   uint64_t w[16];
+
+   //Process the message blocks one after the other
+   for(; n > 0; n--)
    {
-      w[i] = betoh64(w[i]);
+      //Initialize the 8 working registers
+      a = context->h[0];
+      b = context->h[1];
+      c = context->h[2];
+      d = context->h[3];
+      e = context->h[4];
+      f = context->h[5];
+      g = context->h[6];
+      h = context->h[7];
+
+      //Convert from big-endian byte order to host byte order
+      for(i = 0; i < 16; i++)
+      {
+         w[i] = LOAD64BE(data + i * 8);
+      }
+
+      //SHA-512 hash computation (the working registers are renamed rather
+      //than shifted, and the message schedule is computed on the fly)
+      for(i = 0; i < 80; i += 8)
+      {
+         SHA512_ROUND(a, b, c, d, e, f, g, h, i);
+         SHA512_ROUND(h, a, b, c, d, e, f, g, i + 1);
+         SHA512_ROUND(g, h, a, b, c, d, e, f, i + 2);
+         SHA512_ROUND(f, g, h, a, b, c, d, e, i + 3);
+         SHA512_ROUND(e, f, g, h, a, b, c, d, i + 4);
+         SHA512_ROUND(d, e, f, g, h, a, b, c, i + 5);
+         SHA512_ROUND(c, d, e, f, g, h, a, b, i + 6);
+         SHA512_ROUND(b, c, d, e, f, g, h, a, i + 7);
+      }
+
+      //Update the hash value
+      context->h[0] += a;
+      context->h[1] += b;
+      context->h[2] += c;
+      context->h[3] += d;
+      context->h[4] += e;
+      context->h[5] += f;
+      context->h[6] += g;
+      context->h[7] += h;
+
+      //Next block
+      data += 128;
    }
+}
+
+
+
+/**
+ * @brief Process blocks from several messages in lockstep
+ * @param[in] context Array of pointers to the SHA-512 contexts
+ * @param[in] data Array of pointers to the message blocks (one per context)
+ * @param[in] count Number of contexts (at most SHA512_LANES)
+ * @param[in] n Number of blocks to process for each context
+ **/
 
-   //SHA-512 hash computation (alternate method)
-   for(i = 0; i < 80; i++)
+__weak_func void sha512ProcessBlocksMulti(Sha512Context *context[], const uint8_t *data[],
+   uint_t count, size_t n)
+{
+   //Portable implementation
+   sha512SoftProcessBlocksMulti(context, data, count, n);
+}
+
+
+/**
+ * @brief Process blocks from several messages in lockstep (portable
+ *   implementation)
+ * @param[in] context Array of pointers to the SHA-512 contexts
+ * @param[in] data Array of pointers to the message blocks (one per context)
+ * @param[in] count Number of contexts (at most SHA512_LANES)
+ * @param[in] n Number of blocks to process for each context
+ **/
+
+void sha512SoftProcessBlocksMulti(Sha512Context *context[], const uint8_t *data[],
+   uint_t count, size_t n)
+{
+#if (HASH_VECTOR_SUPPORT == ENABLED)
+   uint_t i;
+   uint_t j;
+   size_t offset;
+   Sha512Vector a;
+   Sha512Vector b;
+   Sha512Vector c;
+   Sha512Vector d;
+   Sha512Vector e;
+   Sha512Vector f;
+   Sha512Vector g;
+   Sha512Vector h;
+   Sha512Vector s[8];
+   Sha512Vector w[16];
+   const uint8_t *p[SHA512_LANES];
+
+   //Lockstep processing only pays off when most of the lanes are in use
+   if(count <= SHA512_LANES / 2)
    {
-      //Prepare the message schedule
-      if(i >= 16)
+      //Transform the blocks of each message in turn
+      for(i = 0; i < count; i++)
       {
-         W(i) += SIGMA4(W(i + 14)) + W(i + 9) + SIGMA3(W(i + 1));
+         sha512SoftProcessBlocks(context[i], data[i], n);
+      }
+   }
+   else
+   {
+      //Unused lanes duplicate the first message (the result is discarded)
+      for(j = 0; j < SHA512_LANES; j++)
+      {
+         p[j] = (j < count) ? data[j] : data[0];
       }
 
-      //Calculate T1 and T2
-      temp1 = h + SIGMA2(e) + CH(e, f, g) + k[i] + W(i);
-      temp2 = SIGMA1(a) + MAJ(a, b, c);
-
-      //Update working registers
-      h = g;
-      g = f;
-      f = e;
-      e = d + temp1;
-      d = c;
-      c = b;
-      b = a;
-      a = temp1 + temp2;
+      //Gather the intermediate hash values (one lane per message)
+      for(i = 0; i < 8; i++)
+      {
+         for(j = 0; j < SHA512_LANES; j++)
+         {
+            s[i][j] = context[(j < count) ? j : 0]->h[i];
+         }
+      }
+
+      //Process the message blocks one after the other
+      for(offset = 0; n > 0; n--, offset += 128)
+      {
+         //Convert from big-endian byte order to host byte order
+         for(i = 0; i < 16; i++)
+         {
+            for(j = 0; j < SHA512_LANES; j++)
+            {
+               w[i][j] = LOAD64BE(p[j] + offset + i * 8);
+            }
+         }
+
+         //Initialize the 8 working registers
+         a = s[0];
+         b = s[1];
+         c = s[2];
+         d = s[3];
+         e = s[4];
+         f = s[5];
+         g = s[6];
+         h = s[7];
+
+         //SHA-512 hash computation (all the lanes are processed at once)
+         for(i = 0; i < 80; i += 8)
+         {
+            SHA512_ROUND(a, b, c, d, e, f, g, h, i);
+            SHA512_ROUND(h, a, b, c, d, e, f, g, i + 1);
+            SHA512_ROUND(g, h, a, b, c, d, e, f, i + 2);
+            SHA512_ROUND(f, g, h, a, b, c, d, e, i + 3);
+            SHA512_ROUND(e, f, g, h, a, b, c, d, i + 4);
+            SHA512_ROUND(d, e, f, g, h, a, b, c, i + 5);
+            SHA512_ROUND(c, d, e, f, g, h, a, b, i + 6);
+            SHA512_ROUND(b, c, d, e, f, g, h, a, i + 7);
+         }
+
+         //Update the hash values
+         s[0] += a;
+         s[1] += b;
+         s[2] += c;
+         s[3] += d;
+         s[4] += e;
+         s[5] += f;
+         s[6] += g;
+         s[7] += h;
+      }
+
+      //Scatter the resulting hash values
+      for(i = 0; i < 8; i++)
+      {
+         for(j = 0; j < count; j++)
+         {
+            context[j]->h[i] = s[i][j];
+         }
+      }
    }
+#else
+   uint_t i;
 
-   //Update the hash value
-   context->h[0] += a;
-   context->h[1] += b;
-   context->h[2] += c;
-   context->h[3] += d;
-   context->h[4] += e;
-   context->h[5] += f;
-   context->h[6] += g;
-   context->h[7] += h;
+   //Transform the blocks of each message in turn
+   for(i = 0; i < count; i++)
+   {
+      sha512SoftProcessBlocks(context[i], data[i], n);
+   }
+#endif
 }
-
 #endif
@@ -42,6 +42,8 @@
 #define SHA512_DIGEST_SIZE 64
 //Minimum length of the padding string
 #define SHA512_MIN_PAD_SIZE 17
+//Number of messages processed in lockstep
+#define SHA512_LANES 4
 //Common interface for hash algorithms
 #define SHA512_HASH_ALGO (&sha512HashAlgo)
 
@@ -84,6 +86,26 @@ void sha512Update(Sha512Context *context, const void *data, size_t length);
 void sha512Final(Sha512Context *context, uint8_t *digest);
 void sha512ProcessBlock(Sha512Context *context);
 
+void sha512ProcessBlocks(Sha512Context *context, const uint8_t *data,
+   size_t n);
+
+void sha512SoftProcessBlocks(Sha512Context *context, const uint8_t *data,
+   size_t n);
+
+error_t sha512ComputeMulti(const void *data[], size_t length, uint8_t *digest[],
+   uint_t count);
+
+void sha512UpdateMulti(Sha512Context *context[], const void *data[], size_t length,
+   uint_t count);
+
+void sha512FinalMulti(Sha512Context *context[], uint8_t *digest[], uint_t count);
+
+void sha512ProcessBlocksMulti(Sha512Context *context[], const uint8_t *data[],
+   uint_t count, size_t n);
+
+void sha512SoftProcessBlocksMulti(Sha512Context *context[], const uint8_t *data[],
+   uint_t count, size_t n);
+
 //C++ guard
 #ifdef __cplusplus
 }
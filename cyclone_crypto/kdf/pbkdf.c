@@ -137,6 +137,7 @@ error_t pbkdf1(const HashAlgo *hash, const uint8_t *p, size_t pLen,
 error_t pbkdf2(const HashAlgo *hash, const uint8_t *p, size_t pLen,
    const uint8_t *s, size_t sLen, uint_t c, uint8_t *dk, size_t dkLen)
 {
+   error_t error;
    uint_t i;
    uint_t j;
    uint_t k;
@@ -145,8 +146,10 @@ error_t pbkdf2(const HashAlgo *hash, const uint8_t *p, size_t pLen,
    uint8_t u[MAX_HASH_DIGEST_SIZE];
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
    HmacContext *hmacContext;
+   HmacPreparedKey *hmacKey;
 #else
    HmacContext hmacContext[1];
+   HmacPreparedKey hmacKey[1];
 #endif
 
    //Check parameters
@@ -158,21 +161,29 @@ error_t pbkdf2(const HashAlgo *hash, const uint8_t *p, size_t pLen,
       return ERROR_INVALID_PARAMETER;
 
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
-   //Allocate a memory buffer to hold the HMAC context
-   hmacContext = cryptoAllocMem(sizeof(HmacContext));
+   //Allocate a memory buffer to hold the HMAC context and the pre-processed
+   //password
+   hmacContext = cryptoAllocMem(sizeof(HmacContext) + sizeof(HmacPreparedKey));
    //Failed to allocate memory?
    if(hmacContext == NULL)
       return ERROR_OUT_OF_MEMORY;
+
+   //The pre-processed password immediately follows the HMAC context
+   hmacKey = (HmacPreparedKey *) (hmacContext + 1);
 #endif
 
+   //The password is used as the HMAC key for every invocation of the PRF, so
+   //the padded key blocks only need to be digested once
+   error = hmacPrepareKey(hmacKey, hash, p, pLen);
+
    //For each block of the derived key apply the function F
-   for(i = 1; dkLen > 0; i++)
+   for(i = 1; dkLen > 0 && !error; i++)
    {
       //Calculate the 4-octet encoding of the integer i (MSB first)
       STORE32BE(i, a);
 
       //Compute U1 = PRF(P, S || INT(i))
-      hmacInit(hmacContext, hash, p, pLen);
+      hmacInitPrepared(hmacContext, hmacKey);
       hmacUpdate(hmacContext, s, sLen);
       hmacUpdate(hmacContext, a, 4);
       hmacFinal(hmacContext, u);
@@ -184,7 +195,7 @@ error_t pbkdf2(const HashAlgo *hash, const uint8_t *p, size_t pLen,
       for(j = 1; j < c; j++)
       {
          //Compute U(j) = PRF(P, U(j-1))
-         hmacInit(hmacContext, hash, p, pLen);
+         hmacInitPrepared(hmacContext, hmacKey);
          hmacUpdate(hmacContext, u, hash->digestSize);
          hmacFinal(hmacContext, u);
 
@@ -205,13 +216,16 @@ error_t pbkdf2(const HashAlgo *hash, const uint8_t *p, size_t pLen,
       dkLen -= k;
    }
 
+   //Erase the pre-processed password
+   osMemset(hmacKey, 0, sizeof(HmacPreparedKey));
+
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
    //Free previously allocated memory
    cryptoFreeMem(hmacContext);
 #endif
 
-   //Successful processing
-   return NO_ERROR;
+   //Return status code
+   return error;
 }
 
 #endif
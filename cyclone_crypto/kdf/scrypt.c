@@ -25,6 +25,7 @@
  * @version 2.4.2
  **/
 
+
 //Switch to the appropriate trace level
 #define TRACE_LEVEL CRYPTO_TRACE_LEVEL
 
@@ -33,11 +34,19 @@
 #include "kdf/scrypt.h"
 #include "kdf/pbkdf.h"
 #include "hash/sha256.h"
-#include "cipher/salsa20.h"
 
 //Check crypto library configuration
 #if (SCRYPT_SUPPORT == ENABLED)
 
+//Salsa20 quarter-round function
+#define QUARTER_ROUND(a, b, c, d) \
+{ \
+   b ^= ROL32(a + d, 7); \
+   c ^= ROL32(b + a, 9); \
+   d ^= ROL32(c + b, 13); \
+   a ^= ROL32(d + c, 18); \
+}
+
 
 /**
  * @brief scrypt algorithm
@@ -57,21 +66,16 @@ error_t scrypt(const char_t *password, const uint8_t *salt, size_t saltLen,
 {
    error_t error;
    uint_t i;
+   uint_t numLanes;
    size_t blockSize;
    size_t passwordLen;
    uint8_t *b;
-   uint8_t *v;
-   uint8_t *y;
+   ScryptLane lanes[SCRYPT_MAX_LANES];
 
    //Check parameters
    if(password == NULL || salt == NULL || dk == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //Initialize variables
-   b = NULL;
-   v = NULL;
-   y = NULL;
-
    //The CPU/Memory cost parameter must be larger than 1, a power of 2, and
    //less than 2^(128 * r / 8)
    if(n <= 1 || (n & (n - 1)) != 0)
@@ -92,6 +96,18 @@ error_t scrypt(const char_t *password, const uint8_t *salt, size_t saltLen,
    //Each block consists of 128 * r octets
    blockSize = 128 * r;
 
+#if (SCRYPT_PARALLEL_SUPPORT == ENABLED)
+   //Number of blocks that can be processed concurrently
+   numLanes = MIN(p, SCRYPT_MAX_LANES);
+#else
+   //The blocks are processed one after the other
+   numLanes = 1;
+#endif
+
+   //Initialize variables
+   b = NULL;
+   osMemset(lanes, 0, sizeof(lanes));
+
    //Start of exception handling block
    do
    {
@@ -105,26 +121,31 @@ error_t scrypt(const char_t *password, const uint8_t *salt, size_t saltLen,
          break;
       }
 
-      //Initialize a working array V consisting of N blocks
-      v = cryptoAllocMem(n * blockSize);
-      //Failed to allocate memory?
-      if(v == NULL)
+      //Each concurrent lane requires its own working arrays
+      for(i = 0; i < numLanes; i++)
       {
-         //Report an error
-         error = ERROR_OUT_OF_MEMORY;
-         break;
+         //Initialize a working array V consisting of N blocks, followed by
+         //the working arrays X and Y
+         lanes[i].v = cryptoAllocMem((n + 2) * blockSize);
+         //Failed to allocate memory?
+         if(lanes[i].v == NULL)
+            break;
+
+         lanes[i].r = r;
+         lanes[i].n = n;
       }
 
-      //Initialize a working array Y
-      y = cryptoAllocMem(blockSize);
-      //Failed to allocate memory?
-      if(y == NULL)
+      //The first lane is mandatory, the other ones only save time
+      if(i == 0)
       {
          //Report an error
          error = ERROR_OUT_OF_MEMORY;
          break;
       }
 
+      //Run as many lanes concurrently as working arrays could be allocated
+      numLanes = i;
+
       //Compute B = PBKDF2-HMAC-SHA256(P, S, 1, p * 128 * r)
       error = pbkdf2(SHA256_HASH_ALGO, (const uint8_t *) password,
          passwordLen, salt, saltLen, 1, b, p * blockSize);
@@ -132,12 +153,11 @@ error_t scrypt(const char_t *password, const uint8_t *salt, size_t saltLen,
       if(error)
          break;
 
-      //Iterate as many times as desired
-      for(i = 0; i < p; i++)
-      {
-         //Compute B[i] = scryptROMix(r, B[i], N)
-         scryptRoMix(r, b + i * blockSize, n, v, y);
-      }
+      //Compute B[i] = scryptROMix(r, B[i], N) for each block
+      error = scryptProcessLanes(lanes, numLanes, b, p);
+      //Any error to report?
+      if(error)
+         break;
 
       //Compute DK = PBKDF2-HMAC-SHA256(P, B, 1, dkLen)
       error = pbkdf2(SHA256_HASH_ALGO, (const uint8_t *) password,
@@ -155,125 +175,299 @@ error_t scrypt(const char_t *password, const uint8_t *salt, size_t saltLen,
       cryptoFreeMem(b);
    }
 
-   //Release working array V
-   if(v != NULL)
+   //Release working arrays
+   for(i = 0; i < SCRYPT_MAX_LANES; i++)
    {
-      cryptoFreeMem(v);
+      if(lanes[i].v != NULL)
+      {
+         cryptoFreeMem(lanes[i].v);
+      }
    }
 
-   //Release working array Y
-   if(y != NULL)
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Apply scryptROMix to the p blocks of B
+ * @param[in] lanes Working arrays (one per concurrent lane)
+ * @param[in] numLanes Number of lanes that can be evaluated concurrently
+ * @param[in,out] b Array B consisting of p blocks
+ * @param[in] p Parallelization parameter
+ * @return Error code
+ **/
+
+error_t scryptProcessLanes(ScryptLane *lanes, uint_t numLanes, uint8_t *b,
+   uint_t p)
+{
+   uint_t i;
+   size_t blockSize;
+#if (SCRYPT_PARALLEL_SUPPORT == ENABLED)
+   uint_t j;
+   uint_t numTasks;
+   OsTaskId taskId;
+   OsSemaphore semaphore;
+   OsTaskParameters taskParams;
+#endif
+
+   //Each block consists of 128 * r octets
+   blockSize = 128 * lanes[0].r;
+
+#if (SCRYPT_PARALLEL_SUPPORT == ENABLED)
+   //The blocks are independent of one another
+   if(numLanes > 1)
+   {
+      //The semaphore is released by each task on completion
+      if(!osCreateSemaphore(&semaphore, 0))
+         return ERROR_OUT_OF_RESOURCES;
+
+      //Set task parameters
+      taskParams = OS_TASK_DEFAULT_PARAMS;
+      taskParams.stackSize = SCRYPT_TASK_STACK_SIZE;
+      taskParams.priority = SCRYPT_TASK_PRIORITY;
+
+      //Process the blocks by groups of numLanes
+      for(i = 0; i < p; i += numLanes)
+      {
+         //The calling task processes the first block of the group and hands
+         //out the other ones
+         for(numTasks = 0, j = 1; j < numLanes && (i + j) < p; j++)
+         {
+            lanes[j].b = b + (i + j) * blockSize;
+            lanes[j].semaphore = &semaphore;
+
+            //Create a task
+            taskId = osCreateTask("scrypt", scryptLaneTask, &lanes[j],
+               &taskParams);
+
+            //Unable to create the task?
+            if(taskId == (OsTaskId) OS_INVALID_TASK_ID)
+            {
+               //Process the block in the calling task instead
+               scryptRoMix(lanes[j].r, lanes[j].b, lanes[j].n, lanes[j].v);
+            }
+            else
+            {
+               numTasks++;
+            }
+         }
+
+         //Process the first block of the group
+         scryptRoMix(lanes[0].r, b + i * blockSize, lanes[0].n, lanes[0].v);
+
+         //Wait for the other blocks of the group to be processed
+         for(j = 0; j < numTasks; j++)
+         {
+            osWaitForSemaphore(&semaphore, INFINITE_DELAY);
+         }
+      }
+
+      //Release semaphore
+      osDeleteSemaphore(&semaphore);
+   }
+   else
+#endif
    {
-      cryptoFreeMem(y);
+      //Process the blocks sequentially
+      for(i = 0; i < p; i++)
+      {
+         scryptRoMix(lanes[0].r, b + i * blockSize, lanes[0].n, lanes[0].v);
+      }
    }
 
-   //Return status code
-   return error;
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+#if (SCRYPT_PARALLEL_SUPPORT == ENABLED)
+
+/**
+ * @brief Task applying scryptROMix to a single block
+ * @param[in] param Pointer to the lane
+ **/
+
+void scryptLaneTask(void *param)
+{
+   ScryptLane *lane;
+
+   //Point to the lane
+   lane = (ScryptLane *) param;
+
+   //Compute B[i] = scryptROMix(r, B[i], N)
+   scryptRoMix(lane->r, lane->b, lane->n, lane->v);
+
+   //Notify the calling task
+   osReleaseSemaphore(lane->semaphore);
+
+   //Kill ourselves
+   osDeleteTask(OS_SELF_TASK_ID);
 }
 
+#endif
+
 
 /**
  * @brief scryptROMix algorithm
+ *
+ * The block is converted to 32-bit words once, and scryptBlockMix writes its
+ * output straight into the next slot of V, so that neither the computation
+ * of V nor the second loop copy any block
+ *
  * @param[in] r Block size parameter
  * @param[in,out] b Octet vector of length 128 * r octets
  * @param[in] n CPU/Memory cost parameter
- * @param[in,out] v Working array
- * @param[in,out] y Working array
+ * @param[in,out] v Working array of (N + 2) * 32 * r words
  **/
 
-void scryptRoMix(uint_t r, uint8_t *b, uint_t n, uint8_t *v, uint8_t *y)
+void scryptRoMix(uint_t r, uint8_t *b, uint_t n, uint32_t *v)
 {
    uint_t i;
    uint32_t j;
-   uint8_t *x;
-   size_t blockSize;
+   size_t k;
+   uint32_t *x;
+   uint32_t *y;
 
-   //Each block consists of 128 * r octets
-   blockSize = 128 * r;
+   //Each block consists of 32 * r words
+   k = 32 * r;
 
-   //Let X = B
-   x = b;
+   //The working arrays X and Y follow V
+   x = v + n * k;
+   y = x + k;
 
-   //Compute V array
-   for(i = 0; i < n; i++)
+   //Let V[0] = B
+   for(i = 0; i < k; i++)
    {
-      //Let V[i] = X
-      osMemcpy(v + i * blockSize, x, blockSize);
+      v[i] = LOAD32LE(b + i * 4);
+   }
 
-      //Compute X = scryptBlockMix(r, X)
-      scryptBlockMix(r, x, y);
+   //Compute V[i] = scryptBlockMix(r, V[i - 1])
+   for(i = 1; i < n; i++)
+   {
+      scryptBlockMix(r, v + (i - 1) * k, NULL, v + i * k);
    }
 
-   //Compute B' array
-   for(i = 0; i < n; i++)
+   //Compute X = scryptBlockMix(r, V[N - 1])
+   scryptBlockMix(r, v + (n - 1) * k, NULL, x);
+
+   //N is a power of 2, so the second loop can alternate between X and Y
+   for(i = 0; i < n; i += 2)
    {
       //Compute j = Integerify(X) mod N
-      j = LOAD32LE(x + blockSize - 64) & (n - 1);
-
-      //Compute T = X xor V[j]
-      scryptXorBlock(x, x, v + j * blockSize, blockSize);
+      j = x[k - 16] & (n - 1);
+      //Compute Y = scryptBlockMix(r, X xor V[j])
+      scryptBlockMix(r, x, v + j * k, y);
+
+      //Compute j = Integerify(Y) mod N
+      j = y[k - 16] & (n - 1);
+      //Compute X = scryptBlockMix(r, Y xor V[j])
+      scryptBlockMix(r, y, v + j * k, x);
+   }
 
-      //Compute X = scryptBlockMix(r, T)
-      scryptBlockMix(r, x, y);
+   //Let B' = X
+   for(i = 0; i < k; i++)
+   {
+      STORE32LE(x[i], b + i * 4);
    }
 }
 
 
 /**
  * @brief scryptBlockMix algorithm
+ *
+ * The output sub-blocks are written directly at their shuffled positions
+ * (Y[0], Y[2], ..., Y[2 * r - 2], Y[1], Y[3], ..., Y[2 * r - 1])
+ *
  * @param[in] r Block size parameter
- * @param[in,out] b Octet vector of length 128 * r octets
- * @param[in,out] y Working array
+ * @param[in] b Input block (32 * r words)
+ * @param[in] c Optional block XORed with the input (NULL if not used)
+ * @param[out] y Output block (32 * r words)
  **/
 
-void scryptBlockMix(uint_t r, uint8_t *b, uint8_t *y)
+void scryptBlockMix(uint_t r, const uint32_t *b, const uint32_t *c,
+   uint32_t *y)
 {
    uint_t i;
-   uint8_t x[64];
+   uint_t j;
+   uint32_t x[16];
 
    //Let X = B[2 * r - 1]
-   osMemcpy(x, b + r * 128 - 64, 64);
+   if(c != NULL)
+   {
+      for(j = 0; j < 16; j++)
+      {
+         x[j] = b[(2 * r - 1) * 16 + j] ^ c[(2 * r - 1) * 16 + j];
+      }
+   }
+   else
+   {
+      osMemcpy(x, b + (2 * r - 1) * 16, 64);
+   }
 
    //Iterate as many times as desired
    for(i = 0; i < (2 * r); i++)
    {
       //Compute T = X xor B[i]
-      scryptXorBlock(x, x, b + i * 64, 64);
+      if(c != NULL)
+      {
+         for(j = 0; j < 16; j++)
+         {
+            x[j] ^= b[i * 16 + j] ^ c[i * 16 + j];
+         }
+      }
+      else
+      {
+         for(j = 0; j < 16; j++)
+         {
+            x[j] ^= b[i * 16 + j];
+         }
+      }
 
       //Salsa20/8 Core is used as the hash function
-      salsa20ProcessBlock(x, x, 8);
+      scryptSalsa8(x);
 
-      //Let Y[i] = X
-      osMemcpy(y + i * 64, x, 64);
-   }
-
-   //Let  B' = (Y[0], Y[2], ..., Y[2 * r - 2], Y[1], Y[3], ..., Y[2 * r - 1])
-   for(i = 0; i < r; i++)
-   {
-      osMemcpy(b + i * 64, y + i * 128, 64);
-      osMemcpy(b + (r + i) * 64, y + i * 128 + 64, 64);
+      //Even sub-blocks go to the first half of the output, odd sub-blocks to
+      //the second half
+      osMemcpy(y + ((i & 1) * r + (i >> 1)) * 16, x, 64);
    }
 }
 
 
 /**
- * @brief XOR operation
- * @param[out] x Block resulting from the XOR operation
- * @param[in] a First block
- * @param[in] b Second block
- * @param[in] n Size of the block
+ * @brief Salsa20/8 core function, operating in place on 32-bit words
+ * @param[in,out] b 16-word block
  **/
 
-void scryptXorBlock(uint8_t *x, const uint8_t *a, const uint8_t *b, size_t n)
+void scryptSalsa8(uint32_t *b)
 {
-   size_t i;
+   uint_t i;
+   uint32_t x[16];
+
+   //Copy the input words to the working state
+   osMemcpy(x, b, 64);
 
-   //Perform XOR operation
-   for(i = 0; i < n; i++)
+   //The Salsa20 core function alternates between column rounds and row rounds
+   for(i = 0; i < 8; i += 2)
    {
-      x[i] = a[i] ^ b[i];
+      //Column round
+      QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+      QUARTER_ROUND(x[5], x[9], x[13], x[1]);
+      QUARTER_ROUND(x[10], x[14], x[2], x[6]);
+      QUARTER_ROUND(x[15], x[3], x[7], x[11]);
+
+      //Row round
+      QUARTER_ROUND(x[0], x[1], x[2], x[3]);
+      QUARTER_ROUND(x[5], x[6], x[7], x[4]);
+      QUARTER_ROUND(x[10], x[11], x[8], x[9]);
+      QUARTER_ROUND(x[15], x[12], x[13], x[14]);
    }
-}
 
+   //Add the original input words to the output words
+   for(i = 0; i < 16; i++)
+   {
+      b[i] += x[i];
+   }
+}
 
 #endif
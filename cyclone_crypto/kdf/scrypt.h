@@ -25,24 +25,76 @@
  * @version 2.4.2
  **/
 
+
 #ifndef _SCRYPT_H
 #define _SCRYPT_H
 
 //Dependencies
 #include "core/crypto.h"
 
+//Parallel evaluation of the p blocks
+#ifndef SCRYPT_PARALLEL_SUPPORT
+   #define SCRYPT_PARALLEL_SUPPORT DISABLED
+#elif (SCRYPT_PARALLEL_SUPPORT != ENABLED && SCRYPT_PARALLEL_SUPPORT != DISABLED)
+   #error SCRYPT_PARALLEL_SUPPORT parameter is not valid
+#endif
+
+//Maximum number of blocks processed concurrently
+#ifndef SCRYPT_MAX_LANES
+   #define SCRYPT_MAX_LANES 4
+#elif (SCRYPT_MAX_LANES < 1)
+   #error SCRYPT_MAX_LANES parameter is not valid
+#endif
+
+//Stack size required to run the scrypt worker tasks
+#ifndef SCRYPT_TASK_STACK_SIZE
+   #define SCRYPT_TASK_STACK_SIZE 256
+#elif (SCRYPT_TASK_STACK_SIZE < 1)
+   #error SCRYPT_TASK_STACK_SIZE parameter is not valid
+#endif
+
+//Priority at which the scrypt worker tasks should run
+#ifndef SCRYPT_TASK_PRIORITY
+   #define SCRYPT_TASK_PRIORITY OS_TASK_PRIORITY_NORMAL
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+
+/**
+ * @brief Working state of a scryptROMix evaluation
+ **/
+
+typedef struct
+{
+   uint_t r;                ///<Block size parameter
+   uint_t n;                ///<CPU/Memory cost parameter
+   uint8_t *b;              ///<Block being processed
+   uint32_t *v;             ///<Working arrays V, X and Y
+#if (SCRYPT_PARALLEL_SUPPORT == ENABLED)
+   OsSemaphore *semaphore;  ///<Released when the block has been processed
+#endif
+} ScryptLane;
+
+
 //scrypt related functions
 error_t scrypt(const char_t *password, const uint8_t *salt, size_t saltLen,
    uint_t n, uint_t r, uint_t p, uint8_t *dk, size_t dkLen);
 
-void scryptRoMix(uint_t r, uint8_t *b, uint_t n, uint8_t *v, uint8_t *y);
-void scryptBlockMix(uint_t r, uint8_t *b, uint8_t *y);
-void scryptXorBlock(uint8_t *x, const uint8_t *a, const uint8_t *b, size_t n);
+error_t scryptProcessLanes(ScryptLane *lanes, uint_t numLanes, uint8_t *b,
+   uint_t p);
+
+void scryptLaneTask(void *param);
+
+void scryptRoMix(uint_t r, uint8_t *b, uint_t n, uint32_t *v);
+
+void scryptBlockMix(uint_t r, const uint32_t *b, const uint32_t *c,
+   uint32_t *y);
+
+void scryptSalsa8(uint32_t *b);
 
 //C++ guard
 #ifdef __cplusplus
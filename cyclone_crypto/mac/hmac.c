@@ -142,6 +142,8 @@ __weak_func error_t hmacInit(HmacContext *context, const HashAlgo *hash,
 
    //Hash algorithm used to compute HMAC
    context->hash = hash;
+   //The key is not pre-processed
+   context->preparedKey = NULL;
 
    //The key is longer than the block size?
    if(keyLen > hash->blockSize)
@@ -181,6 +183,110 @@ __weak_func error_t hmacInit(HmacContext *context, const HashAlgo *hash,
 }
 
 
+/**
+ * @brief Pre-process a HMAC key
+ *
+ * The inner and outer padded keys are digested once for all. The resulting
+ * object can then be used to initialize any number of HMAC computations with
+ * the same key
+ *
+ * @param[out] preparedKey Pre-processed key
+ * @param[in] hash Hash algorithm used to compute HMAC
+ * @param[in] key Key to use in the hash algorithm
+ * @param[in] keyLen Length of the key
+ * @return Error code
+ **/
+
+error_t hmacPrepareKey(HmacPreparedKey *preparedKey, const HashAlgo *hash,
+   const void *key, size_t keyLen)
+{
+   uint_t i;
+   uint8_t block[MAX_HASH_BLOCK_SIZE];
+
+   //Check parameters
+   if(preparedKey == NULL || hash == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the supplied key is valid
+   if(key == NULL && keyLen != 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Hash algorithm used to compute HMAC
+   preparedKey->hash = hash;
+
+   //The key is longer than the block size?
+   if(keyLen > hash->blockSize)
+   {
+      //Digest the original key
+      hash->init(&preparedKey->innerContext);
+      hash->update(&preparedKey->innerContext, key, keyLen);
+      hash->final(&preparedKey->innerContext, block);
+
+      //Key is padded to the right with extra zeros
+      osMemset(block + hash->digestSize, 0,
+         hash->blockSize - hash->digestSize);
+   }
+   else
+   {
+      //Copy the key
+      osMemcpy(block, key, keyLen);
+      //Key is padded to the right with extra zeros
+      osMemset(block + keyLen, 0, hash->blockSize - keyLen);
+   }
+
+   //XOR the resulting key with ipad
+   for(i = 0; i < hash->blockSize; i++)
+   {
+      block[i] ^= HMAC_IPAD;
+   }
+
+   //Digest the inner pad
+   hash->init(&preparedKey->innerContext);
+   hash->update(&preparedKey->innerContext, block, hash->blockSize);
+
+   //XOR the original key with opad
+   for(i = 0; i < hash->blockSize; i++)
+   {
+      block[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+   }
+
+   //Digest the outer pad
+   hash->init(&preparedKey->outerContext);
+   hash->update(&preparedKey->outerContext, block, hash->blockSize);
+
+   //Clear the padded key
+   osMemset(block, 0, MAX_HASH_BLOCK_SIZE);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Initialize HMAC calculation using a pre-processed key
+ *
+ * This function can also be used to reset a HMAC context so that another
+ * message can be authenticated with the same key
+ *
+ * @param[in] context Pointer to the HMAC context to initialize
+ * @param[in] preparedKey Pre-processed key. The object must remain valid
+ *   until the HMAC computation is complete
+ **/
+
+void hmacInitPrepared(HmacContext *context,
+   const HmacPreparedKey *preparedKey)
+{
+   //Hash algorithm used to compute HMAC
+   context->hash = preparedKey->hash;
+   //Save the pre-processed key
+   context->preparedKey = preparedKey;
+
+   //Restore the state of the hash function after the inner pad
+   osMemcpy(&context->hashContext, &preparedKey->innerContext,
+      preparedKey->hash->contextSize);
+}
+
+
 /**
  * @brief Update the HMAC context with a portion of the message being hashed
  * @param[in] context Pointer to the HMAC context
@@ -215,16 +321,27 @@ __weak_func void hmacFinal(HmacContext *context, uint8_t *digest)
    //Finish the first pass
    hash->final(&context->hashContext, context->digest);
 
-   //XOR the original key with opad
-   for(i = 0; i < hash->blockSize; i++)
+   //Pre-processed key?
+   if(context->preparedKey != NULL)
    {
-      context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      //Restore the state of the hash function after the outer pad
+      osMemcpy(&context->hashContext, &context->preparedKey->outerContext,
+         hash->contextSize);
+   }
+   else
+   {
+      //XOR the original key with opad
+      for(i = 0; i < hash->blockSize; i++)
+      {
+         context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      }
+
+      //Initialize context for the second pass
+      hash->init(&context->hashContext);
+      //Start with outer pad
+      hash->update(&context->hashContext, context->key, hash->blockSize);
    }
 
-   //Initialize context for the second pass
-   hash->init(&context->hashContext);
-   //Start with outer pad
-   hash->update(&context->hashContext, context->key, hash->blockSize);
    //Then digest the result of the first hash
    hash->update(&context->hashContext, context->digest, hash->digestSize);
    //Finish the second pass
@@ -268,16 +385,27 @@ void hmacFinalRaw(HmacContext *context, uint8_t *digest)
    //Hash algorithm used to compute HMAC
    hash = context->hash;
 
-   //XOR the original key with opad
-   for(i = 0; i < hash->blockSize; i++)
+   //Pre-processed key?
+   if(context->preparedKey != NULL)
+   {
+      //Restore the state of the hash function after the outer pad
+      osMemcpy(&context->hashContext, &context->preparedKey->outerContext,
+         hash->contextSize);
+   }
+   else
    {
-      context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      //XOR the original key with opad
+      for(i = 0; i < hash->blockSize; i++)
+      {
+         context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      }
+
+      //Initialize context for the second pass
+      hash->init(&context->hashContext);
+      //Start with outer pad
+      hash->update(&context->hashContext, context->key, hash->blockSize);
    }
 
-   //Initialize context for the second pass
-   hash->init(&context->hashContext);
-   //Start with outer pad
-   hash->update(&context->hashContext, context->key, hash->blockSize);
    //Then digest the result of the first hash
    hash->update(&context->hashContext, context->digest, hash->digestSize);
    //Finish the second pass
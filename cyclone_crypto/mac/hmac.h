@@ -48,6 +48,22 @@ extern "C" {
 #endif
 
 
+/**
+ * @brief Pre-processed HMAC key
+ *
+ * Holds the state of the hash function after absorbing the inner and outer
+ * padded keys, so that several messages can be authenticated with the same
+ * key without digesting the padded key blocks again
+ **/
+
+typedef struct
+{
+   const HashAlgo *hash;
+   HashContext innerContext;
+   HashContext outerContext;
+} HmacPreparedKey;
+
+
 /**
  * @brief HMAC algorithm context
  **/
@@ -58,6 +74,7 @@ typedef struct
    HashContext hashContext;
    uint8_t key[MAX_HASH_BLOCK_SIZE];
    uint8_t digest[MAX_HASH_DIGEST_SIZE];
+   const HmacPreparedKey *preparedKey;
    HMAC_PRIVATE_CONTEXT
 } HmacContext;
 
@@ -86,6 +103,12 @@ error_t hmacCompute(const HashAlgo *hash, const void *key, size_t keyLen,
 error_t hmacInit(HmacContext *context, const HashAlgo *hash,
    const void *key, size_t keyLen);
 
+error_t hmacPrepareKey(HmacPreparedKey *preparedKey, const HashAlgo *hash,
+   const void *key, size_t keyLen);
+
+void hmacInitPrepared(HmacContext *context,
+   const HmacPreparedKey *preparedKey);
+
 void hmacUpdate(HmacContext *context, const void *data, size_t length);
 void hmacFinal(HmacContext *context, uint8_t *digest);
 void hmacFinalRaw(HmacContext *context, uint8_t *digest);
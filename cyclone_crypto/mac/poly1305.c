@@ -90,27 +90,41 @@ void poly1305Update(Poly1305Context *context, const void *data, size_t length)
    //Process the incoming data
    while(length > 0)
    {
-      //The buffer can hold at most 16 bytes
-      n = MIN(length, 16 - context->size);
+      //Complete blocks can be processed directly from the input buffer as
+      //long as no data is pending
+      if(context->size == 0 && length >= 16)
+      {
+         //Number of bytes that form complete blocks
+         n = length - (length % 16);
 
-      //Copy the data to the buffer
-      osMemcpy(context->buffer + context->size, data, n);
+         //Transform the 16-byte blocks
+         poly1305ProcessBlocks(context, data, n / 16);
+      }
+      else
+      {
+         //The buffer can hold at most 16 bytes
+         n = MIN(length, 16 - context->size);
+
+         //Copy the data to the buffer
+         osMemcpy(context->buffer + context->size, data, n);
+
+         //Update the Poly1305 context
+         context->size += n;
+
+         //Process message in 16-byte blocks
+         if(context->size == 16)
+         {
+            //Transform the 16-byte block
+            poly1305ProcessBlock(context);
+            //Empty the buffer
+            context->size = 0;
+         }
+      }
 
-      //Update the Poly1305 context
-      context->size += n;
       //Advance the data pointer
       data = (uint8_t *) data + n;
       //Remaining bytes to process
       length -= n;
-
-      //Process message in 16-byte blocks
-      if(context->size == 16)
-      {
-         //Transform the 16-byte block
-         poly1305ProcessBlock(context);
-         //Empty the buffer
-         context->size = 0;
-      }
    }
 }
 
@@ -203,38 +217,24 @@ void poly1305Final(Poly1305Context *context, uint8_t *tag)
 
 
 /**
- * @brief Process message in 16-byte blocks
+ * @brief Add a 17-byte block to the accumulator and multiply the result by r
  * @param[in] context Pointer to the Poly1305 context
+ * @param[in] data Pointer to the 16 least significant bytes of the block
+ * @param[in] hibit Most significant byte of the block
  **/
 
-void poly1305ProcessBlock(Poly1305Context *context)
+static void poly1305Transform(Poly1305Context *context, const uint8_t *data,
+   uint32_t hibit)
 {
    uint32_t a[5];
    uint32_t r[4];
-   uint_t n;
-
-   //Retrieve the length of the last block
-   n = context->size;
-
-   //Add one bit beyond the number of octets. For a 16-byte block,
-   //this is equivalent to adding 2^128 to the number. For the shorter
-   //block, it can be 2^120, 2^112, or any power of two that is evenly
-   //divisible by 8, all the way down to 2^8
-   context->buffer[n++] = 0x01;
-
-   //If the resulting block is not 17 bytes long (the last block),
-   //pad it with zeros
-   while(n < 17)
-   {
-      context->buffer[n++] = 0x00;
-   }
 
    //Read the block as a little-endian number
-   a[0] = LOAD32LE(context->buffer);
-   a[1] = LOAD32LE(context->buffer + 4);
-   a[2] = LOAD32LE(context->buffer + 8);
-   a[3] = LOAD32LE(context->buffer + 12);
-   a[4] = context->buffer[16];
+   a[0] = LOAD32LE(data);
+   a[1] = LOAD32LE(data + 4);
+   a[2] = LOAD32LE(data + 8);
+   a[3] = LOAD32LE(data + 12);
+   a[4] = hibit;
 
    //Add this number to the accumulator
    context->a[0] += a[0];
@@ -338,4 +338,57 @@ void poly1305ProcessBlock(Poly1305Context *context)
    context->a[4] &= 0x00000003;
 }
 
+
+/**
+ * @brief Process message in 16-byte blocks
+ * @param[in] context Pointer to the Poly1305 context
+ **/
+
+void poly1305ProcessBlock(Poly1305Context *context)
+{
+   uint_t n;
+
+   //Retrieve the length of the last block
+   n = context->size;
+
+   //Add one bit beyond the number of octets. For a 16-byte block,
+   //this is equivalent to adding 2^128 to the number. For the shorter
+   //block, it can be 2^120, 2^112, or any power of two that is evenly
+   //divisible by 8, all the way down to 2^8
+   context->buffer[n++] = 0x01;
+
+   //If the resulting block is not 17 bytes long (the last block),
+   //pad it with zeros
+   while(n < 17)
+   {
+      context->buffer[n++] = 0x00;
+   }
+
+   //Transform the padded block
+   poly1305Transform(context, context->buffer, context->buffer[16]);
+}
+
+
+/**
+ * @brief Process several consecutive 16-byte blocks
+ * @param[in] context Pointer to the Poly1305 context
+ * @param[in] data Pointer to the message blocks
+ * @param[in] n Number of blocks to process
+ **/
+
+void poly1305ProcessBlocks(Poly1305Context *context, const uint8_t *data,
+   size_t n)
+{
+   //Process the blocks one after the other
+   for(; n > 0; n--)
+   {
+      //For a 16-byte block, adding one bit beyond the number of octets is
+      //equivalent to adding 2^128 to the number
+      poly1305Transform(context, data, 0x01);
+
+      //Next block
+      data += 16;
+   }
+}
+
 #endif
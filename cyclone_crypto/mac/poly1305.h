@@ -58,6 +58,9 @@ void poly1305Final(Poly1305Context *context, uint8_t *tag);
 
 void poly1305ProcessBlock(Poly1305Context *context);
 
+void poly1305ProcessBlocks(Poly1305Context *context, const uint8_t *data,
+   size_t n);
+
 //C++ guard
 #ifdef __cplusplus
 }
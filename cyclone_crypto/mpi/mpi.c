@@ -36,6 +36,252 @@
 //Check crypto library configuration
 #if (MPI_SUPPORT == ENABLED)
 
+//Arena attached to the calling task
+#ifdef MPI_ARENA_TASK_LOCAL
+MPI_ARENA_TASK_LOCAL MpiArena *mpiActiveArena = NULL;
+#endif
+
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief Initialize a memory arena
+ *
+ * The arena can be backed by a static or stack buffer. Once entered, it
+ * serves all the MPI allocations until it is left, at which point all the
+ * blocks are released at once. Any integer whose storage is allocated or
+ * grown while the arena is active must therefore be freed before the arena
+ * is left
+ *
+ * @param[out] arena Pointer to the arena to initialize
+ * @param[in] buffer Memory buffer
+ * @param[in] size Size of the memory buffer, in bytes
+ **/
+
+void mpiArenaInit(MpiArena *arena, void *buffer, size_t size)
+{
+   uint_t i;
+   size_t n;
+
+   //Blocks are aligned on 8-byte boundaries
+   n = (8 - ((uintptr_t) buffer & 7)) & 7;
+   n = MIN(n, size);
+
+   //Initialize arena
+   arena->buffer = (uint8_t *) buffer + n;
+   arena->size = (size - n) & ~((size_t) 7);
+   arena->pos = 0;
+   arena->highWaterMark = 0;
+   arena->heapFallbacks = 0;
+   arena->prev = NULL;
+
+   //The free lists are empty
+   for(i = 0; i < MPI_ARENA_NUM_CLASSES; i++)
+   {
+      arena->freeList[i] = NULL;
+   }
+}
+
+
+/**
+ * @brief Attach a memory arena to the calling task
+ * @param[in] arena Pointer to the arena
+ **/
+
+void mpiArenaEnter(MpiArena *arena)
+{
+   //Arenas can be nested. An integer allocated in an outer arena and grown
+   //while the inner arena is active moves to the inner arena, so it must be
+   //freed before the inner arena is left
+   arena->prev = mpiGetActiveArena();
+   //Subsequent MPI allocations are served by the arena
+   mpiSetActiveArena(arena);
+}
+
+
+/**
+ * @brief Detach a memory arena and release all its blocks at once
+ *
+ * No integer allocated or grown while the arena was active may be used or
+ * freed after this call, since its storage is reclaimed with the arena
+ *
+ * @param[in] arena Pointer to the arena
+ **/
+
+void mpiArenaLeave(MpiArena *arena)
+{
+   uint_t i;
+
+   //Erase the contents of the blocks
+   osMemset(arena->buffer, 0, arena->pos);
+
+   //Release all the blocks
+   arena->pos = 0;
+
+   //The free lists are empty
+   for(i = 0; i < MPI_ARENA_NUM_CLASSES; i++)
+   {
+      arena->freeList[i] = NULL;
+   }
+
+   //Restore the previously active arena
+   mpiSetActiveArena(arena->prev);
+   arena->prev = NULL;
+}
+
+
+/**
+ * @brief Get the size class of a memory block
+ * @param[in] size Size of the block, in bytes
+ * @return Size class
+ **/
+
+static uint_t mpiArenaGetClass(size_t size)
+{
+   uint_t i;
+
+   //Blocks are allocated in power-of-two sizes, starting at 16 bytes
+   for(i = 0; i < MPI_ARENA_NUM_CLASSES && ((size_t) 16 << i) < size; i++)
+   {
+   }
+
+   //Return the size class
+   return i;
+}
+
+
+/**
+ * @brief Allocate a memory block from an arena
+ * @param[in] arena Pointer to the arena
+ * @param[in] size Size of the block, in bytes
+ * @return Pointer to the allocated block, or NULL if the arena is exhausted
+ **/
+
+static void *mpiArenaAlloc(MpiArena *arena, size_t size)
+{
+   uint_t i;
+   uint8_t *p;
+
+   //Retrieve the size class of the block
+   i = mpiArenaGetClass(size);
+
+   //Check whether the block size is supported
+   if(i >= MPI_ARENA_NUM_CLASSES)
+   {
+      p = NULL;
+   }
+   else if(arena->freeList[i] != NULL)
+   {
+      //Reuse a previously released block of the same class
+      p = arena->freeList[i];
+      arena->freeList[i] = *((void **) p);
+   }
+   else if(((size_t) 16 << i) <= (arena->size - arena->pos))
+   {
+      //Carve a new block from the unused part of the buffer
+      p = arena->buffer + arena->pos;
+      arena->pos += (size_t) 16 << i;
+
+      //Keep track of the peak usage
+      arena->highWaterMark = MAX(arena->highWaterMark, arena->pos);
+   }
+   else
+   {
+      //The arena is exhausted
+      p = NULL;
+   }
+
+   //Return a pointer to the allocated block
+   return p;
+}
+
+
+/**
+ * @brief Allocate a memory block for an MPI operation
+ * @param[in] size Size of the block, in bytes
+ * @return Pointer to the allocated block
+ **/
+
+static void *mpiAllocMem(size_t size)
+{
+   void *p;
+   MpiArena *arena;
+
+   //Point to the arena attached to the calling task
+   arena = mpiGetActiveArena();
+
+   //Any arena?
+   if(arena != NULL)
+   {
+      //Allocate the block from the arena
+      p = mpiArenaAlloc(arena, size);
+
+      //Fall back to the heap if the arena is exhausted
+      if(p == NULL)
+      {
+         arena->heapFallbacks++;
+         p = cryptoAllocMem(size);
+      }
+   }
+   else
+   {
+      //Allocate the block from the heap
+      p = cryptoAllocMem(size);
+   }
+
+   //Return a pointer to the allocated block
+   return p;
+}
+
+
+/**
+ * @brief Release a memory block used by an MPI operation
+ * @param[in] p Pointer to the block
+ * @param[in] size Size of the block, in bytes
+ **/
+
+static void mpiFreeMem(void *p, size_t size)
+{
+   uint_t i;
+   MpiArena *arena;
+
+   //Search the active arena and the arenas it is nested in for the one
+   //the block was carved from
+   for(arena = mpiGetActiveArena(); arena != NULL; arena = arena->prev)
+   {
+      //Check whether the block belongs to the current arena
+      if((uint8_t *) p >= arena->buffer &&
+         (uint8_t *) p < (arena->buffer + arena->size))
+      {
+         break;
+      }
+   }
+
+   //Any owning arena?
+   if(arena != NULL)
+   {
+      //Retrieve the size class of the block
+      i = mpiArenaGetClass(size);
+
+      //Add the block to the relevant free list
+      *((void **) p) = arena->freeList[i];
+      arena->freeList[i] = p;
+   }
+   else
+   {
+      //Release the block to the heap
+      cryptoFreeMem(p);
+   }
+}
+
+#else
+
+//Without arena support, MPI storage is taken directly from the heap
+#define mpiAllocMem(size) cryptoAllocMem(size)
+#define mpiFreeMem(p, size) cryptoFreeMem(p)
+
+#endif
+
 
 /**
  * @brief Initialize a multiple precision integer
@@ -68,7 +314,7 @@ void mpiFree(Mpi *r)
       osMemset(r->data, 0, r->size * MPI_INT_SIZE);
 
       //Release memory buffer
-      cryptoFreeMem(r->data);
+      mpiFreeMem(r->data, r->size * MPI_INT_SIZE);
       r->data = NULL;
    }
 #else
@@ -106,7 +352,7 @@ error_t mpiGrow(Mpi *r, uint_t size)
    {
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
       //Allocate a new memory buffer
-      data = cryptoAllocMem(size * MPI_INT_SIZE);
+      data = mpiAllocMem(size * MPI_INT_SIZE);
 
       //Successful memory allocation?
       if(data != NULL)
@@ -119,7 +365,7 @@ error_t mpiGrow(Mpi *r, uint_t size)
 
             //Release old memory buffer
             osMemset(r->data, 0, r->size * MPI_INT_SIZE);
-            cryptoFreeMem(r->data);
+            mpiFreeMem(r->data, r->size * MPI_INT_SIZE);
          }
 
          //Clear upper words
@@ -1234,9 +1480,9 @@ error_t mpiShiftRight(Mpi *r, uint_t n)
 __weak_func error_t mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
 {
    error_t error;
-   int_t i;
-   int_t m;
-   int_t n;
+   uint_t m;
+   uint_t n;
+   uint_t *t;
    Mpi ta;
    Mpi tb;
 
@@ -1244,11 +1490,21 @@ __weak_func error_t mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
    mpiInit(&ta);
    mpiInit(&tb);
 
+   //No scratch buffer is allocated by default
+   t = NULL;
+
    //R and A are the same instance?
    if(r == a)
    {
       //Copy A to TA
       MPI_CHECK(mpiCopy(&ta, a));
+
+      //Squaring operation?
+      if(b == a)
+      {
+         b = &ta;
+      }
+
       //Use TA instead of A
       a = &ta;
    }
@@ -1274,23 +1530,26 @@ __weak_func error_t mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
    //Clear the contents of the destination integer
    osMemset(r->data, 0, r->size * MPI_INT_SIZE);
 
-   //Perform multiplication
-   if(m < n)
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Karatsuba multiplication requires a scratch buffer. Schoolbook
+   //multiplication is used if the allocation fails
+   if(m == n && n >= MPI_KARATSUBA_THRESHOLD)
    {
-      for(i = 0; i < m; i++)
-      {
-         mpiMulAccCore(&r->data[i], b->data, n, a->data[i]);
-      }
+      t = mpiAllocMem(mpiKaratsubaScratchSize(n) * MPI_INT_SIZE);
    }
-   else
+#endif
+
+   //Perform multiplication
+   mpiMulCore(r->data, a->data, m, b->data, n, t);
+
+end:
+   //Release scratch buffer
+   if(t != NULL)
    {
-      for(i = 0; i < n; i++)
-      {
-         mpiMulAccCore(&r->data[i], a->data, m, b->data[i]);
-      }
+      osMemset(t, 0, mpiKaratsubaScratchSize(n) * MPI_INT_SIZE);
+      mpiFreeMem(t, mpiKaratsubaScratchSize(n) * MPI_INT_SIZE);
    }
 
-end:
    //Release multiple precision integers
    mpiFree(&ta);
    mpiFree(&tb);
@@ -1659,7 +1918,7 @@ __weak_func error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
    Mpi b;
    Mpi c2;
    Mpi t;
-   Mpi s[8];
+   Mpi s[1 << (MPI_MAX_WINDOW_SIZE - 1)];
 
    //Initialize multiple precision integers
    mpiInit(&b);
@@ -1672,9 +1931,23 @@ __weak_func error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
       mpiInit(&s[i]);
    }
 
+   //Retrieve the length of the exponent
+   k = mpiGetBitLength(e);
+
    //Very small exponents are often selected with low Hamming weight.
    //The sliding window mechanism should be disabled in that case
-   d = (mpiGetBitLength(e) <= 32) ? 1 : 4;
+   if(k <= 32)
+   {
+      d = 1;
+   }
+   else
+   {
+      //Select the window size that minimizes the total number of
+      //multiplications (precomputation and sliding window)
+      d = (k <= 79) ? 3 : (k <= 239) ? 4 : (k <= 671) ? 5 : 6;
+      //Limit the size of the precomputed table
+      d = MIN(d, MPI_MAX_WINDOW_SIZE);
+   }
 
    //Even modulus?
    if(mpiIsEven(p))
@@ -1878,7 +2151,10 @@ error_t mpiMontgomeryMul(Mpi *r, const Mpi *a, const Mpi *b, uint_t k,
    uint_t i;
    uint_t m;
    uint_t n;
+   uint_t l;
    uint_t q;
+   uint_t s;
+   uint_t *u;
 
    //Use Newton's method to compute the inverse of P[0] mod 2^32
    for(m = 2 - p->data[0], i = 0; i < 4; i++)
@@ -1889,38 +2165,46 @@ error_t mpiMontgomeryMul(Mpi *r, const Mpi *a, const Mpi *b, uint_t k,
    //Precompute -1/P[0] mod 2^32;
    m = ~m + 1;
 
-   //We assume that B is always less than 2^k
-   n = MIN(b->size, k);
+   //We assume that A and B are always less than 2^k
+   n = MIN(mpiGetLength(a), k);
+   l = MIN(mpiGetLength(b), k);
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Reserve room for the scratch buffer used by Karatsuba multiplication
+   s = mpiKaratsubaScratchSize(k);
+#else
+   //Karatsuba multiplication is not used with static memory allocation
+   s = 0;
+#endif
 
    //Make sure T is large enough
-   MPI_CHECK(mpiGrow(t, 2 * k + 1));
+   MPI_CHECK(mpiGrow(t, 2 * k + 1 + s));
+
+   //Point to the scratch buffer
+   u = (s > 0) ? t->data + 2 * k + 1 : NULL;
+
    //Let T = 0
-   MPI_CHECK(mpiSetValue(t, 0));
+   osMemset(t->data, 0, (2 * k + 1) * MPI_INT_SIZE);
+
+   //Compute T = A * B (squaring is detected by mpiMulCore)
+   mpiMulCore(t->data, a->data, n, b->data, l, u);
 
-   //Perform Montgomery multiplication
+   //Perform Montgomery reduction
    for(i = 0; i < k; i++)
    {
-      //Check current index
-      if(i < a->size)
-      {
-         //Compute q = ((T[i] + A[i] * B[0]) * m) mod 2^32
-         q = (t->data[i] + a->data[i] * b->data[0]) * m;
-         //Compute T = T + A[i] * B
-         mpiMulAccCore(t->data + i, b->data, n, a->data[i]);
-      }
-      else
-      {
-         //Compute q = (T[i] * m) mod 2^32
-         q = t->data[i] * m;
-      }
-
+      //Compute q = (T[i] * m) mod 2^32
+      q = t->data[i] * m;
       //Compute T = T + q * P
       mpiMulAccCore(t->data + i, p->data, k, q);
    }
 
+   //Make sure R is large enough
+   MPI_CHECK(mpiGrow(r, k + 1));
+
    //Compute R = T / 2^(32 * k)
-   MPI_CHECK(mpiShiftRight(t, k * (MPI_INT_SIZE * 8)));
-   MPI_CHECK(mpiCopy(r, t));
+   osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+   osMemcpy(r->data, t->data + k, (k + 1) * MPI_INT_SIZE);
+   r->sign = 1;
 
    //A final subtraction is required
    if(mpiComp(r, p) >= 0)
@@ -1978,41 +2262,402 @@ void mpiMulAccCore(uint_t *r, const uint_t *a, int_t m, const uint_t b)
 {
    int_t i;
    uint32_t c;
-   uint32_t u;
-   uint32_t v;
    uint64_t p;
 
-   //Clear variables
+   //Clear carry
    c = 0;
-   u = 0;
-   v = 0;
 
-   //Perform multiplication
+   //Perform multiplication (the 64-bit sum A[i] * B + R[i] + C never
+   //overflows)
    for(i = 0; i < m; i++)
    {
-      p = (uint64_t) a[i] * b;
-      u = (uint32_t) p;
-      v = (uint32_t) (p >> 32);
+      p = (uint64_t) a[i] * b + r[i] + c;
+      r[i] = (uint32_t) p;
+      c = (uint32_t) (p >> 32);
+   }
+
+   //Propagate carry
+   for(; c != 0; i++)
+   {
+      r[i] += c;
+      c = (r[i] < c);
+   }
+}
+
+#endif
 
-      u += c;
-      if(u < c) v++;
 
-      u += r[i];
-      if(u < r[i]) v++;
+/**
+ * @brief Add two word arrays
+ * @param[in,out] r First operand, which receives the result (m words)
+ * @param[in] m Size of R in words
+ * @param[in] a Second operand (n words, with n <= m)
+ * @param[in] n Size of A in words
+ **/
+
+static void mpiAddCore(uint_t *r, uint_t m, const uint_t *a, uint_t n)
+{
+   uint_t i;
+   uint_t c;
+   uint_t u;
 
-      r[i] = u;
-      c = v;
+   //Compute R = R + A
+   for(c = 0, i = 0; i < n; i++)
+   {
+      u = r[i] + c;
+      c = (u < c);
+      r[i] = u + a[i];
+      c += (r[i] < u);
    }
 
    //Propagate carry
-   for(; c != 0; i++)
+   for(; c != 0 && i < m; i++)
    {
       r[i] += c;
       c = (r[i] < c);
    }
 }
 
-#endif
+
+/**
+ * @brief Subtract two word arrays
+ * @param[in,out] r First operand, which receives the result (m words)
+ * @param[in] m Size of R in words
+ * @param[in] a Second operand (n words, with n <= m)
+ * @param[in] n Size of A in words
+ **/
+
+static void mpiSubCore(uint_t *r, uint_t m, const uint_t *a, uint_t n)
+{
+   uint_t i;
+   uint_t c;
+   uint_t u;
+
+   //Compute R = R - A
+   for(c = 0, i = 0; i < n; i++)
+   {
+      u = r[i] - c;
+      c = (r[i] < c);
+      r[i] = u - a[i];
+      c += (u < a[i]);
+   }
+
+   //Propagate borrow
+   for(; c != 0 && i < m; i++)
+   {
+      u = r[i];
+      r[i] = u - c;
+      c = (u < c);
+   }
+}
+
+
+/**
+ * @brief Comba multiplication (product scanning)
+ * @param[out] r Resulting integer R = A * B (m + n words)
+ * @param[in] a First operand A
+ * @param[in] m Size of A in words
+ * @param[in] b Second operand B
+ * @param[in] n Size of B in words
+ **/
+
+static void mpiCombaMul(uint_t *r, const uint_t *a, uint_t m, const uint_t *b,
+   uint_t n)
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint32_t c;
+   uint64_t p;
+   uint64_t acc;
+
+   //Clear the 96-bit accumulator
+   acc = 0;
+   c = 0;
+
+   //The result is computed one column at a time
+   for(k = 0; k < (m + n - 1); k++)
+   {
+      //Sum the products A[i] * B[j] such as i + j = k
+      for(i = (k < n) ? 0 : k - n + 1, j = k - i; i < m && i <= k; i++, j--)
+      {
+         p = (uint64_t) a[i] * b[j];
+         acc += p;
+         c += (acc < p);
+      }
+
+      //Save the least significant word of the column
+      r[k] = (uint32_t) acc;
+
+      //Shift the accumulator
+      acc = (acc >> 32) | ((uint64_t) c << 32);
+      c = 0;
+   }
+
+   //Save the most significant word
+   r[k] = (uint32_t) acc;
+}
+
+
+/**
+ * @brief Comba squaring
+ * @param[out] r Resulting integer R = A^2 (2 * n words)
+ * @param[in] a Operand A
+ * @param[in] n Size of A in words
+ **/
+
+static void mpiCombaSqr(uint_t *r, const uint_t *a, uint_t n)
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint32_t c;
+   uint32_t cx;
+   uint64_t p;
+   uint64_t x;
+   uint64_t acc;
+
+   //Clear the 96-bit accumulator
+   acc = 0;
+   c = 0;
+
+   //The result is computed one column at a time
+   for(k = 0; k < (2 * n - 1); k++)
+   {
+      //Clear the cross product accumulator
+      x = 0;
+      cx = 0;
+
+      //Sum the cross products A[i] * A[j] such as i < j and i + j = k
+      for(i = (k < n) ? 0 : k - n + 1, j = k - i; i < j; i++, j--)
+      {
+         p = (uint64_t) a[i] * a[j];
+         x += p;
+         cx += (x < p);
+      }
+
+      //Each cross product appears twice in the column
+      cx = (cx << 1) | (uint32_t) (x >> 63);
+      x <<= 1;
+
+      //Even columns also contain the square of a single word
+      if((k & 1) == 0)
+      {
+         p = (uint64_t) a[k / 2] * a[k / 2];
+         x += p;
+         cx += (x < p);
+      }
+
+      //Add the column to the accumulator
+      acc += x;
+      c += cx + (acc < x);
+
+      //Save the least significant word of the column
+      r[k] = (uint32_t) acc;
+
+      //Shift the accumulator
+      acc = (acc >> 32) | ((uint64_t) c << 32);
+      c = 0;
+   }
+
+   //Save the most significant word
+   r[k] = (uint32_t) acc;
+}
+
+
+/**
+ * @brief Karatsuba multiplication
+ * @param[out] r Resulting integer R = A * B (2 * n words)
+ * @param[in] a First operand A
+ * @param[in] b Second operand B
+ * @param[in] n Size of A and B in words
+ * @param[in] t Scratch buffer
+ **/
+
+static void mpiKaratsubaMul(uint_t *r, const uint_t *a, const uint_t *b,
+   uint_t n, uint_t *t)
+{
+   uint_t l;
+   uint_t h;
+   uint_t *sa;
+   uint_t *sb;
+   uint_t *z1;
+
+   //Small operands are multiplied using Comba method
+   if(n < MPI_KARATSUBA_THRESHOLD)
+   {
+      mpiCombaMul(r, a, n, b, n);
+   }
+   else
+   {
+      //Split the operands as A = A1 * 2^(32 * l) + A0
+      l = n / 2;
+      h = n - l;
+
+      //Point to the scratch buffer
+      sa = t;
+      sb = t + h + 1;
+      z1 = t + 2 * h + 2;
+
+      //Compute Z0 = A0 * B0 and Z2 = A1 * B1
+      mpiKaratsubaMul(r, a, b, l, t);
+      mpiKaratsubaMul(r + 2 * l, a + l, b + l, h, t);
+
+      //Compute SA = A0 + A1
+      osMemcpy(sa, a + l, h * MPI_INT_SIZE);
+      sa[h] = 0;
+      mpiAddCore(sa, h + 1, a, l);
+
+      //Compute SB = B0 + B1
+      osMemcpy(sb, b + l, h * MPI_INT_SIZE);
+      sb[h] = 0;
+      mpiAddCore(sb, h + 1, b, l);
+
+      //Compute Z1 = SA * SB - Z0 - Z2
+      mpiKaratsubaMul(z1, sa, sb, h + 1, t + 4 * h + 4);
+      mpiSubCore(z1, 2 * h + 2, r, 2 * l);
+      mpiSubCore(z1, 2 * h + 2, r + 2 * l, 2 * h);
+
+      //Compute R = Z2 * 2^(64 * l) + Z1 * 2^(32 * l) + Z0
+      mpiAddCore(r + l, 2 * n - l, z1, 2 * h + 2);
+   }
+}
+
+
+/**
+ * @brief Karatsuba squaring
+ * @param[out] r Resulting integer R = A^2 (2 * n words)
+ * @param[in] a Operand A
+ * @param[in] n Size of A in words
+ * @param[in] t Scratch buffer
+ **/
+
+static void mpiKaratsubaSqr(uint_t *r, const uint_t *a, uint_t n, uint_t *t)
+{
+   uint_t l;
+   uint_t h;
+   uint_t *sa;
+   uint_t *z1;
+
+   //Small operands are squared using Comba method
+   if(n < MPI_KARATSUBA_THRESHOLD)
+   {
+      mpiCombaSqr(r, a, n);
+   }
+   else
+   {
+      //Split the operand as A = A1 * 2^(32 * l) + A0
+      l = n / 2;
+      h = n - l;
+
+      //Point to the scratch buffer
+      sa = t;
+      z1 = t + h + 1;
+
+      //Compute Z0 = A0^2 and Z2 = A1^2
+      mpiKaratsubaSqr(r, a, l, t);
+      mpiKaratsubaSqr(r + 2 * l, a + l, h, t);
+
+      //Compute SA = A0 + A1
+      osMemcpy(sa, a + l, h * MPI_INT_SIZE);
+      sa[h] = 0;
+      mpiAddCore(sa, h + 1, a, l);
+
+      //Compute Z1 = SA^2 - Z0 - Z2
+      mpiKaratsubaSqr(z1, sa, h + 1, t + 3 * h + 3);
+      mpiSubCore(z1, 2 * h + 2, r, 2 * l);
+      mpiSubCore(z1, 2 * h + 2, r + 2 * l, 2 * h);
+
+      //Compute R = Z2 * 2^(64 * l) + Z1 * 2^(32 * l) + Z0
+      mpiAddCore(r + l, 2 * n - l, z1, 2 * h + 2);
+   }
+}
+
+
+/**
+ * @brief Multiply two word arrays
+ * @param[out] r Resulting integer R = A * B (m + n words)
+ * @param[in] a First operand A
+ * @param[in] m Size of A in words
+ * @param[in] b Second operand B
+ * @param[in] n Size of B in words
+ * @param[in] t Scratch buffer for Karatsuba multiplication (optional)
+ **/
+
+void mpiMulCore(uint_t *r, const uint_t *a, uint_t m, const uint_t *b,
+   uint_t n, uint_t *t)
+{
+   //Check the length of the operands
+   if(m == 0 || n == 0)
+   {
+      //The product is zero
+      osMemset(r, 0, (m + n) * MPI_INT_SIZE);
+   }
+   else if(a == b && m == n)
+   {
+      //Squaring requires about half as many word multiplications
+      mpiSqrCore(r, a, n, t);
+   }
+   else if(m == n && t != NULL)
+   {
+      //Use Karatsuba method above the threshold
+      mpiKaratsubaMul(r, a, b, n, t);
+   }
+   else
+   {
+      //Use Comba method
+      mpiCombaMul(r, a, m, b, n);
+   }
+}
+
+
+/**
+ * @brief Square a word array
+ * @param[out] r Resulting integer R = A^2 (2 * n words)
+ * @param[in] a Operand A
+ * @param[in] n Size of A in words
+ * @param[in] t Scratch buffer for Karatsuba multiplication (optional)
+ **/
+
+void mpiSqrCore(uint_t *r, const uint_t *a, uint_t n, uint_t *t)
+{
+   //Check the length of the operand
+   if(n > 0)
+   {
+      //Use Karatsuba method above the threshold
+      if(t != NULL)
+      {
+         mpiKaratsubaSqr(r, a, n, t);
+      }
+      else
+      {
+         mpiCombaSqr(r, a, n);
+      }
+   }
+}
+
+
+/**
+ * @brief Get the size of the scratch buffer used by Karatsuba multiplication
+ * @param[in] n Size of the operands in words
+ * @return Size of the scratch buffer in words
+ **/
+
+uint_t mpiKaratsubaScratchSize(uint_t n)
+{
+   uint_t h;
+   uint_t size;
+
+   //Each recursion level stores SA, SB and Z1, then recurses on SA * SB
+   for(size = 0; n >= MPI_KARATSUBA_THRESHOLD; n = h + 1)
+   {
+      h = n - n / 2;
+      size += 4 * h + 4;
+   }
+
+   //Return the size of the scratch buffer
+   return size;
+}
 
 
 /**
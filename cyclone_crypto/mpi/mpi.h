@@ -39,6 +39,67 @@
    #error MPI_MAX_BIT_SIZE parameter is not valid
 #endif
 
+//Threshold, in words, above which Karatsuba multiplication is used
+#ifndef MPI_KARATSUBA_THRESHOLD
+   #define MPI_KARATSUBA_THRESHOLD 48
+#elif (MPI_KARATSUBA_THRESHOLD < 8)
+   #error MPI_KARATSUBA_THRESHOLD parameter is not valid
+#endif
+
+//Maximum window size for sliding window exponentiation
+#ifndef MPI_MAX_WINDOW_SIZE
+   #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+      #define MPI_MAX_WINDOW_SIZE 6
+   #else
+      #define MPI_MAX_WINDOW_SIZE 4
+   #endif
+#elif (MPI_MAX_WINDOW_SIZE < 1 || MPI_MAX_WINDOW_SIZE > 8)
+   #error MPI_MAX_WINDOW_SIZE parameter is not valid
+#endif
+
+//Arena allocation support
+#ifndef MPI_ARENA_SUPPORT
+   #define MPI_ARENA_SUPPORT DISABLED
+#elif (MPI_ARENA_SUPPORT != ENABLED && MPI_ARENA_SUPPORT != DISABLED)
+   #error MPI_ARENA_SUPPORT parameter is not valid
+#elif (MPI_ARENA_SUPPORT == ENABLED && CRYPTO_STATIC_MEM_SUPPORT == ENABLED)
+   #error MPI_ARENA_SUPPORT requires dynamic memory allocation
+#endif
+
+//Number of size classes managed by an arena (16 bytes to 512 KB)
+#ifndef MPI_ARENA_NUM_CLASSES
+   #define MPI_ARENA_NUM_CLASSES 16
+#elif (MPI_ARENA_NUM_CLASSES < 1 || MPI_ARENA_NUM_CLASSES > 24)
+   #error MPI_ARENA_NUM_CLASSES parameter is not valid
+#endif
+
+//The active arena must be private to each task. Otherwise a task that has
+//not entered an arena would allocate from the arena of another task. Ports
+//that do not provide task-local storage must map mpiGetActiveArena() and
+//mpiSetActiveArena() to a task-local hook (FreeRTOS thread local storage
+//pointers, for instance)
+#if (MPI_ARENA_SUPPORT == ENABLED && !defined(mpiGetActiveArena))
+   #if defined(_OS_PORT_NONE_H)
+      //Single-threaded environment
+      #define MPI_ARENA_TASK_LOCAL
+   #elif defined(_OS_PORT_WINDOWS_H) && defined(_MSC_VER)
+      //Thread-local storage (Windows)
+      #define MPI_ARENA_TASK_LOCAL __declspec(thread)
+   #elif (defined(_OS_PORT_WINDOWS_H) || defined(_OS_PORT_POSIX_H)) && defined(__GNUC__)
+      //Thread-local storage (POSIX threads)
+      #define MPI_ARENA_TASK_LOCAL __thread
+   #else
+      #error MPI_ARENA_SUPPORT requires mpiGetActiveArena() and mpiSetActiveArena() to be mapped to task-local storage
+   #endif
+
+   //Get the arena attached to the calling task
+   #define mpiGetActiveArena() mpiActiveArena
+   //Attach an arena to the calling task
+   #define mpiSetActiveArena(arena) mpiActiveArena = (arena)
+#elif (MPI_ARENA_SUPPORT == ENABLED && !defined(mpiSetActiveArena))
+   #error mpiSetActiveArena() must be defined along with mpiGetActiveArena()
+#endif
+
 //Size of the sub data type
 #define MPI_INT_SIZE sizeof(uint_t)
 
@@ -85,7 +146,41 @@ typedef struct
 } Mpi;
 
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief Memory arena backing the temporaries of an operation
+ **/
+
+typedef struct _MpiArena MpiArena;
+
+struct _MpiArena
+{
+   uint8_t *buffer;                       ///<Memory buffer
+   size_t size;                           ///<Size of the memory buffer, in bytes
+   size_t pos;                            ///<Bump pointer (offset of the first unused byte)
+   size_t highWaterMark;                  ///<Peak usage of the memory buffer, in bytes
+   uint_t heapFallbacks;                  ///<Number of allocations served by the heap
+   void *freeList[MPI_ARENA_NUM_CLASSES]; ///<Released blocks, by size class
+   MpiArena *prev;                        ///<Previously active arena
+};
+
+
+//Arena attached to the calling task
+#ifdef MPI_ARENA_TASK_LOCAL
+extern MPI_ARENA_TASK_LOCAL MpiArena *mpiActiveArena;
+#endif
+
+#endif
+
+
 //MPI related functions
+#if (MPI_ARENA_SUPPORT == ENABLED)
+void mpiArenaInit(MpiArena *arena, void *buffer, size_t size);
+void mpiArenaEnter(MpiArena *arena);
+void mpiArenaLeave(MpiArena *arena);
+#endif
+
 void mpiInit(Mpi *r);
 void mpiFree(Mpi *r);
 
@@ -151,6 +246,13 @@ error_t mpiMontgomeryRed(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t);
 
 void mpiMulAccCore(uint_t *r, const uint_t *a, int_t m, const uint_t b);
 
+void mpiMulCore(uint_t *r, const uint_t *a, uint_t m, const uint_t *b,
+   uint_t n, uint_t *t);
+
+void mpiSqrCore(uint_t *r, const uint_t *a, uint_t n, uint_t *t);
+
+uint_t mpiKaratsubaScratchSize(uint_t n);
+
 void mpiDump(FILE *stream, const char_t *prepend, const Mpi *a);
 
 //C++ guard
@@ -1179,6 +1179,82 @@ error_t rsassaPssVerify(const RsaPublicKey *key, const HashAlgo *hash,
 }
 
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief RSASSA-PKCS1-v1_5 signature verification using a caller-supplied arena
+ * @param[in] key Signer's RSA public key
+ * @param[in] hash Hash function used to digest the message
+ * @param[in] digest Digest of the message whose signature is to be verified
+ * @param[in] signature Signature to be verified
+ * @param[in] signatureLen Length of the signature to be verified
+ * @param[in] arena Arena used to allocate temporary integers
+ * @return Error code
+ **/
+
+error_t rsassaPkcs1v15VerifyArena(const RsaPublicKey *key,
+   const HashAlgo *hash, const uint8_t *digest, const uint8_t *signature,
+   size_t signatureLen, MpiArena *arena)
+{
+   error_t error;
+
+   //Check parameters
+   if(arena == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Route temporary allocations to the arena
+   mpiArenaEnter(arena);
+
+   //Verify RSA signature
+   error = rsassaPkcs1v15Verify(key, hash, digest, signature, signatureLen);
+
+   //Release the arena
+   mpiArenaLeave(arena);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief RSASSA-PSS signature verification using a caller-supplied arena
+ * @param[in] key Signer's RSA public key
+ * @param[in] hash Hash function used to digest the message
+ * @param[in] saltLen Length of the salt, in bytes
+ * @param[in] digest Digest of the message whose signature is to be verified
+ * @param[in] signature Signature to be verified
+ * @param[in] signatureLen Length of the signature to be verified
+ * @param[in] arena Arena used to allocate temporary integers
+ * @return Error code
+ **/
+
+error_t rsassaPssVerifyArena(const RsaPublicKey *key, const HashAlgo *hash,
+   size_t saltLen, const uint8_t *digest, const uint8_t *signature,
+   size_t signatureLen, MpiArena *arena)
+{
+   error_t error;
+
+   //Check parameters
+   if(arena == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Route temporary allocations to the arena
+   mpiArenaEnter(arena);
+
+   //Verify RSA signature
+   error = rsassaPssVerify(key, hash, saltLen, digest, signature,
+      signatureLen);
+
+   //Release the arena
+   mpiArenaLeave(arena);
+
+   //Return status code
+   return error;
+}
+
+#endif
+
+
 /**
  * @brief RSA encryption primitive
  *
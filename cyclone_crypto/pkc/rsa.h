@@ -131,6 +131,18 @@ error_t rsassaPssVerify(const RsaPublicKey *key, const HashAlgo *hash,
    size_t saltLen, const uint8_t *digest, const uint8_t *signature,
    size_t signatureLen);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+error_t rsassaPkcs1v15VerifyArena(const RsaPublicKey *key,
+   const HashAlgo *hash, const uint8_t *digest, const uint8_t *signature,
+   size_t signatureLen, MpiArena *arena);
+
+error_t rsassaPssVerifyArena(const RsaPublicKey *key, const HashAlgo *hash,
+   size_t saltLen, const uint8_t *digest, const uint8_t *signature,
+   size_t signatureLen, MpiArena *arena);
+
+#endif
+
 error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c);
 error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m);
 
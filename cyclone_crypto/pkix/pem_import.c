@@ -36,6 +36,7 @@
 #include "pkix/pkcs8_key_parse.h"
 #include "pkix/x509_key_parse.h"
 #include "encoding/asn1.h"
+#include "encoding/base64.h"
 #include "encoding/oid.h"
 #include "mpi/mpi.h"
 #include "debug.h"
@@ -1862,4 +1863,395 @@ error_t pemGetPrivateKeyType(const char_t *input, size_t length,
    return error;
 }
 
+
+/**
+ * @brief Initialize a streaming PEM decoder
+ *
+ * The streaming decoder processes a sequence of PEM objects (such as a bundle
+ * of CA certificates) that is supplied in chunks of arbitrary size. Each
+ * object is decoded in the buffer provided by the caller and handed to the
+ * callback function as soon as its post-encapsulation boundary is reached,
+ * so that the memory footprint does not depend on the size of the bundle.
+ * Encapsulated headers are not supported
+ *
+ * @param[in] context Pointer to the decoder context
+ * @param[in] label Label of the PEM objects to decode (e.g. "CERTIFICATE")
+ * @param[in] buffer Buffer where to decode each object
+ * @param[in] bufferSize Size of the buffer, in bytes
+ * @param[in] callback Function invoked for each decoded object
+ * @param[in] param Callback function parameter
+ * @return Error code
+ **/
+
+error_t pemImportInit(PemImportContext *context, const char_t *label,
+   uint8_t *buffer, size_t bufferSize, PemImportCallback callback,
+   void *param)
+{
+   //Check parameters
+   if(context == NULL || label == NULL || buffer == NULL || callback == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The boundaries must fit in the line buffer
+   if((osStrlen("-----BEGIN -----") + osStrlen(label)) > PEM_IMPORT_MAX_LINE_LEN)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the decoder context
+   osMemset(context, 0, sizeof(PemImportContext));
+
+   //Save parameters
+   context->label = label;
+   context->buffer = buffer;
+   context->bufferSize = bufferSize;
+   context->callback = callback;
+   context->param = param;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Feed the streaming PEM decoder with data
+ * @param[in] context Pointer to the decoder context
+ * @param[in] input Next chunk of the PEM encoding
+ * @param[in] length Length of the chunk
+ * @return Error code
+ **/
+
+error_t pemImportUpdate(PemImportContext *context, const char_t *input,
+   size_t length)
+{
+   error_t error;
+   size_t n;
+   size_t k;
+
+   //Check parameters
+   if(context == NULL || (input == NULL && length != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Process the incoming data
+   while(length > 0 && !error)
+   {
+      //Search for the end of the current line
+      for(n = 0; n < length && input[n] != '\n'; n++)
+      {
+      }
+
+      //Append the characters to the line buffer
+      while(n > 0 && !error)
+      {
+         //Number of characters that can be copied
+         k = MIN(n, PEM_IMPORT_MAX_LINE_LEN - context->lineLen);
+
+         //Line buffer full?
+         if(k == 0)
+         {
+            //Check whether the current line belongs to the Base64 text
+            if(context->inside && !context->discard)
+            {
+               //Decode the complete blocks, so that long lines can be
+               //processed with a bounded line buffer
+               error = pemImportDecodeLine(context, FALSE);
+
+               //The line buffer is still full?
+               if(!error && context->lineLen >= PEM_IMPORT_MAX_LINE_LEN)
+                  error = ERROR_INVALID_SYNTAX;
+
+               //The rest of the line is not located at the beginning of a line
+               context->partial = TRUE;
+            }
+            else
+            {
+               //Lines that are too long cannot contain a boundary
+               context->lineLen = context->lineStart;
+               context->discard = TRUE;
+            }
+         }
+         else
+         {
+            //Copy the characters
+            osMemcpy(context->line + context->lineLen, input, k);
+            context->lineLen += k;
+
+            //Advance data pointer
+            input += k;
+            length -= k;
+            n -= k;
+         }
+      }
+
+      //End of line?
+      if(length > 0 && !error)
+      {
+         //Process the current line
+         error = pemImportProcessLine(context);
+
+         //Skip the LF character
+         input++;
+         length--;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Finalize the streaming PEM decoder
+ * @param[in] context Pointer to the decoder context
+ * @return Error code
+ **/
+
+error_t pemImportFinal(PemImportContext *context)
+{
+   error_t error;
+
+   //Check parameters
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //The last line may not be terminated by a line break
+   if(context->lineLen > context->lineStart || context->partial)
+   {
+      error = pemImportProcessLine(context);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Post-encapsulation boundary not found?
+      if(context->inside)
+      {
+         error = ERROR_INVALID_SYNTAX;
+      }
+      else if(context->count == 0)
+      {
+         //The input does not contain any PEM object with the specified label
+         error = ERROR_END_OF_FILE;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Process a complete line
+ * @param[in] context Pointer to the decoder context
+ * @return Error code
+ **/
+
+error_t pemImportProcessLine(PemImportContext *context)
+{
+   error_t error;
+   const char_t *line;
+   size_t n;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Trailing whitespace characters are ignored
+   while(context->lineLen > context->lineStart &&
+      (context->line[context->lineLen - 1] == '\r' ||
+      context->line[context->lineLen - 1] == ' ' ||
+      context->line[context->lineLen - 1] == '\t'))
+   {
+      context->lineLen--;
+   }
+
+   //Point to the beginning of the current line
+   line = context->line + context->lineStart;
+   n = context->lineLen - context->lineStart;
+
+   //Check current state
+   if(context->discard)
+   {
+      //Discard the line
+      context->lineLen = context->lineStart;
+   }
+   else if(!context->inside)
+   {
+      //The PEM container begins with a "-----BEGIN " line
+      if(pemImportCompareBoundary(line, n, "-----BEGIN ", context->label))
+      {
+         //Start decoding a new object
+         context->inside = TRUE;
+         context->padding = FALSE;
+         context->bufferLen = 0;
+      }
+
+      //Text outside of the PEM containers is ignored
+      context->lineLen = 0;
+   }
+   else if(!context->partial && n > 0 && line[0] == '-')
+   {
+      //The PEM container ends with a "-----END " line
+      if(pemImportCompareBoundary(line, n, "-----END ", context->label))
+      {
+         //Remove the boundary from the line buffer
+         context->lineLen = context->lineStart;
+
+         //Decode the remaining characters
+         error = pemImportDecodeLine(context, TRUE);
+
+         //Check status code
+         if(!error)
+         {
+            //Sanity check
+            if(context->bufferLen > 0)
+            {
+               //Pass the decoded object to the callback function
+               error = context->callback(context->buffer, context->bufferLen,
+                  context->param);
+
+               //Increment the number of objects
+               context->count++;
+            }
+            else
+            {
+               //Report an error
+               error = ERROR_INVALID_SYNTAX;
+            }
+         }
+
+         //Search for the next PEM container
+         context->inside = FALSE;
+         context->lineLen = 0;
+      }
+      else
+      {
+         //Unexpected boundary
+         error = ERROR_INVALID_SYNTAX;
+      }
+   }
+   else
+   {
+      //Decode the complete blocks of the Base64 text
+      error = pemImportDecodeLine(context, FALSE);
+   }
+
+   //The next line starts after the characters carried over
+   context->lineStart = context->lineLen;
+   context->partial = FALSE;
+   context->discard = FALSE;
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Decode the contents of the line buffer
+ * @param[in] context Pointer to the decoder context
+ * @param[in] final This flag indicates whether the end of the Base64 text
+ *   has been reached
+ * @return Error code
+ **/
+
+error_t pemImportDecodeLine(PemImportContext *context, bool_t final)
+{
+   error_t error;
+   size_t n;
+   size_t k;
+
+   //A Base64 block may span several lines, so the remaining characters are
+   //carried over until the end of the text
+   if(final)
+   {
+      n = context->lineLen;
+   }
+   else
+   {
+      n = context->lineLen - (context->lineLen % 4);
+   }
+
+   //Any characters to decode?
+   if(n > 0)
+   {
+      //No data can follow the pad characters
+      if(context->padding)
+         return ERROR_INVALID_SYNTAX;
+
+      //Calculate the length of the decoded data
+      k = (n + 3) / 4 * 3;
+
+      //Pad characters reduce the length of the last block
+      if(context->line[n - 1] == '=')
+      {
+         k--;
+         context->padding = TRUE;
+
+         if(n > 1 && context->line[n - 2] == '=')
+         {
+            k--;
+         }
+      }
+
+      //Make sure the buffer is large enough to hold the decoded data
+      if((context->bufferLen + k) > context->bufferSize)
+         return ERROR_BUFFER_OVERFLOW;
+
+      //Decode the complete blocks
+      error = base64Decode(context->line, n,
+         context->buffer + context->bufferLen, &k);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Adjust the length of the decoded data
+      context->bufferLen += k;
+
+      //Keep the characters that do not form a complete block
+      osMemmove(context->line, context->line + n, context->lineLen - n);
+      context->lineLen -= n;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Check whether a line matches an encapsulation boundary
+ * @param[in] line Pointer to the line
+ * @param[in] length Length of the line
+ * @param[in] prefix Either "-----BEGIN " or "-----END "
+ * @param[in] label Label of the PEM object
+ * @return TRUE if the line matches the boundary, else FALSE
+ **/
+
+bool_t pemImportCompareBoundary(const char_t *line, size_t length,
+   const char_t *prefix, const char_t *label)
+{
+   size_t n1;
+   size_t n2;
+
+   //Calculate the length of the prefix and of the label
+   n1 = osStrlen(prefix);
+   n2 = osStrlen(label);
+
+   //Check the length of the line
+   if(length != (n1 + n2 + 5))
+      return FALSE;
+
+   //Compare the boundary
+   if(osStrncmp(line, prefix, n1) != 0)
+      return FALSE;
+   if(osStrncmp(line + n1, label, n2) != 0)
+      return FALSE;
+   if(osStrncmp(line + n1 + n2, "-----", 5) != 0)
+      return FALSE;
+
+   //The line matches the boundary
+   return TRUE;
+}
+
 #endif
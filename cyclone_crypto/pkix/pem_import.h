@@ -38,11 +38,50 @@
 #include "ecc/ec.h"
 #include "ecc/eddsa.h"
 
+//Size of the line buffer used by the streaming decoder
+#ifndef PEM_IMPORT_MAX_LINE_LEN
+   #define PEM_IMPORT_MAX_LINE_LEN 128
+#elif (PEM_IMPORT_MAX_LINE_LEN < 64)
+   #error PEM_IMPORT_MAX_LINE_LEN parameter is not valid
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+
+/**
+ * @brief Callback function invoked for each decoded PEM object
+ **/
+
+typedef error_t (*PemImportCallback)(const uint8_t *data, size_t length,
+   void *param);
+
+
+/**
+ * @brief Streaming PEM decoder
+ **/
+
+typedef struct
+{
+   const char_t *label;                  ///<Label of the PEM objects to decode
+   PemImportCallback callback;           ///<Callback function
+   void *param;                          ///<Callback function parameter
+   uint8_t *buffer;                      ///<Buffer holding the current object
+   size_t bufferSize;                    ///<Size of the buffer
+   size_t bufferLen;                     ///<Length of the current object
+   bool_t inside;                        ///<Inside a PEM container
+   bool_t padding;                       ///<Pad characters have been decoded
+   bool_t partial;                       ///<The line buffer holds the middle of a line
+   bool_t discard;                       ///<Discard the current line
+   char_t line[PEM_IMPORT_MAX_LINE_LEN]; ///<Line buffer
+   size_t lineLen;                       ///<Number of characters in the line buffer
+   size_t lineStart;                     ///<Beginning of the current line
+   uint_t count;                         ///<Number of objects decoded so far
+} PemImportContext;
+
+
 //PEM related functions
 error_t pemImportCertificate(const char_t *input, size_t inputLen,
    uint8_t *output, size_t *outputLen, size_t *consumed);
@@ -89,6 +128,22 @@ error_t pemGetPublicKeyType(const char_t *input, size_t length,
 error_t pemGetPrivateKeyType(const char_t *input, size_t length,
    X509KeyType *keyType);
 
+error_t pemImportInit(PemImportContext *context, const char_t *label,
+   uint8_t *buffer, size_t bufferSize, PemImportCallback callback,
+   void *param);
+
+error_t pemImportUpdate(PemImportContext *context, const char_t *input,
+   size_t length);
+
+error_t pemImportFinal(PemImportContext *context);
+
+error_t pemImportProcessLine(PemImportContext *context);
+
+error_t pemImportDecodeLine(PemImportContext *context, bool_t final);
+
+bool_t pemImportCompareBoundary(const char_t *line, size_t length,
+   const char_t *prefix, const char_t *label);
+
 //C++ guard
 #ifdef __cplusplus
 }
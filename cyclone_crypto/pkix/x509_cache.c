@@ -0,0 +1,670 @@
+/**
+ * @file x509_cache.c
+ * @brief Cache of parsed certificates and verified signatures
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * The same intermediate and responder certificates are typically validated
+ * over and over. The cache keeps a bounded number of parsed certificates,
+ * indexed by the SHA-256 digest of their DER encoding, and remembers the
+ * signature verifications that have already succeeded, so that neither the
+ * parsing nor the public key operation has to be repeated. Both tables are
+ * managed on a least recently used basis. The cache is initialized on first
+ * use, so that x509ValidateCertificate() can rely on it without any action
+ * from the application
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "pkix/x509_cache.h"
+#include "pkix/x509_cert_parse.h"
+#include "pkix/x509_sign_verify.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (X509_SUPPORT == ENABLED && X509_CACHE_SUPPORT == ENABLED)
+
+//The cache has been initialized
+static volatile bool_t x509CacheReady = FALSE;
+//Mutex preventing simultaneous access to the cache
+static OsMutex x509CacheMutex;
+//Parsed certificates
+static X509CacheEntry x509CertCache[X509_CACHE_SIZE];
+//Verified signatures
+static X509CacheSignEntry x509SignCache[X509_CACHE_SIGN_SIZE];
+//Statistics
+static X509CacheStats x509CacheStatistics;
+//Time stamp used to track the least recently used entries
+static uint32_t x509CacheTimestamp;
+
+
+/**
+ * @brief Initialize the X.509 cache
+ *
+ * The function is called on first use of the cache and may be called again
+ * without side effects. The initialization is serialized by suspending the
+ * scheduler, which is a no-op on the POSIX and Windows ports. There, the
+ * function must be called before several tasks can use the cache
+ *
+ * @return Error code
+ **/
+
+error_t x509CacheInit(void)
+{
+   error_t error;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Prevent other tasks from initializing the cache at the same time
+   osSuspendAllTasks();
+
+   //First call?
+   if(!x509CacheReady)
+   {
+      //Clear the cache
+      osMemset(x509CertCache, 0, sizeof(x509CertCache));
+      osMemset(x509SignCache, 0, sizeof(x509SignCache));
+      osMemset(&x509CacheStatistics, 0, sizeof(X509CacheStats));
+      x509CacheTimestamp = 0;
+
+      //Create a mutex to prevent simultaneous access to the cache
+      if(osCreateMutex(&x509CacheMutex))
+      {
+         //The cache is ready for use
+         x509CacheReady = TRUE;
+      }
+      else
+      {
+         //Failed to create mutex
+         error = ERROR_OUT_OF_RESOURCES;
+      }
+   }
+
+   //Resume scheduler activity
+   osResumeAllTasks();
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Retrieve a parsed certificate from the cache
+ *
+ * The certificate is parsed and added to the cache if it is not already
+ * present. The returned structure remains valid until the caller releases it
+ * with x509CacheReleaseCertificate(). When the certificate cannot be cached
+ * (ERROR_INVALID_LENGTH or ERROR_OUT_OF_RESOURCES), the caller should parse
+ * it with x509ParseCertificateEx() instead
+ *
+ * @param[in] data Pointer to the DER-encoded certificate
+ * @param[in] length Length of the DER-encoded certificate
+ * @param[in] ignoreUnknown Ignore unknown extensions
+ * @param[out] certInfo Parsed certificate
+ * @return Error code
+ **/
+
+error_t x509CacheGetCertificate(const uint8_t *data, size_t length,
+   bool_t ignoreUnknown, const X509CertInfo **certInfo)
+{
+   error_t error;
+   uint_t i;
+   uint8_t digest[SHA256_DIGEST_SIZE];
+   X509CacheEntry *entry;
+   X509CacheEntry *oldestEntry;
+
+   //Check parameters
+   if(data == NULL || certInfo == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Large certificates are not cached
+   if(length > X509_CACHE_MAX_CERT_SIZE)
+      return ERROR_INVALID_LENGTH;
+
+   //Initialize the cache on first use
+   if(!x509CacheReady)
+   {
+      error = x509CacheInit();
+      //Any error to report?
+      if(error)
+         return error;
+   }
+
+   //The cache is indexed by the digest of the DER encoding
+   error = sha256Compute(data, length, digest);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&x509CacheMutex);
+
+   //Keep track of the least recently used entry
+   oldestEntry = NULL;
+
+   //Search the cache for the specified certificate
+   for(i = 0; i < X509_CACHE_SIZE; i++)
+   {
+      //Point to the current entry
+      entry = &x509CertCache[i];
+
+      //Valid entry?
+      if(entry->certInfo != NULL && !entry->stale)
+      {
+         //Matching certificate?
+         if(entry->ignoreUnknown == ignoreUnknown &&
+            entry->derLen == length &&
+            osMemcmp(entry->digest, digest, SHA256_DIGEST_SIZE) == 0 &&
+            osMemcmp(entry->der, data, length) == 0)
+         {
+            break;
+         }
+      }
+
+      //Entries that are currently referenced cannot be evicted
+      if(entry->refCount == 0)
+      {
+         //Free entries are used first
+         if(entry->certInfo == NULL)
+         {
+            oldestEntry = entry;
+         }
+         else if(oldestEntry == NULL || (oldestEntry->certInfo != NULL &&
+            (x509CacheTimestamp - entry->lastUsed) >
+            (x509CacheTimestamp - oldestEntry->lastUsed)))
+         {
+            oldestEntry = entry;
+         }
+      }
+   }
+
+   //Certificate found in the cache?
+   if(i < X509_CACHE_SIZE)
+   {
+      //Update statistics
+      x509CacheStatistics.certHits++;
+   }
+   else
+   {
+      //Update statistics
+      x509CacheStatistics.certMisses++;
+
+      //All the entries are currently in use?
+      if(oldestEntry == NULL)
+      {
+         //Release exclusive access to the cache
+         osReleaseMutex(&x509CacheMutex);
+         //The certificate cannot be cached
+         return ERROR_OUT_OF_RESOURCES;
+      }
+
+      //Evict the least recently used certificate
+      if(oldestEntry->certInfo != NULL)
+      {
+         x509CacheFreeEntry(oldestEntry);
+         x509CacheStatistics.certEvictions++;
+      }
+
+      //Point to the entry to be filled
+      entry = oldestEntry;
+
+      //Allocate memory to hold the certificate
+      entry->der = cryptoAllocMem(length);
+      entry->certInfo = cryptoAllocMem(sizeof(X509CertInfo));
+
+      //Successful memory allocation?
+      if(entry->der != NULL && entry->certInfo != NULL)
+      {
+         //The parsed certificate points to the copy of the DER encoding
+         osMemcpy(entry->der, data, length);
+
+         //Parse the certificate
+         error = x509ParseCertificateEx(entry->der, length, entry->certInfo,
+            ignoreUnknown);
+      }
+      else
+      {
+         //Failed to allocate memory
+         error = ERROR_OUT_OF_MEMORY;
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Save the digest of the certificate
+         osMemcpy(entry->digest, digest, SHA256_DIGEST_SIZE);
+         entry->derLen = length;
+         entry->ignoreUnknown = ignoreUnknown;
+      }
+      else
+      {
+         //Clean up side effects
+         x509CacheFreeEntry(entry);
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //The entry is now referenced by the caller
+      entry->refCount++;
+      entry->lastUsed = ++x509CacheTimestamp;
+
+      //Return the parsed certificate
+      *certInfo = entry->certInfo;
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&x509CacheMutex);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Release a certificate obtained from the cache
+ * @param[in] certInfo Parsed certificate
+ **/
+
+void x509CacheReleaseCertificate(const X509CertInfo *certInfo)
+{
+   uint_t i;
+   X509CacheEntry *entry;
+
+   //No certificate can have been obtained from an uninitialized cache
+   if(!x509CacheReady)
+      return;
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&x509CacheMutex);
+
+   //Loop through the cache entries
+   for(i = 0; i < X509_CACHE_SIZE; i++)
+   {
+      //Point to the current entry
+      entry = &x509CertCache[i];
+
+      //Matching entry?
+      if(entry->certInfo == certInfo && entry->refCount > 0)
+      {
+         //Drop the reference held by the caller
+         entry->refCount--;
+
+         //Invalidated entries are released as soon as they are unused
+         if(entry->refCount == 0 && entry->stale)
+         {
+            x509CacheFreeEntry(entry);
+         }
+
+         //We are done
+         break;
+      }
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&x509CacheMutex);
+}
+
+
+/**
+ * @brief Certificate signature verification with memoization
+ *
+ * Only successful verifications are remembered. The memo is indexed by the
+ * digest of every input of the verification, so that a cached result can
+ * never be reused for a different certificate, signature or issuer key
+ *
+ * @param[in] tbsData Data whose signature is to be verified
+ * @param[in] signAlgoId Signature algorithm identifier
+ * @param[in] publicKeyInfo Issuer's public key
+ * @param[in] signature Signature to be verified
+ * @return Error code
+ **/
+
+error_t x509CacheVerifySignature(const X509OctetString *tbsData,
+   const X509SignAlgoId *signAlgoId,
+   const X509SubjectPublicKeyInfo *publicKeyInfo,
+   const X509OctetString *signature)
+{
+   error_t error;
+   uint_t i;
+   uint8_t digest[SHA256_DIGEST_SIZE];
+   X509CacheSignEntry *entry;
+   X509CacheSignEntry *oldestEntry;
+
+   //Initialize the cache on first use
+   if(!x509CacheReady)
+   {
+      //Without a cache, the signature is verified every time
+      if(x509CacheInit())
+      {
+         return x509VerifySignature(tbsData, signAlgoId, publicKeyInfo,
+            signature);
+      }
+   }
+
+   //Digest the inputs of the signature verification
+   x509CacheComputeSignDigest(tbsData, signAlgoId, publicKeyInfo, signature,
+      digest);
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&x509CacheMutex);
+
+   //Search the cache for a matching verification
+   for(i = 0; i < X509_CACHE_SIGN_SIZE; i++)
+   {
+      //Point to the current entry
+      entry = &x509SignCache[i];
+
+      //Matching entry?
+      if(entry->valid && osMemcmp(entry->digest, digest,
+         SHA256_DIGEST_SIZE) == 0)
+      {
+         //The signature has already been verified
+         entry->lastUsed = ++x509CacheTimestamp;
+         x509CacheStatistics.signHits++;
+         break;
+      }
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&x509CacheMutex);
+
+   //Cache hit?
+   if(i < X509_CACHE_SIGN_SIZE)
+      return NO_ERROR;
+
+   //The public key operation is performed outside of the critical section
+   error = x509VerifySignature(tbsData, signAlgoId, publicKeyInfo, signature);
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&x509CacheMutex);
+
+   //Update statistics
+   x509CacheStatistics.signMisses++;
+
+   //Successful verification?
+   if(!error)
+   {
+      //Keep track of the least recently used entry
+      oldestEntry = &x509SignCache[0];
+
+      //Loop through the cache entries
+      for(i = 0; i < X509_CACHE_SIGN_SIZE; i++)
+      {
+         //Point to the current entry
+         entry = &x509SignCache[i];
+
+         //Free entries are used first
+         if(!entry->valid)
+         {
+            oldestEntry = entry;
+            break;
+         }
+
+         //Keep track of the least recently used entry
+         if((x509CacheTimestamp - entry->lastUsed) >
+            (x509CacheTimestamp - oldestEntry->lastUsed))
+         {
+            oldestEntry = entry;
+         }
+      }
+
+      //Evict the least recently used verification
+      if(oldestEntry->valid)
+      {
+         x509CacheStatistics.signEvictions++;
+      }
+
+      //Remember the successful verification
+      oldestEntry->valid = TRUE;
+      osMemcpy(oldestEntry->digest, digest, SHA256_DIGEST_SIZE);
+      oldestEntry->lastUsed = ++x509CacheTimestamp;
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&x509CacheMutex);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Remove a certificate from the cache
+ *
+ * The parsed certificate and the signature verifications are dropped. A
+ * certificate that is still referenced is released by the last call to
+ * x509CacheReleaseCertificate()
+ *
+ * @param[in] data Pointer to the DER-encoded certificate
+ * @param[in] length Length of the DER-encoded certificate
+ **/
+
+void x509CacheInvalidate(const uint8_t *data, size_t length)
+{
+   uint_t i;
+   uint8_t digest[SHA256_DIGEST_SIZE];
+   X509CacheEntry *entry;
+
+   //An uninitialized cache holds no certificate
+   if(!x509CacheReady)
+      return;
+
+   //Compute the digest of the DER encoding
+   if(sha256Compute(data, length, digest))
+      return;
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&x509CacheMutex);
+
+   //Loop through the cache entries
+   for(i = 0; i < X509_CACHE_SIZE; i++)
+   {
+      //Point to the current entry
+      entry = &x509CertCache[i];
+
+      //Matching certificate?
+      if(entry->certInfo != NULL &&
+         osMemcmp(entry->digest, digest, SHA256_DIGEST_SIZE) == 0)
+      {
+         //Release the entry, unless it is still referenced
+         if(entry->refCount == 0)
+         {
+            x509CacheFreeEntry(entry);
+         }
+         else
+         {
+            entry->stale = TRUE;
+         }
+      }
+   }
+
+   //The verification memo is not indexed by certificate, so all the
+   //signatures involving the certificate are forgotten by flushing it
+   for(i = 0; i < X509_CACHE_SIGN_SIZE; i++)
+   {
+      x509SignCache[i].valid = FALSE;
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&x509CacheMutex);
+}
+
+
+/**
+ * @brief Flush the cache
+ **/
+
+void x509CacheFlush(void)
+{
+   uint_t i;
+   X509CacheEntry *entry;
+
+   //An uninitialized cache holds no certificate
+   if(!x509CacheReady)
+      return;
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&x509CacheMutex);
+
+   //Loop through the cache entries
+   for(i = 0; i < X509_CACHE_SIZE; i++)
+   {
+      //Point to the current entry
+      entry = &x509CertCache[i];
+
+      //Release the entry, unless it is still referenced
+      if(entry->refCount == 0)
+      {
+         x509CacheFreeEntry(entry);
+      }
+      else
+      {
+         entry->stale = TRUE;
+      }
+   }
+
+   //Forget all the signature verifications
+   for(i = 0; i < X509_CACHE_SIGN_SIZE; i++)
+   {
+      x509SignCache[i].valid = FALSE;
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&x509CacheMutex);
+}
+
+
+/**
+ * @brief Retrieve cache statistics
+ * @param[out] stats Hit, miss and eviction counters
+ **/
+
+void x509CacheGetStats(X509CacheStats *stats)
+{
+   //The cache has not been used yet?
+   if(!x509CacheReady)
+   {
+      osMemset(stats, 0, sizeof(X509CacheStats));
+      return;
+   }
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&x509CacheMutex);
+   //Copy statistics
+   *stats = x509CacheStatistics;
+   //Release exclusive access to the cache
+   osReleaseMutex(&x509CacheMutex);
+}
+
+
+/**
+ * @brief Digest the inputs of a signature verification
+ * @param[in] tbsData Data whose signature is to be verified
+ * @param[in] signAlgoId Signature algorithm identifier
+ * @param[in] publicKeyInfo Issuer's public key
+ * @param[in] signature Signature to be verified
+ * @param[out] digest Resulting digest
+ **/
+
+void x509CacheComputeSignDigest(const X509OctetString *tbsData,
+   const X509SignAlgoId *signAlgoId,
+   const X509SubjectPublicKeyInfo *publicKeyInfo,
+   const X509OctetString *signature, uint8_t *digest)
+{
+   uint_t i;
+   uint8_t temp[4];
+   Sha256Context context;
+   const X509OctetString *fields[7];
+
+   //Fields covered by the digest
+   fields[0] = tbsData;
+   fields[1] = &signAlgoId->oid;
+   fields[2] = &publicKeyInfo->raw;
+   fields[3] = signature;
+
+#if (X509_RSA_PSS_SUPPORT == ENABLED && RSA_SUPPORT == ENABLED)
+   //RSASSA-PSS parameters
+   fields[4] = &signAlgoId->rsaPssParams.hashAlgo;
+   fields[5] = &signAlgoId->rsaPssParams.maskGenAlgo;
+   fields[6] = &signAlgoId->rsaPssParams.maskGenHashAlgo;
+#else
+   //No parameters
+   fields[4] = NULL;
+   fields[5] = NULL;
+   fields[6] = NULL;
+#endif
+
+   //Initialize hash context
+   sha256Init(&context);
+
+   //Each field is prefixed with its length to avoid ambiguities
+   for(i = 0; i < arraysize(fields) && fields[i] != NULL; i++)
+   {
+      STORE32BE(fields[i]->length, temp);
+      sha256Update(&context, temp, sizeof(temp));
+      sha256Update(&context, fields[i]->value, fields[i]->length);
+   }
+
+#if (X509_RSA_PSS_SUPPORT == ENABLED && RSA_SUPPORT == ENABLED)
+   //Length of the salt
+   STORE32BE(signAlgoId->rsaPssParams.saltLen, temp);
+   sha256Update(&context, temp, sizeof(temp));
+#endif
+
+   //Finalize hash computation
+   sha256Final(&context, digest);
+}
+
+
+/**
+ * @brief Release a cache entry
+ * @param[in] entry Pointer to the cache entry
+ **/
+
+void x509CacheFreeEntry(X509CacheEntry *entry)
+{
+   //Release the parsed certificate
+   if(entry->certInfo != NULL)
+   {
+      cryptoFreeMem(entry->certInfo);
+   }
+
+   //Release the DER encoding
+   if(entry->der != NULL)
+   {
+      cryptoFreeMem(entry->der);
+   }
+
+   //Clear the entry
+   osMemset(entry, 0, sizeof(X509CacheEntry));
+}
+
+#endif
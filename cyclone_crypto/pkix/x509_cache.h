@@ -0,0 +1,140 @@
+/**
+ * @file x509_cache.h
+ * @brief Cache of parsed certificates and verified signatures
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _X509_CACHE_H
+#define _X509_CACHE_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "pkix/x509_common.h"
+#include "hash/sha256.h"
+
+//Number of parsed certificates held in the cache
+#ifndef X509_CACHE_SIZE
+   #define X509_CACHE_SIZE 8
+#elif (X509_CACHE_SIZE < 1)
+   #error X509_CACHE_SIZE parameter is not valid
+#endif
+
+//Maximum length of the certificates that can be cached
+#ifndef X509_CACHE_MAX_CERT_SIZE
+   #define X509_CACHE_MAX_CERT_SIZE 4096
+#elif (X509_CACHE_MAX_CERT_SIZE < 1)
+   #error X509_CACHE_MAX_CERT_SIZE parameter is not valid
+#endif
+
+//Number of successful signature verifications remembered by the cache
+#ifndef X509_CACHE_SIGN_SIZE
+   #define X509_CACHE_SIGN_SIZE 32
+#elif (X509_CACHE_SIGN_SIZE < 1)
+   #error X509_CACHE_SIGN_SIZE parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Parsed certificate cache entry
+ **/
+
+typedef struct
+{
+   uint8_t digest[SHA256_DIGEST_SIZE]; ///<SHA-256 digest of the DER-encoded certificate
+   uint8_t *der;                       ///<Copy of the DER-encoded certificate
+   size_t derLen;                      ///<Length of the DER-encoded certificate
+   X509CertInfo *certInfo;             ///<Parsed certificate (points to the DER encoding)
+   bool_t ignoreUnknown;               ///<Unknown extensions have been ignored during parsing
+   bool_t stale;                       ///<The entry has been invalidated
+   uint_t refCount;                    ///<Number of references held by the callers
+   uint32_t lastUsed;                  ///<Time stamp used to select the least recently used entry
+} X509CacheEntry;
+
+
+/**
+ * @brief Verified signature cache entry
+ **/
+
+typedef struct
+{
+   bool_t valid;                       ///<Valid entry
+   uint8_t digest[SHA256_DIGEST_SIZE]; ///<Digest of the signed data, signature and issuer's public key
+   uint32_t lastUsed;                  ///<Time stamp used to select the least recently used entry
+} X509CacheSignEntry;
+
+
+/**
+ * @brief Cache statistics
+ **/
+
+typedef struct
+{
+   uint32_t certHits;      ///<Number of certificates found in the cache
+   uint32_t certMisses;    ///<Number of certificates that had to be parsed
+   uint32_t certEvictions; ///<Number of certificates evicted from the cache
+   uint32_t signHits;      ///<Number of signature verifications skipped
+   uint32_t signMisses;    ///<Number of signature verifications performed
+   uint32_t signEvictions; ///<Number of verified signatures evicted from the cache
+} X509CacheStats;
+
+
+//X.509 cache related functions. The cache initializes itself on first use.
+//On ports where osSuspendAllTasks() does not suspend the other tasks (POSIX,
+//Windows), x509CacheInit() must be called before the cache can be used by
+//several tasks at the same time, e.g. before the first TLS connection
+error_t x509CacheInit(void);
+
+error_t x509CacheGetCertificate(const uint8_t *data, size_t length,
+   bool_t ignoreUnknown, const X509CertInfo **certInfo);
+
+void x509CacheReleaseCertificate(const X509CertInfo *certInfo);
+
+error_t x509CacheVerifySignature(const X509OctetString *tbsData,
+   const X509SignAlgoId *signAlgoId,
+   const X509SubjectPublicKeyInfo *publicKeyInfo,
+   const X509OctetString *signature);
+
+void x509CacheInvalidate(const uint8_t *data, size_t length);
+void x509CacheFlush(void);
+
+void x509CacheGetStats(X509CacheStats *stats);
+
+void x509CacheComputeSignDigest(const X509OctetString *tbsData,
+   const X509SignAlgoId *signAlgoId,
+   const X509SubjectPublicKeyInfo *publicKeyInfo,
+   const X509OctetString *signature, uint8_t *digest);
+
+void x509CacheFreeEntry(X509CacheEntry *entry);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
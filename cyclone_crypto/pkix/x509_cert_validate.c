@@ -34,6 +34,7 @@
 #include "pkix/x509_cert_ext_parse.h"
 #include "pkix/x509_cert_validate.h"
 #include "pkix/x509_sign_verify.h"
+#include "pkix/x509_cache.h"
 #include "debug.h"
 
 //Check crypto library configuration
@@ -128,8 +129,14 @@ error_t x509ValidateCertificate(const X509CertInfo *certInfo,
 
    //The ASN.1 DER-encoded tbsCertificate is used as the input to the signature
    //function
+#if (X509_CACHE_SUPPORT == ENABLED)
+   error = x509CacheVerifySignature(&certInfo->tbsCert.raw,
+      &certInfo->signatureAlgo, &issuerCertInfo->tbsCert.subjectPublicKeyInfo,
+      &certInfo->signatureValue);
+#else
    error = x509VerifySignature(&certInfo->tbsCert.raw, &certInfo->signatureAlgo,
       &issuerCertInfo->tbsCert.subjectPublicKeyInfo, &certInfo->signatureValue);
+#endif
 
    //Return status code
    return error;
@@ -44,6 +44,13 @@
    #error X509_SIGN_CALLBACK_SUPPORT parameter is not valid
 #endif
 
+//Cache of parsed certificates and verified signatures
+#ifndef X509_CACHE_SUPPORT
+   #define X509_CACHE_SUPPORT DISABLED
+#elif (X509_CACHE_SUPPORT != ENABLED && X509_CACHE_SUPPORT != DISABLED)
+   #error X509_CACHE_SUPPORT parameter is not valid
+#endif
+
 //RSA certificate support
 #ifndef X509_RSA_SUPPORT
    #define X509_RSA_SUPPORT ENABLED
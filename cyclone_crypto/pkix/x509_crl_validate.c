@@ -35,6 +35,7 @@
 #include "pkix/x509_cert_parse.h"
 #include "pkix/x509_cert_validate.h"
 #include "pkix/x509_sign_verify.h"
+#include "encoding/asn1.h"
 #include "debug.h"
 
 //Check crypto library configuration
@@ -222,4 +223,369 @@ error_t x509CheckRevokedCertificate(const X509CertInfo *certInfo,
    return error;
 }
 
+
+/**
+ * @brief Build the revocation index of a CRL
+ *
+ * The list of revoked certificates is parsed once and the entries are sorted
+ * by serial number, so that any number of certificates can then be checked
+ * against the CRL with a binary search. The index points to the DER encoding
+ * of the CRL, which must remain valid until x509FreeCrlIndex() is called
+ *
+ * @param[out] index Pointer to the CRL index
+ * @param[in] crlInfo Pointer to the CRL
+ * @return Error code
+ **/
+
+error_t x509InitCrlIndex(X509CrlIndex *index, const X509CrlInfo *crlInfo)
+{
+   error_t error;
+   uint_t i;
+   size_t n;
+   size_t length;
+   const uint8_t *data;
+   const uint8_t *certIssuer;
+   size_t certIssuerLen;
+   Asn1Tag tag;
+   X509RevokedCertificate revokedCert;
+
+   //Check parameters
+   if(index == NULL || crlInfo == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize the index
+   osMemset(index, 0, sizeof(X509CrlIndex));
+   index->crlInfo = crlInfo;
+
+   //Point to the first entry of the list
+   data = crlInfo->tbsCertList.revokedCerts.value;
+   length = crlInfo->tbsCertList.revokedCerts.length;
+
+   //Count the number of revoked certificates
+   for(i = 0; length > 0; i++)
+   {
+      //Each entry shall contain a valid sequence
+      error = asn1ReadSequence(data, length, &tag);
+      //Failed to decode ASN.1 tag?
+      if(error)
+         return error;
+
+      //Next item
+      data += tag.totalLength;
+      length -= tag.totalLength;
+   }
+
+   //Empty CRL?
+   if(i == 0)
+      return NO_ERROR;
+
+   //Allocate the entries of the index
+   index->entries = cryptoAllocMem(i * sizeof(X509CrlIndexEntry));
+   //Failed to allocate memory?
+   if(index->entries == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //If the CertificateIssuer extension is not present on the first entry in
+   //an indirect CRL, the certificate issuer defaults to the CRL issuer
+   certIssuer = NULL;
+   certIssuerLen = 0;
+
+   //Point to the first entry of the list
+   data = crlInfo->tbsCertList.revokedCerts.value;
+   length = crlInfo->tbsCertList.revokedCerts.length;
+
+   //Loop through the list of revoked certificates
+   for(i = 0; length > 0; i++)
+   {
+      //Parse current entry
+      error = x509ParseRevokedCertificate(data, length, &n, &revokedCert);
+      //Any error to report?
+      if(error)
+      {
+         x509FreeCrlIndex(index);
+         return error;
+      }
+
+      //Indirect CRL?
+      if(crlInfo->tbsCertList.crlExtensions.issuingDistrPoint.indirectCrl)
+      {
+         //Check whether the CertificateIssuer is present?
+         if(revokedCert.crlEntryExtensions.certIssuer.numGeneralNames > 0)
+         {
+            //Save certificate issuer
+            certIssuer = revokedCert.crlEntryExtensions.certIssuer.raw.value;
+            certIssuerLen = revokedCert.crlEntryExtensions.certIssuer.raw.length;
+         }
+      }
+
+      //Save the relevant fields of the entry
+      index->entries[i].serialNumber = revokedCert.userCert.value;
+      index->entries[i].serialNumberLen = revokedCert.userCert.length;
+      index->entries[i].certIssuer = certIssuer;
+      index->entries[i].certIssuerLen = certIssuerLen;
+      index->entries[i].reasonCode = revokedCert.crlEntryExtensions.reasonCode.value;
+
+      //Next item
+      data += n;
+      length -= n;
+   }
+
+   //Save the number of entries
+   index->numEntries = i;
+
+   //Sort the entries by serial number
+   x509SortCrlIndex(index->entries, index->numEntries);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Check whether a certificate is listed in an indexed CRL
+ * @param[in] certInfo Pointer to the certificate to be checked
+ * @param[in] index Pointer to the CRL index
+ * @param[out] entry Matching entry of the index (optional parameter)
+ * @return Error code (ERROR_CERTIFICATE_REVOKED if the certificate has been
+ *   revoked)
+ **/
+
+error_t x509CheckRevokedCertificateIndex(const X509CertInfo *certInfo,
+   const X509CrlIndex *index, const X509CrlIndexEntry **entry)
+{
+   uint_t i;
+   uint_t left;
+   uint_t right;
+   const uint8_t *serialNumber;
+   size_t serialNumberLen;
+
+   //Check parameters
+   if(certInfo == NULL || index == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Point to the serial number of the certificate
+   serialNumber = certInfo->tbsCert.serialNumber.value;
+   serialNumberLen = certInfo->tbsCert.serialNumber.length;
+
+   //Search for the first entry whose serial number is not lower than the
+   //serial number of the certificate
+   left = 0;
+   right = index->numEntries;
+
+   //Binary search
+   while(left < right)
+   {
+      i = left + (right - left) / 2;
+
+      if(x509CompareCrlIndexEntry(&index->entries[i], serialNumber,
+         serialNumberLen) < 0)
+      {
+         left = i + 1;
+      }
+      else
+      {
+         right = i;
+      }
+   }
+
+   //In an indirect CRL, the same serial number may appear once per
+   //certificate issuer
+   for(i = left; i < index->numEntries; i++)
+   {
+      //Serial numbers do not match?
+      if(x509CompareCrlIndexEntry(&index->entries[i], serialNumber,
+         serialNumberLen) != 0)
+      {
+         break;
+      }
+
+      //Check whether the issuer of the certificate matches the current entry
+      if(x509CheckCrlIndexIssuer(certInfo, index, &index->entries[i]))
+      {
+         //Return the matching entry, if requested
+         if(entry != NULL)
+         {
+            *entry = &index->entries[i];
+         }
+
+         //The certificate has been revoked
+         return ERROR_CERTIFICATE_REVOKED;
+      }
+   }
+
+   //The certificate is not listed in the CRL
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Check whether the issuer of a certificate matches a CRL entry
+ * @param[in] certInfo Pointer to the certificate
+ * @param[in] index Pointer to the CRL index
+ * @param[in] entry Pointer to the entry of the index
+ * @return TRUE if the certificate issuer matches, else FALSE
+ **/
+
+bool_t x509CheckCrlIndexIssuer(const X509CertInfo *certInfo,
+   const X509CrlIndex *index, const X509CrlIndexEntry *entry)
+{
+   error_t error;
+   uint_t i;
+   size_t n;
+   size_t length;
+   const uint8_t *data;
+   X509GeneralName generalName;
+
+   //The certificate issuer defaults to the CRL issuer
+   if(entry->certIssuer == NULL)
+   {
+      return x509CompareName(index->crlInfo->tbsCertList.issuer.raw.value,
+         index->crlInfo->tbsCertList.issuer.raw.length,
+         certInfo->tbsCert.issuer.raw.value,
+         certInfo->tbsCert.issuer.raw.length);
+   }
+
+   //Point to the list of general names
+   data = entry->certIssuer;
+   length = entry->certIssuerLen;
+
+   //Loop through the names of the certificate issuer
+   for(i = 0; length > 0 && i < X509_MAX_CRL_ISSUERS; i++)
+   {
+      //Parse GeneralName field
+      error = x509ParseGeneralName(data, length, &n, &generalName);
+      //Any error to report?
+      if(error)
+         break;
+
+      //Distinguished name?
+      if(generalName.type == X509_GENERAL_NAME_TYPE_DIRECTORY)
+      {
+         //Compare distinguished names
+         if(x509CompareName((uint8_t *) generalName.value, generalName.length,
+            certInfo->tbsCert.issuer.raw.value,
+            certInfo->tbsCert.issuer.raw.length))
+         {
+            return TRUE;
+         }
+      }
+
+      //Next item
+      data += n;
+      length -= n;
+   }
+
+   //The certificate issuer does not match
+   return FALSE;
+}
+
+
+/**
+ * @brief Sort the entries of a CRL index by serial number (heapsort)
+ * @param[in,out] entries Array of entries
+ * @param[in] numEntries Number of entries
+ **/
+
+void x509SortCrlIndex(X509CrlIndexEntry *entries, uint_t numEntries)
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint_t n;
+   X509CrlIndexEntry temp;
+
+   //Build a max-heap, then repeatedly move the largest entry to the end of
+   //the array
+   for(i = numEntries / 2, n = numEntries; n > 1; )
+   {
+      //Heap construction phase?
+      if(i > 0)
+      {
+         i--;
+      }
+      else
+      {
+         //Swap the root of the heap with the last entry
+         n--;
+         temp = entries[0];
+         entries[0] = entries[n];
+         entries[n] = temp;
+      }
+
+      //Sift down the current entry
+      for(j = i; (2 * j + 1) < n; j = k)
+      {
+         //Select the largest child
+         k = 2 * j + 1;
+
+         if((k + 1) < n && x509CompareCrlIndexEntry(&entries[k],
+            entries[k + 1].serialNumber, entries[k + 1].serialNumberLen) < 0)
+         {
+            k++;
+         }
+
+         //The heap property is satisfied?
+         if(x509CompareCrlIndexEntry(&entries[j], entries[k].serialNumber,
+            entries[k].serialNumberLen) >= 0)
+         {
+            break;
+         }
+
+         //Swap the entry with its largest child
+         temp = entries[j];
+         entries[j] = entries[k];
+         entries[k] = temp;
+      }
+   }
+}
+
+
+/**
+ * @brief Compare the serial number of a CRL index entry
+ * @param[in] entry Pointer to the entry of the index
+ * @param[in] serialNumber Serial number to compare with
+ * @param[in] serialNumberLen Length of the serial number
+ * @return Comparison result (negative, zero or positive)
+ **/
+
+int_t x509CompareCrlIndexEntry(const X509CrlIndexEntry *entry,
+   const uint8_t *serialNumber, size_t serialNumberLen)
+{
+   //Serial numbers are ordered by length first, then lexicographically
+   if(entry->serialNumberLen < serialNumberLen)
+   {
+      return -1;
+   }
+   else if(entry->serialNumberLen > serialNumberLen)
+   {
+      return 1;
+   }
+   else
+   {
+      return osMemcmp(entry->serialNumber, serialNumber, serialNumberLen);
+   }
+}
+
+
+/**
+ * @brief Release a CRL index
+ * @param[in] index Pointer to the CRL index
+ **/
+
+void x509FreeCrlIndex(X509CrlIndex *index)
+{
+   //Valid index?
+   if(index != NULL)
+   {
+      //Release the entries of the index
+      if(index->entries != NULL)
+      {
+         cryptoFreeMem(index->entries);
+      }
+
+      //Clear the index
+      osMemset(index, 0, sizeof(X509CrlIndex));
+   }
+}
+
 #endif
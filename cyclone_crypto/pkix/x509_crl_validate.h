@@ -37,6 +37,33 @@
 extern "C" {
 #endif
 
+
+/**
+ * @brief Entry of a CRL index
+ **/
+
+typedef struct
+{
+   const uint8_t *serialNumber; ///<Serial number of the revoked certificate
+   size_t serialNumberLen;      ///<Length of the serial number, in bytes
+   const uint8_t *certIssuer;   ///<Certificate issuer (indirect CRL only)
+   size_t certIssuerLen;        ///<Length of the certificate issuer, in bytes
+   uint8_t reasonCode;          ///<Revocation reason
+} X509CrlIndexEntry;
+
+
+/**
+ * @brief CRL index
+ **/
+
+typedef struct
+{
+   const X509CrlInfo *crlInfo; ///<CRL the index refers to
+   X509CrlIndexEntry *entries; ///<Entries sorted by serial number
+   uint_t numEntries;          ///<Number of entries
+} X509CrlIndex;
+
+
 //CSR related functions
 error_t x509ValidateCrl(const X509CrlInfo *crlInfo,
    const X509CertInfo *issuerCertInfo);
@@ -44,6 +71,21 @@ error_t x509ValidateCrl(const X509CrlInfo *crlInfo,
 error_t x509CheckRevokedCertificate(const X509CertInfo *certInfo,
    const X509CrlInfo *crlInfo);
 
+error_t x509InitCrlIndex(X509CrlIndex *index, const X509CrlInfo *crlInfo);
+
+error_t x509CheckRevokedCertificateIndex(const X509CertInfo *certInfo,
+   const X509CrlIndex *index, const X509CrlIndexEntry **entry);
+
+bool_t x509CheckCrlIndexIssuer(const X509CertInfo *certInfo,
+   const X509CrlIndex *index, const X509CrlIndexEntry *entry);
+
+void x509SortCrlIndex(X509CrlIndexEntry *entries, uint_t numEntries);
+
+int_t x509CompareCrlIndexEntry(const X509CrlIndexEntry *entry,
+   const uint8_t *serialNumber, size_t serialNumberLen);
+
+void x509FreeCrlIndex(X509CrlIndex *index);
+
 //C++ guard
 #ifdef __cplusplus
 }
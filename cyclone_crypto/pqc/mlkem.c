@@ -0,0 +1,1286 @@
+/**
+ * @file mlkem.c
+ * @brief ML-KEM key encapsulation mechanism (FIPS 203)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * ML-KEM is a key encapsulation mechanism based on the hardness of the Module
+ * Learning With Errors problem. The implementation does not rely on dynamic
+ * memory allocation. The matrix A is never stored in memory: each of its
+ * elements is expanded from the public seed when it is needed, so that the
+ * working memory only grows linearly with the dimension of the module. Refer
+ * to FIPS 203 for more details
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "pqc/mlkem.h"
+#include "hash/sha3_256.h"
+#include "hash/sha3_512.h"
+#include "xof/shake.h"
+
+//Check crypto library configuration
+#if (MLKEM512_SUPPORT == ENABLED || MLKEM768_SUPPORT == ENABLED || \
+   MLKEM1024_SUPPORT == ENABLED)
+
+//q^-1 mod 2^16
+#define MLKEM_QINV -3327
+//2^32 mod q (conversion to Montgomery representation)
+#define MLKEM_MONT2 1353
+//2^32 / 128 mod q (scaling factor of the inverse NTT)
+#define MLKEM_INV_NTT_F 1441
+
+//Powers of the primitive 256-th root of unity (17), in bit-reversed order
+//and Montgomery representation
+static const int16_t MLKEM_ZETA[128] =
+{
+   -1044,  -758,  -359, -1517,  1493,  1422,   287,   202,
+    -171,   622,  1577,   182,   962, -1202, -1474,  1468,
+     573, -1325,   264,   383,  -829,  1458, -1602,  -130,
+    -681,  1017,   732,   608, -1542,   411,  -205, -1571,
+    1223,   652,  -552,  1015, -1293,  1491,  -282, -1544,
+     516,    -8,  -320,  -666, -1618, -1162,   126,  1469,
+    -853,   -90,  -271,   830,   107, -1421,  -247,  -951,
+    -398,   961, -1508,  -725,   448, -1065,   677, -1275,
+   -1103,   430,   555,   843, -1251,   871,  1550,   105,
+     422,   587,   177,  -235,  -291,  -460,  1574,  1653,
+    -246,   778,  1159,  -147,  -777,  1483,  -602,  1119,
+   -1590,   644,  -872,   349,   418,   329,  -156,   -75,
+     817,  1097,   603,   610,  1322, -1285, -1465,   384,
+   -1215,  -136,  1218, -1335,  -874,   220, -1187, -1659,
+   -1185, -1530, -1278,   794, -1510,  -854,  -870,   478,
+    -108,  -308,   996,   991,   958, -1460,  1522,  1628
+};
+
+
+/**
+ * @brief Key pair generation
+ * @param[in] params ML-KEM parameter set
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @param[out] pk Public key (encapsulation key)
+ * @param[out] sk Secret key (decapsulation key)
+ * @return Error code
+ **/
+
+error_t mlkemGenerateKeyPair(const MlkemParameters *params,
+   const PrngAlgo *prngAlgo, void *prngContext, uint8_t *pk, uint8_t *sk)
+{
+   error_t error;
+   uint8_t seed[2 * MLKEM_SYM_BYTES];
+
+   //Check parameters
+   if(params == NULL || prngAlgo == NULL || pk == NULL || sk == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Generate the random seeds d and z
+   error = prngAlgo->read(prngContext, seed, 2 * MLKEM_SYM_BYTES);
+
+   //Check status code
+   if(!error)
+   {
+      //Derive the key pair from the seeds
+      error = mlkemGenerateKeyPairInternal(params, seed,
+         seed + MLKEM_SYM_BYTES, pk, sk);
+   }
+
+   //Erase the seeds
+   osMemset(seed, 0, 2 * MLKEM_SYM_BYTES);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Deterministic key pair generation (ML-KEM.KeyGen_internal)
+ * @param[in] params ML-KEM parameter set
+ * @param[in] d 32-byte seed used to derive the K-PKE key pair
+ * @param[in] z 32-byte seed used for implicit rejection
+ * @param[out] pk Public key (encapsulation key)
+ * @param[out] sk Secret key (decapsulation key)
+ * @return Error code
+ **/
+
+error_t mlkemGenerateKeyPairInternal(const MlkemParameters *params,
+   const uint8_t *d, const uint8_t *z, uint8_t *pk, uint8_t *sk)
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint8_t c;
+   uint8_t seed[2 * MLKEM_SYM_BYTES];
+   const uint8_t *rho;
+   const uint8_t *sigma;
+   ShakeContext shakeContext;
+   MlkemPoly s[MLKEM_MAX_K];
+   MlkemPoly t;
+   MlkemPoly a;
+#if (MLKEM_PARALLEL_SAMPLING_SUPPORT == ENABLED)
+   MlkemPoly row[MLKEM_MAX_K];
+#endif
+
+   //Check parameters
+   if(params == NULL || d == NULL || z == NULL || pk == NULL || sk == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Dimension of the module
+   k = params->k;
+
+   //Check the parameter set
+   if(k < 2 || k > MLKEM_MAX_K)
+      return ERROR_INVALID_PARAMETER;
+
+   //Compute (rho, sigma) = G(d || k)
+   c = (uint8_t) k;
+   sha3_512Init(&shakeContext.keccakContext);
+   sha3_512Update(&shakeContext.keccakContext, d, MLKEM_SYM_BYTES);
+   sha3_512Update(&shakeContext.keccakContext, &c, sizeof(uint8_t));
+   sha3_512Final(&shakeContext.keccakContext, seed);
+
+   //Point to the public and private seeds
+   rho = seed;
+   sigma = seed + MLKEM_SYM_BYTES;
+
+   //Sample the secret vector s from the centered binomial distribution
+   for(i = 0; i < k; i++)
+   {
+      mlkemSampleCbd(&s[i], &shakeContext, sigma, (uint8_t) i, params->eta1);
+      mlkemNtt(&s[i]);
+   }
+
+   //Compute t = A * s + e, one row at a time
+   for(i = 0; i < k; i++)
+   {
+      mlkemSetZero(&t);
+
+#if (MLKEM_PARALLEL_SAMPLING_SUPPORT == ENABLED)
+      //Expand the elements of the current row of A in lockstep
+      mlkemSampleNttRow(row, rho, k, (uint8_t) i, FALSE);
+
+      for(j = 0; j < k; j++)
+      {
+         mlkemBaseMulAcc(&t, &row[j], &s[j]);
+      }
+#else
+      //Expand the elements of the current row of A on the fly
+      for(j = 0; j < k; j++)
+      {
+         mlkemSampleNtt(&a, &shakeContext, rho, (uint8_t) j, (uint8_t) i);
+         mlkemBaseMulAcc(&t, &a, &s[j]);
+      }
+#endif
+
+      //Convert the result to Montgomery representation
+      mlkemRed(&t);
+      mlkemToMont(&t);
+
+      //Sample the error term
+      mlkemSampleCbd(&a, &shakeContext, sigma, (uint8_t) (k + i),
+         params->eta1);
+      mlkemNtt(&a);
+
+      //Add the error term
+      mlkemAdd(&t, &t, &a);
+      mlkemRed(&t);
+
+      //The encapsulation key contains the encoding of t
+      mlkemEncodePoly(pk + i * MLKEM_POLY_BYTES, &t, 12);
+   }
+
+   //The public seed rho is appended to the encapsulation key
+   osMemcpy(pk + k * MLKEM_POLY_BYTES, rho, MLKEM_SYM_BYTES);
+
+   //The decapsulation key starts with the encoding of s
+   for(i = 0; i < k; i++)
+   {
+      mlkemEncodePoly(sk + i * MLKEM_POLY_BYTES, &s[i], 12);
+   }
+
+   //Point to the remaining fields of the decapsulation key
+   sk += k * MLKEM_POLY_BYTES;
+
+   //Append the encapsulation key
+   osMemcpy(sk, pk, k * MLKEM_POLY_BYTES + MLKEM_SYM_BYTES);
+   sk += k * MLKEM_POLY_BYTES + MLKEM_SYM_BYTES;
+
+   //Append H(ek)
+   sha3_256Init(&shakeContext.keccakContext);
+   sha3_256Update(&shakeContext.keccakContext, pk,
+      k * MLKEM_POLY_BYTES + MLKEM_SYM_BYTES);
+   sha3_256Final(&shakeContext.keccakContext, sk);
+   sk += MLKEM_SYM_BYTES;
+
+   //Append the implicit rejection value z
+   osMemcpy(sk, z, MLKEM_SYM_BYTES);
+
+   //Erase sensitive data
+   osMemset(seed, 0, sizeof(seed));
+   osMemset(s, 0, sizeof(s));
+   osMemset(&shakeContext, 0, sizeof(ShakeContext));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Encapsulation algorithm
+ * @param[in] params ML-KEM parameter set
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @param[out] ct Ciphertext
+ * @param[out] ss Shared secret
+ * @param[in] pk Public key (encapsulation key)
+ * @return Error code
+ **/
+
+error_t mlkemEncapsulate(const MlkemParameters *params,
+   const PrngAlgo *prngAlgo, void *prngContext, uint8_t *ct, uint8_t *ss,
+   const uint8_t *pk)
+{
+   error_t error;
+   uint8_t m[MLKEM_SYM_BYTES];
+
+   //Check parameters
+   if(params == NULL || prngAlgo == NULL || ct == NULL || ss == NULL ||
+      pk == NULL)
+   {
+      return ERROR_INVALID_PARAMETER;
+   }
+
+   //Generate a random message
+   error = prngAlgo->read(prngContext, m, MLKEM_SYM_BYTES);
+
+   //Check status code
+   if(!error)
+   {
+      //Encapsulate the message
+      error = mlkemEncapsulateInternal(params, m, ct, ss, pk);
+   }
+
+   //Erase the message
+   osMemset(m, 0, MLKEM_SYM_BYTES);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Deterministic encapsulation algorithm (ML-KEM.Encaps_internal)
+ * @param[in] params ML-KEM parameter set
+ * @param[in] m 32-byte random message
+ * @param[out] ct Ciphertext
+ * @param[out] ss Shared secret
+ * @param[in] pk Public key (encapsulation key)
+ * @return Error code
+ **/
+
+error_t mlkemEncapsulateInternal(const MlkemParameters *params,
+   const uint8_t *m, uint8_t *ct, uint8_t *ss, const uint8_t *pk)
+{
+   uint_t i;
+   uint_t k;
+   uint16_t t0;
+   uint16_t t1;
+   uint8_t buffer[2 * MLKEM_SYM_BYTES];
+   Sha3_256Context sha3Context;
+
+   //Check parameters
+   if(params == NULL || m == NULL || ct == NULL || ss == NULL || pk == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Dimension of the module
+   k = params->k;
+
+   //Check the parameter set
+   if(k < 2 || k > MLKEM_MAX_K)
+      return ERROR_INVALID_PARAMETER;
+
+   //Modulus check: the coefficients of the encoded vector t must be
+   //smaller than q (refer to FIPS 203, section 7.2)
+   for(i = 0; i < (k * MLKEM_POLY_BYTES); i += 3)
+   {
+      //Each group of 3 bytes holds two 12-bit coefficients
+      t0 = pk[i] | ((pk[i + 1] & 0x0F) << 8);
+      t1 = (pk[i + 1] >> 4) | (pk[i + 2] << 4);
+
+      //Check the values of the coefficients
+      if(t0 >= MLKEM_Q || t1 >= MLKEM_Q)
+         return ERROR_INVALID_KEY;
+   }
+
+   //Compute H(ek)
+   sha3_256Init(&sha3Context);
+   sha3_256Update(&sha3Context, pk, k * MLKEM_POLY_BYTES + MLKEM_SYM_BYTES);
+   sha3_256Final(&sha3Context, buffer + MLKEM_SYM_BYTES);
+
+   //Compute (K, r) = G(m || H(ek))
+   osMemcpy(buffer, m, MLKEM_SYM_BYTES);
+   sha3_512Init(&sha3Context);
+   sha3_512Update(&sha3Context, buffer, 2 * MLKEM_SYM_BYTES);
+   sha3_512Final(&sha3Context, buffer);
+
+   //Encrypt the message using the randomness r
+   mlkemPkeEncrypt(params, ct, NULL, pk, m, buffer + MLKEM_SYM_BYTES);
+
+   //The shared secret is K
+   osMemcpy(ss, buffer, MLKEM_SYM_BYTES);
+
+   //Erase sensitive data
+   osMemset(buffer, 0, sizeof(buffer));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Decapsulation algorithm
+ * @param[in] params ML-KEM parameter set
+ * @param[out] ss Shared secret
+ * @param[in] ct Ciphertext
+ * @param[in] sk Secret key (decapsulation key)
+ * @return Error code
+ **/
+
+error_t mlkemDecapsulate(const MlkemParameters *params, uint8_t *ss,
+   const uint8_t *ct, const uint8_t *sk)
+{
+   uint_t i;
+   uint_t k;
+   uint8_t mask;
+   uint32_t ret;
+   size_t ctLen;
+   const uint8_t *ek;
+   const uint8_t *h;
+   const uint8_t *z;
+   uint8_t m[MLKEM_SYM_BYTES];
+   uint8_t kr[2 * MLKEM_SYM_BYTES];
+   uint8_t kBar[MLKEM_SYM_BYTES];
+   ShakeContext shakeContext;
+
+   //Check parameters
+   if(params == NULL || ss == NULL || ct == NULL || sk == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Dimension of the module
+   k = params->k;
+
+   //Check the parameter set
+   if(k < 2 || k > MLKEM_MAX_K)
+      return ERROR_INVALID_PARAMETER;
+
+   //Length of the ciphertext
+   ctLen = (params->du * k + params->dv) * MLKEM_N / 8;
+
+   //Parse the decapsulation key
+   ek = sk + k * MLKEM_POLY_BYTES;
+   h = ek + k * MLKEM_POLY_BYTES + MLKEM_SYM_BYTES;
+   z = h + MLKEM_SYM_BYTES;
+
+   //Hash check: the decapsulation key must contain H(ek) (refer to FIPS 203,
+   //section 7.3)
+   sha3_256Init(&shakeContext.keccakContext);
+   sha3_256Update(&shakeContext.keccakContext, ek,
+      k * MLKEM_POLY_BYTES + MLKEM_SYM_BYTES);
+   sha3_256Final(&shakeContext.keccakContext, kr);
+
+   //Compare the digests
+   for(ret = 0, i = 0; i < MLKEM_SYM_BYTES; i++)
+   {
+      ret |= kr[i] ^ h[i];
+   }
+
+   //Malformed decapsulation key?
+   if(ret != 0)
+      return ERROR_INVALID_KEY;
+
+   //Decrypt the ciphertext
+   mlkemPkeDecrypt(params, m, sk, ct);
+
+   //Compute (K', r') = G(m' || h)
+   sha3_512Init(&shakeContext.keccakContext);
+   sha3_512Update(&shakeContext.keccakContext, m, MLKEM_SYM_BYTES);
+   sha3_512Update(&shakeContext.keccakContext, h, MLKEM_SYM_BYTES);
+   sha3_512Final(&shakeContext.keccakContext, kr);
+
+   //Compute K_bar = J(z || c)
+   shakeInit(&shakeContext, 256);
+   shakeAbsorb(&shakeContext, z, MLKEM_SYM_BYTES);
+   shakeAbsorb(&shakeContext, ct, ctLen);
+   shakeFinal(&shakeContext);
+   shakeSqueeze(&shakeContext, kBar, MLKEM_SYM_BYTES);
+
+   //Re-encrypt the message using the derived randomness and compare the
+   //result with the received ciphertext
+   ret = mlkemPkeEncrypt(params, NULL, ct, ek, m, kr + MLKEM_SYM_BYTES);
+
+   //The mask is 0xFF if the ciphertexts differ, else 0x00
+   mask = (uint8_t) (0 - ((ret | (0 - ret)) >> 31));
+
+   //Implicit rejection: the shared secret is K_bar if the ciphertexts
+   //differ, else K' (constant-time selection)
+   for(i = 0; i < MLKEM_SYM_BYTES; i++)
+   {
+      ss[i] = (kr[i] & ~mask) | (kBar[i] & mask);
+   }
+
+   //Erase sensitive data
+   osMemset(m, 0, sizeof(m));
+   osMemset(kr, 0, sizeof(kr));
+   osMemset(kBar, 0, sizeof(kBar));
+   osMemset(&shakeContext, 0, sizeof(ShakeContext));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief K-PKE encryption algorithm
+ *
+ * When ctRef is not NULL, the resulting ciphertext is compared in constant
+ * time with the reference ciphertext. This allows the re-encryption step of
+ * the decapsulation algorithm to be performed without storing a whole
+ * ciphertext
+ *
+ * @param[in] params ML-KEM parameter set
+ * @param[out] ct Resulting ciphertext (optional parameter)
+ * @param[in] ctRef Reference ciphertext (optional parameter)
+ * @param[in] ek Encryption key
+ * @param[in] m 32-byte message
+ * @param[in] r 32-byte randomness
+ * @return 0 if the resulting ciphertext matches the reference ciphertext
+ **/
+
+uint32_t mlkemPkeEncrypt(const MlkemParameters *params, uint8_t *ct,
+   const uint8_t *ctRef, const uint8_t *ek, const uint8_t *m,
+   const uint8_t *r)
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   size_t n;
+   uint32_t ret;
+   const uint8_t *rho;
+   uint8_t buffer[MLKEM_POLY_BYTES];
+   ShakeContext shakeContext;
+   MlkemPoly y[MLKEM_MAX_K];
+   MlkemPoly u;
+   MlkemPoly a;
+#if (MLKEM_PARALLEL_SAMPLING_SUPPORT == ENABLED)
+   MlkemPoly column[MLKEM_MAX_K];
+#endif
+
+   //Initialize status code
+   ret = 0;
+
+   //Dimension of the module
+   k = params->k;
+   //Point to the public seed
+   rho = ek + k * MLKEM_POLY_BYTES;
+
+   //Sample the vector y from the centered binomial distribution
+   for(i = 0; i < k; i++)
+   {
+      mlkemSampleCbd(&y[i], &shakeContext, r, (uint8_t) i, params->eta1);
+      mlkemNtt(&y[i]);
+   }
+
+   //Size of a compressed element of u
+   n = params->du * MLKEM_N / 8;
+
+   //Compute u = NTT^-1(A^T * y) + e1, one element at a time
+   for(i = 0; i < k; i++)
+   {
+      mlkemSetZero(&u);
+
+#if (MLKEM_PARALLEL_SAMPLING_SUPPORT == ENABLED)
+      //Expand the elements of the current column of A in lockstep
+      mlkemSampleNttRow(column, rho, k, (uint8_t) i, TRUE);
+
+      for(j = 0; j < k; j++)
+      {
+         mlkemBaseMulAcc(&u, &column[j], &y[j]);
+      }
+#else
+      //Expand the elements of the current column of A on the fly
+      for(j = 0; j < k; j++)
+      {
+         mlkemSampleNtt(&a, &shakeContext, rho, (uint8_t) i, (uint8_t) j);
+         mlkemBaseMulAcc(&u, &a, &y[j]);
+      }
+#endif
+
+      //Return to the normal domain
+      mlkemRed(&u);
+      mlkemInvNtt(&u);
+
+      //Add the error term e1
+      mlkemSampleCbd(&a, &shakeContext, r, (uint8_t) (k + i), params->eta2);
+      mlkemAdd(&u, &u, &a);
+      mlkemRed(&u);
+
+      //Compress and encode the current element of u
+      mlkemCompress(&u, params->du);
+      mlkemEncodePoly(buffer, &u, params->du);
+
+      //Compare the result with the reference ciphertext
+      if(ctRef != NULL)
+      {
+         for(j = 0; j < n; j++)
+         {
+            ret |= buffer[j] ^ ctRef[i * n + j];
+         }
+      }
+
+      //Copy the result to the ciphertext
+      if(ct != NULL)
+      {
+         osMemcpy(ct + i * n, buffer, n);
+      }
+   }
+
+   //Compute v = NTT^-1(t^T * y) + e2 + Decompress1(m)
+   mlkemSetZero(&u);
+
+   //Decode the elements of the vector t on the fly
+   for(j = 0; j < k; j++)
+   {
+      mlkemDecodePoly(&a, ek + j * MLKEM_POLY_BYTES, 12);
+      mlkemBaseMulAcc(&u, &a, &y[j]);
+   }
+
+   //Return to the normal domain
+   mlkemRed(&u);
+   mlkemInvNtt(&u);
+
+   //Add the error term e2
+   mlkemSampleCbd(&a, &shakeContext, r, (uint8_t) (2 * k), params->eta2);
+   mlkemAdd(&u, &u, &a);
+
+   //Encode the message as a polynomial
+   mlkemDecodePoly(&a, m, 1);
+   mlkemDecompress(&a, 1);
+   mlkemAdd(&u, &u, &a);
+   mlkemRed(&u);
+
+   //Point to the second part of the ciphertext
+   i = k * n;
+   //Size of the compressed polynomial v
+   n = params->dv * MLKEM_N / 8;
+
+   //Compress and encode v
+   mlkemCompress(&u, params->dv);
+   mlkemEncodePoly(buffer, &u, params->dv);
+
+   //Compare the result with the reference ciphertext
+   if(ctRef != NULL)
+   {
+      for(j = 0; j < n; j++)
+      {
+         ret |= buffer[j] ^ ctRef[i + j];
+      }
+   }
+
+   //Copy the result to the ciphertext
+   if(ct != NULL)
+   {
+      osMemcpy(ct + i, buffer, n);
+   }
+
+   //Erase sensitive data
+   osMemset(y, 0, sizeof(y));
+   osMemset(&u, 0, sizeof(MlkemPoly));
+   osMemset(&a, 0, sizeof(MlkemPoly));
+   osMemset(&shakeContext, 0, sizeof(ShakeContext));
+
+   //Return 0 if the ciphertexts match
+   return ret;
+}
+
+
+/**
+ * @brief K-PKE decryption algorithm
+ * @param[in] params ML-KEM parameter set
+ * @param[out] m 32-byte message
+ * @param[in] dk Decryption key
+ * @param[in] ct Ciphertext
+ **/
+
+void mlkemPkeDecrypt(const MlkemParameters *params, uint8_t *m,
+   const uint8_t *dk, const uint8_t *ct)
+{
+   uint_t i;
+   uint_t k;
+   size_t n;
+   MlkemPoly w;
+   MlkemPoly u;
+   MlkemPoly s;
+
+   //Dimension of the module
+   k = params->k;
+   //Size of a compressed element of u
+   n = params->du * MLKEM_N / 8;
+
+   //Compute s^T * NTT(u), one element at a time
+   mlkemSetZero(&w);
+
+   for(i = 0; i < k; i++)
+   {
+      //Decode and decompress the current element of u
+      mlkemDecodePoly(&u, ct + i * n, params->du);
+      mlkemDecompress(&u, params->du);
+      mlkemNtt(&u);
+
+      //Decode the current element of s
+      mlkemDecodePoly(&s, dk + i * MLKEM_POLY_BYTES, 12);
+      mlkemBaseMulAcc(&w, &s, &u);
+   }
+
+   //Return to the normal domain
+   mlkemRed(&w);
+   mlkemInvNtt(&w);
+
+   //Decode and decompress v
+   mlkemDecodePoly(&u, ct + k * n, params->dv);
+   mlkemDecompress(&u, params->dv);
+
+   //Compute w = v - s^T * NTT^-1(NTT(u))
+   mlkemSub(&w, &u, &w);
+   mlkemRed(&w);
+
+   //Decode the message
+   mlkemCompress(&w, 1);
+   mlkemEncodePoly(m, &w, 1);
+
+   //Erase sensitive data
+   osMemset(&w, 0, sizeof(MlkemPoly));
+   osMemset(&s, 0, sizeof(MlkemPoly));
+}
+
+
+/**
+ * @brief Sample a polynomial in NTT domain from a uniform distribution
+ *
+ * The polynomial is generated by rejection sampling of the output of
+ * SHAKE128(rho || i || j) (algorithm SampleNTT)
+ *
+ * @param[out] r Resulting polynomial
+ * @param[in] shakeContext Pointer to a SHAKE context
+ * @param[in] rho 32-byte public seed
+ * @param[in] i First index
+ * @param[in] j Second index
+ **/
+
+void mlkemSampleNtt(MlkemPoly *r, ShakeContext *shakeContext,
+   const uint8_t *rho, uint8_t i, uint8_t j)
+{
+   uint_t n;
+   uint8_t buffer[MLKEM_SHAKE128_RATE];
+
+   //Absorb rho || i || j
+   shakeInit(shakeContext, 128);
+   shakeAbsorb(shakeContext, rho, MLKEM_SYM_BYTES);
+   shakeAbsorb(shakeContext, &i, sizeof(uint8_t));
+   shakeAbsorb(shakeContext, &j, sizeof(uint8_t));
+   shakeFinal(shakeContext);
+
+   //Squeeze one block at a time until all the coefficients are sampled
+   for(n = 0; n < MLKEM_N; )
+   {
+      shakeSqueeze(shakeContext, buffer, MLKEM_SHAKE128_RATE);
+      n = mlkemParseBlock(r, n, buffer);
+   }
+}
+
+
+/**
+ * @brief Sample a row (or a column) of the matrix A in lockstep
+ *
+ * The k SHAKE128 instances are processed together by the multi-lane Keccak
+ * primitives, so that SIMD implementations of the permutation can be used
+ *
+ * @param[out] r Resulting polynomials (k elements)
+ * @param[in] rho 32-byte public seed
+ * @param[in] k Dimension of the module
+ * @param[in] i Index of the row (or column)
+ * @param[in] transposed Sample the i-th column of A instead of the i-th row
+ **/
+
+void mlkemSampleNttRow(MlkemPoly *r, const uint8_t *rho, uint_t k,
+   uint8_t i, bool_t transposed)
+{
+   uint_t j;
+   uint_t n[MLKEM_MAX_K];
+   bool_t done;
+   uint8_t seed[MLKEM_MAX_K][MLKEM_SYM_BYTES + 2];
+   uint8_t buffer[MLKEM_MAX_K][MLKEM_SHAKE128_RATE];
+   KeccakContext keccakContext[MLKEM_MAX_K];
+   KeccakContext *context[MLKEM_MAX_K];
+   const void *input[MLKEM_MAX_K];
+   uint8_t *output[MLKEM_MAX_K];
+
+   //Initialize the SHAKE128 instances
+   for(j = 0; j < k; j++)
+   {
+      keccakInit(&keccakContext[j], 256);
+
+      //Element (i, j) of A is derived from SHAKE128(rho || j || i)
+      osMemcpy(seed[j], rho, MLKEM_SYM_BYTES);
+      seed[j][MLKEM_SYM_BYTES] = transposed ? i : (uint8_t) j;
+      seed[j][MLKEM_SYM_BYTES + 1] = transposed ? (uint8_t) j : i;
+
+      context[j] = &keccakContext[j];
+      input[j] = seed[j];
+      output[j] = buffer[j];
+      n[j] = 0;
+   }
+
+   //Absorb the seeds
+   keccakAbsorbMulti(context, input, MLKEM_SYM_BYTES + 2, k);
+   keccakFinalMulti(context, KECCAK_SHAKE_PAD, k);
+
+   //Squeeze one block at a time until all the polynomials are sampled
+   for(done = FALSE; !done; )
+   {
+      keccakSqueezeMulti(context, output, MLKEM_SHAKE128_RATE, k);
+
+      for(done = TRUE, j = 0; j < k; j++)
+      {
+         n[j] = mlkemParseBlock(&r[j], n[j], buffer[j]);
+
+         if(n[j] < MLKEM_N)
+         {
+            done = FALSE;
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Rejection sampling of a block of SHAKE128 output
+ *
+ * The rejection sampling only processes public data, so it does not need to
+ * run in constant time
+ *
+ * @param[in,out] r Polynomial being sampled
+ * @param[in] n Number of coefficients sampled so far
+ * @param[in] buffer Block of MLKEM_SHAKE128_RATE bytes
+ * @return Updated number of coefficients
+ **/
+
+uint_t mlkemParseBlock(MlkemPoly *r, uint_t n, const uint8_t *buffer)
+{
+   uint_t pos;
+   uint16_t d1;
+   uint16_t d2;
+
+   //Parse the block 3 bytes at a time
+   for(pos = 0; pos < MLKEM_SHAKE128_RATE && n < MLKEM_N; pos += 3)
+   {
+      //Each group of 3 bytes yields two 12-bit candidates
+      d1 = buffer[pos] | ((buffer[pos + 1] & 0x0F) << 8);
+      d2 = (buffer[pos + 1] >> 4) | (buffer[pos + 2] << 4);
+
+      //Accept the candidates that are smaller than q
+      if(d1 < MLKEM_Q)
+      {
+         r->a[n++] = (int16_t) d1;
+      }
+
+      if(d2 < MLKEM_Q && n < MLKEM_N)
+      {
+         r->a[n++] = (int16_t) d2;
+      }
+   }
+
+   //Return the number of coefficients sampled so far
+   return n;
+}
+
+
+/**
+ * @brief Sample a polynomial from the centered binomial distribution
+ *
+ * The coefficients are derived from PRF(sigma, nonce) = SHAKE256(sigma ||
+ * nonce) (algorithm SamplePolyCBD)
+ *
+ * @param[out] r Resulting polynomial
+ * @param[in] shakeContext Pointer to a SHAKE context
+ * @param[in] sigma 32-byte seed
+ * @param[in] nonce Nonce
+ * @param[in] eta Parameter of the distribution (2 or 3)
+ **/
+
+void mlkemSampleCbd(MlkemPoly *r, ShakeContext *shakeContext,
+   const uint8_t *sigma, uint8_t nonce, uint_t eta)
+{
+   uint_t i;
+   uint_t j;
+   uint32_t t;
+   uint32_t d;
+   uint8_t buffer[3 * MLKEM_N / 4];
+
+   //Compute PRF(sigma, nonce)
+   shakeInit(shakeContext, 256);
+   shakeAbsorb(shakeContext, sigma, MLKEM_SYM_BYTES);
+   shakeAbsorb(shakeContext, &nonce, sizeof(uint8_t));
+   shakeFinal(shakeContext);
+   shakeSqueeze(shakeContext, buffer, eta * MLKEM_N / 4);
+
+   //Check the parameter of the distribution
+   if(eta == 2)
+   {
+      //Process the input 4 bytes at a time
+      for(i = 0; i < (MLKEM_N / 8); i++)
+      {
+         //Add adjacent bits
+         t = LOAD32LE(buffer + 4 * i);
+         d = t & 0x55555555;
+         d += (t >> 1) & 0x55555555;
+
+         //Each coefficient is the difference of two sums of 2 bits
+         for(j = 0; j < 8; j++)
+         {
+            r->a[8 * i + j] = (int16_t) ((d >> (4 * j)) & 0x03) -
+               (int16_t) ((d >> (4 * j + 2)) & 0x03);
+         }
+      }
+   }
+   else
+   {
+      //Process the input 3 bytes at a time
+      for(i = 0; i < (MLKEM_N / 4); i++)
+      {
+         //Add adjacent bits
+         t = LOAD24LE(buffer + 3 * i);
+         d = t & 0x00249249;
+         d += (t >> 1) & 0x00249249;
+         d += (t >> 2) & 0x00249249;
+
+         //Each coefficient is the difference of two sums of 3 bits
+         for(j = 0; j < 4; j++)
+         {
+            r->a[4 * i + j] = (int16_t) ((d >> (6 * j)) & 0x07) -
+               (int16_t) ((d >> (6 * j + 3)) & 0x07);
+         }
+      }
+   }
+
+   //Erase the output of the PRF
+   osMemset(buffer, 0, sizeof(buffer));
+}
+
+
+/**
+ * @brief Number-theoretic transform
+ *
+ * The coefficients of the input polynomial are assumed to be smaller than q
+ * in absolute value. The output is in bit-reversed order
+ *
+ * @param[in,out] r Polynomial to be transformed
+ **/
+
+__weak_func void mlkemNtt(MlkemPoly *r)
+{
+   uint_t j;
+   uint_t k;
+   uint_t len;
+   uint_t start;
+   int16_t t;
+   int16_t zeta;
+
+   //Cooley-Tukey butterflies
+   for(k = 1, len = MLKEM_N / 2; len >= 2; len >>= 1)
+   {
+      for(start = 0; start < MLKEM_N; start += 2 * len)
+      {
+         zeta = MLKEM_ZETA[k++];
+
+         for(j = start; j < (start + len); j++)
+         {
+            t = mlkemMontRed((int32_t) zeta * r->a[j + len]);
+            r->a[j + len] = r->a[j] - t;
+            r->a[j] = r->a[j] + t;
+         }
+      }
+   }
+
+   //Reduce the coefficients
+   mlkemRed(r);
+}
+
+
+/**
+ * @brief Inverse number-theoretic transform
+ *
+ * The output is multiplied by the Montgomery factor 2^16, which cancels the
+ * factor 2^-16 introduced by mlkemBaseMulAcc()
+ *
+ * @param[in,out] r Polynomial to be transformed
+ **/
+
+__weak_func void mlkemInvNtt(MlkemPoly *r)
+{
+   uint_t j;
+   uint_t k;
+   uint_t len;
+   uint_t start;
+   int16_t t;
+   int16_t zeta;
+
+   //Gentleman-Sande butterflies
+   for(k = 127, len = 2; len <= (MLKEM_N / 2); len <<= 1)
+   {
+      for(start = 0; start < MLKEM_N; start += 2 * len)
+      {
+         zeta = MLKEM_ZETA[k--];
+
+         for(j = start; j < (start + len); j++)
+         {
+            t = r->a[j];
+            r->a[j] = mlkemBarrettRed(t + r->a[j + len]);
+            r->a[j + len] = r->a[j + len] - t;
+            r->a[j + len] = mlkemMontRed((int32_t) zeta * r->a[j + len]);
+         }
+      }
+   }
+
+   //Multiply by 2^32 / 128 to undo the scaling
+   for(j = 0; j < MLKEM_N; j++)
+   {
+      r->a[j] = mlkemMontRed((int32_t) MLKEM_INV_NTT_F * r->a[j]);
+   }
+}
+
+
+/**
+ * @brief Multiply two polynomials in NTT domain and accumulate the result
+ *
+ * The product is computed in Montgomery representation (i.e. it is multiplied
+ * by 2^-16). Up to 4 products can be accumulated before the coefficients of
+ * the result must be reduced
+ *
+ * @param[in,out] r Accumulator
+ * @param[in] a First operand
+ * @param[in] b Second operand
+ **/
+
+__weak_func void mlkemBaseMulAcc(MlkemPoly *r, const MlkemPoly *a,
+   const MlkemPoly *b)
+{
+   uint_t i;
+   int16_t zeta;
+   int16_t t;
+   const int16_t *p;
+   const int16_t *q;
+
+   //The NTT representation consists of 128 polynomials of degree 1
+   for(i = 0; i < (MLKEM_N / 2); i++)
+   {
+      //Successive pairs use opposite roots of unity
+      zeta = MLKEM_ZETA[64 + i / 2];
+      zeta = (i & 1) ? -zeta : zeta;
+
+      //Point to the current pair of coefficients
+      p = a->a + 2 * i;
+      q = b->a + 2 * i;
+
+      //Multiply (p0 + p1.X) by (q0 + q1.X) modulo (X^2 - zeta)
+      t = mlkemMontRed((int32_t) p[1] * q[1]);
+      t = mlkemMontRed((int32_t) t * zeta);
+      t += mlkemMontRed((int32_t) p[0] * q[0]);
+      r->a[2 * i] += t;
+
+      t = mlkemMontRed((int32_t) p[0] * q[1]);
+      t += mlkemMontRed((int32_t) p[1] * q[0]);
+      r->a[2 * i + 1] += t;
+   }
+}
+
+
+/**
+ * @brief Polynomial addition
+ * @param[out] r Resulting polynomial R = A + B
+ * @param[in] a First operand
+ * @param[in] b Second operand
+ **/
+
+void mlkemAdd(MlkemPoly *r, const MlkemPoly *a, const MlkemPoly *b)
+{
+   uint_t i;
+
+   //Add the coefficients
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      r->a[i] = a->a[i] + b->a[i];
+   }
+}
+
+
+/**
+ * @brief Polynomial subtraction
+ * @param[out] r Resulting polynomial R = A - B
+ * @param[in] a First operand
+ * @param[in] b Second operand
+ **/
+
+void mlkemSub(MlkemPoly *r, const MlkemPoly *a, const MlkemPoly *b)
+{
+   uint_t i;
+
+   //Subtract the coefficients
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      r->a[i] = a->a[i] - b->a[i];
+   }
+}
+
+
+/**
+ * @brief Barrett reduction of the coefficients of a polynomial
+ * @param[in,out] r Polynomial
+ **/
+
+void mlkemRed(MlkemPoly *r)
+{
+   uint_t i;
+
+   //Reduce the coefficients
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      r->a[i] = mlkemBarrettRed(r->a[i]);
+   }
+}
+
+
+/**
+ * @brief Convert the coefficients of a polynomial to Montgomery representation
+ * @param[in,out] r Polynomial
+ **/
+
+void mlkemToMont(MlkemPoly *r)
+{
+   uint_t i;
+
+   //Multiply the coefficients by 2^16
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      r->a[i] = mlkemMontRed((int32_t) MLKEM_MONT2 * r->a[i]);
+   }
+}
+
+
+/**
+ * @brief Set all the coefficients of a polynomial to zero
+ * @param[out] r Polynomial
+ **/
+
+void mlkemSetZero(MlkemPoly *r)
+{
+   osMemset(r, 0, sizeof(MlkemPoly));
+}
+
+
+/**
+ * @brief Compress the coefficients of a polynomial
+ *
+ * Each coefficient x is replaced with round(2^d / q * x) mod 2^d. The division
+ * by q is performed with a multiplication, so that the execution time does
+ * not depend on the value of the coefficients
+ *
+ * @param[in,out] r Polynomial
+ * @param[in] d Number of bits per coefficient
+ **/
+
+void mlkemCompress(MlkemPoly *r, uint_t d)
+{
+   uint_t i;
+   uint64_t t;
+
+   //Process the coefficients
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      //Map the coefficient to the range 0 to q - 1
+      t = (uint16_t) (r->a[i] + ((r->a[i] >> 15) & MLKEM_Q));
+
+      //Compute floor((2^d * x + (q - 1) / 2) / q), using 2^35 / q
+      t = (t << d) + (MLKEM_Q - 1) / 2;
+      t = (t * 10321340) >> 35;
+
+      //Keep the d least significant bits
+      r->a[i] = (int16_t) (t & ((1U << d) - 1));
+   }
+}
+
+
+/**
+ * @brief Decompress the coefficients of a polynomial
+ *
+ * Each coefficient y is replaced with round(q / 2^d * y)
+ *
+ * @param[in,out] r Polynomial
+ * @param[in] d Number of bits per coefficient
+ **/
+
+void mlkemDecompress(MlkemPoly *r, uint_t d)
+{
+   uint_t i;
+   uint32_t t;
+
+   //Process the coefficients
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      t = (uint32_t) r->a[i] * MLKEM_Q + (1U << (d - 1));
+      r->a[i] = (int16_t) (t >> d);
+   }
+}
+
+
+/**
+ * @brief Encode a polynomial (algorithm ByteEncode)
+ *
+ * The coefficients must lie in the range 0 to 2^d - 1, except when d = 12,
+ * where they are first mapped to the range 0 to q - 1
+ *
+ * @param[out] p Output byte array (32 * d bytes)
+ * @param[in] a Polynomial to be encoded
+ * @param[in] d Number of bits per coefficient
+ **/
+
+void mlkemEncodePoly(uint8_t *p, const MlkemPoly *a, uint_t d)
+{
+   uint_t i;
+   uint_t n;
+   uint32_t t;
+   uint32_t acc;
+
+   //Initialize bit accumulator
+   acc = 0;
+   n = 0;
+
+   //Process the coefficients
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      //Map negative coefficients to the range 0 to q - 1
+      t = (uint16_t) (a->a[i] + ((a->a[i] >> 15) & MLKEM_Q));
+
+      //Append the d bits of the coefficient
+      acc |= t << n;
+      n += d;
+
+      //Flush complete bytes
+      while(n >= 8)
+      {
+         *(p++) = (uint8_t) acc;
+         acc >>= 8;
+         n -= 8;
+      }
+   }
+}
+
+
+/**
+ * @brief Decode a polynomial (algorithm ByteDecode)
+ * @param[out] r Resulting polynomial
+ * @param[in] p Input byte array (32 * d bytes)
+ * @param[in] d Number of bits per coefficient
+ **/
+
+void mlkemDecodePoly(MlkemPoly *r, const uint8_t *p, uint_t d)
+{
+   uint_t i;
+   uint_t n;
+   uint32_t acc;
+
+   //Initialize bit accumulator
+   acc = 0;
+   n = 0;
+
+   //Process the coefficients
+   for(i = 0; i < MLKEM_N; i++)
+   {
+      //Load as many bytes as necessary
+      while(n < d)
+      {
+         acc |= (uint32_t) *(p++) << n;
+         n += 8;
+      }
+
+      //Extract the d bits of the coefficient
+      r->a[i] = (int16_t) (acc & ((1U << d) - 1));
+      acc >>= d;
+      n -= d;
+   }
+}
+
+
+/**
+ * @brief Montgomery reduction
+ * @param[in] a Input value, in the range -q * 2^15 to q * 2^15
+ * @return a * 2^-16 mod q, in the range -q + 1 to q - 1
+ **/
+
+int16_t mlkemMontRed(int32_t a)
+{
+   int16_t t;
+
+   //Compute t = a * q^-1 mod 2^16
+   t = (int16_t) ((int16_t) a * MLKEM_QINV);
+   //Compute (a - t * q) / 2^16
+   t = (int16_t) ((a - (int32_t) t * MLKEM_Q) >> 16);
+
+   //Return the result
+   return t;
+}
+
+
+/**
+ * @brief Barrett reduction
+ * @param[in] a Input value
+ * @return Centered representative of a mod q
+ **/
+
+int16_t mlkemBarrettRed(int16_t a)
+{
+   int16_t t;
+
+   //Compute round(a / q) using round(2^26 / q) = 20159
+   t = (int16_t) (((int32_t) 20159 * a + (1 << 25)) >> 26);
+   //Compute a - round(a / q) * q
+   t = a - t * MLKEM_Q;
+
+   //Return the result
+   return t;
+}
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file mlkem.h
+ * @brief ML-KEM key encapsulation mechanism (FIPS 203)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _MLKEM_H
+#define _MLKEM_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "xof/shake.h"
+
+//Degree of the polynomials
+#define MLKEM_N 256
+//Modulus
+#define MLKEM_Q 3329
+//Maximum dimension of the module
+#define MLKEM_MAX_K 4
+
+//Size of the seeds, messages and shared secrets
+#define MLKEM_SYM_BYTES 32
+//Size of an encoded polynomial (12 bits per coefficient)
+#define MLKEM_POLY_BYTES 384
+//Rate of SHAKE128, in bytes
+#define MLKEM_SHAKE128_RATE 168
+
+//Expand the matrix A using the multi-lane Keccak primitives
+#ifndef MLKEM_PARALLEL_SAMPLING_SUPPORT
+   #define MLKEM_PARALLEL_SAMPLING_SUPPORT DISABLED
+#elif (MLKEM_PARALLEL_SAMPLING_SUPPORT != ENABLED && MLKEM_PARALLEL_SAMPLING_SUPPORT != DISABLED)
+   #error MLKEM_PARALLEL_SAMPLING_SUPPORT parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief ML-KEM parameter set
+ **/
+
+typedef struct
+{
+   uint_t k;    ///<Dimension of the module
+   uint_t eta1; ///<Parameter of the noise distribution for s, e and y
+   uint_t eta2; ///<Parameter of the noise distribution for e1 and e2
+   uint_t du;   ///<Number of bits per coefficient of u
+   uint_t dv;   ///<Number of bits per coefficient of v
+} MlkemParameters;
+
+
+/**
+ * @brief Polynomial of the ring Zq[X]/(X^256 + 1)
+ **/
+
+typedef struct
+{
+   int16_t a[MLKEM_N];
+} MlkemPoly;
+
+
+//ML-KEM related functions
+error_t mlkemGenerateKeyPair(const MlkemParameters *params,
+   const PrngAlgo *prngAlgo, void *prngContext, uint8_t *pk, uint8_t *sk);
+
+error_t mlkemGenerateKeyPairInternal(const MlkemParameters *params,
+   const uint8_t *d, const uint8_t *z, uint8_t *pk, uint8_t *sk);
+
+error_t mlkemEncapsulate(const MlkemParameters *params,
+   const PrngAlgo *prngAlgo, void *prngContext, uint8_t *ct, uint8_t *ss,
+   const uint8_t *pk);
+
+error_t mlkemEncapsulateInternal(const MlkemParameters *params,
+   const uint8_t *m, uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+
+error_t mlkemDecapsulate(const MlkemParameters *params, uint8_t *ss,
+   const uint8_t *ct, const uint8_t *sk);
+
+uint32_t mlkemPkeEncrypt(const MlkemParameters *params, uint8_t *ct,
+   const uint8_t *ctRef, const uint8_t *ek, const uint8_t *m,
+   const uint8_t *r);
+
+void mlkemPkeDecrypt(const MlkemParameters *params, uint8_t *m,
+   const uint8_t *dk, const uint8_t *ct);
+
+void mlkemSampleNtt(MlkemPoly *r, ShakeContext *shakeContext,
+   const uint8_t *rho, uint8_t i, uint8_t j);
+
+void mlkemSampleNttRow(MlkemPoly *r, const uint8_t *rho, uint_t k,
+   uint8_t i, bool_t transposed);
+
+uint_t mlkemParseBlock(MlkemPoly *r, uint_t n, const uint8_t *buffer);
+
+void mlkemSampleCbd(MlkemPoly *r, ShakeContext *shakeContext,
+   const uint8_t *sigma, uint8_t nonce, uint_t eta);
+
+void mlkemNtt(MlkemPoly *r);
+void mlkemInvNtt(MlkemPoly *r);
+
+void mlkemBaseMulAcc(MlkemPoly *r, const MlkemPoly *a, const MlkemPoly *b);
+
+void mlkemAdd(MlkemPoly *r, const MlkemPoly *a, const MlkemPoly *b);
+void mlkemSub(MlkemPoly *r, const MlkemPoly *a, const MlkemPoly *b);
+void mlkemRed(MlkemPoly *r);
+void mlkemToMont(MlkemPoly *r);
+void mlkemSetZero(MlkemPoly *r);
+
+void mlkemCompress(MlkemPoly *r, uint_t d);
+void mlkemDecompress(MlkemPoly *r, uint_t d);
+
+void mlkemEncodePoly(uint8_t *p, const MlkemPoly *a, uint_t d);
+void mlkemDecodePoly(MlkemPoly *r, const uint8_t *p, uint_t d);
+
+int16_t mlkemMontRed(int32_t a);
+int16_t mlkemBarrettRed(int16_t a);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -31,12 +31,20 @@
 //Dependencies
 #include "core/crypto.h"
 #include "pqc/mlkem1024.h"
+#include "pqc/mlkem.h"
 
 //Check crypto library configuration
 #if (MLKEM1024_SUPPORT == ENABLED)
 
-//Dependencies (liboqs)
-#include <oqs/oqs.h>
+//ML-KEM-1024 parameter set
+static const MlkemParameters mlkem1024Params =
+{
+   4,  //k
+   2,  //eta1
+   2,  //eta2
+   11, //du
+   5   //dv
+};
 
 //Common interface for key encapsulation mechanisms (KEM)
 const KemAlgo mlkem1024KemAlgo =
@@ -64,13 +72,8 @@ const KemAlgo mlkem1024KemAlgo =
 error_t mlkem1024GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
    uint8_t *pk, uint8_t *sk)
 {
-   OQS_STATUS status;
-
    //Key pair generation
-   status = OQS_KEM_kyber_1024_keypair(pk, sk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemGenerateKeyPair(&mlkem1024Params, prngAlgo, prngContext, pk, sk);
 }
 
 
@@ -87,13 +90,9 @@ error_t mlkem1024GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
 error_t mlkem1024Encapsulate(const PrngAlgo *prngAlgo, void *prngContext,
    uint8_t *ct, uint8_t *ss, const uint8_t *pk)
 {
-   OQS_STATUS status;
-
    //Encapsulation algorithm
-   status = OQS_KEM_kyber_1024_encaps(ct, ss, pk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemEncapsulate(&mlkem1024Params, prngAlgo, prngContext, ct, ss,
+      pk);
 }
 
 
@@ -107,13 +106,8 @@ error_t mlkem1024Encapsulate(const PrngAlgo *prngAlgo, void *prngContext,
 
 error_t mlkem1024Decapsulate(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
 {
-   OQS_STATUS status;
-
    //Decapsulation algorithm
-   status = OQS_KEM_kyber_1024_decaps(ss, ct, sk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemDecapsulate(&mlkem1024Params, ss, ct, sk);
 }
 
 #endif
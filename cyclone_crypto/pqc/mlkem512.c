@@ -31,12 +31,20 @@
 //Dependencies
 #include "core/crypto.h"
 #include "pqc/mlkem512.h"
+#include "pqc/mlkem.h"
 
 //Check crypto library configuration
 #if (MLKEM512_SUPPORT == ENABLED)
 
-//Dependencies (liboqs)
-#include <oqs/oqs.h>
+//ML-KEM-512 parameter set
+static const MlkemParameters mlkem512Params =
+{
+   2,  //k
+   3,  //eta1
+   2,  //eta2
+   10, //du
+   4   //dv
+};
 
 //Common interface for key encapsulation mechanisms (KEM)
 const KemAlgo mlkem512KemAlgo =
@@ -64,13 +72,8 @@ const KemAlgo mlkem512KemAlgo =
 error_t mlkem512GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
    uint8_t *pk, uint8_t *sk)
 {
-   OQS_STATUS status;
-
    //Key pair generation
-   status = OQS_KEM_kyber_512_keypair(pk, sk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemGenerateKeyPair(&mlkem512Params, prngAlgo, prngContext, pk, sk);
 }
 
 
@@ -87,13 +90,9 @@ error_t mlkem512GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
 error_t mlkem512Encapsulate(const PrngAlgo *prngAlgo, void *prngContext,
    uint8_t *ct, uint8_t *ss, const uint8_t *pk)
 {
-   OQS_STATUS status;
-
    //Encapsulation algorithm
-   status = OQS_KEM_kyber_512_encaps(ct, ss, pk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemEncapsulate(&mlkem512Params, prngAlgo, prngContext, ct, ss,
+      pk);
 }
 
 
@@ -107,13 +106,8 @@ error_t mlkem512Encapsulate(const PrngAlgo *prngAlgo, void *prngContext,
 
 error_t mlkem512Decapsulate(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
 {
-   OQS_STATUS status;
-
    //Decapsulation algorithm
-   status = OQS_KEM_kyber_512_decaps(ss, ct, sk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemDecapsulate(&mlkem512Params, ss, ct, sk);
 }
 
 #endif
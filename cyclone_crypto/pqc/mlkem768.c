@@ -31,12 +31,20 @@
 //Dependencies
 #include "core/crypto.h"
 #include "pqc/mlkem768.h"
+#include "pqc/mlkem.h"
 
 //Check crypto library configuration
 #if (MLKEM768_SUPPORT == ENABLED)
 
-//Dependencies (liboqs)
-#include <oqs/oqs.h>
+//ML-KEM-768 parameter set
+static const MlkemParameters mlkem768Params =
+{
+   3,  //k
+   2,  //eta1
+   2,  //eta2
+   10, //du
+   4   //dv
+};
 
 //Common interface for key encapsulation mechanisms (KEM)
 const KemAlgo mlkem768KemAlgo =
@@ -64,13 +72,8 @@ const KemAlgo mlkem768KemAlgo =
 error_t mlkem768GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
    uint8_t *pk, uint8_t *sk)
 {
-   OQS_STATUS status;
-
    //Key pair generation
-   status = OQS_KEM_kyber_768_keypair(pk, sk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemGenerateKeyPair(&mlkem768Params, prngAlgo, prngContext, pk, sk);
 }
 
 
@@ -87,13 +90,9 @@ error_t mlkem768GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
 error_t mlkem768Encapsulate(const PrngAlgo *prngAlgo, void *prngContext,
    uint8_t *ct, uint8_t *ss, const uint8_t *pk)
 {
-   OQS_STATUS status;
-
    //Encapsulation algorithm
-   status = OQS_KEM_kyber_768_encaps(ct, ss, pk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemEncapsulate(&mlkem768Params, prngAlgo, prngContext, ct, ss,
+      pk);
 }
 
 
@@ -107,13 +106,8 @@ error_t mlkem768Encapsulate(const PrngAlgo *prngAlgo, void *prngContext,
 
 error_t mlkem768Decapsulate(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
 {
-   OQS_STATUS status;
-
    //Decapsulation algorithm
-   status = OQS_KEM_kyber_768_decaps(ss, ct, sk);
-
-   //Return status code
-   return (status == OQS_SUCCESS) ? NO_ERROR : ERROR_FAILURE;
+   return mlkemDecapsulate(&mlkem768Params, ss, ct, sk);
 }
 
 #endif
@@ -0,0 +1,683 @@
+/**
+ * @file ctr_drbg.c
+ * @brief CTR_DRBG pseudorandom number generator (NIST SP 800-90A)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * CTR_DRBG is a deterministic random bit generator based on a block cipher
+ * in counter mode. This implementation uses AES-256 and the block cipher
+ * derivation function. Refer to NIST SP 800-90A for more details
+ *
+ * A shared instance serializes its callers with a mutex. Tasks that draw a
+ * lot of random data can instead own a child instance, created with
+ * ctrDrbgInitChild(). A child instance is seeded from its parent and is
+ * accessed without any locking. It periodically reseeds from its parent, so
+ * that entropy added to the parent is propagated
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "rng/ctr_drbg.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (CTR_DRBG_SUPPORT == ENABLED)
+
+//Common interface for PRNG algorithms
+const PrngAlgo ctrDrbgPrngAlgo =
+{
+   "CTR_DRBG",
+   sizeof(CtrDrbgContext),
+   (PrngAlgoInit) ctrDrbgInit,
+   (PrngAlgoSeed) ctrDrbgSeed,
+   (PrngAlgoAddEntropy) ctrDrbgAddEntropy,
+   (PrngAlgoRead) ctrDrbgRead,
+   (PrngAlgoDeinit) ctrDrbgDeinit
+};
+
+
+/**
+ * @brief Initialize PRNG context
+ * @param[in] context Pointer to the PRNG context to initialize
+ * @return Error code
+ **/
+
+error_t ctrDrbgInit(CtrDrbgContext *context)
+{
+   //Check parameters
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear PRNG state
+   osMemset(context, 0, sizeof(CtrDrbgContext));
+
+   //Create a mutex to prevent simultaneous access to the PRNG state
+   if(!osCreateMutex(&context->mutex))
+   {
+      //Failed to create mutex
+      return ERROR_OUT_OF_RESOURCES;
+   }
+
+   //The instance may be accessed by several tasks
+   context->shared = TRUE;
+   //The PRNG is not ready to generate random data
+   context->ready = FALSE;
+
+   //Successful initialization
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Initialize a child instance seeded from a parent instance
+ *
+ * The child instance must only be accessed by a single task. It does not
+ * take any lock, except when it reseeds from its parent
+ *
+ * @param[in] context Pointer to the PRNG context to initialize
+ * @param[in] parent Pointer to the parent PRNG context
+ * @return Error code
+ **/
+
+error_t ctrDrbgInitChild(CtrDrbgContext *context, CtrDrbgContext *parent)
+{
+   error_t error;
+   uint8_t seed[CTR_DRBG_SEED_LEN];
+
+   //Check parameters
+   if(context == NULL || parent == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear PRNG state
+   osMemset(context, 0, sizeof(CtrDrbgContext));
+
+   //The child instance is owned by a single task
+   context->shared = FALSE;
+   context->parent = parent;
+
+   //Draw the seed material from the parent instance
+   error = ctrDrbgRead(parent, seed, sizeof(seed));
+
+   //Check status code
+   if(!error)
+   {
+      //Instantiate the child instance
+      error = ctrDrbgSeed(context, seed, sizeof(seed));
+   }
+
+   //Erase seed material
+   osMemset(seed, 0, sizeof(seed));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Seed the PRNG state
+ * @param[in] context Pointer to the PRNG context
+ * @param[in] input Seed material (entropy input and nonce)
+ * @param[in] length Length of the seed material
+ * @return Error code
+ **/
+
+error_t ctrDrbgSeed(CtrDrbgContext *context, const uint8_t *input,
+   size_t length)
+{
+   error_t error;
+   uint8_t seed[CTR_DRBG_SEED_LEN];
+
+   //Check parameters
+   if(context == NULL || input == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The seed material must provide at least 256 bits of entropy
+   if(length < CTR_DRBG_MIN_SEED_LEN)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the PRNG state
+   if(context->shared)
+   {
+      osAcquireMutex(&context->mutex);
+   }
+
+   //Release the previous key, if any
+   if(context->ready)
+   {
+      aesDeinit(&context->cipherContext);
+   }
+
+   //Set Key and V to zero
+   osMemset(context->k, 0, CTR_DRBG_KEY_LEN);
+   osMemset(context->v, 0, AES_BLOCK_SIZE);
+
+   //Set the initial key
+   error = aesInit(&context->cipherContext, context->k, CTR_DRBG_KEY_LEN);
+
+   //Check status code
+   if(!error)
+   {
+      //Compute seed_material = Block_Cipher_df(seed_material, seedlen)
+      ctrDrbgDerive(context, input, length, seed);
+      //Compute (Key, V) = CTR_DRBG_Update(seed_material, Key, V)
+      error = ctrDrbgUpdate(context, seed);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Reset the reseed counter
+      context->reseedCounter = 1;
+
+      //Discard the keystream buffer
+      osMemset(context->buffer, 0, CTR_DRBG_BUFFER_SIZE);
+      context->bufferLen = 0;
+
+      //The PRNG is ready to generate random data
+      context->ready = TRUE;
+   }
+
+   //Release exclusive access to the PRNG state
+   if(context->shared)
+   {
+      osReleaseMutex(&context->mutex);
+   }
+
+   //Erase seed material
+   osMemset(seed, 0, sizeof(seed));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Add entropy to the PRNG state
+ *
+ * The input is mixed into the state immediately (reseed function). The
+ * source identifier and the entropy estimate are not used
+ *
+ * @param[in] context Pointer to the PRNG context
+ * @param[in] source Entropy source identifier
+ * @param[in] input Pointer to the input data
+ * @param[in] length Length of the input data
+ * @param[in] entropy Actual number of bits of entropy
+ * @return Error code
+ **/
+
+error_t ctrDrbgAddEntropy(CtrDrbgContext *context, uint_t source,
+   const uint8_t *input, size_t length, size_t entropy)
+{
+   error_t error;
+
+   //Check parameters
+   if(context == NULL || input == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure that the PRNG has been properly seeded
+   if(!context->ready)
+      return ERROR_PRNG_NOT_READY;
+
+   //Acquire exclusive access to the PRNG state
+   if(context->shared)
+   {
+      osAcquireMutex(&context->mutex);
+   }
+
+   //Reseed the PRNG
+   error = ctrDrbgReseed(context, input, length);
+
+   //Release exclusive access to the PRNG state
+   if(context->shared)
+   {
+      osReleaseMutex(&context->mutex);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Read random data
+ *
+ * Small requests are served from a keystream buffer that is refilled
+ * CTR_DRBG_BUFFER_SIZE bytes at a time, so that the cost of the key update
+ * is shared among several requests. The consumed bytes are erased from the
+ * buffer. Large requests bypass the buffer
+ *
+ * @param[in] context Pointer to the PRNG context
+ * @param[out] output Buffer where to store the output data
+ * @param[in] length Desired length in bytes
+ * @return Error code
+ **/
+
+error_t ctrDrbgRead(CtrDrbgContext *context, uint8_t *output, size_t length)
+{
+   error_t error;
+   size_t n;
+   uint8_t *p;
+
+   //Check parameters
+   if(context == NULL || (output == NULL && length != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure that the PRNG has been properly seeded
+   if(!context->ready)
+      return ERROR_PRNG_NOT_READY;
+
+   //Child instances are owned by a single task and do not need any lock
+   if(context->shared)
+   {
+      osAcquireMutex(&context->mutex);
+   }
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Generate random data
+   while(length > 0 && !error)
+   {
+      //Any unused keystream?
+      if(context->bufferLen > 0)
+      {
+         //Number of bytes to copy at a time
+         n = MIN(length, context->bufferLen);
+
+         //Point to the unused keystream
+         p = context->buffer + CTR_DRBG_BUFFER_SIZE - context->bufferLen;
+
+         //Copy data to the output buffer and erase the consumed keystream
+         osMemcpy(output, p, n);
+         osMemset(p, 0, n);
+
+         //Number of unused bytes in the keystream buffer
+         context->bufferLen -= n;
+      }
+      else if(length >= CTR_DRBG_BUFFER_SIZE)
+      {
+         //Large requests are written directly to the output buffer
+         n = MIN(length, CTR_DRBG_MAX_REQUEST_SIZE);
+         error = ctrDrbgGenerate(context, output, n);
+      }
+      else
+      {
+         //Refill the keystream buffer
+         error = ctrDrbgGenerate(context, context->buffer,
+            CTR_DRBG_BUFFER_SIZE);
+
+         //Check status code
+         if(!error)
+         {
+            context->bufferLen = CTR_DRBG_BUFFER_SIZE;
+         }
+
+         //No data has been copied yet
+         n = 0;
+      }
+
+      //Next block
+      output += n;
+      length -= n;
+   }
+
+   //Release exclusive access to the PRNG state
+   if(context->shared)
+   {
+      osReleaseMutex(&context->mutex);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Generate function
+ * @param[in] context Pointer to the PRNG context
+ * @param[out] output Buffer where to store the output data
+ * @param[in] length Desired length in bytes (at most CTR_DRBG_MAX_REQUEST_SIZE)
+ * @return Error code
+ **/
+
+error_t ctrDrbgGenerate(CtrDrbgContext *context, uint8_t *output,
+   size_t length)
+{
+   error_t error;
+   size_t i;
+   size_t n;
+   uint8_t block[AES_BLOCK_SIZE];
+   uint8_t seed[CTR_DRBG_SEED_LEN];
+
+   //Child instances periodically reseed from their parent
+   if(context->parent != NULL &&
+      context->reseedCounter > CTR_DRBG_CHILD_RESEED_INTERVAL)
+   {
+      //Draw fresh seed material from the parent instance
+      error = ctrDrbgRead(context->parent, seed, sizeof(seed));
+
+      //Check status code
+      if(!error)
+      {
+         error = ctrDrbgReseed(context, seed, sizeof(seed));
+      }
+
+      //Erase seed material
+      osMemset(seed, 0, sizeof(seed));
+
+      //Any error to report?
+      if(error)
+         return error;
+   }
+
+   //A reseed is required when the reseed interval has been reached
+   if(context->reseedCounter > CTR_DRBG_RESEED_INTERVAL)
+      return ERROR_PRNG_NOT_READY;
+
+   //Number of complete blocks
+   n = length / AES_BLOCK_SIZE;
+
+   //The counter blocks are written to the output buffer and encrypted in
+   //place, using the multi-block interface of the cipher
+   for(i = 0; i < n; i++)
+   {
+      ctrDrbgIncCounter(context->v);
+      osMemcpy(output + i * AES_BLOCK_SIZE, context->v, AES_BLOCK_SIZE);
+   }
+
+   //Encrypt the counter blocks
+   aesEncryptBlocks(&context->cipherContext, output, output, n);
+
+   //Process the last block, if any
+   if((length % AES_BLOCK_SIZE) != 0)
+   {
+      ctrDrbgIncCounter(context->v);
+      aesEncryptBlock(&context->cipherContext, context->v, block);
+      osMemcpy(output + n * AES_BLOCK_SIZE, block, length % AES_BLOCK_SIZE);
+      osMemset(block, 0, AES_BLOCK_SIZE);
+   }
+
+   //Update the internal state for backtracking resistance
+   error = ctrDrbgUpdate(context, NULL);
+
+   //Increment the reseed counter
+   context->reseedCounter++;
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Reseed function
+ * @param[in] context Pointer to the PRNG context
+ * @param[in] input Entropy input
+ * @param[in] length Length of the entropy input
+ * @return Error code
+ **/
+
+error_t ctrDrbgReseed(CtrDrbgContext *context, const uint8_t *input,
+   size_t length)
+{
+   error_t error;
+   uint8_t seed[CTR_DRBG_SEED_LEN];
+
+   //Compute seed_material = Block_Cipher_df(seed_material, seedlen)
+   ctrDrbgDerive(context, input, length, seed);
+   //Compute (Key, V) = CTR_DRBG_Update(seed_material, Key, V)
+   error = ctrDrbgUpdate(context, seed);
+
+   //Reset the reseed counter
+   context->reseedCounter = 1;
+
+   //The buffered keystream must not be used after a reseed
+   osMemset(context->buffer, 0, CTR_DRBG_BUFFER_SIZE);
+   context->bufferLen = 0;
+
+   //Erase seed material
+   osMemset(seed, 0, sizeof(seed));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Update function (CTR_DRBG_Update)
+ * @param[in] context Pointer to the PRNG context
+ * @param[in] data Provided data (CTR_DRBG_SEED_LEN bytes), or NULL when
+ *   the provided data is a string of zeros
+ * @return Error code
+ **/
+
+error_t ctrDrbgUpdate(CtrDrbgContext *context, const uint8_t *data)
+{
+   error_t error;
+   uint_t i;
+   uint8_t temp[CTR_DRBG_SEED_LEN];
+
+   //Generate seedlen bits of keystream
+   for(i = 0; i < CTR_DRBG_SEED_LEN; i += AES_BLOCK_SIZE)
+   {
+      ctrDrbgIncCounter(context->v);
+      osMemcpy(temp + i, context->v, AES_BLOCK_SIZE);
+   }
+
+   //Encrypt the counter blocks
+   aesEncryptBlocks(&context->cipherContext, temp, temp,
+      CTR_DRBG_SEED_LEN / AES_BLOCK_SIZE);
+
+   //XOR the keystream with the provided data
+   if(data != NULL)
+   {
+      for(i = 0; i < CTR_DRBG_SEED_LEN; i++)
+      {
+         temp[i] ^= data[i];
+      }
+   }
+
+   //The leftmost bits are used as the new key, the rightmost bits as the
+   //new value of V
+   osMemcpy(context->k, temp, CTR_DRBG_KEY_LEN);
+   osMemcpy(context->v, temp + CTR_DRBG_KEY_LEN, AES_BLOCK_SIZE);
+
+   //Set the new key
+   aesDeinit(&context->cipherContext);
+   error = aesInit(&context->cipherContext, context->k, CTR_DRBG_KEY_LEN);
+
+   //Erase temporary buffer
+   osMemset(temp, 0, sizeof(temp));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Block cipher derivation function (Block_Cipher_df)
+ *
+ * The cipher context is used as a scratch and is keyed again with the
+ * current key before returning
+ *
+ * @param[in] context Pointer to the PRNG context
+ * @param[in] input Input string
+ * @param[in] length Length of the input string
+ * @param[out] output Resulting string (CTR_DRBG_SEED_LEN bytes)
+ **/
+
+void ctrDrbgDerive(CtrDrbgContext *context, const uint8_t *input,
+   size_t length, uint8_t *output)
+{
+   uint_t i;
+   size_t n;
+   uint8_t pad;
+   uint8_t header[8];
+   uint8_t x[AES_BLOCK_SIZE];
+   uint8_t temp[CTR_DRBG_SEED_LEN];
+
+   //The first pass of the derivation function uses a fixed key
+   for(i = 0; i < CTR_DRBG_KEY_LEN; i++)
+   {
+      temp[i] = (uint8_t) i;
+   }
+
+   //Set the fixed key
+   aesDeinit(&context->cipherContext);
+   aesInit(&context->cipherContext, temp, CTR_DRBG_KEY_LEN);
+
+   //Format L || N, where L is the length of the input string and N the
+   //number of bytes to return
+   STORE32BE(length, header);
+   STORE32BE(CTR_DRBG_SEED_LEN, header + 4);
+
+   //Padding byte
+   pad = 0x80;
+
+   //Compute temp = BCC(K, IV || S) for successive values of the IV
+   for(i = 0; i < CTR_DRBG_SEED_LEN / AES_BLOCK_SIZE; i++)
+   {
+      //The IV is the 32-bit counter i padded with zeros
+      osMemset(x, 0, AES_BLOCK_SIZE);
+      STORE32BE(i, x);
+      aesEncryptBlock(&context->cipherContext, x, x);
+
+      //Process S = L || N || input || 0x80, padded with zeros
+      n = 0;
+      ctrDrbgBcc(&context->cipherContext, x, &n, header, sizeof(header));
+      ctrDrbgBcc(&context->cipherContext, x, &n, input, length);
+      ctrDrbgBcc(&context->cipherContext, x, &n, &pad, sizeof(uint8_t));
+
+      //Process the last (zero-padded) block, if any
+      if(n > 0)
+      {
+         aesEncryptBlock(&context->cipherContext, x, x);
+      }
+
+      //Save the chaining value
+      osMemcpy(temp + i * AES_BLOCK_SIZE, x, AES_BLOCK_SIZE);
+   }
+
+   //The leftmost bits of temp are used as key for the second pass
+   aesDeinit(&context->cipherContext);
+   aesInit(&context->cipherContext, temp, CTR_DRBG_KEY_LEN);
+
+   //The rightmost bits of temp are used as initial value of X
+   osMemcpy(x, temp + CTR_DRBG_KEY_LEN, AES_BLOCK_SIZE);
+
+   //Generate the requested number of bytes
+   for(i = 0; i < CTR_DRBG_SEED_LEN; i += AES_BLOCK_SIZE)
+   {
+      aesEncryptBlock(&context->cipherContext, x, x);
+      osMemcpy(output + i, x, AES_BLOCK_SIZE);
+   }
+
+   //Restore the current key
+   aesDeinit(&context->cipherContext);
+   aesInit(&context->cipherContext, context->k, CTR_DRBG_KEY_LEN);
+
+   //Erase temporary buffers
+   osMemset(x, 0, sizeof(x));
+   osMemset(temp, 0, sizeof(temp));
+}
+
+
+/**
+ * @brief Absorb data into a BCC chaining value
+ * @param[in] aesContext Pointer to the AES context
+ * @param[in,out] x Chaining value
+ * @param[in,out] n Number of bytes of the current block processed so far
+ * @param[in] data Pointer to the data
+ * @param[in] length Length of the data
+ **/
+
+void ctrDrbgBcc(AesContext *aesContext, uint8_t *x, size_t *n,
+   const uint8_t *data, size_t length)
+{
+   size_t i;
+
+   //Process the incoming data
+   for(i = 0; i < length; i++)
+   {
+      //XOR the current byte with the chaining value
+      x[(*n)++] ^= data[i];
+
+      //Encrypt the chaining value when a block is complete
+      if(*n == AES_BLOCK_SIZE)
+      {
+         aesEncryptBlock(aesContext, x, x);
+         *n = 0;
+      }
+   }
+}
+
+
+/**
+ * @brief Increment counter block
+ * @param[in,out] v Counter block
+ **/
+
+void ctrDrbgIncCounter(uint8_t *v)
+{
+   int_t i;
+
+   //Increment counter value
+   for(i = AES_BLOCK_SIZE - 1; i >= 0; i--)
+   {
+      //Increment the current byte and propagate the carry if necessary
+      if(++(v[i]) != 0)
+      {
+         break;
+      }
+   }
+}
+
+
+/**
+ * @brief Release PRNG context
+ * @param[in] context Pointer to the PRNG context
+ **/
+
+void ctrDrbgDeinit(CtrDrbgContext *context)
+{
+   //Erase AES context
+   if(context->ready)
+   {
+      aesDeinit(&context->cipherContext);
+   }
+
+   //Free previously allocated resources
+   if(context->shared)
+   {
+      osDeleteMutex(&context->mutex);
+   }
+
+   //Clear PRNG state
+   osMemset(context, 0, sizeof(CtrDrbgContext));
+}
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file ctr_drbg.h
+ * @brief CTR_DRBG pseudorandom number generator (NIST SP 800-90A)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _CTR_DRBG_H
+#define _CTR_DRBG_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "cipher/aes.h"
+
+//Size of the keystream buffer
+#ifndef CTR_DRBG_BUFFER_SIZE
+   #define CTR_DRBG_BUFFER_SIZE 128
+#elif (CTR_DRBG_BUFFER_SIZE < 16 || (CTR_DRBG_BUFFER_SIZE % 16) != 0)
+   #error CTR_DRBG_BUFFER_SIZE parameter is not valid
+#endif
+
+//Maximum number of generate requests between reseeds
+#ifndef CTR_DRBG_RESEED_INTERVAL
+   #define CTR_DRBG_RESEED_INTERVAL 0x0001000000000000ULL
+#elif (CTR_DRBG_RESEED_INTERVAL < 1)
+   #error CTR_DRBG_RESEED_INTERVAL parameter is not valid
+#endif
+
+//Number of generate requests after which a child instance reseeds from
+//its parent
+#ifndef CTR_DRBG_CHILD_RESEED_INTERVAL
+   #define CTR_DRBG_CHILD_RESEED_INTERVAL 1024
+#elif (CTR_DRBG_CHILD_RESEED_INTERVAL < 1)
+   #error CTR_DRBG_CHILD_RESEED_INTERVAL parameter is not valid
+#endif
+
+//Common interface for PRNG algorithms
+#define CTR_DRBG_PRNG_ALGO (&ctrDrbgPrngAlgo)
+
+//Key length (AES-256)
+#define CTR_DRBG_KEY_LEN 32
+//Seed length
+#define CTR_DRBG_SEED_LEN 48
+//Minimum length of the seed material
+#define CTR_DRBG_MIN_SEED_LEN 32
+//Maximum number of bytes per generate request
+#define CTR_DRBG_MAX_REQUEST_SIZE 65536
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief CTR_DRBG PRNG context
+ **/
+
+typedef struct _CtrDrbgContext CtrDrbgContext;
+
+struct _CtrDrbgContext
+{
+   OsMutex mutex;                        //Mutex to prevent simultaneous access to the PRNG state
+   bool_t shared;                        //The instance may be accessed by several tasks
+   bool_t ready;                         //This flag tells whether the PRNG has been properly seeded
+   CtrDrbgContext *parent;               //Instance the child is seeded from
+   AesContext cipherContext;             //Cipher context
+   uint8_t k[CTR_DRBG_KEY_LEN];          //Current key
+   uint8_t v[AES_BLOCK_SIZE];            //Counter block
+   uint64_t reseedCounter;               //Number of requests since the last reseed
+   uint8_t buffer[CTR_DRBG_BUFFER_SIZE]; //Keystream buffer
+   size_t bufferLen;                     //Number of unused bytes in the keystream buffer
+};
+
+
+//CTR_DRBG related constants
+extern const PrngAlgo ctrDrbgPrngAlgo;
+
+//CTR_DRBG related functions
+error_t ctrDrbgInit(CtrDrbgContext *context);
+error_t ctrDrbgInitChild(CtrDrbgContext *context, CtrDrbgContext *parent);
+
+error_t ctrDrbgSeed(CtrDrbgContext *context, const uint8_t *input,
+   size_t length);
+
+error_t ctrDrbgAddEntropy(CtrDrbgContext *context, uint_t source,
+   const uint8_t *input, size_t length, size_t entropy);
+
+error_t ctrDrbgRead(CtrDrbgContext *context, uint8_t *output, size_t length);
+
+error_t ctrDrbgGenerate(CtrDrbgContext *context, uint8_t *output,
+   size_t length);
+
+error_t ctrDrbgReseed(CtrDrbgContext *context, const uint8_t *input,
+   size_t length);
+
+error_t ctrDrbgUpdate(CtrDrbgContext *context, const uint8_t *data);
+
+void ctrDrbgDerive(CtrDrbgContext *context, const uint8_t *input,
+   size_t length, uint8_t *output);
+
+void ctrDrbgBcc(AesContext *aesContext, uint8_t *x, size_t *n,
+   const uint8_t *data, size_t length);
+
+void ctrDrbgIncCounter(uint8_t *v);
+
+void ctrDrbgDeinit(CtrDrbgContext *context);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -71,206 +71,104 @@ static const keccak_lane_t rc[KECCAK_NR] =
 };
 
 
-/**
- * @brief Apply theta transformation
- * @param[in,out] a State array
- **/
-
-static void theta(keccak_lane_t a[5][5])
-{
-   keccak_lane_t c[5];
-   keccak_lane_t d[5];
-
-   //The effect of the theta transformation is to XOR each bit in the state
-   //with the parities of two columns in the array
-   c[0] = a[0][0] ^ a[1][0] ^ a[2][0] ^ a[3][0] ^ a[4][0];
-   c[1] = a[0][1] ^ a[1][1] ^ a[2][1] ^ a[3][1] ^ a[4][1];
-   c[2] = a[0][2] ^ a[1][2] ^ a[2][2] ^ a[3][2] ^ a[4][2];
-   c[3] = a[0][3] ^ a[1][3] ^ a[2][3] ^ a[3][3] ^ a[4][3];
-   c[4] = a[0][4] ^ a[1][4] ^ a[2][4] ^ a[3][4] ^ a[4][4];
-
-   d[0] = c[4] ^ KECCAK_ROL(c[1], 1);
-   d[1] = c[0] ^ KECCAK_ROL(c[2], 1);
-   d[2] = c[1] ^ KECCAK_ROL(c[3], 1);
-   d[3] = c[2] ^ KECCAK_ROL(c[4], 1);
-   d[4] = c[3] ^ KECCAK_ROL(c[0], 1);
-
-   a[0][0] ^= d[0];
-   a[1][0] ^= d[0];
-   a[2][0] ^= d[0];
-   a[3][0] ^= d[0];
-   a[4][0] ^= d[0];
-
-   a[0][1] ^= d[1];
-   a[1][1] ^= d[1];
-   a[2][1] ^= d[1];
-   a[3][1] ^= d[1];
-   a[4][1] ^= d[1];
-
-   a[0][2] ^= d[2];
-   a[1][2] ^= d[2];
-   a[2][2] ^= d[2];
-   a[3][2] ^= d[2];
-   a[4][2] ^= d[2];
-
-   a[0][3] ^= d[3];
-   a[1][3] ^= d[3];
-   a[2][3] ^= d[3];
-   a[3][3] ^= d[3];
-   a[4][3] ^= d[3];
-
-   a[0][4] ^= d[4];
-   a[1][4] ^= d[4];
-   a[2][4] ^= d[4];
-   a[3][4] ^= d[4];
-   a[4][4] ^= d[4];
-}
-
-
-/**
- * @brief Apply rho transformation
- * @param[in,out] a State array
- **/
-
-static void rho(keccak_lane_t a[5][5])
-{
-   //The effect of the rho transformation is to rotate the bits of each lane by
-   //an offset, which depends on the fixed x and y coordinates of the lane
-   a[0][1] = KECCAK_ROL(a[0][1], 1);
-   a[0][2] = KECCAK_ROL(a[0][2], 190);
-   a[0][3] = KECCAK_ROL(a[0][3], 28);
-   a[0][4] = KECCAK_ROL(a[0][4], 91);
-
-   a[1][0] = KECCAK_ROL(a[1][0], 36);
-   a[1][1] = KECCAK_ROL(a[1][1], 300);
-   a[1][2] = KECCAK_ROL(a[1][2], 6);
-   a[1][3] = KECCAK_ROL(a[1][3], 55);
-   a[1][4] = KECCAK_ROL(a[1][4], 276);
-
-   a[2][0] = KECCAK_ROL(a[2][0], 3);
-   a[2][1] = KECCAK_ROL(a[2][1], 10);
-   a[2][2] = KECCAK_ROL(a[2][2], 171);
-   a[2][3] = KECCAK_ROL(a[2][3], 153);
-   a[2][4] = KECCAK_ROL(a[2][4], 231);
-
-   a[3][0] = KECCAK_ROL(a[3][0], 105);
-   a[3][1] = KECCAK_ROL(a[3][1], 45);
-   a[3][2] = KECCAK_ROL(a[3][2], 15);
-   a[3][3] = KECCAK_ROL(a[3][3], 21);
-   a[3][4] = KECCAK_ROL(a[3][4], 136);
-
-   a[4][0] = KECCAK_ROL(a[4][0], 210);
-   a[4][1] = KECCAK_ROL(a[4][1], 66);
-   a[4][2] = KECCAK_ROL(a[4][2], 253);
-   a[4][3] = KECCAK_ROL(a[4][3], 120);
-   a[4][4] = KECCAK_ROL(a[4][4], 78);
-}
-
-
-/**
- * @brief Apply pi transformation
- * @param[in,out] a State array
- **/
-
-static void pi(keccak_lane_t a[5][5])
-{
-   keccak_lane_t temp;
-
-   //The effect of the pi transformation is to rearrange the positions of
-   //the lanes
-   temp = a[0][1];
-   a[0][1] = a[1][1];
-   a[1][1] = a[1][4];
-   a[1][4] = a[4][2];
-   a[4][2] = a[2][4];
-   a[2][4] = a[4][0];
-   a[4][0] = a[0][2];
-   a[0][2] = a[2][2];
-   a[2][2] = a[2][3];
-   a[2][3] = a[3][4];
-   a[3][4] = a[4][3];
-   a[4][3] = a[3][0];
-   a[3][0] = a[0][4];
-   a[0][4] = a[4][4];
-   a[4][4] = a[4][1];
-   a[4][1] = a[1][3];
-   a[1][3] = a[3][1];
-   a[3][1] = a[1][0];
-   a[1][0] = a[0][3];
-   a[0][3] = a[3][3];
-   a[3][3] = a[3][2];
-   a[3][2] = a[2][1];
-   a[2][1] = a[1][2];
-   a[1][2] = a[2][0];
-   a[2][0] = temp;
-}
-
-
-/**
- * @brief Apply chi transformation
- * @param[in,out] a State array
- **/
-
-static void chi(keccak_lane_t a[5][5])
-{
-   keccak_lane_t temp1;
-   keccak_lane_t temp2;
-
-   //The effect of the chi transformation is to XOR each bit with a non
-   //linear function of two other bits in its row
-   temp1 = a[0][0];
-   temp2 = a[0][1];
-   a[0][0] ^= ~a[0][1] & a[0][2];
-   a[0][1] ^= ~a[0][2] & a[0][3];
-   a[0][2] ^= ~a[0][3] & a[0][4];
-   a[0][3] ^= ~a[0][4] & temp1;
-   a[0][4] ^= ~temp1 & temp2;
-
-   temp1 = a[1][0];
-   temp2 = a[1][1];
-   a[1][0] ^= ~a[1][1] & a[1][2];
-   a[1][1] ^= ~a[1][2] & a[1][3];
-   a[1][2] ^= ~a[1][3] & a[1][4];
-   a[1][3] ^= ~a[1][4] & temp1;
-   a[1][4] ^= ~temp1 & temp2;
-
-   temp1 = a[2][0];
-   temp2 = a[2][1];
-   a[2][0] ^= ~a[2][1] & a[2][2];
-   a[2][1] ^= ~a[2][2] & a[2][3];
-   a[2][2] ^= ~a[2][3] & a[2][4];
-   a[2][3] ^= ~a[2][4] & temp1;
-   a[2][4] ^= ~temp1 & temp2;
-
-   temp1 = a[3][0];
-   temp2 = a[3][1];
-   a[3][0] ^= ~a[3][1] & a[3][2];
-   a[3][1] ^= ~a[3][2] & a[3][3];
-   a[3][2] ^= ~a[3][3] & a[3][4];
-   a[3][3] ^= ~a[3][4] & temp1;
-   a[3][4] ^= ~temp1 & temp2;
-
-   temp1 = a[4][0];
-   temp2 = a[4][1];
-   a[4][0] ^= ~a[4][1] & a[4][2];
-   a[4][1] ^= ~a[4][2] & a[4][3];
-   a[4][2] ^= ~a[4][3] & a[4][4];
-   a[4][3] ^= ~a[4][4] & temp1;
-   a[4][4] ^= ~temp1 & temp2;
+//Keccak-p round function (the theta, rho, pi, chi and iota step mappings are
+//merged together and the state array is held in local variables)
+#define KECCAK_ROUND(A, E, i) \
+{ \
+   c0 = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa; \
+   c1 = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se; \
+   c2 = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si; \
+   c3 = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so; \
+   c4 = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su; \
+   d0 = c4 ^ KECCAK_ROL(c1, 1); \
+   d1 = c0 ^ KECCAK_ROL(c2, 1); \
+   d2 = c1 ^ KECCAK_ROL(c3, 1); \
+   d3 = c2 ^ KECCAK_ROL(c4, 1); \
+   d4 = c3 ^ KECCAK_ROL(c0, 1); \
+   A##ba ^= d0; \
+   b0 = A##ba; \
+   A##ge ^= d1; \
+   b1 = KECCAK_ROL(A##ge, 300); \
+   A##ki ^= d2; \
+   b2 = KECCAK_ROL(A##ki, 171); \
+   A##mo ^= d3; \
+   b3 = KECCAK_ROL(A##mo, 21); \
+   A##su ^= d4; \
+   b4 = KECCAK_ROL(A##su, 78); \
+   E##ba = b0 ^ (~b1 & b2); \
+   E##be = b1 ^ (~b2 & b3); \
+   E##bi = b2 ^ (~b3 & b4); \
+   E##bo = b3 ^ (~b4 & b0); \
+   E##bu = b4 ^ (~b0 & b1); \
+   E##ba ^= rc[i]; \
+   A##bo ^= d3; \
+   b0 = KECCAK_ROL(A##bo, 28); \
+   A##gu ^= d4; \
+   b1 = KECCAK_ROL(A##gu, 276); \
+   A##ka ^= d0; \
+   b2 = KECCAK_ROL(A##ka, 3); \
+   A##me ^= d1; \
+   b3 = KECCAK_ROL(A##me, 45); \
+   A##si ^= d2; \
+   b4 = KECCAK_ROL(A##si, 253); \
+   E##ga = b0 ^ (~b1 & b2); \
+   E##ge = b1 ^ (~b2 & b3); \
+   E##gi = b2 ^ (~b3 & b4); \
+   E##go = b3 ^ (~b4 & b0); \
+   E##gu = b4 ^ (~b0 & b1); \
+   A##be ^= d1; \
+   b0 = KECCAK_ROL(A##be, 1); \
+   A##gi ^= d2; \
+   b1 = KECCAK_ROL(A##gi, 6); \
+   A##ko ^= d3; \
+   b2 = KECCAK_ROL(A##ko, 153); \
+   A##mu ^= d4; \
+   b3 = KECCAK_ROL(A##mu, 136); \
+   A##sa ^= d0; \
+   b4 = KECCAK_ROL(A##sa, 210); \
+   E##ka = b0 ^ (~b1 & b2); \
+   E##ke = b1 ^ (~b2 & b3); \
+   E##ki = b2 ^ (~b3 & b4); \
+   E##ko = b3 ^ (~b4 & b0); \
+   E##ku = b4 ^ (~b0 & b1); \
+   A##bu ^= d4; \
+   b0 = KECCAK_ROL(A##bu, 91); \
+   A##ga ^= d0; \
+   b1 = KECCAK_ROL(A##ga, 36); \
+   A##ke ^= d1; \
+   b2 = KECCAK_ROL(A##ke, 10); \
+   A##mi ^= d2; \
+   b3 = KECCAK_ROL(A##mi, 15); \
+   A##so ^= d3; \
+   b4 = KECCAK_ROL(A##so, 120); \
+   E##ma = b0 ^ (~b1 & b2); \
+   E##me = b1 ^ (~b2 & b3); \
+   E##mi = b2 ^ (~b3 & b4); \
+   E##mo = b3 ^ (~b4 & b0); \
+   E##mu = b4 ^ (~b0 & b1); \
+   A##bi ^= d2; \
+   b0 = KECCAK_ROL(A##bi, 190); \
+   A##go ^= d3; \
+   b1 = KECCAK_ROL(A##go, 55); \
+   A##ku ^= d4; \
+   b2 = KECCAK_ROL(A##ku, 231); \
+   A##ma ^= d0; \
+   b3 = KECCAK_ROL(A##ma, 105); \
+   A##se ^= d1; \
+   b4 = KECCAK_ROL(A##se, 66); \
+   E##sa = b0 ^ (~b1 & b2); \
+   E##se = b1 ^ (~b2 & b3); \
+   E##si = b2 ^ (~b3 & b4); \
+   E##so = b3 ^ (~b4 & b0); \
+   E##su = b4 ^ (~b0 & b1); \
 }
 
-
-/**
- * @brief Apply iota transformation
- * @param[in,out] a State array
- * @param[index] round Round index
- **/
-
-static void iota(keccak_lane_t a[5][5], uint_t index)
-{
-   //The iota transformation is parameterized by the round index
-   a[0][0] ^= rc[index];
-}
+//Vector holding one lane per Keccak instance (Keccak-f[200] is excluded since
+//some of its rotation offsets are multiples of the lane size)
+#if (HASH_VECTOR_SUPPORT == ENABLED && KECCAK_L >= 4)
+typedef keccak_lane_t KeccakVector __attribute__((vector_size(KECCAK_LANES *
+   sizeof(keccak_lane_t))));
+#endif
 
 
 /**
@@ -475,22 +373,485 @@ void keccakSqueeze(KeccakContext *context, uint8_t *output, size_t length)
 __weak_func void keccakPermutBlock(KeccakContext *context)
 {
    uint_t i;
+   keccak_lane_t aba, abe, abi, abo, abu;
+   keccak_lane_t aga, age, agi, ago, agu;
+   keccak_lane_t aka, ake, aki, ako, aku;
+   keccak_lane_t ama, ame, ami, amo, amu;
+   keccak_lane_t asa, ase, asi, aso, asu;
+   keccak_lane_t eba, ebe, ebi, ebo, ebu;
+   keccak_lane_t ega, ege, egi, ego, egu;
+   keccak_lane_t eka, eke, eki, eko, eku;
+   keccak_lane_t ema, eme, emi, emo, emu;
+   keccak_lane_t esa, ese, esi, eso, esu;
+   keccak_lane_t c0, c1, c2, c3, c4;
+   keccak_lane_t d0, d1, d2, d3, d4;
+   keccak_lane_t b0, b1, b2, b3, b4;
+
+   //Load the state array
+   aba = context->a[0][0];
+   abe = context->a[0][1];
+   abi = context->a[0][2];
+   abo = context->a[0][3];
+   abu = context->a[0][4];
+   aga = context->a[1][0];
+   age = context->a[1][1];
+   agi = context->a[1][2];
+   ago = context->a[1][3];
+   agu = context->a[1][4];
+   aka = context->a[2][0];
+   ake = context->a[2][1];
+   aki = context->a[2][2];
+   ako = context->a[2][3];
+   aku = context->a[2][4];
+   ama = context->a[3][0];
+   ame = context->a[3][1];
+   ami = context->a[3][2];
+   amo = context->a[3][3];
+   amu = context->a[3][4];
+   asa = context->a[4][0];
+   ase = context->a[4][1];
+   asi = context->a[4][2];
+   aso = context->a[4][3];
+   asu = context->a[4][4];
+
+   //Two rounds are computed per iteration, so that the state array alternates
+   //between the two sets of local variables without any copy
+   for(i = 0; i < KECCAK_NR; i += 2)
+   {
+      KECCAK_ROUND(a, e, i);
+      KECCAK_ROUND(e, a, i + 1);
+   }
+
+   //Save the state array
+   context->a[0][0] = aba;
+   context->a[0][1] = abe;
+   context->a[0][2] = abi;
+   context->a[0][3] = abo;
+   context->a[0][4] = abu;
+   context->a[1][0] = aga;
+   context->a[1][1] = age;
+   context->a[1][2] = agi;
+   context->a[1][3] = ago;
+   context->a[1][4] = agu;
+   context->a[2][0] = aka;
+   context->a[2][1] = ake;
+   context->a[2][2] = aki;
+   context->a[2][3] = ako;
+   context->a[2][4] = aku;
+   context->a[3][0] = ama;
+   context->a[3][1] = ame;
+   context->a[3][2] = ami;
+   context->a[3][3] = amo;
+   context->a[3][4] = amu;
+   context->a[4][0] = asa;
+   context->a[4][1] = ase;
+   context->a[4][2] = asi;
+   context->a[4][3] = aso;
+   context->a[4][4] = asu;
+}
+
+
+/**
+ * @brief Absorb data into several Keccak instances in lockstep
+ *
+ * Each instance absorbs the same number of bytes taken from its own buffer.
+ * Instances that share the same rate and the same amount of buffered data
+ * are permuted KECCAK_LANES at a time. Other instances are updated one by one
+ *
+ * @param[in] context Array of pointers to the Keccak contexts
+ * @param[in] input Array of pointers to the buffers being hashed
+ * @param[in] length Length of each buffer
+ * @param[in] count Number of contexts
+ **/
+
+void keccakAbsorbMulti(KeccakContext *context[], const void *input[],
+   size_t length, uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   uint_t m;
+   size_t n;
+   size_t offset;
+   keccak_lane_t *a;
+
+   //Process the contexts by groups of KECCAK_LANES
+   for(; count > 0; count -= m, context += m, input += m)
+   {
+      //Number of contexts in the current group
+      m = MIN(count, KECCAK_LANES);
+
+      //Lockstep processing requires the buffers to be filled at the same level
+      for(i = 1; i < m; i++)
+      {
+         if(context[i]->blockSize != context[0]->blockSize ||
+            context[i]->length != context[0]->length)
+         {
+            break;
+         }
+      }
+
+      //Check whether the contexts can be advanced in lockstep
+      if(i < m)
+      {
+         //Update the contexts one by one
+         for(i = 0; i < m; i++)
+         {
+            keccakAbsorb(context[i], input[i], length);
+         }
+      }
+      else
+      {
+         //Absorbing phase
+         for(offset = 0; offset < length; offset += n)
+         {
+            //Limit the number of bytes to process at a time
+            n = MIN(length - offset, context[0]->blockSize -
+               context[0]->length);
+
+            //Copy the data to the buffers
+            for(i = 0; i < m; i++)
+            {
+               osMemcpy(context[i]->buffer + context[i]->length,
+                  (const uint8_t *) input[i] + offset, n);
+
+               context[i]->length += n;
+            }
+
+            //Absorb the message block by block
+            if(context[0]->length == context[0]->blockSize)
+            {
+               //Absorb the current blocks
+               for(i = 0; i < m; i++)
+               {
+                  //Point to the state array
+                  a = (keccak_lane_t *) context[i]->a;
+
+                  for(j = 0; j < context[i]->blockSize / sizeof(keccak_lane_t); j++)
+                  {
+                     a[j] ^= KECCAK_LETOH(context[i]->block[j]);
+                  }
+
+                  //The input buffer is empty
+                  context[i]->length = 0;
+               }
+
+               //Apply block permutation function
+               keccakPermutBlockMulti(context, m);
+            }
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Finish absorbing phase for several Keccak instances in lockstep
+ * @param[in] context Array of pointers to the Keccak contexts
+ * @param[in] pad Padding byte used for domain separation
+ * @param[in] count Number of contexts
+ **/
+
+void keccakFinalMulti(KeccakContext *context[], uint8_t pad, uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   uint_t m;
+   size_t q;
+   keccak_lane_t *a;
+
+   //Process the contexts by groups of KECCAK_LANES
+   for(; count > 0; count -= m, context += m)
+   {
+      //Number of contexts in the current group
+      m = MIN(count, KECCAK_LANES);
+
+      //Pad and absorb the final blocks
+      for(i = 0; i < m; i++)
+      {
+         //Point to the state array
+         a = (keccak_lane_t *) context[i]->a;
+
+         //Compute the number of padding bytes
+         q = context[i]->blockSize - context[i]->length;
+
+         //Append padding
+         osMemset(context[i]->buffer + context[i]->length, 0, q);
+         context[i]->buffer[context[i]->length] |= pad;
+         context[i]->buffer[context[i]->blockSize - 1] |= 0x80;
+
+         //Absorb the final block
+         for(j = 0; j < context[i]->blockSize / sizeof(keccak_lane_t); j++)
+         {
+            a[j] ^= KECCAK_LETOH(context[i]->block[j]);
+         }
+      }
+
+      //Apply block permutation function
+      keccakPermutBlockMulti(context, m);
+
+      //Convert lanes to little-endian byte order
+      for(i = 0; i < m; i++)
+      {
+         //Point to the state array
+         a = (keccak_lane_t *) context[i]->a;
+
+         for(j = 0; j < context[i]->blockSize / sizeof(keccak_lane_t); j++)
+         {
+            a[j] = KECCAK_HTOLE(a[j]);
+         }
+
+         //Number of bytes available in the output buffer
+         context[i]->length = context[i]->blockSize;
+      }
+   }
+}
+
+
+/**
+ * @brief Extract data from several Keccak instances in lockstep
+ * @param[in] context Array of pointers to the Keccak contexts
+ * @param[out] output Array of pointers to the output strings
+ * @param[in] length Desired output length, in bytes
+ * @param[in] count Number of contexts
+ **/
+
+void keccakSqueezeMulti(KeccakContext *context[], uint8_t *output[],
+   size_t length, uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   uint_t m;
+   size_t n;
+   size_t offset;
+   keccak_lane_t *a;
 
-   //Each round consists of a sequence of five transformations, which are
-   //called the step mappings
-   for(i = 0; i < KECCAK_NR; i++)
+   //Process the contexts by groups of KECCAK_LANES
+   for(; count > 0; count -= m, context += m, output += m)
    {
-      //Apply theta step mapping
-      theta(context->a);
-      //Apply rho step mapping
-      rho(context->a);
-      //Apply pi step mapping
-      pi(context->a);
-      //Apply chi step mapping
-      chi(context->a);
-      //Apply iota step mapping
-      iota(context->a, i);
+      //Number of contexts in the current group
+      m = MIN(count, KECCAK_LANES);
+
+      //Lockstep processing requires the output buffers to be drained at the
+      //same level
+      for(i = 1; i < m; i++)
+      {
+         if(context[i]->blockSize != context[0]->blockSize ||
+            context[i]->length != context[0]->length)
+         {
+            break;
+         }
+      }
+
+      //Check whether the contexts can be advanced in lockstep
+      if(i < m)
+      {
+         //Squeeze the contexts one by one
+         for(i = 0; i < m; i++)
+         {
+            keccakSqueeze(context[i], output[i], length);
+         }
+      }
+      else
+      {
+         //Squeezing phase
+         for(offset = 0; offset < length; offset += n)
+         {
+            //Check whether more data is required
+            if(context[0]->length == 0)
+            {
+               //Convert lanes to host byte order
+               for(i = 0; i < m; i++)
+               {
+                  //Point to the state array
+                  a = (keccak_lane_t *) context[i]->a;
+
+                  for(j = 0; j < context[i]->blockSize / sizeof(keccak_lane_t); j++)
+                  {
+                     a[j] = KECCAK_LETOH(a[j]);
+                  }
+               }
+
+               //Apply block permutation function
+               keccakPermutBlockMulti(context, m);
+
+               //Convert lanes to little-endian byte order
+               for(i = 0; i < m; i++)
+               {
+                  //Point to the state array
+                  a = (keccak_lane_t *) context[i]->a;
+
+                  for(j = 0; j < context[i]->blockSize / sizeof(keccak_lane_t); j++)
+                  {
+                     a[j] = KECCAK_HTOLE(a[j]);
+                  }
+
+                  //Number of bytes available in the output buffer
+                  context[i]->length = context[i]->blockSize;
+               }
+            }
+
+            //Compute the number of bytes to process at a time
+            n = MIN(length - offset, context[0]->length);
+
+            //Copy the output strings
+            for(i = 0; i < m; i++)
+            {
+               if(output[i] != NULL)
+               {
+                  osMemcpy(output[i] + offset, context[i]->digest +
+                     context[i]->blockSize - context[i]->length, n);
+               }
+
+               //Number of bytes available in the output buffer
+               context[i]->length -= n;
+            }
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Permute the state arrays of several Keccak instances in lockstep
+ * @param[in] context Array of pointers to the Keccak contexts
+ * @param[in] count Number of contexts (at most KECCAK_LANES)
+ **/
+
+__weak_func void keccakPermutBlockMulti(KeccakContext *context[], uint_t count)
+{
+   //Portable implementation
+   keccakSoftPermutBlockMulti(context, count);
+}
+
+
+/**
+ * @brief Permute the state arrays of several Keccak instances in lockstep
+ *   (portable implementation)
+ * @param[in] context Array of pointers to the Keccak contexts
+ * @param[in] count Number of contexts (at most KECCAK_LANES)
+ **/
+
+void keccakSoftPermutBlockMulti(KeccakContext *context[], uint_t count)
+{
+#if (HASH_VECTOR_SUPPORT == ENABLED && KECCAK_L >= 4)
+   uint_t i;
+   uint_t j;
+   KeccakVector aba, abe, abi, abo, abu;
+   KeccakVector aga, age, agi, ago, agu;
+   KeccakVector aka, ake, aki, ako, aku;
+   KeccakVector ama, ame, ami, amo, amu;
+   KeccakVector asa, ase, asi, aso, asu;
+   KeccakVector eba, ebe, ebi, ebo, ebu;
+   KeccakVector ega, ege, egi, ego, egu;
+   KeccakVector eka, eke, eki, eko, eku;
+   KeccakVector ema, eme, emi, emo, emu;
+   KeccakVector esa, ese, esi, eso, esu;
+   KeccakVector c0, c1, c2, c3, c4;
+   KeccakVector d0, d1, d2, d3, d4;
+   KeccakVector b0, b1, b2, b3, b4;
+   KeccakVector s[25];
+
+   //Without native vector rotations, lockstep processing only pays off when
+   //all the lanes are in use
+   if(count < KECCAK_LANES)
+   {
+      //Permute the state arrays one after the other
+      for(i = 0; i < count; i++)
+      {
+         keccakPermutBlock(context[i]);
+      }
    }
+   else
+   {
+      //Gather the state arrays (unused lanes duplicate the first instance and
+      //the result is discarded)
+      for(i = 0; i < 25; i++)
+      {
+         for(j = 0; j < KECCAK_LANES; j++)
+         {
+            s[i][j] = context[(j < count) ? j : 0]->a[i / 5][i % 5];
+         }
+      }
+
+      //Load the state arrays (one lane per instance)
+      aba = s[0];
+      abe = s[1];
+      abi = s[2];
+      abo = s[3];
+      abu = s[4];
+      aga = s[5];
+      age = s[6];
+      agi = s[7];
+      ago = s[8];
+      agu = s[9];
+      aka = s[10];
+      ake = s[11];
+      aki = s[12];
+      ako = s[13];
+      aku = s[14];
+      ama = s[15];
+      ame = s[16];
+      ami = s[17];
+      amo = s[18];
+      amu = s[19];
+      asa = s[20];
+      ase = s[21];
+      asi = s[22];
+      aso = s[23];
+      asu = s[24];
+
+      //All the instances are processed at once
+      for(i = 0; i < KECCAK_NR; i += 2)
+      {
+         KECCAK_ROUND(a, e, i);
+         KECCAK_ROUND(e, a, i + 1);
+      }
+
+      //Save the state arrays
+      s[0] = aba;
+      s[1] = abe;
+      s[2] = abi;
+      s[3] = abo;
+      s[4] = abu;
+      s[5] = aga;
+      s[6] = age;
+      s[7] = agi;
+      s[8] = ago;
+      s[9] = agu;
+      s[10] = aka;
+      s[11] = ake;
+      s[12] = aki;
+      s[13] = ako;
+      s[14] = aku;
+      s[15] = ama;
+      s[16] = ame;
+      s[17] = ami;
+      s[18] = amo;
+      s[19] = amu;
+      s[20] = asa;
+      s[21] = ase;
+      s[22] = asi;
+      s[23] = aso;
+      s[24] = asu;
+
+      //Scatter the resulting state arrays
+      for(i = 0; i < 25; i++)
+      {
+         for(j = 0; j < count; j++)
+         {
+            context[j]->a[i / 5][i % 5] = s[i][j];
+         }
+      }
+   }
+#else
+   uint_t i;
+
+   //Permute the state arrays one after the other
+   for(i = 0; i < count; i++)
+   {
+      keccakPermutBlock(context[i]);
+   }
+#endif
 }
 
 #endif
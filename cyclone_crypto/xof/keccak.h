@@ -83,6 +83,8 @@
 #define KECCAK_B (KECCAK_W * 25)
 //The number of rounds for a Keccak-p permutation
 #define KECCAK_NR (12 + 2 * KECCAK_L)
+//Number of Keccak instances processed in lockstep
+#define KECCAK_LANES 4
 
 //Keccak padding byte
 #define KECCAK_PAD 0x01
@@ -127,6 +129,17 @@ void keccakFinal(KeccakContext *context, uint8_t pad);
 void keccakSqueeze(KeccakContext *context, uint8_t *output, size_t length);
 void keccakPermutBlock(KeccakContext *context);
 
+void keccakAbsorbMulti(KeccakContext *context[], const void *input[],
+   size_t length, uint_t count);
+
+void keccakFinalMulti(KeccakContext *context[], uint8_t pad, uint_t count);
+
+void keccakSqueezeMulti(KeccakContext *context[], uint8_t *output[],
+   size_t length, uint_t count);
+
+void keccakPermutBlockMulti(KeccakContext *context[], uint_t count);
+void keccakSoftPermutBlockMulti(KeccakContext *context[], uint_t count);
+
 //C++ guard
 #ifdef __cplusplus
 }
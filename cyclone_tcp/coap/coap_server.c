@@ -148,6 +148,8 @@ error_t coapServerSetCookieSecret(CoapServerContext *context,
    osMemcpy(context->cookieSecret, cookieSecret, cookieSecretLen);
    //Save the length of the secret key
    context->cookieSecretLen = cookieSecretLen;
+   //The new secret key has not been pre-processed yet
+   context->cookieKey.hash = NULL;
 
    //Successful processing
    return NO_ERROR;
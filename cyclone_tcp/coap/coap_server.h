@@ -110,6 +110,7 @@
 //DTLS supported?
 #if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
    #include "core/crypto.h"
+   #include "mac/hmac.h"
    #include "tls.h"
 #endif
 
@@ -209,6 +210,7 @@ struct _CoapServerContext
 #if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
    uint8_t cookieSecret[COAP_SERVER_MAX_COOKIE_SECRET_SIZE]; ///<Cookie secret
    size_t cookieSecretLen;                                   ///<Length of the cookie secret, in bytes
+   HmacPreparedKey cookieKey;                                ///<Pre-processed cookie secret
    CoapDtlsSession session[COAP_SERVER_MAX_SESSIONS];        ///<DTLS sessions
 #endif
    uint8_t buffer[COAP_SERVER_BUFFER_SIZE];                  ///<Memory buffer for input/output operations
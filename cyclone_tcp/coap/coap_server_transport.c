@@ -446,11 +446,23 @@ error_t coapServerCookieGenerateCallback(TlsContext *context,
 
       //Save the length of the generated secret
       session->context->cookieSecretLen = COAP_SERVER_MAX_COOKIE_SECRET_SIZE;
+      //The new secret has not been pre-processed yet
+      session->context->cookieKey.hash = NULL;
+   }
+
+   //The padded cookie secret is digested only once
+   if(session->context->cookieKey.hash == NULL)
+   {
+      //Pre-process the cookie secret
+      error = hmacPrepareKey(&session->context->cookieKey, SHA256_HASH_ALGO,
+         session->context->cookieSecret, session->context->cookieSecretLen);
+      //Any error to report?
+      if(error)
+         return error;
    }
 
    //Initialize HMAC context
-   hmacInit(&hmacContext, SHA256_HASH_ALGO, session->context->cookieSecret,
-      session->context->cookieSecretLen);
+   hmacInitPrepared(&hmacContext, &session->context->cookieKey);
 
    //Generate stateless cookie
    hmacUpdate(&hmacContext, (uint8_t *) &session->clientIpAddr + sizeof(size_t),
@@ -515,11 +527,23 @@ error_t coapServerCookieVerifyCallback(TlsContext *context,
 
       //Save the length of the generated secret
       session->context->cookieSecretLen = COAP_SERVER_MAX_COOKIE_SECRET_SIZE;
+      //The new secret has not been pre-processed yet
+      session->context->cookieKey.hash = NULL;
+   }
+
+   //The padded cookie secret is digested only once
+   if(session->context->cookieKey.hash == NULL)
+   {
+      //Pre-process the cookie secret
+      error = hmacPrepareKey(&session->context->cookieKey, SHA256_HASH_ALGO,
+         session->context->cookieSecret, session->context->cookieSecretLen);
+      //Any error to report?
+      if(error)
+         return error;
    }
 
    //Initialize HMAC context
-   hmacInit(&hmacContext, SHA256_HASH_ALGO, session->context->cookieSecret,
-      session->context->cookieSecretLen);
+   hmacInitPrepared(&hmacContext, &session->context->cookieKey);
 
    //Generate stateless cookie
    hmacUpdate(&hmacContext, (uint8_t *) &session->clientIpAddr + sizeof(size_t),
@@ -1585,6 +1585,23 @@ void netTaskEx(NetContext *context)
          timeout = 0;
       }
 
+#if (TCP_SUPPORT == ENABLED && TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+      //The TCP pacer may resume a transmission before the next tick
+      if(tcpPacingTimer.running)
+      {
+         if(timeCompare(time, tcpPacingTimer.startTime +
+            tcpPacingTimer.interval) < 0)
+         {
+            timeout = MIN(timeout, tcpPacingTimer.startTime +
+               tcpPacingTimer.interval - time);
+         }
+         else
+         {
+            timeout = 0;
+         }
+      }
+#endif
+
       //Receive notifications when a frame has been received, or the
       //link state of any network interfaces has changed
       status = osWaitForEvent(&netEvent, timeout);
@@ -1659,6 +1676,19 @@ void netTaskEx(NetContext *context)
          osReleaseMutex(&netMutex);
       }
 
+#if (TCP_SUPPORT == ENABLED && TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+      //Earliest pacing deadline reached?
+      if(netTimerExpired(&tcpPacingTimer))
+      {
+         //Get exclusive access
+         osAcquireMutex(&netMutex);
+         //Resume the transmissions held back by the pacer
+         tcpPacingTick();
+         //Release exclusive access
+         osReleaseMutex(&netMutex);
+      }
+#endif
+
       //Get current time
       time = osGetSystemTime();
 
@@ -47,10 +47,30 @@
 
 //Mutex preventing simultaneous access to the memory pool
 static OsMutex memPoolMutex;
-//Memory pool
-static uint32_t memPool[NET_MEM_POOL_BUFFER_COUNT][NET_MEM_POOL_BUFFER_SIZE / 4];
+
+#if (NET_MEM_POOL_SMALL_BUFFER_COUNT > 0)
+//Pool of small blocks
+static void *memPoolSmall[NET_MEM_POOL_SMALL_BUFFER_COUNT][NET_MEM_POOL_SMALL_BUFFER_SIZE / sizeof(void *)];
+//Allocation table of the small blocks
+static bool_t memPoolSmallAllocTable[NET_MEM_POOL_SMALL_BUFFER_COUNT];
+#endif
+
+#if (NET_MEM_POOL_MEDIUM_BUFFER_COUNT > 0)
+//Pool of medium blocks
+static void *memPoolMedium[NET_MEM_POOL_MEDIUM_BUFFER_COUNT][NET_MEM_POOL_MEDIUM_BUFFER_SIZE / sizeof(void *)];
+//Allocation table of the medium blocks
+static bool_t memPoolMediumAllocTable[NET_MEM_POOL_MEDIUM_BUFFER_COUNT];
+#endif
+
+//Memory pool (the blocks are made of pointer-sized words so that the link
+//stored in a free block is properly aligned)
+static void *memPool[NET_MEM_POOL_BUFFER_COUNT][NET_MEM_POOL_BUFFER_SIZE / sizeof(void *)];
 //Allocation table
 static bool_t memPoolAllocTable[NET_MEM_POOL_BUFFER_COUNT];
+
+//Size classes, sorted by increasing block size
+static MemPoolClass memPoolClasses[NET_MEM_POOL_CLASS_COUNT];
+
 //Number of buffers currently allocated
 uint_t memPoolCurrentUsage;
 //Maximum number of buffers that have been allocated so far
@@ -68,6 +88,11 @@ error_t memPoolInit(void)
 {
 //Use fixed-size blocks allocation?
 #if (NET_MEM_POOL_SUPPORT == ENABLED)
+   uint_t i;
+   uint_t j;
+   void **block;
+   MemPoolClass *poolClass;
+
    //Create a mutex to prevent simultaneous access to the memory pool
    if(!osCreateMutex(&memPoolMutex))
    {
@@ -75,8 +100,52 @@ error_t memPoolInit(void)
       return ERROR_OUT_OF_RESOURCES;
    }
 
-   //Clear allocation table
-   osMemset(memPoolAllocTable, 0, sizeof(memPoolAllocTable));
+   //Clear size classes
+   osMemset(memPoolClasses, 0, sizeof(memPoolClasses));
+
+#if (NET_MEM_POOL_SMALL_BUFFER_COUNT > 0)
+   //Small blocks
+   memPoolClasses[0].blocks = memPoolSmall[0];
+   memPoolClasses[0].allocTable = memPoolSmallAllocTable;
+   memPoolClasses[0].blockSize = NET_MEM_POOL_SMALL_BUFFER_SIZE;
+   memPoolClasses[0].blockCount = NET_MEM_POOL_SMALL_BUFFER_COUNT;
+#endif
+
+#if (NET_MEM_POOL_MEDIUM_BUFFER_COUNT > 0)
+   //Medium blocks
+   memPoolClasses[1].blocks = memPoolMedium[0];
+   memPoolClasses[1].allocTable = memPoolMediumAllocTable;
+   memPoolClasses[1].blockSize = NET_MEM_POOL_MEDIUM_BUFFER_SIZE;
+   memPoolClasses[1].blockCount = NET_MEM_POOL_MEDIUM_BUFFER_COUNT;
+#endif
+
+   //Large blocks
+   memPoolClasses[2].blocks = memPool[0];
+   memPoolClasses[2].allocTable = memPoolAllocTable;
+   memPoolClasses[2].blockSize = NET_MEM_POOL_BUFFER_SIZE;
+   memPoolClasses[2].blockCount = NET_MEM_POOL_BUFFER_COUNT;
+
+   //Loop through size classes
+   for(i = 0; i < NET_MEM_POOL_CLASS_COUNT; i++)
+   {
+      //Point to the current size class
+      poolClass = &memPoolClasses[i];
+
+      //Loop through the blocks of the pool, starting with the last one
+      for(j = poolClass->blockCount; j > 0; j--)
+      {
+         //Point to the current block
+         block = poolClass->blocks + (j - 1) * (poolClass->blockSize / sizeof(void *));
+
+         //Free blocks are chained through their first word, so that a block
+         //can be allocated or released in constant time
+         *block = poolClass->freeList;
+         poolClass->freeList = block;
+
+         //Mark the current block as free
+         poolClass->allocTable[j - 1] = FALSE;
+      }
+   }
 
    //Clear statistics
    memPoolCurrentUsage = 0;
@@ -98,6 +167,8 @@ void *memPoolAlloc(size_t size)
 {
 #if (NET_MEM_POOL_SUPPORT == ENABLED)
    uint_t i;
+   uint_t index;
+   MemPoolClass *poolClass;
 #endif
 
    //Pointer to the allocated memory block
@@ -111,28 +182,32 @@ void *memPoolAlloc(size_t size)
    //Acquire exclusive access to the memory pool
    osAcquireMutex(&memPoolMutex);
 
-   //Enforce block size
-   if(size <= NET_MEM_POOL_BUFFER_SIZE)
+   //Use the smallest size class that can satisfy the request. Larger
+   //blocks are used when the preferred size class is exhausted
+   for(i = 0; i < NET_MEM_POOL_CLASS_COUNT && p == NULL; i++)
    {
-      //Loop through allocation table
-      for(i = 0; i < NET_MEM_POOL_BUFFER_COUNT; i++)
+      //Point to the current size class
+      poolClass = &memPoolClasses[i];
+
+      //Enforce block size and check whether a free block is available
+      if(size <= poolClass->blockSize && poolClass->freeList != NULL)
       {
-         //Check whether the current block is free
-         if(!memPoolAllocTable[i])
-         {
-            //Mark the current entry as used
-            memPoolAllocTable[i] = TRUE;
-            //Point to the corresponding memory block
-            p = memPool[i];
+         //Remove the first block from the list of free blocks
+         p = poolClass->freeList;
+         poolClass->freeList = *((void **) p);
 
-            //Update statistics
-            memPoolCurrentUsage++;
-            //Maximum number of buffers that have been allocated so far
-            memPoolMaxUsage = MAX(memPoolCurrentUsage, memPoolMaxUsage);
+         //Mark the corresponding entry as used
+         index = ((void **) p - poolClass->blocks) / (poolClass->blockSize / sizeof(void *));
+         poolClass->allocTable[index] = TRUE;
 
-            //Exit immediately
-            break;
-         }
+         //Update statistics
+         poolClass->currentUsage++;
+         poolClass->maxUsage = MAX(poolClass->currentUsage, poolClass->maxUsage);
+
+         //Update global statistics
+         memPoolCurrentUsage++;
+         //Maximum number of buffers that have been allocated so far
+         memPoolMaxUsage = MAX(memPoolCurrentUsage, memPoolMaxUsage);
       }
    }
 
@@ -165,20 +240,44 @@ void memPoolFree(void *p)
 //Use fixed-size blocks allocation?
 #if (NET_MEM_POOL_SUPPORT == ENABLED)
    uint_t i;
+   uint_t index;
+   void **block;
+   MemPoolClass *poolClass;
+
+   //Point to the memory block
+   block = (void **) p;
 
    //Acquire exclusive access to the memory pool
    osAcquireMutex(&memPoolMutex);
 
-   //Loop through allocation table
-   for(i = 0; i < NET_MEM_POOL_BUFFER_COUNT; i++)
+   //Loop through size classes
+   for(i = 0; i < NET_MEM_POOL_CLASS_COUNT; i++)
    {
-      if(memPool[i] == p)
+      //Point to the current size class
+      poolClass = &memPoolClasses[i];
+
+      //Check whether the block belongs to the current pool
+      if(poolClass->blockCount > 0 && block >= poolClass->blocks &&
+         block < poolClass->blocks + poolClass->blockCount * (poolClass->blockSize / sizeof(void *)))
       {
-         //Mark the current block as free
-         memPoolAllocTable[i] = FALSE;
+         //Retrieve the index of the block
+         index = (block - poolClass->blocks) / (poolClass->blockSize / sizeof(void *));
 
-         //Update statistics
-         memPoolCurrentUsage--;
+         //Make sure the block is currently allocated
+         if(poolClass->allocTable[index] &&
+            block == poolClass->blocks + index * (poolClass->blockSize / sizeof(void *)))
+         {
+            //Mark the current block as free
+            poolClass->allocTable[index] = FALSE;
+
+            //Insert the block at the head of the list of free blocks
+            *block = poolClass->freeList;
+            poolClass->freeList = block;
+
+            //Update statistics
+            poolClass->currentUsage--;
+            memPoolCurrentUsage--;
+         }
 
          //Exit immediately
          break;
@@ -215,7 +314,10 @@ void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
 
    //Total number of buffers in the memory pool
    if(size != NULL)
-      *size = NET_MEM_POOL_BUFFER_COUNT;
+   {
+      *size = NET_MEM_POOL_SMALL_BUFFER_COUNT +
+         NET_MEM_POOL_MEDIUM_BUFFER_COUNT + NET_MEM_POOL_BUFFER_COUNT;
+   }
 #else
    //Memory pool is not used...
    if(currentUsage != NULL)
@@ -230,6 +332,109 @@ void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
 }
 
 
+/**
+ * @brief Get the usage of a given size class
+ * @param[in] index Zero-based index of the size class (0 = small blocks,
+ *   1 = medium blocks, 2 = large blocks)
+ * @param[out] blockSize Size of the blocks, in bytes
+ * @param[out] currentUsage Number of blocks currently allocated
+ * @param[out] maxUsage Maximum number of blocks that have been allocated so far
+ * @param[out] size Total number of blocks in the size class
+ **/
+
+void memPoolGetClassStats(uint_t index, size_t *blockSize,
+   uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
+{
+   //Size of the blocks
+   if(blockSize != NULL)
+   {
+      if(index == 0)
+      {
+         *blockSize = NET_MEM_POOL_SMALL_BUFFER_SIZE;
+      }
+      else if(index == 1)
+      {
+         *blockSize = NET_MEM_POOL_MEDIUM_BUFFER_SIZE;
+      }
+      else if(index == 2)
+      {
+         *blockSize = NET_MEM_POOL_BUFFER_SIZE;
+      }
+      else
+      {
+         *blockSize = 0;
+      }
+   }
+
+//Use fixed-size blocks allocation?
+#if (NET_MEM_POOL_SUPPORT == ENABLED)
+   //Valid size class?
+   if(index < NET_MEM_POOL_CLASS_COUNT)
+   {
+      //Acquire exclusive access to the memory pool
+      osAcquireMutex(&memPoolMutex);
+
+      //Number of blocks currently allocated
+      if(currentUsage != NULL)
+         *currentUsage = memPoolClasses[index].currentUsage;
+
+      //Maximum number of blocks that have been allocated so far
+      if(maxUsage != NULL)
+         *maxUsage = memPoolClasses[index].maxUsage;
+
+      //Total number of blocks in the size class
+      if(size != NULL)
+         *size = memPoolClasses[index].blockCount;
+
+      //Release exclusive access to the memory pool
+      osReleaseMutex(&memPoolMutex);
+   }
+   else
+#endif
+   {
+      //The size class is not used...
+      if(currentUsage != NULL)
+         *currentUsage = 0;
+
+      if(maxUsage != NULL)
+         *maxUsage = 0;
+
+      if(size != NULL)
+         *size = 0;
+   }
+}
+
+
+/**
+ * @brief Get the size of the block used to hold a given amount of data
+ * @param[in] size Number of bytes to be stored
+ * @return Size of the smallest block that can hold the data. Requests that
+ *   exceed the largest block size return the size of the largest blocks
+ **/
+
+size_t memPoolGetBlockSize(size_t size)
+{
+   size_t n;
+
+   //Select the smallest size class that can hold the data
+   if(size <= NET_MEM_POOL_SMALL_BUFFER_SIZE)
+   {
+      n = NET_MEM_POOL_SMALL_BUFFER_SIZE;
+   }
+   else if(size <= NET_MEM_POOL_MEDIUM_BUFFER_SIZE)
+   {
+      n = NET_MEM_POOL_MEDIUM_BUFFER_SIZE;
+   }
+   else
+   {
+      n = NET_MEM_POOL_BUFFER_SIZE;
+   }
+
+   //Return the size of the block
+   return n;
+}
+
+
 /**
  * @brief Allocate a multi-part buffer
  * @param[in] length Desired length
@@ -240,10 +445,15 @@ void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
 NetBuffer *netBufferAlloc(size_t length)
 {
    error_t error;
+   size_t size;
    NetBuffer *buffer;
 
+   //Small buffers (ACKs, ARP messages, DNS queries...) do not need a full
+   //block. Select the smallest block that can hold the header and the data
+   size = memPoolGetBlockSize(CHUNKED_BUFFER_HEADER_SIZE + length);
+
    //Allocate memory to hold the multi-part buffer
-   buffer = memPoolAlloc(NET_MEM_POOL_BUFFER_SIZE);
+   buffer = memPoolAlloc(size);
    //Failed to allocate memory?
    if(buffer == NULL)
       return NULL;
@@ -252,7 +462,7 @@ NetBuffer *netBufferAlloc(size_t length)
    buffer->chunkCount = 1;
    buffer->maxChunkCount = MAX_CHUNK_COUNT;
    buffer->chunk[0].address = (uint8_t *) buffer + CHUNKED_BUFFER_HEADER_SIZE;
-   buffer->chunk[0].length = NET_MEM_POOL_BUFFER_SIZE - CHUNKED_BUFFER_HEADER_SIZE;
+   buffer->chunk[0].length = size - CHUNKED_BUFFER_HEADER_SIZE;
    buffer->chunk[0].size = 0;
 
    //Adjust the length of the buffer
@@ -47,13 +47,48 @@
    #error NET_MEM_POOL_BUFFER_COUNT parameter is not valid
 #endif
 
-//Size of the buffers
+//Size of the buffers (free blocks are chained through a pointer stored in
+//their first bytes, hence sizes must be multiples of 8 so that every block
+//is suitably aligned on both 32-bit and 64-bit targets)
 #ifndef NET_MEM_POOL_BUFFER_SIZE
    #define NET_MEM_POOL_BUFFER_SIZE 1536
-#elif (NET_MEM_POOL_BUFFER_SIZE < 128)
+#elif (NET_MEM_POOL_BUFFER_SIZE < 128 || (NET_MEM_POOL_BUFFER_SIZE % 8) != 0)
    #error NET_MEM_POOL_BUFFER_SIZE parameter is not valid
 #endif
 
+//Number of small buffers available
+#ifndef NET_MEM_POOL_SMALL_BUFFER_COUNT
+   #define NET_MEM_POOL_SMALL_BUFFER_COUNT 0
+#elif (NET_MEM_POOL_SMALL_BUFFER_COUNT < 0)
+   #error NET_MEM_POOL_SMALL_BUFFER_COUNT parameter is not valid
+#endif
+
+//Size of the small buffers
+#ifndef NET_MEM_POOL_SMALL_BUFFER_SIZE
+   #define NET_MEM_POOL_SMALL_BUFFER_SIZE 256
+#elif (NET_MEM_POOL_SMALL_BUFFER_SIZE < 64 || (NET_MEM_POOL_SMALL_BUFFER_SIZE % 8) != 0)
+   #error NET_MEM_POOL_SMALL_BUFFER_SIZE parameter is not valid
+#endif
+
+//Number of medium buffers available
+#ifndef NET_MEM_POOL_MEDIUM_BUFFER_COUNT
+   #define NET_MEM_POOL_MEDIUM_BUFFER_COUNT 0
+#elif (NET_MEM_POOL_MEDIUM_BUFFER_COUNT < 0)
+   #error NET_MEM_POOL_MEDIUM_BUFFER_COUNT parameter is not valid
+#endif
+
+//Size of the medium buffers
+#ifndef NET_MEM_POOL_MEDIUM_BUFFER_SIZE
+   #define NET_MEM_POOL_MEDIUM_BUFFER_SIZE 768
+#elif (NET_MEM_POOL_MEDIUM_BUFFER_SIZE <= NET_MEM_POOL_SMALL_BUFFER_SIZE || \
+   NET_MEM_POOL_MEDIUM_BUFFER_SIZE >= NET_MEM_POOL_BUFFER_SIZE || \
+   (NET_MEM_POOL_MEDIUM_BUFFER_SIZE % 8) != 0)
+   #error NET_MEM_POOL_MEDIUM_BUFFER_SIZE parameter is not valid
+#endif
+
+//Number of buffer size classes
+#define NET_MEM_POOL_CLASS_COUNT 3
+
 //Size of the header part of the buffer
 #define CHUNKED_BUFFER_HEADER_SIZE (sizeof(NetBuffer) + MAX_CHUNK_COUNT * sizeof(ChunkDesc))
 
@@ -98,12 +133,33 @@ typedef struct
 } NetBuffer1;
 
 
+/**
+ * @brief Memory pool holding fixed-size blocks of a given size class
+ **/
+
+typedef struct
+{
+   void **blocks;        ///<Memory blocks
+   bool_t *allocTable;   ///<Allocation table
+   size_t blockSize;     ///<Size of the blocks, in bytes
+   uint_t blockCount;    ///<Number of blocks in the pool
+   void *freeList;       ///<List of free blocks
+   uint_t currentUsage;  ///<Number of blocks currently allocated
+   uint_t maxUsage;      ///<Maximum number of blocks that have been allocated so far
+} MemPoolClass;
+
+
 //Memory management functions
 error_t memPoolInit(void);
 void *memPoolAlloc(size_t size);
 void memPoolFree(void *p);
 void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size);
 
+void memPoolGetClassStats(uint_t index, size_t *blockSize,
+   uint_t *currentUsage, uint_t *maxUsage, uint_t *size);
+
+size_t memPoolGetBlockSize(size_t size);
+
 NetBuffer *netBufferAlloc(size_t length);
 void netBufferFree(NetBuffer *buffer);
 
@@ -31,6 +31,7 @@
 //Dependencies
 #include "core/net.h"
 #include "core/socket.h"
+#include "core/socket_misc.h"
 #include "core/raw_socket.h"
 #include "core/ethernet_misc.h"
 #include "ipv4/ipv4.h"
@@ -61,20 +62,47 @@ error_t rawSocketProcessIpPacket(NetInterface *interface,
    const NetRxAncillary *ancillary)
 {
    uint_t i;
+   uint_t protocol;
    size_t length;
    Socket *socket;
+   Socket *matchingSocket;
    SocketQueueItem *queueItem;
    NetBuffer *p;
 
    //Retrieve the length of the raw IP packet
    length = netBufferGetLength(buffer) - offset;
 
-   //Loop through opened sockets
-   for(i = 0; i < SOCKET_MAX_COUNT; i++)
+#if (IPV4_SUPPORT == ENABLED)
+   //IPv4 packet received?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
    {
-      //Point to the current socket
-      socket = socketTable + i;
+      //Retrieve the protocol field
+      protocol = pseudoHeader->ipv4Data.protocol;
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //IPv6 packet received?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      //Retrieve the next header field
+      protocol = pseudoHeader->ipv6Data.nextHeader;
+   }
+   else
+#endif
+   //Invalid packet received?
+   {
+      //This should never occur...
+      return ERROR_PROTOCOL_UNREACHABLE;
+   }
 
+   //No matching socket for the moment
+   matchingSocket = NULL;
+
+   //Only the raw sockets bound to the protocol of the packet are searched
+   for(socket = socketBindHashTable[socketComputeBindHash(SOCKET_TYPE_RAW_IP,
+      protocol)]; socket != NULL; socket = socket->hashNext)
+   {
       //Raw socket found?
       if(socket->type != SOCKET_TYPE_RAW_IP)
          continue;
@@ -207,14 +235,18 @@ error_t rawSocketProcessIpPacket(NetInterface *interface,
          continue;
       }
 
-      //The current socket meets all the criteria
-      break;
+      //The socket with the lowest descriptor takes precedence
+      if(matchingSocket == NULL || socket < matchingSocket)
+         matchingSocket = socket;
    }
 
    //Drop incoming packet if no matching socket was found
-   if(i >= SOCKET_MAX_COUNT)
+   if(matchingSocket == NULL)
       return ERROR_PROTOCOL_UNREACHABLE;
 
+   //Point to the matching socket
+   socket = matchingSocket;
+
    //Empty receive queue?
    if(socket->receiveQueue == NULL)
    {
@@ -355,77 +387,121 @@ void rawSocketProcessEthPacket(NetInterface *interface, const uint8_t *data,
 #if (ETH_SUPPORT == ENABLED)
    uint_t i;
    uint_t j;
+   uint_t k;
+   uint_t numProtocols;
+   uint16_t protocols[3];
    Socket *socket;
    SocketQueueItem *queueItem;
    NetBuffer *p;
 
-   //Loop through opened sockets
-   for(i = 0; i < SOCKET_MAX_COUNT; i++)
+   //Raw sockets accepting the EtherType of the frame, or all frames
+   protocols[0] = ancillary->ethType;
+   protocols[1] = SOCKET_ETH_PROTO_ALL;
+   numProtocols = 2;
+
+   //LLC frame received?
+   if(ancillary->ethType <= ETH_MTU)
    {
-      //Point to the current socket
-      socket = socketTable + i;
+      //Raw sockets accepting LLC frames
+      protocols[numProtocols++] = SOCKET_ETH_PROTO_LLC;
+   }
 
-      //Raw socket found?
-      if(socket->type != SOCKET_TYPE_RAW_ETH)
-         continue;
+   //Loop through the relevant protocol values
+   for(k = 0; k < numProtocols; k++)
+   {
+      //Skip the protocol values that have already been searched
+      for(i = 0; i < k && protocols[i] != protocols[k]; i++)
+      {
+      }
 
-      //Check whether the socket is bound to a particular interface
-      if(socket->interface && socket->interface != interface)
+      //Duplicate value?
+      if(i < k)
          continue;
 
-      //Check protocol field
-      if(socket->protocol == SOCKET_ETH_PROTO_ALL)
+      //Only the raw sockets bound to the current protocol value are searched
+      for(socket = socketBindHashTable[socketComputeBindHash(
+         SOCKET_TYPE_RAW_ETH, protocols[k])]; socket != NULL;
+         socket = socket->hashNext)
       {
-         //Accept all EtherType values
-      }
-      else if(socket->protocol == SOCKET_ETH_PROTO_LLC)
-      {
-         //Only accept LLC frames
-         if(ancillary->ethType > ETH_MTU)
+         //Raw socket found?
+         if(socket->type != SOCKET_TYPE_RAW_ETH)
             continue;
-      }
-      else
-      {
-         //Only accept frames with the correct EtherType value
-         if(ancillary->ethType != socket->protocol)
+
+         //Check whether the socket is bound to a particular interface
+         if(socket->interface && socket->interface != interface)
             continue;
-      }
 
-      //Empty receive queue?
-      if(socket->receiveQueue == NULL)
-      {
-         //Allocate a memory buffer to hold the data and the associated
-         //descriptor
-         p = netBufferAlloc(sizeof(SocketQueueItem) + length);
+         //Check protocol field
+         if(socket->protocol != protocols[k])
+            continue;
 
-         //Successful memory allocation?
-         if(p != NULL)
+         //Empty receive queue?
+         if(socket->receiveQueue == NULL)
          {
-            //Point to the newly created item
-            queueItem = netBufferAt(p, 0);
-            queueItem->buffer = p;
-            //Add the newly created item to the queue
-            socket->receiveQueue = queueItem;
+            //Allocate a memory buffer to hold the data and the associated
+            //descriptor
+            p = netBufferAlloc(sizeof(SocketQueueItem) + length);
+
+            //Successful memory allocation?
+            if(p != NULL)
+            {
+               //Point to the newly created item
+               queueItem = netBufferAt(p, 0);
+               queueItem->buffer = p;
+               //Add the newly created item to the queue
+               socket->receiveQueue = queueItem;
+            }
+            else
+            {
+               //Memory allocation failed
+               queueItem = NULL;
+            }
          }
          else
          {
-            //Memory allocation failed
-            queueItem = NULL;
-         }
-      }
-      else
-      {
-         //Point to the very first item
-         queueItem = socket->receiveQueue;
+            //Point to the very first item
+            queueItem = socket->receiveQueue;
 
-         //Reach the last item in the receive queue
-         for(j = 1; queueItem->next; j++)
-         {
-            queueItem = queueItem->next;
+            //Reach the last item in the receive queue
+            for(j = 1; queueItem->next; j++)
+            {
+               queueItem = queueItem->next;
+            }
+
+            //Check whether the receive queue is full
+            if(j >= RAW_SOCKET_RX_QUEUE_SIZE)
+            {
+               //Number of inbound packets which were chosen to be discarded
+               //even though no errors had been detected
+               MIB2_IF_INC_COUNTER32(ifTable[interface->index].ifInDiscards, 1);
+               IF_MIB_INC_COUNTER32(ifTable[interface->index].ifInDiscards, 1);
+
+               //Exit immediately
+               break;
+            }
+
+            //Allocate a memory buffer to hold the data and the associated
+            //descriptor
+            p = netBufferAlloc(sizeof(SocketQueueItem) + length);
+
+            //Successful memory allocation?
+            if(p != NULL)
+            {
+               //Add the newly created item to the queue
+               queueItem->next = netBufferAt(p, 0);
+               //Point to the newly created item
+               queueItem = queueItem->next;
+               queueItem->buffer = p;
+            }
+            else
+            {
+               //Memory allocation failed
+               queueItem = NULL;
+            }
          }
 
-         //Check whether the receive queue is full
-         if(j >= RAW_SOCKET_RX_QUEUE_SIZE)
+         //Not enough resources to properly handle the packet?
+         if(queueItem == NULL)
          {
             //Number of inbound packets which were chosen to be discarded even
             //though no errors had been detected
@@ -436,59 +512,32 @@ void rawSocketProcessEthPacket(NetInterface *interface, const uint8_t *data,
             break;
          }
 
-         //Allocate a memory buffer to hold the data and the associated
-         //descriptor
-         p = netBufferAlloc(sizeof(SocketQueueItem) + length);
+         //Initialize next field
+         queueItem->next = NULL;
+         //Network interface where the packet was received
+         queueItem->interface = interface;
 
-         //Successful memory allocation?
-         if(p != NULL)
-         {
-            //Add the newly created item to the queue
-            queueItem->next = netBufferAt(p, 0);
-            //Point to the newly created item
-            queueItem = queueItem->next;
-            queueItem->buffer = p;
-         }
-         else
-         {
-            //Memory allocation failed
-            queueItem = NULL;
-         }
-      }
-
-      //Not enough resources to properly handle the packet?
-      if(queueItem == NULL)
-      {
-         //Number of inbound packets which were chosen to be discarded even
-         //though no errors had been detected
-         MIB2_IF_INC_COUNTER32(ifTable[interface->index].ifInDiscards, 1);
-         IF_MIB_INC_COUNTER32(ifTable[interface->index].ifInDiscards, 1);
-
-         //Exit immediately
-         break;
-      }
-
-      //Initialize next field
-      queueItem->next = NULL;
-      //Network interface where the packet was received
-      queueItem->interface = interface;
+         //Other fields are meaningless
+         queueItem->srcPort = 0;
+         queueItem->srcIpAddr = IP_ADDR_ANY;
+         queueItem->destIpAddr = IP_ADDR_ANY;
 
-      //Other fields are meaningless
-      queueItem->srcPort = 0;
-      queueItem->srcIpAddr = IP_ADDR_ANY;
-      queueItem->destIpAddr = IP_ADDR_ANY;
+         //Offset to the raw datagram
+         queueItem->offset = sizeof(SocketQueueItem);
 
-      //Offset to the raw datagram
-      queueItem->offset = sizeof(SocketQueueItem);
+         //Copy the payload
+         netBufferWrite(queueItem->buffer, queueItem->offset, data, length);
 
-      //Copy the payload
-      netBufferWrite(queueItem->buffer, queueItem->offset, data, length);
+         //Additional options can be passed to the stack along with the packet
+         queueItem->ancillary = *ancillary;
 
-      //Additional options can be passed to the stack along with the packet
-      queueItem->ancillary = *ancillary;
+         //Notify user that data is available
+         rawSocketUpdateEvents(socket);
+      }
 
-      //Notify user that data is available
-      rawSocketUpdateEvents(socket);
+      //Stop processing if the packet could not be queued
+      if(socket != NULL)
+         break;
    }
 #endif
 }
@@ -45,6 +45,11 @@
 //Socket table
 Socket socketTable[SOCKET_MAX_COUNT];
 
+//Hash table of connected sockets (local port, remote address and remote port)
+Socket *socketConnHashTable[SOCKET_HASH_TABLE_SIZE];
+//Hash table of the other sockets (local port only)
+Socket *socketBindHashTable[SOCKET_HASH_TABLE_SIZE];
+
 //Default socket message
 const SocketMsg SOCKET_DEFAULT_MSG =
 {
@@ -87,6 +92,10 @@ error_t socketInit(void)
    //Initialize socket descriptors
    osMemset(socketTable, 0, sizeof(socketTable));
 
+   //Initialize hash tables
+   osMemset(socketConnHashTable, 0, sizeof(socketConnHashTable));
+   osMemset(socketBindHashTable, 0, sizeof(socketBindHashTable));
+
    //Loop through socket descriptors
    for(i = 0; i < SOCKET_MAX_COUNT; i++)
    {
@@ -722,6 +731,39 @@ error_t socketSetRxBufferSize(Socket *socket, size_t size)
 }
 
 
+/**
+ * @brief Select the congestion control algorithm
+ * @param[in] socket Handle to a socket
+ * @param[in] algo Congestion control algorithm (e.g. TCP_CUBIC_ALGO)
+ * @return Error code
+ **/
+
+error_t socketSetCongestionControl(Socket *socket,
+   const TcpCongestionAlgo *algo)
+{
+#if (TCP_SUPPORT == ENABLED && TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //Check parameters
+   if(socket == NULL || algo == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //This function shall be used with connection-oriented socket types
+   if(socket->type != SOCKET_TYPE_STREAM)
+      return ERROR_INVALID_SOCKET;
+
+   //The algorithm cannot be changed when the connection is established
+   if(tcpGetState(socket) != TCP_STATE_CLOSED)
+      return ERROR_INVALID_SOCKET;
+
+   //Use the specified algorithm
+   socket->congestAlgo = algo;
+   //No error to report
+   return NO_ERROR;
+#else
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Bind a socket to a particular network interface
  * @param[in] socket Handle to a socket
@@ -787,10 +829,19 @@ error_t socketBind(Socket *socket, const IpAddr *localIpAddr,
       return ERROR_INVALID_SOCKET;
    }
 
+   //Get exclusive access
+   osAcquireMutex(&netMutex);
+
    //Associate the specified IP address and port number
    socket->localIpAddr = *localIpAddr;
    socket->localPort = localPort;
 
+   //Move the socket to the relevant hash bucket
+   socketUpdateHash(socket);
+
+   //Release exclusive access
+   osReleaseMutex(&netMutex);
+
    //No error to report
    return NO_ERROR;
 }
@@ -832,9 +883,19 @@ error_t socketConnect(Socket *socket, const IpAddr *remoteIpAddr,
    //Connectionless socket?
    if(socket->type == SOCKET_TYPE_DGRAM)
    {
+      //Get exclusive access
+      osAcquireMutex(&netMutex);
+
       //Save port number and IP address of the remote host
       socket->remoteIpAddr = *remoteIpAddr;
       socket->remotePort = remotePort;
+
+      //Move the socket to the relevant hash bucket
+      socketUpdateHash(socket);
+
+      //Release exclusive access
+      osReleaseMutex(&netMutex);
+
       //No error to report
       error = NO_ERROR;
    }
@@ -1565,6 +1626,8 @@ void socketClose(Socket *socket)
 
       //Mark the socket as closed
       socket->type = SOCKET_TYPE_UNUSED;
+      //Remove the socket from the hash tables
+      socketRemoveHash(socket);
    }
 #endif
 
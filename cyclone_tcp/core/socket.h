@@ -37,6 +37,8 @@ struct _Socket;
 #include "core/ethernet.h"
 #include "core/ip.h"
 #include "core/tcp.h"
+#include "core/tcp_cubic.h"
+#include "core/tcp_bbr.h"
 
 //Number of sockets that can be opened simultaneously
 #ifndef SOCKET_MAX_COUNT
@@ -45,6 +47,13 @@ struct _Socket;
    #error SOCKET_MAX_COUNT parameter is not valid
 #endif
 
+//Size of the hash tables used to demultiplex incoming packets
+#ifndef SOCKET_HASH_TABLE_SIZE
+   #define SOCKET_HASH_TABLE_SIZE SOCKET_MAX_COUNT
+#elif (SOCKET_HASH_TABLE_SIZE < 1)
+   #error SOCKET_HASH_TABLE_SIZE parameter is not valid
+#endif
+
 //Maximum number of multicast groups joined
 #ifndef SOCKET_MAX_MULTICAST_GROUPS
    #define SOCKET_MAX_MULTICAST_GROUPS 1
@@ -300,6 +309,8 @@ struct _Socket
    int8_t vmanDei;                ///<Drop eligible indicator
 #endif
    int_t errnoCode;
+   Socket *hashNext;              ///<Next socket in the same hash bucket
+   Socket **hashBucket;           ///<Hash bucket the socket is linked into
    OsEvent event;
    uint_t eventMask;
    uint_t eventFlags;
@@ -320,15 +331,30 @@ struct _Socket
 
    uint32_t sndUna;               ///<Data that have been sent but not yet acknowledged
    uint32_t sndNxt;               ///<Sequence number of the next byte to be sent
-   uint16_t sndUser;              ///<Amount of data buffered but not yet sent
-   uint16_t sndWnd;               ///<Size of the send window
-   uint16_t maxSndWnd;            ///<Maximum send window it has seen so far on the connection
+   uint32_t sndUser;              ///<Amount of data buffered but not yet sent
+   uint32_t sndWnd;               ///<Size of the send window
+   uint32_t maxSndWnd;            ///<Maximum send window it has seen so far on the connection
    uint32_t sndWl1;               ///<Segment sequence number used for last window update
    uint32_t sndWl2;               ///<Segment acknowledgment number used for last window update
 
    uint32_t rcvNxt;               ///<Receive next sequence number
-   uint16_t rcvUser;              ///<Number of data received but not yet consumed
-   uint16_t rcvWnd;               ///<Receive window
+   uint32_t rcvUser;              ///<Number of data received but not yet consumed
+   uint32_t rcvWnd;               ///<Receive window
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   bool_t wndScaleEnabled;        ///<Window Scale option received
+   uint8_t sndWndShift;           ///<Shift count applied to the window advertised by the peer
+   uint8_t rcvWndShift;           ///<Shift count applied to the window we advertise
+#endif
+
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   bool_t tsEnabled;              ///<Timestamps option received
+   uint32_t tsOffset;             ///<Random offset added to the timestamp clock
+   uint32_t tsRecent;             ///<Timestamp value to be echoed in the next segment
+   systime_t tsRecentTime;        ///<Time at which TS.Recent was last updated
+   uint32_t tsRttNext;            ///<Oldest TSval whose echo provides the next RTT sample
+   uint32_t lastAckSent;          ///<Acknowledgment number of the last segment sent
+#endif
 
    bool_t rttBusy;                ///<RTT measurement is being performed
    uint32_t rttSeqNum;            ///<Sequence number identifying a TCP segment
@@ -338,12 +364,35 @@ struct _Socket
    systime_t rto;                 ///<Retransmission timeout
 
 #if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   const TcpCongestionAlgo *congestAlgo; ///<Congestion control algorithm
    TcpCongestState congestState;  ///<Congestion state
-   uint16_t cwnd;                 ///<Congestion window
-   uint16_t ssthresh;             ///<Slow start threshold
+   uint32_t cwnd;                 ///<Congestion window
+   uint32_t ssthresh;             ///<Slow start threshold
    uint_t dupAckCount;            ///<Number of consecutive duplicate ACKs
    uint_t n;                      ///<Number of bytes acknowledged during the whole round-trip
    uint32_t recover;              ///<NewReno modification to TCP's fast recovery algorithm
+
+   uint32_t delivered;            ///<Number of bytes delivered so far
+   systime_t deliveredTime;       ///<Time at which the delivered count was last updated
+   systime_t firstSentTime;       ///<Send time of the first segment of the current flight
+   uint32_t appLimited;           ///<End of the application-limited phase (0 if none)
+   TcpRateSample rateSample;      ///<Delivery rate sample being collected
+
+   uint32_t pacingCredit;         ///<Number of bytes that can be sent by the pacer
+   systime_t pacingTime;          ///<Time at which the pacing credit was last updated
+   NetTimer pacingTimer;          ///<Pacing timer
+
+#if (TCP_CUBIC_SUPPORT == ENABLED || TCP_BBR_SUPPORT == ENABLED)
+   union
+   {
+#if (TCP_CUBIC_SUPPORT == ENABLED)
+      TcpCubicContext cubic;
+#endif
+#if (TCP_BBR_SUPPORT == ENABLED)
+      TcpBbrContext bbr;
+#endif
+   } congestContext;              ///<Private state of the congestion control algorithm
+#endif
 #endif
 
 #if (TCP_KEEP_ALIVE_SUPPORT == ENABLED)
@@ -407,6 +456,8 @@ extern const SocketMsg SOCKET_DEFAULT_MSG;
 
 //Global variables
 extern Socket socketTable[SOCKET_MAX_COUNT];
+extern Socket *socketConnHashTable[SOCKET_HASH_TABLE_SIZE];
+extern Socket *socketBindHashTable[SOCKET_HASH_TABLE_SIZE];
 
 //Socket related functions
 error_t socketInit(void);
@@ -439,6 +490,9 @@ error_t socketSetMaxSegmentSize(Socket *socket, size_t mss);
 error_t socketSetTxBufferSize(Socket *socket, size_t size);
 error_t socketSetRxBufferSize(Socket *socket, size_t size);
 
+error_t socketSetCongestionControl(Socket *socket,
+   const TcpCongestionAlgo *algo);
+
 error_t socketSetInterface(Socket *socket, NetInterface *interface);
 NetInterface *socketGetInterface(Socket *socket);
 
@@ -127,6 +127,9 @@ Socket *socketAllocate(uint_t type, uint_t protocol)
       //Check whether the current entry is free
       if(socket != NULL)
       {
+         //Remove the socket from the hash tables before clearing its links
+         socketRemoveHash(socket);
+
          //Save socket descriptor
          i = socket->descriptor;
 
@@ -174,6 +177,14 @@ Socket *socketAllocate(uint_t type, uint_t protocol)
          socket->txBufferSize = MIN(TCP_DEFAULT_TX_BUFFER_SIZE, TCP_MAX_TX_BUFFER_SIZE);
          socket->rxBufferSize = MIN(TCP_DEFAULT_RX_BUFFER_SIZE, TCP_MAX_RX_BUFFER_SIZE);
 #endif
+
+#if (TCP_SUPPORT == ENABLED && TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+         //Default congestion control algorithm
+         socket->congestAlgo = TCP_DEFAULT_CONGEST_ALGO;
+#endif
+
+         //Insert the socket into the relevant hash table
+         socketUpdateHash(socket);
       }
    }
 
@@ -182,6 +193,199 @@ Socket *socketAllocate(uint_t type, uint_t protocol)
 }
 
 
+/**
+ * @brief Update the position of a socket in the hash tables
+ *
+ * This function must be called whenever the type, the protocol, the local
+ * port, the remote address, the remote port or the LISTEN state of a socket
+ * changes
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void socketUpdateHash(Socket *socket)
+{
+   bool_t connected;
+   uint_t index;
+
+   //Remove the socket from its current hash bucket, if any
+   socketRemoveHash(socket);
+
+#if (RAW_SOCKET_SUPPORT == ENABLED)
+   //Raw sockets are demultiplexed using the protocol value they are bound to
+   if(socket->type == SOCKET_TYPE_RAW_IP || socket->type == SOCKET_TYPE_RAW_ETH)
+   {
+      //The hash key is made of the protocol value (IP protocol number or
+      //EtherType) in place of the local port
+      index = socketComputeBindHash(socket->type, (uint16_t) socket->protocol);
+
+      //Insert the socket at the head of the relevant hash bucket
+      socket->hashBucket = &socketBindHashTable[index];
+      socket->hashNext = *socket->hashBucket;
+      *socket->hashBucket = socket;
+
+      //Raw sockets are not bound to any port
+      return;
+   }
+#endif
+
+   //Only TCP and UDP sockets are demultiplexed using the hash tables
+   if(socket->type != SOCKET_TYPE_STREAM && socket->type != SOCKET_TYPE_DGRAM)
+      return;
+
+   //Sockets that are not bound to a port cannot receive any packet
+   if(socket->localPort == 0)
+      return;
+
+   //A socket is considered as connected when both the remote address and
+   //the remote port are specified
+   if(socket->remotePort != 0 && socket->remoteIpAddr.length != 0 &&
+      !ipIsUnspecifiedAddr(&socket->remoteIpAddr))
+   {
+      connected = TRUE;
+   }
+   else
+   {
+      connected = FALSE;
+   }
+
+#if (TCP_SUPPORT == ENABLED)
+   //A socket in the LISTEN state accepts segments from any remote host
+   if(socket->type == SOCKET_TYPE_STREAM &&
+      socket->state == TCP_STATE_LISTEN)
+   {
+      connected = FALSE;
+   }
+#endif
+
+   //Connected socket?
+   if(connected)
+   {
+      //The hash key is made of the local port and the remote endpoint
+      index = socketComputeConnHash(socket->type, socket->localPort,
+         &socket->remoteIpAddr, socket->remotePort);
+
+      //Point to the relevant hash bucket
+      socket->hashBucket = &socketConnHashTable[index];
+   }
+   else
+   {
+      //The hash key is made of the local port only
+      index = socketComputeBindHash(socket->type, socket->localPort);
+
+      //Point to the relevant hash bucket
+      socket->hashBucket = &socketBindHashTable[index];
+   }
+
+   //Insert the socket at the head of the bucket
+   socket->hashNext = *socket->hashBucket;
+   *socket->hashBucket = socket;
+}
+
+
+/**
+ * @brief Remove a socket from the hash tables
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void socketRemoveHash(Socket *socket)
+{
+   Socket **p;
+
+   //Make sure the socket is linked into a hash bucket
+   if(socket->hashBucket != NULL)
+   {
+      //Search the bucket for the link pointing to the socket
+      for(p = socket->hashBucket; *p != NULL; p = &(*p)->hashNext)
+      {
+         //Matching entry?
+         if(*p == socket)
+         {
+            //Unlink the socket
+            *p = socket->hashNext;
+            break;
+         }
+      }
+
+      //The socket is no longer part of the hash tables
+      socket->hashNext = NULL;
+      socket->hashBucket = NULL;
+   }
+}
+
+
+/**
+ * @brief Compute the hash key of a connected socket
+ * @param[in] type Socket type
+ * @param[in] localPort Local port number
+ * @param[in] remoteIpAddr Remote IP address
+ * @param[in] remotePort Remote port number
+ * @return Index of the hash bucket
+ **/
+
+uint_t socketComputeConnHash(uint_t type, uint16_t localPort,
+   const IpAddr *remoteIpAddr, uint16_t remotePort)
+{
+   uint32_t h;
+
+   //Combine the socket type and the port numbers
+   h = ((uint32_t) localPort << 16) | remotePort;
+   h ^= type;
+
+#if (IPV4_SUPPORT == ENABLED)
+   //IPv4 remote address?
+   if(remoteIpAddr->length == sizeof(Ipv4Addr))
+   {
+      h ^= remoteIpAddr->ipv4Addr;
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //IPv6 remote address?
+   if(remoteIpAddr->length == sizeof(Ipv6Addr))
+   {
+      h ^= remoteIpAddr->ipv6Addr.dw[0] ^ remoteIpAddr->ipv6Addr.dw[1] ^
+         remoteIpAddr->ipv6Addr.dw[2] ^ remoteIpAddr->ipv6Addr.dw[3];
+   }
+   else
+#endif
+   //Invalid IP address?
+   {
+      //The remote address does not contribute to the hash key
+   }
+
+   //Multiplicative hashing spreads the bits of the key over the upper
+   //half of the result
+   h *= 0x9E3779B1;
+
+   //Return the index of the hash bucket
+   return (h >> 16) % SOCKET_HASH_TABLE_SIZE;
+}
+
+
+/**
+ * @brief Compute the hash key of a socket that is bound to a local port
+ * @param[in] type Socket type
+ * @param[in] localPort Local port number
+ * @return Index of the hash bucket
+ **/
+
+uint_t socketComputeBindHash(uint_t type, uint16_t localPort)
+{
+   uint32_t h;
+
+   //Combine the socket type and the local port number
+   h = ((uint32_t) localPort << 16) | type;
+
+   //Multiplicative hashing spreads the bits of the key over the upper
+   //half of the result
+   h *= 0x9E3779B1;
+
+   //Return the index of the hash bucket
+   return (h >> 16) % SOCKET_HASH_TABLE_SIZE;
+}
+
+
 /**
  * @brief Subscribe to the specified socket events
  * @param[in] socket Handle that identifies a socket
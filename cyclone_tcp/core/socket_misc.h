@@ -40,6 +40,14 @@ extern "C" {
 //Socket related functions
 Socket *socketAllocate(uint_t type, uint_t protocol);
 
+void socketUpdateHash(Socket *socket);
+void socketRemoveHash(Socket *socket);
+
+uint_t socketComputeConnHash(uint_t type, uint16_t localPort,
+   const IpAddr *remoteIpAddr, uint16_t remotePort);
+
+uint_t socketComputeBindHash(uint_t type, uint16_t localPort);
+
 void socketRegisterEvents(Socket *socket, OsEvent *event, uint_t eventMask);
 void socketUnregisterEvents(Socket *socket);
 uint_t socketGetEvents(Socket *socket);
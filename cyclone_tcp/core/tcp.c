@@ -45,6 +45,11 @@
 //Tick counter to handle periodic operations
 systime_t tcpTickCounter;
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+//Earliest deadline among the pacing timers of all sockets
+NetTimer tcpPacingTimer;
+#endif
+
 //Ephemeral ports are used for dynamic port assignment
 static uint16_t tcpDynamicPort;
 
@@ -59,6 +64,11 @@ error_t tcpInit(void)
    //Reset ephemeral port number
    tcpDynamicPort = 0;
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //No transmission is held back by the pacer
+   netStopTimer(&tcpPacingTimer);
+#endif
+
    //Successful initialization
    return NO_ERROR;
 }
@@ -167,6 +177,9 @@ error_t tcpConnect(Socket *socket, const IpAddr *remoteIpAddr,
       socket->remoteIpAddr = *remoteIpAddr;
       socket->remotePort = remotePort;
 
+      //Move the socket to the relevant hash bucket
+      socketUpdateHash(socket);
+
       //Unspecified source address?
       if(ipIsUnspecifiedAddr(&socket->localIpAddr))
       {
@@ -225,18 +238,27 @@ error_t tcpConnect(Socket *socket, const IpAddr *remoteIpAddr,
       socket->rcvUser = 0;
       socket->rcvWnd = socket->rxBufferSize;
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+      //Select the shift count to be advertised in the SYN segment
+      socket->wndScaleEnabled = FALSE;
+      socket->sndWndShift = 0;
+      socket->rcvWndShift = tcpComputeWindowShift(socket->rxBufferSize);
+#endif
+
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+      //Initialize the timestamp clock of the connection
+      socket->tsEnabled = FALSE;
+      socket->tsOffset = netGenerateRand();
+      socket->tsRecent = 0;
+      socket->tsRttNext = tcpGetTimestamp(socket);
+#endif
+
       //Set initial retransmission timeout
       socket->rto = socket->interface->initialRto;
 
 #if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
-      //Default congestion state
-      socket->congestState = TCP_CONGEST_STATE_IDLE;
-      //Initial congestion window
-      socket->cwnd = MIN(TCP_INITIAL_WINDOW * socket->smss, socket->txBufferSize);
-      //Slow start threshold should be set arbitrarily high
-      socket->ssthresh = UINT16_MAX;
-      //Recover is set to the initial send sequence number
-      socket->recover = socket->iss;
+      //Initialize congestion control
+      tcpInitCongestControl(socket);
 #endif
 
       //Send a SYN segment
@@ -301,6 +323,8 @@ error_t tcpListen(Socket *socket, uint_t backlog)
 
    //Place the socket in the listening state
    tcpChangeState(socket, TCP_STATE_LISTEN);
+   //Move the socket to the relevant hash bucket
+   socketUpdateHash(socket);
 
    //Successful processing
    return NO_ERROR;
@@ -422,6 +446,9 @@ Socket *tcpAccept(Socket *socket, IpAddr *clientIpAddr, uint16_t *clientPort)
             newSocket->remoteIpAddr = queueItem->srcAddr;
             newSocket->remotePort = queueItem->srcPort;
 
+            //Move the socket to the relevant hash bucket
+            socketUpdateHash(newSocket);
+
             //The SMSS is the size of the largest segment that the sender can
             //transmit
             newSocket->smss = queueItem->mss;
@@ -447,17 +474,11 @@ Socket *tcpAccept(Socket *socket, IpAddr *clientIpAddr, uint16_t *clientPort)
             newSocket->rto = newSocket->interface->initialRto;
 
 #if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
-            //Default congestion state
-            newSocket->congestState = TCP_CONGEST_STATE_IDLE;
-
-            //Initial congestion window
-            newSocket->cwnd = MIN(TCP_INITIAL_WINDOW * newSocket->smss,
-               newSocket->txBufferSize);
-
-            //Slow start threshold should be set arbitrarily high
-            newSocket->ssthresh = UINT16_MAX;
-            //Recover is set to the initial send sequence number
-            newSocket->recover = newSocket->iss;
+            //The connection inherits the congestion control algorithm of
+            //the listening socket
+            newSocket->congestAlgo = socket->congestAlgo;
+            //Initialize congestion control
+            tcpInitCongestControl(newSocket);
 #endif
 
 #if (TCP_SACK_SUPPORT == ENABLED)
@@ -466,6 +487,34 @@ Socket *tcpAccept(Socket *socket, IpAddr *clientIpAddr, uint16_t *clientPort)
             //is established
             newSocket->sackPermitted = queueItem->sackPermitted;
 #endif
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+            //Window scaling is enabled only if the Window Scale option was
+            //received in the SYN segment
+            newSocket->wndScaleEnabled = queueItem->wndScaleEnabled;
+            newSocket->sndWndShift = queueItem->wndShift;
+
+            //Select the shift count to be advertised in the SYN ACK segment
+            if(newSocket->wndScaleEnabled)
+            {
+               newSocket->rcvWndShift = tcpComputeWindowShift(
+                  newSocket->rxBufferSize);
+            }
+            else
+            {
+               newSocket->rcvWndShift = 0;
+            }
+#endif
+
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+            //The Timestamps option is used only if it was received in the
+            //SYN segment
+            newSocket->tsEnabled = queueItem->tsEnabled;
+            newSocket->tsOffset = netGenerateRand();
+            newSocket->tsRecent = queueItem->tsVal;
+            newSocket->tsRecentTime = osGetSystemTime();
+            newSocket->tsRttNext = tcpGetTimestamp(newSocket);
+#endif
             //The connection state should be changed to SYN-RECEIVED
             tcpChangeState(newSocket, TCP_STATE_SYN_RECEIVED);
 
@@ -973,6 +1022,8 @@ error_t tcpAbort(Socket *socket)
       tcpDeleteControlBlock(socket);
       //Mark the socket as closed
       socket->type = SOCKET_TYPE_UNUSED;
+      //Remove the socket from the hash tables
+      socketRemoveHash(socket);
       //Return status code
       return error;
 
@@ -991,6 +1042,8 @@ error_t tcpAbort(Socket *socket)
       tcpDeleteControlBlock(socket);
       //Mark the socket as closed
       socket->type = SOCKET_TYPE_UNUSED;
+      //Remove the socket from the hash tables
+      socketRemoveHash(socket);
       //No error to report
       return NO_ERROR;
 #endif
@@ -1003,6 +1056,8 @@ error_t tcpAbort(Socket *socket)
       tcpDeleteControlBlock(socket);
       //Mark the socket as closed
       socket->type = SOCKET_TYPE_UNUSED;
+      //Remove the socket from the hash tables
+      socketRemoveHash(socket);
       //No error to report
       return NO_ERROR;
    }
@@ -1089,6 +1144,8 @@ Socket *tcpKillOldestConnection(void)
       tcpDeleteControlBlock(oldestSocket);
       //Mark the socket as closed
       oldestSocket->type = SOCKET_TYPE_UNUSED;
+      //Remove the socket from the hash tables
+      socketRemoveHash(oldestSocket);
    }
 
    //The oldest connection in the TIME-WAIT state can be reused
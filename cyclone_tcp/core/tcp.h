@@ -60,6 +60,20 @@
    #error TCP_MIN_MSS parameter is not valid
 #endif
 
+//Window scale option support
+#ifndef TCP_WINDOW_SCALE_SUPPORT
+   #define TCP_WINDOW_SCALE_SUPPORT DISABLED
+#elif (TCP_WINDOW_SCALE_SUPPORT != ENABLED && TCP_WINDOW_SCALE_SUPPORT != DISABLED)
+   #error TCP_WINDOW_SCALE_SUPPORT parameter is not valid
+#endif
+
+//Timestamps option support
+#ifndef TCP_TIMESTAMPS_SUPPORT
+   #define TCP_TIMESTAMPS_SUPPORT DISABLED
+#elif (TCP_TIMESTAMPS_SUPPORT != ENABLED && TCP_TIMESTAMPS_SUPPORT != DISABLED)
+   #error TCP_TIMESTAMPS_SUPPORT parameter is not valid
+#endif
+
 //Default buffer size for transmission
 #ifndef TCP_DEFAULT_TX_BUFFER_SIZE
    #define TCP_DEFAULT_TX_BUFFER_SIZE 2860
@@ -86,6 +100,8 @@
    #define TCP_MAX_RX_BUFFER_SIZE 22880
 #elif (TCP_MAX_RX_BUFFER_SIZE < 536)
    #error TCP_MAX_RX_BUFFER_SIZE parameter is not valid
+#elif (TCP_MAX_RX_BUFFER_SIZE > 65535 && TCP_WINDOW_SCALE_SUPPORT == DISABLED)
+   #error TCP_MAX_RX_BUFFER_SIZE parameter is not valid
 #endif
 
 //Default SYN queue size for listening sockets
@@ -144,6 +160,20 @@
    #error TCP_CONGEST_CONTROL_SUPPORT parameter is not valid
 #endif
 
+//CUBIC congestion control algorithm
+#ifndef TCP_CUBIC_SUPPORT
+   #define TCP_CUBIC_SUPPORT DISABLED
+#elif (TCP_CUBIC_SUPPORT != ENABLED && TCP_CUBIC_SUPPORT != DISABLED)
+   #error TCP_CUBIC_SUPPORT parameter is not valid
+#endif
+
+//BBR congestion control algorithm
+#ifndef TCP_BBR_SUPPORT
+   #define TCP_BBR_SUPPORT DISABLED
+#elif (TCP_BBR_SUPPORT != ENABLED && TCP_BBR_SUPPORT != DISABLED)
+   #error TCP_BBR_SUPPORT parameter is not valid
+#endif
+
 //Number of duplicate ACKs that triggers fast retransmit algorithm
 #ifndef TCP_FAST_RETRANSMIT_THRES
    #define TCP_FAST_RETRANSMIT_THRES 3
@@ -165,6 +195,18 @@
    #error TCP_LOSS_WINDOW parameter is not valid
 #endif
 
+//Default congestion control algorithm
+#ifndef TCP_DEFAULT_CONGEST_ALGO
+   #define TCP_DEFAULT_CONGEST_ALGO TCP_NEWRENO_ALGO
+#endif
+
+//Maximum burst allowed by the pacer (in ms of transmission)
+#ifndef TCP_PACING_MAX_BURST
+   #define TCP_PACING_MAX_BURST 10
+#elif (TCP_PACING_MAX_BURST < 1)
+   #error TCP_PACING_MAX_BURST parameter is not valid
+#endif
+
 //Default interval between successive window probes
 #ifndef TCP_DEFAULT_PROBE_INTERVAL
    #define TCP_DEFAULT_PROBE_INTERVAL 1000
@@ -246,10 +288,17 @@
 #define TCP_MAX_HEADER_LENGTH 60
 //Default maximum segment size
 #define TCP_DEFAULT_MSS 536
+//Maximum window scale factor
+#define TCP_MAX_WINDOW_SHIFT 14
+//Age after which TS.Recent is considered invalid (24 days)
+#define TCP_PAWS_IDLE_TIMEOUT 2073600000
 
 //Sequence number comparison macro
 #define TCP_CMP_SEQ(a, b) ((int32_t) ((a) - (b)))
 
+//NewReno congestion control algorithm
+#define TCP_NEWRENO_ALGO (&tcpNewRenoAlgo)
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -288,6 +337,50 @@ typedef enum
 } TcpCongestState;
 
 
+/**
+ * @brief Delivery rate sample
+ **/
+
+typedef struct
+{
+   bool_t valid;            ///<The sample covers at least one acknowledged segment
+   uint32_t acked;          ///<Number of bytes newly acknowledged
+   bool_t roundTrip;        ///<A full window of data has been acknowledged
+   uint32_t priorDelivered; ///<Delivered count when the newest acknowledged segment was sent
+   systime_t sendElapsed;   ///<Send phase of the sampling interval
+   systime_t ackElapsed;    ///<ACK phase of the sampling interval
+   uint32_t delivered;      ///<Number of bytes delivered over the sampling interval
+   systime_t interval;      ///<Duration of the sampling interval
+   systime_t rtt;           ///<Round-trip time of the newest acknowledged segment
+   bool_t appLimited;       ///<The sample was taken while the sender was application-limited
+} TcpRateSample;
+
+
+//Congestion control related functions
+typedef void (*TcpCongestInit)(Socket *socket);
+typedef void (*TcpCongestOnAck)(Socket *socket, const TcpRateSample *rs);
+typedef void (*TcpCongestOnLoss)(Socket *socket);
+typedef void (*TcpCongestOnRto)(Socket *socket);
+typedef void (*TcpCongestOnRecovery)(Socket *socket, uint_t n);
+typedef uint32_t (*TcpCongestGetPacingRate)(Socket *socket);
+
+
+/**
+ * @brief Congestion control algorithm
+ **/
+
+typedef struct
+{
+   const char_t *name;
+   TcpCongestInit init;
+   TcpCongestOnAck onAck;
+   TcpCongestOnLoss onLoss;
+   TcpCongestOnRto onRto;
+   TcpCongestOnRecovery onRecovery;
+   TcpCongestGetPacingRate getPacingRate;
+} TcpCongestionAlgo;
+
+
 /**
  * @brief TCP control flags
  **/
@@ -384,6 +477,13 @@ typedef struct _TcpQueueItem
    struct _TcpQueueItem *next;
    uint_t length;
    uint_t sacked;
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   uint32_t delivered;
+   systime_t deliveredTime;
+   systime_t firstSentTime;
+   systime_t sentTime;
+   bool_t appLimited;
+#endif
    IpPseudoHeader pseudoHeader;
    uint8_t header[TCP_MAX_HEADER_LENGTH];
 } TcpQueueItem;
@@ -405,6 +505,14 @@ typedef struct _TcpSynQueueItem
 #if (TCP_SACK_SUPPORT == ENABLED)
    bool_t sackPermitted;
 #endif
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   bool_t wndScaleEnabled;
+   uint8_t wndShift;
+#endif
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   bool_t tsEnabled;
+   uint32_t tsVal;
+#endif
 } TcpSynQueueItem;
 
 
@@ -446,6 +554,14 @@ typedef struct
 //Tick counter to handle periodic operations
 extern systime_t tcpTickCounter;
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+//Earliest deadline among the pacing timers of all sockets
+extern NetTimer tcpPacingTimer;
+#endif
+
+//NewReno congestion control algorithm
+extern const TcpCongestionAlgo tcpNewRenoAlgo;
+
 //TCP related functions
 error_t tcpInit(void);
 
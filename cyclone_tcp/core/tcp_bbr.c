@@ -0,0 +1,759 @@
+/**
+ * @file tcp_bbr.c
+ * @brief BBR congestion control algorithm (version 1)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * BBR builds a model of the path from the delivery rate and round-trip time
+ * samples, and paces the transmission at the estimated bottleneck bandwidth
+ * rather than reacting to packet loss. Refer to the following IETF draft for
+ * more details: draft-cardwell-iccrg-bbr-congestion-control-00
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL TCP_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_misc.h"
+#include "core/tcp_bbr.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (TCP_SUPPORT == ENABLED && TCP_CONGEST_CONTROL_SUPPORT == ENABLED && \
+   TCP_BBR_SUPPORT == ENABLED)
+
+//Pacing gain cycle used in PROBE_BW mode
+static const uint_t tcpBbrPacingGainCycle[TCP_BBR_GAIN_CYCLE_LEN] =
+{
+   TCP_BBR_UNIT * 5 / 4,
+   TCP_BBR_UNIT * 3 / 4,
+   TCP_BBR_UNIT,
+   TCP_BBR_UNIT,
+   TCP_BBR_UNIT,
+   TCP_BBR_UNIT,
+   TCP_BBR_UNIT,
+   TCP_BBR_UNIT
+};
+
+//BBR congestion control algorithm
+const TcpCongestionAlgo tcpBbrAlgo =
+{
+   "BBR",
+   tcpBbrInit,
+   tcpBbrOnAck,
+   tcpBbrOnLoss,
+   tcpBbrOnRto,
+   tcpBbrOnRecovery,
+   tcpBbrGetPacingRate
+};
+
+
+/**
+ * @brief BBR initialization
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrInit(Socket *socket)
+{
+   systime_t time;
+   systime_t rtt;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Clear the model of the path
+   osMemset(context, 0, sizeof(TcpBbrContext));
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //The round-trip propagation time is unknown
+   context->rtPropStamp = time;
+   context->cycleStamp = time;
+
+   //BBR starts in STARTUP mode
+   context->mode = TCP_BBR_MODE_STARTUP;
+   context->pacingGain = TCP_BBR_HIGH_GAIN;
+   context->cwndGain = TCP_BBR_HIGH_GAIN;
+
+   //Until a bandwidth sample is available, the pacing rate is derived from
+   //the initial window and the smoothed RTT (or 1 ms if none)
+   rtt = MAX(socket->srtt, 1);
+
+   context->pacingRate = (uint32_t) ((uint64_t) socket->cwnd * 1000 *
+      TCP_BBR_HIGH_GAIN / TCP_BBR_UNIT / rtt);
+}
+
+
+/**
+ * @brief BBR processing of an ACK that acknowledges new data
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpBbrOnAck(Socket *socket, const TcpRateSample *rs)
+{
+   //Update the model of the path
+   tcpBbrUpdateRound(socket, rs);
+   tcpBbrUpdateBtlBw(socket, rs);
+   tcpBbrCheckCyclePhase(socket);
+   tcpBbrCheckFullPipe(socket, rs);
+   tcpBbrCheckDrain(socket);
+   tcpBbrUpdateRtProp(socket, rs);
+   tcpBbrCheckProbeRtt(socket);
+
+   //Update the control parameters
+   tcpBbrSetPacingRate(socket);
+   tcpBbrSetCwnd(socket, rs);
+}
+
+
+/**
+ * @brief BBR processing of a loss detected by duplicate ACKs
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrOnLoss(Socket *socket)
+{
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //BBR does not treat packet loss as a congestion signal. The current
+   //window is restored once the loss has been repaired
+   tcpBbrSaveCwnd(socket);
+   context->lossRecovery = TRUE;
+
+   //Packet conservation only applies to the first round trip of fast
+   //recovery
+   context->packetConservation = TRUE;
+   context->recoveryRound = context->roundCount;
+
+   //Keep the slow start threshold out of the way of the model
+   socket->ssthresh = MAX(socket->cwnd, 2 * socket->smss);
+}
+
+
+/**
+ * @brief BBR processing of a retransmission timeout
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrOnRto(Socket *socket)
+{
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Save the current window so that it can be restored once the loss has
+   //been repaired
+   tcpBbrSaveCwnd(socket);
+   context->lossRecovery = TRUE;
+
+   //Keep the slow start threshold out of the way of the model
+   socket->ssthresh = MAX(socket->cwnd, 2 * socket->smss);
+}
+
+
+/**
+ * @brief BBR processing of an ACK received during fast recovery
+ *
+ * BBR bypasses the window handling of RFC 6582. Upon entering fast recovery,
+ * the window is set to the amount of data in flight. During the first round
+ * trip, every ACK then releases the amount of data it reports as delivered,
+ * that is one segment for a duplicate ACK. The model drives the window for
+ * the rest of the recovery
+ *
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] n Number of bytes acknowledged by the incoming ACK
+ **/
+
+void tcpBbrOnRecovery(Socket *socket, uint_t n)
+{
+   uint32_t inflight;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Amount of data sent but not yet acknowledged
+   inflight = socket->sndNxt - socket->sndUna;
+
+   //A duplicate ACK reports a segment that has left the network
+   if(n == 0)
+   {
+      n = socket->smss;
+   }
+
+   //Entering fast recovery?
+   if(socket->congestState != TCP_CONGEST_STATE_RECOVERY)
+   {
+      socket->cwnd = inflight + n;
+   }
+   else if(context->packetConservation)
+   {
+      socket->cwnd = MAX(socket->cwnd, inflight + n);
+   }
+
+   //Enforce the minimum window
+   socket->cwnd = MAX(socket->cwnd, TCP_BBR_MIN_CWND * socket->smss);
+}
+
+
+/**
+ * @brief Get the pacing rate
+ * @param[in] socket Handle referencing the current socket
+ * @return Pacing rate, in bytes per second
+ **/
+
+uint32_t tcpBbrGetPacingRate(Socket *socket)
+{
+   //Return the current pacing rate
+   return socket->congestContext.bbr.pacingRate;
+}
+
+
+/**
+ * @brief Track round trips
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpBbrUpdateRound(Socket *socket, const TcpRateSample *rs)
+{
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //A round trip ends when a segment sent after the beginning of the round
+   //trip is acknowledged
+   if(rs->valid && TCP_CMP_SEQ(rs->priorDelivered,
+      context->nextRoundDelivered) >= 0)
+   {
+      context->nextRoundDelivered = socket->delivered;
+      context->roundCount++;
+      context->roundStart = TRUE;
+   }
+   else
+   {
+      context->roundStart = FALSE;
+   }
+}
+
+
+/**
+ * @brief Update the bottleneck bandwidth estimate
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpBbrUpdateBtlBw(Socket *socket, const TcpRateSample *rs)
+{
+   uint_t i;
+   uint32_t bw;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Discard samples that do not carry any rate information
+   if(!rs->valid || rs->delivered == 0 || rs->interval == 0)
+      return;
+
+   //Samples taken over less than a round trip are not reliable, as ACKs
+   //may have been compressed on the reverse path
+   if(context->rtPropValid && rs->interval < context->rtProp)
+      return;
+
+   //Compute the delivery rate, in bytes per second
+   bw = (uint32_t) MIN((uint64_t) rs->delivered * 1000 / rs->interval,
+      UINT32_MAX);
+
+   //Application-limited samples underestimate the bandwidth, hence they are
+   //only used when they exceed the current estimate
+   if(rs->appLimited && bw < context->btlBw)
+      return;
+
+   //Each entry of the filter holds the maximum rate of one round trip
+   i = context->roundCount % TCP_BBR_BW_FILTER_LEN;
+
+   //First sample of the round trip?
+   if(context->bwRound[i] != context->roundCount)
+   {
+      context->bwFilter[i] = 0;
+      context->bwRound[i] = context->roundCount;
+   }
+
+   //Update the current entry
+   context->bwFilter[i] = MAX(context->bwFilter[i], bw);
+
+   //The bottleneck bandwidth is the maximum rate measured over the last
+   //round trips
+   context->btlBw = 0;
+
+   for(i = 0; i < TCP_BBR_BW_FILTER_LEN; i++)
+   {
+      //Discard the entries that are out of the window
+      if((context->roundCount - context->bwRound[i]) < TCP_BBR_BW_FILTER_LEN)
+      {
+         context->btlBw = MAX(context->btlBw, context->bwFilter[i]);
+      }
+   }
+}
+
+
+/**
+ * @brief Update the round-trip propagation time estimate
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpBbrUpdateRtProp(Socket *socket, const TcpRateSample *rs)
+{
+   systime_t time;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //The estimate expires when it has not been refreshed for a while
+   context->rtPropExpired = (timeCompare(time, context->rtPropStamp +
+      TCP_BBR_RTPROP_FILTER_LEN) > 0) ? TRUE : FALSE;
+
+   //The round-trip propagation time is the minimum RTT over the window
+   if(rs->valid && (!context->rtPropValid || rs->rtt <= context->rtProp ||
+      context->rtPropExpired))
+   {
+      context->rtProp = rs->rtt;
+      context->rtPropStamp = time;
+      context->rtPropValid = TRUE;
+   }
+}
+
+
+/**
+ * @brief Advance the pacing gain cycle
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrCheckCyclePhase(Socket *socket)
+{
+   bool_t next;
+   bool_t fullLength;
+   uint32_t inflight;
+   systime_t time;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //The pacing gain cycle is only used in PROBE_BW mode
+   if(context->mode != TCP_BBR_MODE_PROBE_BW)
+      return;
+
+   //Get current time
+   time = osGetSystemTime();
+   //Amount of data in flight
+   inflight = socket->sndNxt - socket->sndUna;
+
+   //Each phase normally lasts for one round-trip propagation time
+   fullLength = ((time - context->cycleStamp) > context->rtProp) ? TRUE : FALSE;
+
+   //Check current phase
+   if(context->pacingGain > TCP_BBR_UNIT)
+   {
+      //Probe for more bandwidth until the pipe holds the extra data, or a
+      //loss indicates that it is already full
+      next = fullLength && (inflight >= tcpBbrComputeInflight(socket,
+         context->pacingGain) || socket->congestState != TCP_CONGEST_STATE_IDLE);
+   }
+   else if(context->pacingGain < TCP_BBR_UNIT)
+   {
+      //Drain the queue created by the probing phase
+      next = fullLength || inflight <= tcpBbrComputeInflight(socket,
+         TCP_BBR_UNIT);
+   }
+   else
+   {
+      //Cruise at the estimated bandwidth
+      next = fullLength;
+   }
+
+   //Move to the next phase?
+   if(next)
+   {
+      context->cycleIndex = (context->cycleIndex + 1) % TCP_BBR_GAIN_CYCLE_LEN;
+      context->cycleStamp = time;
+      context->pacingGain = tcpBbrPacingGainCycle[context->cycleIndex];
+   }
+}
+
+
+/**
+ * @brief Detect when the bottleneck bandwidth has been reached
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpBbrCheckFullPipe(Socket *socket, const TcpRateSample *rs)
+{
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //The check is performed once per round trip
+   if(context->filledPipe || !context->roundStart || rs->appLimited)
+      return;
+
+   //Check whether the bandwidth estimate is still growing significantly
+   if(context->btlBw >= (uint64_t) context->fullBw * 5 / 4)
+   {
+      //Record the new baseline
+      context->fullBw = context->btlBw;
+      context->fullBwCount = 0;
+   }
+   else
+   {
+      //The pipe is considered full after three round trips without at least
+      //25% growth
+      context->fullBwCount++;
+
+      if(context->fullBwCount >= 3)
+      {
+         context->filledPipe = TRUE;
+      }
+   }
+}
+
+
+/**
+ * @brief Manage the STARTUP to DRAIN to PROBE_BW transitions
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrCheckDrain(Socket *socket)
+{
+   uint32_t inflight;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Leave STARTUP mode as soon as the pipe is full
+   if(context->mode == TCP_BBR_MODE_STARTUP && context->filledPipe)
+   {
+      //Drain the queue created during STARTUP mode
+      context->mode = TCP_BBR_MODE_DRAIN;
+      context->pacingGain = TCP_BBR_DRAIN_GAIN;
+      context->cwndGain = TCP_BBR_HIGH_GAIN;
+
+      //Debug message
+      TRACE_DEBUG("BBR: DRAIN (btlBw=%" PRIu32 " bytes/s, rtProp=%" PRIu32 " ms)\r\n",
+         context->btlBw, context->rtProp);
+   }
+
+   //Amount of data in flight
+   inflight = socket->sndNxt - socket->sndUna;
+
+   //The queue is drained once the data in flight matches the estimated BDP
+   if(context->mode == TCP_BBR_MODE_DRAIN &&
+      inflight <= tcpBbrComputeInflight(socket, TCP_BBR_UNIT))
+   {
+      tcpBbrEnterProbeBw(socket);
+   }
+}
+
+
+/**
+ * @brief Manage PROBE_RTT mode
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrCheckProbeRtt(Socket *socket)
+{
+   uint32_t inflight;
+   systime_t time;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Get current time
+   time = osGetSystemTime();
+   //Amount of data in flight
+   inflight = socket->sndNxt - socket->sndUna;
+
+   //Refresh the round-trip propagation time estimate when it has expired
+   if(context->mode != TCP_BBR_MODE_PROBE_RTT && context->rtPropExpired)
+   {
+      //Save the current window
+      tcpBbrSaveCwnd(socket);
+
+      //Enter PROBE_RTT mode
+      context->mode = TCP_BBR_MODE_PROBE_RTT;
+      context->pacingGain = TCP_BBR_UNIT;
+      context->cwndGain = TCP_BBR_UNIT;
+      context->probeRttDone = FALSE;
+
+      //Debug message
+      TRACE_DEBUG("BBR: PROBE_RTT\r\n");
+   }
+
+   //PROBE_RTT mode?
+   if(context->mode == TCP_BBR_MODE_PROBE_RTT)
+   {
+      //Wait for the data in flight to drop to the minimum window
+      if(!context->probeRttDone && inflight <= TCP_BBR_MIN_CWND * socket->smss)
+      {
+         //Stay in PROBE_RTT mode for at least one round trip and 200 ms
+         context->probeRttDoneStamp = time + TCP_BBR_PROBE_RTT_DURATION;
+         context->probeRttDone = TRUE;
+         context->probeRttRoundDone = FALSE;
+         context->nextRoundDelivered = socket->delivered;
+      }
+      else if(context->probeRttDone)
+      {
+         //A full round trip has elapsed?
+         if(context->roundStart)
+         {
+            context->probeRttRoundDone = TRUE;
+         }
+
+         //Exit PROBE_RTT mode?
+         if(context->probeRttRoundDone &&
+            timeCompare(time, context->probeRttDoneStamp) >= 0)
+         {
+            //The estimate has just been refreshed
+            context->rtPropStamp = time;
+            //Restore the window
+            socket->cwnd = MAX(socket->cwnd, context->priorCwnd);
+
+            //Resume normal operation
+            if(context->filledPipe)
+            {
+               tcpBbrEnterProbeBw(socket);
+            }
+            else
+            {
+               context->mode = TCP_BBR_MODE_STARTUP;
+               context->pacingGain = TCP_BBR_HIGH_GAIN;
+               context->cwndGain = TCP_BBR_HIGH_GAIN;
+            }
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Enter PROBE_BW mode
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrEnterProbeBw(Socket *socket)
+{
+   uint_t i;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Switch to PROBE_BW mode
+   context->mode = TCP_BBR_MODE_PROBE_BW;
+   context->cwndGain = TCP_BBR_CWND_GAIN;
+
+   //Start the gain cycle at a random phase, other than the draining phase,
+   //so that competing flows do not probe in lockstep
+   i = netGenerateRand() % (TCP_BBR_GAIN_CYCLE_LEN - 1);
+   context->cycleIndex = (i >= 1) ? i + 1 : i;
+
+   //Enter the first phase
+   context->cycleStamp = osGetSystemTime();
+   context->pacingGain = tcpBbrPacingGainCycle[context->cycleIndex];
+
+   //Debug message
+   TRACE_DEBUG("BBR: PROBE_BW (btlBw=%" PRIu32 " bytes/s, rtProp=%" PRIu32 " ms)\r\n",
+      context->btlBw, context->rtProp);
+}
+
+
+/**
+ * @brief Update the pacing rate
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrSetPacingRate(Socket *socket)
+{
+   uint32_t rate;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //No bandwidth estimate yet?
+   if(context->btlBw == 0)
+      return;
+
+   //Pace at a multiple of the estimated bottleneck bandwidth
+   rate = (uint32_t) MIN((uint64_t) context->btlBw * context->pacingGain /
+      TCP_BBR_UNIT, UINT32_MAX);
+
+   //The pacing rate is not reduced until the pipe is full
+   if(context->filledPipe || rate > context->pacingRate)
+   {
+      context->pacingRate = rate;
+   }
+}
+
+
+/**
+ * @brief Update the congestion window
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpBbrSetCwnd(Socket *socket, const TcpRateSample *rs)
+{
+   uint32_t target;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //Restore the window once the loss has been repaired
+   if(context->lossRecovery &&
+      socket->congestState == TCP_CONGEST_STATE_IDLE)
+   {
+      socket->cwnd = MAX(socket->cwnd, context->priorCwnd);
+      context->lossRecovery = FALSE;
+      context->packetConservation = FALSE;
+   }
+
+   //Packet conservation ends after the first round trip of fast recovery
+   if(context->packetConservation &&
+      context->roundCount != context->recoveryRound)
+   {
+      context->packetConservation = FALSE;
+   }
+
+   //The window is managed by tcpBbrOnRecovery during packet conservation
+   if(context->packetConservation &&
+      socket->congestState == TCP_CONGEST_STATE_RECOVERY)
+   {
+      return;
+   }
+
+   //Compute the target window
+   target = tcpBbrComputeInflight(socket, context->cwndGain);
+
+   //Grow the window towards the target
+   if(context->filledPipe)
+   {
+      socket->cwnd = MIN(socket->cwnd + rs->acked, target);
+   }
+   else if(socket->cwnd < target ||
+      socket->delivered < TCP_INITIAL_WINDOW * socket->smss)
+   {
+      socket->cwnd += rs->acked;
+   }
+
+   //Enforce the minimum window
+   socket->cwnd = MAX(socket->cwnd, TCP_BBR_MIN_CWND * socket->smss);
+
+   //The data in flight is kept to a minimum in PROBE_RTT mode
+   if(context->mode == TCP_BBR_MODE_PROBE_RTT)
+   {
+      socket->cwnd = MIN(socket->cwnd, TCP_BBR_MIN_CWND * socket->smss);
+   }
+}
+
+
+/**
+ * @brief Save the congestion window before a reduction
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpBbrSaveCwnd(Socket *socket)
+{
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //The window may already have been reduced
+   if(socket->congestState == TCP_CONGEST_STATE_IDLE &&
+      context->mode != TCP_BBR_MODE_PROBE_RTT)
+   {
+      context->priorCwnd = socket->cwnd;
+   }
+   else
+   {
+      context->priorCwnd = MAX(context->priorCwnd, socket->cwnd);
+   }
+}
+
+
+/**
+ * @brief Compute the amount of data in flight for a given gain
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] gain Gain applied to the estimated bandwidth-delay product
+ * @return Amount of data, in bytes
+ **/
+
+uint32_t tcpBbrComputeInflight(Socket *socket, uint_t gain)
+{
+   uint64_t bdp;
+   TcpBbrContext *context;
+
+   //Point to the BBR context
+   context = &socket->congestContext.bbr;
+
+   //The model is not available yet?
+   if(!context->rtPropValid || context->btlBw == 0)
+      return TCP_INITIAL_WINDOW * socket->smss;
+
+   //Estimate the bandwidth-delay product
+   bdp = (uint64_t) context->btlBw * MAX(context->rtProp, 1) / 1000;
+   bdp = bdp * gain / TCP_BBR_UNIT;
+
+   //Allow for a few segments held in the send and receive paths
+   bdp += 3 * socket->smss;
+
+   //Return the amount of data in flight
+   return (uint32_t) MIN(bdp, UINT32_MAX);
+}
+
+#endif
@@ -0,0 +1,154 @@
+/**
+ * @file tcp_bbr.h
+ * @brief BBR congestion control algorithm (version 1)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _TCP_BBR_H
+#define _TCP_BBR_H
+
+//Dependencies
+#include "core/tcp.h"
+
+//Length of the bottleneck bandwidth filter (in round trips)
+#ifndef TCP_BBR_BW_FILTER_LEN
+   #define TCP_BBR_BW_FILTER_LEN 10
+#elif (TCP_BBR_BW_FILTER_LEN < 1)
+   #error TCP_BBR_BW_FILTER_LEN parameter is not valid
+#endif
+
+//Length of the round-trip propagation time filter (in ms)
+#ifndef TCP_BBR_RTPROP_FILTER_LEN
+   #define TCP_BBR_RTPROP_FILTER_LEN 10000
+#elif (TCP_BBR_RTPROP_FILTER_LEN < 1000)
+   #error TCP_BBR_RTPROP_FILTER_LEN parameter is not valid
+#endif
+
+//Minimum time spent in PROBE_RTT mode (in ms)
+#ifndef TCP_BBR_PROBE_RTT_DURATION
+   #define TCP_BBR_PROBE_RTT_DURATION 200
+#elif (TCP_BBR_PROBE_RTT_DURATION < 10)
+   #error TCP_BBR_PROBE_RTT_DURATION parameter is not valid
+#endif
+
+//Unit of the gain factors
+#define TCP_BBR_UNIT 256
+//Gain used in STARTUP mode (2/ln(2))
+#define TCP_BBR_HIGH_GAIN 739
+//Pacing gain used in DRAIN mode (ln(2)/2)
+#define TCP_BBR_DRAIN_GAIN 88
+//Congestion window gain used in PROBE_BW mode
+#define TCP_BBR_CWND_GAIN 512
+//Number of phases of the pacing gain cycle
+#define TCP_BBR_GAIN_CYCLE_LEN 8
+//Minimum congestion window (in segments)
+#define TCP_BBR_MIN_CWND 4
+
+//BBR congestion control algorithm
+#define TCP_BBR_ALGO (&tcpBbrAlgo)
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief BBR modes
+ **/
+
+typedef enum
+{
+   TCP_BBR_MODE_STARTUP   = 0,
+   TCP_BBR_MODE_DRAIN     = 1,
+   TCP_BBR_MODE_PROBE_BW  = 2,
+   TCP_BBR_MODE_PROBE_RTT = 3
+} TcpBbrMode;
+
+
+/**
+ * @brief BBR context
+ **/
+
+typedef struct
+{
+   TcpBbrMode mode;                          ///<Current mode
+   uint32_t bwFilter[TCP_BBR_BW_FILTER_LEN]; ///<Maximum delivery rate measured during each round trip
+   uint32_t bwRound[TCP_BBR_BW_FILTER_LEN];  ///<Round trip to which each entry of the filter belongs
+   uint32_t btlBw;                           ///<Estimated bottleneck bandwidth (in bytes per second)
+   systime_t rtProp;                         ///<Estimated round-trip propagation time
+   systime_t rtPropStamp;                    ///<Time at which rtProp was last updated
+   bool_t rtPropValid;                       ///<A round-trip time sample has been collected
+   bool_t rtPropExpired;                     ///<The rtProp estimate is older than the filter length
+   uint32_t nextRoundDelivered;              ///<Delivered count marking the end of the current round trip
+   uint32_t roundCount;                      ///<Number of round trips
+   bool_t roundStart;                        ///<A new round trip has just started
+   uint32_t fullBw;                          ///<Baseline bandwidth used to detect a full pipe
+   uint_t fullBwCount;                       ///<Number of round trips without significant growth
+   bool_t filledPipe;                        ///<The bottleneck bandwidth has been reached
+   uint_t pacingGain;                        ///<Current pacing gain
+   uint_t cwndGain;                          ///<Current congestion window gain
+   uint_t cycleIndex;                        ///<Current phase of the pacing gain cycle
+   systime_t cycleStamp;                     ///<Beginning of the current phase
+   bool_t probeRttDone;                      ///<The minimum PROBE_RTT duration has been scheduled
+   systime_t probeRttDoneStamp;              ///<Time at which PROBE_RTT mode can be exited
+   bool_t probeRttRoundDone;                 ///<A round trip has elapsed in PROBE_RTT mode
+   uint32_t priorCwnd;                       ///<Congestion window saved before a reduction
+   bool_t lossRecovery;                      ///<The window must be restored once the loss is repaired
+   bool_t packetConservation;                ///<Packet conservation applies during fast recovery
+   uint32_t recoveryRound;                   ///<Round trip during which fast recovery was entered
+   uint32_t pacingRate;                      ///<Pacing rate (in bytes per second)
+} TcpBbrContext;
+
+
+//BBR congestion control algorithm
+extern const TcpCongestionAlgo tcpBbrAlgo;
+
+//BBR related functions
+void tcpBbrInit(Socket *socket);
+void tcpBbrOnAck(Socket *socket, const TcpRateSample *rs);
+void tcpBbrOnLoss(Socket *socket);
+void tcpBbrOnRto(Socket *socket);
+void tcpBbrOnRecovery(Socket *socket, uint_t n);
+uint32_t tcpBbrGetPacingRate(Socket *socket);
+
+void tcpBbrUpdateRound(Socket *socket, const TcpRateSample *rs);
+void tcpBbrUpdateBtlBw(Socket *socket, const TcpRateSample *rs);
+void tcpBbrUpdateRtProp(Socket *socket, const TcpRateSample *rs);
+void tcpBbrCheckCyclePhase(Socket *socket);
+void tcpBbrCheckFullPipe(Socket *socket, const TcpRateSample *rs);
+void tcpBbrCheckDrain(Socket *socket);
+void tcpBbrCheckProbeRtt(Socket *socket);
+void tcpBbrEnterProbeBw(Socket *socket);
+void tcpBbrSetPacingRate(Socket *socket);
+void tcpBbrSetCwnd(Socket *socket, const TcpRateSample *rs);
+void tcpBbrSaveCwnd(Socket *socket);
+uint32_t tcpBbrComputeInflight(Socket *socket, uint_t gain);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
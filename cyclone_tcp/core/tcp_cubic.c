@@ -0,0 +1,320 @@
+/**
+ * @file tcp_cubic.c
+ * @brief CUBIC congestion control algorithm
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * CUBIC uses a cubic function of the time elapsed since the last congestion
+ * event to grow the congestion window, which makes the window growth
+ * independent of the round-trip time. Refer to RFC 9438 for more details
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL TCP_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_misc.h"
+#include "core/tcp_cubic.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (TCP_SUPPORT == ENABLED && TCP_CONGEST_CONTROL_SUPPORT == ENABLED && \
+   TCP_CUBIC_SUPPORT == ENABLED)
+
+//CUBIC congestion control algorithm
+const TcpCongestionAlgo tcpCubicAlgo =
+{
+   "CUBIC",
+   tcpCubicInit,
+   tcpCubicOnAck,
+   tcpCubicOnLoss,
+   tcpCubicOnRto,
+   NULL,
+   NULL
+};
+
+
+/**
+ * @brief CUBIC initialization
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpCubicInit(Socket *socket)
+{
+   TcpCubicContext *context;
+
+   //Point to the CUBIC context
+   context = &socket->congestContext.cubic;
+
+   //No congestion event has been detected yet
+   context->epochStarted = FALSE;
+   context->epochStart = 0;
+   context->wMax = 0;
+   context->wEst = 0;
+   context->k = 0;
+}
+
+
+/**
+ * @brief CUBIC processing of an ACK that acknowledges new data
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpCubicOnAck(Socket *socket, const TcpRateSample *rs)
+{
+   uint32_t target;
+   uint64_t inc;
+   systime_t time;
+   systime_t t;
+   TcpCubicContext *context;
+
+   //Point to the CUBIC context
+   context = &socket->congestContext.cubic;
+
+   //The congestion window is managed by the fast recovery procedure
+   if(socket->congestState == TCP_CONGEST_STATE_RECOVERY)
+      return;
+
+   //Slow start algorithm is used when cwnd is lower than ssthresh
+   if(socket->cwnd < socket->ssthresh)
+   {
+      //CUBIC uses the standard slow start algorithm
+      socket->cwnd += MIN(rs->acked, socket->smss);
+      return;
+   }
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Beginning of a congestion avoidance stage?
+   if(!context->epochStarted)
+   {
+      //Record the start time of the stage
+      context->epochStarted = TRUE;
+      context->epochStart = time;
+
+      //The Reno-friendly estimate starts from the current window
+      context->wEst = socket->cwnd;
+
+      //Check whether the window is below the point of the last reduction
+      if(socket->cwnd < context->wMax)
+      {
+         //Compute the time period needed to grow back to W_max. K is
+         //expressed in milliseconds and C = 0.4 (refer to RFC 9438,
+         //section 4.2)
+         context->k = tcpCubicRoot((uint64_t) (context->wMax - socket->cwnd) *
+            2500000 / socket->smss * 1000);
+      }
+      else
+      {
+         //The cubic function starts in its convex region
+         context->k = 0;
+         context->wMax = socket->cwnd;
+      }
+   }
+
+   //The target window is the value of the cubic function one RTT ahead
+   t = time - context->epochStart + socket->srtt;
+   target = tcpCubicComputeWindow(socket, t);
+
+   //The target must lie between cwnd and 1.5 * cwnd
+   target = MAX(target, socket->cwnd);
+   target = MIN(target, socket->cwnd + socket->cwnd / 2);
+
+   //Update the estimate of the window of a Reno flow. The additive increase
+   //factor makes CUBIC as aggressive as Reno until W_max is reached
+   inc = (uint64_t) socket->smss * rs->acked;
+
+   if(context->wEst < context->wMax)
+   {
+      inc = inc * 3 * (1024 - TCP_CUBIC_BETA) / (1024 + TCP_CUBIC_BETA);
+   }
+
+   context->wEst += (uint32_t) (inc / socket->cwnd);
+
+   //Reno-friendly region?
+   if(context->wEst > target)
+   {
+      //CUBIC must not be less aggressive than Reno
+      socket->cwnd = context->wEst;
+   }
+   else
+   {
+      //Concave or convex region of the cubic function
+      socket->cwnd += (uint32_t) ((uint64_t) (target - socket->cwnd) *
+         rs->acked / socket->cwnd);
+   }
+}
+
+
+/**
+ * @brief CUBIC processing of a loss detected by duplicate ACKs
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpCubicOnLoss(Socket *socket)
+{
+   uint32_t wMax;
+   TcpCubicContext *context;
+
+   //Point to the CUBIC context
+   context = &socket->congestContext.cubic;
+
+   //A new congestion avoidance stage will begin after the recovery
+   context->epochStarted = FALSE;
+
+   //Save the window size before the reduction
+   wMax = socket->cwnd;
+
+#if (TCP_CUBIC_FAST_CONVERGENCE == ENABLED)
+   //When the window keeps shrinking, a new flow is likely competing for
+   //the bandwidth. Release more bandwidth by reducing W_max further
+   if(socket->cwnd < context->wMax)
+   {
+      wMax = (uint32_t) ((uint64_t) socket->cwnd * (1024 + TCP_CUBIC_BETA) /
+         2048);
+   }
+#endif
+
+   //Update W_max
+   context->wMax = wMax;
+
+   //Multiplicative decrease of the congestion window
+   socket->ssthresh = (uint32_t) ((uint64_t) socket->cwnd * TCP_CUBIC_BETA /
+      1024);
+
+   //The slow start threshold cannot be lower than 2 * SMSS
+   socket->ssthresh = MAX(socket->ssthresh, 2 * socket->smss);
+
+   //Debug message
+   TRACE_DEBUG("CUBIC: W_max=%" PRIu32 " ssthresh=%" PRIu32 "\r\n",
+      context->wMax, socket->ssthresh);
+}
+
+
+/**
+ * @brief CUBIC processing of a retransmission timeout
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpCubicOnRto(Socket *socket)
+{
+   //A retransmission timeout triggers the same reduction as a loss
+   //detected by duplicate ACKs (refer to RFC 9438, section 4.8)
+   tcpCubicOnLoss(socket);
+}
+
+
+/**
+ * @brief Evaluate the cubic function
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] t Time elapsed since the beginning of the stage (in ms)
+ * @return Value of W_cubic(t), in bytes
+ **/
+
+uint32_t tcpCubicComputeWindow(Socket *socket, systime_t t)
+{
+   uint32_t offset;
+   uint64_t delta;
+   uint64_t w;
+   TcpCubicContext *context;
+
+   //Point to the CUBIC context
+   context = &socket->congestContext.cubic;
+
+   //Distance to the inflection point
+   if(t >= context->k)
+   {
+      offset = t - context->k;
+   }
+   else
+   {
+      offset = context->k - t;
+   }
+
+   //Limit the offset to prevent overflows
+   offset = MIN(offset, TCP_CUBIC_MAX_TIME_OFFSET);
+
+   //Compute C * (t - K)^3, in bytes, with C = 0.4 segments per second^3
+   delta = (uint64_t) offset * offset * offset / 1000000;
+   delta = delta * socket->smss / 2500;
+
+   //W_cubic(t) = C * (t - K)^3 + W_max
+   if(t >= context->k)
+   {
+      w = context->wMax + delta;
+   }
+   else if(delta < context->wMax)
+   {
+      w = context->wMax - delta;
+   }
+   else
+   {
+      w = 0;
+   }
+
+   //Return the value of the cubic function
+   return (uint32_t) MIN(w, UINT32_MAX);
+}
+
+
+/**
+ * @brief Integer cube root
+ * @param[in] a Input value
+ * @return Largest integer whose cube does not exceed the input value
+ **/
+
+uint32_t tcpCubicRoot(uint64_t a)
+{
+   int_t s;
+   uint64_t b;
+   uint64_t y;
+
+   //Initialize the result
+   y = 0;
+
+   //The root is computed one bit at a time
+   for(s = 63; s >= 0; s -= 3)
+   {
+      y = 2 * y;
+      b = 3 * y * (y + 1) + 1;
+
+      //Check whether the next bit of the root is set
+      if((a >> s) >= b)
+      {
+         a -= b << s;
+         y++;
+      }
+   }
+
+   //Return the cube root
+   return (uint32_t) y;
+}
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file tcp_cubic.h
+ * @brief CUBIC congestion control algorithm
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _TCP_CUBIC_H
+#define _TCP_CUBIC_H
+
+//Dependencies
+#include "core/tcp.h"
+
+//Multiplicative decrease factor (in units of 1/1024)
+#ifndef TCP_CUBIC_BETA
+   #define TCP_CUBIC_BETA 717
+#elif (TCP_CUBIC_BETA < 512 || TCP_CUBIC_BETA > 1023)
+   #error TCP_CUBIC_BETA parameter is not valid
+#endif
+
+//Fast convergence
+#ifndef TCP_CUBIC_FAST_CONVERGENCE
+   #define TCP_CUBIC_FAST_CONVERGENCE ENABLED
+#elif (TCP_CUBIC_FAST_CONVERGENCE != ENABLED && TCP_CUBIC_FAST_CONVERGENCE != DISABLED)
+   #error TCP_CUBIC_FAST_CONVERGENCE parameter is not valid
+#endif
+
+//Maximum time offset used to evaluate the cubic function (in ms)
+#define TCP_CUBIC_MAX_TIME_OFFSET 1000000
+
+//CUBIC congestion control algorithm
+#define TCP_CUBIC_ALGO (&tcpCubicAlgo)
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief CUBIC context
+ **/
+
+typedef struct
+{
+   bool_t epochStarted;  ///<A congestion avoidance stage is in progress
+   systime_t epochStart; ///<Beginning of the current congestion avoidance stage
+   uint32_t wMax;        ///<Congestion window just before the last reduction
+   uint32_t wEst;        ///<Estimate of the window of a Reno-friendly flow
+   uint32_t k;           ///<Time needed to grow back to W_max (in ms)
+} TcpCubicContext;
+
+
+//CUBIC congestion control algorithm
+extern const TcpCongestionAlgo tcpCubicAlgo;
+
+//CUBIC related functions
+void tcpCubicInit(Socket *socket);
+void tcpCubicOnAck(Socket *socket, const TcpRateSample *rs);
+void tcpCubicOnLoss(Socket *socket);
+void tcpCubicOnRto(Socket *socket);
+
+uint32_t tcpCubicComputeWindow(Socket *socket, systime_t t);
+uint32_t tcpCubicRoot(uint64_t a);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
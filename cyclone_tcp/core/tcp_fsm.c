@@ -32,6 +32,7 @@
 #include "core/net.h"
 #include "core/ip.h"
 #include "core/socket.h"
+#include "core/socket_misc.h"
 #include "core/tcp.h"
 #include "core/tcp_fsm.h"
 #include "core/tcp_misc.h"
@@ -64,8 +65,11 @@ void tcpProcessSegment(NetInterface *interface,
 {
    uint_t i;
    size_t length;
+   IpAddr srcIpAddr;
    Socket *socket;
+   Socket *matchingSocket;
    Socket *passiveSocket;
+   Socket *bucket[2];
    TcpHeader *segment;
 
    //Total number of segments received, including those received in error
@@ -86,6 +90,10 @@ void tcpProcessSegment(NetInterface *interface,
       //Ensure the destination address is not a multicast address
       if(ipv4IsMulticastAddr(pseudoHeader->ipv4Data.destAddr))
          return;
+
+      //Save the source IPv4 address
+      srcIpAddr.length = sizeof(Ipv4Addr);
+      srcIpAddr.ipv4Addr = pseudoHeader->ipv4Data.srcAddr;
    }
    else
 #endif
@@ -95,6 +103,10 @@ void tcpProcessSegment(NetInterface *interface,
       //Ensure the destination address is not a multicast address
       if(ipv6IsMulticastAddr(&pseudoHeader->ipv6Data.destAddr))
          return;
+
+      //Save the source IPv6 address
+      srcIpAddr.length = sizeof(Ipv6Addr);
+      srcIpAddr.ipv6Addr = pseudoHeader->ipv6Data.srcAddr;
    }
    else
 #endif
@@ -155,124 +167,144 @@ void tcpProcessSegment(NetInterface *interface,
       return;
    }
 
-   //No matching socket in the LISTEN state for the moment
+   //No matching socket for the moment
+   matchingSocket = NULL;
    passiveSocket = NULL;
 
-   //Look through opened sockets
-   for(i = 0; i < SOCKET_MAX_COUNT; i++)
-   {
-      //Point to the current socket
-      socket = socketTable + i;
+   //Only the hash buckets that may contain a matching socket are searched:
+   //the bucket of connected sockets that matches the 4-tuple of the segment
+   //and the bucket of sockets bound to the destination port
+   bucket[0] = socketConnHashTable[socketComputeConnHash(SOCKET_TYPE_STREAM,
+      ntohs(segment->destPort), &srcIpAddr, ntohs(segment->srcPort))];
 
-      //TCP socket found?
-      if(socket->type != SOCKET_TYPE_STREAM)
-         continue;
+   bucket[1] = socketBindHashTable[socketComputeBindHash(SOCKET_TYPE_STREAM,
+      ntohs(segment->destPort))];
 
-      //Check whether the socket is bound to a particular interface
-      if(socket->interface && socket->interface != interface)
-         continue;
+   //Loop through the selected hash buckets
+   for(i = 0; i < arraysize(bucket); i++)
+   {
+      //Loop through the sockets of the current bucket
+      for(socket = bucket[i]; socket != NULL; socket = socket->hashNext)
+      {
+         //TCP socket found?
+         if(socket->type != SOCKET_TYPE_STREAM)
+            continue;
 
-      //Check destination port number
-      if(socket->localPort == 0 || socket->localPort != ntohs(segment->destPort))
-         continue;
+         //Check whether the socket is bound to a particular interface
+         if(socket->interface && socket->interface != interface)
+            continue;
 
-#if (IPV4_SUPPORT == ENABLED)
-      //IPv4 packet received?
-      if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
-      {
-         //Check whether the socket is restricted to IPv6 communications only
-         if((socket->options & SOCKET_OPTION_IPV6_ONLY) != 0)
+         //Check destination port number
+         if(socket->localPort == 0 || socket->localPort != ntohs(segment->destPort))
             continue;
 
-         //Destination IP address filtering
-         if(socket->localIpAddr.length != 0)
+#if (IPV4_SUPPORT == ENABLED)
+         //IPv4 packet received?
+         if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
          {
-            //An IPv4 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv4Addr))
+            //Check whether the socket is restricted to IPv6 communications only
+            if((socket->options & SOCKET_OPTION_IPV6_ONLY) != 0)
                continue;
 
-            //Filter out non-matching addresses
-            if(socket->localIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
-               socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
+            //Destination IP address filtering
+            if(socket->localIpAddr.length != 0)
             {
-               continue;
+               //An IPv4 address is expected
+               if(socket->localIpAddr.length != sizeof(Ipv4Addr))
+                  continue;
+
+               //Filter out non-matching addresses
+               if(socket->localIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
+                  socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
+               {
+                  continue;
+               }
             }
-         }
-
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length != 0)
-         {
-            //An IPv4 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
-               continue;
 
-            //Filter out non-matching addresses
-            if(socket->remoteIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
-               socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
+            //Source IP address filtering
+            if(socket->remoteIpAddr.length != 0)
             {
-               continue;
+               //An IPv4 address is expected
+               if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
+                  continue;
+
+               //Filter out non-matching addresses
+               if(socket->remoteIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
+                  socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
+               {
+                  continue;
+               }
             }
          }
-      }
-      else
+         else
 #endif
 #if (IPV6_SUPPORT == ENABLED)
-      //IPv6 packet received?
-      if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
-      {
-         //Destination IP address filtering
-         if(socket->localIpAddr.length != 0)
+         //IPv6 packet received?
+         if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
          {
-            //An IPv6 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
-               !ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
+            //Destination IP address filtering
+            if(socket->localIpAddr.length != 0)
             {
-               continue;
+               //An IPv6 address is expected
+               if(socket->localIpAddr.length != sizeof(Ipv6Addr))
+                  continue;
+
+               //Filter out non-matching addresses
+               if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
+                  !ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
+               {
+                  continue;
+               }
             }
-         }
 
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length != 0)
-         {
-            //An IPv6 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
-               !ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
+            //Source IP address filtering
+            if(socket->remoteIpAddr.length != 0)
             {
-               continue;
+               //An IPv6 address is expected
+               if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
+                  continue;
+
+               //Filter out non-matching addresses
+               if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
+                  !ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
+               {
+                  continue;
+               }
             }
          }
-      }
-      else
+         else
 #endif
-      //Invalid packet received?
-      {
-         //This should never occur...
-         continue;
-      }
+         //Invalid packet received?
+         {
+            //This should never occur...
+            continue;
+         }
 
-      //Keep track of the first matching socket in the LISTEN state
-      if(socket->state == TCP_STATE_LISTEN && passiveSocket == NULL)
-         passiveSocket = socket;
+         //Keep track of the first matching socket in the LISTEN state
+         if(socket->state == TCP_STATE_LISTEN)
+         {
+            //The socket with the lowest descriptor takes precedence
+            if(passiveSocket == NULL || socket < passiveSocket)
+               passiveSocket = socket;
+         }
 
-      //Source port filtering
-      if(socket->remotePort != ntohs(segment->srcPort))
-         continue;
+         //Source port filtering
+         if(socket->remotePort != ntohs(segment->srcPort))
+            continue;
 
-      //A matching socket has been found
-      break;
+         //The socket with the lowest descriptor takes precedence
+         if(matchingSocket == NULL || socket < matchingSocket)
+            matchingSocket = socket;
+      }
    }
 
    //If no matching socket has been found then try to use the first matching
    //socket in the LISTEN state
-   if(i >= SOCKET_MAX_COUNT)
+   if(matchingSocket != NULL)
+   {
+      socket = matchingSocket;
+   }
+   else
    {
       socket = passiveSocket;
    }
@@ -617,6 +649,43 @@ void tcpStateListen(Socket *socket, NetInterface *interface,
       }
 #endif
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+      //Get the Window Scale option
+      option = tcpGetOption(segment, TCP_OPTION_WINDOW_SCALE_FACTOR);
+
+      //Window scaling is enabled only if both sides send this option in
+      //their SYN segments (refer to RFC 7323, section 2.2)
+      if(option != NULL && option->length == 3)
+      {
+         queueItem->wndScaleEnabled = TRUE;
+         //Shift counts greater than 14 must be interpreted as 14
+         queueItem->wndShift = MIN(option->value[0], TCP_MAX_WINDOW_SHIFT);
+      }
+      else
+      {
+         queueItem->wndScaleEnabled = FALSE;
+         queueItem->wndShift = 0;
+      }
+#endif
+
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+      //Get the Timestamps option
+      option = tcpGetOption(segment, TCP_OPTION_TIMESTAMP);
+
+      //The Timestamps option is negotiated if it is received in the initial
+      //SYN segment (refer to RFC 7323, section 3.2)
+      if(option != NULL && option->length == 10)
+      {
+         queueItem->tsEnabled = TRUE;
+         queueItem->tsVal = LOAD32BE(option->value);
+      }
+      else
+      {
+         queueItem->tsEnabled = FALSE;
+         queueItem->tsVal = 0;
+      }
+#endif
+
       //Notify user that a connection request is pending
       tcpUpdateEvents(socket);
 
@@ -695,7 +764,7 @@ void tcpStateSynSent(Socket *socket, const TcpHeader *segment, size_t length)
       }
 
       //Compute retransmission timeout
-      tcpComputeRto(socket);
+      tcpComputeRto(socket, segment);
 
       //Any segments on the retransmission queue which are thereby acknowledged
       //should be removed
@@ -732,6 +801,42 @@ void tcpStateSynSent(Socket *socket, const TcpHeader *segment, size_t length)
       }
 #endif
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+      //Get the Window Scale option
+      option = tcpGetOption(segment, TCP_OPTION_WINDOW_SCALE_FACTOR);
+
+      //Specified option found?
+      if(option != NULL && option->length == 3)
+      {
+         //Window scaling is in effect in both directions
+         socket->wndScaleEnabled = TRUE;
+         //Shift counts greater than 14 must be interpreted as 14
+         socket->sndWndShift = MIN(option->value[0], TCP_MAX_WINDOW_SHIFT);
+      }
+      else
+      {
+         //If the remote host did not send the option, window scaling is
+         //disabled in both directions (refer to RFC 7323, section 2.2)
+         socket->sndWndShift = 0;
+         socket->rcvWndShift = 0;
+      }
+#endif
+
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+      //Get the Timestamps option
+      option = tcpGetOption(segment, TCP_OPTION_TIMESTAMP);
+
+      //Specified option found?
+      if(option != NULL && option->length == 10)
+      {
+         //The Timestamps option can be used once the connection is
+         //established (refer to RFC 7323, section 3.2)
+         socket->tsEnabled = TRUE;
+         socket->tsRecent = LOAD32BE(option->value);
+         socket->tsRecentTime = osGetSystemTime();
+      }
+#endif
+
 #if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
       //Initial congestion window
       socket->cwnd = MIN(TCP_INITIAL_WINDOW * socket->smss,
@@ -743,12 +848,12 @@ void tcpStateSynSent(Socket *socket, const TcpHeader *segment, size_t length)
       {
          //Update the send window before entering ESTABLISHED state (refer to
          //RFC 1122, section 4.2.2.20)
-         socket->sndWnd = segment->window;
+         socket->sndWnd = tcpDecodeWindow(socket, segment);
          socket->sndWl1 = segment->seqNum;
          socket->sndWl2 = segment->ackNum;
 
          //Maximum send window it has seen so far on the connection
-         socket->maxSndWnd = segment->window;
+         socket->maxSndWnd = socket->sndWnd;
 
          //Form an ACK segment and send it
          tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt, socket->rcvNxt,
@@ -786,15 +891,16 @@ void tcpStateSynSent(Socket *socket, const TcpHeader *segment, size_t length)
 void tcpStateSynReceived(Socket *socket, const TcpHeader *segment,
    const NetBuffer *buffer, size_t offset, size_t length)
 {
-   TcpHeader segment2;
+   TcpHeader *segment2;
+   uint8_t header[TCP_MAX_HEADER_LENGTH];
 
    //Debug message
    TRACE_DEBUG("TCP FSM: SYN-RECEIVED state\r\n");
 
-   //Make a copy of the TCP header
-   segment2 = *segment;
-   //Discard TCP options
-   segment2.dataOffset = sizeof(TcpHeader) / 4;
+   //Make a copy of the TCP header. The options are preserved since the
+   //Timestamps option must be present once it has been negotiated
+   segment2 = (TcpHeader *) header;
+   osMemcpy(segment2, segment, segment->dataOffset * 4);
 
    //Check the SYN bit
    if((segment->flags & TCP_FLAG_SYN) != 0 &&
@@ -804,8 +910,8 @@ void tcpStateSynReceived(Socket *socket, const TcpHeader *segment,
       if((segment->flags & TCP_FLAG_ACK) != 0)
       {
          //Simultaneous open attempt
-         segment2.flags &= ~TCP_FLAG_SYN;
-         segment2.seqNum++;
+         segment2->flags &= ~TCP_FLAG_SYN;
+         segment2->seqNum++;
       }
       else
       {
@@ -819,7 +925,7 @@ void tcpStateSynReceived(Socket *socket, const TcpHeader *segment,
    }
 
    //First check sequence number
-   if(tcpCheckSeqNum(socket, &segment2, length))
+   if(tcpCheckSeqNum(socket, segment2, length))
       return;
 
    //Check the RST bit
@@ -838,7 +944,7 @@ void tcpStateSynReceived(Socket *socket, const TcpHeader *segment,
    }
 
    //Check the SYN bit
-   if(tcpCheckSyn(socket, &segment2, length))
+   if(tcpCheckSyn(socket, segment2, length))
       return;
 
    //If the ACK bit is off drop the segment and return
@@ -858,17 +964,17 @@ void tcpStateSynReceived(Socket *socket, const TcpHeader *segment,
 
    //Update the send window before entering ESTABLISHED state (refer to
    //RFC 1122, section 4.2.2.20)
-   socket->sndWnd = segment->window;
+   socket->sndWnd = tcpDecodeWindow(socket, segment);
    socket->sndWl1 = segment->seqNum;
    socket->sndWl2 = segment->ackNum;
 
    //Maximum send window it has seen so far on the connection
-   socket->maxSndWnd = segment->window;
+   socket->maxSndWnd = socket->sndWnd;
 
    //Enter ESTABLISHED state
    tcpChangeState(socket, TCP_STATE_ESTABLISHED);
    //And continue processing...
-   tcpStateEstablished(socket, &segment2, buffer, offset, length);
+   tcpStateEstablished(socket, segment2, buffer, offset, length);
 }
 
 
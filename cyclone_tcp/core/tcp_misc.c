@@ -50,6 +50,18 @@
 //Check TCP/IP stack configuration
 #if (TCP_SUPPORT == ENABLED)
 
+//NewReno congestion control algorithm
+const TcpCongestionAlgo tcpNewRenoAlgo =
+{
+   "NewReno",
+   NULL,
+   tcpNewRenoOnAck,
+   tcpNewRenoOnLoss,
+   tcpNewRenoOnRto,
+   NULL,
+   NULL
+};
+
 
 /**
  * @brief Send a TCP segment
@@ -96,7 +108,7 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
    segment->dataOffset = sizeof(TcpHeader) / 4;
    segment->flags = flags;
    segment->reserved2 = 0;
-   segment->window = htons(socket->rcvWnd);
+   segment->window = htons(tcpEncodeWindow(socket, flags));
    segment->checksum = 0;
    segment->urgentPointer = 0;
 
@@ -107,6 +119,57 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
       tcpAddOption(segment, TCP_OPTION_MAX_SEGMENT_SIZE, &mss, sizeof(mss));
    }
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //SYN flag set?
+   if((flags & TCP_FLAG_SYN) != 0)
+   {
+      //A TCP may send the Window Scale option in a SYN-ACK segment only if it
+      //has received this option in the initial SYN (refer to RFC 7323,
+      //section 2.2)
+      if((flags & TCP_FLAG_ACK) == 0 || socket->wndScaleEnabled)
+      {
+         //Append Window Scale option
+         tcpAddOption(segment, TCP_OPTION_WINDOW_SCALE_FACTOR,
+            &socket->rcvWndShift, sizeof(uint8_t));
+      }
+   }
+#endif
+
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   //The Timestamps option may be sent in an initial SYN segment. Once it has
+   //been negotiated, it must be sent in every non-RST segment (refer to
+   //RFC 7323, section 3.2)
+   if((flags & TCP_FLAG_RST) == 0 && (socket->tsEnabled ||
+      (flags & (TCP_FLAG_SYN | TCP_FLAG_ACK)) == TCP_FLAG_SYN))
+   {
+      uint32_t data[2];
+
+      //The TSval field contains the current value of the timestamp clock
+      data[0] = htonl(tcpGetTimestamp(socket));
+
+      //The TSecr field echoes the most recent timestamp received from the
+      //remote host. It is only valid if the ACK bit is set
+      if((flags & TCP_FLAG_ACK) != 0)
+      {
+         data[1] = htonl(socket->tsRecent);
+      }
+      else
+      {
+         data[1] = 0;
+      }
+
+      //Append Timestamps option
+      tcpAddOption(segment, TCP_OPTION_TIMESTAMP, data, sizeof(data));
+   }
+
+   //ACK flag set?
+   if((flags & TCP_FLAG_ACK) != 0)
+   {
+      //Save the acknowledgment number (Last.ACK.sent)
+      socket->lastAckSent = ackNum;
+   }
+#endif
+
 #if (TCP_SACK_SUPPORT == ENABLED)
    //SYN flag set?
    if((flags & TCP_FLAG_SYN) != 0)
@@ -130,19 +193,25 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
             socket->sackBlockCount <= TCP_MAX_SACK_BLOCKS)
          {
             uint_t i;
+            uint_t n;
             uint32_t data[TCP_MAX_SACK_BLOCKS * 2];
 
+            //Limit the number of blocks to the space left in the TCP header
+            //(each block takes 8 bytes, plus 4 bytes of option overhead)
+            n = (TCP_MAX_HEADER_LENGTH - segment->dataOffset * 4 - 4) / 8;
+            n = MIN(n, socket->sackBlockCount);
+
             //This option contains a list of some of the blocks of contiguous
             //sequence space occupied by data that has been received and queued
             //within the window
-            for(i = 0; i < socket->sackBlockCount; i++)
+            for(i = 0; i < n; i++)
             {
                data[i * 2] = htonl(socket->sackBlock[i].leftEdge);
                data[i * 2 + 1] = htonl(socket->sackBlock[i].rightEdge);
             }
 
             //Append SACK option
-            tcpAddOption(segment, TCP_OPTION_SACK, data, socket->sackBlockCount * 8);
+            tcpAddOption(segment, TCP_OPTION_SACK, data, n * 8);
          }
       }
    }
@@ -262,6 +331,11 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
       //Save pseudo header
       queueItem->pseudoHeader = pseudoHeader;
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+      //Record the state of the delivery rate estimator
+      tcpSaveDeliveryState(socket, queueItem);
+#endif
+
       //Take one RTT measurement at a time
       if(!socket->rttBusy)
       {
@@ -668,6 +742,106 @@ const TcpOption *tcpGetOption(const TcpHeader *segment, uint8_t kind)
 }
 
 
+/**
+ * @brief Select the window scale factor for a given receive buffer size
+ * @param[in] bufferSize Size of the receive buffer, in bytes
+ * @return Shift count to be advertised in the Window Scale option
+ **/
+
+uint8_t tcpComputeWindowShift(size_t bufferSize)
+{
+   uint8_t shift;
+
+   //Select the smallest shift count that allows the whole receive buffer to
+   //be advertised in the 16-bit Window field
+   for(shift = 0; shift < TCP_MAX_WINDOW_SHIFT; shift++)
+   {
+      //Check whether the scaled window fits in the Window field
+      if((bufferSize >> shift) <= UINT16_MAX)
+         break;
+   }
+
+   //Return the shift count
+   return shift;
+}
+
+
+/**
+ * @brief Format the Window field of an outgoing segment
+ * @param[in] socket Handle referencing the socket
+ * @param[in] flags Control flags of the outgoing segment
+ * @return Value of the Window field (host byte order)
+ **/
+
+uint16_t tcpEncodeWindow(Socket *socket, uint8_t flags)
+{
+   uint32_t wnd;
+
+   //Current receive window
+   wnd = socket->rcvWnd;
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //The Window field in a SYN segment is never scaled (refer to RFC 7323,
+   //section 2.2)
+   if((flags & TCP_FLAG_SYN) == 0)
+   {
+      wnd >>= socket->rcvWndShift;
+   }
+#endif
+
+   //The window cannot exceed the capacity of the 16-bit Window field
+   return (uint16_t) MIN(wnd, UINT16_MAX);
+}
+
+
+/**
+ * @brief Retrieve the window advertised by an incoming segment
+ * @param[in] socket Handle referencing the socket
+ * @param[in] segment Pointer to the incoming TCP segment
+ * @return Size of the advertised window, in bytes
+ **/
+
+uint32_t tcpDecodeWindow(Socket *socket, const TcpHeader *segment)
+{
+   uint32_t wnd;
+
+   //Window field of the incoming segment
+   wnd = segment->window;
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //The Window field in a SYN segment is never scaled (refer to RFC 7323,
+   //section 2.2)
+   if((segment->flags & TCP_FLAG_SYN) == 0)
+   {
+      wnd <<= socket->sndWndShift;
+   }
+#endif
+
+   //Return the size of the send window
+   return wnd;
+}
+
+
+/**
+ * @brief Get the current value of the timestamp clock
+ * @param[in] socket Handle referencing the socket
+ * @return Timestamp value, in milliseconds
+ **/
+
+uint32_t tcpGetTimestamp(Socket *socket)
+{
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   //A random per-connection offset is added to the clock so that the
+   //timestamps do not disclose the uptime of the host (refer to RFC 7323,
+   //section 7.1)
+   return (uint32_t) osGetSystemTime() + socket->tsOffset;
+#else
+   //The timestamp clock ticks every millisecond
+   return (uint32_t) osGetSystemTime();
+#endif
+}
+
+
 /**
  * @brief Initial sequence number generation
  * @param[in] localIpAddr Local IP address
@@ -716,6 +890,72 @@ uint32_t tcpGenerateInitialSeqNum(const IpAddr *localIpAddr,
 error_t tcpCheckSeqNum(Socket *socket, const TcpHeader *segment, size_t length)
 {
    bool_t acceptable;
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   uint32_t tsVal;
+   const TcpOption *option;
+
+   //Check whether the Timestamps option has been negotiated
+   if(socket->tsEnabled)
+   {
+      //Get the Timestamps option
+      option = tcpGetOption(segment, TCP_OPTION_TIMESTAMP);
+
+      //Malformed option?
+      if(option != NULL && option->length != 10)
+      {
+         option = NULL;
+      }
+   }
+   else
+   {
+      //The option is ignored
+      option = NULL;
+   }
+
+   //Once the Timestamps option has been negotiated, a non-RST segment
+   //received without it should be silently dropped (refer to RFC 7323,
+   //section 3.2)
+   if(socket->tsEnabled && option == NULL &&
+      (segment->flags & TCP_FLAG_RST) == 0)
+   {
+      //Debug message
+      TRACE_WARNING("TCP segment without Timestamps option rejected!\r\n");
+
+      //Drop the segment
+      return ERROR_FAILURE;
+   }
+
+   //Timestamps option found?
+   if(option != NULL)
+   {
+      //Retrieve the TSval field
+      tsVal = LOAD32BE(option->value);
+
+      //PAWS (Protection Against Wrapped Sequences) discards a non-RST segment
+      //whose TSval is older than TS.Recent. TS.Recent is no longer valid if
+      //the connection has been idle for more than 24 days (refer to RFC 7323,
+      //section 5.3)
+      if((segment->flags & TCP_FLAG_RST) == 0 &&
+         TCP_CMP_SEQ(tsVal, socket->tsRecent) < 0 &&
+         (osGetSystemTime() - socket->tsRecentTime) < TCP_PAWS_IDLE_TIMEOUT)
+      {
+         //Debug message
+         TRACE_WARNING("TCP segment rejected by PAWS!\r\n");
+
+         //An acknowledgment should be sent in reply
+         tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt, socket->rcvNxt,
+            0, FALSE);
+
+         //Drop the segment
+         return ERROR_FAILURE;
+      }
+   }
+   else
+   {
+      //Just for sanity
+      tsVal = 0;
+   }
+#endif
 
    //Due to zero windows and zero length segments, we have four cases for the
    //acceptability of an incoming segment (refer to RFC 793, section 3.3)
@@ -791,6 +1031,20 @@ error_t tcpCheckSeqNum(Socket *socket, const TcpHeader *segment, size_t length)
       return ERROR_FAILURE;
    }
 
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   //If SEG.TSval >= TS.Recent and SEG.SEQ <= Last.ACK.sent, then SEG.TSval
+   //is copied to TS.Recent (refer to RFC 7323, section 4.3)
+   if(option != NULL)
+   {
+      if(TCP_CMP_SEQ(tsVal, socket->tsRecent) >= 0 &&
+         TCP_CMP_SEQ(segment->seqNum, socket->lastAckSent) <= 0)
+      {
+         socket->tsRecent = tsVal;
+         socket->tsRecentTime = osGetSystemTime();
+      }
+   }
+#endif
+
    //Sequence number is acceptable
    return NO_ERROR;
 }
@@ -846,6 +1100,7 @@ error_t tcpCheckAck(Socket *socket, const TcpHeader *segment, size_t length)
    uint_t n;
    uint_t ownd;
    uint_t thresh;
+   TcpRateSample rs;
 #endif
 
    //If the ACK bit is off drop the segment and return
@@ -906,7 +1161,7 @@ error_t tcpCheckAck(Socket *socket, const TcpHeader *segment, size_t length)
       socket->sndUna = segment->ackNum;
 
       //Compute retransmission timeout
-      updateFlag = tcpComputeRto(socket);
+      updateFlag = tcpComputeRto(socket, segment);
       (void) updateFlag;
 
       //Any segments on the retransmission queue which are thereby entirely
@@ -914,6 +1169,13 @@ error_t tcpCheckAck(Socket *socket, const TcpHeader *segment, size_t length)
       tcpUpdateRetransmitQueue(socket);
 
 #if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+      //Generate a delivery rate sample
+      tcpGenerateRateSample(socket, n, updateFlag, &rs);
+
+      //Let the congestion control algorithm update the congestion window
+      //(NewReno and CUBIC leave it untouched during fast recovery)
+      socket->congestAlgo->onAck(socket, &rs);
+
       //Check congestion state
       if(socket->congestState == TCP_CONGEST_STATE_RECOVERY)
       {
@@ -931,24 +1193,6 @@ error_t tcpCheckAck(Socket *socket, const TcpHeader *segment, size_t length)
             //Invoke fast loss recovery
             tcpFastLossRecovery(socket, segment);
          }
-
-         //Slow start algorithm is used when cwnd is lower than ssthresh
-         if(socket->cwnd < socket->ssthresh)
-         {
-            //During slow start, TCP increments cwnd by at most SMSS bytes
-            //for each ACK received that cumulatively acknowledges new data
-            socket->cwnd += MIN(n, socket->smss);
-         }
-         //Congestion avoidance algorithm is used when cwnd exceeds ssthres
-         else
-         {
-            //Congestion window is updated once per RTT
-            if(updateFlag)
-            {
-               //TCP must not increment cwnd by more than SMSS bytes
-               socket->cwnd += MIN(socket->n, socket->smss);
-            }
-         }
       }
 
       //Limit the size of the congestion window
@@ -1023,11 +1267,20 @@ error_t tcpCheckAck(Socket *socket, const TcpHeader *segment, size_t length)
          //Duplicate ACK received?
          if(duplicateFlag)
          {
-            //For each additional duplicate ACK received (after the third),
-            //cwnd must be incremented by SMSS. This artificially inflates
-            //the congestion window in order to reflect the additional
-            //segment that has left the network
-            socket->cwnd += socket->smss;
+            //Algorithms that do not treat loss as a congestion signal manage
+            //the congestion window by themselves
+            if(socket->congestAlgo->onRecovery != NULL)
+            {
+               socket->congestAlgo->onRecovery(socket, 0);
+            }
+            else
+            {
+               //For each additional duplicate ACK received (after the third),
+               //cwnd must be incremented by SMSS. This artificially inflates
+               //the congestion window in order to reflect the additional
+               //segment that has left the network
+               socket->cwnd += socket->smss;
+            }
          }
       }
 
@@ -1151,7 +1404,7 @@ bool_t tcpIsDuplicateAck(Socket *socket, const TcpHeader *segment,
             {
                //The advertised window in the incoming acknowledgment equals
                //the advertised window in the last incoming acknowledgment
-               if(segment->window == socket->sndWnd)
+               if(tcpDecodeWindow(socket, segment) == socket->sndWnd)
                {
                   //Duplicate ACK
                   flag = TRUE;
@@ -1174,12 +1427,9 @@ bool_t tcpIsDuplicateAck(Socket *socket, const TcpHeader *segment,
 void tcpFastRetransmit(Socket *socket)
 {
 #if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
-   uint32_t flightSize;
-
-   //Amount of data that has been sent but not yet acknowledged
-   flightSize = socket->sndNxt - socket->sndUna;
-   //After receiving 3 duplicate ACKs, ssthresh must be adjusted
-   socket->ssthresh = MAX(flightSize / 2, 2 * socket->smss);
+   //After receiving 3 duplicate ACKs, ssthresh must be adjusted by the
+   //congestion control algorithm
+   socket->congestAlgo->onLoss(socket);
 
    //The value of recover is incremented to the value of the highest
    //sequence number transmitted by the TCP so far
@@ -1192,10 +1442,20 @@ void tcpFastRetransmit(Socket *socket)
    //without waiting for the retransmission timer to expire
    tcpRetransmitSegment(socket);
 
-   //cwnd must set to ssthresh plus 3*SMSS. This artificially inflates the
-   //congestion window by the number of segments (three) that have left the
-   //network and which the receiver has buffered
-   socket->cwnd = socket->ssthresh + TCP_FAST_RETRANSMIT_THRES * socket->smss;
+   //Algorithms that do not treat loss as a congestion signal manage the
+   //congestion window by themselves
+   if(socket->congestAlgo->onRecovery != NULL)
+   {
+      socket->congestAlgo->onRecovery(socket, 0);
+   }
+   else
+   {
+      //cwnd must set to ssthresh plus 3*SMSS. This artificially inflates the
+      //congestion window by the number of segments (three) that have left
+      //the network and which the receiver has buffered
+      socket->cwnd = socket->ssthresh + TCP_FAST_RETRANSMIT_THRES *
+         socket->smss;
+   }
 
    //Enter the fast recovery procedure
    socket->congestState = TCP_CONGEST_STATE_RECOVERY;
@@ -1220,8 +1480,13 @@ void tcpFastRecovery(Socket *socket, const TcpHeader *segment, uint_t n)
       //This is a full acknowledgment
       TRACE_INFO("TCP full acknowledgment\r\n");
 
-      //Set cwnd to ssthresh
-      socket->cwnd = socket->ssthresh;
+      //Set cwnd to ssthresh, unless the algorithm manages the congestion
+      //window by itself
+      if(socket->congestAlgo->onRecovery == NULL)
+      {
+         socket->cwnd = socket->ssthresh;
+      }
+
       //Exit the fast recovery procedure
       socket->congestState = TCP_CONGEST_STATE_IDLE;
    }
@@ -1234,17 +1499,26 @@ void tcpFastRecovery(Socket *socket, const TcpHeader *segment, uint_t n)
       //Retransmit the first unacknowledged segment
       tcpRetransmitSegment(socket);
 
-      //Deflate the congestion window by the amount of new data acknowledged
-      //by the cumulative acknowledgment field
-      if(socket->cwnd > n)
-         socket->cwnd -= n;
+      //Algorithms that do not treat loss as a congestion signal manage the
+      //congestion window by themselves
+      if(socket->congestAlgo->onRecovery != NULL)
+      {
+         socket->congestAlgo->onRecovery(socket, n);
+      }
+      else
+      {
+         //Deflate the congestion window by the amount of new data
+         //acknowledged by the cumulative acknowledgment field
+         if(socket->cwnd > n)
+            socket->cwnd -= n;
 
-      //If the partial ACK acknowledges at least one SMSS of new data, then
-      //add back SMSS bytes to the congestion window. This artificially
-      //inflates the congestion window in order to reflect the additional
-      //segment that has left the network
-      if(n >= socket->smss)
-         socket->cwnd += socket->smss;
+         //If the partial ACK acknowledges at least one SMSS of new data,
+         //then add back SMSS bytes to the congestion window. This
+         //artificially inflates the congestion window in order to reflect
+         //the additional segment that has left the network
+         if(n >= socket->smss)
+            socket->cwnd += socket->smss;
+      }
 
       //Do not exit the fast recovery procedure...
       socket->congestState = TCP_CONGEST_STATE_RECOVERY;
@@ -1288,6 +1562,366 @@ void tcpFastLossRecovery(Socket *socket, const TcpHeader *segment)
 }
 
 
+/**
+ * @brief Initialize congestion control
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpInitCongestControl(Socket *socket)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   systime_t time;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Default congestion state
+   socket->congestState = TCP_CONGEST_STATE_IDLE;
+   //Initial congestion window
+   socket->cwnd = MIN(TCP_INITIAL_WINDOW * socket->smss, socket->txBufferSize);
+   //Slow start threshold should be set arbitrarily high
+   socket->ssthresh = UINT32_MAX;
+   //Recover is set to the initial send sequence number
+   socket->recover = socket->iss;
+   //Reset duplicate ACK counter
+   socket->dupAckCount = 0;
+
+   //Reset the delivery rate estimator
+   socket->delivered = 0;
+   socket->deliveredTime = time;
+   socket->firstSentTime = time;
+   socket->appLimited = 0;
+   socket->rateSample.valid = FALSE;
+
+   //The pacer starts with no credit
+   socket->pacingCredit = 0;
+   socket->pacingTime = time;
+   netStopTimer(&socket->pacingTimer);
+
+   //Initialize the private state of the congestion control algorithm, if any
+   if(socket->congestAlgo->init != NULL)
+   {
+      socket->congestAlgo->init(socket);
+   }
+#endif
+}
+
+
+/**
+ * @brief Save the state of the delivery rate estimator when a segment is sent
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] queueItem Retransmission queue item describing the segment
+ **/
+
+void tcpSaveDeliveryState(Socket *socket, TcpQueueItem *queueItem)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   systime_t time;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //If there is no data in flight, the sampling interval starts now
+   if(socket->retransmitQueue == queueItem)
+   {
+      socket->firstSentTime = time;
+      socket->deliveredTime = time;
+   }
+
+   //Record the state of the connection at the time the segment is sent
+   queueItem->delivered = socket->delivered;
+   queueItem->deliveredTime = socket->deliveredTime;
+   queueItem->firstSentTime = socket->firstSentTime;
+   queueItem->sentTime = time;
+   queueItem->appLimited = (socket->appLimited != 0) ? TRUE : FALSE;
+#endif
+}
+
+
+/**
+ * @brief Update the delivery rate estimator when a segment is acknowledged
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] queueItem Retransmission queue item describing the segment
+ **/
+
+void tcpUpdateDeliveryState(Socket *socket, const TcpQueueItem *queueItem)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   systime_t time;
+   TcpRateSample *rs;
+
+   //Get current time
+   time = osGetSystemTime();
+   //Point to the sample being collected
+   rs = &socket->rateSample;
+
+   //Update the number of bytes delivered
+   socket->delivered += queueItem->length;
+   socket->deliveredTime = time;
+
+   //Segments are acknowledged in the order they were sent, so the sample
+   //always reflects the most recently sent segment
+   rs->valid = TRUE;
+   rs->priorDelivered = queueItem->delivered;
+   rs->sendElapsed = queueItem->sentTime - queueItem->firstSentTime;
+   rs->ackElapsed = time - queueItem->deliveredTime;
+   rs->rtt = time - queueItem->sentTime;
+   rs->appLimited = queueItem->appLimited;
+
+   //The next sampling interval starts with the send time of this segment
+   socket->firstSentTime = queueItem->sentTime;
+#endif
+}
+
+
+/**
+ * @brief Generate a delivery rate sample
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] acked Number of bytes acknowledged by the incoming ACK
+ * @param[in] roundTrip A full window of data has been acknowledged
+ * @param[out] rs Delivery rate sample
+ **/
+
+void tcpGenerateRateSample(Socket *socket, uint32_t acked, bool_t roundTrip,
+   TcpRateSample *rs)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //Retrieve the sample collected while processing the ACK
+   *rs = socket->rateSample;
+   //Start a new sample
+   socket->rateSample.valid = FALSE;
+
+   //Save the number of bytes newly acknowledged
+   rs->acked = acked;
+   rs->roundTrip = roundTrip;
+
+   //The application-limited phase ends once the data in flight at the time
+   //it started has been delivered
+   if(socket->appLimited != 0 &&
+      TCP_CMP_SEQ(socket->delivered, socket->appLimited) > 0)
+   {
+      socket->appLimited = 0;
+   }
+
+   //Any segment acknowledged?
+   if(rs->valid)
+   {
+      //Number of bytes delivered over the sampling interval
+      rs->delivered = socket->delivered - rs->priorDelivered;
+      //Use the longer of the send and ACK phases to avoid overestimating
+      //the delivery rate
+      rs->interval = MAX(rs->sendElapsed, rs->ackElapsed);
+   }
+   else
+   {
+      //The sample cannot be used to estimate the delivery rate
+      rs->delivered = 0;
+      rs->interval = 0;
+   }
+#endif
+}
+
+
+/**
+ * @brief Get the number of bytes the pacer allows to send
+ * @param[in] socket Handle referencing the current socket
+ * @return Number of bytes that can be sent now
+ **/
+
+uint32_t tcpGetPacingQuota(Socket *socket)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   uint32_t rate;
+   uint32_t burst;
+   uint64_t credit;
+   systime_t time;
+
+   //Pacing not supported by the congestion control algorithm?
+   if(socket->congestAlgo->getPacingRate == NULL)
+      return UINT32_MAX;
+
+   //Retrieve the pacing rate, in bytes per second
+   rate = socket->congestAlgo->getPacingRate(socket);
+   //Pacing disabled?
+   if(rate == 0)
+      return UINT32_MAX;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //The credit builds up at the pacing rate
+   credit = socket->pacingCredit;
+   credit += (uint64_t) rate * (time - socket->pacingTime) / 1000;
+   socket->pacingTime = time;
+
+   //The pacing timer resumes the transmission as soon as the next segment
+   //is covered, so the credit only needs to absorb the timer granularity
+   //(at least two full-sized segments)
+   burst = (uint32_t) MIN((uint64_t) rate * TCP_PACING_MAX_BURST / 1000,
+      UINT32_MAX);
+   burst = MAX(burst, 2 * socket->smss);
+
+   //Limit the size of the bursts
+   socket->pacingCredit = (uint32_t) MIN(credit, burst);
+
+   //Return the number of bytes that can be sent now
+   return socket->pacingCredit;
+#else
+   //Pacing is not implemented
+   return UINT32_MAX;
+#endif
+}
+
+
+/**
+ * @brief Schedule the next transmission allowed by the pacer
+ *
+ * This function must be called once the data allowed by the windows and by
+ * the pacer has been sent. If the transmission is only held back by the
+ * pacer, the pacing timer is started so that the next segment is sent as
+ * soon as the credit covers it, without waiting for an ACK or for the TCP
+ * tick
+ *
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpUpdatePacingTimer(Socket *socket)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   uint32_t n;
+   uint32_t u;
+   uint32_t rate;
+   systime_t delay;
+
+   //Stop the pacing timer
+   netStopTimer(&socket->pacingTimer);
+
+   //Pacing not supported by the congestion control algorithm?
+   if(socket->congestAlgo->getPacingRate == NULL)
+      return;
+
+   //Retrieve the pacing rate, in bytes per second
+   rate = socket->congestAlgo->getPacingRate(socket);
+   //Pacing disabled?
+   if(rate == 0)
+      return;
+
+   //Size of the next segment to be sent
+   n = MIN(socket->sndUser, socket->smss);
+
+   //Retrieve the size of the usable window
+   u = MIN(socket->sndWnd, socket->txBufferSize);
+   u = MIN(u, socket->cwnd);
+   u -= socket->sndNxt - socket->sndUna;
+
+   //Check whether the next segment is only held back by the pacer
+   if(n > 0 && (int32_t) u >= (int32_t) n && socket->pacingCredit < n)
+   {
+      //Time needed for the credit to cover the next segment
+      delay = (systime_t) (((uint64_t) (n - socket->pacingCredit) * 1000 +
+         rate - 1) / rate);
+
+      //Start the pacing timer
+      netStartTimer(&socket->pacingTimer, delay);
+      //Make sure the TCP/IP stack wakes up in time
+      tcpSchedulePacingTimer(&socket->pacingTimer);
+   }
+#endif
+}
+
+
+/**
+ * @brief Update the earliest pacing deadline
+ * @param[in] timer Pacing timer of a socket
+ **/
+
+void tcpSchedulePacingTimer(const NetTimer *timer)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //Check whether the deadline is earlier than the current one
+   if(!tcpPacingTimer.running || timeCompare(timer->startTime +
+      timer->interval, tcpPacingTimer.startTime + tcpPacingTimer.interval) < 0)
+   {
+      //Save the new deadline
+      tcpPacingTimer = *timer;
+
+      //The TCP/IP stack may be waiting for a later event
+      osSetEvent(&netEvent);
+   }
+#endif
+}
+
+
+/**
+ * @brief NewReno processing of an ACK that acknowledges new data
+ * @param[in] socket Handle referencing the current socket
+ * @param[in] rs Delivery rate sample
+ **/
+
+void tcpNewRenoOnAck(Socket *socket, const TcpRateSample *rs)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //The congestion window is managed by the fast recovery procedure
+   if(socket->congestState == TCP_CONGEST_STATE_RECOVERY)
+      return;
+
+   //Slow start algorithm is used when cwnd is lower than ssthresh
+   if(socket->cwnd < socket->ssthresh)
+   {
+      //During slow start, TCP increments cwnd by at most SMSS bytes for each
+      //ACK received that cumulatively acknowledges new data
+      socket->cwnd += MIN(rs->acked, socket->smss);
+   }
+   //Congestion avoidance algorithm is used when cwnd exceeds ssthres
+   else
+   {
+      //Congestion window is updated once per RTT
+      if(rs->roundTrip)
+      {
+         //TCP must not increment cwnd by more than SMSS bytes
+         socket->cwnd += MIN(socket->n, socket->smss);
+      }
+   }
+#endif
+}
+
+
+/**
+ * @brief NewReno processing of a loss detected by duplicate ACKs
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpNewRenoOnLoss(Socket *socket)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   uint32_t flightSize;
+
+   //Amount of data that has been sent but not yet acknowledged
+   flightSize = socket->sndNxt - socket->sndUna;
+   //After receiving 3 duplicate ACKs, ssthresh must be adjusted
+   socket->ssthresh = MAX(flightSize / 2, 2 * socket->smss);
+#endif
+}
+
+
+/**
+ * @brief NewReno processing of a retransmission timeout
+ * @param[in] socket Handle referencing the current socket
+ **/
+
+void tcpNewRenoOnRto(Socket *socket)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   uint32_t flightSize;
+
+   //Amount of data that has been sent but not yet acknowledged
+   flightSize = socket->sndNxt - socket->sndUna;
+   //When the retransmission timer expires, ssthresh must be adjusted
+   socket->ssthresh = MAX(flightSize / 2, 2 * socket->smss);
+#endif
+}
+
+
 /**
  * @brief Process the segment text
  * @param[in] socket Handle referencing the current socket
@@ -1421,6 +2055,11 @@ void tcpUpdateRetransmitQueue(Socket *socket)
       //expires, the segment is removed from the retransmission queue
       if(TCP_CMP_SEQ(socket->sndUna, ntohl(header->seqNum) + length) >= 0)
       {
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+         //Update the delivery rate estimator
+         tcpUpdateDeliveryState(socket, queueItem);
+#endif
+
          //First item of the queue?
          if(prevQueueItem == NULL)
          {
@@ -1582,22 +2221,27 @@ void tcpUpdateSackBlocks(Socket *socket, uint32_t *leftEdge, uint32_t *rightEdge
 
 void tcpUpdateSendWindow(Socket *socket, const TcpHeader *segment)
 {
+   uint32_t wnd;
+
+   //Retrieve the window advertised by the remote host
+   wnd = tcpDecodeWindow(socket, segment);
+
    //Case where neither the sequence nor the acknowledgment number is increased
    if(segment->seqNum == socket->sndWl1 && segment->ackNum == socket->sndWl2)
    {
       //TCP may ignore a window update with a smaller window than previously
       //offered if neither the sequence number nor the acknowledgment number
       //is increased (refer to RFC 1122, section 4.2.2.16)
-      if(segment->window > socket->sndWnd)
+      if(wnd > socket->sndWnd)
       {
          //Update the send window and record the sequence number and the
          //acknowledgment number used to update SND.WND
-         socket->sndWnd = segment->window;
+         socket->sndWnd = wnd;
          socket->sndWl1 = segment->seqNum;
          socket->sndWl2 = segment->ackNum;
 
          //Maximum send window it has seen so far on the connection
-         socket->maxSndWnd = MAX(socket->maxSndWnd, segment->window);
+         socket->maxSndWnd = MAX(socket->maxSndWnd, wnd);
       }
    }
    //Case where the sequence or the acknowledgment number is increased
@@ -1605,7 +2249,7 @@ void tcpUpdateSendWindow(Socket *socket, const TcpHeader *segment)
       TCP_CMP_SEQ(segment->ackNum, socket->sndWl2) >= 0)
    {
       //Check whether the remote host advertises a zero window
-      if(segment->window == 0 && socket->sndWnd != 0)
+      if(wnd == 0 && socket->sndWnd != 0)
       {
          //Start the persist timer
          socket->wndProbeCount = 0;
@@ -1615,12 +2259,12 @@ void tcpUpdateSendWindow(Socket *socket, const TcpHeader *segment)
 
       //Update the send window and record the sequence number and the
       //acknowledgment number used to update SND.WND
-      socket->sndWnd = segment->window;
+      socket->sndWnd = wnd;
       socket->sndWl1 = segment->seqNum;
       socket->sndWl2 = segment->ackNum;
 
       //Maximum send window it has seen so far on the connection
-      socket->maxSndWnd = MAX(socket->maxSndWnd, segment->window);
+      socket->maxSndWnd = MAX(socket->maxSndWnd, wnd);
    }
 }
 
@@ -1632,7 +2276,7 @@ void tcpUpdateSendWindow(Socket *socket, const TcpHeader *segment)
 
 void tcpUpdateReceiveWindow(Socket *socket)
 {
-   uint16_t reduction;
+   uint32_t reduction;
 
    //Space available but not yet advertised
    reduction = socket->rxBufferSize - socket->rcvUser - socket->rcvWnd;
@@ -1666,17 +2310,26 @@ void tcpUpdateReceiveWindow(Socket *socket)
 /**
  * @brief Compute retransmission timeout
  * @param[in] socket Handle referencing the socket
+ * @param[in] segment Incoming TCP segment that acknowledges new data
  * @return TRUE if the RTT measurement is complete, else FALSE
  **/
 
-bool_t tcpComputeRto(Socket *socket)
+bool_t tcpComputeRto(Socket *socket, const TcpHeader *segment)
 {
    bool_t flag;
+   bool_t valid;
    systime_t r;
    systime_t delta;
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   uint32_t tsEcr;
+   uint32_t tsNow;
+   const TcpOption *option;
+#endif
 
-   //Clear flag
+   //Clear flags
    flag = FALSE;
+   valid = FALSE;
+   r = 0;
 
    //TCP implementation takes one RTT measurement at a time
    if(socket->rttBusy)
@@ -1686,45 +2339,89 @@ bool_t tcpComputeRto(Socket *socket)
       {
          //Calculate round-time trip
          r = osGetSystemTime() - socket->rttStartTime;
+         valid = TRUE;
 
-         //First RTT measurement?
-         if(socket->srtt == 0 && socket->rttvar == 0)
-         {
-            //Initialize RTO calculation algorithm
-            socket->srtt = r;
-            socket->rttvar = r / 2;
-         }
-         else
+         //RTT measurement is complete
+         socket->rttBusy = FALSE;
+         //Set flag
+         flag = TRUE;
+      }
+   }
+
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+   //Check whether the Timestamps option has been negotiated
+   if(socket->tsEnabled)
+   {
+      //The RTT samples are taken from the Timestamps option instead, which
+      //remains unambiguous when a segment has been retransmitted (refer to
+      //RFC 7323, section 4.1)
+      valid = FALSE;
+
+      //Get the Timestamps option
+      option = tcpGetOption(segment, TCP_OPTION_TIMESTAMP);
+
+      //The TSecr field is valid in any segment that has the ACK bit set
+      if(option != NULL && option->length == 10 &&
+         (segment->flags & TCP_FLAG_ACK) != 0)
+      {
+         //Retrieve the TSecr field (0 is a valid value, since the timestamp
+         //clock starts at a random offset)
+         tsEcr = LOAD32BE(option->value + 4);
+         //Read the timestamp clock
+         tsNow = tcpGetTimestamp(socket);
+
+         //Take a single sample per round trip. The RFC 6298 gains assume one
+         //sample per RTT, and feeding them every ACK would collapse RTTVAR
+         //(refer to RFC 7323, section 4.2). The echoed TSval must therefore
+         //have been sent after the previous sample was taken
+         if(TCP_CMP_SEQ(tsEcr, socket->tsRttNext) >= 0 &&
+            TCP_CMP_SEQ(tsEcr, tsNow) <= 0)
          {
-            //Calculate the difference between the measured value and the
-            //current RTT estimator
-            delta = (r > socket->srtt) ? (r - socket->srtt) : (socket->srtt - r);
+            r = tsNow - tsEcr;
+            valid = TRUE;
 
-            //Implement Van Jacobson's algorithm (as specified in RFC 6298 2.3)
-            socket->rttvar = (3 * socket->rttvar + delta) / 4;
-            socket->srtt = (7 * socket->srtt + r) / 8;
+            //The next sample will echo a TSval sent from now on
+            socket->tsRttNext = tsNow + 1;
          }
+      }
+   }
+#endif
 
-         //Calculate the next retransmission timeout
-         socket->rto = socket->srtt + 4 * socket->rttvar;
+   //Valid RTT sample?
+   if(valid)
+   {
+      //First RTT measurement?
+      if(socket->srtt == 0 && socket->rttvar == 0)
+      {
+         //Initialize RTO calculation algorithm
+         socket->srtt = r;
+         socket->rttvar = r / 2;
+      }
+      else
+      {
+         //Calculate the difference between the measured value and the
+         //current RTT estimator
+         delta = (r > socket->srtt) ? (r - socket->srtt) : (socket->srtt - r);
 
-         //Whenever RTO is computed, if it is less than 1 second, then the RTO
-         //should be rounded up to 1 second
-         socket->rto = MAX(socket->rto, TCP_MIN_RTO);
+         //Implement Van Jacobson's algorithm (as specified in RFC 6298 2.3)
+         socket->rttvar = (3 * socket->rttvar + delta) / 4;
+         socket->srtt = (7 * socket->srtt + r) / 8;
+      }
 
-         //A maximum value may be placed on RTO provided it is at least 60
-         //seconds
-         socket->rto = MIN(socket->rto, TCP_MAX_RTO);
+      //Calculate the next retransmission timeout
+      socket->rto = socket->srtt + 4 * socket->rttvar;
 
-         //Debug message
-         TRACE_DEBUG("R=%" PRIu32 ", SRTT=%" PRIu32 ", RTTVAR=%" PRIu32 ", RTO=%" PRIu32 "\r\n",
-            r, socket->srtt, socket->rttvar, socket->rto);
+      //Whenever RTO is computed, if it is less than 1 second, then the RTO
+      //should be rounded up to 1 second
+      socket->rto = MAX(socket->rto, TCP_MIN_RTO);
 
-         //RTT measurement is complete
-         socket->rttBusy = FALSE;
-         //Set flag
-         flag = TRUE;
-      }
+      //A maximum value may be placed on RTO provided it is at least 60
+      //seconds
+      socket->rto = MIN(socket->rto, TCP_MAX_RTO);
+
+      //Debug message
+      TRACE_DEBUG("R=%" PRIu32 ", SRTT=%" PRIu32 ", RTTVAR=%" PRIu32 ", RTO=%" PRIu32 "\r\n",
+         r, socket->srtt, socket->rttvar, socket->rto);
    }
 
    //Return TRUE if the RTT measurement is complete
@@ -1794,10 +2491,37 @@ error_t tcpRetransmitSegment(Socket *socket)
          //Update ACK number
          segment->ackNum = htonl(socket->rcvNxt);
          //Update receive window
-         segment->window = htons(socket->rcvWnd);
+         segment->window = htons(tcpEncodeWindow(socket, segment->flags));
          //The checksum field is replaced with zeros
          segment->checksum = 0;
 
+#if (TCP_TIMESTAMPS_SUPPORT == ENABLED)
+         //The retransmitted segment carries the current value of the
+         //timestamp clock (refer to RFC 7323, section 4.1)
+         if(socket->tsEnabled)
+         {
+            TcpOption *option;
+
+            //Get the Timestamps option
+            option = (TcpOption *) tcpGetOption(segment, TCP_OPTION_TIMESTAMP);
+
+            //Specified option found?
+            if(option != NULL && option->length == 10)
+            {
+               //Update TSval and TSecr fields
+               STORE32BE(tcpGetTimestamp(socket), option->value);
+               STORE32BE(socket->tsRecent, option->value + 4);
+            }
+         }
+
+         //ACK flag set?
+         if((segment->flags & TCP_FLAG_ACK) != 0)
+         {
+            //Save the acknowledgment number (Last.ACK.sent)
+            socket->lastAckSent = socket->rcvNxt;
+         }
+#endif
+
          //Adjust the length of the multi-part buffer
          netBufferSetLength(buffer, offset + segment->dataOffset * 4);
 
@@ -1915,6 +2639,14 @@ error_t tcpNagleAlgo(Socket *socket, uint_t flags)
    //Retrieve the size of the usable window
    u = n - (socket->sndNxt - socket->sndUna);
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //The pacer may further limit the amount of data that can be sent
+   if((int32_t) u > 0)
+   {
+      u = MIN(u, tcpGetPacingQuota(socket));
+   }
+#endif
+
    //The Nagle algorithm discourages sending tiny segments when the data to be
    //sent increases in small increments
    while(socket->sndUser > 0 && !error)
@@ -1998,9 +2730,30 @@ error_t tcpNagleAlgo(Socket *socket, uint_t flags)
          socket->sndUser -= n;
          //Update the size of the usable window
          u -= n;
+
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+         //Consume pacing credit
+         socket->pacingCredit -= MIN(n, socket->pacingCredit);
+#endif
       }
    }
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //Resume the transmission as soon as the pacer allows it
+   tcpUpdatePacingTimer(socket);
+
+   //The sender is application-limited when it runs out of data before the
+   //congestion window is full
+   if(socket->sndUser == 0 &&
+      (socket->sndNxt - socket->sndUna) < socket->cwnd)
+   {
+      //Delivery rate samples are marked as application-limited until the
+      //data in flight has been acknowledged
+      socket->appLimited = socket->delivered + (socket->sndNxt - socket->sndUna);
+      socket->appLimited = MAX(socket->appLimited, 1);
+   }
+#endif
+
    //Check whether the transmitter can accept more data
    tcpUpdateEvents(socket);
 
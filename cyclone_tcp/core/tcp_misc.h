@@ -50,6 +50,11 @@ error_t tcpAddOption(TcpHeader *segment, uint8_t kind, const void *value,
 
 const TcpOption *tcpGetOption(const TcpHeader *segment, uint8_t kind);
 
+uint8_t tcpComputeWindowShift(size_t bufferSize);
+uint16_t tcpEncodeWindow(Socket *socket, uint8_t flags);
+uint32_t tcpDecodeWindow(Socket *socket, const TcpHeader *segment);
+uint32_t tcpGetTimestamp(Socket *socket);
+
 uint32_t tcpGenerateInitialSeqNum(const IpAddr *localIpAddr,
    uint16_t localPort, const IpAddr *remoteIpAddr, uint16_t remotePort);
 
@@ -67,6 +72,21 @@ void tcpFastRetransmit(Socket *socket);
 void tcpFastRecovery(Socket *socket, const TcpHeader *segment, uint_t n);
 void tcpFastLossRecovery(Socket *socket, const TcpHeader *segment);
 
+void tcpInitCongestControl(Socket *socket);
+void tcpSaveDeliveryState(Socket *socket, TcpQueueItem *queueItem);
+void tcpUpdateDeliveryState(Socket *socket, const TcpQueueItem *queueItem);
+
+void tcpGenerateRateSample(Socket *socket, uint32_t acked, bool_t roundTrip,
+   TcpRateSample *rs);
+
+uint32_t tcpGetPacingQuota(Socket *socket);
+void tcpUpdatePacingTimer(Socket *socket);
+void tcpSchedulePacingTimer(const NetTimer *timer);
+
+void tcpNewRenoOnAck(Socket *socket, const TcpRateSample *rs);
+void tcpNewRenoOnLoss(Socket *socket);
+void tcpNewRenoOnRto(Socket *socket);
+
 void tcpProcessSegmentData(Socket *socket, const TcpHeader *segment,
    const NetBuffer *buffer, size_t offset, size_t length);
 
@@ -81,7 +101,7 @@ void tcpUpdateSackBlocks(Socket *socket, uint32_t *leftEdge, uint32_t *rightEdge
 void tcpUpdateSendWindow(Socket *socket, const TcpHeader *segment);
 void tcpUpdateReceiveWindow(Socket *socket);
 
-bool_t tcpComputeRto(Socket *socket);
+bool_t tcpComputeRto(Socket *socket, const TcpHeader *segment);
 error_t tcpRetransmitSegment(Socket *socket);
 error_t tcpNagleAlgo(Socket *socket, uint_t flags);
 
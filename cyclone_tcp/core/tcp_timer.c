@@ -31,6 +31,7 @@
 //Dependencies
 #include "core/net.h"
 #include "core/socket.h"
+#include "core/socket_misc.h"
 #include "core/tcp.h"
 #include "core/tcp_misc.h"
 #include "core/tcp_timer.h"
@@ -75,6 +76,8 @@ void tcpTick(void)
             tcpCheckKeepAliveTimer(socket);
             //Check override timer
             tcpCheckOverrideTimer(socket);
+            //Check pacing timer
+            tcpCheckPacingTimer(socket);
             //Check FIN-WAIT-2 timer
             tcpCheckFinWait2Timer(socket);
             //Check 2MSL timer
@@ -107,12 +110,8 @@ void tcpCheckRetransmitTimer(Socket *socket)
             //the retransmission timer, the value of ssthresh must be updated
             if(socket->retransmitCount == 0)
             {
-               uint32_t flightSize;
-
-               //Amount of data that has been sent but not yet acknowledged
-               flightSize = socket->sndNxt - socket->sndUna;
                //Adjust ssthresh value
-               socket->ssthresh = MAX(flightSize / 2, 2 * socket->smss);
+               socket->congestAlgo->onRto(socket);
             }
 
             //Furthermore, upon a timeout cwnd must be set to no more than the
@@ -338,6 +337,14 @@ void tcpCheckOverrideTimer(Socket *socket)
          //Retrieve the size of the usable window
          u = n - (socket->sndNxt - socket->sndUna);
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+         //The pacer may further limit the amount of data that can be sent
+         if((int32_t) u > 0)
+         {
+            u = MIN(u, tcpGetPacingQuota(socket));
+         }
+#endif
+
          //Send as much data as possible
          while(socket->sndUser > 0)
          {
@@ -363,8 +370,18 @@ void tcpCheckOverrideTimer(Socket *socket)
             socket->sndUser -= n;
             //Update the size of the usable window
             u -= n;
+
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+            //Consume pacing credit
+            socket->pacingCredit -= MIN(n, socket->pacingCredit);
+#endif
          }
 
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+         //Resume the transmission as soon as the pacer allows it
+         tcpUpdatePacingTimer(socket);
+#endif
+
          //Check whether the transmitter can accept more data
          tcpUpdateEvents(socket);
 
@@ -378,6 +395,84 @@ void tcpCheckOverrideTimer(Socket *socket)
 }
 
 
+/**
+ * @brief Pacing timer handler
+ *
+ * This routine is called by the TCP/IP stack as soon as the earliest pacing
+ * deadline is reached, independently of the TCP tick
+ *
+ **/
+
+void tcpPacingTick(void)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   uint_t i;
+   Socket *socket;
+
+   //The deadline is recomputed from the pacing timers that are still running
+   netStopTimer(&tcpPacingTimer);
+
+   //Loop through opened sockets
+   for(i = 0; i < SOCKET_MAX_COUNT; i++)
+   {
+      //Point to the current socket
+      socket = &socketTable[i];
+
+      //TCP socket?
+      if(socket->type == SOCKET_TYPE_STREAM)
+      {
+         //Check current TCP state
+         if(socket->state != TCP_STATE_CLOSED)
+         {
+            //Check pacing timer
+            tcpCheckPacingTimer(socket);
+
+            //Pacing timer still running?
+            if(netTimerRunning(&socket->pacingTimer))
+            {
+               tcpSchedulePacingTimer(&socket->pacingTimer);
+            }
+         }
+      }
+   }
+#endif
+}
+
+
+/**
+ * @brief Check pacing timer
+ *
+ * When the congestion control algorithm paces the transmission, data may be
+ * held back even though the congestion window is open. The pacing timer
+ * expires as soon as the pacing credit covers the next segment
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpCheckPacingTimer(Socket *socket)
+{
+#if (TCP_CONGEST_CONTROL_SUPPORT == ENABLED)
+   //Check current TCP state
+   if(socket->state == TCP_STATE_ESTABLISHED ||
+      socket->state == TCP_STATE_CLOSE_WAIT)
+   {
+      //Pacing timer expired?
+      if(netTimerExpired(&socket->pacingTimer))
+      {
+         //Send as much data as the pacer allows (the timer is restarted if
+         //more data is held back)
+         tcpNagleAlgo(socket, 0);
+      }
+   }
+   else
+   {
+      //The pacer is no longer used
+      netStopTimer(&socket->pacingTimer);
+   }
+#endif
+}
+
+
 /**
  * @brief Check FIN-WAIT-2 timer
  *
@@ -433,6 +528,8 @@ void tcpCheckTimeWaitTimer(Socket *socket)
             tcpDeleteControlBlock(socket);
             //Mark the socket as closed
             socket->type = SOCKET_TYPE_UNUSED;
+            //Remove the socket from the hash tables
+            socketRemoveHash(socket);
          }
       }
    }
@@ -35,11 +35,13 @@ extern "C" {
 
 //TCP timer related functions
 void tcpTick(void);
+void tcpPacingTick(void);
 
 void tcpCheckRetransmitTimer(Socket *socket);
 void tcpCheckPersistTimer(Socket *socket);
 void tcpCheckKeepAliveTimer(Socket *socket);
 void tcpCheckOverrideTimer(Socket *socket);
+void tcpCheckPacingTimer(Socket *socket);
 void tcpCheckFinWait2Timer(Socket *socket);
 void tcpCheckTimeWaitTimer(Socket *socket);
 
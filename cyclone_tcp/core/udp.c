@@ -33,6 +33,7 @@
 #include "core/ip.h"
 #include "core/udp.h"
 #include "core/socket.h"
+#include "core/socket_misc.h"
 #include "ipv4/ipv4.h"
 #include "ipv4/ipv4_misc.h"
 #include "ipv6/ipv6.h"
@@ -124,8 +125,11 @@ error_t udpProcessDatagram(NetInterface *interface,
    error_t error;
    uint_t i;
    size_t length;
+   IpAddr srcIpAddr;
    UdpHeader *header;
    Socket *socket;
+   Socket *matchingSocket;
+   Socket *bucket[2];
    SocketQueueItem *queueItem;
    NetBuffer *p;
 
@@ -192,154 +196,197 @@ error_t udpProcessDatagram(NetInterface *interface,
       }
    }
 
-   //Loop through opened sockets
-   for(i = 0; i < SOCKET_MAX_COUNT; i++)
+#if (IPV4_SUPPORT == ENABLED)
+   //IPv4 packet received?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
    {
-      //Point to the current socket
-      socket = socketTable + i;
-
-      //UDP socket found?
-      if(socket->type != SOCKET_TYPE_DGRAM)
-         continue;
+      //Save the source IPv4 address
+      srcIpAddr.length = sizeof(Ipv4Addr);
+      srcIpAddr.ipv4Addr = pseudoHeader->ipv4Data.srcAddr;
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //IPv6 packet received?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      //Save the source IPv6 address
+      srcIpAddr.length = sizeof(Ipv6Addr);
+      srcIpAddr.ipv6Addr = pseudoHeader->ipv6Data.srcAddr;
+   }
+   else
+#endif
+   //Invalid packet received?
+   {
+      //This should never occur...
+      return ERROR_INVALID_PACKET;
+   }
 
-      //Check whether the socket is bound to a particular interface
-      if(socket->interface && socket->interface != interface)
-         continue;
+   //No matching socket for the moment
+   matchingSocket = NULL;
 
-      //Check destination port number
-      if(socket->localPort == 0 || socket->localPort != ntohs(header->destPort))
-         continue;
+   //Only the hash buckets that may contain a matching socket are searched:
+   //the bucket of connected sockets that matches the 4-tuple of the datagram
+   //and the bucket of sockets bound to the destination port
+   bucket[0] = socketConnHashTable[socketComputeConnHash(SOCKET_TYPE_DGRAM,
+      ntohs(header->destPort), &srcIpAddr, ntohs(header->srcPort))];
 
-      //Source port number filtering
-      if(socket->remotePort != 0 && socket->remotePort != ntohs(header->srcPort))
-         continue;
+   bucket[1] = socketBindHashTable[socketComputeBindHash(SOCKET_TYPE_DGRAM,
+      ntohs(header->destPort))];
 
-#if (IPV4_SUPPORT == ENABLED)
-      //IPv4 packet received?
-      if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+   //Loop through the selected hash buckets
+   for(i = 0; i < arraysize(bucket); i++)
+   {
+      //Loop through the sockets of the current bucket
+      for(socket = bucket[i]; socket != NULL; socket = socket->hashNext)
       {
-         //Check whether the socket is restricted to IPv6 communications only
-         if((socket->options & SOCKET_OPTION_IPV6_ONLY) != 0)
+         //UDP socket found?
+         if(socket->type != SOCKET_TYPE_DGRAM)
+            continue;
+
+         //Check whether the socket is bound to a particular interface
+         if(socket->interface && socket->interface != interface)
+            continue;
+
+         //Check destination port number
+         if(socket->localPort == 0 || socket->localPort != ntohs(header->destPort))
             continue;
 
-         //Check whether the destination address is a unicast, broadcast or
-         //multicast address
-         if(ipv4IsBroadcastAddr(interface, pseudoHeader->ipv4Data.destAddr))
+         //Source port number filtering
+         if(socket->remotePort != 0 && socket->remotePort != ntohs(header->srcPort))
+            continue;
+
+#if (IPV4_SUPPORT == ENABLED)
+         //IPv4 packet received?
+         if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
          {
-            //Check whether broadcast datagrams are accepted or not
-            if((socket->options & SOCKET_OPTION_BROADCAST) == 0)
+            //Check whether the socket is restricted to IPv6 communications only
+            if((socket->options & SOCKET_OPTION_IPV6_ONLY) != 0)
                continue;
-         }
-         else if(ipv4IsMulticastAddr(pseudoHeader->ipv4Data.destAddr))
-         {
-            uint_t j;
-            IpAddr *group;
 
-            //Loop through multicast groups
-            for(j = 0; j < SOCKET_MAX_MULTICAST_GROUPS; j++)
+            //Check whether the destination address is a unicast, broadcast or
+            //multicast address
+            if(ipv4IsBroadcastAddr(interface, pseudoHeader->ipv4Data.destAddr))
             {
-               //Point to the current multicast group
-               group = &socket->multicastGroups[j];
+               //Check whether broadcast datagrams are accepted or not
+               if((socket->options & SOCKET_OPTION_BROADCAST) == 0)
+                  continue;
+            }
+            else if(ipv4IsMulticastAddr(pseudoHeader->ipv4Data.destAddr))
+            {
+               uint_t j;
+               IpAddr *group;
 
-               //Matching multicast address?
-               if(group->length == sizeof(Ipv4Addr) &&
-                  group->ipv4Addr == pseudoHeader->ipv4Data.destAddr)
+               //Loop through multicast groups
+               for(j = 0; j < SOCKET_MAX_MULTICAST_GROUPS; j++)
                {
-                  break;
+                  //Point to the current multicast group
+                  group = &socket->multicastGroups[j];
+
+                  //Matching multicast address?
+                  if(group->length == sizeof(Ipv4Addr) &&
+                     group->ipv4Addr == pseudoHeader->ipv4Data.destAddr)
+                  {
+                     break;
+                  }
+               }
+
+               //Filter out non-matching multicast addresses
+               if(j >= SOCKET_MAX_MULTICAST_GROUPS)
+                  continue;
+            }
+            else
+            {
+               //Destination IP address filtering
+               if(socket->localIpAddr.length != 0)
+               {
+                  //An IPv4 address is expected
+                  if(socket->localIpAddr.length != sizeof(Ipv4Addr))
+                     continue;
+
+                  //Filter out non-matching addresses
+                  if(socket->localIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
+                     socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
+                  {
+                     continue;
+                  }
                }
             }
 
-            //Filter out non-matching multicast addresses
-            if(j >= SOCKET_MAX_MULTICAST_GROUPS)
-               continue;
+            //Source IP address filtering
+            if(socket->remoteIpAddr.length != 0)
+            {
+               //An IPv4 address is expected
+               if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
+                  continue;
+
+               //Filter out non-matching addresses
+               if(socket->remoteIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
+                  socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
+               {
+                  continue;
+               }
+            }
          }
          else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+         //IPv6 packet received?
+         if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
          {
             //Destination IP address filtering
             if(socket->localIpAddr.length != 0)
             {
-               //An IPv4 address is expected
-               if(socket->localIpAddr.length != sizeof(Ipv4Addr))
+               //An IPv6 address is expected
+               if(socket->localIpAddr.length != sizeof(Ipv6Addr))
                   continue;
 
                //Filter out non-matching addresses
-               if(socket->localIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
-                  socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
+               if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
+                  !ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
                {
                   continue;
                }
             }
-         }
-
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length != 0)
-         {
-            //An IPv4 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
-               continue;
 
-            //Filter out non-matching addresses
-            if(socket->remoteIpAddr.ipv4Addr != IPV4_UNSPECIFIED_ADDR &&
-               socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
+            //Source IP address filtering
+            if(socket->remoteIpAddr.length != 0)
             {
-               continue;
+               //An IPv6 address is expected
+               if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
+                  continue;
+
+               //Filter out non-matching addresses
+               if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
+                  !ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
+               {
+                  continue;
+               }
             }
          }
-      }
-      else
+         else
 #endif
-#if (IPV6_SUPPORT == ENABLED)
-      //IPv6 packet received?
-      if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
-      {
-         //Destination IP address filtering
-         if(socket->localIpAddr.length != 0)
+         //Invalid packet received?
          {
-            //An IPv6 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
-               !ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
-            {
-               continue;
-            }
+            //This should never occur...
+            continue;
          }
 
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length != 0)
-         {
-            //An IPv6 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &IPV6_UNSPECIFIED_ADDR) &&
-               !ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
-            {
-               continue;
-            }
-         }
-      }
-      else
-#endif
-      //Invalid packet received?
-      {
-         //This should never occur...
-         continue;
+         //The socket with the lowest descriptor takes precedence
+         if(matchingSocket == NULL || socket < matchingSocket)
+            matchingSocket = socket;
       }
-
-      //The current socket meets all the criteria
-      break;
    }
 
+   //Point to the matching socket, if any
+   socket = matchingSocket;
+
    //Point to the payload
    offset += sizeof(UdpHeader);
    length -= sizeof(UdpHeader);
 
    //No matching socket found?
-   if(i >= SOCKET_MAX_COUNT)
+   if(socket == NULL)
    {
       //Invoke user callback, if any
       error = udpInvokeRxCallback(interface, pseudoHeader, header, buffer,
@@ -965,6 +965,7 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
    error_t error;
    size_t length;
    const uint8_t *data;
+   const ResFileInfo *info;
 
    //Retrieve the full pathname
    httpGetAbsolutePath(connection, uri, connection->buffer,
@@ -985,7 +986,7 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
          //Append gzip extension
          osStrcpy(connection->buffer + n, ".gz");
          //Get the compressed resource data associated with the URI, if any
-         error = resGetData(connection->buffer, &data, &length);
+         error = resGetDataEx(connection->buffer, &data, &length, &info);
       }
       else
       {
@@ -1005,7 +1006,7 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
          connection->buffer[n] = '\0';
 
          //Get the non-compressed resource data associated with the URI
-         error = resGetData(connection->buffer, &data, &length);
+         error = resGetDataEx(connection->buffer, &data, &length, &info);
          //The specified URI cannot be found?
          if(error)
             return error;
@@ -1015,11 +1016,42 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
 #endif
    {
       //Get the resource data associated with the URI
-      error = resGetData(connection->buffer, &data, &length);
+      error = resGetDataEx(connection->buffer, &data, &length, &info);
       //The specified URI cannot be found?
       if(error)
          return error;
    }
+
+#if (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT == ENABLED)
+   //The resource compiler may provide a precomputed entity tag and
+   //modification date for the resource
+   if(info != NULL)
+   {
+      //Set ETag and Last-Modified header fields
+      connection->response.etag = info->etag;
+      connection->response.lastModified = info->date;
+
+      //Check whether the cached representation held by the client is
+      //still valid
+      if(httpCheckNotModified(connection, info->etag, info->date))
+      {
+         //Format HTTP response header
+         connection->response.statusCode = 304;
+         connection->response.contentType = NULL;
+         connection->response.chunkedEncoding = FALSE;
+         connection->response.contentLength = 0;
+
+         //Send the header to the client
+         error = httpWriteHeader(connection);
+         //Any error to report?
+         if(error)
+            return error;
+
+         //A 304 response cannot contain a message body
+         return httpCloseStream(connection);
+      }
+   }
+#endif
 #endif
 
    //Format HTTP response header
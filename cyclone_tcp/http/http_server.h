@@ -118,6 +118,13 @@
    #error HTTP_SERVER_COOKIE_SUPPORT parameter is not valid
 #endif
 
+//Conditional requests support (static resources only)
+#ifndef HTTP_SERVER_CONDITIONAL_REQ_SUPPORT
+   #define HTTP_SERVER_CONDITIONAL_REQ_SUPPORT DISABLED
+#elif (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT != ENABLED && HTTP_SERVER_CONDITIONAL_REQ_SUPPORT != DISABLED)
+   #error HTTP_SERVER_CONDITIONAL_REQ_SUPPORT parameter is not valid
+#endif
+
 //Stack size required to run the HTTP server
 #ifndef HTTP_SERVER_STACK_SIZE
    #define HTTP_SERVER_STACK_SIZE 650
@@ -278,6 +285,20 @@
    #error HTTP_SERVER_COOKIE_MAX_LEN parameter is not valid
 #endif
 
+//Maximum length for If-None-Match header field
+#ifndef HTTP_SERVER_IF_NONE_MATCH_MAX_LEN
+   #define HTTP_SERVER_IF_NONE_MATCH_MAX_LEN 63
+#elif (HTTP_SERVER_IF_NONE_MATCH_MAX_LEN < 23)
+   #error HTTP_SERVER_IF_NONE_MATCH_MAX_LEN parameter is not valid
+#endif
+
+//Maximum length for If-Modified-Since header field
+#ifndef HTTP_SERVER_IF_MODIFIED_SINCE_MAX_LEN
+   #define HTTP_SERVER_IF_MODIFIED_SINCE_MAX_LEN 31
+#elif (HTTP_SERVER_IF_MODIFIED_SINCE_MAX_LEN < 29)
+   #error HTTP_SERVER_IF_MODIFIED_SINCE_MAX_LEN parameter is not valid
+#endif
+
 //Application specific context
 #ifndef HTTP_SERVER_PRIVATE_CONTEXT
    #define HTTP_SERVER_PRIVATE_CONTEXT
@@ -505,6 +526,10 @@ typedef struct
 #if (HTTP_SERVER_COOKIE_SUPPORT == ENABLED)
    char_t cookie[HTTP_SERVER_COOKIE_MAX_LEN + 1];            ///<Cookie header field
 #endif
+#if (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT == ENABLED)
+   char_t ifNoneMatch[HTTP_SERVER_IF_NONE_MATCH_MAX_LEN + 1];         ///<If-None-Match header field
+   char_t ifModifiedSince[HTTP_SERVER_IF_MODIFIED_SINCE_MAX_LEN + 1]; ///<If-Modified-Since header field
+#endif
 } HttpRequest;
 
 
@@ -533,6 +558,10 @@ typedef struct
 #if (HTTP_SERVER_COOKIE_SUPPORT == ENABLED)
    char_t setCookie[HTTP_SERVER_COOKIE_MAX_LEN + 1]; ///<Set-Cookie header field
 #endif
+#if (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT == ENABLED)
+   const char_t *etag;                               ///<ETag header field
+   const char_t *lastModified;                       ///<Last-Modified header field
+#endif
 } HttpResponse;
 
 
@@ -485,6 +485,22 @@ void httpParseHeaderField(HttpConnection *connection,
       httpParseCookieField(connection, value);
    }
 #endif
+#if (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT == ENABLED)
+   //If-None-Match header field?
+   else if(!osStrcasecmp(name, "If-None-Match"))
+   {
+      //Save the list of entity tags (the field is ignored if too long)
+      if(osStrlen(value) <= HTTP_SERVER_IF_NONE_MATCH_MAX_LEN)
+         osStrcpy(connection->request.ifNoneMatch, value);
+   }
+   //If-Modified-Since header field?
+   else if(!osStrcasecmp(name, "If-Modified-Since"))
+   {
+      //Save the date (the field is ignored if too long)
+      if(osStrlen(value) <= HTTP_SERVER_IF_MODIFIED_SINCE_MAX_LEN)
+         osStrcpy(connection->request.ifModifiedSince, value);
+   }
+#endif
 }
 
 
@@ -913,6 +929,22 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
    }
 #endif
 
+#if (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT == ENABLED)
+   //Valid entity tag?
+   if(connection->response.etag != NULL)
+   {
+      //Set ETag field
+      p += osSprintf(p, "ETag: %s\r\n", connection->response.etag);
+   }
+
+   //Valid modification date?
+   if(connection->response.lastModified != NULL)
+   {
+      //Set Last-Modified field
+      p += osSprintf(p, "Last-Modified: %s\r\n", connection->response.lastModified);
+   }
+#endif
+
    //Use chunked encoding transfer?
    if(connection->response.chunkedEncoding)
    {
@@ -934,6 +966,68 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
 }
 
 
+/**
+ * @brief Evaluate the preconditions of a conditional GET request
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[in] etag Entity tag of the selected representation
+ * @param[in] lastModified Modification date of the selected representation
+ * @return TRUE if the server can answer with a 304 status code, else FALSE
+ **/
+
+bool_t httpCheckNotModified(HttpConnection *connection, const char_t *etag,
+   const char_t *lastModified)
+{
+#if (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT == ENABLED)
+   bool_t notModified;
+   char_t *p;
+   char_t *token;
+   char_t *value;
+
+   //Initialize flag
+   notModified = FALSE;
+
+   //A recipient must ignore If-Modified-Since if the request contains an
+   //If-None-Match header field (refer to RFC 7232, section 3.3)
+   if(connection->request.ifNoneMatch[0] != '\0')
+   {
+      //Get the first entity tag of the list
+      token = osStrtok_r(connection->request.ifNoneMatch, ",", &p);
+
+      //Parse the comma-separated list
+      while(token != NULL && !notModified)
+      {
+         //Trim whitespace characters
+         value = strTrimWhitespace(token);
+
+         //If-None-Match uses the weak comparison function
+         if(!osStrncmp(value, "W/", 2))
+            value += 2;
+
+         //Check whether the entity tag matches the current representation
+         if(!osStrcmp(value, "*") || !osStrcmp(value, etag))
+            notModified = TRUE;
+
+         //Get next entity tag
+         token = osStrtok_r(NULL, ",", &p);
+      }
+   }
+   else if(connection->request.ifModifiedSince[0] != '\0')
+   {
+      //Clients usually echo the Last-Modified value of the cached response.
+      //Any other date is conservatively considered as a modification
+      if(!osStrcmp(connection->request.ifModifiedSince, lastModified))
+         notModified = TRUE;
+   }
+
+   //Return TRUE if the selected representation has not been modified
+   return notModified;
+#else
+   //Conditional requests are not supported
+   return FALSE;
+#endif
+}
+
+
 /**
  * @brief Send data to the client
  * @param[in] connection Structure representing an HTTP connection
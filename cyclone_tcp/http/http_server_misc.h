@@ -62,6 +62,9 @@ error_t httpReadChunkSize(HttpConnection *connection);
 void httpInitResponseHeader(HttpConnection *connection);
 error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer);
 
+bool_t httpCheckNotModified(HttpConnection *connection, const char_t *etag,
+   const char_t *lastModified);
+
 error_t httpSend(HttpConnection *connection,
    const void *data, size_t length, uint_t flags);
 
@@ -183,6 +183,8 @@ struct _SnmpAgentContext
    int32_t msgId;                                             ///<Message identifier
    uint64_t salt;                                             ///<Integer initialized to a random value at boot time
    uint8_t privParameters[8];                                 ///<Privacy parameters
+   HmacPreparedKey authPreparedKey;                           ///<Pre-processed authentication key
+   SnmpKey authPreparedKeyValue;                              ///<Localized key the pre-processed key derives from
 #endif
 #if (SNMP_AGENT_INFORM_SUPPORT == ENABLED)
    SnmpAgentState informState;                                ///<State of the inform sending process
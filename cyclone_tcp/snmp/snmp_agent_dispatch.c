@@ -379,7 +379,7 @@ error_t snmpv3ProcessMessage(SnmpAgentContext *context)
       if((context->request.msgFlags & SNMP_MSG_FLAG_AUTH) != 0)
       {
          //Authenticate incoming SNMP message
-         error = snmpAuthIncomingMessage(&context->user, &context->request);
+         error = snmpAuthIncomingMessage(context, &context->user, &context->request);
          //Data authentication failed?
          if(error)
             break;
@@ -475,7 +475,7 @@ error_t snmpv3ProcessMessage(SnmpAgentContext *context)
       if((context->response.msgFlags & SNMP_MSG_FLAG_AUTH) != 0)
       {
          //Authenticate outgoing SNMP message
-         error = snmpAuthOutgoingMessage(&context->user, &context->response);
+         error = snmpAuthOutgoingMessage(context, &context->user, &context->response);
          //Any error to report?
          if(error)
             return error;
@@ -155,7 +155,7 @@ error_t snmpFormatInformRequestMessage(SnmpAgentContext *context,
       if((context->response.msgFlags & SNMP_MSG_FLAG_AUTH) != 0)
       {
          //Authenticate outgoing SNMP message
-         error = snmpAuthOutgoingMessage(&context->user, &context->response);
+         error = snmpAuthOutgoingMessage(context, &context->user, &context->response);
          //Any error to report?
          if(error)
             return error;
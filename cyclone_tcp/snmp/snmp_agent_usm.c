@@ -447,15 +447,66 @@ error_t snmpCheckEngineTime(SnmpAgentContext *context, SnmpMessage *message)
 }
 
 
+/**
+ * @brief Pre-process the authentication key of the specified user
+ *
+ * The HMAC key is only pre-processed when the localized authentication key
+ * differs from the one used for the previous message
+ *
+ * @param[in] context Pointer to the SNMP agent context
+ * @param[in] user Security profile of the user
+ * @param[in] hashAlgo Hash algorithm to be used for HMAC computation
+ * @return Error code
+ **/
+
+error_t snmpPrepareAuthKey(SnmpAgentContext *context,
+   const SnmpUserEntry *user, const HashAlgo *hashAlgo)
+{
+   error_t error;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Check whether the key has already been pre-processed
+   if(context->authPreparedKey.hash != hashAlgo ||
+      osMemcmp(context->authPreparedKeyValue.b, user->localizedAuthKey.b,
+      hashAlgo->digestSize) != 0)
+   {
+      //Digest the inner and outer padded keys
+      error = hmacPrepareKey(&context->authPreparedKey, hashAlgo,
+         user->localizedAuthKey.b, hashAlgo->digestSize);
+
+      //Check status code
+      if(!error)
+      {
+         //Save the localized key
+         osMemcpy(context->authPreparedKeyValue.b, user->localizedAuthKey.b,
+            hashAlgo->digestSize);
+      }
+      else
+      {
+         //Invalidate the pre-processed key
+         context->authPreparedKey.hash = NULL;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Authenticate outgoing SNMP message
+ * @param[in] context Pointer to the SNMP agent context
  * @param[in] user Security profile of the user
  * @param[in,out] message Pointer to the outgoing SNMP message
  * @return Error code
  **/
 
-error_t snmpAuthOutgoingMessage(const SnmpUserEntry *user, SnmpMessage *message)
+error_t snmpAuthOutgoingMessage(SnmpAgentContext *context,
+   const SnmpUserEntry *user, SnmpMessage *message)
 {
+   error_t error;
    const HashAlgo *hashAlgo;
    size_t macLen;
    HmacContext hmacContext;
@@ -474,8 +525,14 @@ error_t snmpAuthOutgoingMessage(const SnmpUserEntry *user, SnmpMessage *message)
    if(message->msgAuthParametersLen != macLen)
       return ERROR_FAILURE;
 
+   //Pre-process the authentication key
+   error = snmpPrepareAuthKey(context, user, hashAlgo);
+   //Any error to report?
+   if(error)
+      return ERROR_FAILURE;
+
    //The MAC is calculated over the whole message
-   hmacInit(&hmacContext, hashAlgo, user->localizedAuthKey.b, hashAlgo->digestSize);
+   hmacInitPrepared(&hmacContext, &context->authPreparedKey);
    hmacUpdate(&hmacContext, message->pos, message->length);
    hmacFinal(&hmacContext, NULL);
 
@@ -489,13 +546,16 @@ error_t snmpAuthOutgoingMessage(const SnmpUserEntry *user, SnmpMessage *message)
 
 /**
  * @brief Authenticate incoming SNMP message
+ * @param[in] context Pointer to the SNMP agent context
  * @param[in] user Security profile of the user
  * @param[in] message Pointer to the incoming SNMP message
  * @return Error code
  **/
 
-error_t snmpAuthIncomingMessage(const SnmpUserEntry *user, SnmpMessage *message)
+error_t snmpAuthIncomingMessage(SnmpAgentContext *context,
+   const SnmpUserEntry *user, SnmpMessage *message)
 {
+   error_t error;
    const HashAlgo *hashAlgo;
    size_t macLen;
    uint8_t mac[SNMP_MAX_TRUNCATED_MAC_SIZE];
@@ -515,6 +575,12 @@ error_t snmpAuthIncomingMessage(const SnmpUserEntry *user, SnmpMessage *message)
    if(message->msgAuthParametersLen != macLen)
       return ERROR_AUTHENTICATION_FAILED;
 
+   //Pre-process the authentication key
+   error = snmpPrepareAuthKey(context, user, hashAlgo);
+   //Any error to report?
+   if(error)
+      return ERROR_AUTHENTICATION_FAILED;
+
    //The MAC received in the msgAuthenticationParameters field is saved
    osMemcpy(mac, message->msgAuthParameters, macLen);
 
@@ -523,7 +589,7 @@ error_t snmpAuthIncomingMessage(const SnmpUserEntry *user, SnmpMessage *message)
    osMemset(message->msgAuthParameters, 0, macLen);
 
    //The MAC is calculated over the whole message
-   hmacInit(&hmacContext, hashAlgo, user->localizedAuthKey.b, hashAlgo->digestSize);
+   hmacInitPrepared(&hmacContext, &context->authPreparedKey);
    hmacUpdate(&hmacContext, message->buffer, message->bufferLen);
    hmacFinal(&hmacContext, NULL);
 
@@ -33,6 +33,7 @@
 #include "snmp/snmp_agent.h"
 #include "mibs/mib_common.h"
 #include "core/crypto.h"
+#include "mac/hmac.h"
 
 //Time window for replay protection
 #ifndef SNMP_TIME_WINDOW
@@ -338,8 +339,14 @@ error_t snmpCheckSecurityParameters(const SnmpUserEntry *user,
 void snmpRefreshEngineTime(SnmpAgentContext *context);
 error_t snmpCheckEngineTime(SnmpAgentContext *context, SnmpMessage *message);
 
-error_t snmpAuthOutgoingMessage(const SnmpUserEntry *user, SnmpMessage *message);
-error_t snmpAuthIncomingMessage(const SnmpUserEntry *user, SnmpMessage *message);
+error_t snmpPrepareAuthKey(SnmpAgentContext *context,
+   const SnmpUserEntry *user, const HashAlgo *hashAlgo);
+
+error_t snmpAuthOutgoingMessage(SnmpAgentContext *context,
+   const SnmpUserEntry *user, SnmpMessage *message);
+
+error_t snmpAuthIncomingMessage(SnmpAgentContext *context,
+   const SnmpUserEntry *user, SnmpMessage *message);
 
 error_t snmpEncryptData(const SnmpUserEntry *user, SnmpMessage *message,
    uint64_t *salt);
@@ -0,0 +1,182 @@
+/**
+ * @file crypto_config.h
+ * @brief CycloneCRYPTO configuration file
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _CRYPTO_CONFIG_H
+#define _CRYPTO_CONFIG_H
+
+//Desired trace level (for debugging purposes)
+#define CRYPTO_TRACE_LEVEL TRACE_LEVEL_OFF
+
+//Route the library allocations through the benchmark so that the heap
+//high-water mark of each operation can be recorded
+void *benchAllocMem(size_t size);
+void benchFreeMem(void *p);
+
+#define cryptoAllocMem(size) benchAllocMem(size)
+#define cryptoFreeMem(p) benchFreeMem(p)
+
+//Multiple precision integer support
+#define MPI_SUPPORT ENABLED
+//Assembly optimizations for time-critical routines
+#define MPI_ASM_SUPPORT DISABLED
+
+//MD5 hash support
+#define MD5_SUPPORT ENABLED
+//SHA-1 hash support
+#define SHA1_SUPPORT ENABLED
+//SHA-224 hash support
+#define SHA224_SUPPORT ENABLED
+//SHA-256 hash support
+#define SHA256_SUPPORT ENABLED
+//SHA-384 hash support
+#define SHA384_SUPPORT ENABLED
+//SHA-512 hash support
+#define SHA512_SUPPORT ENABLED
+//SHA3-256 hash support
+#define SHA3_256_SUPPORT ENABLED
+//SHA3-512 hash support
+#define SHA3_512_SUPPORT ENABLED
+//SHAKE support
+#define SHAKE_SUPPORT ENABLED
+//Keccak support
+#define KECCAK_SUPPORT ENABLED
+//BLAKE2b support
+#define BLAKE2B_SUPPORT ENABLED
+//BLAKE2b-512 hash support
+#define BLAKE2B512_SUPPORT ENABLED
+//BLAKE2s support
+#define BLAKE2S_SUPPORT ENABLED
+//BLAKE2s-256 hash support
+#define BLAKE2S256_SUPPORT ENABLED
+//SM3 hash support
+#define SM3_SUPPORT ENABLED
+
+//AES support
+#define AES_SUPPORT ENABLED
+//Camellia support
+#define CAMELLIA_SUPPORT ENABLED
+//ARIA support
+#define ARIA_SUPPORT ENABLED
+//SM4 support
+#define SM4_SUPPORT ENABLED
+//Triple DES support
+#define DES3_SUPPORT ENABLED
+//DES support
+#define DES_SUPPORT ENABLED
+//RC4 support
+#define RC4_SUPPORT ENABLED
+//ChaCha support
+#define CHACHA_SUPPORT ENABLED
+
+//ECB mode support
+#define ECB_SUPPORT ENABLED
+//CBC mode support
+#define CBC_SUPPORT ENABLED
+//CFB mode support
+#define CFB_SUPPORT ENABLED
+//OFB mode support
+#define OFB_SUPPORT ENABLED
+//CTR mode support
+#define CTR_SUPPORT ENABLED
+//XTS mode support
+#define XTS_SUPPORT ENABLED
+//CCM mode support
+#define CCM_SUPPORT ENABLED
+//GCM mode support
+#define GCM_SUPPORT ENABLED
+//ChaCha20Poly1305 support
+#define CHACHA20_POLY1305_SUPPORT ENABLED
+
+//HMAC support
+#define HMAC_SUPPORT ENABLED
+//CMAC support
+#define CMAC_SUPPORT ENABLED
+//GMAC support
+#define GMAC_SUPPORT ENABLED
+//Poly1305 support
+#define POLY1305_SUPPORT ENABLED
+
+//HKDF support
+#define HKDF_SUPPORT ENABLED
+//PBKDF support
+#define PBKDF_SUPPORT ENABLED
+//scrypt support
+#define SCRYPT_SUPPORT ENABLED
+//Parallel evaluation of the scrypt blocks
+#define SCRYPT_PARALLEL_SUPPORT ENABLED
+
+//CTR_DRBG PRNG support
+#define CTR_DRBG_SUPPORT ENABLED
+
+//RSA support
+#define RSA_SUPPORT ENABLED
+//Elliptic curve cryptography support
+#define EC_SUPPORT ENABLED
+//ECDH support
+#define ECDH_SUPPORT ENABLED
+//ECDSA support
+#define ECDSA_SUPPORT ENABLED
+//secp256r1 elliptic curve support
+#define SECP256R1_SUPPORT ENABLED
+//Constant-time P-256 engine (fixed-size limbs, no heap)
+#ifndef P256_ENGINE_SUPPORT
+   #define P256_ENGINE_SUPPORT ENABLED
+#endif
+//secp384r1 elliptic curve support
+#define SECP384R1_SUPPORT ENABLED
+//Curve25519 elliptic curve support
+#define X25519_SUPPORT ENABLED
+//Ed25519 elliptic curve support
+#define ED25519_SUPPORT ENABLED
+
+//KEM support
+#define KEM_SUPPORT ENABLED
+//ML-KEM-512 key encapsulation mechanism support
+#define MLKEM512_SUPPORT ENABLED
+//ML-KEM-768 key encapsulation mechanism support
+#define MLKEM768_SUPPORT ENABLED
+//ML-KEM-1024 key encapsulation mechanism support
+#define MLKEM1024_SUPPORT ENABLED
+//Streamlined NTRU Prime 761 key encapsulation mechanism support (liboqs)
+#define SNTRUP761_SUPPORT DISABLED
+
+//Cache of parsed certificates and verified signatures
+#define X509_CACHE_SUPPORT ENABLED
+
+//x86-64 accelerated port (set by the X86_64_CRYPTO CMake option)
+#ifndef X86_64_CRYPTO_SUPPORT
+   #define X86_64_CRYPTO_SUPPORT DISABLED
+#endif
+
+//The accelerated functions replace the portable ones
+#if (X86_64_CRYPTO_SUPPORT == ENABLED)
+   #define X86_64_CRYPTO_CIPHER_SUPPORT ENABLED
+   #define X86_64_CRYPTO_HASH_SUPPORT ENABLED
+   #include "hardware/x86_64/x86_64_crypto_config.h"
+#endif
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ * @file bench.h
+ * @brief CycloneCRYPTO benchmark framework
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _BENCH_H
+#define _BENCH_H
+
+//Dependencies
+#include "core/crypto.h"
+
+//Size of the stack area painted to measure the stack high-water mark
+#ifndef BENCH_STACK_PAINT_SIZE
+   #define BENCH_STACK_PAINT_SIZE 65536
+#elif (BENCH_STACK_PAINT_SIZE < 256)
+   #error BENCH_STACK_PAINT_SIZE parameter is not valid
+#endif
+
+//Default minimum duration of each measurement, in milliseconds
+#ifndef BENCH_DEFAULT_MIN_TIME
+   #define BENCH_DEFAULT_MIN_TIME 200
+#elif (BENCH_DEFAULT_MIN_TIME < 1)
+   #error BENCH_DEFAULT_MIN_TIME parameter is not valid
+#endif
+
+//Software primality test (RSA key generation otherwise relies on a
+//hardware accelerator)
+#ifndef BENCH_PRIME_TEST_SUPPORT
+   #define BENCH_PRIME_TEST_SUPPORT ENABLED
+#elif (BENCH_PRIME_TEST_SUPPORT != ENABLED && BENCH_PRIME_TEST_SUPPORT != DISABLED)
+   #error BENCH_PRIME_TEST_SUPPORT parameter is not valid
+#endif
+
+//Largest message processed by the symmetric benchmarks
+#ifndef BENCH_MAX_MSG_SIZE
+   #define BENCH_MAX_MSG_SIZE 65536
+#elif (BENCH_MAX_MSG_SIZE < 16384)
+   #error BENCH_MAX_MSG_SIZE parameter is not valid
+#endif
+
+//Cycle counter (the MCU ports may map this macro to DWT->CYCCNT)
+#ifndef BENCH_GET_CYCLES
+   #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+      #include <x86intrin.h>
+      #define BENCH_GET_CYCLES() ((uint64_t) __rdtsc())
+   #endif
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Output format
+ **/
+
+typedef enum
+{
+   BENCH_FORMAT_TEXT = 0,
+   BENCH_FORMAT_JSON = 1
+} BenchFormat;
+
+
+/**
+ * @brief Operation to be measured
+ **/
+
+typedef error_t (*BenchFunc)(void *param);
+
+
+/**
+ * @brief Benchmark settings
+ **/
+
+typedef struct
+{
+   BenchFormat format;    ///<Output format
+   uint32_t minTime;      ///<Minimum duration of each measurement, in milliseconds
+   const char_t *filter;  ///<Only run the benchmarks whose name contains this string
+} BenchSettings;
+
+
+/**
+ * @brief Result of a measurement
+ **/
+
+typedef struct
+{
+   const char_t *category; ///<Algorithm family (hash, cipher, aead, mac, kdf, pkc, kem, rng, pkix)
+   const char_t *algo;     ///<Algorithm name
+   const char_t *op;       ///<Operation
+   size_t size;            ///<Message size, in bytes (0 for fixed-size operations)
+   uint32_t iterations;    ///<Number of operations performed
+   uint64_t time;          ///<Total duration, in nanoseconds
+   uint64_t cycles;        ///<Total number of cycles (0 if no cycle counter)
+   size_t heapPeak;        ///<Heap high-water mark of a single operation, in bytes
+   size_t stackPeak;       ///<Stack high-water mark of a single operation, in bytes
+} BenchResult;
+
+
+//Global variables
+extern BenchSettings benchSettings;
+extern uint8_t benchInput[BENCH_MAX_MSG_SIZE];
+extern uint8_t benchOutput[BENCH_MAX_MSG_SIZE + 64];
+extern const size_t benchMsgSizes[];
+extern const uint_t benchNumMsgSizes;
+extern const PrngAlgo *benchPrngAlgo;
+extern void *benchPrngContext;
+
+//Benchmark framework
+error_t benchInit(void);
+void benchBegin(void);
+void benchEnd(void);
+
+bool_t benchSelected(const char_t *category, const char_t *algo,
+   const char_t *op);
+
+error_t benchRun(const char_t *category, const char_t *algo,
+   const char_t *op, size_t size, BenchFunc func, void *param);
+
+void benchFailed(const char_t *category, const char_t *algo,
+   const char_t *op, error_t error);
+
+void benchReport(const BenchResult *result);
+
+uint64_t benchGetTime(void);
+uint64_t benchGetCycles(void);
+
+uintptr_t benchPaintStack(void);
+size_t benchMeasureStack(uintptr_t top);
+
+void *benchAllocMem(size_t size);
+void benchFreeMem(void *p);
+
+//Known-answer tests
+error_t benchKat(void);
+error_t benchPkixKat(void);
+
+//Benchmark suites
+void benchHash(void);
+void benchCipher(void);
+void benchAead(void);
+void benchMac(void);
+void benchKdf(void);
+void benchPkc(void);
+void benchKem(void);
+void benchRng(void);
+void benchPkix(void);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
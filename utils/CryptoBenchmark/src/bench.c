@@ -0,0 +1,580 @@
+/**
+ * @file bench.c
+ * @brief CycloneCRYPTO benchmark framework
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * Each operation is first run once to record its heap and stack high-water
+ * marks. The heap usage is tracked by the allocation hooks installed in
+ * crypto_config.h, and the stack usage is measured by painting the unused
+ * area below the current stack pointer before the call and looking for the
+ * deepest overwritten byte after it. The operation is then repeated until the
+ * minimum measurement time is reached
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include "core/crypto.h"
+#include "rng/yarrow.h"
+#include "bench.h"
+
+#if (X86_64_CRYPTO_SUPPORT == ENABLED)
+   #include "hardware/x86_64/x86_64_crypto.h"
+#endif
+
+#if defined(USE_POSIX)
+   #include <time.h>
+#endif
+
+//Prevent the compiler from inlining the stack painting functions
+#if defined(__GNUC__)
+   #define BENCH_NOINLINE __attribute__((noinline))
+#else
+   #define BENCH_NOINLINE
+#endif
+
+//Pattern used to paint the stack
+#define BENCH_STACK_PATTERN 0xA5
+//Unpainted gap reserved for the frame of the painting function
+#define BENCH_STACK_GUARD_SIZE 256
+
+//Benchmark settings
+BenchSettings benchSettings =
+{
+   BENCH_FORMAT_TEXT,
+   BENCH_DEFAULT_MIN_TIME,
+   NULL
+};
+
+//Input and output buffers
+uint8_t benchInput[BENCH_MAX_MSG_SIZE];
+uint8_t benchOutput[BENCH_MAX_MSG_SIZE + 64];
+
+//Message sizes used by the symmetric benchmarks
+const size_t benchMsgSizes[] = {16, 64, 256, 1024, 8192, 16384};
+const uint_t benchNumMsgSizes = arraysize(benchMsgSizes);
+
+//Pseudo-random number generator
+static YarrowContext benchYarrowContext;
+const PrngAlgo *benchPrngAlgo = YARROW_PRNG_ALGO;
+void *benchPrngContext = &benchYarrowContext;
+
+//Heap usage
+static size_t benchHeapCurrent;
+static size_t benchHeapPeak;
+
+//Number of results reported so far
+static uint_t benchNumResults;
+
+
+/**
+ * @brief Initialize the benchmark framework
+ * @return Error code
+ **/
+
+error_t benchInit(void)
+{
+   error_t error;
+   size_t i;
+   uint8_t seed[32];
+
+   //Fill the input buffer with a fixed pattern
+   for(i = 0; i < BENCH_MAX_MSG_SIZE; i++)
+   {
+      benchInput[i] = (uint8_t) (i * 31 + 7);
+   }
+
+   //The PRNG is seeded with a constant so that successive runs perform
+   //the same computations
+   for(i = 0; i < sizeof(seed); i++)
+   {
+      seed[i] = (uint8_t) i;
+   }
+
+#if (X86_64_CRYPTO_SUPPORT == ENABLED)
+   //Detect the instruction set extensions supported by the CPU
+   error = x86_64CryptoInit();
+   //Any error to report?
+   if(error)
+      return error;
+#endif
+
+   //Initialize PRNG
+   error = yarrowInit(&benchYarrowContext);
+
+   //Check status code
+   if(!error)
+   {
+      //Seed the PRNG
+      error = yarrowSeed(&benchYarrowContext, seed, sizeof(seed));
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Start the report
+ **/
+
+void benchBegin(void)
+{
+   //Reset the number of results
+   benchNumResults = 0;
+
+   //Check output format
+   if(benchSettings.format == BENCH_FORMAT_JSON)
+   {
+      printf("{\n  \"library\": \"CycloneCRYPTO\",\n");
+      printf("  \"version\": \"%s\",\n", CYCLONE_CRYPTO_VERSION_STRING);
+      printf("  \"min_time_ms\": %u,\n", (uint_t) benchSettings.minTime);
+      printf("  \"results\": [");
+   }
+   else
+   {
+      printf("%-7s %-22s %-8s %6s %14s %10s %10s %9s %9s\r\n", "Family",
+         "Algorithm", "Op", "Size", "Ops/s", "MB/s", "Cycles/B", "Heap",
+         "Stack");
+   }
+}
+
+
+/**
+ * @brief Terminate the report
+ **/
+
+void benchEnd(void)
+{
+   //Check output format
+   if(benchSettings.format == BENCH_FORMAT_JSON)
+   {
+      printf("\n  ]\n}\n");
+   }
+}
+
+
+/**
+ * @brief Check whether an operation matches the user-defined filter
+ * @param[in] category Algorithm family
+ * @param[in] algo Algorithm name
+ * @param[in] op Operation
+ * @return TRUE if the operation is to be measured, else FALSE
+ **/
+
+bool_t benchSelected(const char_t *category, const char_t *algo,
+   const char_t *op)
+{
+   char_t name[64];
+
+   //No filter?
+   if(benchSettings.filter == NULL)
+      return TRUE;
+
+   //The filter is matched against "category/algorithm/operation"
+   snprintf(name, sizeof(name), "%s/%s/%s", category, algo, op);
+
+   //Check whether the name contains the filter
+   return (osStrstr(name, benchSettings.filter) != NULL) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief Measure an operation
+ * @param[in] category Algorithm family
+ * @param[in] algo Algorithm name
+ * @param[in] op Operation
+ * @param[in] size Message size, in bytes (0 for fixed-size operations)
+ * @param[in] func Function performing a single operation
+ * @param[in] param Parameter passed to the function
+ * @return Error code
+ **/
+
+error_t benchRun(const char_t *category, const char_t *algo,
+   const char_t *op, size_t size, BenchFunc func, void *param)
+{
+   error_t error;
+   uint32_t i;
+   uint32_t n;
+   uint64_t time;
+   uint64_t cycles;
+   size_t heapBase;
+   uintptr_t stackTop;
+   BenchResult result;
+
+   //Skip the benchmark if the name does not match the user-defined filter
+   if(!benchSelected(category, algo, op))
+      return NO_ERROR;
+
+   //Clear the result
+   osMemset(&result, 0, sizeof(BenchResult));
+   result.category = category;
+   result.algo = algo;
+   result.op = op;
+   result.size = size;
+
+   //Warm up the caches (and resolve lazily bound symbols, whose resolver
+   //would otherwise show up in the stack measurement)
+   error = func(param);
+
+   //Any error to report?
+   if(error)
+   {
+      benchFailed(category, algo, op, error);
+      return error;
+   }
+
+   //Record the heap and stack high-water marks of a single operation
+   heapBase = benchHeapCurrent;
+   benchHeapPeak = benchHeapCurrent;
+
+   stackTop = benchPaintStack();
+   error = func(param);
+   result.stackPeak = benchMeasureStack(stackTop);
+   result.heapPeak = benchHeapPeak - heapBase;
+
+   //Any error to report?
+   if(error)
+   {
+      benchFailed(category, algo, op, error);
+      return error;
+   }
+
+   //Repeat the operation until the minimum measurement time is reached
+   for(n = 1; ; n *= 2)
+   {
+      //Start of the measurement
+      time = benchGetTime();
+      cycles = benchGetCycles();
+
+      //Perform the operation n times
+      for(i = 0; i < n && !error; i++)
+      {
+         error = func(param);
+      }
+
+      //End of the measurement
+      time = benchGetTime() - time;
+      cycles = benchGetCycles() - cycles;
+
+      //Exit immediately in case of failure
+      if(error)
+         return error;
+
+      //Long enough?
+      if(time >= ((uint64_t) benchSettings.minTime * 1000000) ||
+         n >= 0x80000000)
+      {
+         break;
+      }
+   }
+
+   //Save the measurement
+   result.iterations = n;
+   result.time = time;
+   result.cycles = cycles;
+
+   //Print the result
+   benchReport(&result);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Report a failed operation
+ * @param[in] category Algorithm family
+ * @param[in] algo Algorithm name
+ * @param[in] op Operation
+ * @param[in] error Error code
+ **/
+
+void benchFailed(const char_t *category, const char_t *algo,
+   const char_t *op, error_t error)
+{
+   fprintf(stderr, "%s/%s/%s failed (error %d)\r\n", category, algo, op,
+      error);
+}
+
+
+/**
+ * @brief Print the result of a measurement
+ * @param[in] result Pointer to the result
+ **/
+
+void benchReport(const BenchResult *result)
+{
+   double opsPerSec;
+   double bytesPerSec;
+   double cyclesPerOp;
+
+   //Compute the throughput
+   opsPerSec = (double) result->iterations * 1e9 / (double) result->time;
+   bytesPerSec = opsPerSec * (double) result->size;
+   cyclesPerOp = (double) result->cycles / (double) result->iterations;
+
+   //Check output format
+   if(benchSettings.format == BENCH_FORMAT_JSON)
+   {
+      //Separate the records
+      printf("%s\n    {\"category\": \"%s\", \"algo\": \"%s\", \"op\": \"%s\", ",
+         (benchNumResults > 0) ? "," : "", result->category, result->algo,
+         result->op);
+
+      printf("\"size\": %u, \"iterations\": %lu, \"ns_per_op\": %.1f, ",
+         (uint_t) result->size, (unsigned long) result->iterations,
+         (double) result->time / (double) result->iterations);
+
+      printf("\"ops_per_sec\": %.1f, ", opsPerSec);
+
+      //Throughput is only meaningful for variable-size messages
+      if(result->size > 0)
+      {
+         printf("\"bytes_per_sec\": %.0f, ", bytesPerSec);
+      }
+      else
+      {
+         printf("\"bytes_per_sec\": null, ");
+      }
+
+      //Cycle counts are only available on some platforms
+      if(result->cycles > 0)
+      {
+         printf("\"cycles_per_op\": %.1f, ", cyclesPerOp);
+
+         if(result->size > 0)
+         {
+            printf("\"cycles_per_byte\": %.2f, ", cyclesPerOp /
+               (double) result->size);
+         }
+         else
+         {
+            printf("\"cycles_per_byte\": null, ");
+         }
+      }
+      else
+      {
+         printf("\"cycles_per_op\": null, \"cycles_per_byte\": null, ");
+      }
+
+      printf("\"heap_peak\": %u, \"stack_peak\": %u}",
+         (uint_t) result->heapPeak, (uint_t) result->stackPeak);
+   }
+   else
+   {
+      printf("%-7s %-22s %-8s %6u %14.1f ", result->category, result->algo,
+         result->op, (uint_t) result->size, opsPerSec);
+
+      //Throughput is only meaningful for variable-size messages
+      if(result->size > 0)
+      {
+         printf("%10.2f ", bytesPerSec / 1e6);
+      }
+      else
+      {
+         printf("%10s ", "-");
+      }
+
+      //Cycle counts are only available on some platforms
+      if(result->cycles > 0 && result->size > 0)
+      {
+         printf("%10.2f ", cyclesPerOp / (double) result->size);
+      }
+      else
+      {
+         printf("%10s ", "-");
+      }
+
+      printf("%9u %9u\r\n", (uint_t) result->heapPeak,
+         (uint_t) result->stackPeak);
+   }
+
+   //Flush the output so that partial results are not lost
+   fflush(stdout);
+
+   //Increment the number of results
+   benchNumResults++;
+}
+
+
+/**
+ * @brief Get current time
+ * @return Time in nanoseconds
+ **/
+
+uint64_t benchGetTime(void)
+{
+#if defined(USE_POSIX)
+   struct timespec ts;
+
+   //Use the monotonic clock
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   //Convert the time to nanoseconds
+   return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+#else
+   //Fall back to the system tick counter
+   return (uint64_t) osGetSystemTime64() * 1000000;
+#endif
+}
+
+
+/**
+ * @brief Get current value of the cycle counter
+ * @return Number of cycles (0 if no cycle counter is available)
+ **/
+
+uint64_t benchGetCycles(void)
+{
+#if defined(BENCH_GET_CYCLES)
+   return BENCH_GET_CYCLES();
+#else
+   return 0;
+#endif
+}
+
+
+/**
+ * @brief Paint the unused area of the stack used by the next call
+ *
+ * The stack is assumed to grow downwards. The area painted lies below the
+ * frame of this function, which sits right below the frame of the caller.
+ * The returned address must be passed to benchMeasureStack() once the
+ * operation to be measured has been called from the same function
+ *
+ * @return Top of the painted area
+ **/
+
+BENCH_NOINLINE uintptr_t benchPaintStack(void)
+{
+   size_t i;
+   uintptr_t top;
+   volatile uint8_t *p;
+
+   //Get the current position in the stack
+#if defined(__GNUC__)
+   top = (uintptr_t) __builtin_frame_address(0);
+#else
+   top = (uintptr_t) &p;
+#endif
+
+   //Point to the bottom of the area to be painted
+   p = (volatile uint8_t *) (top - BENCH_STACK_GUARD_SIZE -
+      BENCH_STACK_PAINT_SIZE);
+
+   //Fill the area with a known pattern
+   for(i = 0; i < BENCH_STACK_PAINT_SIZE; i++)
+   {
+      p[i] = BENCH_STACK_PATTERN;
+   }
+
+   //Return the top of the painted area
+   return top;
+}
+
+
+/**
+ * @brief Measure the stack high-water mark of the previous call
+ * @param[in] top Value returned by benchPaintStack()
+ * @return Number of bytes of stack that have been used below the caller
+ **/
+
+BENCH_NOINLINE size_t benchMeasureStack(uintptr_t top)
+{
+   size_t i;
+   volatile const uint8_t *p;
+
+   //Point to the bottom of the painted area
+   p = (volatile const uint8_t *) (top - BENCH_STACK_GUARD_SIZE -
+      BENCH_STACK_PAINT_SIZE);
+
+   //Search for the deepest byte that has been overwritten
+   for(i = 0; i < BENCH_STACK_PAINT_SIZE; i++)
+   {
+      if(p[i] != BENCH_STACK_PATTERN)
+         break;
+   }
+
+   //Return the distance between the top of the area and the deepest
+   //overwritten byte
+   return BENCH_STACK_PAINT_SIZE + BENCH_STACK_GUARD_SIZE - i;
+}
+
+
+/**
+ * @brief Allocate memory on behalf of the library
+ * @param[in] size Number of bytes to allocate
+ * @return Pointer to the allocated block
+ **/
+
+void *benchAllocMem(size_t size)
+{
+   size_t *p;
+
+   //Reserve room for the size of the block (16 bytes to preserve alignment)
+   p = osAllocMem(size + 16);
+
+   //Successful memory allocation?
+   if(p != NULL)
+   {
+      //Save the size of the block
+      p[0] = size;
+
+      //Update the heap usage
+      benchHeapCurrent += size;
+      benchHeapPeak = MAX(benchHeapPeak, benchHeapCurrent);
+
+      //Return a pointer to the usable area
+      p = (size_t *) ((uint8_t *) p + 16);
+   }
+
+   //Return a pointer to the allocated block
+   return p;
+}
+
+
+/**
+ * @brief Release memory allocated by benchAllocMem()
+ * @param[in] p Pointer to the memory block
+ **/
+
+void benchFreeMem(void *p)
+{
+   size_t *q;
+
+   //Valid pointer?
+   if(p != NULL)
+   {
+      //Point to the beginning of the block
+      q = (size_t *) ((uint8_t *) p - 16);
+
+      //Update the heap usage
+      benchHeapCurrent -= q[0];
+
+      //Release the block
+      osFreeMem(q);
+   }
+}
@@ -0,0 +1,1556 @@
+/**
+ * @file bench_kat.c
+ * @brief Known-answer tests
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * The outputs of the optimized implementations are checked byte for byte
+ * against reference values before any measurement is made. The Keccak
+ * vectors cover the empty message, messages whose length is a multiple of
+ * the rate, outputs longer than the rate, incremental absorption and
+ * squeezing, and the multi-lane API with full and partial groups. The
+ * SHA-1 and SHA-2 vectors cover one-shot, incremental and multi-lane
+ * hashing. The AES vectors cover single blocks (FIPS-197) and the ECB, CBC
+ * and CTR modes. The AEAD vectors cover GCM and ChaCha20Poly1305, including
+ * the rejection of a modified tag. Long outputs are checked through their
+ * SHA-256 digest. The reference values were obtained from independent
+ * implementations. When the x86-64 port is compiled in, the tests are run a
+ * second time through the portable code
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include "core/crypto.h"
+#include "hash/sha3_256.h"
+#include "hash/sha3_512.h"
+#include "xof/shake.h"
+#include "xof/keccak.h"
+#include "hash/sha1.h"
+#include "hash/sha256.h"
+#include "hash/sha512.h"
+#include "cipher/aes.h"
+#include "cipher_modes/ecb.h"
+#include "cipher_modes/cbc.h"
+#include "cipher_modes/ctr.h"
+#include "aead/gcm.h"
+#include "aead/chacha20_poly1305.h"
+#include "bench.h"
+
+#if (X86_64_CRYPTO_SUPPORT == ENABLED)
+   #include "hardware/x86_64/x86_64_crypto.h"
+#endif
+
+//Length of the longest generated message
+#define BENCH_KAT_MAX_MSG_SIZE 1000
+//Number of generated messages of each length
+#define BENCH_KAT_NUM_MESSAGES 8
+//Length of the generated message encrypted by the AES tests (whole blocks)
+#define BENCH_KAT_AES_MSG_SIZE 992
+
+#if (SHA3_256_SUPPORT == ENABLED && SHA3_512_SUPPORT == ENABLED && \
+   SHAKE_SUPPORT == ENABLED)
+
+//Length of the SHAKE128 and SHAKE256 reference outputs
+#define BENCH_KAT_SHAKE128_OUTPUT_SIZE 176
+#define BENCH_KAT_SHAKE256_OUTPUT_SIZE 64
+//Number of messages of each length in the Keccak vector set
+#define BENCH_KAT_NUM_SEEDS 4
+
+
+/**
+ * @brief Keccak reference vector
+ **/
+
+typedef struct
+{
+   const char_t *label;     ///<Description of the message
+   const char_t *message;   ///<Message (NULL if made of a repeated byte)
+   uint8_t fill;            ///<Value of the repeated byte
+   size_t length;           ///<Length of the message
+   const char_t *sha3_256;  ///<SHA3-256 digest
+   const char_t *sha3_512;  ///<SHA3-512 digest
+   const char_t *shake128;  ///<First bytes of the SHAKE128 output
+   const char_t *shake256;  ///<First bytes of the SHAKE256 output
+} BenchKatKeccakVector;
+
+
+/**
+ * @brief Keccak reference vector for a generated message
+ **/
+
+typedef struct
+{
+   size_t length;           ///<Length of the message
+   uint_t seed;             ///<Seed of the message generator
+   const char_t *sha3_256;  ///<SHA3-256 digest
+   const char_t *shake128;  ///<First bytes of the SHAKE128 output
+} BenchKatKeccakLaneVector;
+
+
+//Reference vectors for messages from the SHA-3 and SHAKE test suites
+static const BenchKatKeccakVector benchKatKeccakVectors[] =
+{
+   {
+      "Empty message", "", 0x00, 0,
+      "A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A",
+      "A69F73CCA23A9AC5C8B567DC185A756E97C982164FE25859E0D1DCC1475C80A6"
+      "15B2123AF1F5F94C11E3E9402C3AC558F500199D95B6D3E301758586281DCD26",
+      "7F9C2BA4E88F827D616045507605853ED73B8093F6EFBC88EB1A6EACFA66EF26"
+      "3CB1EEA988004B93103CFB0AEEFD2A686E01FA4A58E8A3639CA8A1E3F9AE57E2"
+      "35B8CC873C23DC62B8D260169AFA2F75AB916A58D974918835D25E6A435085B2"
+      "BADFD6DFAAC359A5EFBB7BCC4B59D538DF9A04302E10C8BC1CBF1A0B3A5120EA"
+      "17CDA7CFAD765F5623474D368CCCA8AF0007CD9F5E4C849F167A580B14AABDEF"
+      "AEE7EEF47CB0FCA9767BE1FDA69419DF",
+      "46B9DD2B0BA88D13233B3FEB743EEB243FCD52EA62B81B82B50C27646ED5762F"
+      "D75DC4DDD8C0F200CB05019D67B592F6FC821C49479AB48640292EACB3B7C4BE"
+   },
+   {
+      "\"abc\"", "abc", 0x00, 3,
+      "3A985DA74FE225B2045C172D6BD390BD855F086E3E9D525B46BFE24511431532",
+      "B751850B1A57168A5693CD924B6B096E08F621827444F70D884F5D0240D2712E"
+      "10E116E9192AF3C91A7EC57647E3934057340B4CF408D5A56592F8274EEC53F0",
+      "5881092DD818BF5CF8A3DDB793FBCBA74097D5C526A6D35F97B83351940F2CC8"
+      "44C50AF32ACD3F2CDD066568706F509BC1BDDE58295DAE3F891A9A0FCA578378"
+      "9A41F8611214CE612394DF286A62D1A2252AA94DB9C538956C717DC2BED4F232"
+      "A0294C857C730AA16067AC1062F1201FB0D377CFB9CDE4C63599B27F3462BBA4"
+      "A0ED296C801F9FF7F57302BB3076EE145F97A32AE68E76AB66C48D51675BD49A"
+      "CC29082F5647584E6AA01B3F5AF05780",
+      "483366601360A8771C6863080CC4114D8DB44530F8F1E1EE4F94EA37E78B5739"
+      "D5A15BEF186A5386C75744C0527E1FAA9F8726E462A12A4FEB06BD8801E751E4"
+   },
+   {
+      "200 bytes of 0xA3", NULL, 0xA3, 200,
+      "79F38ADEC5C20307A98EF76E8324AFBFD46CFD81B22E3973C65FA1BD9DE31787",
+      "E76DFAD22084A8B1467FCF2FFA58361BEC7628EDF5F3FDC0E4805DC48CAEECA8"
+      "1B7C13C30ADF52A3659584739A2DF46BE589C51CA1A4A8416DF6545A1CE8BA00",
+      "131AB8D2B594946B9C81333F9BB6E0CE75C3B93104FA3469D3917457385DA037"
+      "CF232EF7164A6D1EB448C8908186AD852D3F85A5CF28DA1AB6FE343817197846"
+      "7F1C05D58C7EF38C284C41F6C2221A76F12AB1C04082660250802294FB871802"
+      "13FDEF5B0ECB7DF50CA1F8555BE14D32E10F6EDCDE892C09424B29F597AFC270"
+      "C904556BFCB47A7D40778D390923642B3CBD0579E60908D5A000C1D08B98EF93"
+      "3F806445BF87F8B009BA9E94F7266122",
+      "CD8A920ED141AA0407A22D59288652E9D9F1A7EE0C1E7C1CA699424DA84A904D"
+      "2D700CAAE7396ECE96604440577DA4F3AA22AEB8857F961C4CD8E06F0AE6610B"
+   }
+};
+
+//Reference vectors for the generated messages (the messages of a given
+//length are processed in lockstep by the multi-lane tests)
+static const BenchKatKeccakLaneVector benchKatKeccakLaneVectors[] =
+{
+   {
+      0, 0,
+      "A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A",
+      "7F9C2BA4E88F827D616045507605853ED73B8093F6EFBC88EB1A6EACFA66EF26"
+      "3CB1EEA988004B93103CFB0AEEFD2A686E01FA4A58E8A3639CA8A1E3F9AE57E2"
+      "35B8CC873C23DC62B8D260169AFA2F75AB916A58D974918835D25E6A435085B2"
+      "BADFD6DFAAC359A5EFBB7BCC4B59D538DF9A04302E10C8BC1CBF1A0B3A5120EA"
+      "17CDA7CFAD765F5623474D368CCCA8AF0007CD9F5E4C849F167A580B14AABDEF"
+      "AEE7EEF47CB0FCA9767BE1FDA69419DF"
+   },
+   {
+      0, 1,
+      "A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A",
+      "7F9C2BA4E88F827D616045507605853ED73B8093F6EFBC88EB1A6EACFA66EF26"
+      "3CB1EEA988004B93103CFB0AEEFD2A686E01FA4A58E8A3639CA8A1E3F9AE57E2"
+      "35B8CC873C23DC62B8D260169AFA2F75AB916A58D974918835D25E6A435085B2"
+      "BADFD6DFAAC359A5EFBB7BCC4B59D538DF9A04302E10C8BC1CBF1A0B3A5120EA"
+      "17CDA7CFAD765F5623474D368CCCA8AF0007CD9F5E4C849F167A580B14AABDEF"
+      "AEE7EEF47CB0FCA9767BE1FDA69419DF"
+   },
+   {
+      0, 2,
+      "A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A",
+      "7F9C2BA4E88F827D616045507605853ED73B8093F6EFBC88EB1A6EACFA66EF26"
+      "3CB1EEA988004B93103CFB0AEEFD2A686E01FA4A58E8A3639CA8A1E3F9AE57E2"
+      "35B8CC873C23DC62B8D260169AFA2F75AB916A58D974918835D25E6A435085B2"
+      "BADFD6DFAAC359A5EFBB7BCC4B59D538DF9A04302E10C8BC1CBF1A0B3A5120EA"
+      "17CDA7CFAD765F5623474D368CCCA8AF0007CD9F5E4C849F167A580B14AABDEF"
+      "AEE7EEF47CB0FCA9767BE1FDA69419DF"
+   },
+   {
+      0, 3,
+      "A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A",
+      "7F9C2BA4E88F827D616045507605853ED73B8093F6EFBC88EB1A6EACFA66EF26"
+      "3CB1EEA988004B93103CFB0AEEFD2A686E01FA4A58E8A3639CA8A1E3F9AE57E2"
+      "35B8CC873C23DC62B8D260169AFA2F75AB916A58D974918835D25E6A435085B2"
+      "BADFD6DFAAC359A5EFBB7BCC4B59D538DF9A04302E10C8BC1CBF1A0B3A5120EA"
+      "17CDA7CFAD765F5623474D368CCCA8AF0007CD9F5E4C849F167A580B14AABDEF"
+      "AEE7EEF47CB0FCA9767BE1FDA69419DF"
+   },
+   {
+      136, 0,
+      "BF55DD8C0B4DD0F226D019F9B85D74E3D77CD13409E1306665A44CC688A93D6E",
+      "73681D0342AABCB50F5F50B0E5DFF20113750DAED75F0A2DDB263966A2905701"
+      "7D8D590B63F689AD6C5ED8540A24555C66717B28D2F5AE2458C1AA38E6C2EDED"
+      "F61D36DF36B8A591A7B5BB737FB6888511237A9129B990489298BDBDA928580F"
+      "8F719D8610CE2318C5214EFA9EE332FD01B7472EC27CE33DCB090E4163D97508"
+      "53F80BA271A26F0C1E31179AC0473DE04F6328FA639A6452CA8D4D12A9669C9C"
+      "2B8E92CF405E1EF93FA93F2F3E6E7985"
+   },
+   {
+      136, 1,
+      "D1980B4518CED4C9B62F3AD095F823CAACCC495E4E9C6484E8F2C1EBDC33E924",
+      "8EE2982362A37657EB62AD2E814FF8F6EF137776453A65A21430381BB2974821"
+      "BE0F2E7F2FD55FA3642084D408D1435018497AB73C873EAFD73EBA236F9796B2"
+      "16839186928EC3FD146CE9982312793288E65E15F3232BE01AC7324FFFCC77F9"
+      "205B887ED6A040E02DA79DBAF4734BD281D533B615C9ADCD4322677428AE084E"
+      "6E7AC31C1A3A9069F6B900AD890368025B568145814E5F396F611943BB5B3B3B"
+      "46B7797FC745342E89C21E38EA4BC02E"
+   },
+   {
+      136, 2,
+      "6233F6DF7B0FA0CD547109449C2459DB584F86A7308EC5AA46E2F3B03D33241A",
+      "D1C2F0AB44F206BEE319C03F44756455C5EBBCD8024FDC8E67DA0D0274ACC697"
+      "C0B86DAA854E7FAA114B4E469EDEEFAEB5455E7564E9B6F75DB0CD2110705E14"
+      "4E86E82DE87AC9ECD3A1C64CBFBB4A1EA9449D74D051FE502E031F2CBA2FED8A"
+      "0531A1BF5FCE237A74E89217792585BBCBC87B71132217D8D6E50C9DE20A8076"
+      "DBF867ABC292B7F16F6469E71A1A14D23DD0C08DBCAA23B3082240EF92BDFDAF"
+      "4661B7F1FEEFEF22ABD982744A93FF4D"
+   },
+   {
+      136, 3,
+      "78855445042AFA89DFDD664D25B1F9356495EDA408067F220F08D063E7C8B89C",
+      "43C31CEC1D698551644D22CC347E0F2822AAE1B1401097E22F003DA5E2C1687E"
+      "0778AEC7577DB33769EC2D303267AB1389A7D6EC74E2E05C3F7376B55F29DBEB"
+      "C68EB439287541F201C2F90AAFEB9D0AA40712D4535D6AB7B305336A3C686BE5"
+      "A9D0CF0A877E2041671A65155BDEFD4EACC53D2C16FBCA742A06E7576162FDD2"
+      "5C17791F786ABFC5409A1BB62B45C6CA4BB8C7D817CFEABB5904D76934B05801"
+      "58060AA210E3F57189A377EC82A56112"
+   },
+   {
+      168, 0,
+      "52721F3B517C6521539677E4252D4C7C550EEACFD2BEFA64699E5B27FB19C7E3",
+      "ED300818A030AF92239F7140176A0E468FAD27EA97B3F01578817E8E80F16FCE"
+      "12253D73F19161A3E432F9FF6A2CCD6D9A8C5F2DC66006FB02F32ACA812D5AD2"
+      "082FAFDB66B32A81C5DA47CA29918199993E80BBDE517D1F3021F00463FCE090"
+      "7E84183D4C8D3CB0D1CB57243CE76964185890B19D663663920A4B8422047458"
+      "65F68662916EF695257B218F94D3F0B0BE9BFE7F665ABEB956CB07A801421FF8"
+      "80CBEC4F5D04CDE0BE368B480A6A323C"
+   },
+   {
+      168, 1,
+      "3E8B707086CA93C4D69035BB09E56E5A55D917FF56BC4150D7084FA536C0B43E",
+      "67F1C4F5C2A9BDC9E3BFCBA1730092DF32F0F40C2F2AB7D34557C5FDAEFD9E9F"
+      "590D086FE434C1CFD0095408C0F75EA06DE1516446174B916C23EF6D1D122FCB"
+      "379A3AB300686355AB2E84B42C20276C977608C1598CD19F5AD680C6A031946B"
+      "A2549B95B897EB69EB61EAB7306F9C3BBE0CF1C50BEB5D386F0956E7009A10C6"
+      "569BE529D79C7DEB1E9A16DF5E62B793F403CCB91541EC0293D68C2DA3BEA2A9"
+      "B71D72D1ADBEE2DEF9F66E6E9F9E2C3C"
+   },
+   {
+      168, 2,
+      "3315E11F6B0C5177EC3B07B14728E19B7F6D81AD8A2AA0102D8D34B03459819B",
+      "033C4C6A1B0F50542A4D7F0283548D26104E2EDB01CCD8A80777F6A8C6556FC0"
+      "77FD987CB1618369507CEF6055CCFC6F64AC5698F8F5A5B858A2BAA750821DD0"
+      "3D84B4B0E91E18860F27D5E90EFC8B401BC907A25074FFA27DC3B8C50A06F33A"
+      "9292B49412754670D55E18ECB80D4AC6FAED13B3840727A84D3EDBB3FE6619B2"
+      "9C746B5EDCF1FF1B24F9CD298D83B39F1C4821946E443989D5817E6BB3E03D64"
+      "8433FA81AB1A250906A9F7494F9D0209"
+   },
+   {
+      168, 3,
+      "66A35C0D887888743A0333FB1AD2F361C77130DD08AAE6873EAD8315D9C9C89E",
+      "3A235814455D8E4A627969912D49549783BE5ADB9329D8ACB82128A9964037ED"
+      "CD63BE50D321FC6DD85E727225175DC43251A4CD9AE6D0DCF17DBAC9A1F269E9"
+      "17373B59BC5D0D2E53FB1F9996B188A89B94A203FF2B5F8EA88916909BD21FC6"
+      "735AEF84A6FC321BA8266C4E7B64DD13910B3C985106152DEAF9C4A716F7F2F8"
+      "EDF245998EE3BB3CAE4D7065810C4E2CD1DC68169B6001B71FA4DA991C57A0E1"
+      "06426C6730D7CBD5685C7AE030A31529"
+   },
+   {
+      1000, 0,
+      "E9612E6ECFC2FC3C9467302E2563D3155906EAF49E0BB663E460791EF2FEC839",
+      "B0E0C141CE415F44188AA69075387C0AF2114A07797FD7FFD9A9AFE7257B9AD3"
+      "AA04808403907446CF81AE5FF616A12B4700F0EC1240254D5FD8322ED42D6A28"
+      "CCF253BA573046BA49CD001120B0ED33AEABC548682F6012188948CFF1ED71CE"
+      "E2717EE6FD973DC78CF7B92774F3C35A0404F330FA320BAC55671569D28D34CB"
+      "949BAE31783D8D5CB1BAA0200B3C8E4DFB73A9F3F1DE9A4A893C309990FFE27B"
+      "A8D33EB148C2556CB822E67C49BA45DC"
+   },
+   {
+      1000, 1,
+      "413A158564A9B168AE36E7A1F9A015B9A88A907B5EF096B514CC1BE9DCC17B76",
+      "4E0F8B1F1771E3EC48AB43C9C720345988B91D958E8487413259EC5A417B671E"
+      "99DDB9C70446594AD9B8AAFA7615A2312EFA67261A05874072D3EE2FD14D38BC"
+      "B9D73361C8407147E86E95149CE6A821E9CE9E7843870F97279FBD5DC13D0D67"
+      "5309A2CB0B66627020E017A2E904131F0C3F202469F5EE6391D0746466C68507"
+      "E90817FA4E403940CA2A1FA6D3B500DF73C62A2B458D8AA2BCA1B1732E1236DA"
+      "8CB72B40350580137767E09581D1F64F"
+   },
+   {
+      1000, 2,
+      "7680A7C4837F22606F06B21404A061E01E36FBF62F7C752A8E0F2078B4DC703A",
+      "C6032C623B2EE2F19481F810787F539C17B9CADFA7872F2ADAB064D1F893FFDB"
+      "89AACBDA0E8B1E1417605C5B46096FC95E302DD1FE38DD72E3657A1E7504B1A7"
+      "07A59C38E1CC20477F3A6D06718D551C68C4674F3A1ADAC05C4D15CB398E9303"
+      "49A069AE7C4BDBADCD3BE547C0D5F9ACE66931AE018566D25DFCACE2BA93166F"
+      "C13B7148C622DA1D53C8ABA37ECC832BBE51FF07DE0A02CB759C0FE971F091A5"
+      "A97BE6C00EBA52F0C383D1116A0682CF"
+   },
+   {
+      1000, 3,
+      "FD3F335B06EB76666D5615EEE2CBF5C84C2F65489601F472DDAE48458EBA42C0",
+      "DF87BC23D93CA6C5C22D88D2B94286C04946120347C212B73E9664D7170E7610"
+      "E8BE9C588AD8E0A10C07C5BA00493E93376FB473A72EAC0FA9308A535EEBE29A"
+      "D083A65B8945AD47E19128BE465E874D9069E8DCE20CBC660E00039AC56ECFE4"
+      "3C6646A4FE684CF0CD66DF90D001531EA8A300F4A02B8F296304C67066BB4083"
+      "1458F7659C4C8B7F1E8A09250B360CB5B52F3038CDB17934F0B9C0A85671E043"
+      "F6AA1F9C3F81184BB0CA2A2B4C076E9B"
+   }
+};
+
+#endif
+
+#if (SHA1_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED && \
+   SHA512_SUPPORT == ENABLED)
+
+
+/**
+ * @brief SHA-1 and SHA-2 reference vector for a generated message
+ **/
+
+typedef struct
+{
+   size_t length;           ///<Length of the message
+   uint_t seed;             ///<Seed of the message generator
+   const char_t *sha1;      ///<SHA-1 digest
+   const char_t *sha256;    ///<SHA-256 digest
+   const char_t *sha512;    ///<SHA-512 digest
+} BenchKatShaVector;
+
+
+//Reference vectors for the generated messages. 120 bytes require an
+//additional padding block with both block sizes (the messages of a given
+//length are processed in lockstep by the multi-lane tests)
+static const BenchKatShaVector benchKatShaVectors[] =
+{
+   {
+      120, 0,
+      "353F6D2BF0E91AA91B74A2E0B3F297510F7D825F",
+      "1F80156A804CB7862AD113E8200E9D74499723E7C7854D5F48776D3148E09656",
+      "F138C42E1F58DA8B1E7A14810A424CBE8B1BAA4976B7853F4C9A856609FEA684"
+      "A6E9EE070ABE81B88F3289B6711687EB751DA453942E4EB6E5609212E8B08739"
+   },
+   {
+      120, 1,
+      "B3D17E515BBB1D8F2DC131CAA0A1DACEA1418CC3",
+      "52A17E152225CDF217C554A3B1F76FEF089E1FD62A75784362E7363E39CA9FC4",
+      "F3F8978AF26D820A36325862EA307ECB0C700EE72F34F578E494A2AAFEDAD63E"
+      "17E5C4E6CE3B749031AE517437D69D3B1EB4AD8439E251FB8B352F06D284C384"
+   },
+   {
+      120, 2,
+      "8D8C14D816A438A8C5FA71982908C405A8FD7153",
+      "A77CD6788B75E795BC2127333A286C7ABDED07EC87E6BF3256291A39794FF5B2",
+      "A9850E2F0D089DCA07ACBB809FD832F9085A7EF38CCA2C210E1FBA3B89328668"
+      "F458E971D2FC5ED7E4BF97C0EF477813B33F1730E4D08FAA632D68ADCAFB5852"
+   },
+   {
+      120, 3,
+      "406364B5CAF44DCAAF8982CB694F83DB83D40B26",
+      "A5621D14D92CF715F630C3DDB7FABD0F684B6059FD42E1A6A8C831A43A708F89",
+      "76C96207AD73EA07E36E6D26DD21CD9A54D4B493ECA1D91538E4493793FD27F7"
+      "389BA762F8DB7B25E23893C444CC94DCEEEB307F5CD83F4B36A3F31F53EFD8A2"
+   },
+   {
+      120, 4,
+      "AC963526D5669FD461A827BE3551C3B6C4C2B033",
+      "9942C8856D97B237D7D271066987161758E828282227F24F91420CEDB8B3048F",
+      "5A96E51ACB6A22F5ED4EE1BEC553810302CA50AED3F918F4A77EA865E2F5F6B6"
+      "AF8C1CDCD1EFB0E73347087C3E18B79ADFB0BF1F3A94E7F21C0C0860E7D2CA68"
+   },
+   {
+      120, 5,
+      "F24A724971C69FB626D08BC0CD627CDAA7A8A700",
+      "E4FCE14F6AA99657BDFFE9F1DA59CE85F0398479E9AF7E9DE6CCF53E174447AB",
+      "9F891B0F2B3973D3AE50219EB453EEC7B37C76890A3FECF480A24D499BDFEC99"
+      "A7A3F3BA103106255EA029654E7E4B4A7B7FFF4DA5C867C52886E2F3933F1614"
+   },
+   {
+      120, 6,
+      "D797AF588129DD31D08194269E02C7F987AA1B52",
+      "268914CBD7562228CE936DF5B1BC1F89FAA57357C93744F537B3C89791701FCC",
+      "88902DFCF78518AD41B477A9F4E631F35C156D7E79CE1FE193EE1C07059CF037"
+      "F228C4140F393681B308E79F3468B9DB40B32F4343E826D4C63D2C5542A9F159"
+   },
+   {
+      120, 7,
+      "ABD525F1E65DA8F9CD1BF1967BE9B2C828B7A7C4",
+      "2A22C5AA9242E46E867AB966BA4179B067F11D6B0EF95C197FB639AD187053C6",
+      "456F864341844577FD27B5FC290F399AA4E4EAE3120CDEF72A31E13C28B433BC"
+      "8796B3C83790233174C9FD714B953F331341AAE03C015A13BCF03A4D75D21784"
+   },
+   {
+      1000, 0,
+      "414475341017EC91703435A6F290324818F983E9",
+      "5097E7D587352F5097062AE679F37BDA5802D9F875ABA14C8CB4D1A188ADA179",
+      "B41D42E106ECA6BF57123566B7ED1550C37D33AF23AFBFA8E302DFD44C988B30"
+      "03A26B4140EF42F535E66EA424E7C4A31616307269E6D520A6508F726DA23D0A"
+   },
+   {
+      1000, 1,
+      "C6A8EB06B0852091AE90EFF8E841EC635D375DA3",
+      "DBE3FCB58FE17A91CFE1D3F851000C85DE7539989184253F9E452B58FD31F5B0",
+      "532611F256FD94937C6D983066FA5D31C28B6635FCEC308B6E80FEE07E5A2BFB"
+      "E1003B20D1CA4539F5DE0E487EFDA36598F85607E8B94741698F3F5CE7EFC4DD"
+   },
+   {
+      1000, 2,
+      "8423AC0119E18AA4F075333ACE66FC074243ED08",
+      "0597DA09A3F4F0D0EE7C39FB7F484518B9E3166170A657956A26D40F3EA464BC",
+      "84F99519081E051F2B4D80C20057B019AE64792D6FAC2EB33CDBE9D794DDBE61"
+      "F9B4CD8783979007EE2B01C516B0EF115FFBA5E449003D9C89CB63B2AEF467EB"
+   },
+   {
+      1000, 3,
+      "CB094C8B22CE6A66225CA7F7AC65A92136A157A8",
+      "8EBD048CBDDA5032BBAF0F42F8B4C0014B6CA5EB9BD16ACFF7509536AE65AF89",
+      "55168D3296B5F39ED46EB89407048B649479513369100BA6586A42AD31E0A159"
+      "6A868802217AB4929110A13045637ADC3C7B651DB38C940A16C511BC8F1F440C"
+   },
+   {
+      1000, 4,
+      "E00DEAED8FDE0E25CAFF878F11CE1932126729FE",
+      "B26C9EA944780F34B3B373F445B731570403CC38DCC3BBC629B92F561A88E24E",
+      "DBA9C64118D94DC0700C9ABC714FFCFD90347719E13CE53D0975CCD6C113453E"
+      "4B910FF52FB975EFF9FF43730038ED6A75C6693ECEC53CFAF0A3CB3015C3AA54"
+   },
+   {
+      1000, 5,
+      "6D8E2F33DBD4328B794D66BE4D1ABBEC1C6F0FBB",
+      "945ACDF575D6A2430BF4D6163E1D03B4B0B896FCEF107C8B24BF7FF07A621FA3",
+      "8A61EAD00D8FE5381604579F3E5FBFEECED02C3BDBE130618E26CE9971F005D5"
+      "B629253264FDEF166D9F4D2A11B1B1C064343E07F4BE328AAF16B43239C9C3E0"
+   },
+   {
+      1000, 6,
+      "831483B5994892CF0891523F6BA50C09DAD1873E",
+      "BF62A6B44406B26B9146C347DBB5980FCEEC248092A99FC54F0566250094F370",
+      "C19E94DFF0BC0642172C7EC7FE54F1FE320EEEB0F74ADBDED36C61F7C2F99A92"
+      "39B56277E95FD526E8BD3296B59205CD9B7F64E7764EB985A7CF993E65C3C441"
+   },
+   {
+      1000, 7,
+      "F1CC41E710BB3E104177FB163DF257CCE22C98F0",
+      "36298D449AD11E4AAB6596C4F40A2651B47290CC2F6631AC8AD0DAD28BACF5E5",
+      "38E87FE90C27B98AC01BF12AF04E2F162B2355035CE06E245E80A46FB97588BB"
+      "559FC7ABB9D964BFA42652CE2F7670DB0D289CB4D7E1DBDC64E78B8978CB5A15"
+   }
+};
+
+#endif
+
+#if (AES_SUPPORT == ENABLED && ECB_SUPPORT == ENABLED && \
+   CBC_SUPPORT == ENABLED && CTR_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+
+
+/**
+ * @brief AES reference vector for a single block
+ **/
+
+typedef struct
+{
+   size_t keyLen;             ///<Length of the key
+   const char_t *ciphertext;  ///<Encryption of the FIPS-197 plaintext
+} BenchKatAesVector;
+
+
+/**
+ * @brief AES reference vector for a mode of operation
+ **/
+
+typedef struct
+{
+   const char_t *label;       ///<Name of the test
+   CipherMode mode;           ///<Cipher mode of operation
+   size_t keyLen;             ///<Length of the key
+   const char_t *digest;      ///<SHA-256 digest of the ciphertext
+} BenchKatAesModeVector;
+
+
+//Key (truncated to the desired length), plaintext block and initialization
+//vector (FIPS-197 appendix C and SP 800-38A)
+static const char_t benchKatAesKey[] =
+   "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F";
+static const char_t benchKatAesPlaintext[] = "00112233445566778899AABBCCDDEEFF";
+static const char_t benchKatAesIv[] = "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+//Reference vectors from FIPS-197 appendix C
+static const BenchKatAesVector benchKatAesVectors[] =
+{
+   {16, "69C4E0D86A7B0430D8CDB78070B4C55A"},
+   {24, "DDA97CA4864CDFE06EAF70A0EC0D7191"},
+   {32, "8EA2B7CA516745BFEAFC49904B496089"}
+};
+
+//Reference vectors for the generated message
+static const BenchKatAesModeVector benchKatAesModeVectors[] =
+{
+   {"AES-128-ECB", CIPHER_MODE_ECB, 16,
+      "D8B230B782BFA8A399B44E1CC7838F4246FDA802DB1C90445D0A8B3F9DC0680E"},
+   {"AES-128-CBC", CIPHER_MODE_CBC, 16,
+      "61CD1C6EC5BDB778AC14B6F013703D5CE5C5DDBD9A451EB4600D8140EB734723"},
+   {"AES-128-CTR", CIPHER_MODE_CTR, 16,
+      "AB1AEFEF5A47C70DC3D816E40AE63931FE1E7F155866EB526959F3ADE10D8C3A"},
+   {"AES-256-ECB", CIPHER_MODE_ECB, 32,
+      "E614AD9CACC11728FC7662DCF72F01E69F46B060132E6E3851C215018DAE8DCC"},
+   {"AES-256-CBC", CIPHER_MODE_CBC, 32,
+      "8DFF0C52945659A9A3F89BDC135E9D7149A3677923D6A4B48BA344926AFEE011"},
+   {"AES-256-CTR", CIPHER_MODE_CTR, 32,
+      "CAD5A7D927CD44A5D9C5FCFA7A343C4C13EDCD671198C91F6ED604A39F29BFED"}
+};
+
+#endif
+
+#if ((AES_SUPPORT == ENABLED && GCM_SUPPORT == ENABLED) || \
+   CHACHA20_POLY1305_SUPPORT == ENABLED) && SHA256_SUPPORT == ENABLED
+
+
+/**
+ * @brief AEAD reference vector
+ **/
+
+typedef struct
+{
+   const char_t *label;       ///<Description of the vector
+   const char_t *key;         ///<Key
+   const char_t *iv;          ///<Initialization vector or nonce
+   const char_t *aad;         ///<Additional authenticated data
+   const char_t *plaintext;   ///<Plaintext (NULL for a generated message)
+   size_t length;             ///<Length of the plaintext
+   const char_t *ciphertext;  ///<Ciphertext (digest for a generated message)
+   const char_t *tag;         ///<Authentication tag
+} BenchKatAeadVector;
+
+#endif
+
+#if (AES_SUPPORT == ENABLED && GCM_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+
+//Reference vectors for AES-GCM (test case 4 of the GCM specification and
+//generated message)
+static const BenchKatAeadVector benchKatGcmVectors[] =
+{
+   {
+      "Test case 4",
+      "FEFFE9928665731C6D6A8F9467308308",
+      "CAFEBABEFACEDBADDECAF888",
+      "FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2",
+      "D9313225F88406E5A55909C5AFF5269A86A7A9531534F7DA2E4C303D8A318A72"
+      "1C3C0C95956809532FCF0E2449A6B525B16AEDF5AA0DE657BA637B39",
+      60,
+      "42831EC2217774244B7221B784D0D49CE3AA212F2C02A4E035C17E2329ACA12E"
+      "21D514B25466931C7D8F6A5AAC84AA051BA30B396A0AAC973D58E091",
+      "5BC94FBC3221A5DB94FAE95AE7121A47"
+   },
+   {
+      "AES-256, 1000 bytes",
+      "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F",
+      "CAFEBABEFACEDBADDECAF888",
+      "FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2",
+      NULL,
+      1000,
+      "9E05D788BCAA3AA87BC74983EB6707D883152546767DE2998A20E8AEC18BF26F",
+      "4B93FD586BEAEAFAEA39D0E65B42659D"
+   }
+};
+
+#endif
+
+#if (CHACHA20_POLY1305_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+
+//Reference vectors for ChaCha20Poly1305 (RFC 8439, section 2.8.2, and
+//generated message)
+static const BenchKatAeadVector benchKatChachaPolyVectors[] =
+{
+   {
+      "RFC 8439",
+      "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F",
+      "070000004041424344454647",
+      "50515253C0C1C2C3C4C5C6C7",
+      "4C616469657320616E642047656E746C656D656E206F662074686520636C6173"
+      "73206F66202739393A204966204920636F756C64206F6666657220796F75206F"
+      "6E6C79206F6E652074697020666F7220746865206675747572652C2073756E73"
+      "637265656E20776F756C642062652069742E",
+      114,
+      "D31A8D34648E60DB7B86AFBC53EF7EC2A4ADED51296E08FEA9E2B5A736EE62D6"
+      "3DBEA45E8CA9671282FAFB69DA92728B1A71DE0A9E060B2905D6A5B67ECD3B36"
+      "92DDBD7F2D778B8C9803AEE328091B58FAB324E4FAD675945585808B4831D7BC"
+      "3FF4DEF08E4B7A9DE576D26586CEC64B6116",
+      "1AE10B594F09E26A7E902ECBD0600691"
+   },
+   {
+      "1000 bytes",
+      "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F",
+      "070000004041424344454647",
+      "50515253C0C1C2C3C4C5C6C7",
+      NULL,
+      1000,
+      "1C81AB52632EB2C800362FBAEF7686EB0B94101CA5C81D726390721AAA961EEE",
+      "5AA5C40BA6AF1A31902AF9B9A6720503"
+   }
+};
+
+#endif
+
+//Generated messages
+static uint8_t benchKatMessages[BENCH_KAT_NUM_MESSAGES][BENCH_KAT_MAX_MSG_SIZE];
+//Number of failed tests
+static uint_t benchKatFailures;
+//Implementation being tested (appended to the failure messages)
+static const char_t *benchKatVariant;
+
+
+/**
+ * @brief Report a failed test
+ * @param[in] name Name of the test
+ * @param[in] label Description of the message
+ * @param[in] reason Description of the failure
+ **/
+
+static void benchKatFail(const char_t *name, const char_t *label,
+   const char_t *reason)
+{
+   fprintf(stderr, "KAT %s (%s%s) %s\r\n", name, label, benchKatVariant,
+      reason);
+
+   //Increment the number of failed tests
+   benchKatFailures++;
+}
+
+
+/**
+ * @brief Compare an output with its reference value
+ * @param[in] name Name of the test
+ * @param[in] label Description of the message
+ * @param[in] output Output to be checked
+ * @param[in] expected Reference value, as a hex string
+ * @param[in] length Length of the output, in bytes
+ **/
+
+static void benchKatCheck(const char_t *name, const char_t *label,
+   const uint8_t *output, const char_t *expected, size_t length)
+{
+   size_t i;
+   uint_t value;
+   char_t reason[32];
+
+   //The reference value must cover the whole output
+   if(osStrlen(expected) != (length * 2))
+   {
+      i = 0;
+   }
+   else
+   {
+      //Compare the output byte for byte
+      for(i = 0; i < length; i++)
+      {
+         //Decode the next byte of the reference value
+         if(sscanf(expected + i * 2, "%2X", &value) != 1 ||
+            output[i] != (uint8_t) value)
+         {
+            break;
+         }
+      }
+   }
+
+   //Mismatch?
+   if(i < length)
+   {
+      snprintf(reason, sizeof(reason), "failed at byte %u", (uint_t) i);
+      benchKatFail(name, label, reason);
+   }
+}
+
+
+/**
+ * @brief Compare an output with an expected binary value
+ * @param[in] name Name of the test
+ * @param[in] label Description of the message
+ * @param[in] output Output to be checked
+ * @param[in] expected Expected value
+ * @param[in] length Length of the output, in bytes
+ **/
+
+static void benchKatCompare(const char_t *name, const char_t *label,
+   const uint8_t *output, const uint8_t *expected, size_t length)
+{
+   size_t i;
+   char_t reason[32];
+
+   //Compare the output byte for byte
+   for(i = 0; i < length && output[i] == expected[i]; i++)
+   {
+   }
+
+   //Mismatch?
+   if(i < length)
+   {
+      snprintf(reason, sizeof(reason), "failed at byte %u", (uint_t) i);
+      benchKatFail(name, label, reason);
+   }
+}
+
+
+/**
+ * @brief Decode a hex string
+ * @param[in] input Hex string
+ * @param[out] output Decoded bytes
+ * @return Number of decoded bytes
+ **/
+
+static size_t benchKatDecode(const char_t *input, uint8_t *output)
+{
+   size_t i;
+   uint_t value;
+
+   //Decode the string two digits at a time
+   for(i = 0; input[i * 2] != '\0'; i++)
+   {
+      sscanf(input + i * 2, "%2X", &value);
+      output[i] = (uint8_t) value;
+   }
+
+   //Return the number of decoded bytes
+   return i;
+}
+
+#if (SHA256_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Compare the SHA-256 digest of an output with its reference value
+ * @param[in] name Name of the test
+ * @param[in] label Description of the message
+ * @param[in] output Output to be checked
+ * @param[in] length Length of the output, in bytes
+ * @param[in] expected Reference digest, as a hex string
+ **/
+
+static void benchKatCheckDigest(const char_t *name, const char_t *label,
+   const uint8_t *output, size_t length, const char_t *expected)
+{
+   uint8_t digest[SHA256_DIGEST_SIZE];
+
+   //Digest the output
+   sha256Compute(output, length, digest);
+   //Compare the digest with the reference value
+   benchKatCheck(name, label, digest, expected, SHA256_DIGEST_SIZE);
+}
+
+#endif
+
+
+/**
+ * @brief Fill the generated messages
+ **/
+
+static void benchKatGenerateMessages(void)
+{
+   uint_t i;
+   size_t j;
+
+   //Each message is derived from its seed and from the byte offset
+   for(i = 0; i < BENCH_KAT_NUM_MESSAGES; i++)
+   {
+      for(j = 0; j < BENCH_KAT_MAX_MSG_SIZE; j++)
+      {
+         benchKatMessages[i][j] = (uint8_t) (j * 31 + 7 + i * 101);
+      }
+   }
+}
+
+#if (SHA3_256_SUPPORT == ENABLED && SHA3_512_SUPPORT == ENABLED && \
+   SHAKE_SUPPORT == ENABLED)
+
+
+/**
+ * @brief One-shot SHA-3 and SHAKE computations
+ **/
+
+static void benchKatKeccakOneShot(void)
+{
+   uint_t i;
+   const uint8_t *message;
+   const BenchKatKeccakVector *vector;
+   uint8_t buffer[256];
+   uint8_t output[BENCH_KAT_SHAKE128_OUTPUT_SIZE];
+
+   //Loop through the reference vectors
+   for(i = 0; i < arraysize(benchKatKeccakVectors); i++)
+   {
+      //Point to the current vector
+      vector = &benchKatKeccakVectors[i];
+
+      //Build the message
+      if(vector->message != NULL)
+      {
+         message = (const uint8_t *) vector->message;
+      }
+      else
+      {
+         osMemset(buffer, vector->fill, vector->length);
+         message = buffer;
+      }
+
+      //SHA3-256
+      sha3_256Compute(message, vector->length, output);
+      benchKatCheck("SHA3-256", vector->label, output, vector->sha3_256,
+         SHA3_256_DIGEST_SIZE);
+
+      //SHA3-512
+      sha3_512Compute(message, vector->length, output);
+      benchKatCheck("SHA3-512", vector->label, output, vector->sha3_512,
+         SHA3_512_DIGEST_SIZE);
+
+      //SHAKE128
+      shakeCompute(128, message, vector->length, output,
+         BENCH_KAT_SHAKE128_OUTPUT_SIZE);
+      benchKatCheck("SHAKE128", vector->label, output, vector->shake128,
+         BENCH_KAT_SHAKE128_OUTPUT_SIZE);
+
+      //SHAKE256
+      shakeCompute(256, message, vector->length, output,
+         BENCH_KAT_SHAKE256_OUTPUT_SIZE);
+      benchKatCheck("SHAKE256", vector->label, output, vector->shake256,
+         BENCH_KAT_SHAKE256_OUTPUT_SIZE);
+   }
+}
+
+
+/**
+ * @brief Incremental SHA-3 and SHAKE computations
+ **/
+
+static void benchKatKeccakIncremental(void)
+{
+   uint_t i;
+   size_t j;
+   size_t n;
+   char_t label[32];
+   const BenchKatKeccakLaneVector *vector;
+   Sha3_256Context sha3Context;
+   ShakeContext shakeContext;
+   uint8_t output[BENCH_KAT_SHAKE128_OUTPUT_SIZE];
+
+   //Loop through the reference vectors
+   for(i = 0; i < arraysize(benchKatKeccakLaneVectors); i++)
+   {
+      //Point to the current vector
+      vector = &benchKatKeccakLaneVectors[i];
+
+      //Describe the message
+      snprintf(label, sizeof(label), "%u bytes, seed %u",
+         (uint_t) vector->length, vector->seed);
+
+      //SHA3-256, absorbing 7 bytes at a time so that the data straddles
+      //the block boundaries
+      sha3_256Init(&sha3Context);
+
+      for(j = 0; j < vector->length; j += n)
+      {
+         n = MIN(vector->length - j, 7);
+         sha3_256Update(&sha3Context, benchKatMessages[vector->seed] + j, n);
+      }
+
+      sha3_256Final(&sha3Context, output);
+
+      benchKatCheck("SHA3-256", label, output, vector->sha3_256,
+         SHA3_256_DIGEST_SIZE);
+
+      //SHAKE128, absorbing 7 bytes at a time and squeezing the output in
+      //two parts
+      shakeInit(&shakeContext, 128);
+
+      for(j = 0; j < vector->length; j += n)
+      {
+         n = MIN(vector->length - j, 7);
+         shakeAbsorb(&shakeContext, benchKatMessages[vector->seed] + j, n);
+      }
+
+      shakeFinal(&shakeContext);
+      shakeSqueeze(&shakeContext, output, 100);
+      shakeSqueeze(&shakeContext, output + 100,
+         BENCH_KAT_SHAKE128_OUTPUT_SIZE - 100);
+
+      benchKatCheck("SHAKE128", label, output, vector->shake128,
+         BENCH_KAT_SHAKE128_OUTPUT_SIZE);
+   }
+}
+
+
+/**
+ * @brief Multi-lane Keccak computations
+ * @param[in] count Number of instances processed in lockstep
+ **/
+
+static void benchKatKeccakMulti(uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   char_t label[48];
+   const BenchKatKeccakLaneVector *vector;
+   KeccakContext contexts[BENCH_KAT_NUM_SEEDS];
+   KeccakContext *context[BENCH_KAT_NUM_SEEDS];
+   const void *input[BENCH_KAT_NUM_SEEDS];
+   uint8_t *output[BENCH_KAT_NUM_SEEDS];
+   uint8_t buffer[BENCH_KAT_NUM_SEEDS][BENCH_KAT_SHAKE128_OUTPUT_SIZE];
+
+   //The vectors are grouped by message length, one per seed
+   for(i = 0; i < arraysize(benchKatKeccakLaneVectors);
+      i += BENCH_KAT_NUM_SEEDS)
+   {
+      //Point to the instances
+      for(j = 0; j < count; j++)
+      {
+         context[j] = &contexts[j];
+         input[j] = benchKatMessages[benchKatKeccakLaneVectors[i + j].seed];
+         output[j] = buffer[j];
+      }
+
+      //SHA3-256 (capacity of 512 bits)
+      for(j = 0; j < count; j++)
+      {
+         keccakInit(context[j], 2 * 256);
+      }
+
+      keccakAbsorbMulti(context, input, benchKatKeccakLaneVectors[i].length,
+         count);
+      keccakFinalMulti(context, KECCAK_SHA3_PAD, count);
+      keccakSqueezeMulti(context, output, SHA3_256_DIGEST_SIZE, count);
+
+      for(j = 0; j < count; j++)
+      {
+         vector = &benchKatKeccakLaneVectors[i + j];
+
+         snprintf(label, sizeof(label), "%u lanes, %u bytes, seed %u",
+            count, (uint_t) vector->length, vector->seed);
+
+         benchKatCheck("Keccak multi SHA3-256", label, buffer[j],
+            vector->sha3_256, SHA3_256_DIGEST_SIZE);
+      }
+
+      //SHAKE128 (capacity of 256 bits)
+      for(j = 0; j < count; j++)
+      {
+         keccakInit(context[j], 2 * 128);
+      }
+
+      keccakAbsorbMulti(context, input, benchKatKeccakLaneVectors[i].length,
+         count);
+      keccakFinalMulti(context, KECCAK_SHAKE_PAD, count);
+      keccakSqueezeMulti(context, output, BENCH_KAT_SHAKE128_OUTPUT_SIZE,
+         count);
+
+      for(j = 0; j < count; j++)
+      {
+         vector = &benchKatKeccakLaneVectors[i + j];
+
+         snprintf(label, sizeof(label), "%u lanes, %u bytes, seed %u",
+            count, (uint_t) vector->length, vector->seed);
+
+         benchKatCheck("Keccak multi SHAKE128", label, buffer[j],
+            vector->shake128, BENCH_KAT_SHAKE128_OUTPUT_SIZE);
+      }
+   }
+}
+
+#endif
+
+#if (SHA1_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED && \
+   SHA512_SUPPORT == ENABLED)
+
+
+/**
+ * @brief One-shot and incremental SHA-1 and SHA-2 computations
+ **/
+
+static void benchKatSha(void)
+{
+   uint_t i;
+   size_t j;
+   size_t n;
+   char_t label[32];
+   const uint8_t *message;
+   const BenchKatShaVector *vector;
+   Sha256Context sha256Context;
+   Sha512Context sha512Context;
+   uint8_t output[SHA512_DIGEST_SIZE];
+
+   //Loop through the reference vectors
+   for(i = 0; i < arraysize(benchKatShaVectors); i++)
+   {
+      //Point to the current vector
+      vector = &benchKatShaVectors[i];
+      message = benchKatMessages[vector->seed];
+
+      //Describe the message
+      snprintf(label, sizeof(label), "%u bytes, seed %u",
+         (uint_t) vector->length, vector->seed);
+
+      //SHA-1
+      sha1Compute(message, vector->length, output);
+      benchKatCheck("SHA-1", label, output, vector->sha1, SHA1_DIGEST_SIZE);
+
+      //SHA-256
+      sha256Compute(message, vector->length, output);
+      benchKatCheck("SHA-256", label, output, vector->sha256,
+         SHA256_DIGEST_SIZE);
+
+      //SHA-512
+      sha512Compute(message, vector->length, output);
+      benchKatCheck("SHA-512", label, output, vector->sha512,
+         SHA512_DIGEST_SIZE);
+
+      //SHA-256, absorbing 7 bytes at a time so that the data straddles
+      //the block boundaries
+      sha256Init(&sha256Context);
+
+      for(j = 0; j < vector->length; j += n)
+      {
+         n = MIN(vector->length - j, 7);
+         sha256Update(&sha256Context, message + j, n);
+      }
+
+      sha256Final(&sha256Context, output);
+
+      benchKatCheck("SHA-256 incremental", label, output, vector->sha256,
+         SHA256_DIGEST_SIZE);
+
+      //SHA-512, absorbing 7 bytes at a time
+      sha512Init(&sha512Context);
+
+      for(j = 0; j < vector->length; j += n)
+      {
+         n = MIN(vector->length - j, 7);
+         sha512Update(&sha512Context, message + j, n);
+      }
+
+      sha512Final(&sha512Context, output);
+
+      benchKatCheck("SHA-512 incremental", label, output, vector->sha512,
+         SHA512_DIGEST_SIZE);
+   }
+}
+
+
+/**
+ * @brief Multi-lane SHA-256 and SHA-512 computations
+ * @param[in] count Number of messages processed in lockstep
+ **/
+
+static void benchKatShaMulti(uint_t count)
+{
+   uint_t i;
+   uint_t j;
+   char_t label[48];
+   const BenchKatShaVector *vector;
+   const void *input[BENCH_KAT_NUM_MESSAGES];
+   uint8_t *output[BENCH_KAT_NUM_MESSAGES];
+   uint8_t buffer[BENCH_KAT_NUM_MESSAGES][SHA512_DIGEST_SIZE];
+
+   //The vectors are grouped by message length, one per seed
+   for(i = 0; i < arraysize(benchKatShaVectors); i += BENCH_KAT_NUM_MESSAGES)
+   {
+      //Point to the messages and to the digests
+      for(j = 0; j < count; j++)
+      {
+         input[j] = benchKatMessages[benchKatShaVectors[i + j].seed];
+         output[j] = buffer[j];
+      }
+
+      //SHA-256
+      sha256ComputeMulti(input, benchKatShaVectors[i].length, output, count);
+
+      for(j = 0; j < count; j++)
+      {
+         vector = &benchKatShaVectors[i + j];
+
+         snprintf(label, sizeof(label), "%u lanes, %u bytes, seed %u",
+            count, (uint_t) vector->length, vector->seed);
+
+         benchKatCheck("SHA-256 multi", label, buffer[j], vector->sha256,
+            SHA256_DIGEST_SIZE);
+      }
+
+      //SHA-512
+      sha512ComputeMulti(input, benchKatShaVectors[i].length, output, count);
+
+      for(j = 0; j < count; j++)
+      {
+         vector = &benchKatShaVectors[i + j];
+
+         snprintf(label, sizeof(label), "%u lanes, %u bytes, seed %u",
+            count, (uint_t) vector->length, vector->seed);
+
+         benchKatCheck("SHA-512 multi", label, buffer[j], vector->sha512,
+            SHA512_DIGEST_SIZE);
+      }
+   }
+}
+
+#endif
+
+#if (AES_SUPPORT == ENABLED && ECB_SUPPORT == ENABLED && \
+   CBC_SUPPORT == ENABLED && CTR_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+
+
+/**
+ * @brief AES single-block computations
+ **/
+
+static void benchKatAes(void)
+{
+   uint_t i;
+   char_t label[16];
+   const BenchKatAesVector *vector;
+   AesContext context;
+   uint8_t key[32];
+   uint8_t plaintext[AES_BLOCK_SIZE];
+   uint8_t output[AES_BLOCK_SIZE];
+
+   //Decode the key and the plaintext
+   benchKatDecode(benchKatAesKey, key);
+   benchKatDecode(benchKatAesPlaintext, plaintext);
+
+   //Loop through the reference vectors
+   for(i = 0; i < arraysize(benchKatAesVectors); i++)
+   {
+      //Point to the current vector
+      vector = &benchKatAesVectors[i];
+
+      //Describe the key
+      snprintf(label, sizeof(label), "AES-%u", (uint_t) vector->keyLen * 8);
+
+      //Load the key
+      aesInit(&context, key, vector->keyLen);
+
+      //Encrypt the plaintext block
+      aesEncryptBlock(&context, plaintext, output);
+      benchKatCheck("AES encrypt", label, output, vector->ciphertext,
+         AES_BLOCK_SIZE);
+
+      //Decrypt it back
+      aesDecryptBlock(&context, output, output);
+      benchKatCompare("AES decrypt", label, output, plaintext,
+         AES_BLOCK_SIZE);
+
+      //Release the AES context
+      aesDeinit(&context);
+   }
+}
+
+
+/**
+ * @brief AES computations in ECB, CBC and CTR modes
+ **/
+
+static void benchKatAesModes(void)
+{
+   uint_t i;
+   const uint8_t *message;
+   const BenchKatAesModeVector *vector;
+   AesContext context;
+   uint8_t key[32];
+   uint8_t iv[AES_BLOCK_SIZE];
+   uint8_t t[AES_BLOCK_SIZE];
+   uint8_t ciphertext[BENCH_KAT_AES_MSG_SIZE];
+   uint8_t plaintext[BENCH_KAT_AES_MSG_SIZE];
+
+   //Decode the key and the initialization vector
+   benchKatDecode(benchKatAesKey, key);
+   benchKatDecode(benchKatAesIv, iv);
+
+   //Point to the generated message
+   message = benchKatMessages[0];
+
+   //Loop through the reference vectors
+   for(i = 0; i < arraysize(benchKatAesModeVectors); i++)
+   {
+      //Point to the current vector
+      vector = &benchKatAesModeVectors[i];
+
+      //Load the key
+      aesInit(&context, key, vector->keyLen);
+
+      //Encrypt the message
+      osMemcpy(t, iv, AES_BLOCK_SIZE);
+
+      if(vector->mode == CIPHER_MODE_ECB)
+      {
+         ecbEncrypt(AES_CIPHER_ALGO, &context, message, ciphertext,
+            BENCH_KAT_AES_MSG_SIZE);
+      }
+      else if(vector->mode == CIPHER_MODE_CBC)
+      {
+         cbcEncrypt(AES_CIPHER_ALGO, &context, t, message, ciphertext,
+            BENCH_KAT_AES_MSG_SIZE);
+      }
+      else
+      {
+         ctrEncrypt(AES_CIPHER_ALGO, &context, 128, t, message, ciphertext,
+            BENCH_KAT_AES_MSG_SIZE);
+      }
+
+      benchKatCheckDigest(vector->label, "encrypt", ciphertext,
+         BENCH_KAT_AES_MSG_SIZE, vector->digest);
+
+      //Decrypt it back
+      osMemcpy(t, iv, AES_BLOCK_SIZE);
+
+      if(vector->mode == CIPHER_MODE_ECB)
+      {
+         ecbDecrypt(AES_CIPHER_ALGO, &context, ciphertext, plaintext,
+            BENCH_KAT_AES_MSG_SIZE);
+      }
+      else if(vector->mode == CIPHER_MODE_CBC)
+      {
+         cbcDecrypt(AES_CIPHER_ALGO, &context, t, ciphertext, plaintext,
+            BENCH_KAT_AES_MSG_SIZE);
+      }
+      else
+      {
+         ctrDecrypt(AES_CIPHER_ALGO, &context, 128, t, ciphertext, plaintext,
+            BENCH_KAT_AES_MSG_SIZE);
+      }
+
+      benchKatCompare(vector->label, "decrypt", plaintext, message,
+         BENCH_KAT_AES_MSG_SIZE);
+
+      //Release the AES context
+      aesDeinit(&context);
+   }
+}
+
+#endif
+
+#if (AES_SUPPORT == ENABLED && GCM_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+
+
+/**
+ * @brief AES-GCM computations
+ **/
+
+static void benchKatGcm(void)
+{
+   uint_t i;
+   size_t keyLen;
+   size_t ivLen;
+   size_t aadLen;
+   error_t error;
+   const uint8_t *message;
+   const BenchKatAeadVector *vector;
+   AesContext aesContext;
+   GcmContext gcmContext;
+   uint8_t key[32];
+   uint8_t iv[16];
+   uint8_t aad[32];
+   uint8_t tag[16];
+   uint8_t buffer[BENCH_KAT_MAX_MSG_SIZE];
+   uint8_t ciphertext[BENCH_KAT_MAX_MSG_SIZE];
+   uint8_t plaintext[BENCH_KAT_MAX_MSG_SIZE];
+
+   //Loop through the reference vectors
+   for(i = 0; i < arraysize(benchKatGcmVectors); i++)
+   {
+      //Point to the current vector
+      vector = &benchKatGcmVectors[i];
+
+      //Decode the parameters
+      keyLen = benchKatDecode(vector->key, key);
+      ivLen = benchKatDecode(vector->iv, iv);
+      aadLen = benchKatDecode(vector->aad, aad);
+
+      //Point to the plaintext
+      if(vector->plaintext != NULL)
+      {
+         benchKatDecode(vector->plaintext, buffer);
+         message = buffer;
+      }
+      else
+      {
+         message = benchKatMessages[0];
+      }
+
+      //Initialize the AES and GCM contexts
+      aesInit(&aesContext, key, keyLen);
+      gcmInit(&gcmContext, AES_CIPHER_ALGO, &aesContext);
+
+      //Encrypt the message
+      gcmEncrypt(&gcmContext, iv, ivLen, aad, aadLen, message, ciphertext,
+         vector->length, tag, sizeof(tag));
+
+      //Check the ciphertext and the authentication tag
+      if(vector->plaintext != NULL)
+      {
+         benchKatCheck("AES-GCM encrypt", vector->label, ciphertext,
+            vector->ciphertext, vector->length);
+      }
+      else
+      {
+         benchKatCheckDigest("AES-GCM encrypt", vector->label, ciphertext,
+            vector->length, vector->ciphertext);
+      }
+
+      benchKatCheck("AES-GCM tag", vector->label, tag, vector->tag,
+         sizeof(tag));
+
+      //Decrypt it back
+      error = gcmDecrypt(&gcmContext, iv, ivLen, aad, aadLen, ciphertext,
+         plaintext, vector->length, tag, sizeof(tag));
+
+      //A valid tag must be accepted
+      if(error)
+      {
+         benchKatFail("AES-GCM decrypt", vector->label, "rejected a valid tag");
+      }
+      else
+      {
+         benchKatCompare("AES-GCM decrypt", vector->label, plaintext, message,
+            vector->length);
+      }
+
+      //A modified tag must be rejected
+      tag[0] ^= 0x01;
+
+      error = gcmDecrypt(&gcmContext, iv, ivLen, aad, aadLen, ciphertext,
+         plaintext, vector->length, tag, sizeof(tag));
+
+      if(!error)
+      {
+         benchKatFail("AES-GCM decrypt", vector->label,
+            "accepted a modified tag");
+      }
+
+      //Release the AES context
+      aesDeinit(&aesContext);
+   }
+}
+
+#endif
+
+#if (CHACHA20_POLY1305_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+
+
+/**
+ * @brief ChaCha20Poly1305 computations
+ **/
+
+static void benchKatChachaPoly(void)
+{
+   uint_t i;
+   size_t keyLen;
+   size_t nonceLen;
+   size_t aadLen;
+   error_t error;
+   const uint8_t *message;
+   const BenchKatAeadVector *vector;
+   uint8_t key[32];
+   uint8_t nonce[12];
+   uint8_t aad[32];
+   uint8_t tag[16];
+   uint8_t buffer[BENCH_KAT_MAX_MSG_SIZE];
+   uint8_t ciphertext[BENCH_KAT_MAX_MSG_SIZE];
+   uint8_t plaintext[BENCH_KAT_MAX_MSG_SIZE];
+
+   //Loop through the reference vectors
+   for(i = 0; i < arraysize(benchKatChachaPolyVectors); i++)
+   {
+      //Point to the current vector
+      vector = &benchKatChachaPolyVectors[i];
+
+      //Decode the parameters
+      keyLen = benchKatDecode(vector->key, key);
+      nonceLen = benchKatDecode(vector->iv, nonce);
+      aadLen = benchKatDecode(vector->aad, aad);
+
+      //Point to the plaintext
+      if(vector->plaintext != NULL)
+      {
+         benchKatDecode(vector->plaintext, buffer);
+         message = buffer;
+      }
+      else
+      {
+         message = benchKatMessages[0];
+      }
+
+      //Encrypt the message
+      chacha20Poly1305Encrypt(key, keyLen, nonce, nonceLen, aad, aadLen,
+         message, ciphertext, vector->length, tag, sizeof(tag));
+
+      //Check the ciphertext and the authentication tag
+      if(vector->plaintext != NULL)
+      {
+         benchKatCheck("ChaCha20Poly1305 encrypt", vector->label, ciphertext,
+            vector->ciphertext, vector->length);
+      }
+      else
+      {
+         benchKatCheckDigest("ChaCha20Poly1305 encrypt", vector->label,
+            ciphertext, vector->length, vector->ciphertext);
+      }
+
+      benchKatCheck("ChaCha20Poly1305 tag", vector->label, tag, vector->tag,
+         sizeof(tag));
+
+      //Decrypt it back
+      error = chacha20Poly1305Decrypt(key, keyLen, nonce, nonceLen, aad,
+         aadLen, ciphertext, plaintext, vector->length, tag, sizeof(tag));
+
+      //A valid tag must be accepted
+      if(error)
+      {
+         benchKatFail("ChaCha20Poly1305 decrypt", vector->label,
+            "rejected a valid tag");
+      }
+      else
+      {
+         benchKatCompare("ChaCha20Poly1305 decrypt", vector->label, plaintext,
+            message, vector->length);
+      }
+
+      //A modified tag must be rejected
+      tag[0] ^= 0x01;
+
+      error = chacha20Poly1305Decrypt(key, keyLen, nonce, nonceLen, aad,
+         aadLen, ciphertext, plaintext, vector->length, tag, sizeof(tag));
+
+      if(!error)
+      {
+         benchKatFail("ChaCha20Poly1305 decrypt", vector->label,
+            "accepted a modified tag");
+      }
+   }
+}
+
+#endif
+
+
+/**
+ * @brief Run the algorithm tests once
+ **/
+
+static void benchKatRun(void)
+{
+   uint_t count;
+
+#if (SHA3_256_SUPPORT == ENABLED && SHA3_512_SUPPORT == ENABLED && \
+   SHAKE_SUPPORT == ENABLED)
+   //Keccak (SHA-3 and SHAKE)
+   benchKatKeccakOneShot();
+   benchKatKeccakIncremental();
+
+   //Full and partial groups of instances processed in lockstep
+   for(count = 1; count <= BENCH_KAT_NUM_SEEDS; count++)
+   {
+      benchKatKeccakMulti(count);
+   }
+#endif
+
+#if (SHA1_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED && \
+   SHA512_SUPPORT == ENABLED)
+   //SHA-1 and SHA-2
+   benchKatSha();
+
+   //Full and partial groups of messages processed in lockstep
+   for(count = 1; count <= BENCH_KAT_NUM_MESSAGES; count++)
+   {
+      benchKatShaMulti(count);
+   }
+#endif
+
+#if (AES_SUPPORT == ENABLED && ECB_SUPPORT == ENABLED && \
+   CBC_SUPPORT == ENABLED && CTR_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+   //AES
+   benchKatAes();
+   benchKatAesModes();
+#endif
+
+#if (AES_SUPPORT == ENABLED && GCM_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+   //AES-GCM
+   benchKatGcm();
+#endif
+
+#if (CHACHA20_POLY1305_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+   //ChaCha20Poly1305
+   benchKatChachaPoly();
+#endif
+
+   //Not every configuration uses the loop counter
+   (void) count;
+}
+
+
+/**
+ * @brief Run the known-answer tests
+ * @return Error code
+ **/
+
+error_t benchKat(void)
+{
+#if (X86_64_CRYPTO_SUPPORT == ENABLED)
+   uint32_t features;
+#endif
+
+   //Reset the number of failed tests
+   benchKatFailures = 0;
+   benchKatVariant = "";
+
+   //Fill the generated messages
+   benchKatGenerateMessages();
+
+   //Algorithm tests
+   benchKatRun();
+
+#if (X86_64_CRYPTO_SUPPORT == ENABLED)
+   //Run the tests a second time with the instruction set extensions masked,
+   //as on a CPU that lacks them
+   features = x86_64CryptoFeatures;
+   x86_64CryptoFeatures = 0;
+   benchKatVariant = ", portable code";
+
+   benchKatRun();
+
+   //Restore the detected features
+   x86_64CryptoFeatures = features;
+   benchKatVariant = "";
+#endif
+
+   //Certificate processing
+   if(benchPkixKat())
+   {
+      benchKatFailures++;
+   }
+
+   //Return status code
+   return (benchKatFailures == 0) ? NO_ERROR : ERROR_FAILURE;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file bench_kdf.c
+ * @brief Benchmarks of key derivation functions
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/crypto.h"
+#include "hash/hash_algorithms.h"
+#include "kdf/hkdf.h"
+#include "kdf/pbkdf.h"
+#include "kdf/scrypt.h"
+#include "bench.h"
+
+//Salt shared by the password-based KDFs
+static const uint8_t benchSalt[16] =
+{
+   0x5B, 0x12, 0x9E, 0x7C, 0x33, 0xD0, 0x41, 0xA8,
+   0x6F, 0x0B, 0xE4, 0x25, 0x97, 0x58, 0xC1, 0x3A
+};
+
+//Password shared by the password-based KDFs
+static const char_t benchPassword[] = "correct horse battery staple";
+
+
+#if (HKDF_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+
+/**
+ * @brief HKDF-SHA-256 (32-byte input keying material, 64-byte output)
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchHkdf(void *param)
+{
+   return hkdf(SHA256_HASH_ALGO, benchInput, 32, benchSalt, sizeof(benchSalt),
+      benchInput + 32, 16, benchOutput, 64);
+}
+
+#endif
+#if (PBKDF_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+
+/**
+ * @brief PBKDF2-HMAC-SHA-256 (1000 iterations, 32-byte output)
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchPbkdf2(void *param)
+{
+   return pbkdf2(SHA256_HASH_ALGO, (const uint8_t *) benchPassword,
+      osStrlen(benchPassword), benchSalt, sizeof(benchSalt), 1000,
+      benchOutput, 32);
+}
+
+#endif
+#if (SCRYPT_SUPPORT == ENABLED)
+
+/**
+ * @brief scrypt (N = 16384, r = 8, 32-byte output)
+ * @param[in] param Parallelization parameter
+ * @return Error code
+ **/
+
+static error_t benchScrypt(void *param)
+{
+   return scrypt(benchPassword, benchSalt, sizeof(benchSalt), 16384, 8,
+      *((const uint_t *) param), benchOutput, 32);
+}
+
+#endif
+
+
+/**
+ * @brief Run the KDF benchmarks
+ **/
+
+void benchKdf(void)
+{
+#if (SCRYPT_SUPPORT == ENABLED)
+   uint_t i;
+   char_t name[24];
+   static const uint_t scryptParams[] = {1, 2, 3, 4};
+#endif
+
+#if (HKDF_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+   benchRun("kdf", "HKDF-SHA-256", "derive", 0, benchHkdf, NULL);
+#endif
+#if (PBKDF_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+   benchRun("kdf", "PBKDF2-SHA-256-1000", "derive", 0, benchPbkdf2, NULL);
+#endif
+#if (SCRYPT_SUPPORT == ENABLED)
+   //Interactive login parameters, with 1 to 4 parallel blocks
+   for(i = 0; i < arraysize(scryptParams); i++)
+   {
+      osSprintf(name, "scrypt-16384-8-%u", scryptParams[i]);
+      benchRun("kdf", name, "derive", 0, benchScrypt,
+         (void *) &scryptParams[i]);
+   }
+#endif
+}
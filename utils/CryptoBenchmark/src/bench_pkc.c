@@ -0,0 +1,795 @@
+/**
+ * @file bench_pkc.c
+ * @brief Benchmarks of public-key algorithms and KEMs
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/crypto.h"
+#include "hash/hash_algorithms.h"
+#include "pkc/rsa.h"
+#include "mpi/mpi.h"
+#include "ecc/ec.h"
+#include "ecc/ec_curves.h"
+#include "ecc/ecdh.h"
+#include "ecc/ecdsa.h"
+#include "ecc/ed25519.h"
+#include "ecc/x25519.h"
+#include "pqc/kem.h"
+#include "pqc/mlkem512.h"
+#include "pqc/mlkem768.h"
+#include "pqc/mlkem1024.h"
+#include "pqc/sntrup761.h"
+#include "bench.h"
+
+//Largest number of Ed25519 signatures verified together
+#define BENCH_ED25519_MAX_BATCH 64
+
+//Message digest signed by the signature schemes
+static uint8_t benchDigest[64];
+
+#if (RSA_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+static RsaPublicKey benchRsaPublicKey;
+static RsaPrivateKey benchRsaPrivateKey;
+static uint8_t benchRsaSignature[512];
+static size_t benchRsaSignatureLen;
+#endif
+
+#if (ECDH_SUPPORT == ENABLED)
+static EcdhContext benchEcdhContext;
+#endif
+
+#if (ECDSA_SUPPORT == ENABLED)
+static EcDomainParameters benchEcParams;
+static EcPrivateKey benchEcPrivateKey;
+static EcPublicKey benchEcPublicKey;
+static EcdsaSignature benchEcdsaSignature;
+static size_t benchEcDigestLen;
+#endif
+
+#if (ED25519_SUPPORT == ENABLED)
+static uint8_t benchEd25519PrivateKey[ED25519_PRIVATE_KEY_LEN];
+static uint8_t benchEd25519PublicKey[ED25519_PUBLIC_KEY_LEN];
+static uint8_t benchEd25519Signature[ED25519_SIGNATURE_LEN];
+static uint8_t benchEd25519BatchKeys[BENCH_ED25519_MAX_BATCH][ED25519_PUBLIC_KEY_LEN];
+static uint8_t benchEd25519BatchSignatures[BENCH_ED25519_MAX_BATCH][ED25519_SIGNATURE_LEN];
+static Ed25519BatchItem benchEd25519BatchItems[BENCH_ED25519_MAX_BATCH];
+
+//Number of signatures verified together by the batch benchmarks
+static const uint_t benchEd25519BatchSizes[] = {4, 16, BENCH_ED25519_MAX_BATCH};
+#endif
+
+#if (X25519_SUPPORT == ENABLED)
+static uint8_t benchX25519PrivateKey[CURVE25519_BYTE_LEN];
+#endif
+
+#if (KEM_SUPPORT == ENABLED)
+
+//KEMs under test
+static const KemAlgo *const benchKemAlgos[] =
+{
+#if (MLKEM512_SUPPORT == ENABLED)
+   MLKEM512_KEM_ALGO,
+#endif
+#if (MLKEM768_SUPPORT == ENABLED)
+   MLKEM768_KEM_ALGO,
+#endif
+#if (MLKEM1024_SUPPORT == ENABLED)
+   MLKEM1024_KEM_ALGO,
+#endif
+#if (SNTRUP761_SUPPORT == ENABLED)
+   SNTRUP761_KEM_ALGO,
+#endif
+   NULL
+};
+
+//KEM working state
+static KemContext benchKemContext;
+static uint8_t *benchKemCiphertext;
+static uint8_t benchKemSharedSecret[64];
+
+#endif
+
+
+#if (RSA_SUPPORT == ENABLED && BENCH_PRIME_TEST_SUPPORT == ENABLED)
+
+/**
+ * @brief Test whether a number is probable prime
+ *
+ * The library leaves this primitive to the hardware accelerators. The
+ * benchmark provides a Miller-Rabin test (preceded by trial division) so
+ * that RSA keys can be generated on the host
+ *
+ * @param[in] a Pointer to a multiple precision integer
+ * @return Error code
+ **/
+
+error_t mpiCheckProbablePrime(const Mpi *a)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint_t s;
+   uint32_t r;
+   Mpi b;
+   Mpi d;
+   Mpi x;
+   Mpi n1;
+
+   //Small primes used for trial division and as Miller-Rabin bases
+   static const uint16_t primes[] =
+   {
+      2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61,
+      67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137,
+      139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211
+   };
+
+   //The test is restricted to odd numbers greater than the largest small prime
+   if(mpiCompInt(a, primes[arraysize(primes) - 1]) <= 0 ||
+      mpiGetBitValue(a, 0) == 0)
+   {
+      return ERROR_INVALID_VALUE;
+   }
+
+   //Trial division
+   for(i = 1; i < arraysize(primes); i++)
+   {
+      //Compute a mod p, 16 bits at a time
+      for(r = 0, j = a->size * MPI_INT_SIZE * 8; j > 0; j -= 16)
+      {
+         k = (j - 16) / (MPI_INT_SIZE * 8);
+         r = ((r << 16) | ((a->data[k] >> ((j - 16) % (MPI_INT_SIZE * 8))) &
+            0xFFFF)) % primes[i];
+      }
+
+      //Composite number?
+      if(r == 0)
+         return ERROR_INVALID_VALUE;
+   }
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Initialize multiple precision integers
+   mpiInit(&b);
+   mpiInit(&d);
+   mpiInit(&x);
+   mpiInit(&n1);
+
+   //Write a - 1 = 2^s * d, with d odd
+   MPI_CHECK(mpiSubInt(&n1, a, 1));
+   MPI_CHECK(mpiCopy(&d, &n1));
+
+   for(s = 0; mpiGetBitValue(&d, 0) == 0; s++)
+   {
+      MPI_CHECK(mpiShiftRight(&d, 1));
+   }
+
+   //Miller-Rabin rounds, using the first primes as bases
+   for(i = 0; i < 8 && !error; i++)
+   {
+      //Compute x = b^d mod a
+      MPI_CHECK(mpiSetValue(&b, primes[i]));
+      MPI_CHECK(mpiExpMod(&x, &b, &d, a));
+
+      //x = 1 or x = a - 1 passes the round
+      if(mpiCompInt(&x, 1) == 0 || mpiComp(&x, &n1) == 0)
+         continue;
+
+      //Square x up to s - 1 times, looking for a - 1
+      for(j = 1; j < s; j++)
+      {
+         MPI_CHECK(mpiMulMod(&x, &x, &x, a));
+
+         if(mpiComp(&x, &n1) == 0)
+            break;
+      }
+
+      //The number is composite if a - 1 was never reached
+      if(j >= s)
+      {
+         error = ERROR_INVALID_VALUE;
+      }
+   }
+
+end:
+   //Release multiple precision integers
+   mpiFree(&b);
+   mpiFree(&d);
+   mpiFree(&x);
+   mpiFree(&n1);
+
+   //Return status code
+   return error;
+}
+
+#endif
+#if (RSA_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+
+/**
+ * @brief RSASSA-PKCS1-v1_5 signature generation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchRsaSign(void *param)
+{
+   return rsassaPkcs1v15Sign(&benchRsaPrivateKey, SHA256_HASH_ALGO,
+      benchDigest, benchRsaSignature, &benchRsaSignatureLen);
+}
+
+
+/**
+ * @brief RSASSA-PKCS1-v1_5 signature verification
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchRsaVerify(void *param)
+{
+   return rsassaPkcs1v15Verify(&benchRsaPublicKey, SHA256_HASH_ALGO,
+      benchDigest, benchRsaSignature, benchRsaSignatureLen);
+}
+
+
+/**
+ * @brief Benchmark RSA with a given modulus size
+ * @param[in] name Algorithm name
+ * @param[in] k Modulus size, in bits
+ **/
+
+static void benchRsa(const char_t *name, size_t k)
+{
+   error_t error;
+
+   //Skip the key generation if no operation is to be measured
+   if(!benchSelected("pkc", name, "sign") &&
+      !benchSelected("pkc", name, "verify"))
+   {
+      return;
+   }
+
+   //Initialize RSA keys
+   rsaInitPublicKey(&benchRsaPublicKey);
+   rsaInitPrivateKey(&benchRsaPrivateKey);
+
+   //Key generation is too slow and too variable to be measured reliably
+   error = rsaGenerateKeyPair(benchPrngAlgo, benchPrngContext, k, 65537,
+      &benchRsaPrivateKey, &benchRsaPublicKey);
+
+   //Check status code
+   if(!error)
+   {
+      //Generate a signature to be verified
+      error = benchRsaSign(NULL);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      benchRun("pkc", name, "sign", 0, benchRsaSign, NULL);
+      benchRun("pkc", name, "verify", 0, benchRsaVerify, NULL);
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkc", name, "setup", error);
+   }
+
+   //Release RSA keys
+   rsaFreePublicKey(&benchRsaPublicKey);
+   rsaFreePrivateKey(&benchRsaPrivateKey);
+}
+
+#endif
+#if (ECDSA_SUPPORT == ENABLED)
+
+/**
+ * @brief ECDSA key pair generation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchEcdsaKeyGen(void *param)
+{
+   return ecGenerateKeyPair(benchPrngAlgo, benchPrngContext, &benchEcParams,
+      &benchEcPrivateKey, &benchEcPublicKey);
+}
+
+
+/**
+ * @brief ECDSA signature generation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchEcdsaSign(void *param)
+{
+   return ecdsaGenerateSignature(benchPrngAlgo, benchPrngContext,
+      &benchEcParams, &benchEcPrivateKey, benchDigest, benchEcDigestLen,
+      &benchEcdsaSignature);
+}
+
+
+/**
+ * @brief ECDSA signature verification
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchEcdsaVerify(void *param)
+{
+   return ecdsaVerifySignature(&benchEcParams, &benchEcPublicKey,
+      benchDigest, benchEcDigestLen, &benchEcdsaSignature);
+}
+
+
+/**
+ * @brief Benchmark ECDSA over a given curve
+ * @param[in] name Algorithm name
+ * @param[in] curveInfo Elliptic curve parameters
+ * @param[in] digestLen Length of the signed digest, in bytes
+ **/
+
+static void benchEcdsa(const char_t *name, const EcCurveInfo *curveInfo,
+   size_t digestLen)
+{
+   error_t error;
+
+   //Initialize working state
+   ecInitDomainParameters(&benchEcParams);
+   ecInitPrivateKey(&benchEcPrivateKey);
+   ecInitPublicKey(&benchEcPublicKey);
+   ecdsaInitSignature(&benchEcdsaSignature);
+   benchEcDigestLen = digestLen;
+
+   //Load EC domain parameters
+   error = ecLoadDomainParameters(&benchEcParams, curveInfo);
+
+   //Check status code
+   if(!error)
+   {
+      benchRun("pkc", name, "keygen", 0, benchEcdsaKeyGen, NULL);
+
+      //Generate the key pair and the signature used by the next measurements
+      //(the keygen measurement may have been skipped by the filter)
+      error = benchEcdsaKeyGen(NULL);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      error = benchEcdsaSign(NULL);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      benchRun("pkc", name, "sign", 0, benchEcdsaSign, NULL);
+      benchRun("pkc", name, "verify", 0, benchEcdsaVerify, NULL);
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkc", name, "setup", error);
+   }
+
+   //Release working state
+   ecFreeDomainParameters(&benchEcParams);
+   ecFreePrivateKey(&benchEcPrivateKey);
+   ecFreePublicKey(&benchEcPublicKey);
+   ecdsaFreeSignature(&benchEcdsaSignature);
+}
+
+#endif
+#if (ECDH_SUPPORT == ENABLED)
+
+/**
+ * @brief ECDH shared secret computation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchEcdhCompute(void *param)
+{
+   size_t n;
+
+   return ecdhComputeSharedSecret(&benchEcdhContext, benchOutput, 128, &n);
+}
+
+
+/**
+ * @brief Benchmark ECDH over a given curve
+ * @param[in] name Algorithm name
+ * @param[in] curveInfo Elliptic curve parameters
+ **/
+
+static void benchEcdh(const char_t *name, const EcCurveInfo *curveInfo)
+{
+   error_t error;
+
+   //Initialize ECDH context
+   ecdhInit(&benchEcdhContext);
+
+   //Load EC domain parameters
+   error = ecLoadDomainParameters(&benchEcdhContext.params, curveInfo);
+
+   //Check status code
+   if(!error)
+   {
+      //Generate an ephemeral key pair
+      error = ecdhGenerateKeyPair(&benchEcdhContext, benchPrngAlgo,
+         benchPrngContext);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Use our own public key as the peer's public key
+      error = ecCopy(&benchEcdhContext.qb.q, &benchEcdhContext.qa.q);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      benchRun("pkc", name, "derive", 0, benchEcdhCompute, NULL);
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkc", name, "setup", error);
+   }
+
+   //Release ECDH context
+   ecdhFree(&benchEcdhContext);
+}
+
+#endif
+#if (ED25519_SUPPORT == ENABLED)
+
+/**
+ * @brief Ed25519 key pair generation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchEd25519KeyGen(void *param)
+{
+   return ed25519GenerateKeyPair(benchPrngAlgo, benchPrngContext,
+      benchEd25519PrivateKey, benchEd25519PublicKey);
+}
+
+
+/**
+ * @brief Ed25519 signature generation (32-byte message)
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchEd25519Sign(void *param)
+{
+   return ed25519GenerateSignature(benchEd25519PrivateKey,
+      benchEd25519PublicKey, benchDigest, 32, NULL, 0, 0,
+      benchEd25519Signature);
+}
+
+
+/**
+ * @brief Ed25519 signature verification (32-byte message)
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchEd25519Verify(void *param)
+{
+   return ed25519VerifySignature(benchEd25519PublicKey, benchDigest, 32,
+      NULL, 0, 0, benchEd25519Signature);
+}
+
+
+/**
+ * @brief Ed25519 batch verification (32-byte messages)
+ * @param[in] param Number of signatures in the batch
+ * @return Error code
+ **/
+
+static error_t benchEd25519VerifyBatch(void *param)
+{
+   return ed25519VerifyBatch(benchEd25519BatchItems, *(const uint_t *) param);
+}
+
+
+/**
+ * @brief Generate the signatures verified by the batch benchmarks
+ * @return Error code
+ **/
+
+static error_t benchEd25519PrepareBatch(void)
+{
+   error_t error;
+   uint_t i;
+   uint8_t privateKey[ED25519_PRIVATE_KEY_LEN];
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Each signature is issued by a distinct signer over a distinct message
+   for(i = 0; i < BENCH_ED25519_MAX_BATCH && !error; i++)
+   {
+      //Generate a key pair
+      error = ed25519GenerateKeyPair(benchPrngAlgo, benchPrngContext,
+         privateKey, benchEd25519BatchKeys[i]);
+
+      //Check status code
+      if(!error)
+      {
+         //Sign a 32-byte message
+         error = ed25519GenerateSignature(privateKey, benchEd25519BatchKeys[i],
+            benchInput + i * 32, 32, NULL, 0, 0,
+            benchEd25519BatchSignatures[i]);
+      }
+
+      //Fill the batch entry
+      benchEd25519BatchItems[i].publicKey = benchEd25519BatchKeys[i];
+      benchEd25519BatchItems[i].message = benchInput + i * 32;
+      benchEd25519BatchItems[i].messageLen = 32;
+      benchEd25519BatchItems[i].signature = benchEd25519BatchSignatures[i];
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
+#if (X25519_SUPPORT == ENABLED)
+
+/**
+ * @brief X25519 scalar multiplication
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchX25519(void *param)
+{
+   uint8_t u[CURVE25519_BYTE_LEN];
+
+   //Use the base point u = 9
+   osMemset(u, 0, CURVE25519_BYTE_LEN);
+   u[0] = 9;
+
+   return x25519(benchOutput, benchX25519PrivateKey, u);
+}
+
+#endif
+
+
+/**
+ * @brief Run the public-key algorithm benchmarks
+ **/
+
+void benchPkc(void)
+{
+   error_t error;
+#if (ED25519_SUPPORT == ENABLED)
+   uint_t i;
+   char_t name[24];
+#endif
+
+   //Prepare the message digest
+   error = benchPrngAlgo->read(benchPrngContext, benchDigest,
+      sizeof(benchDigest));
+   //Any error to report?
+   if(error)
+      return;
+
+#if (RSA_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+   benchRsa("RSA-1024", 1024);
+   benchRsa("RSA-2048", 2048);
+   benchRsa("RSA-3072", 3072);
+   benchRsa("RSA-4096", 4096);
+#endif
+
+#if (ECDSA_SUPPORT == ENABLED)
+#if (SECP256R1_SUPPORT == ENABLED)
+   benchEcdsa("ECDSA-P-256", SECP256R1_CURVE, 32);
+#endif
+#if (SECP384R1_SUPPORT == ENABLED)
+   benchEcdsa("ECDSA-P-384", SECP384R1_CURVE, 48);
+#endif
+#endif
+
+#if (ECDH_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED)
+   benchEcdh("ECDH-P-256", SECP256R1_CURVE);
+#endif
+
+#if (ED25519_SUPPORT == ENABLED)
+   benchRun("pkc", "Ed25519", "keygen", 0, benchEd25519KeyGen, NULL);
+
+   //Generate the key pair and the signature used by the next measurements
+   error = benchEd25519KeyGen(NULL);
+
+   //Check status code
+   if(!error)
+   {
+      error = benchEd25519Sign(NULL);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      benchRun("pkc", "Ed25519", "sign", 0, benchEd25519Sign, NULL);
+      benchRun("pkc", "Ed25519", "verify", 0, benchEd25519Verify, NULL);
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkc", "Ed25519", "setup", error);
+   }
+
+   //Generate the signatures of the batch verification benchmarks
+   error = benchEd25519PrepareBatch();
+
+   //Check status code
+   if(!error)
+   {
+      //Loop through the batch sizes (one operation verifies the whole batch)
+      for(i = 0; i < arraysize(benchEd25519BatchSizes); i++)
+      {
+         osSprintf(name, "Ed25519-batch-%u", benchEd25519BatchSizes[i]);
+
+         benchRun("pkc", name, "verify", 0, benchEd25519VerifyBatch,
+            (void *) &benchEd25519BatchSizes[i]);
+      }
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkc", "Ed25519-batch", "setup", error);
+   }
+#endif
+
+#if (X25519_SUPPORT == ENABLED)
+   //Generate a private key
+   error = benchPrngAlgo->read(benchPrngContext, benchX25519PrivateKey,
+      CURVE25519_BYTE_LEN);
+
+   //Check status code
+   if(!error)
+   {
+      benchRun("pkc", "X25519", "derive", 0, benchX25519, NULL);
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkc", "X25519", "setup", error);
+   }
+#endif
+}
+
+
+#if (KEM_SUPPORT == ENABLED)
+
+/**
+ * @brief KEM key pair generation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchKemKeyGen(void *param)
+{
+   return kemGenerateKeyPair(&benchKemContext, benchPrngAlgo,
+      benchPrngContext);
+}
+
+
+/**
+ * @brief KEM encapsulation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchKemEncapsulate(void *param)
+{
+   return kemEncapsulate(&benchKemContext, benchPrngAlgo, benchPrngContext,
+      benchKemCiphertext, benchKemSharedSecret);
+}
+
+
+/**
+ * @brief KEM decapsulation
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchKemDecapsulate(void *param)
+{
+   return kemDecapsulate(&benchKemContext, benchKemCiphertext,
+      benchKemSharedSecret);
+}
+
+#endif
+
+
+/**
+ * @brief Run the KEM benchmarks
+ **/
+
+void benchKem(void)
+{
+#if (KEM_SUPPORT == ENABLED)
+   error_t error;
+   uint_t i;
+   const KemAlgo *kemAlgo;
+
+   //Loop through the KEMs
+   for(i = 0; benchKemAlgos[i] != NULL; i++)
+   {
+      kemAlgo = benchKemAlgos[i];
+
+      //Make sure the shared secret fits in the buffer
+      if(kemAlgo->sharedSecretSize > sizeof(benchKemSharedSecret))
+         continue;
+
+      //Allocate a buffer to hold the ciphertext
+      benchKemCiphertext = cryptoAllocMem(kemAlgo->ciphertextSize);
+      //Failed to allocate memory?
+      if(benchKemCiphertext == NULL)
+         continue;
+
+      //Initialize KEM context
+      kemInit(&benchKemContext, kemAlgo);
+
+      //Measure key pair generation
+      benchRun("kem", kemAlgo->name, "keygen", 0, benchKemKeyGen, NULL);
+
+      //Generate the key pair and the ciphertext used by the next measurements
+      error = benchKemKeyGen(NULL);
+
+      //Check status code
+      if(!error)
+      {
+         error = benchKemEncapsulate(NULL);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         benchRun("kem", kemAlgo->name, "encaps", 0, benchKemEncapsulate,
+            NULL);
+         benchRun("kem", kemAlgo->name, "decaps", 0, benchKemDecapsulate,
+            NULL);
+      }
+      else
+      {
+         //Report the failure of the preliminary steps
+         benchFailed("kem", kemAlgo->name, "setup", error);
+      }
+
+      //Release KEM context
+      kemFree(&benchKemContext);
+      cryptoFreeMem(benchKemCiphertext);
+   }
+#endif
+}
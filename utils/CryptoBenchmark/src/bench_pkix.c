@@ -0,0 +1,1151 @@
+/**
+ * @file bench_pkix.c
+ * @brief Benchmarks of certificate and CRL processing
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include "core/crypto.h"
+#include "pkix/pem_import.h"
+#include "pkix/pem_export.h"
+#include "pkix/x509_cert_create.h"
+#include "pkix/x509_cert_parse.h"
+#include "pkix/x509_crl_parse.h"
+#include "pkix/x509_crl_validate.h"
+#include "pkix/x509_cert_validate.h"
+#include "pkix/x509_sign_verify.h"
+#include "pkix/x509_cache.h"
+#include "encoding/asn1.h"
+#include "ecc/ecdsa.h"
+#include "bench.h"
+
+#if (X509_SUPPORT == ENABLED)
+
+//Number of entries of the synthetic CRL
+#define BENCH_CRL_NUM_ENTRIES 50000
+
+//Length of the serial numbers, in bytes
+#define BENCH_CRL_SERIAL_LEN 16
+
+//Length of a RevokedCertificate entry, in bytes
+#define BENCH_CRL_ENTRY_LEN (4 + BENCH_CRL_SERIAL_LEN + 15)
+
+//Length of the signature of the CRL, in bytes
+#define BENCH_CRL_SIGNATURE_LEN 256
+
+//Number of certificates of the PEM bundle
+#define BENCH_BUNDLE_NUM_CERTS 200
+
+//Maximum length of a DER-encoded certificate of the bundle
+#define BENCH_BUNDLE_MAX_CERT_LEN 1024
+
+
+//sha256WithRSAEncryption algorithm identifier
+static const uint8_t benchSignAlgoId[] =
+{
+   0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01,
+   0x0B, 0x05, 0x00
+};
+
+//Issuer of the CRL and of the certificates (CN=Bench CA)
+static const uint8_t benchIssuerName[] =
+{
+   0x30, 0x13, 0x31, 0x11, 0x30, 0x0F, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+   0x08, 'B', 'e', 'n', 'c', 'h', ' ', 'C', 'A'
+};
+
+//UTCTime used for the thisUpdate, nextUpdate and revocationDate fields
+static const uint8_t benchUtcTime[] =
+{
+   0x17, 0x0D, '2', '4', '0', '1', '0', '1', '0', '0', '0', '0', '0', '0', 'Z'
+};
+
+//Working contexts
+static uint8_t *benchCrlData;
+static size_t benchCrlLen;
+static X509CrlInfo benchCrlInfo;
+static X509CrlIndex benchCrlIndex;
+static X509CertInfo benchCertInfo;
+static uint8_t benchSerialNumber[BENCH_CRL_SERIAL_LEN];
+static char_t *benchBundle;
+static size_t benchBundleLen;
+static X509CertInfo benchBundleCertInfo;
+static uint8_t benchBundleCert[BENCH_BUNDLE_MAX_CERT_LEN];
+static PemImportContext benchPemImportContext;
+#if (ECDSA_SUPPORT == ENABLED)
+static EcDomainParameters benchEcParams;
+static EcPrivateKey benchEcPrivateKey;
+static EcPublicKey benchEcPublicKey;
+static X509CertRequestInfo benchCertReqInfo;
+static char_t benchCertName[32];
+#endif
+#if (X509_CACHE_SUPPORT == ENABLED)
+static uint8_t benchCacheCert[BENCH_BUNDLE_MAX_CERT_LEN];
+static uint8_t benchCacheTampered[BENCH_BUNDLE_MAX_CERT_LEN];
+static size_t benchCacheCertLen;
+static uint_t benchCacheFailures;
+#endif
+
+
+/**
+ * @brief Generate the serial number of a certificate
+ * @param[in] i Certificate number
+ * @param[out] serialNumber Serial number
+ **/
+
+static void benchCrlSerialNumber(uint32_t i, uint8_t *serialNumber)
+{
+   uint_t j;
+   uint64_t x;
+
+   //The leading bytes are scrambled so that the CRL is not sorted
+   x = (uint64_t) (i + 1) * 0x9E3779B97F4A7C15ULL;
+   x ^= x >> 29;
+   x *= 0xBF58476D1CE4E5B9ULL;
+   x ^= x >> 32;
+
+   for(j = 0; j < 8; j++)
+   {
+      serialNumber[j] = (uint8_t) (x >> (56 - 8 * j));
+   }
+
+   //The serial number is a positive integer with no leading zero
+   serialNumber[0] = (serialNumber[0] & 0x3F) | 0x40;
+
+   //The trailing bytes make the serial numbers unique
+   osMemset(serialNumber + 8, 0, BENCH_CRL_SERIAL_LEN - 12);
+   STORE32BE(i, serialNumber + BENCH_CRL_SERIAL_LEN - 4);
+}
+
+
+/**
+ * @brief Wrap the data that starts at a given position in an ASN.1 tag
+ * @param[in] objType Tag number
+ * @param[in,out] data Contents of the tag, followed by enough room for the
+ *   header
+ * @param[in] length Length of the contents
+ * @return Total length of the tag
+ **/
+
+static size_t benchCrlWrap(uint_t objType, uint8_t *data, size_t length)
+{
+   size_t n;
+   Asn1Tag tag;
+
+   //The contents are moved forward to make room for the header
+   tag.constructed = (objType == ASN1_TYPE_SEQUENCE) ? TRUE : FALSE;
+   tag.objClass = ASN1_CLASS_UNIVERSAL;
+   tag.objType = objType;
+   tag.length = length;
+   tag.value = data;
+
+   //Write the tag
+   asn1WriteTag(&tag, FALSE, data, &n);
+
+   //Return the total length of the tag
+   return n;
+}
+
+
+/**
+ * @brief Generate a synthetic CRL
+ * @return Error code
+ **/
+
+static error_t benchCrlGenerate(void)
+{
+   uint_t i;
+   size_t n;
+   uint8_t *p;
+
+   //Allocate a buffer large enough for the CRL
+   benchCrlData = osAllocMem(BENCH_CRL_NUM_ENTRIES * BENCH_CRL_ENTRY_LEN +
+      1024);
+   //Failed to allocate memory?
+   if(benchCrlData == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //Format the list of revoked certificates
+   for(p = benchCrlData, i = 0; i < BENCH_CRL_NUM_ENTRIES; i++)
+   {
+      //userCertificate
+      p[0] = 0x30;
+      p[1] = BENCH_CRL_ENTRY_LEN - 2;
+      p[2] = 0x02;
+      p[3] = BENCH_CRL_SERIAL_LEN;
+      benchCrlSerialNumber(i, p + 4);
+
+      //revocationDate
+      osMemcpy(p + 4 + BENCH_CRL_SERIAL_LEN, benchUtcTime,
+         sizeof(benchUtcTime));
+
+      //Next entry
+      p += BENCH_CRL_ENTRY_LEN;
+   }
+
+   //revokedCertificates
+   n = benchCrlWrap(ASN1_TYPE_SEQUENCE, benchCrlData, p - benchCrlData);
+
+   //The fields that precede the list are inserted in front of it
+   p = benchCrlData + sizeof(benchSignAlgoId) + sizeof(benchIssuerName) +
+      2 * sizeof(benchUtcTime) + 3;
+
+   osMemmove(p, benchCrlData, n);
+
+   //version (v2), signature, issuer, thisUpdate and nextUpdate
+   p = benchCrlData;
+   p[0] = 0x02;
+   p[1] = 0x01;
+   p[2] = 0x01;
+   p += 3;
+   osMemcpy(p, benchSignAlgoId, sizeof(benchSignAlgoId));
+   p += sizeof(benchSignAlgoId);
+   osMemcpy(p, benchIssuerName, sizeof(benchIssuerName));
+   p += sizeof(benchIssuerName);
+   osMemcpy(p, benchUtcTime, sizeof(benchUtcTime));
+   p += sizeof(benchUtcTime);
+   osMemcpy(p, benchUtcTime, sizeof(benchUtcTime));
+   p += sizeof(benchUtcTime);
+
+   //tbsCertList
+   n = benchCrlWrap(ASN1_TYPE_SEQUENCE, benchCrlData, p + n - benchCrlData);
+
+   //signatureAlgorithm
+   p = benchCrlData + n;
+   osMemcpy(p, benchSignAlgoId, sizeof(benchSignAlgoId));
+   p += sizeof(benchSignAlgoId);
+
+   //signatureValue (the signature is not verified by the benchmarks)
+   osMemset(p, 0, BENCH_CRL_SIGNATURE_LEN + 1);
+   p += benchCrlWrap(ASN1_TYPE_BIT_STRING, p, BENCH_CRL_SIGNATURE_LEN + 1);
+
+   //CertificateList
+   benchCrlLen = benchCrlWrap(ASN1_TYPE_SEQUENCE, benchCrlData,
+      p - benchCrlData);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Check that the linear and indexed lookups agree
+ * @return Error code
+ **/
+
+static error_t benchCrlCheck(void)
+{
+   uint_t i;
+   error_t error1;
+   error_t error2;
+   static const uint32_t serials[] = {0, 1, 24999, 49999, 50000, 123456};
+
+   //Loop through the test serial numbers (the first four are listed)
+   for(i = 0; i < arraysize(serials); i++)
+   {
+      benchCrlSerialNumber(serials[i], benchSerialNumber);
+
+      error1 = x509CheckRevokedCertificate(&benchCertInfo, &benchCrlInfo);
+      error2 = x509CheckRevokedCertificateIndex(&benchCertInfo,
+         &benchCrlIndex, NULL);
+
+      //Both lookups shall return the expected status
+      if(error1 != error2 || error1 != ((serials[i] < BENCH_CRL_NUM_ENTRIES) ?
+         ERROR_CERTIFICATE_REVOKED : NO_ERROR))
+      {
+         return ERROR_FAILURE;
+      }
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Parse the CRL
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchCrlParse(void *param)
+{
+   return x509ParseCrl(benchCrlData, benchCrlLen, &benchCrlInfo);
+}
+
+
+/**
+ * @brief Build the revocation index of the CRL
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchCrlBuildIndex(void *param)
+{
+   error_t error;
+   X509CrlIndex index;
+
+   //Build the index
+   error = x509InitCrlIndex(&index, &benchCrlInfo);
+
+   //Release the index
+   x509FreeCrlIndex(&index);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Check a certificate that is not listed, walking the whole CRL
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchCrlCheckLinear(void *param)
+{
+   return x509CheckRevokedCertificate(&benchCertInfo, &benchCrlInfo);
+}
+
+
+/**
+ * @brief Check a certificate that is not listed, using the index
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchCrlCheckIndex(void *param)
+{
+   return x509CheckRevokedCertificateIndex(&benchCertInfo, &benchCrlIndex,
+      NULL);
+}
+
+
+/**
+ * @brief Run the CRL benchmarks
+ **/
+
+static void benchCrlLookup(void)
+{
+   error_t error;
+   const char_t *name;
+
+   //Name of the test case
+   name = "CRL-50000";
+
+   //Skip the generation of the CRL if no operation is to be measured
+   if(!benchSelected("pkix", name, "parse") &&
+      !benchSelected("pkix", name, "index") &&
+      !benchSelected("pkix", name, "check") &&
+      !benchSelected("pkix", "CRL-50000-idx", "check"))
+   {
+      return;
+   }
+
+   //Generate the CRL
+   error = benchCrlGenerate();
+
+   //Check status code
+   if(!error)
+   {
+      //Parse the CRL
+      error = benchCrlParse(NULL);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Build the revocation index
+      error = x509InitCrlIndex(&benchCrlIndex, &benchCrlInfo);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //The certificates to be checked are issued by the CRL issuer
+      osMemset(&benchCertInfo, 0, sizeof(X509CertInfo));
+      benchCertInfo.tbsCert.issuer.raw.value = benchIssuerName;
+      benchCertInfo.tbsCert.issuer.raw.length = sizeof(benchIssuerName);
+      benchCertInfo.tbsCert.serialNumber.value = benchSerialNumber;
+      benchCertInfo.tbsCert.serialNumber.length = BENCH_CRL_SERIAL_LEN;
+
+      //Both lookups must find the listed certificates
+      error = benchCrlCheck();
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //The measured lookups are for a certificate that is not listed, which
+      //is the common case
+      benchCrlSerialNumber(BENCH_CRL_NUM_ENTRIES, benchSerialNumber);
+
+      benchRun("pkix", name, "parse", benchCrlLen, benchCrlParse, NULL);
+      benchRun("pkix", name, "index", benchCrlLen, benchCrlBuildIndex, NULL);
+      benchRun("pkix", name, "check", 0, benchCrlCheckLinear, NULL);
+      benchRun("pkix", "CRL-50000-idx", "check", 0, benchCrlCheckIndex, NULL);
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkix", name, "setup", error);
+   }
+
+   //Release resources
+   x509FreeCrlIndex(&benchCrlIndex);
+   osFreeMem(benchCrlData);
+}
+
+#endif
+
+
+#if (X509_SUPPORT == ENABLED && PEM_SUPPORT == ENABLED && \
+   ECDSA_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+
+/**
+ * @brief Generate the key pair used to sign the certificates
+ * @return Error code
+ **/
+
+static error_t benchCertInit(void)
+{
+   error_t error;
+   X509CertRequestInfo *certReqInfo;
+
+   //Initialize EC domain parameters and key pair
+   ecInitDomainParameters(&benchEcParams);
+   ecInitPrivateKey(&benchEcPrivateKey);
+   ecInitPublicKey(&benchEcPublicKey);
+
+   //All the certificates are signed with the same P-256 key
+   error = ecLoadDomainParameters(&benchEcParams, SECP256R1_CURVE);
+
+   //Check status code
+   if(!error)
+   {
+      error = ecGenerateKeyPair(benchPrngAlgo, benchPrngContext,
+         &benchEcParams, &benchEcPrivateKey, &benchEcPublicKey);
+   }
+
+   //Point to the certificate request
+   certReqInfo = &benchCertReqInfo;
+
+   //Self-signed CA certificates
+   osMemset(certReqInfo, 0, sizeof(X509CertRequestInfo));
+   certReqInfo->subject.commonName.value = benchCertName;
+   certReqInfo->subject.organizationName.value = "Oryx Embedded";
+   certReqInfo->subject.organizationName.length = 13;
+   certReqInfo->subject.countryName.value = "FR";
+   certReqInfo->subject.countryName.length = 2;
+   certReqInfo->subjectPublicKeyInfo.oid.value = EC_PUBLIC_KEY_OID;
+   certReqInfo->subjectPublicKeyInfo.oid.length = sizeof(EC_PUBLIC_KEY_OID);
+   certReqInfo->subjectPublicKeyInfo.ecParams.namedCurve.value = SECP256R1_OID;
+   certReqInfo->subjectPublicKeyInfo.ecParams.namedCurve.length =
+      sizeof(SECP256R1_OID);
+   certReqInfo->attributes.extensionReq.basicConstraints.critical = TRUE;
+   certReqInfo->attributes.extensionReq.basicConstraints.cA = TRUE;
+   certReqInfo->attributes.extensionReq.basicConstraints.pathLenConstraint = -1;
+   certReqInfo->attributes.extensionReq.keyUsage.critical = TRUE;
+   certReqInfo->attributes.extensionReq.keyUsage.bitmap =
+      X509_KEY_USAGE_KEY_CERT_SIGN | X509_KEY_USAGE_CRL_SIGN;
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Release the key pair used to sign the certificates
+ **/
+
+static void benchCertDeinit(void)
+{
+   //Release resources
+   ecFreeDomainParameters(&benchEcParams);
+   ecFreePrivateKey(&benchEcPrivateKey);
+   ecFreePublicKey(&benchEcPublicKey);
+}
+
+
+/**
+ * @brief Generate a self-signed CA certificate
+ * @param[in] i Certificate number (selects the subject and serial number)
+ * @param[out] output DER-encoded certificate
+ * @param[out] written Length of the certificate, in bytes
+ * @return Error code
+ **/
+
+static error_t benchCertCreate(uint_t i, uint8_t *output, size_t *written)
+{
+   uint8_t serial[4];
+   X509SerialNumber serialNumber;
+   X509Validity validity;
+   X509SignAlgoId signAlgo;
+
+   //Each certificate has its own subject and serial number
+   benchCertReqInfo.subject.commonName.length = osSprintf(benchCertName,
+      "Bench Root CA %03u", i);
+
+   STORE32BE(i + 1, serial);
+   serialNumber.value = serial;
+   serialNumber.length = sizeof(serial);
+
+   //Validity period
+   osMemset(&validity, 0, sizeof(X509Validity));
+   validity.notBefore.year = 2024;
+   validity.notBefore.month = 1;
+   validity.notBefore.day = 1;
+   validity.notAfter.year = 2044;
+   validity.notAfter.month = 1;
+   validity.notAfter.day = 1;
+
+   //Signature algorithm
+   osMemset(&signAlgo, 0, sizeof(X509SignAlgoId));
+   signAlgo.oid.value = ECDSA_WITH_SHA256_OID;
+   signAlgo.oid.length = sizeof(ECDSA_WITH_SHA256_OID);
+
+   //Create the certificate
+   return x509CreateCertificate(benchPrngAlgo, benchPrngContext,
+      &benchCertReqInfo, &benchEcPublicKey, NULL, &serialNumber, &validity,
+      &signAlgo, &benchEcPrivateKey, output, written);
+}
+
+
+/**
+ * @brief Generate a PEM bundle of CA certificates
+ * @return Error code
+ **/
+
+static error_t benchBundleGenerate(void)
+{
+   error_t error;
+   uint_t i;
+   size_t n;
+   size_t m;
+
+   //Allocate a buffer large enough for the bundle
+   benchBundle = osAllocMem(BENCH_BUNDLE_NUM_CERTS *
+      BENCH_BUNDLE_MAX_CERT_LEN * 2);
+   //Failed to allocate memory?
+   if(benchBundle == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //Generate the signing key
+   error = benchCertInit();
+
+   //Generate the certificates
+   for(benchBundleLen = 0, i = 0; i < BENCH_BUNDLE_NUM_CERTS && !error; i++)
+   {
+      //Create the certificate
+      error = benchCertCreate(i, benchBundleCert, &n);
+
+      //Check status code
+      if(!error)
+      {
+         //Append the PEM encoding of the certificate to the bundle
+         error = pemExportCertificate(benchBundleCert, n,
+            benchBundle + benchBundleLen, &m);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         benchBundleLen += m;
+      }
+   }
+
+   //Release the signing key
+   benchCertDeinit();
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Import the bundle one certificate at a time
+ *
+ * The length of each certificate is queried first, then the certificate is
+ * decoded into a freshly allocated buffer and parsed
+ *
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchBundleImport(void *param)
+{
+   error_t error;
+   uint_t count;
+   size_t n;
+   size_t length;
+   const char_t *p;
+   uint8_t *der;
+
+   //Point to the beginning of the bundle
+   p = benchBundle;
+   length = benchBundleLen;
+
+   //Loop through the certificates
+   for(count = 0; ; count++)
+   {
+      //Retrieve the length of the next certificate
+      error = pemImportCertificate(p, length, NULL, &n, NULL);
+      //End of the bundle?
+      if(error)
+         break;
+
+      //Allocate a buffer to hold the certificate
+      der = cryptoAllocMem(n);
+      //Failed to allocate memory?
+      if(der == NULL)
+         return ERROR_OUT_OF_MEMORY;
+
+      //Decode the certificate
+      error = pemImportCertificate(p, length, der, &n, &n);
+
+      //Check status code
+      if(!error)
+      {
+         //Advance to the next certificate
+         p += n;
+         length -= n;
+
+         //Parse the certificate
+         error = x509ParseCertificate(der, n, &benchBundleCertInfo);
+      }
+
+      //Release the buffer
+      cryptoFreeMem(der);
+
+      //Any error to report?
+      if(error)
+         return error;
+   }
+
+   //Check whether all the certificates have been imported
+   if(error != ERROR_END_OF_FILE || count != BENCH_BUNDLE_NUM_CERTS)
+      return ERROR_FAILURE;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Parse a certificate decoded by the streaming importer
+ * @param[in] data DER-encoded certificate
+ * @param[in] length Length of the certificate, in bytes
+ * @param[in] param Non-NULL if the certificate is to be parsed
+ * @return Error code
+ **/
+
+static error_t benchBundleCallback(const uint8_t *data, size_t length,
+   void *param)
+{
+   error_t error;
+
+   //Parse the certificate, if requested
+   if(param != NULL)
+   {
+      error = x509ParseCertificate(data, length, &benchBundleCertInfo);
+   }
+   else
+   {
+      error = NO_ERROR;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Import the bundle with the streaming importer
+ * @param[in] param Non-NULL if the certificates are to be parsed
+ * @return Error code
+ **/
+
+static error_t benchBundleStream(void *param)
+{
+   error_t error;
+
+   //Initialize the streaming importer
+   error = pemImportInit(&benchPemImportContext, "CERTIFICATE",
+      benchBundleCert, sizeof(benchBundleCert), benchBundleCallback, param);
+
+   //Check status code
+   if(!error)
+   {
+      //The bundle is passed in a single chunk
+      error = pemImportUpdate(&benchPemImportContext, benchBundle,
+         benchBundleLen);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      error = pemImportFinal(&benchPemImportContext);
+   }
+
+   //Check whether all the certificates have been imported
+   if(!error && benchPemImportContext.count != BENCH_BUNDLE_NUM_CERTS)
+   {
+      error = ERROR_FAILURE;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Run the PEM bundle benchmarks
+ **/
+
+static void benchBundleLoad(void)
+{
+   error_t error;
+   const char_t *name;
+
+   //Name of the test case
+   name = "PEM-200";
+
+   //Skip the generation of the bundle if no operation is to be measured
+   if(!benchSelected("pkix", name, "import") &&
+      !benchSelected("pkix", name, "stream") &&
+      !benchSelected("pkix", name, "decode"))
+   {
+      return;
+   }
+
+   //Generate the bundle
+   error = benchBundleGenerate();
+
+   //Check status code
+   if(!error)
+   {
+      //Decode and parse the certificates one at a time
+      benchRun("pkix", name, "import", benchBundleLen, benchBundleImport,
+         NULL);
+
+      //Decode and parse the certificates with the streaming importer
+      benchRun("pkix", name, "stream", benchBundleLen, benchBundleStream,
+         (void *) name);
+
+      //Decode only (Base64 and PEM framing)
+      benchRun("pkix", name, "decode", benchBundleLen, benchBundleStream,
+         NULL);
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkix", name, "setup", error);
+   }
+
+   //Release resources
+   osFreeMem(benchBundle);
+}
+
+#if (X509_CACHE_SUPPORT == ENABLED)
+
+/**
+ * @brief Generate the certificate used by the cache tests
+ *
+ * The tampered copy differs from the certificate in the last byte of its
+ * signature only
+ *
+ * @return Error code
+ **/
+
+static error_t benchCacheGenerate(void)
+{
+   error_t error;
+
+   //Generate the signing key
+   error = benchCertInit();
+
+   //Check status code
+   if(!error)
+   {
+      //Create a self-signed certificate
+      error = benchCertCreate(0, benchCacheCert, &benchCacheCertLen);
+   }
+
+   //Release the signing key
+   benchCertDeinit();
+
+   //Check status code
+   if(!error)
+   {
+      //Flip the last bit of the signature
+      osMemcpy(benchCacheTampered, benchCacheCert, benchCacheCertLen);
+      benchCacheTampered[benchCacheCertLen - 1] ^= 0x01;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Check the outcome of a cache test
+ * @param[in] label Description of the test
+ * @param[in] condition Expected outcome
+ **/
+
+static void benchCacheExpect(const char_t *label, bool_t condition)
+{
+   //Failed test?
+   if(!condition)
+   {
+      fprintf(stderr, "KAT X.509 cache (%s) failed\r\n", label);
+
+      //Increment the number of failed tests
+      benchCacheFailures++;
+   }
+}
+
+
+/**
+ * @brief Cache tests
+ *
+ * A certificate must be parsed once and then served from the cache, its
+ * signature must be verified once and then remembered, and a copy with a
+ * corrupted signature must be rejected every time even though the same
+ * tbsCertificate has been verified before
+ **/
+
+static void benchCacheTest(void)
+{
+   error_t error;
+   error_t error2;
+   const X509CertInfo *certInfo;
+   const X509CertInfo *certInfo2;
+   const X509CertInfo *tamperedInfo;
+   X509CacheStats s0;
+   X509CacheStats s;
+
+   //Start from an empty cache
+   x509CacheFlush();
+   x509CacheGetStats(&s0);
+
+   //The first lookup parses the certificate
+   error = x509CacheGetCertificate(benchCacheCert, benchCacheCertLen, FALSE,
+      &certInfo);
+   x509CacheGetStats(&s);
+   benchCacheExpect("certificate miss", !error &&
+      s.certMisses == s0.certMisses + 1 && s.certHits == s0.certHits);
+
+   //Any error to report?
+   if(error)
+      return;
+
+   //The second lookup returns the same parsed certificate
+   error = x509CacheGetCertificate(benchCacheCert, benchCacheCertLen, FALSE,
+      &certInfo2);
+   x509CacheGetStats(&s);
+   benchCacheExpect("certificate hit", !error && certInfo2 == certInfo &&
+      s.certHits == s0.certHits + 1);
+
+   //Release the second reference
+   if(!error)
+   {
+      x509CacheReleaseCertificate(certInfo2);
+   }
+
+   //The first validation performs the public key operation
+   error = x509ValidateCertificate(certInfo, certInfo, 0);
+   x509CacheGetStats(&s);
+   benchCacheExpect("signature miss", !error &&
+      s.signMisses == s0.signMisses + 1 && s.signHits == s0.signHits);
+
+   //The second validation is served from the cache
+   error = x509ValidateCertificate(certInfo, certInfo, 0);
+   x509CacheGetStats(&s);
+   benchCacheExpect("signature hit", !error &&
+      s.signHits == s0.signHits + 1);
+
+   //The tampered copy is a different certificate
+   error = x509CacheGetCertificate(benchCacheTampered, benchCacheCertLen,
+      FALSE, &tamperedInfo);
+   x509CacheGetStats(&s);
+   benchCacheExpect("tampered certificate miss", !error &&
+      tamperedInfo != certInfo && s.certMisses == s0.certMisses + 2);
+
+   //Check status code
+   if(!error)
+   {
+      //The corrupted signature must be rejected, and the failure must not
+      //be remembered as a success
+      error = x509ValidateCertificate(tamperedInfo, certInfo, 0);
+      error2 = x509ValidateCertificate(tamperedInfo, certInfo, 0);
+      x509CacheGetStats(&s);
+      benchCacheExpect("tampered signature", error != NO_ERROR &&
+         error2 != NO_ERROR && s.signHits == s0.signHits + 1 &&
+         s.signMisses == s0.signMisses + 3);
+
+      //Release the tampered copy
+      x509CacheReleaseCertificate(tamperedInfo);
+   }
+
+   //Drop the certificate while it is still referenced
+   x509CacheInvalidate(benchCacheCert, benchCacheCertLen);
+
+   //The next lookup parses the certificate again
+   error = x509CacheGetCertificate(benchCacheCert, benchCacheCertLen, FALSE,
+      &certInfo2);
+   x509CacheGetStats(&s);
+   benchCacheExpect("invalidated certificate", !error &&
+      s.certMisses == s0.certMisses + 3);
+
+   //Release the references
+   if(!error)
+   {
+      x509CacheReleaseCertificate(certInfo2);
+   }
+
+   x509CacheReleaseCertificate(certInfo);
+
+   //The signature memo has been flushed as well
+   error = x509CacheGetCertificate(benchCacheCert, benchCacheCertLen, FALSE,
+      &certInfo);
+
+   //Check status code
+   if(!error)
+   {
+      error = x509ValidateCertificate(certInfo, certInfo, 0);
+      x509CacheGetStats(&s);
+      benchCacheExpect("invalidated signature", !error &&
+         s.signMisses == s0.signMisses + 4);
+
+      //Release the reference
+      x509CacheReleaseCertificate(certInfo);
+   }
+
+   //Leave the cache empty
+   x509CacheFlush();
+}
+
+
+/**
+ * @brief Parse the certificate without the cache
+ * @param[in] param Parsed certificate
+ * @return Error code
+ **/
+
+static error_t benchCacheParse(void *param)
+{
+   return x509ParseCertificate(benchCacheCert, benchCacheCertLen,
+      (X509CertInfo *) param);
+}
+
+
+/**
+ * @brief Retrieve the certificate from the cache
+ * @param[in] param Unused parameter
+ * @return Error code
+ **/
+
+static error_t benchCacheGet(void *param)
+{
+   error_t error;
+   const X509CertInfo *certInfo;
+
+   //Look up the certificate
+   error = x509CacheGetCertificate(benchCacheCert, benchCacheCertLen, FALSE,
+      &certInfo);
+
+   //Check status code
+   if(!error)
+   {
+      x509CacheReleaseCertificate(certInfo);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Verify the signature of the certificate without the cache
+ * @param[in] param Parsed certificate
+ * @return Error code
+ **/
+
+static error_t benchCacheVerify(void *param)
+{
+   const X509CertInfo *certInfo;
+
+   //Point to the parsed certificate
+   certInfo = (const X509CertInfo *) param;
+
+   //Perform the public key operation
+   return x509VerifySignature(&certInfo->tbsCert.raw,
+      &certInfo->signatureAlgo, &certInfo->tbsCert.subjectPublicKeyInfo,
+      &certInfo->signatureValue);
+}
+
+
+/**
+ * @brief Verify the signature of the certificate through the cache
+ * @param[in] param Parsed certificate
+ * @return Error code
+ **/
+
+static error_t benchCacheVerifyCached(void *param)
+{
+   const X509CertInfo *certInfo;
+
+   //Point to the parsed certificate
+   certInfo = (const X509CertInfo *) param;
+
+   //Look up the verification memo
+   return x509CacheVerifySignature(&certInfo->tbsCert.raw,
+      &certInfo->signatureAlgo, &certInfo->tbsCert.subjectPublicKeyInfo,
+      &certInfo->signatureValue);
+}
+
+
+/**
+ * @brief Run the certificate cache benchmarks
+ **/
+
+static void benchCacheLookup(void)
+{
+   error_t error;
+
+   //Skip the generation of the certificate if no operation is to be measured
+   if(!benchSelected("pkix", "Cert-P256", "parse") &&
+      !benchSelected("pkix", "Cert-P256", "verify") &&
+      !benchSelected("pkix", "Cert-P256-cached", "get") &&
+      !benchSelected("pkix", "Cert-P256-cached", "verify"))
+   {
+      return;
+   }
+
+   //Generate the certificate
+   error = benchCacheGenerate();
+
+   //Check status code
+   if(!error)
+   {
+      error = x509ParseCertificate(benchCacheCert, benchCacheCertLen,
+         &benchCertInfo);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Uncached operations
+      benchRun("pkix", "Cert-P256", "parse", benchCacheCertLen,
+         benchCacheParse, &benchBundleCertInfo);
+
+      benchRun("pkix", "Cert-P256", "verify", benchCacheCertLen,
+         benchCacheVerify, &benchCertInfo);
+
+      //Cache hits
+      benchRun("pkix", "Cert-P256-cached", "get", benchCacheCertLen,
+         benchCacheGet, NULL);
+
+      benchRun("pkix", "Cert-P256-cached", "verify", benchCacheCertLen,
+         benchCacheVerifyCached, &benchCertInfo);
+
+      //Leave the cache empty
+      x509CacheFlush();
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("pkix", "Cert-P256", "setup", error);
+   }
+}
+
+#endif
+#endif
+
+
+/**
+ * @brief Run the certificate and CRL benchmarks
+ **/
+
+void benchPkix(void)
+{
+#if (X509_SUPPORT == ENABLED)
+   //Revocation checks against a large CRL
+   benchCrlLookup();
+#endif
+#if (X509_SUPPORT == ENABLED && PEM_SUPPORT == ENABLED && \
+   ECDSA_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED)
+   //Loading of a bundle of CA certificates
+   benchBundleLoad();
+#endif
+#if (X509_SUPPORT == ENABLED && PEM_SUPPORT == ENABLED && \
+   ECDSA_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED && X509_CACHE_SUPPORT == ENABLED)
+   //Parsed certificate and signature cache
+   benchCacheLookup();
+#endif
+}
+
+
+/**
+ * @brief Run the certificate known-answer tests
+ * @return Error code
+ **/
+
+error_t benchPkixKat(void)
+{
+#if (X509_SUPPORT == ENABLED && PEM_SUPPORT == ENABLED && \
+   ECDSA_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED && \
+   SHA256_SUPPORT == ENABLED && X509_CACHE_SUPPORT == ENABLED)
+   error_t error;
+
+   //Reset the number of failed tests
+   benchCacheFailures = 0;
+
+   //Generate the certificate
+   error = benchCacheGenerate();
+
+   //Check status code
+   if(!error)
+   {
+      //Hit, miss and tamper checks of the X.509 cache
+      benchCacheTest();
+   }
+   else
+   {
+      fprintf(stderr, "KAT X.509 cache setup failed (error %d)\r\n", error);
+      benchCacheFailures++;
+   }
+
+   //Return status code
+   return (benchCacheFailures == 0) ? NO_ERROR : ERROR_FAILURE;
+#else
+   //No known-answer test available
+   return NO_ERROR;
+#endif
+}
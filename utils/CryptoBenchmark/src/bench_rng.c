@@ -0,0 +1,336 @@
+/**
+ * @file bench_rng.c
+ * @brief Benchmarks of pseudo-random number generators
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * A given number of tasks concurrently draw short random values (the size of
+ * a TCP initial sequence number or of a DNS query identifier) from a PRNG.
+ * The generator is either shared by all the tasks, or, for CTR_DRBG, each
+ * task reads its own child instance seeded from a common master. The figure
+ * reported is the total number of reads per second
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/crypto.h"
+#include "rng/yarrow.h"
+#include "rng/ctr_drbg.h"
+#include "bench.h"
+
+//Maximum number of concurrent tasks
+#define BENCH_RNG_MAX_TASKS 8
+
+//Size of each random value, in bytes
+#define BENCH_RNG_READ_SIZE 4
+
+
+/**
+ * @brief Reader task context
+ **/
+
+typedef struct
+{
+   OsSemaphore *semaphore;     ///<Semaphore released when the task completes
+   volatile bool_t *stop;      ///<Flag telling the task to stop
+   const PrngAlgo *prngAlgo;   ///<PRNG algorithm
+   void *prngContext;          ///<PRNG context read by the task
+   uint32_t count;             ///<Number of reads performed
+   error_t error;              ///<Status of the last read
+} BenchRngTask;
+
+
+//Number of concurrent tasks used by the test cases
+static const uint_t benchRngTaskCounts[] = {1, 2, 4, BENCH_RNG_MAX_TASKS};
+
+//Working contexts
+#if (YARROW_SUPPORT == ENABLED)
+static YarrowContext benchRngYarrowContext;
+#endif
+#if (CTR_DRBG_SUPPORT == ENABLED)
+static CtrDrbgContext benchRngMasterContext;
+static CtrDrbgContext benchRngChildContexts[BENCH_RNG_MAX_TASKS];
+#endif
+
+
+/**
+ * @brief Reader task
+ * @param[in] param Pointer to the task context
+ **/
+
+static void benchRngTaskFunc(void *param)
+{
+   uint8_t value[BENCH_RNG_READ_SIZE];
+   BenchRngTask *task;
+
+   //Point to the task context
+   task = (BenchRngTask *) param;
+
+   //Run until the measurement time has elapsed
+   while(!*task->stop && !task->error)
+   {
+      //Draw a random value
+      task->error = task->prngAlgo->read(task->prngContext, value,
+         BENCH_RNG_READ_SIZE);
+
+      //Count the number of reads
+      task->count++;
+   }
+
+   //Notify the calling task
+   osReleaseSemaphore(task->semaphore);
+
+   //Kill ourselves
+   osDeleteTask(OS_SELF_TASK_ID);
+}
+
+
+/**
+ * @brief Concurrent reads
+ * @param[in] algo Name of the test case
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContexts PRNG context read by each task
+ * @param[in] numTasks Number of tasks
+ **/
+
+static void benchRngRead(const char_t *algo, const PrngAlgo *prngAlgo,
+   void *const *prngContexts, uint_t numTasks)
+{
+   error_t error;
+   uint_t i;
+   uint_t numCreated;
+   char_t op[16];
+   OsTaskId taskId;
+   OsSemaphore semaphore;
+   volatile bool_t stop;
+   BenchRngTask tasks[BENCH_RNG_MAX_TASKS];
+   BenchResult result;
+
+   //Name of the operation
+   osSprintf(op, "read-%ut", numTasks);
+
+   //Skip the benchmark if the name does not match the user-defined filter
+   if(!benchSelected("rng", algo, op))
+      return;
+
+   //Create a semaphore to wait for the tasks
+   if(!osCreateSemaphore(&semaphore, 0))
+   {
+      benchFailed("rng", algo, op, ERROR_OUT_OF_RESOURCES);
+      return;
+   }
+
+   //Clear the result
+   osMemset(&result, 0, sizeof(BenchResult));
+   result.category = "rng";
+   result.algo = algo;
+   result.op = op;
+   result.size = BENCH_RNG_READ_SIZE;
+
+   //Start of the measurement
+   stop = FALSE;
+   result.time = benchGetTime();
+
+   //Create the tasks
+   for(numCreated = 0; numCreated < numTasks; numCreated++)
+   {
+      //Initialize task context
+      tasks[numCreated].semaphore = &semaphore;
+      tasks[numCreated].stop = &stop;
+      tasks[numCreated].prngAlgo = prngAlgo;
+      tasks[numCreated].prngContext = prngContexts[numCreated];
+      tasks[numCreated].count = 0;
+      tasks[numCreated].error = NO_ERROR;
+
+      //Create a task
+      taskId = osCreateTask("Bench", benchRngTaskFunc, &tasks[numCreated],
+         &OS_TASK_DEFAULT_PARAMS);
+
+      //Unable to create the task?
+      if(taskId == (OsTaskId) OS_INVALID_TASK_ID)
+         break;
+   }
+
+   //Let the tasks run for the minimum measurement time
+   if(numCreated == numTasks)
+   {
+      osDelayTask(benchSettings.minTime);
+   }
+
+   //Tell the tasks to stop and wait for them
+   stop = TRUE;
+
+   for(i = 0; i < numCreated; i++)
+   {
+      osWaitForSemaphore(&semaphore, INFINITE_DELAY);
+   }
+
+   //End of the measurement
+   result.time = benchGetTime() - result.time;
+
+   //Release semaphore
+   osDeleteSemaphore(&semaphore);
+
+   //Check whether all the tasks could be created
+   error = (numCreated < numTasks) ? ERROR_OUT_OF_RESOURCES : NO_ERROR;
+
+   //Total number of reads
+   for(i = 0; i < numCreated; i++)
+   {
+      //Check whether the reads succeeded
+      if(tasks[i].error)
+      {
+         error = tasks[i].error;
+      }
+
+      result.iterations += tasks[i].count;
+   }
+
+   //Report the result
+   if(!error && result.iterations > 0)
+   {
+      benchReport(&result);
+   }
+   else
+   {
+      benchFailed("rng", algo, op, error);
+   }
+}
+
+
+/**
+ * @brief Run the PRNG benchmarks
+ **/
+
+void benchRng(void)
+{
+   error_t error;
+   uint_t i;
+   uint8_t seed[32];
+   void *contexts[BENCH_RNG_MAX_TASKS];
+
+   //The generators are seeded with a constant so that successive runs
+   //perform the same computations
+   for(i = 0; i < sizeof(seed); i++)
+   {
+      seed[i] = (uint8_t) i;
+   }
+
+#if (YARROW_SUPPORT == ENABLED)
+   //Initialize the shared Yarrow instance
+   error = yarrowInit(&benchRngYarrowContext);
+   //Any error to report?
+   if(error)
+      return;
+
+   //Seed the PRNG
+   error = yarrowSeed(&benchRngYarrowContext, seed, sizeof(seed));
+
+   //Check status code
+   if(!error)
+   {
+      //All the tasks read the same instance
+      for(i = 0; i < BENCH_RNG_MAX_TASKS; i++)
+      {
+         contexts[i] = &benchRngYarrowContext;
+      }
+
+      //Loop through the number of tasks
+      for(i = 0; i < arraysize(benchRngTaskCounts); i++)
+      {
+         benchRngRead("Yarrow", YARROW_PRNG_ALGO, contexts,
+            benchRngTaskCounts[i]);
+      }
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("rng", "Yarrow", "setup", error);
+   }
+
+   //Release PRNG context
+   yarrowDeinit(&benchRngYarrowContext);
+#endif
+
+#if (CTR_DRBG_SUPPORT == ENABLED)
+   //Initialize and seed the master instance
+   error = ctrDrbgInit(&benchRngMasterContext);
+
+   //Check status code
+   if(!error)
+   {
+      error = ctrDrbgSeed(&benchRngMasterContext, seed, sizeof(seed));
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //All the tasks read the master instance
+      for(i = 0; i < BENCH_RNG_MAX_TASKS; i++)
+      {
+         contexts[i] = &benchRngMasterContext;
+      }
+
+      //Loop through the number of tasks
+      for(i = 0; i < arraysize(benchRngTaskCounts); i++)
+      {
+         benchRngRead("CTR_DRBG", CTR_DRBG_PRNG_ALGO, contexts,
+            benchRngTaskCounts[i]);
+      }
+
+      //Each task reads its own child instance
+      for(i = 0; i < BENCH_RNG_MAX_TASKS && !error; i++)
+      {
+         error = ctrDrbgInitChild(&benchRngChildContexts[i],
+            &benchRngMasterContext);
+
+         contexts[i] = &benchRngChildContexts[i];
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Loop through the number of tasks
+      for(i = 0; i < arraysize(benchRngTaskCounts); i++)
+      {
+         benchRngRead("CTR_DRBG-per-task", CTR_DRBG_PRNG_ALGO, contexts,
+            benchRngTaskCounts[i]);
+      }
+   }
+   else
+   {
+      //Report the failure of the preliminary steps
+      benchFailed("rng", "CTR_DRBG", "setup", error);
+   }
+
+   //Release PRNG contexts
+   for(i = 0; i < BENCH_RNG_MAX_TASKS; i++)
+   {
+      ctrDrbgDeinit(&benchRngChildContexts[i]);
+   }
+
+   ctrDrbgDeinit(&benchRngMasterContext);
+#endif
+}
@@ -0,0 +1,1015 @@
+/**
+ * @file bench_symmetric.c
+ * @brief Benchmarks of hash functions, ciphers, AEAD and MAC algorithms
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/crypto.h"
+#include "hash/hash_algorithms.h"
+#include "cipher/cipher_algorithms.h"
+#include "cipher_modes/cipher_modes.h"
+#include "aead/aead_algorithms.h"
+#include "mac/mac_algorithms.h"
+#include "bench.h"
+
+//Largest number of messages hashed together
+#define BENCH_MAX_LANES 16
+
+
+/**
+ * @brief Parameters of a symmetric benchmark
+ **/
+
+typedef struct
+{
+   const HashAlgo *hashAlgo;     ///<Hash algorithm
+   const CipherAlgo *cipherAlgo; ///<Cipher algorithm
+   size_t keyLen;                ///<Length of the key, in bytes
+   size_t length;                ///<Length of the message, in bytes
+   uint_t count;                 ///<Number of independent messages
+} BenchSymParam;
+
+
+/**
+ * @brief Block cipher under test
+ **/
+
+typedef struct
+{
+   const char_t *name;
+   const CipherAlgo *cipherAlgo;
+   size_t keyLen;
+} BenchCipherInfo;
+
+
+#if (AES_SUPPORT == ENABLED)
+//AES without the multi-block entry points (reference for the modes that
+//process several blocks per call)
+static CipherAlgo benchAesSingleBlockAlgo;
+#endif
+
+//Hash algorithms under test
+static const HashAlgo *const benchHashAlgos[] =
+{
+#if (MD5_SUPPORT == ENABLED)
+   MD5_HASH_ALGO,
+#endif
+#if (SHA1_SUPPORT == ENABLED)
+   SHA1_HASH_ALGO,
+#endif
+#if (SHA224_SUPPORT == ENABLED)
+   SHA224_HASH_ALGO,
+#endif
+#if (SHA256_SUPPORT == ENABLED)
+   SHA256_HASH_ALGO,
+#endif
+#if (SHA384_SUPPORT == ENABLED)
+   SHA384_HASH_ALGO,
+#endif
+#if (SHA512_SUPPORT == ENABLED)
+   SHA512_HASH_ALGO,
+#endif
+#if (SHA3_256_SUPPORT == ENABLED)
+   SHA3_256_HASH_ALGO,
+#endif
+#if (SHA3_512_SUPPORT == ENABLED)
+   SHA3_512_HASH_ALGO,
+#endif
+#if (BLAKE2B512_SUPPORT == ENABLED)
+   BLAKE2B512_HASH_ALGO,
+#endif
+#if (BLAKE2S256_SUPPORT == ENABLED)
+   BLAKE2S256_HASH_ALGO,
+#endif
+#if (SM3_SUPPORT == ENABLED)
+   SM3_HASH_ALGO,
+#endif
+   NULL
+};
+
+//Block ciphers under test
+static const BenchCipherInfo benchCipherInfos[] =
+{
+#if (AES_SUPPORT == ENABLED)
+   {"AES-128", AES_CIPHER_ALGO, 16},
+   {"AES-192", AES_CIPHER_ALGO, 24},
+   {"AES-256", AES_CIPHER_ALGO, 32},
+   {"AES-128-1blk", &benchAesSingleBlockAlgo, 16},
+#endif
+#if (CAMELLIA_SUPPORT == ENABLED)
+   {"Camellia-128", CAMELLIA_CIPHER_ALGO, 16},
+   {"Camellia-256", CAMELLIA_CIPHER_ALGO, 32},
+#endif
+#if (ARIA_SUPPORT == ENABLED)
+   {"ARIA-128", ARIA_CIPHER_ALGO, 16},
+#endif
+#if (SM4_SUPPORT == ENABLED)
+   {"SM4", SM4_CIPHER_ALGO, 16},
+#endif
+#if (DES3_SUPPORT == ENABLED)
+   {"3DES", DES3_CIPHER_ALGO, 24},
+#endif
+   {NULL, NULL, 0}
+};
+
+//Number of independent messages hashed together by the multi-lane benchmarks
+static const uint_t benchLaneCounts[] = {1, 2, 4, 8, BENCH_MAX_LANES};
+
+//Length of each message hashed by the multi-lane benchmarks
+static const size_t benchLaneMsgSizes[] = {64, 1024};
+
+//Message sizes of the ChaCha20Poly1305 benchmarks (short packet, typical
+//record and bulk transfer)
+static const size_t benchChachaPolyMsgSizes[] = {64, 1024, 65536};
+
+//Working contexts
+static HashContext benchHashContext;
+static CipherContext benchCipherContext;
+static uint8_t benchKey[64];
+static uint8_t benchIv[16];
+static uint8_t benchTag[16];
+static uint8_t benchAad[13];
+
+#if (XTS_SUPPORT == ENABLED)
+static XtsContext benchXtsContext;
+#endif
+#if (CHACHA_SUPPORT == ENABLED)
+static ChachaContext benchChachaContext;
+#endif
+#if (GCM_SUPPORT == ENABLED)
+static GcmContext benchGcmContext;
+#endif
+#if (HMAC_SUPPORT == ENABLED)
+static HmacContext benchHmacContext;
+#endif
+#if (CMAC_SUPPORT == ENABLED)
+static CmacContext benchCmacContext;
+#endif
+#if (GMAC_SUPPORT == ENABLED)
+static GmacContext benchGmacContext;
+#endif
+#if (POLY1305_SUPPORT == ENABLED)
+static Poly1305Context benchPoly1305Context;
+#endif
+
+
+/**
+ * @brief Digest a message
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchHashDigest(void *param)
+{
+   const BenchSymParam *p;
+
+   //Point to the benchmark parameters
+   p = (const BenchSymParam *) param;
+
+   //Digest the message using a preallocated context
+   p->hashAlgo->init(&benchHashContext);
+   p->hashAlgo->update(&benchHashContext, benchInput, p->length);
+   p->hashAlgo->final(&benchHashContext, benchOutput);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+#if (SHA256_SUPPORT == ENABLED || SHA512_SUPPORT == ENABLED)
+
+/**
+ * @brief Digest several independent messages in lockstep
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchHashDigestMulti(void *param)
+{
+   error_t error;
+   uint_t i;
+   const void *data[BENCH_MAX_LANES];
+   uint8_t *digest[BENCH_MAX_LANES];
+   const BenchSymParam *p;
+
+   //Point to the benchmark parameters
+   p = (const BenchSymParam *) param;
+
+   //Each message is taken from a distinct part of the input buffer
+   for(i = 0; i < p->count; i++)
+   {
+      data[i] = benchInput + i * p->length;
+      digest[i] = benchOutput + i * p->hashAlgo->digestSize;
+   }
+
+#if (SHA256_SUPPORT == ENABLED)
+   //SHA-256?
+   if(p->hashAlgo == SHA256_HASH_ALGO)
+   {
+      error = sha256ComputeMulti(data, p->length, digest, p->count);
+   }
+   else
+#endif
+#if (SHA512_SUPPORT == ENABLED)
+   //SHA-512?
+   if(p->hashAlgo == SHA512_HASH_ALGO)
+   {
+      error = sha512ComputeMulti(data, p->length, digest, p->count);
+   }
+   else
+#endif
+   //Unknown hash algorithm?
+   {
+      error = ERROR_UNSUPPORTED_HASH_ALGO;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Run the multi-lane benchmarks of a hash function
+ * @param[in] hashAlgo Hash algorithm
+ *
+ * The size of each record is the total number of bytes hashed by a call, so
+ * that the throughput is the aggregate throughput of all lanes
+ *
+ **/
+
+static void benchHashMulti(const HashAlgo *hashAlgo)
+{
+   uint_t i;
+   uint_t j;
+   char_t name[24];
+   BenchSymParam param;
+
+   //Clear parameters
+   osMemset(&param, 0, sizeof(BenchSymParam));
+   param.hashAlgo = hashAlgo;
+
+   //Loop through the number of lanes
+   for(i = 0; i < arraysize(benchLaneCounts); i++)
+   {
+      param.count = benchLaneCounts[i];
+      osSprintf(name, "%s-x%u", hashAlgo->name, param.count);
+
+      //Loop through the message sizes
+      for(j = 0; j < arraysize(benchLaneMsgSizes); j++)
+      {
+         param.length = benchLaneMsgSizes[j];
+
+         benchRun("hash", name, "digest", param.count * param.length,
+            benchHashDigestMulti, &param);
+      }
+   }
+}
+
+#endif
+
+
+/**
+ * @brief Run the hash function benchmarks
+ **/
+
+void benchHash(void)
+{
+   uint_t i;
+   uint_t j;
+   BenchSymParam param;
+
+   //Clear parameters
+   osMemset(&param, 0, sizeof(BenchSymParam));
+
+   //Loop through the hash algorithms
+   for(i = 0; benchHashAlgos[i] != NULL; i++)
+   {
+      param.hashAlgo = benchHashAlgos[i];
+
+      //Loop through the message sizes
+      for(j = 0; j < benchNumMsgSizes; j++)
+      {
+         param.length = benchMsgSizes[j];
+
+         benchRun("hash", param.hashAlgo->name, "digest", param.length,
+            benchHashDigest, &param);
+      }
+   }
+
+#if (SHA256_SUPPORT == ENABLED)
+   //Aggregate throughput of the multi-lane SHA-256 API
+   benchHashMulti(SHA256_HASH_ALGO);
+#endif
+#if (SHA512_SUPPORT == ENABLED)
+   //Aggregate throughput of the multi-lane SHA-512 API
+   benchHashMulti(SHA512_HASH_ALGO);
+#endif
+}
+
+
+#if (AES_SUPPORT == ENABLED)
+
+/**
+ * @brief Set up the AES variant without multi-block entry points
+ **/
+
+static void benchInitSingleBlockAes(void)
+{
+   //The reference AES processes one block per indirect call
+   osMemcpy(&benchAesSingleBlockAlgo, AES_CIPHER_ALGO, sizeof(CipherAlgo));
+   benchAesSingleBlockAlgo.encryptBlocks = NULL;
+   benchAesSingleBlockAlgo.decryptBlocks = NULL;
+}
+
+#endif
+#if (ECB_SUPPORT == ENABLED)
+
+/**
+ * @brief ECB encryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchEcbEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return ecbEncrypt(p->cipherAlgo, &benchCipherContext, benchInput,
+      benchOutput, p->length);
+}
+
+#endif
+#if (CBC_SUPPORT == ENABLED)
+
+/**
+ * @brief CBC encryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchCbcEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return cbcEncrypt(p->cipherAlgo, &benchCipherContext, benchIv, benchInput,
+      benchOutput, p->length);
+}
+
+
+/**
+ * @brief CBC decryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchCbcDecrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return cbcDecrypt(p->cipherAlgo, &benchCipherContext, benchIv, benchInput,
+      benchOutput, p->length);
+}
+
+#endif
+#if (CFB_SUPPORT == ENABLED)
+
+/**
+ * @brief CFB encryption (full-block segments)
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchCfbEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return cfbEncrypt(p->cipherAlgo, &benchCipherContext,
+      p->cipherAlgo->blockSize * 8, benchIv, benchInput, benchOutput,
+      p->length);
+}
+
+#endif
+#if (OFB_SUPPORT == ENABLED)
+
+/**
+ * @brief OFB encryption (full-block segments)
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchOfbEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return ofbEncrypt(p->cipherAlgo, &benchCipherContext,
+      p->cipherAlgo->blockSize * 8, benchIv, benchInput, benchOutput,
+      p->length);
+}
+
+#endif
+#if (CTR_SUPPORT == ENABLED)
+
+/**
+ * @brief CTR encryption (full-block counter)
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchCtrEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return ctrEncrypt(p->cipherAlgo, &benchCipherContext,
+      p->cipherAlgo->blockSize * 8, benchIv, benchInput, benchOutput,
+      p->length);
+}
+
+#endif
+#if (XTS_SUPPORT == ENABLED)
+
+/**
+ * @brief XTS encryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchXtsEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return xtsEncrypt(&benchXtsContext, benchIv, benchInput, benchOutput,
+      p->length);
+}
+
+#endif
+#if (RC4_SUPPORT == ENABLED)
+
+/**
+ * @brief Encrypt a message with a stream cipher
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchStreamEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   //Generate the key stream and XOR it with the message
+   p->cipherAlgo->encryptStream(&benchCipherContext, benchInput, benchOutput,
+      p->length);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+#if (CHACHA_SUPPORT == ENABLED)
+
+/**
+ * @brief ChaCha20 encryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchChachaEncrypt(void *param)
+{
+   error_t error;
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   //Each message is encrypted with a fresh key stream
+   error = chachaInit(&benchChachaContext, 20, benchKey, 32, benchIv, 12);
+
+   //Check status code
+   if(!error)
+   {
+      chachaCipher(&benchChachaContext, benchInput, benchOutput, p->length);
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
+
+
+/**
+ * @brief Run a cipher operation over all message sizes
+ * @param[in] name Algorithm name
+ * @param[in] op Operation
+ * @param[in] func Function performing a single operation
+ * @param[in] param Benchmark parameters
+ **/
+
+static void benchCipherSizes(const char_t *name, const char_t *op,
+   BenchFunc func, BenchSymParam *param)
+{
+   uint_t i;
+
+   //Loop through the message sizes
+   for(i = 0; i < benchNumMsgSizes; i++)
+   {
+      param->length = benchMsgSizes[i];
+      benchRun("cipher", name, op, param->length, func, param);
+   }
+}
+
+
+/**
+ * @brief Run the cipher benchmarks (one record per mode of operation)
+ *
+ * AES-128-1blk is AES-128 with the multi-block entry points removed, so that
+ * the modes fall back to one indirect call per block. Comparing its cycles
+ * per byte with AES-128 shows the gain of the multi-block interface
+ *
+ **/
+
+void benchCipher(void)
+{
+   error_t error;
+   uint_t i;
+   const BenchCipherInfo *info;
+   BenchSymParam param;
+
+   //Clear parameters
+   osMemset(&param, 0, sizeof(BenchSymParam));
+   osMemset(benchKey, 0x42, sizeof(benchKey));
+   osMemset(benchIv, 0x24, sizeof(benchIv));
+
+#if (AES_SUPPORT == ENABLED)
+   //Set up the single-block reference AES
+   benchInitSingleBlockAes();
+#endif
+
+   //Loop through the block ciphers
+   for(i = 0; benchCipherInfos[i].name != NULL; i++)
+   {
+      info = &benchCipherInfos[i];
+      param.cipherAlgo = info->cipherAlgo;
+      param.keyLen = info->keyLen;
+
+      //Load the key once; the key schedule is not part of the measurement
+      error = info->cipherAlgo->init(&benchCipherContext, benchKey,
+         info->keyLen);
+      //Any error to report?
+      if(error)
+         continue;
+
+#if (ECB_SUPPORT == ENABLED)
+      benchCipherSizes(info->name, "ecb", benchEcbEncrypt, &param);
+#endif
+#if (CBC_SUPPORT == ENABLED)
+      benchCipherSizes(info->name, "cbc-enc", benchCbcEncrypt, &param);
+      benchCipherSizes(info->name, "cbc-dec", benchCbcDecrypt, &param);
+#endif
+#if (CFB_SUPPORT == ENABLED)
+      benchCipherSizes(info->name, "cfb", benchCfbEncrypt, &param);
+#endif
+#if (OFB_SUPPORT == ENABLED)
+      benchCipherSizes(info->name, "ofb", benchOfbEncrypt, &param);
+#endif
+#if (CTR_SUPPORT == ENABLED)
+      benchCipherSizes(info->name, "ctr", benchCtrEncrypt, &param);
+#endif
+
+      //Release the cipher context
+      info->cipherAlgo->deinit(&benchCipherContext);
+
+#if (XTS_SUPPORT == ENABLED)
+      //XTS is only defined for 128-bit block ciphers
+      if(info->cipherAlgo->blockSize == 16)
+      {
+         //XTS uses a pair of keys
+         error = xtsInit(&benchXtsContext, info->cipherAlgo, benchKey,
+            info->keyLen * 2);
+
+         //Check status code
+         if(!error)
+         {
+            benchCipherSizes(info->name, "xts", benchXtsEncrypt, &param);
+         }
+      }
+#endif
+   }
+
+#if (RC4_SUPPORT == ENABLED)
+   //Load the RC4 key
+   param.cipherAlgo = RC4_CIPHER_ALGO;
+   error = RC4_CIPHER_ALGO->init(&benchCipherContext, benchKey, 16);
+
+   //Check status code
+   if(!error)
+   {
+      benchCipherSizes("RC4", "stream", benchStreamEncrypt, &param);
+   }
+#endif
+
+#if (CHACHA_SUPPORT == ENABLED)
+   //ChaCha20 is measured including the per-message setup
+   benchCipherSizes("ChaCha20", "stream", benchChachaEncrypt, &param);
+#endif
+}
+
+
+#if (GCM_SUPPORT == ENABLED)
+
+/**
+ * @brief GCM authenticated encryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchGcmEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return gcmEncrypt(&benchGcmContext, benchIv, 12, benchAad,
+      sizeof(benchAad), benchInput, benchOutput, p->length, benchTag, 16);
+}
+
+#endif
+#if (CCM_SUPPORT == ENABLED)
+
+/**
+ * @brief CCM authenticated encryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchCcmEncrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return ccmEncrypt(p->cipherAlgo, &benchCipherContext, benchIv, 12,
+      benchAad, sizeof(benchAad), benchInput, benchOutput, p->length,
+      benchTag, 16);
+}
+
+#endif
+#if (CHACHA20_POLY1305_SUPPORT == ENABLED)
+
+/**
+ * @brief ChaCha20Poly1305 authenticated encryption
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchChacha20Poly1305Encrypt(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   return chacha20Poly1305Encrypt(benchKey, 32, benchIv, 12, benchAad,
+      sizeof(benchAad), benchInput, benchOutput, p->length, benchTag, 16);
+}
+
+
+/**
+ * @brief ChaCha20Poly1305 authenticated encryption in two passes
+ *
+ * The whole message is encrypted first, then the whole ciphertext is
+ * authenticated. This is the reference for the single-pass implementation
+ *
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchChacha20Poly1305TwoPass(void *param)
+{
+   error_t error;
+   size_t n;
+   uint8_t temp[32];
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   //Initialize ChaCha20 context
+   error = chachaInit(&benchChachaContext, 20, benchKey, 32, benchIv, 12);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Generate the Poly1305 one-time key and discard the rest of the block
+   chachaCipher(&benchChachaContext, NULL, temp, 32);
+   chachaCipher(&benchChachaContext, NULL, NULL, 32);
+
+   //First pass: encrypt the whole plaintext
+   chachaCipher(&benchChachaContext, benchInput, benchOutput, p->length);
+
+   //Second pass: authenticate the AAD and the ciphertext
+   poly1305Init(&benchPoly1305Context, temp);
+   osMemset(temp, 0, sizeof(temp));
+
+   poly1305Update(&benchPoly1305Context, benchAad, sizeof(benchAad));
+   n = (16 - (sizeof(benchAad) % 16)) % 16;
+   poly1305Update(&benchPoly1305Context, temp, n);
+
+   poly1305Update(&benchPoly1305Context, benchOutput, p->length);
+   n = (16 - (p->length % 16)) % 16;
+   poly1305Update(&benchPoly1305Context, temp, n);
+
+   //Authenticate the length fields
+   STORE64LE(sizeof(benchAad), temp);
+   STORE64LE(p->length, temp + 8);
+   poly1305Update(&benchPoly1305Context, temp, 16);
+
+   //Compute message-authentication code
+   poly1305Final(&benchPoly1305Context, benchTag);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
+/**
+ * @brief Run an AEAD operation over all message sizes
+ * @param[in] name Algorithm name
+ * @param[in] func Function performing a single operation
+ * @param[in] param Benchmark parameters
+ **/
+
+static void benchAeadSizes(const char_t *name, BenchFunc func,
+   BenchSymParam *param)
+{
+   uint_t i;
+
+   //Loop through the message sizes
+   for(i = 0; i < benchNumMsgSizes; i++)
+   {
+      param->length = benchMsgSizes[i];
+      benchRun("aead", name, "encrypt", param->length, func, param);
+   }
+}
+
+
+/**
+ * @brief Run the AEAD benchmarks
+ *
+ * The messages are authenticated together with 13 bytes of additional data,
+ * which matches the TLS 1.2 record header
+ *
+ **/
+
+void benchAead(void)
+{
+#if (CHACHA20_POLY1305_SUPPORT == ENABLED)
+   uint_t i;
+#endif
+   BenchSymParam param;
+
+   //Clear parameters
+   osMemset(&param, 0, sizeof(BenchSymParam));
+   osMemset(benchKey, 0x42, sizeof(benchKey));
+   osMemset(benchIv, 0x24, sizeof(benchIv));
+   osMemset(benchAad, 0x17, sizeof(benchAad));
+
+#if (AES_SUPPORT == ENABLED)
+   param.cipherAlgo = AES_CIPHER_ALGO;
+
+#if (GCM_SUPPORT == ENABLED)
+   //AES-128-GCM
+   if(!aesInit(&benchCipherContext.aesContext, benchKey, 16) &&
+      !gcmInit(&benchGcmContext, AES_CIPHER_ALGO, &benchCipherContext))
+   {
+      benchAeadSizes("AES-128-GCM", benchGcmEncrypt, &param);
+   }
+
+   //AES-256-GCM
+   if(!aesInit(&benchCipherContext.aesContext, benchKey, 32) &&
+      !gcmInit(&benchGcmContext, AES_CIPHER_ALGO, &benchCipherContext))
+   {
+      benchAeadSizes("AES-256-GCM", benchGcmEncrypt, &param);
+   }
+
+   //AES-128-GCM, one block per cipher call
+   benchInitSingleBlockAes();
+
+   if(!aesInit(&benchCipherContext.aesContext, benchKey, 16) &&
+      !gcmInit(&benchGcmContext, &benchAesSingleBlockAlgo, &benchCipherContext))
+   {
+      benchAeadSizes("AES-128-GCM-1blk", benchGcmEncrypt, &param);
+   }
+#endif
+
+#if (CCM_SUPPORT == ENABLED)
+   //AES-128-CCM
+   if(!aesInit(&benchCipherContext.aesContext, benchKey, 16))
+   {
+      benchAeadSizes("AES-128-CCM", benchCcmEncrypt, &param);
+   }
+#endif
+#endif
+
+#if (CHACHA20_POLY1305_SUPPORT == ENABLED)
+   //ChaCha20Poly1305 derives the one-time Poly1305 key for each message
+   for(i = 0; i < arraysize(benchChachaPolyMsgSizes); i++)
+   {
+      param.length = benchChachaPolyMsgSizes[i];
+
+      benchRun("aead", "ChaCha20Poly1305", "encrypt", param.length,
+         benchChacha20Poly1305Encrypt, &param);
+   }
+
+   //Reference with separate encryption and authentication passes
+   for(i = 0; i < arraysize(benchChachaPolyMsgSizes); i++)
+   {
+      param.length = benchChachaPolyMsgSizes[i];
+
+      benchRun("aead", "ChaCha20Poly1305-2pass", "encrypt", param.length,
+         benchChacha20Poly1305TwoPass, &param);
+   }
+#endif
+}
+
+
+#if (HMAC_SUPPORT == ENABLED)
+
+/**
+ * @brief HMAC computation
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchHmacCompute(void *param)
+{
+   error_t error;
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   //Initialize HMAC calculation
+   error = hmacInit(&benchHmacContext, p->hashAlgo, benchKey, 32);
+
+   //Check status code
+   if(!error)
+   {
+      hmacUpdate(&benchHmacContext, benchInput, p->length);
+      hmacFinal(&benchHmacContext, benchOutput);
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
+#if (CMAC_SUPPORT == ENABLED)
+
+/**
+ * @brief CMAC computation
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchCmacCompute(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   //The subkeys are derived once by cmacInit
+   cmacReset(&benchCmacContext);
+   cmacUpdate(&benchCmacContext, benchInput, p->length);
+
+   return cmacFinal(&benchCmacContext, benchOutput, 16);
+}
+
+#endif
+#if (GMAC_SUPPORT == ENABLED)
+
+/**
+ * @brief GMAC computation
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchGmacCompute(void *param)
+{
+   error_t error;
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   //The hash subkey is derived once by gmacInit
+   error = gmacReset(&benchGmacContext, benchIv, 12);
+
+   //Check status code
+   if(!error)
+   {
+      gmacUpdate(&benchGmacContext, benchInput, p->length);
+      error = gmacFinal(&benchGmacContext, benchOutput, 16);
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
+#if (POLY1305_SUPPORT == ENABLED)
+
+/**
+ * @brief Poly1305 computation
+ * @param[in] param Benchmark parameters
+ * @return Error code
+ **/
+
+static error_t benchPoly1305Compute(void *param)
+{
+   const BenchSymParam *p = (const BenchSymParam *) param;
+
+   //Poly1305 keys are single-use
+   poly1305Init(&benchPoly1305Context, benchKey);
+   poly1305Update(&benchPoly1305Context, benchInput, p->length);
+   poly1305Final(&benchPoly1305Context, benchOutput);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
+/**
+ * @brief Run a MAC operation over all message sizes
+ * @param[in] name Algorithm name
+ * @param[in] func Function performing a single operation
+ * @param[in] param Benchmark parameters
+ **/
+
+static void benchMacSizes(const char_t *name, BenchFunc func,
+   BenchSymParam *param)
+{
+   uint_t i;
+
+   //Loop through the message sizes
+   for(i = 0; i < benchNumMsgSizes; i++)
+   {
+      param->length = benchMsgSizes[i];
+      benchRun("mac", name, "compute", param->length, func, param);
+   }
+}
+
+
+/**
+ * @brief Run the MAC benchmarks
+ **/
+
+void benchMac(void)
+{
+   BenchSymParam param;
+
+   //Clear parameters
+   osMemset(&param, 0, sizeof(BenchSymParam));
+   osMemset(benchKey, 0x42, sizeof(benchKey));
+   osMemset(benchIv, 0x24, sizeof(benchIv));
+
+#if (HMAC_SUPPORT == ENABLED)
+#if (SHA1_SUPPORT == ENABLED)
+   param.hashAlgo = SHA1_HASH_ALGO;
+   benchMacSizes("HMAC-SHA-1", benchHmacCompute, &param);
+#endif
+#if (SHA256_SUPPORT == ENABLED)
+   param.hashAlgo = SHA256_HASH_ALGO;
+   benchMacSizes("HMAC-SHA-256", benchHmacCompute, &param);
+#endif
+#if (SHA384_SUPPORT == ENABLED)
+   param.hashAlgo = SHA384_HASH_ALGO;
+   benchMacSizes("HMAC-SHA-384", benchHmacCompute, &param);
+#endif
+#endif
+
+#if (AES_SUPPORT == ENABLED)
+#if (CMAC_SUPPORT == ENABLED)
+   //AES-CMAC
+   if(!cmacInit(&benchCmacContext, AES_CIPHER_ALGO, benchKey, 16))
+   {
+      benchMacSizes("AES-128-CMAC", benchCmacCompute, &param);
+   }
+#endif
+
+#if (GMAC_SUPPORT == ENABLED)
+   //AES-GMAC
+   if(!gmacInit(&benchGmacContext, AES_CIPHER_ALGO, benchKey, 16))
+   {
+      benchMacSizes("AES-128-GMAC", benchGmacCompute, &param);
+   }
+#endif
+#endif
+
+#if (POLY1305_SUPPORT == ENABLED)
+   benchMacSizes("Poly1305", benchPoly1305Compute, &param);
+#endif
+}
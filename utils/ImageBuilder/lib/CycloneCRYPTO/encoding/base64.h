@@ -44,6 +44,9 @@ void base64Encode(const void *input, size_t inputLen, char_t *output,
 error_t base64Decode(const char_t *input, size_t inputLen, void *output,
    size_t *outputLen);
 
+size_t base64DecodeBlocks(const char_t *input, size_t inputLen,
+   uint8_t *output);
+
 //C++ guard
 #ifdef __cplusplus
 }
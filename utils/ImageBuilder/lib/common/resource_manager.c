@@ -124,7 +124,7 @@ error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
    if(!found)
       return ERROR_NOT_FOUND;
    //Enforce the entry type
-   if(resEntry->type != RES_TYPE_FILE)
+   if(resEntry->type != RES_TYPE_FILE && resEntry->type != RES_TYPE_FILE_EX)
       return ERROR_NOT_FOUND;
 
    //Return the location of the specified resource
@@ -42,8 +42,9 @@ extern "C" {
 
 typedef enum
 {
-   RES_TYPE_DIR  = 1,
-   RES_TYPE_FILE = 2
+   RES_TYPE_DIR     = 1,
+   RES_TYPE_FILE    = 2,
+   RES_TYPE_FILE_EX = 3 ///<File preceded by a ResFileInfo record
 } ResType;
 
 
@@ -0,0 +1,120 @@
+/**
+ * @file net_config.h
+ * @brief CycloneTCP configuration file
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _NET_CONFIG_H
+#define _NET_CONFIG_H
+
+//Trace level for TCP/IP stack debugging
+#define MEM_TRACE_LEVEL          2
+#define NIC_TRACE_LEVEL          2
+#define ETH_TRACE_LEVEL          2
+#define ARP_TRACE_LEVEL          2
+#define IP_TRACE_LEVEL           2
+#define IPV4_TRACE_LEVEL         2
+#define ICMP_TRACE_LEVEL         2
+#define UDP_TRACE_LEVEL          2
+#define TCP_TRACE_LEVEL          2
+#define SOCKET_TRACE_LEVEL       2
+#define RAW_SOCKET_TRACE_LEVEL   2
+
+//Number of network adapters
+#define NET_INTERFACE_COUNT 1
+
+//IPv4 support
+#define IPV4_SUPPORT ENABLED
+//IPv4 fragmentation support
+#define IPV4_FRAG_SUPPORT DISABLED
+//IGMP support
+#define IGMP_HOST_SUPPORT DISABLED
+
+//IPv6 support
+#define IPV6_SUPPORT DISABLED
+
+//Loopback interface support
+#define NET_LOOPBACK_IF_SUPPORT ENABLED
+
+//TCP support
+#define TCP_SUPPORT ENABLED
+//Window scaling and timestamps (RFC 7323)
+#define TCP_WINDOW_SCALE_SUPPORT ENABLED
+#define TCP_TIMESTAMPS_SUPPORT ENABLED
+//Maximum buffer sizes for transmission and reception
+#define TCP_MAX_TX_BUFFER_SIZE 262144
+#define TCP_MAX_RX_BUFFER_SIZE 262144
+//Selective acknowledgment support
+#define TCP_SACK_SUPPORT ENABLED
+//Out-of-order blocks tracked by the receiver. A block that falls off the
+//list must be sent again, even though its data is already buffered
+#define TCP_MAX_SACK_BLOCKS 32
+//CUBIC and BBR congestion control support
+#define TCP_CUBIC_SUPPORT ENABLED
+#define TCP_BBR_SUPPORT ENABLED
+
+//UDP support
+#define UDP_SUPPORT ENABLED
+//Receive queue depth for connectionless sockets
+#define UDP_RX_QUEUE_SIZE 4
+
+//Raw socket support
+#define RAW_SOCKET_SUPPORT ENABLED
+//Receive queue depth for raw sockets
+#define RAW_SOCKET_RX_QUEUE_SIZE 4
+
+//Use fixed-size blocks allocation
+#define NET_MEM_POOL_SUPPORT ENABLED
+//Number of large, medium and small buffers (the TCP demultiplexing test
+//cases keep 1024 connections open, each holding two large buffers)
+#define NET_MEM_POOL_BUFFER_COUNT 2560
+#define NET_MEM_POOL_MEDIUM_BUFFER_COUNT 256
+#define NET_MEM_POOL_SMALL_BUFFER_COUNT 256
+
+//Number of sockets that can be opened simultaneously
+#define SOCKET_MAX_COUNT 1024
+
+//The benchmarks do not need any of the name resolution services
+#define DNS_CLIENT_SUPPORT DISABLED
+#define MDNS_CLIENT_SUPPORT DISABLED
+#define MDNS_RESPONDER_SUPPORT DISABLED
+#define NBNS_CLIENT_SUPPORT DISABLED
+#define NBNS_RESPONDER_SUPPORT DISABLED
+#define LLMNR_CLIENT_SUPPORT DISABLED
+#define LLMNR_RESPONDER_SUPPORT DISABLED
+#define DNS_SD_SUPPORT DISABLED
+#define DHCP_CLIENT_SUPPORT DISABLED
+
+//BSD socket API support
+#define BSD_SOCKET_SUPPORT DISABLED
+
+//SNMP MIB support
+#define MIB2_SUPPORT DISABLED
+
+//HTTP server support (only checked by the known-answer tests)
+#define HTTP_SERVER_SUPPORT ENABLED
+//HTTP conditional request support (ETag and Last-Modified)
+#define HTTP_SERVER_CONDITIONAL_REQ_SUPPORT ENABLED
+
+#endif
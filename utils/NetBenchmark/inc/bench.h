@@ -0,0 +1,117 @@
+/**
+ * @file bench.h
+ * @brief CycloneTCP benchmark framework
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _BENCH_H
+#define _BENCH_H
+
+//Dependencies
+#include "core/net.h"
+
+//Default minimum duration of each measurement, in milliseconds
+#ifndef BENCH_DEFAULT_MIN_TIME
+   #define BENCH_DEFAULT_MIN_TIME 200
+#elif (BENCH_DEFAULT_MIN_TIME < 1)
+   #error BENCH_DEFAULT_MIN_TIME parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Output format
+ **/
+
+typedef enum
+{
+   BENCH_FORMAT_TEXT = 0,
+   BENCH_FORMAT_JSON = 1
+} BenchFormat;
+
+
+/**
+ * @brief Benchmark settings
+ **/
+
+typedef struct
+{
+   BenchFormat format;    ///<Output format
+   uint32_t minTime;      ///<Minimum duration of each measurement, in milliseconds
+   const char_t *filter;  ///<Only run the benchmarks whose name contains this string
+} BenchSettings;
+
+
+/**
+ * @brief Result of a measurement
+ **/
+
+typedef struct
+{
+   const char_t *suite;   ///<Benchmark suite (demux, mem, tcp)
+   const char_t *test;    ///<Test case
+   uint_t param;          ///<Parameter of the test case (number of sockets, tasks...)
+   double value;          ///<Measured value
+   const char_t *unit;    ///<Unit of the measured value
+} BenchResult;
+
+
+//Global variables
+extern BenchSettings benchSettings;
+
+//Benchmark framework
+error_t benchInit(void);
+void benchBegin(void);
+void benchEnd(void);
+
+bool_t benchSelected(const char_t *suite, const char_t *test);
+
+void benchFailed(const char_t *suite, const char_t *test, uint_t param,
+   error_t error);
+
+void benchReport(const char_t *suite, const char_t *test, uint_t param,
+   double value, const char_t *unit);
+
+error_t benchSetupLink(void);
+
+uint64_t benchGetTime(void);
+
+//Known-answer tests
+error_t benchKat(void);
+
+//Benchmark suites
+void benchDemux(void);
+void benchMem(void);
+void benchTcp(void);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * @file link_driver.h
+ * @brief Emulated link driver
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+#ifndef _LINK_DRIVER_H
+#define _LINK_DRIVER_H
+
+//Dependencies
+#include "core/nic.h"
+
+//Number of packets that can be in flight in each direction
+#ifndef LINK_DRIVER_QUEUE_SIZE
+   #define LINK_DRIVER_QUEUE_SIZE 2048
+#elif (LINK_DRIVER_QUEUE_SIZE < 1)
+   #error LINK_DRIVER_QUEUE_SIZE parameter is not valid
+#endif
+
+//Packets up to this size travel on the return path (pure ACKs)
+#ifndef LINK_DRIVER_RETURN_PATH_SIZE
+   #define LINK_DRIVER_RETURN_PATH_SIZE 128
+#elif (LINK_DRIVER_RETURN_PATH_SIZE < 40)
+   #error LINK_DRIVER_RETURN_PATH_SIZE parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Link parameters
+ **/
+
+typedef struct
+{
+   uint32_t rate;       ///<Bottleneck rate, in bytes per second
+   uint32_t delay;      ///<One-way propagation delay, in milliseconds
+   uint_t queueSize;    ///<Size of the bottleneck queue, in packets
+   uint_t lossRate;     ///<Random loss rate of the data packets, per thousand
+} LinkDriverParams;
+
+
+/**
+ * @brief Link statistics
+ **/
+
+typedef struct
+{
+   uint32_t packets;    ///<Number of packets forwarded through the bottleneck
+   uint32_t drops;      ///<Number of packets dropped by the bottleneck queue
+   uint32_t losses;     ///<Number of packets lost at random
+} LinkDriverStats;
+
+
+/**
+ * @brief Packet in flight
+ **/
+
+typedef struct
+{
+   uint64_t dueTime;
+   size_t length;
+   uint8_t data[ETH_MTU];
+} LinkDriverQueueEntry;
+
+
+/**
+ * @brief Packets in flight in one direction
+ **/
+
+typedef struct
+{
+   uint_t length;
+   uint_t writeIndex;
+   uint_t readIndex;
+   LinkDriverQueueEntry entries[LINK_DRIVER_QUEUE_SIZE];
+} LinkDriverQueue;
+
+
+//Emulated link driver
+extern const NicDriver linkDriver;
+
+//Emulated link related functions
+void linkDriverConfigure(const LinkDriverParams *params);
+void linkDriverGetStats(LinkDriverStats *stats);
+
+error_t linkDriverInit(NetInterface *interface);
+
+void linkDriverTick(NetInterface *interface);
+
+void linkDriverEnableIrq(NetInterface *interface);
+void linkDriverDisableIrq(NetInterface *interface);
+void linkDriverEventHandler(NetInterface *interface);
+
+error_t linkDriverSendPacket(NetInterface *interface,
+   const NetBuffer *buffer, size_t offset, NetTxAncillary *ancillary);
+
+bool_t linkDriverDrawLoss(void);
+
+error_t linkDriverUpdateMacAddrFilter(NetInterface *interface);
+
+void linkDriverTask(void *param);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
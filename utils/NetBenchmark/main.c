@@ -0,0 +1,132 @@
+/**
+ * @file main.c
+ * @brief CycloneTCP benchmark suite
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include <stdlib.h>
+#include "core/net.h"
+#include "bench.h"
+
+
+/**
+ * @brief Print usage information
+ * @param[in] name Name of the executable
+ **/
+
+static void printUsage(const char_t *name)
+{
+   printf("Usage: %s [-k] [-j] [-t ms] [-f filter]\r\n", name);
+   printf("  -k         Only run the known-answer tests\r\n");
+   printf("  -j         Emit JSON records instead of a text table\r\n");
+   printf("  -t ms      Minimum duration of each measurement (default %u ms)\r\n",
+      BENCH_DEFAULT_MIN_TIME);
+   printf("  -f filter  Only run the benchmarks whose \"suite/test\" name\r\n");
+   printf("             contains the specified string\r\n");
+}
+
+
+/**
+ * @brief Main entry point
+ * @param[in] argc Number of command-line arguments
+ * @param[in] argv Command-line arguments
+ * @return Exit status
+ **/
+
+int main(int argc, char *argv[])
+{
+   error_t error;
+   bool_t katOnly;
+   int i;
+
+   //Run the benchmark suites by default
+   katOnly = FALSE;
+
+   //Parse command-line arguments
+   for(i = 1; i < argc; i++)
+   {
+      if(!osStrcmp(argv[i], "-k"))
+      {
+         katOnly = TRUE;
+      }
+      else if(!osStrcmp(argv[i], "-j"))
+      {
+         benchSettings.format = BENCH_FORMAT_JSON;
+      }
+      else if(!osStrcmp(argv[i], "-t") && (i + 1) < argc)
+      {
+         benchSettings.minTime = (uint32_t) atoi(argv[++i]);
+
+         //The duration must be at least 1 ms
+         if(benchSettings.minTime == 0)
+            benchSettings.minTime = 1;
+      }
+      else if(!osStrcmp(argv[i], "-f") && (i + 1) < argc)
+      {
+         benchSettings.filter = argv[++i];
+      }
+      else
+      {
+         printUsage(argv[0]);
+         return EXIT_FAILURE;
+      }
+   }
+
+   //Initialize the benchmark framework
+   error = benchInit();
+   //Any error to report?
+   if(error)
+   {
+      fprintf(stderr, "Failed to initialize the benchmark (error %d)\r\n", error);
+      return EXIT_FAILURE;
+   }
+
+   //The code paths that are not measured must behave as expected
+   error = benchKat();
+   //Any error to report?
+   if(error)
+   {
+      fprintf(stderr, "Known-answer tests failed\r\n");
+      return EXIT_FAILURE;
+   }
+
+   //Known-answer tests only?
+   if(katOnly)
+   {
+      fprintf(stderr, "Known-answer tests passed\r\n");
+      return EXIT_SUCCESS;
+   }
+
+   //Run the benchmark suites
+   benchBegin();
+   benchDemux();
+   benchMem();
+   benchTcp();
+   benchEnd();
+
+   //Successful processing
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,249 @@
+/**
+ * @file bench.c
+ * @brief CycloneTCP benchmark framework
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include "core/net.h"
+#include "ipv4/ipv4.h"
+#include "link_driver.h"
+#include "bench.h"
+
+#if defined(USE_POSIX)
+   #include <time.h>
+#endif
+
+//Benchmark settings
+BenchSettings benchSettings =
+{
+   BENCH_FORMAT_TEXT,
+   BENCH_DEFAULT_MIN_TIME,
+   NULL
+};
+
+//Number of results reported so far
+static uint_t benchNumResults;
+
+//The emulated link has been set up
+static bool_t benchLinkReady;
+
+
+/**
+ * @brief Initialize the benchmark framework
+ * @return Error code
+ **/
+
+error_t benchInit(void)
+{
+   //Initialize the TCP/IP stack
+   return netInit();
+}
+
+
+/**
+ * @brief Start the report
+ **/
+
+void benchBegin(void)
+{
+   //Reset the number of results
+   benchNumResults = 0;
+
+   //Check output format
+   if(benchSettings.format == BENCH_FORMAT_JSON)
+   {
+      printf("{\n  \"library\": \"CycloneTCP\",\n");
+      printf("  \"version\": \"%s\",\n", CYCLONE_TCP_VERSION_STRING);
+      printf("  \"min_time_ms\": %u,\n", (uint_t) benchSettings.minTime);
+      printf("  \"results\": [");
+   }
+   else
+   {
+      printf("%-7s %-24s %8s %16s %s\r\n", "Suite", "Test", "Param",
+         "Value", "Unit");
+   }
+}
+
+
+/**
+ * @brief Terminate the report
+ **/
+
+void benchEnd(void)
+{
+   //Check output format
+   if(benchSettings.format == BENCH_FORMAT_JSON)
+   {
+      printf("\n  ]\n}\n");
+   }
+}
+
+
+/**
+ * @brief Check whether a test case matches the user-defined filter
+ * @param[in] suite Benchmark suite
+ * @param[in] test Test case
+ * @return TRUE if the test case is to be run, else FALSE
+ **/
+
+bool_t benchSelected(const char_t *suite, const char_t *test)
+{
+   char_t name[64];
+
+   //No filter?
+   if(benchSettings.filter == NULL)
+      return TRUE;
+
+   //The filter is matched against "suite/test"
+   snprintf(name, sizeof(name), "%s/%s", suite, test);
+
+   //Check whether the name contains the filter
+   return (osStrstr(name, benchSettings.filter) != NULL) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief Report a failed test case
+ * @param[in] suite Benchmark suite
+ * @param[in] test Test case
+ * @param[in] param Parameter of the test case
+ * @param[in] error Error code
+ **/
+
+void benchFailed(const char_t *suite, const char_t *test, uint_t param,
+   error_t error)
+{
+   fprintf(stderr, "%s/%s (%u) failed (error %d)\r\n", suite, test, param,
+      error);
+}
+
+
+/**
+ * @brief Print the result of a measurement
+ * @param[in] suite Benchmark suite
+ * @param[in] test Test case
+ * @param[in] param Parameter of the test case
+ * @param[in] value Measured value
+ * @param[in] unit Unit of the measured value
+ **/
+
+void benchReport(const char_t *suite, const char_t *test, uint_t param,
+   double value, const char_t *unit)
+{
+   //Check output format
+   if(benchSettings.format == BENCH_FORMAT_JSON)
+   {
+      //Separate the records
+      printf("%s\n    {\"suite\": \"%s\", \"test\": \"%s\", \"param\": %u, ",
+         (benchNumResults > 0) ? "," : "", suite, test, param);
+
+      printf("\"value\": %.1f, \"unit\": \"%s\"}", value, unit);
+   }
+   else
+   {
+      printf("%-7s %-24s %8u %16.1f %s\r\n", suite, test, param, value, unit);
+   }
+
+   //Flush the output so that partial results are not lost
+   fflush(stdout);
+
+   //Increment the number of results
+   benchNumResults++;
+}
+
+
+/**
+ * @brief Attach the emulated link to the first network interface
+ * @return Error code
+ **/
+
+error_t benchSetupLink(void)
+{
+   error_t error;
+   NetInterface *interface;
+
+   //The link is set up only once
+   if(benchLinkReady)
+      return NO_ERROR;
+
+   //Point to the first network interface
+   interface = &netInterface[0];
+
+   //Select the emulated link driver
+   error = netSetDriver(interface, &linkDriver);
+
+   //Check status code
+   if(!error)
+   {
+      //Initialize the network interface
+      error = netConfigInterface(interface);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //The packets addressed to 127.0.0.0/8 are routed to the interface
+      error = ipv4SetHostAddr(interface, IPV4_ADDR(127, 0, 0, 1));
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Set subnet mask
+      error = ipv4SetSubnetMask(interface, IPV4_ADDR(255, 0, 0, 0));
+   }
+
+   //Check status code
+   if(!error)
+   {
+      benchLinkReady = TRUE;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Get current time
+ * @return Time in nanoseconds
+ **/
+
+uint64_t benchGetTime(void)
+{
+#if defined(USE_POSIX)
+   struct timespec ts;
+
+   //Use the monotonic clock
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   //Convert the time to nanoseconds
+   return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+#else
+   //Fall back to the system tick counter
+   return (uint64_t) osGetSystemTime64() * 1000000;
+#endif
+}
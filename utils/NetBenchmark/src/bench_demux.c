@@ -0,0 +1,681 @@
+/**
+ * @file bench_demux.c
+ * @brief Packet demultiplexing benchmarks
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * Each test case opens a given number of sockets, then hands packets
+ * addressed to the socket that was opened last directly to the receive
+ * path of the relevant protocol, and reports the number of packets
+ * processed per second. The receive queue of the target socket fills up
+ * after a few packets, so that the figures mostly reflect the cost of
+ * finding the destination socket. The TCP test cases deliver duplicate
+ * SYN segments to a listening socket and pure ACKs to an established
+ * connection, neither of which elicits a response
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/net.h"
+#include "core/udp.h"
+#include "core/tcp_fsm.h"
+#include "core/raw_socket.h"
+#include "bench.h"
+
+//Number of packets processed while holding the stack mutex
+#define BENCH_DEMUX_BATCH_SIZE 256
+//First UDP port number
+#define BENCH_DEMUX_BASE_PORT 1000
+//First EtherType value
+#define BENCH_DEMUX_BASE_ETH_TYPE 0x9000
+//Length of the payload
+#define BENCH_DEMUX_PAYLOAD_SIZE 32
+//Address of the local host, as configured on the emulated link
+#define BENCH_DEMUX_HOST_ADDR IPV4_ADDR(127, 0, 0, 1)
+//Address of the remote TCP peer
+#define BENCH_DEMUX_PEER_ADDR IPV4_ADDR(127, 0, 0, 2)
+//Port number of the remote TCP peer
+#define BENCH_DEMUX_PEER_PORT 5000
+//Initial sequence number of the remote TCP peer
+#define BENCH_DEMUX_PEER_ISS 1000
+//Size of the TX and RX buffers of the connections (a single chunk each)
+#define BENCH_DEMUX_TCP_BUFFER_SIZE 1024
+
+
+/**
+ * @brief Packet delivery routine
+ **/
+
+typedef void (*BenchDemuxFunc)(const void *packet);
+
+
+/**
+ * @brief IP packet (UDP datagram, TCP segment or raw IP packet)
+ **/
+
+typedef struct
+{
+   IpPseudoHeader pseudoHeader;
+   NetBuffer1 buffer;
+   uint8_t data[sizeof(UdpHeader) + BENCH_DEMUX_PAYLOAD_SIZE];
+} BenchDemuxIpPacket;
+
+
+/**
+ * @brief Ethernet frame
+ **/
+
+typedef struct
+{
+   NetRxAncillary ancillary;
+   uint8_t data[BENCH_DEMUX_PAYLOAD_SIZE];
+} BenchDemuxEthPacket;
+
+
+//Number of sockets opened by the test cases
+static const uint_t benchDemuxSocketCounts[] = {16, 64, 256, 1024};
+
+//Sockets opened by the current test case
+static Socket *benchDemuxSockets[SOCKET_MAX_COUNT];
+
+//TCP segment handed to the stack, which converts its header in place
+static uint8_t benchDemuxTcpSegment[sizeof(TcpHeader)];
+
+
+/**
+ * @brief Close the sockets opened by a test case
+ * @param[in] count Number of sockets
+ **/
+
+static void benchDemuxCloseSockets(uint_t count)
+{
+   uint_t i;
+
+   //Loop through the sockets
+   for(i = 0; i < count; i++)
+   {
+      //Close the current socket
+      socketClose(benchDemuxSockets[i]);
+   }
+}
+
+
+/**
+ * @brief Measure the packet rate of a delivery routine
+ * @param[in] func Delivery routine
+ * @param[in] packet Packet to be delivered
+ * @return Number of packets per second
+ **/
+
+static double benchDemuxMeasure(BenchDemuxFunc func, const void *packet)
+{
+   uint32_t i;
+   uint32_t n;
+   uint64_t time;
+
+   //Start of the measurement
+   time = benchGetTime();
+
+   //Repeat until the minimum measurement time is reached
+   for(n = 0; ; n += BENCH_DEMUX_BATCH_SIZE)
+   {
+      //The receive path always runs with the stack mutex held
+      osAcquireMutex(&netMutex);
+
+      //Deliver a batch of packets
+      for(i = 0; i < BENCH_DEMUX_BATCH_SIZE; i++)
+      {
+         func(packet);
+      }
+
+      //Release exclusive access
+      osReleaseMutex(&netMutex);
+
+      //Long enough?
+      if((benchGetTime() - time) >= (uint64_t) benchSettings.minTime * 1000000)
+         break;
+   }
+
+   //End of the measurement
+   time = benchGetTime() - time;
+
+   //Return the number of packets per second
+   return (double) (n + BENCH_DEMUX_BATCH_SIZE) * 1e9 / (double) time;
+}
+
+
+/**
+ * @brief Deliver a UDP datagram
+ * @param[in] packet Pointer to the datagram
+ **/
+
+static void benchDemuxUdpFunc(const void *packet)
+{
+   const BenchDemuxIpPacket *p;
+
+   //Point to the datagram
+   p = (const BenchDemuxIpPacket *) packet;
+
+   //Process incoming datagram
+   udpProcessDatagram(&netInterface[0], &p->pseudoHeader,
+      (const NetBuffer *) &p->buffer, 0, &NET_DEFAULT_RX_ANCILLARY);
+}
+
+
+/**
+ * @brief UDP demultiplexing
+ * @param[in] count Number of sockets
+ **/
+
+static void benchDemuxUdp(uint_t count)
+{
+   uint_t i;
+   error_t error;
+   UdpHeader *header;
+   BenchDemuxIpPacket packet;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Open the sockets, each bound to its own port
+   for(i = 0; i < count && !error; i++)
+   {
+      //Open a UDP socket
+      benchDemuxSockets[i] = socketOpen(SOCKET_TYPE_DGRAM,
+         SOCKET_IP_PROTO_UDP);
+
+      //Failed to open socket?
+      if(benchDemuxSockets[i] == NULL)
+         break;
+
+      //Bind the socket to a local port
+      error = socketBind(benchDemuxSockets[i], &IP_ADDR_ANY,
+         BENCH_DEMUX_BASE_PORT + i);
+   }
+
+   //Any error to report?
+   if(i < count || error)
+   {
+      benchDemuxCloseSockets(MIN(i, count));
+      benchFailed("demux", "udp", count, ERROR_OUT_OF_RESOURCES);
+      return;
+   }
+
+   //Format the datagram, addressed to the socket opened last
+   osMemset(&packet, 0, sizeof(BenchDemuxIpPacket));
+   packet.pseudoHeader.length = sizeof(Ipv4PseudoHeader);
+   packet.pseudoHeader.ipv4Data.srcAddr = IPV4_ADDR(10, 0, 0, 2);
+   packet.pseudoHeader.ipv4Data.destAddr = IPV4_ADDR(10, 0, 0, 1);
+   packet.pseudoHeader.ipv4Data.protocol = IPV4_PROTOCOL_UDP;
+
+   header = (UdpHeader *) packet.data;
+   header->srcPort = HTONS(5000);
+   header->destPort = htons(BENCH_DEMUX_BASE_PORT + count - 1);
+   header->length = HTONS(sizeof(packet.data));
+   header->checksum = 0;
+
+   packet.buffer.chunkCount = 1;
+   packet.buffer.maxChunkCount = 1;
+   packet.buffer.chunk[0].address = packet.data;
+   packet.buffer.chunk[0].length = sizeof(packet.data);
+
+   //Measure the packet rate
+   benchReport("demux", "udp", count,
+      benchDemuxMeasure(benchDemuxUdpFunc, &packet), "pkt/s");
+
+   //Close the sockets
+   benchDemuxCloseSockets(count);
+}
+
+
+#if (TCP_SUPPORT == ENABLED)
+
+/**
+ * @brief Format a TCP segment sent by the remote peer
+ * @param[out] packet Pointer to the packet
+ * @param[in] srcPort Source port
+ * @param[in] destPort Destination port
+ * @param[in] seqNum Sequence number
+ * @param[in] ackNum Acknowledgment number
+ * @param[in] flags TCP flags
+ **/
+
+static void benchDemuxFormatTcp(BenchDemuxIpPacket *packet, uint16_t srcPort,
+   uint16_t destPort, uint32_t seqNum, uint32_t ackNum, uint8_t flags)
+{
+   TcpHeader *header;
+
+   //Format the pseudo header
+   osMemset(packet, 0, sizeof(BenchDemuxIpPacket));
+   packet->pseudoHeader.length = sizeof(Ipv4PseudoHeader);
+   packet->pseudoHeader.ipv4Data.srcAddr = BENCH_DEMUX_PEER_ADDR;
+   packet->pseudoHeader.ipv4Data.destAddr = BENCH_DEMUX_HOST_ADDR;
+   packet->pseudoHeader.ipv4Data.protocol = IPV4_PROTOCOL_TCP;
+   packet->pseudoHeader.ipv4Data.length = HTONS(sizeof(TcpHeader));
+
+   //Format the TCP header, without any option
+   header = (TcpHeader *) packet->data;
+   header->srcPort = htons(srcPort);
+   header->destPort = htons(destPort);
+   header->seqNum = htonl(seqNum);
+   header->ackNum = htonl(ackNum);
+   header->dataOffset = 5;
+   header->flags = flags;
+   header->window = HTONS(65535);
+
+   //The stack verifies the checksum of every incoming segment
+   header->checksum = ipCalcUpperLayerChecksum(packet->pseudoHeader.data,
+      packet->pseudoHeader.length, header, sizeof(TcpHeader));
+
+   //The segment is copied to a working buffer before each delivery
+   packet->buffer.chunkCount = 1;
+   packet->buffer.maxChunkCount = 1;
+   packet->buffer.chunk[0].address = benchDemuxTcpSegment;
+   packet->buffer.chunk[0].length = sizeof(TcpHeader);
+}
+
+
+/**
+ * @brief Deliver a TCP segment
+ * @param[in] packet Pointer to the segment
+ **/
+
+static void benchDemuxTcpFunc(const void *packet)
+{
+   const BenchDemuxIpPacket *p;
+
+   //Point to the segment
+   p = (const BenchDemuxIpPacket *) packet;
+
+   //Restore the header in network byte order
+   osMemcpy(benchDemuxTcpSegment, p->data, sizeof(TcpHeader));
+
+   //Process incoming segment
+   tcpProcessSegment(&netInterface[0], &p->pseudoHeader,
+      (const NetBuffer *) &p->buffer, 0, &NET_DEFAULT_RX_ANCILLARY);
+}
+
+
+/**
+ * @brief TCP listener demultiplexing
+ * @param[in] count Number of sockets
+ **/
+
+static void benchDemuxTcpListen(uint_t count)
+{
+   uint_t i;
+   error_t error;
+   BenchDemuxIpPacket packet;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Open the sockets, each listening on its own port
+   for(i = 0; i < count && !error; i++)
+   {
+      //Open a TCP socket
+      benchDemuxSockets[i] = socketOpen(SOCKET_TYPE_STREAM,
+         SOCKET_IP_PROTO_TCP);
+
+      //Failed to open socket?
+      if(benchDemuxSockets[i] == NULL)
+         break;
+
+      //Bind the socket to a local port
+      error = socketBind(benchDemuxSockets[i], &IP_ADDR_ANY,
+         BENCH_DEMUX_BASE_PORT + i);
+
+      //Check status code
+      if(!error)
+      {
+         //Place the socket in the listening state
+         error = socketListen(benchDemuxSockets[i], 0);
+      }
+   }
+
+   //Any error to report?
+   if(i < count || error)
+   {
+      benchDemuxCloseSockets(MIN(i, count));
+      benchFailed("demux", "tcp-listen", count, ERROR_OUT_OF_RESOURCES);
+      return;
+   }
+
+   //Format a SYN segment, addressed to the socket opened last. The first
+   //delivery queues the connection request and the subsequent ones are
+   //discarded as duplicates
+   benchDemuxFormatTcp(&packet, BENCH_DEMUX_PEER_PORT,
+      BENCH_DEMUX_BASE_PORT + count - 1, BENCH_DEMUX_PEER_ISS, 0,
+      TCP_FLAG_SYN);
+
+   //Measure the packet rate
+   benchReport("demux", "tcp-listen", count,
+      benchDemuxMeasure(benchDemuxTcpFunc, &packet), "pkt/s");
+
+   //Close the sockets
+   benchDemuxCloseSockets(count);
+}
+
+
+/**
+ * @brief TCP established connection demultiplexing
+ * @param[in] count Number of sockets
+ **/
+
+static void benchDemuxTcpEstablished(uint_t count)
+{
+   uint_t i;
+   error_t error;
+   Socket *socket;
+   IpAddr peerAddr;
+   BenchDemuxIpPacket packet;
+
+   //The SYN segments are sent over the emulated link
+   error = benchSetupLink();
+
+   //Any error to report?
+   if(error)
+   {
+      benchFailed("demux", "tcp-est", count, error);
+      return;
+   }
+
+   //The SYN segments are addressed to a peer that does not exist
+   peerAddr.length = sizeof(Ipv4Addr);
+   peerAddr.ipv4Addr = BENCH_DEMUX_PEER_ADDR;
+
+   //Open the connections, each to its own remote port
+   for(i = 0; i < count && !error; i++)
+   {
+      //Open a TCP socket
+      socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+      benchDemuxSockets[i] = socket;
+
+      //Failed to open socket?
+      if(socket == NULL)
+         break;
+
+      //Do not wait for the SYN-ACK
+      socketSetTimeout(socket, 0);
+
+      //Limit the memory held by the connection
+      socketSetTxBufferSize(socket, BENCH_DEMUX_TCP_BUFFER_SIZE);
+      socketSetRxBufferSize(socket, BENCH_DEMUX_TCP_BUFFER_SIZE);
+
+      //Send a SYN segment
+      error = socketConnect(socket, &peerAddr, BENCH_DEMUX_PEER_PORT + i);
+
+      //The connection is still pending
+      if(error == ERROR_TIMEOUT)
+      {
+         //Answer on behalf of the peer
+         benchDemuxFormatTcp(&packet, BENCH_DEMUX_PEER_PORT + i,
+            socket->localPort, BENCH_DEMUX_PEER_ISS, socket->iss + 1,
+            TCP_FLAG_SYN | TCP_FLAG_ACK);
+
+         //Process the SYN-ACK segment
+         osAcquireMutex(&netMutex);
+         benchDemuxTcpFunc(&packet);
+         osReleaseMutex(&netMutex);
+
+         //Check whether the connection is established
+         if(socket->state == TCP_STATE_ESTABLISHED)
+         {
+            error = NO_ERROR;
+         }
+         else
+         {
+            error = ERROR_CONNECTION_FAILED;
+         }
+      }
+      else if(!error)
+      {
+         //The connection cannot complete before the SYN-ACK is received
+         error = ERROR_UNEXPECTED_STATE;
+      }
+   }
+
+   //Any error to report?
+   if(i < count || error)
+   {
+      benchDemuxCloseSockets(MIN(i, count));
+      benchFailed("demux", "tcp-est", count,
+         error ? error : ERROR_OUT_OF_RESOURCES);
+      return;
+   }
+
+   //Point to the socket opened last
+   socket = benchDemuxSockets[count - 1];
+
+   //Format a pure ACK that acknowledges nothing new and advertises the
+   //same window
+   benchDemuxFormatTcp(&packet, BENCH_DEMUX_PEER_PORT + count - 1,
+      socket->localPort, BENCH_DEMUX_PEER_ISS + 1, socket->iss + 1,
+      TCP_FLAG_ACK);
+
+   //Measure the packet rate
+   benchReport("demux", "tcp-est", count,
+      benchDemuxMeasure(benchDemuxTcpFunc, &packet), "pkt/s");
+
+   //Reset the connections
+   benchDemuxCloseSockets(count);
+}
+
+#endif
+#if (RAW_SOCKET_SUPPORT == ENABLED)
+
+/**
+ * @brief Deliver a raw IP packet
+ * @param[in] packet Pointer to the packet
+ **/
+
+static void benchDemuxRawIpFunc(const void *packet)
+{
+   const BenchDemuxIpPacket *p;
+
+   //Point to the packet
+   p = (const BenchDemuxIpPacket *) packet;
+
+   //Allow raw sockets to process the packet
+   rawSocketProcessIpPacket(&netInterface[0], &p->pseudoHeader,
+      (const NetBuffer *) &p->buffer, 0, &NET_DEFAULT_RX_ANCILLARY);
+}
+
+
+/**
+ * @brief Raw IP demultiplexing
+ * @param[in] count Number of sockets
+ **/
+
+static void benchDemuxRawIp(uint_t count)
+{
+   uint_t i;
+   BenchDemuxIpPacket packet;
+
+   //Each socket is bound to its own protocol number
+   if(count > 256)
+      return;
+
+   //Open the sockets
+   for(i = 0; i < count; i++)
+   {
+      //Open a raw IP socket
+      benchDemuxSockets[i] = socketOpen(SOCKET_TYPE_RAW_IP, i);
+
+      //Failed to open socket?
+      if(benchDemuxSockets[i] == NULL)
+         break;
+   }
+
+   //Any error to report?
+   if(i < count)
+   {
+      benchDemuxCloseSockets(i);
+      benchFailed("demux", "raw-ip", count, ERROR_OUT_OF_RESOURCES);
+      return;
+   }
+
+   //Format the packet, addressed to the socket opened last
+   osMemset(&packet, 0, sizeof(BenchDemuxIpPacket));
+   packet.pseudoHeader.length = sizeof(Ipv4PseudoHeader);
+   packet.pseudoHeader.ipv4Data.srcAddr = IPV4_ADDR(10, 0, 0, 2);
+   packet.pseudoHeader.ipv4Data.destAddr = IPV4_ADDR(10, 0, 0, 1);
+   packet.pseudoHeader.ipv4Data.protocol = count - 1;
+
+   packet.buffer.chunkCount = 1;
+   packet.buffer.maxChunkCount = 1;
+   packet.buffer.chunk[0].address = packet.data;
+   packet.buffer.chunk[0].length = sizeof(packet.data);
+
+   //Measure the packet rate
+   benchReport("demux", "raw-ip", count,
+      benchDemuxMeasure(benchDemuxRawIpFunc, &packet), "pkt/s");
+
+   //Close the sockets
+   benchDemuxCloseSockets(count);
+}
+
+#endif
+#if (RAW_SOCKET_SUPPORT == ENABLED && ETH_SUPPORT == ENABLED)
+
+/**
+ * @brief Deliver an Ethernet frame
+ * @param[in] packet Pointer to the frame
+ **/
+
+static void benchDemuxRawEthFunc(const void *packet)
+{
+   const BenchDemuxEthPacket *p;
+
+   //Point to the frame
+   p = (const BenchDemuxEthPacket *) packet;
+
+   //Allow raw sockets to process the frame
+   rawSocketProcessEthPacket(&netInterface[0], p->data, sizeof(p->data),
+      (NetRxAncillary *) &p->ancillary);
+}
+
+
+/**
+ * @brief Raw Ethernet demultiplexing
+ * @param[in] count Number of sockets
+ **/
+
+static void benchDemuxRawEth(uint_t count)
+{
+   uint_t i;
+   BenchDemuxEthPacket packet;
+
+   //Open the sockets
+   for(i = 0; i < count; i++)
+   {
+      //Open a raw Ethernet socket bound to its own EtherType value
+      benchDemuxSockets[i] = socketOpen(SOCKET_TYPE_RAW_ETH,
+         BENCH_DEMUX_BASE_ETH_TYPE + i);
+
+      //Failed to open socket?
+      if(benchDemuxSockets[i] == NULL)
+         break;
+   }
+
+   //Any error to report?
+   if(i < count)
+   {
+      benchDemuxCloseSockets(i);
+      benchFailed("demux", "raw-eth", count, ERROR_OUT_OF_RESOURCES);
+      return;
+   }
+
+   //Format the frame, addressed to the socket opened last
+   osMemset(&packet, 0, sizeof(BenchDemuxEthPacket));
+   packet.ancillary = NET_DEFAULT_RX_ANCILLARY;
+   packet.ancillary.ethType = BENCH_DEMUX_BASE_ETH_TYPE + count - 1;
+
+   //Measure the packet rate
+   benchReport("demux", "raw-eth", count,
+      benchDemuxMeasure(benchDemuxRawEthFunc, &packet), "pkt/s");
+
+   //Close the sockets
+   benchDemuxCloseSockets(count);
+}
+
+#endif
+
+
+/**
+ * @brief Packet demultiplexing benchmarks
+ **/
+
+void benchDemux(void)
+{
+   uint_t i;
+   uint_t count;
+
+   //Loop through the number of sockets
+   for(i = 0; i < arraysize(benchDemuxSocketCounts); i++)
+   {
+      //Get the number of sockets to be opened
+      count = benchDemuxSocketCounts[i];
+
+      //The socket table must be large enough
+      if(count > SOCKET_MAX_COUNT)
+         break;
+
+      //UDP demultiplexing
+      if(benchSelected("demux", "udp"))
+      {
+         benchDemuxUdp(count);
+      }
+
+#if (TCP_SUPPORT == ENABLED)
+      //TCP listener demultiplexing
+      if(benchSelected("demux", "tcp-listen"))
+      {
+         benchDemuxTcpListen(count);
+      }
+
+      //TCP established connection demultiplexing
+      if(benchSelected("demux", "tcp-est"))
+      {
+         benchDemuxTcpEstablished(count);
+      }
+#endif
+
+#if (RAW_SOCKET_SUPPORT == ENABLED)
+      //Raw IP demultiplexing
+      if(benchSelected("demux", "raw-ip"))
+      {
+         benchDemuxRawIp(count);
+      }
+#endif
+
+#if (RAW_SOCKET_SUPPORT == ENABLED && ETH_SUPPORT == ENABLED)
+      //Raw Ethernet demultiplexing
+      if(benchSelected("demux", "raw-eth"))
+      {
+         benchDemuxRawEth(count);
+      }
+#endif
+   }
+}
@@ -0,0 +1,198 @@
+/**
+ * @file bench_kat.c
+ * @brief Known-answer tests
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * Functional checks of the code paths that the benchmark suites do not
+ * exercise. A resource bundle made of a single RES_TYPE_FILE_EX entry, as
+ * emitted by the resource compiler, is looked up with resGetDataEx, then the
+ * ETag and Last-Modified values of its file information record are matched
+ * against the If-None-Match and If-Modified-Since header fields of a set of
+ * conditional requests (httpCheckNotModified)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include "core/net.h"
+#include "http/http_server.h"
+#include "http/http_server_misc.h"
+#include "resource_manager.h"
+#include "bench.h"
+
+//Path of the resource
+#define BENCH_KAT_RES_PATH "/index.html"
+//Contents of the resource
+#define BENCH_KAT_RES_DATA "Hello"
+//Entity tag of the resource
+#define BENCH_KAT_RES_ETAG "\"8c5d1a2b3e4f6071\""
+//Modification date of the resource (1700000000 in Unix time)
+#define BENCH_KAT_RES_DATE "Tue, 14 Nov 2023 22:13:20 GMT"
+
+
+/**
+ * @brief Conditional request
+ **/
+
+typedef struct
+{
+   const char_t *label;            ///<Description of the request
+   const char_t *ifNoneMatch;      ///<If-None-Match header field
+   const char_t *ifModifiedSince;  ///<If-Modified-Since header field
+   bool_t notModified;             ///<Expected outcome (304 response)
+} BenchKatHttpVector;
+
+
+//Resource bundle (header, root directory, file information record, payload)
+const uint8_t res[] =
+{
+   //Total size
+   0x67, 0x00, 0x00, 0x00,
+   //Root directory (type, data start, data length, name length)
+   0x01, 0x0E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
+   //Entry of the file (type, data start, data length, name length, name)
+   0x03, 0x62, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0A,
+   'i', 'n', 'd', 'e', 'x', '.', 'h', 't', 'm', 'l',
+   //File information record (data length, modification time)
+   0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x53, 0x65,
+   //Entity tag
+   '"', '8', 'c', '5', 'd', '1', 'a', '2', 'b', '3', 'e', '4', 'f', '6', '0',
+   '7', '1', '"', 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   //Modification date
+   'T', 'u', 'e', ',', ' ', '1', '4', ' ', 'N', 'o', 'v', ' ', '2', '0', '2',
+   '3', ' ', '2', '2', ':', '1', '3', ':', '2', '0', ' ', 'G', 'M', 'T', 0x00,
+   0x00, 0x00,
+   //Payload
+   'H', 'e', 'l', 'l', 'o'
+};
+
+//Conditional requests
+static const BenchKatHttpVector benchKatHttpVectors[] =
+{
+   {"unconditional request", "", "", FALSE},
+   {"matching entity tag", BENCH_KAT_RES_ETAG, "", TRUE},
+   {"weak entity tag", "W/" BENCH_KAT_RES_ETAG, "", TRUE},
+   {"list of entity tags", "\"0000000000000000\", " BENCH_KAT_RES_ETAG, "", TRUE},
+   {"wildcard", "*", "", TRUE},
+   {"stale entity tag", "\"0000000000000000\"", "", FALSE},
+   {"matching date", "", BENCH_KAT_RES_DATE, TRUE},
+   {"stale date", "", "Mon, 13 Nov 2023 22:13:20 GMT", FALSE},
+   {"If-None-Match precedence", "\"0000000000000000\"", BENCH_KAT_RES_DATE, FALSE}
+};
+
+//HTTP connection holding the request header fields
+static HttpConnection benchKatHttpConnection;
+
+
+/**
+ * @brief Check the handling of conditional GET requests
+ * @return Number of failed tests
+ **/
+
+static uint_t benchKatHttp(void)
+{
+   error_t error;
+   uint_t i;
+   uint_t failures;
+   bool_t notModified;
+   size_t length;
+   const uint8_t *data;
+   const ResFileInfo *info;
+   const BenchKatHttpVector *vector;
+
+   //Reset the number of failed tests
+   failures = 0;
+
+   //Retrieve the resource and its file information record
+   error = resGetDataEx(BENCH_KAT_RES_PATH, &data, &length, &info);
+
+   //Check the contents of the resource
+   if(error || info == NULL || length != osStrlen(BENCH_KAT_RES_DATA) ||
+      osMemcmp(data, BENCH_KAT_RES_DATA, length) ||
+      osStrcmp(info->etag, BENCH_KAT_RES_ETAG) ||
+      osStrcmp(info->date, BENCH_KAT_RES_DATE))
+   {
+      fprintf(stderr, "KAT resGetDataEx (%s) lookup failed\r\n",
+         BENCH_KAT_RES_PATH);
+
+      //The conditional requests cannot be evaluated
+      return 1;
+   }
+
+#if (HTTP_SERVER_CONDITIONAL_REQ_SUPPORT == ENABLED)
+   //Loop through the conditional requests
+   for(i = 0; i < arraysize(benchKatHttpVectors); i++)
+   {
+      //Point to the current request
+      vector = &benchKatHttpVectors[i];
+
+      //The list of entity tags is parsed in place, so the header fields
+      //must be copied before each evaluation
+      osStrcpy(benchKatHttpConnection.request.ifNoneMatch,
+         vector->ifNoneMatch);
+      osStrcpy(benchKatHttpConnection.request.ifModifiedSince,
+         vector->ifModifiedSince);
+
+      //Evaluate the preconditions of the request
+      notModified = httpCheckNotModified(&benchKatHttpConnection, info->etag,
+         info->date);
+
+      //Check the outcome
+      if(notModified != vector->notModified)
+      {
+         fprintf(stderr, "KAT httpCheckNotModified (%s) returned %s\r\n",
+            vector->label, notModified ? "TRUE" : "FALSE");
+
+         //Increment the number of failed tests
+         failures++;
+      }
+   }
+#else
+   //Conditional requests are not supported
+   (void) i;
+   (void) notModified;
+   (void) vector;
+#endif
+
+   //Return the number of failed tests
+   return failures;
+}
+
+
+/**
+ * @brief Run the known-answer tests
+ * @return Error code
+ **/
+
+error_t benchKat(void)
+{
+   uint_t failures;
+
+   //Conditional GET requests
+   failures = benchKatHttp();
+
+   //Return status code
+   return (failures == 0) ? NO_ERROR : ERROR_FAILURE;
+}
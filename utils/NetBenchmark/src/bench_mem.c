@@ -0,0 +1,241 @@
+/**
+ * @file bench_mem.c
+ * @brief Network buffer allocation benchmarks
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * A given number of tasks concurrently allocate and release network buffers
+ * of typical sizes (ARP, TCP ACK, medium-sized and full-sized frames) while
+ * half of the large buffers of the pool are held, as they would be by the
+ * TCP send and receive buffers of a busy stack. The figure reported is the
+ * total number of allocation/release pairs per second
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/net.h"
+#include "core/net_mem.h"
+#include "bench.h"
+
+//Maximum number of concurrent tasks
+#define BENCH_MEM_MAX_TASKS 8
+
+//Number of large buffers held during the measurement
+#if (NET_MEM_POOL_SUPPORT == ENABLED)
+   #define BENCH_MEM_HELD_BUFFERS (NET_MEM_POOL_BUFFER_COUNT / 2)
+#else
+   #define BENCH_MEM_HELD_BUFFERS 0
+#endif
+
+
+/**
+ * @brief Allocation task context
+ **/
+
+typedef struct
+{
+   OsSemaphore *semaphore;     ///<Semaphore released when the task completes
+   volatile bool_t *stop;      ///<Flag telling the task to stop
+   uint32_t count;             ///<Number of allocation/release pairs performed
+   uint32_t failures;          ///<Number of failed allocations
+} BenchMemTask;
+
+
+//Number of concurrent tasks used by the test cases
+static const uint_t benchMemTaskCounts[] = {1, 2, 4, 8};
+
+//Buffer sizes allocated by each iteration
+static const size_t benchMemSizes[] = {42, 66, 300, 1400};
+
+
+/**
+ * @brief Allocation task
+ * @param[in] param Pointer to the task context
+ **/
+
+static void benchMemTaskFunc(void *param)
+{
+   uint_t i;
+   BenchMemTask *task;
+   NetBuffer *buffers[arraysize(benchMemSizes)];
+
+   //Point to the task context
+   task = (BenchMemTask *) param;
+
+   //Run until the measurement time has elapsed
+   while(!*task->stop)
+   {
+      //Allocate a buffer of each size, so that several size classes are
+      //in use at the same time
+      for(i = 0; i < arraysize(benchMemSizes); i++)
+      {
+         buffers[i] = netBufferAlloc(benchMemSizes[i]);
+      }
+
+      //Release the buffers
+      for(i = 0; i < arraysize(benchMemSizes); i++)
+      {
+         //Successful memory allocation?
+         if(buffers[i] != NULL)
+         {
+            netBufferFree(buffers[i]);
+            task->count++;
+         }
+         else
+         {
+            task->failures++;
+         }
+      }
+   }
+
+   //Notify the calling task
+   osReleaseSemaphore(task->semaphore);
+
+   //Kill ourselves
+   osDeleteTask(OS_SELF_TASK_ID);
+}
+
+
+/**
+ * @brief Concurrent allocations
+ * @param[in] numTasks Number of tasks
+ **/
+
+static void benchMemAllocFree(uint_t numTasks)
+{
+   uint_t i;
+   uint_t numCreated;
+   uint32_t count;
+   uint32_t failures;
+   uint64_t time;
+   OsTaskId taskId;
+   OsSemaphore semaphore;
+   volatile bool_t stop;
+   BenchMemTask tasks[BENCH_MEM_MAX_TASKS];
+
+   //Create a semaphore to wait for the tasks
+   if(!osCreateSemaphore(&semaphore, 0))
+   {
+      benchFailed("mem", "alloc-free", numTasks, ERROR_OUT_OF_RESOURCES);
+      return;
+   }
+
+   //Start of the measurement
+   stop = FALSE;
+   time = benchGetTime();
+
+   //Create the tasks
+   for(numCreated = 0; numCreated < numTasks; numCreated++)
+   {
+      //Initialize task context
+      tasks[numCreated].semaphore = &semaphore;
+      tasks[numCreated].stop = &stop;
+      tasks[numCreated].count = 0;
+      tasks[numCreated].failures = 0;
+
+      //Create a task
+      taskId = osCreateTask("Bench", benchMemTaskFunc, &tasks[numCreated],
+         &OS_TASK_DEFAULT_PARAMS);
+
+      //Unable to create the task?
+      if(taskId == (OsTaskId) OS_INVALID_TASK_ID)
+         break;
+   }
+
+   //Let the tasks run for the minimum measurement time
+   if(numCreated == numTasks)
+   {
+      osDelayTask(benchSettings.minTime);
+   }
+
+   //Tell the tasks to stop and wait for them
+   stop = TRUE;
+
+   for(i = 0; i < numCreated; i++)
+   {
+      osWaitForSemaphore(&semaphore, INFINITE_DELAY);
+   }
+
+   //End of the measurement
+   time = benchGetTime() - time;
+
+   //Release semaphore
+   osDeleteSemaphore(&semaphore);
+
+   //Total number of allocation/release pairs
+   for(count = 0, failures = 0, i = 0; i < numCreated; i++)
+   {
+      count += tasks[i].count;
+      failures += tasks[i].failures;
+   }
+
+   //Check whether all the tasks could be created and all the allocations
+   //succeeded
+   if(numCreated < numTasks)
+   {
+      benchFailed("mem", "alloc-free", numTasks, ERROR_OUT_OF_RESOURCES);
+   }
+   else if(failures > 0)
+   {
+      benchFailed("mem", "alloc-free", numTasks, ERROR_OUT_OF_MEMORY);
+   }
+   else
+   {
+      benchReport("mem", "alloc-free", numTasks,
+         (double) count * 1e9 / (double) time, "ops/s");
+   }
+}
+
+
+/**
+ * @brief Network buffer allocation benchmarks
+ **/
+
+void benchMem(void)
+{
+   uint_t i;
+   void *held[BENCH_MEM_HELD_BUFFERS + 1];
+
+   //Any test case selected?
+   if(!benchSelected("mem", "alloc-free"))
+      return;
+
+   //Hold part of the large buffers
+   for(i = 0; i < BENCH_MEM_HELD_BUFFERS; i++)
+   {
+      held[i] = memPoolAlloc(NET_MEM_POOL_BUFFER_SIZE);
+   }
+
+   //Loop through the number of tasks
+   for(i = 0; i < arraysize(benchMemTaskCounts); i++)
+   {
+      benchMemAllocFree(benchMemTaskCounts[i]);
+   }
+
+   //Release the buffers
+   for(i = 0; i < BENCH_MEM_HELD_BUFFERS; i++)
+   {
+      memPoolFree(held[i]);
+   }
+}
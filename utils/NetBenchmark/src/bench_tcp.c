@@ -0,0 +1,510 @@
+/**
+ * @file bench_tcp.c
+ * @brief TCP throughput benchmarks
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * A client task streams data to a server task over the emulated link for a
+ * fixed duration. The server checks every byte it receives, and the figure
+ * reported is the goodput measured between the end of the three-way
+ * handshake and the reception of the FIN
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/net.h"
+#include "core/tcp_cubic.h"
+#include "core/tcp_bbr.h"
+#include "ipv4/ipv4.h"
+#include "link_driver.h"
+#include "bench.h"
+
+//Duration of each transfer, in milliseconds
+#ifndef BENCH_TCP_DURATION
+   #define BENCH_TCP_DURATION 4000
+#elif (BENCH_TCP_DURATION < 100)
+   #error BENCH_TCP_DURATION parameter is not valid
+#endif
+
+//Port number of the server
+#define BENCH_TCP_PORT 5001
+//Size of the blocks passed to socketSend and socketReceive
+#define BENCH_TCP_BLOCK_SIZE 16384
+//Socket timeout, in milliseconds
+#define BENCH_TCP_TIMEOUT 30000
+
+
+/**
+ * @brief Server task context
+ **/
+
+typedef struct
+{
+   Socket *socket;          ///<Listening socket
+   OsSemaphore *semaphore;  ///<Semaphore released when the transfer completes
+   uint32_t received;       ///<Number of bytes received
+   uint64_t endTime;        ///<Time at which the FIN was received
+   error_t error;           ///<Status of the transfer
+} BenchTcpServer;
+
+
+//Transmit and receive buffers
+static uint8_t benchTcpTxBuffer[BENCH_TCP_BLOCK_SIZE];
+static uint8_t benchTcpRxBuffer[BENCH_TCP_BLOCK_SIZE];
+
+//Socket buffer sizes used by the window scaling test case
+static const uint_t benchTcpBufferSizes[] = {22880, 65536, 262144};
+
+//Congestion control algorithms compared by the test cases
+static const TcpCongestionAlgo *const benchTcpCongestAlgos[] =
+{
+   TCP_NEWRENO_ALGO,
+#if (TCP_CUBIC_SUPPORT == ENABLED)
+   TCP_CUBIC_ALGO,
+#endif
+#if (TCP_BBR_SUPPORT == ENABLED)
+   TCP_BBR_ALGO,
+#endif
+};
+
+//Random loss rates (per thousand) used by the congestion control test cases
+static const uint_t benchTcpLossRates[] = {0, 10};
+
+
+/**
+ * @brief Value of a given byte of the stream
+ * @param[in] offset Offset of the byte from the beginning of the stream
+ * @return Value of the byte
+ **/
+
+static uint8_t benchTcpPattern(uint32_t offset)
+{
+   //The pattern does not repeat every 256 bytes, so that misplaced blocks
+   //are detected as well
+   return (uint8_t) (offset ^ (offset >> 8) ^ (offset >> 16));
+}
+
+
+/**
+ * @brief Server task
+ * @param[in] param Pointer to the server task context
+ **/
+
+static void benchTcpServerTask(void *param)
+{
+   error_t error;
+   size_t i;
+   size_t n;
+   Socket *socket;
+   BenchTcpServer *server;
+
+   //Point to the server task context
+   server = (BenchTcpServer *) param;
+
+   //Wait for the client to connect
+   socket = socketAccept(server->socket, NULL, NULL);
+
+   //Failed to accept the connection?
+   if(socket == NULL)
+   {
+      error = ERROR_TIMEOUT;
+   }
+   else
+   {
+      //Set timeout
+      socketSetTimeout(socket, BENCH_TCP_TIMEOUT);
+
+      //Receive data until the client closes the connection
+      while(1)
+      {
+         //Receive data
+         error = socketReceive(socket, benchTcpRxBuffer, BENCH_TCP_BLOCK_SIZE,
+            &n, 0);
+
+         //Any error to report?
+         if(error)
+            break;
+
+         //Check the data
+         for(i = 0; i < n; i++)
+         {
+            if(benchTcpRxBuffer[i] != benchTcpPattern(server->received + i))
+               break;
+         }
+
+         //Corrupted data?
+         if(i < n)
+         {
+            error = ERROR_INVALID_MESSAGE;
+            break;
+         }
+
+         //Update the number of bytes received
+         server->received += n;
+      }
+
+      //Save the time at which the FIN was received
+      server->endTime = benchGetTime();
+
+      //The client closes the connection at the end of the transfer
+      if(error == ERROR_END_OF_STREAM)
+      {
+         error = NO_ERROR;
+      }
+
+      //Close the connection
+      socketClose(socket);
+   }
+
+   //Save the status of the transfer
+   server->error = error;
+
+   //Notify the calling task
+   osReleaseSemaphore(server->semaphore);
+
+   //Kill ourselves
+   osDeleteTask(OS_SELF_TASK_ID);
+}
+
+
+/**
+ * @brief Stream data over the emulated link
+ * @param[in] bufferSize Size of the socket send and receive buffers
+ * @param[in] algo Congestion control algorithm of the client (NULL to keep
+ *   the default algorithm)
+ * @param[out] goodput Goodput, in bytes per second
+ * @return Error code
+ **/
+
+static error_t benchTcpTransfer(size_t bufferSize,
+   const TcpCongestionAlgo *algo, double *goodput)
+{
+   error_t error;
+   size_t i;
+   size_t n;
+   uint32_t sent;
+   uint64_t startTime;
+   OsTaskId taskId;
+   OsSemaphore semaphore;
+   Socket *socket;
+   IpAddr serverIpAddr;
+   BenchTcpServer server;
+
+   //Initialize variables
+   sent = 0;
+   startTime = 0;
+
+   //Initialize the server task context
+   osMemset(&server, 0, sizeof(BenchTcpServer));
+   server.semaphore = &semaphore;
+
+   //Create a semaphore to wait for the server task
+   if(!osCreateSemaphore(&semaphore, 0))
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Open the listening socket
+   server.socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+
+   //Failed to open socket?
+   if(server.socket == NULL)
+   {
+      osDeleteSemaphore(&semaphore);
+      return ERROR_OPEN_FAILED;
+   }
+
+   //The receive buffer is inherited by the accepted connection
+   error = socketSetRxBufferSize(server.socket, bufferSize);
+
+   //Check status code
+   if(!error)
+   {
+      //Set timeout
+      error = socketSetTimeout(server.socket, BENCH_TCP_TIMEOUT);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Bind the socket to the server port
+      error = socketBind(server.socket, &IP_ADDR_ANY, BENCH_TCP_PORT);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Place the socket in listening state
+      error = socketListen(server.socket, 1);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Create the server task
+      taskId = osCreateTask("Server", benchTcpServerTask, &server,
+         &OS_TASK_DEFAULT_PARAMS);
+
+      //Unable to create the task?
+      if(taskId == (OsTaskId) OS_INVALID_TASK_ID)
+         error = ERROR_OUT_OF_RESOURCES;
+   }
+
+   //Any error to report?
+   if(error)
+   {
+      socketClose(server.socket);
+      osDeleteSemaphore(&semaphore);
+      return error;
+   }
+
+   //Open the client socket
+   socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+
+   //Failed to open socket?
+   if(socket == NULL)
+   {
+      error = ERROR_OPEN_FAILED;
+   }
+   else
+   {
+      //Set the size of the send buffer
+      error = socketSetTxBufferSize(socket, bufferSize);
+
+      //Check status code
+      if(!error)
+      {
+         //Set timeout
+         error = socketSetTimeout(socket, BENCH_TCP_TIMEOUT);
+      }
+
+      //Check status code
+      if(!error && algo != NULL)
+      {
+         //Select the congestion control algorithm
+         error = socketSetCongestionControl(socket, algo);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Connect to the server
+         serverIpAddr.length = sizeof(Ipv4Addr);
+         serverIpAddr.ipv4Addr = IPV4_ADDR(127, 0, 0, 1);
+
+         error = socketConnect(socket, &serverIpAddr, BENCH_TCP_PORT);
+      }
+
+      //Start of the measurement
+      startTime = benchGetTime();
+
+      //Stream data for the specified duration
+      for(sent = 0; !error; sent += n)
+      {
+         //Long enough?
+         if((benchGetTime() - startTime) >= (uint64_t) BENCH_TCP_DURATION *
+            1000000)
+         {
+            break;
+         }
+
+         //Format the next block
+         for(i = 0; i < BENCH_TCP_BLOCK_SIZE; i++)
+         {
+            benchTcpTxBuffer[i] = benchTcpPattern(sent + i);
+         }
+
+         //Send data
+         error = socketSend(socket, benchTcpTxBuffer, BENCH_TCP_BLOCK_SIZE,
+            &n, 0);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Gracefully close the connection
+         error = socketShutdown(socket, SOCKET_SD_BOTH);
+      }
+
+      //Close the socket (a connection that failed is reset, so that the
+      //server task does not hang)
+      socketClose(socket);
+   }
+
+   //Wait for the server task to complete (the accept operation times out
+   //if the client failed to connect)
+   osWaitForSemaphore(&semaphore, INFINITE_DELAY);
+
+   //Release resources
+   socketClose(server.socket);
+   osDeleteSemaphore(&semaphore);
+
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Check the status of the transfer
+   if(server.error)
+      return server.error;
+
+   //The server must have received the whole stream
+   if(server.received != sent)
+      return ERROR_INVALID_LENGTH;
+
+   //Compute the goodput
+   *goodput = (double) server.received * 1e9 /
+      (double) (server.endTime - startTime);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Window scaling over a long fat pipe
+ **/
+
+static void benchTcpWindow(void)
+{
+   error_t error;
+   uint_t i;
+   double goodput;
+   LinkDriverParams params;
+
+   //4 MB/s bottleneck, 100 ms round-trip time, 100-packet queue, no loss
+   params.rate = 4000000;
+   params.delay = 50;
+   params.queueSize = 100;
+   params.lossRate = 0;
+
+   //Loop through the socket buffer sizes
+   for(i = 0; i < arraysize(benchTcpBufferSizes); i++)
+   {
+      //Reset the emulated link
+      linkDriverConfigure(&params);
+
+      //Stream data over the link
+      error = benchTcpTransfer(benchTcpBufferSizes[i], NULL, &goodput);
+
+      //Check status code
+      if(!error)
+      {
+         benchReport("tcp", "window", benchTcpBufferSizes[i], goodput / 1e3,
+            "kB/s");
+      }
+      else
+      {
+         benchFailed("tcp", "window", benchTcpBufferSizes[i], error);
+      }
+   }
+}
+
+
+/**
+ * @brief Congestion control over a lossy link
+ * @param[in] algo Congestion control algorithm
+ **/
+
+static void benchTcpCongestion(const TcpCongestionAlgo *algo)
+{
+   error_t error;
+   uint_t i;
+   double goodput;
+   LinkDriverParams params;
+
+   //4 MB/s bottleneck, 100 ms round-trip time, 100-packet queue
+   params.rate = 4000000;
+   params.delay = 50;
+   params.queueSize = 100;
+
+   //Loop through the loss rates
+   for(i = 0; i < arraysize(benchTcpLossRates); i++)
+   {
+      //Reset the emulated link (the same packets are lost on every run)
+      params.lossRate = benchTcpLossRates[i];
+      linkDriverConfigure(&params);
+
+      //Stream data over the link
+      error = benchTcpTransfer(262144, algo, &goodput);
+
+      //Check status code
+      if(!error)
+      {
+         benchReport("tcp", algo->name, benchTcpLossRates[i], goodput / 1e3,
+            "kB/s");
+      }
+      else
+      {
+         benchFailed("tcp", algo->name, benchTcpLossRates[i], error);
+      }
+   }
+}
+
+
+/**
+ * @brief TCP throughput benchmarks
+ **/
+
+void benchTcp(void)
+{
+   error_t error;
+   uint_t i;
+   bool_t selected;
+
+   //Any test case selected?
+   selected = benchSelected("tcp", "window");
+
+   for(i = 0; i < arraysize(benchTcpCongestAlgos); i++)
+   {
+      selected |= benchSelected("tcp", benchTcpCongestAlgos[i]->name);
+   }
+
+   //Nothing to do?
+   if(!selected)
+      return;
+
+   //Attach the emulated link to the first network interface
+   error = benchSetupLink();
+
+   //Any error to report?
+   if(error)
+   {
+      benchFailed("tcp", "setup", 0, error);
+      return;
+   }
+
+   //Window scaling over a long fat pipe
+   if(benchSelected("tcp", "window"))
+   {
+      benchTcpWindow();
+   }
+
+   //Loop through the congestion control algorithms
+   for(i = 0; i < arraysize(benchTcpCongestAlgos); i++)
+   {
+      //Congestion control over a lossy link
+      if(benchSelected("tcp", benchTcpCongestAlgos[i]->name))
+      {
+         benchTcpCongestion(benchTcpCongestAlgos[i]);
+      }
+   }
+}
@@ -0,0 +1,474 @@
+/**
+ * @file link_driver.c
+ * @brief Emulated link driver
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Eval.
+ *
+ * This software is provided in source form for a short-term evaluation only. The
+ * evaluation license expires 90 days after the date you first download the software.
+ *
+ * If you plan to use this software in a commercial product, you are required to
+ * purchase a commercial license from Oryx Embedded SARL.
+ *
+ * After the 90-day evaluation period, you agree to either purchase a commercial
+ * license or delete all copies of this software. If you wish to extend the
+ * evaluation period, you must contact sales@oryx-embedded.com.
+ *
+ * This evaluation software is provided "as is" without warranty of any kind.
+ * Technical support is available as an option during the evaluation period.
+ *
+ * @section Description
+ *
+ * The driver behaves as a loopback interface whose packets cross an emulated
+ * path before being handed back to the stack. Data packets go through a
+ * bottleneck (fixed rate and drop-tail queue) and then incur the propagation
+ * delay. Random losses are drawn from a fixed-seed generator, so that a
+ * given sequence of packets always suffers the same losses. Small packets (pure ACKs) model the return path: they only incur
+ * the propagation delay. A helper task polls the queues every millisecond
+ * and notifies the stack when a packet is due
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.2
+ **/
+
+//Dependencies
+#include "core/net.h"
+#include "link_driver.h"
+#include "bench.h"
+
+//Link parameters
+static LinkDriverParams linkDriverParams;
+//Link statistics
+static LinkDriverStats linkDriverStats;
+//Time at which the bottleneck becomes idle, in nanoseconds
+static uint64_t linkDriverDepartureTime;
+//State of the loss generator
+static uint32_t linkDriverLossState;
+//Packets in flight on the forward and return paths
+static LinkDriverQueue linkDriverDataQueue;
+static LinkDriverQueue linkDriverReturnQueue;
+//Mutex protecting the queues
+static OsMutex linkDriverMutex;
+//Underlying network interface
+static NetInterface *linkDriverInterface;
+
+
+/**
+ * @brief Emulated link driver
+ **/
+
+const NicDriver linkDriver =
+{
+   NIC_TYPE_LOOPBACK,
+   ETH_MTU,
+   linkDriverInit,
+   linkDriverTick,
+   linkDriverEnableIrq,
+   linkDriverDisableIrq,
+   linkDriverEventHandler,
+   linkDriverSendPacket,
+   linkDriverUpdateMacAddrFilter,
+   NULL,
+   NULL,
+   NULL,
+   FALSE,
+   FALSE,
+   FALSE,
+   FALSE
+};
+
+
+/**
+ * @brief Set the link parameters
+ *
+ * The packets in flight are discarded, the statistics are cleared and the
+ * loss generator is reseeded
+ *
+ * @param[in] params Link parameters
+ **/
+
+void linkDriverConfigure(const LinkDriverParams *params)
+{
+   //Acquire exclusive access to the queues
+   osAcquireMutex(&linkDriverMutex);
+
+   //Save the link parameters
+   linkDriverParams = *params;
+
+   //Reset the emulated path
+   osMemset(&linkDriverStats, 0, sizeof(LinkDriverStats));
+   linkDriverDepartureTime = 0;
+   linkDriverLossState = 12345;
+   linkDriverDataQueue.length = 0;
+   linkDriverDataQueue.writeIndex = 0;
+   linkDriverDataQueue.readIndex = 0;
+   linkDriverReturnQueue.length = 0;
+   linkDriverReturnQueue.writeIndex = 0;
+   linkDriverReturnQueue.readIndex = 0;
+
+   //Release exclusive access to the queues
+   osReleaseMutex(&linkDriverMutex);
+}
+
+
+/**
+ * @brief Get link statistics
+ * @param[out] stats Link statistics
+ **/
+
+void linkDriverGetStats(LinkDriverStats *stats)
+{
+   //Acquire exclusive access to the queues
+   osAcquireMutex(&linkDriverMutex);
+   //Copy the statistics
+   *stats = linkDriverStats;
+   //Release exclusive access to the queues
+   osReleaseMutex(&linkDriverMutex);
+}
+
+
+/**
+ * @brief Emulated link initialization
+ * @param[in] interface Underlying network interface
+ * @return Error code
+ **/
+
+error_t linkDriverInit(NetInterface *interface)
+{
+   OsTaskId taskId;
+
+   //The driver handles a single interface
+   if(linkDriverInterface == NULL)
+   {
+      //Create a mutex to protect the queues
+      if(!osCreateMutex(&linkDriverMutex))
+         return ERROR_OUT_OF_RESOURCES;
+
+      //Create the task that polls the queues
+      taskId = osCreateTask("Link", linkDriverTask, NULL,
+         &OS_TASK_DEFAULT_PARAMS);
+
+      //Unable to create the task?
+      if(taskId == (OsTaskId) OS_INVALID_TASK_ID)
+         return ERROR_OUT_OF_RESOURCES;
+   }
+
+   //Save the underlying network interface
+   linkDriverInterface = interface;
+
+   //Force the TCP/IP stack to poll the link state at startup
+   interface->nicEvent = TRUE;
+   osSetEvent(&netEvent);
+
+   //The emulated link is now ready to send
+   osSetEvent(&interface->nicTxEvent);
+
+   //Successful initialization
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Emulated link timer handler
+ * @param[in] interface Underlying network interface
+ **/
+
+void linkDriverTick(NetInterface *interface)
+{
+   //Not implemented
+}
+
+
+/**
+ * @brief Enable interrupts
+ * @param[in] interface Underlying network interface
+ **/
+
+void linkDriverEnableIrq(NetInterface *interface)
+{
+   //Not implemented
+}
+
+
+/**
+ * @brief Disable interrupts
+ * @param[in] interface Underlying network interface
+ **/
+
+void linkDriverDisableIrq(NetInterface *interface)
+{
+   //Not implemented
+}
+
+
+/**
+ * @brief Emulated link event handler
+ * @param[in] interface Underlying network interface
+ **/
+
+void linkDriverEventHandler(NetInterface *interface)
+{
+   LinkDriverQueue *queue;
+   LinkDriverQueueEntry *entry;
+   NetRxAncillary ancillary;
+
+   //Link up event is pending?
+   if(!interface->linkState)
+   {
+      //Link is up
+      interface->linkState = TRUE;
+      //Process link state change event
+      nicNotifyLinkChange(interface);
+   }
+
+   //Deliver the packets whose delay has elapsed
+   while(1)
+   {
+      //Acquire exclusive access to the queues
+      osAcquireMutex(&linkDriverMutex);
+
+      //Check whether a packet is due on either path
+      if(linkDriverDataQueue.length > 0 && benchGetTime() >=
+         linkDriverDataQueue.entries[linkDriverDataQueue.readIndex].dueTime)
+      {
+         queue = &linkDriverDataQueue;
+      }
+      else if(linkDriverReturnQueue.length > 0 && benchGetTime() >=
+         linkDriverReturnQueue.entries[linkDriverReturnQueue.readIndex].dueTime)
+      {
+         queue = &linkDriverReturnQueue;
+      }
+      else
+      {
+         queue = NULL;
+      }
+
+      //Release exclusive access to the queues
+      osReleaseMutex(&linkDriverMutex);
+
+      //No packet due?
+      if(queue == NULL)
+         break;
+
+      //The entry remains allocated while the stack processes the packet,
+      //since the stack may send packets in response
+      entry = &queue->entries[queue->readIndex];
+
+      //Additional options can be passed to the stack along with the packet
+      ancillary = NET_DEFAULT_RX_ANCILLARY;
+
+      //Pass the packet to the upper layer
+      nicProcessPacket(interface, entry->data, entry->length, &ancillary);
+
+      //Acquire exclusive access to the queues
+      osAcquireMutex(&linkDriverMutex);
+
+      //Increment index and wrap around if necessary
+      if(++queue->readIndex >= LINK_DRIVER_QUEUE_SIZE)
+      {
+         queue->readIndex = 0;
+      }
+
+      //Update the length of the queue
+      queue->length--;
+
+      //Release exclusive access to the queues
+      osReleaseMutex(&linkDriverMutex);
+   }
+}
+
+
+/**
+ * @brief Send a packet over the emulated link
+ * @param[in] interface Underlying network interface
+ * @param[in] buffer Multi-part buffer containing the data to send
+ * @param[in] offset Offset to the first data byte
+ * @param[in] ancillary Additional options passed to the stack along with
+ *   the packet
+ * @return Error code
+ **/
+
+error_t linkDriverSendPacket(NetInterface *interface,
+   const NetBuffer *buffer, size_t offset, NetTxAncillary *ancillary)
+{
+   size_t length;
+   uint64_t time;
+   uint64_t backlog;
+   uint64_t dueTime;
+   LinkDriverQueue *queue;
+   LinkDriverQueueEntry *entry;
+
+   //Retrieve the length of the packet
+   length = netBufferGetLength(buffer) - offset;
+
+   //Check the length of the packet
+   if(length > ETH_MTU)
+      return ERROR_INVALID_LENGTH;
+
+   //Get current time
+   time = benchGetTime();
+
+   //Acquire exclusive access to the queues
+   osAcquireMutex(&linkDriverMutex);
+
+   //Pure ACK?
+   if(length <= LINK_DRIVER_RETURN_PATH_SIZE)
+   {
+      //The return path only adds the propagation delay
+      queue = &linkDriverReturnQueue;
+      dueTime = time + (uint64_t) linkDriverParams.delay * 1000000;
+   }
+   else if(linkDriverParams.lossRate > 0 && linkDriverDrawLoss())
+   {
+      //The packet is lost
+      queue = NULL;
+      dueTime = 0;
+      linkDriverStats.losses++;
+   }
+   else if(linkDriverParams.rate == 0)
+   {
+      //The rate of the forward path is not limited
+      queue = &linkDriverDataQueue;
+      dueTime = time + (uint64_t) linkDriverParams.delay * 1000000;
+      linkDriverStats.packets++;
+   }
+   else
+   {
+      //Number of packets waiting for the bottleneck
+      if(linkDriverDepartureTime > time)
+      {
+         backlog = (linkDriverDepartureTime - time) * linkDriverParams.rate /
+            1000000000 / length;
+      }
+      else
+      {
+         backlog = 0;
+      }
+
+      //Drop-tail queue
+      if(backlog >= linkDriverParams.queueSize)
+      {
+         //The packet is lost
+         queue = NULL;
+         dueTime = 0;
+         linkDriverStats.drops++;
+      }
+      else
+      {
+         //The packet leaves the bottleneck once the packets ahead of it
+         //have been serialized
+         linkDriverDepartureTime = MAX(linkDriverDepartureTime, time) +
+            (uint64_t) length * 1000000000 / linkDriverParams.rate;
+
+         //Then it incurs the propagation delay
+         queue = &linkDriverDataQueue;
+         dueTime = linkDriverDepartureTime +
+            (uint64_t) linkDriverParams.delay * 1000000;
+         linkDriverStats.packets++;
+      }
+   }
+
+   //Any room left in the queue?
+   if(queue != NULL && queue->length < LINK_DRIVER_QUEUE_SIZE)
+   {
+      //Point to the next entry
+      entry = &queue->entries[queue->writeIndex];
+
+      //Copy the packet
+      entry->dueTime = dueTime;
+      entry->length = length;
+      netBufferRead(entry->data, buffer, offset, length);
+
+      //Increment index and wrap around if necessary
+      if(++queue->writeIndex >= LINK_DRIVER_QUEUE_SIZE)
+      {
+         queue->writeIndex = 0;
+      }
+
+      //Update the length of the queue
+      queue->length++;
+   }
+
+   //Release exclusive access to the queues
+   osReleaseMutex(&linkDriverMutex);
+
+   //The emulated link is ready to send the next packet
+   osSetEvent(&interface->nicTxEvent);
+
+   //Lost packets are reported as sent
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Decide whether the next data packet is lost
+ * @return TRUE if the packet is lost, else FALSE
+ **/
+
+bool_t linkDriverDrawLoss(void)
+{
+   //Linear congruential generator
+   linkDriverLossState = linkDriverLossState * 1103515245 + 12345;
+
+   //The upper bits have the longest period
+   return (((linkDriverLossState >> 16) % 1000) < linkDriverParams.lossRate) ?
+      TRUE : FALSE;
+}
+
+
+/**
+ * @brief Configure MAC address filtering
+ * @param[in] interface Underlying network interface
+ * @return Error code
+ **/
+
+error_t linkDriverUpdateMacAddrFilter(NetInterface *interface)
+{
+   //Not implemented
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Task notifying the stack when a packet is due
+ * @param[in] param Unused parameter
+ **/
+
+void linkDriverTask(void *param)
+{
+   bool_t due;
+   uint64_t time;
+
+   //Endless loop
+   while(1)
+   {
+      //Poll the queues every millisecond
+      osDelayTask(1);
+
+      //Get current time
+      time = benchGetTime();
+
+      //Acquire exclusive access to the queues
+      osAcquireMutex(&linkDriverMutex);
+
+      //Check whether a packet is due on either path
+      due = (linkDriverDataQueue.length > 0 && time >=
+         linkDriverDataQueue.entries[linkDriverDataQueue.readIndex].dueTime) ||
+         (linkDriverReturnQueue.length > 0 && time >=
+         linkDriverReturnQueue.entries[linkDriverReturnQueue.readIndex].dueTime);
+
+      //Release exclusive access to the queues
+      osReleaseMutex(&linkDriverMutex);
+
+      //Notify the TCP/IP stack of the event
+      if(due && linkDriverInterface != NULL)
+      {
+         linkDriverInterface->nicEvent = TRUE;
+         osSetEvent(&netEvent);
+      }
+   }
+}
@@ -34,6 +34,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <sys/stat.h>
 
 #ifdef _WIN32
    #include <direct.h>
@@ -56,6 +58,11 @@
 #define ERROR_OPEN_FAILED      -3
 #define ERROR_INVALID_RESOURCE -4
 
+//Size of the entity tag field
+#define RES_ETAG_SIZE 24
+//Size of the Last-Modified date field
+#define RES_DATE_SIZE 32
+
 
 /**
  * @brief Resource type
@@ -63,8 +70,9 @@
 
 typedef enum
 {
-   RES_TYPE_DIR  = 1,
-   RES_TYPE_FILE = 2
+   RES_TYPE_DIR     = 1,
+   RES_TYPE_FILE    = 2,
+   RES_TYPE_FILE_EX = 3
 } tResType;
 
 
@@ -97,10 +105,29 @@ typedef struct
 } tResHeader;
 
 
+/**
+ * @brief File information record (precedes the payload of RES_TYPE_FILE_EX entries)
+ **/
+
+typedef struct
+{
+   uint32_t dataLength;
+   uint32_t lastModified;
+   char etag[RES_ETAG_SIZE];
+   char date[RES_DATE_SIZE];
+} tResFileInfo;
+
+
 //Restore previous settings for data aligment
 #pragma pack(pop)
 
 
+//Payload alignment
+static uint32_t dataAlignment = 4;
+//Generate file information records
+static int fileInfoEnabled = 0;
+
+
 #ifndef _WIN32
 
 /**
@@ -271,6 +298,59 @@ int addFile(const char *filename, uint8_t *data, uint32_t maxSize, uint32_t *len
 }
 
 
+/**
+ * @brief Fill the information record that precedes a file payload
+ * @param[in] filename Path to the filename
+ * @param[in] payload Pointer to the file contents
+ * @param[in] length Length of the file
+ * @param[out] info Pointer to the file information record
+ * @return Status code
+ **/
+
+int addFileInfo(const char *filename, const uint8_t *payload, uint32_t length,
+   tResFileInfo *info)
+{
+   uint32_t i;
+   uint64_t h;
+   time_t t;
+   struct tm *tm;
+   struct stat st;
+
+   //Retrieve the modification time of the file
+   if(stat(filename, &st) != 0)
+      return ERROR_FAILURE;
+
+   //Compute the FNV-1a hash of the contents. Any change to the file yields
+   //a different tag, which is all a strong validator requires
+   for(h = 0xCBF29CE484222325ULL, i = 0; i < length; i++)
+   {
+      h ^= payload[i];
+      h *= 0x00000100000001B3ULL;
+   }
+
+   //Format the entity tag as a quoted string
+   sprintf(info->etag, "\"%08x%08x\"", (unsigned int) (h >> 32),
+      (unsigned int) h);
+
+   //Save the length of the payload
+   info->dataLength = length;
+   //Save the modification time (Unix time)
+   t = st.st_mtime;
+   info->lastModified = (uint32_t) t;
+
+   //Format the date as specified by RFC 7231 (IMF-fixdate)
+   tm = gmtime(&t);
+   //Invalid time?
+   if(tm == NULL)
+      return ERROR_FAILURE;
+
+   strftime(info->date, RES_DATE_SIZE, "%a, %d %b %Y %H:%M:%S GMT", tm);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief Add the contents of a directory to the resource data
  * @param[in] parentOffset Offset of the parent directory
@@ -413,7 +493,8 @@ int addDirectory(uint32_t parentOffset, uint32_t parentSize,
 
          //Add a new entry
          entry = (tResEntry *) (data + i);
-         entry->type = (findData.attrib & _A_SUBDIR) ? RES_TYPE_DIR : RES_TYPE_FILE;
+         entry->type = (findData.attrib & _A_SUBDIR) ? RES_TYPE_DIR :
+            (fileInfoEnabled ? RES_TYPE_FILE_EX : RES_TYPE_FILE);
          entry->dataOffset = 0;
          entry->dataLength = 0;
          entry->nameLength = strlen(findData.name);
@@ -458,7 +539,8 @@ int addDirectory(uint32_t parentOffset, uint32_t parentSize,
 
          //Add a new entry
          entry = (tResEntry *) (data + i);
-         entry->type = (dirEntry->d_type == DT_DIR) ? RES_TYPE_DIR : RES_TYPE_FILE;
+         entry->type = (dirEntry->d_type == DT_DIR) ? RES_TYPE_DIR :
+            (fileInfoEnabled ? RES_TYPE_FILE_EX : RES_TYPE_FILE);
          entry->dataOffset = 0;
          entry->dataLength = 0;
          entry->nameLength = strlen(dirEntry->d_name);
@@ -501,6 +583,30 @@ int addDirectory(uint32_t parentOffset, uint32_t parentSize,
       {
          //Data must be aligned on 4-byte boundaries
          ResHeader->totalSize = (ResHeader->totalSize + 3) / 4 * 4;
+
+         //Files with metadata are preceded by their information record
+         if(entry->type == RES_TYPE_FILE_EX)
+         {
+            //The payload is aligned on the requested boundary and the record
+            //is stored immediately before it
+            ResHeader->totalSize = (ResHeader->totalSize + sizeof(tResFileInfo) +
+               dataAlignment - 1) / dataAlignment * dataAlignment;
+
+            //Make sure the maximum size is not exceeded
+            if(ResHeader->totalSize > maxSize)
+            {
+#ifdef _WIN32
+               //Close find search handle
+               _findclose(hFind);
+#else
+               //Close directory
+               closedir(dir);
+#endif
+               //Report an error
+               return ERROR_FILE_TOO_LARGE;
+            }
+         }
+
          //Set data offset
          entry->dataOffset = ResHeader->totalSize;
 
@@ -528,6 +634,15 @@ int addDirectory(uint32_t parentOffset, uint32_t parentSize,
          {
             //Add the contents of the file to the resource data
             error = addFile(path, data, maxSize, &entry->dataLength);
+
+            //Check status code
+            if(!error && entry->type == RES_TYPE_FILE_EX)
+            {
+               //Fill the information record that precedes the payload
+               error = addFileInfo(path, data + entry->dataOffset,
+                  entry->dataLength, (tResFileInfo *) (data +
+                  entry->dataOffset - sizeof(tResFileInfo)));
+            }
          }
 
          //Any error to report?
@@ -660,13 +775,15 @@ int main(int argc, char *argv[])
    FILE *fp;
 
    //Check parameters
-   if(argc != 3 && argc != 4)
+   if(argc < 3 || argc > 5)
    {
       //Print command syntax
-      printf("Usage: rc.exe input output [maxsize]\r\n");
+      printf("Usage: rc.exe input output [maxsize [align]]\r\n");
       printf("  - input:   Source directory to include in resource file\r\n");
       printf("  - output:  Compiled resource file\r\n");
       printf("  - maxsize: Maximum size of the resource file\r\n");
+      printf("  - align:   Payload alignment (power of two). When specified, each\r\n");
+      printf("             file is preceded by its length, ETag and modification date\r\n");
       printf("Copyright (c) 2010-2017 Oryx Embedded\r\n");
       //Report an error
       return ERROR_FAILURE;
@@ -678,7 +795,24 @@ int main(int argc, char *argv[])
    destFile = argv[2];
 
    //Maximum size of the resulting resource file
-   maxSize = (argc == 4) ? atoi(argv[3]) : (1024 * 1024);
+   maxSize = (argc >= 4) ? atoi(argv[3]) : (1024 * 1024);
+
+   //Payload alignment specified?
+   if(argc == 5)
+   {
+      //Retrieve the alignment boundary
+      dataAlignment = atoi(argv[4]);
+
+      //The alignment must be a power of two, at least 4 bytes
+      if(dataAlignment < 4 || (dataAlignment & (dataAlignment - 1)) != 0)
+      {
+         printf("Error: Invalid alignment!\r\n");
+         return ERROR_FAILURE;
+      }
+
+      //Generate file information records
+      fileInfoEnabled = 1;
+   }
 
 #ifdef _WIN32
    //Split source directory
@@ -782,8 +916,28 @@ int main(int argc, char *argv[])
          return ERROR_FAILURE;
       }
 
-      //Write header
-      fprintf(fp, "const unsigned char %s[] =\n", filename);
+      //Aligned payloads?
+      if(fileInfoEnabled)
+      {
+         //The array itself must be aligned for the payload alignment to hold
+         fprintf(fp, "#if defined(__ICCARM__)\n");
+         fprintf(fp, "#pragma data_alignment = %u\n", dataAlignment);
+         fprintf(fp, "#define RES_ALIGNED\n");
+         fprintf(fp, "#elif defined(_MSC_VER)\n");
+         fprintf(fp, "#define RES_ALIGNED\n");
+         fprintf(fp, "#else\n");
+         fprintf(fp, "#define RES_ALIGNED __attribute__((aligned(%u)))\n", dataAlignment);
+         fprintf(fp, "#endif\n\n");
+
+         //Write header
+         fprintf(fp, "const unsigned char %s[] RES_ALIGNED =\n", filename);
+      }
+      else
+      {
+         //Write header
+         fprintf(fp, "const unsigned char %s[] =\n", filename);
+      }
+
       fprintf(fp, "{\n");
 
       //Write data